@@ -0,0 +1,60 @@
+#include <cylindrical_cell.hpp>
+
+#include <c5g7.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+// Time to compute the collision probabilities and solve the response
+// systems of a UO2 pin cell of the C5G7 benchmark, with the fuel divided in
+// 10 rings of equal volume and the moderator in 4, as in a self-shielding
+// calculation. The cell is rebuilt for each iteration, so that no group is
+// skipped as already computed.
+void BM_cylindrical_cell_cp(benchmark::State& state) {
+  const auto ki3_mode = static_cast<Ki3Mode>(state.range(0));
+  const auto cp_quad = static_cast<CPQuadrature>(state.range(1));
+  const auto uo2 = bench::c5g7_uo2();
+  const auto h2o = bench::c5g7_h2o();
+
+  const double Rfuel = 0.4095;
+  const double Rcell = 0.71;  // Radius of a cell with the area of the pitch
+  std::vector<double> radii;
+  std::vector<std::shared_ptr<CrossSection>> mats;
+  for (std::size_t i = 1; i <= 10; i++) {
+    radii.push_back(Rfuel * std::sqrt(static_cast<double>(i) / 10.));
+    mats.push_back(uo2);
+  }
+  for (std::size_t i = 1; i <= 4; i++) {
+    radii.push_back(Rfuel + (Rcell - Rfuel) * static_cast<double>(i) / 4.);
+    mats.push_back(h2o);
+  }
+
+  for (auto _ : state) {
+    CylindricalCell cell(radii, mats);
+    cell.set_ki3_mode(ki3_mode);
+    cell.set_cp_quadrature(cp_quad);
+    cell.solve();
+    benchmark::DoNotOptimize(cell.Gamma(0));
+  }
+}
+BENCHMARK(BM_cylindrical_cell_cp)
+    ->ArgNames({"ki3_mode", "quadrature"})
+    ->Args({static_cast<int>(Ki3Mode::Series),
+            static_cast<int>(CPQuadrature::Adaptive)})
+    ->Args({static_cast<int>(Ki3Mode::Table),
+            static_cast<int>(CPQuadrature::Adaptive)})
+    ->Args({static_cast<int>(Ki3Mode::Series),
+            static_cast<int>(CPQuadrature::FixedNodes)})
+    ->Args({static_cast<int>(Ki3Mode::Table),
+            static_cast<int>(CPQuadrature::FixedNodes)})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,83 @@
+#include <data/depletion_matrix.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+// Depletion matrix with the size and stiffness of a full burnup chain, for a
+// time step of 30 days. Each nuclide decays or transmutes into the next two
+// nuclides of similar mass, and the heavy nuclides at the end fission into
+// the light nuclides, with removal rates ranging from 1E-12 to 1E2 s^-1.
+DepletionMatrix depletion_matrix() {
+  const std::vector<std::string> symbols{
+      "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Zr", "Nb", "Mo", "Tc", "Ru",
+      "Rh", "Pd", "Ag", "Cd", "In", "Sn", "Sb", "Te", "Xe", "Cs", "Ba", "La",
+      "Ce", "Pr", "Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Th", "Pa", "Np",
+      "Pu", "Am", "Cm", "Bk", "Cf"};
+  std::vector<std::string> nuclides;
+  for (const auto& sym : symbols) {
+    for (std::size_t A = 200; A < 240; A++) {
+      nuclides.push_back(sym + std::to_string(A));
+    }
+  }
+
+  DepletionMatrix M(nuclides);
+  const std::size_t N = M.size();
+  const std::size_t nfp = N - 200;  // The last 200 nuclides are fissile
+  const double dt = 30. * 24. * 3600.;
+
+  std::mt19937_64 rng(1234);
+  std::uniform_real_distribution<double> log_rate(-12., 2.);
+  std::uniform_real_distribution<double> branch(0., 1.);
+  std::uniform_int_distribution<std::size_t> fp(0, nfp - 1);
+
+  for (std::size_t i = 0; i < N; i++) {
+    const double lambda = std::pow(10., log_rate(rng)) * dt;
+    M.ref(i, i) -= lambda;
+
+    if (i >= nfp) {
+      // Fission into 40 randomly chosen fission products
+      for (std::size_t k = 0; k < 40; k++) M.ref(fp(rng), i) += lambda / 20.;
+    } else {
+      const double b = branch(rng);
+      if (i + 1 < nfp) M.ref(i + 1, i) += b * lambda;
+      if (i + 2 < nfp) M.ref(i + 2, i) += (1. - b) * lambda;
+    }
+  }
+
+  M.compress();
+  return M;
+}
+
+void BM_depletion_exponential_product(benchmark::State& state) {
+  const bool cram48 = state.range(0) == 48;
+  const auto solver = static_cast<CRAMSolver>(state.range(1));
+  const DepletionMatrix M = depletion_matrix();
+  const std::vector<double> N0(M.size(), 1.E20);
+  std::vector<double> N(M.size());
+
+  for (auto _ : state) {
+    N = N0;
+    M.exponential_product(N, cram48, solver);
+    benchmark::DoNotOptimize(N.data());
+  }
+
+  state.counters["nuclides"] = static_cast<double>(M.size());
+}
+BENCHMARK(BM_depletion_exponential_product)
+    ->ArgNames({"order", "solver"})
+    ->Args({16, static_cast<int>(CRAMSolver::Elimination)})
+    ->Args({48, static_cast<int>(CRAMSolver::Elimination)})
+    ->Args({16, static_cast<int>(CRAMSolver::SparseLU)})
+    ->Args({48, static_cast<int>(CRAMSolver::SparseLU)})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,149 @@
+#include <data/diffusion_cross_section.hpp>
+#include <diffusion/diffusion_geometry.hpp>
+#include <diffusion/nem_diffusion_driver.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+std::shared_ptr<DiffusionCrossSection> iaea_xs(double Et1, double Et2,
+                                               double Ea1, double Ea2,
+                                               double Es11, double Es12,
+                                               double Es22, bool fissile,
+                                               const std::string& name) {
+  const xt::xtensor<double, 1> D = {1. / (3. * Et1), 1. / (3. * Et2)};
+  const xt::xtensor<double, 1> Ea = {Ea1, Ea2};
+  const xt::xtensor<double, 2> Es = {{Es11, Es12}, {0., Es22}};
+  if (fissile == false) {
+    return std::make_shared<DiffusionCrossSection>(D, Ea, Es, name);
+  }
+  const xt::xtensor<double, 1> vEf = {0., 0.135};
+  const xt::xtensor<double, 1> chi = {1., 0.};
+  return std::make_shared<DiffusionCrossSection>(D, Ea, Es, vEf, vEf, chi,
+                                                 name);
+}
+
+// Quarter core of the IAEA 3D benchmark, with half assemblies on the
+// reflective boundaries, as in examples/nem_iaea3d.py
+std::shared_ptr<DiffusionGeometry> iaea3d_geometry() {
+  const auto a1 = iaea_xs(0.222222, 0.833333, 0.010, 0.080, 0.1922, 0.020,
+                          0.7533, true, "A1");
+  const auto a2 = iaea_xs(0.222222, 0.833333, 0.010, 0.085, 0.1922, 0.020,
+                          0.7483, true, "A2");
+  const auto a3 = iaea_xs(0.222222, 0.833333, 0.010, 0.130, 0.1922, 0.020,
+                          0.7033, true, "A3");
+  const auto a4 = iaea_xs(0.166667, 1.111111, 0.000, 0.010, 0.1267, 0.040,
+                          1.1011, false, "A4");
+  const auto a5 = iaea_xs(0.166667, 1.111111, 0.000, 0.055, 0.0, 0.040, 0.0,
+                          false, "A5");
+
+  // One character per tile, for the four axial layers from top to bottom.
+  // A 0 is a vacuum tile outside the core.
+  const std::array<const char*, 4> layers{
+      "544454444"
+      "444444444"
+      "445444444"
+      "444444444"
+      "544454440"
+      "444444440"
+      "444444400"
+      "444444000"
+      "444400000",
+      "322232214"
+      "222222214"
+      "223222114"
+      "222222144"
+      "322231140"
+      "222211440"
+      "221114400"
+      "111444000"
+      "444400000",
+      "322232214"
+      "222222214"
+      "222222114"
+      "222222144"
+      "322231140"
+      "222211440"
+      "221114400"
+      "111444000"
+      "444400000",
+      "444444444"
+      "444444444"
+      "444444444"
+      "444444444"
+      "444444440"
+      "444444440"
+      "444444400"
+      "444444000"
+      "444400000"};
+
+  std::vector<DiffusionGeometry::TileFill> tiles;
+  for (const char* layer : layers) {
+    for (const char* c = layer; *c != '\0'; c++) {
+      switch (*c) {
+        case '1':
+          tiles.push_back(a1);
+          break;
+        case '2':
+          tiles.push_back(a2);
+          break;
+        case '3':
+          tiles.push_back(a3);
+          break;
+        case '4':
+          tiles.push_back(a4);
+          break;
+        case '5':
+          tiles.push_back(a5);
+          break;
+        default:
+          tiles.push_back(0.);
+      }
+    }
+  }
+
+  const std::vector<double> dx{10., 20., 20., 20., 20., 20., 20., 20., 20.};
+  const std::vector<std::size_t> nx{1, 2, 2, 2, 2, 2, 2, 2, 2};
+  const std::vector<double> dy{20., 20., 20., 20., 20., 20., 20., 20., 10.};
+  const std::vector<std::size_t> ny{2, 2, 2, 2, 2, 2, 2, 2, 1};
+  const std::vector<double> dz{20., 13. * 20., 4. * 20., 20.};
+  const std::vector<std::size_t> nz{1, 13, 4, 1};
+
+  return std::make_shared<DiffusionGeometry>(tiles, dx, nx, dy, ny, dz, nz, 1.,
+                                             0., 0., 1., 0., 0.);
+}
+
+// Time of the inner iteration of the NEM solver, which updates the nodal
+// flux expansions and partial currents of all nodes once, averaged over the
+// outer iterations of a keff solve.
+void BM_nem_inner_iteration_iaea3d(benchmark::State& state) {
+  const auto geom = iaea3d_geometry();
+  NEMDiffusionDriver nem(geom);
+
+  for (auto _ : state) {
+    nem.solve();
+    const auto& tel = nem.telemetry();
+    const double nouter =
+        static_cast<double>(std::max<std::size_t>(tel.iterations(), 1));
+    state.SetIterationTime(tel.phase_time("inner_iteration") / nouter);
+  }
+
+  state.counters["keff"] = nem.keff();
+}
+BENCHMARK(BM_nem_inner_iteration_iaea3d)
+    ->UseManualTime()
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,111 @@
+#include <utils/exp_table.hpp>
+#include <utils/ki3_table.hpp>
+#include <utils/math.hpp>
+#include <utils/simd_kernels.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <xsimd/xsimd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+// Optical thicknesses spread as those of the segments of an MOC sweep, most
+// of them below 1, with a tail of optically thick segments.
+std::vector<double> optical_thicknesses(std::size_t n, double x_max) {
+  std::mt19937_64 rng(1234);
+  std::exponential_distribution<double> dist(2.);
+  std::vector<double> x(n);
+  for (auto& xi : x) {
+    xi = dist(rng);
+    if (xi > x_max) xi = x_max;
+  }
+  return x;
+}
+
+constexpr std::int64_t NPOINTS = 4096;
+constexpr std::size_t N = static_cast<std::size_t>(NPOINTS);
+
+void BM_mexp(benchmark::State& state) {
+  const auto x = optical_thicknesses(N, 50.);
+  for (auto _ : state) {
+    double sum = 0.;
+    for (const double xi : x) sum += mexp(xi);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NPOINTS);
+}
+BENCHMARK(BM_mexp);
+
+void BM_mexp_batch(benchmark::State& state) {
+  using batch = xsimd::batch<double>;
+  constexpr std::size_t W = batch::size;
+  const auto x = optical_thicknesses(N, 50.);
+  for (auto _ : state) {
+    batch sum(0.);
+    for (std::size_t i = 0; i + W <= x.size(); i += W) {
+      sum += mexp(batch::load_unaligned(x.data() + i));
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NPOINTS);
+}
+BENCHMARK(BM_mexp_batch);
+
+// Same as above, with the instruction set chosen at run time
+void BM_mexp_array(benchmark::State& state) {
+  const auto x = optical_thicknesses(N, 50.);
+  std::vector<double> out(x.size());
+  for (auto _ : state) {
+    mexp_array(x.data(), out.data(), x.size());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * NPOINTS);
+  state.SetLabel(simd_architecture());
+}
+BENCHMARK(BM_mexp_array);
+
+void BM_exp_table(benchmark::State& state) {
+  const ExpTable table;
+  const auto x = optical_thicknesses(N, 50.);
+  for (auto _ : state) {
+    double sum = 0.;
+    for (const double xi : x) sum += table(xi);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NPOINTS);
+}
+BENCHMARK(BM_exp_table);
+
+void BM_Ki3_series(benchmark::State& state) {
+  const auto x = optical_thicknesses(N, 20.);
+  for (auto _ : state) {
+    double sum = 0.;
+    for (const double xi : x) sum += Ki3(xi);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * NPOINTS);
+}
+BENCHMARK(BM_Ki3_series);
+
+void BM_Ki3_table(benchmark::State& state) {
+  const Ki3Table table;
+  const auto x = optical_thicknesses(N, 20.);
+  std::vector<double> out(x.size());
+  for (auto _ : state) {
+    table.evaluate(x.data(), out.data(), x.size());
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * NPOINTS);
+}
+BENCHMARK(BM_Ki3_table);
+
+}  // namespace
@@ -0,0 +1,112 @@
+#include <moc/cartesian_2d.hpp>
+#include <moc/cmfd.hpp>
+#include <moc/moc_driver.hpp>
+#include <moc/pin_cell.hpp>
+#include <moc/quadrature/yamamoto_tabuchi.hpp>
+
+#include <c5g7.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+constexpr double PITCH = 1.26;
+constexpr std::size_t NPINS = 17;
+
+// UO2 assembly of the C5G7 benchmark, with reflective boundaries
+std::shared_ptr<Cartesian2D> c5g7_uo2_assembly() {
+  const auto uo2 = bench::c5g7_uo2();
+  const auto h2o = bench::c5g7_h2o();
+  const auto gt = bench::c5g7_guide_tube();
+
+  const std::vector<double> radii{0.4, 0.54, 0.63};
+  const auto U2 = std::make_shared<PinCell>(
+      radii, std::vector{uo2, uo2, h2o, h2o}, PITCH, PITCH);
+  const auto GT = std::make_shared<PinCell>(
+      radii, std::vector{gt, gt, h2o, h2o}, PITCH, PITCH);
+
+  // Guide tube positions of a 17x17 assembly, including the central
+  // instrumentation tube
+  const std::vector<std::pair<std::size_t, std::size_t>> gt_pos{
+      {2, 5},  {2, 8},  {2, 11},  {3, 3},   {3, 13},  {5, 2},   {5, 5},
+      {5, 8},  {5, 11}, {5, 14},  {8, 2},   {8, 5},   {8, 8},   {8, 11},
+      {8, 14}, {11, 2}, {11, 5},  {11, 8},  {11, 11}, {11, 14}, {13, 3},
+      {13, 13}, {14, 5}, {14, 8}, {14, 11}};
+
+  std::vector<Cartesian2D::TileFill> fills(NPINS * NPINS, U2);
+  for (const auto& [j, i] : gt_pos) fills[j * NPINS + i] = GT;
+
+  const std::vector<double> dx(NPINS, PITCH);
+  auto geom = std::make_shared<Cartesian2D>(dx, dx);
+  geom->set_tiles(fills);
+  return geom;
+}
+
+std::shared_ptr<MOCDriver> make_driver(bool cmfd) {
+  auto moc = std::make_shared<MOCDriver>(c5g7_uo2_assembly());
+
+  if (cmfd) {
+    const std::vector<double> dx(NPINS, PITCH);
+    moc->set_cmfd(std::make_shared<CMFD>(
+        dx, dx,
+        std::vector<std::pair<std::size_t, std::size_t>>{
+            {0, 1}, {2, 4}, {5, 6}}));
+  }
+
+  moc->generate_tracks(32, 0.05, YamamotoTabuchi<6>());
+  return moc;
+}
+
+// Time of one transport sweep over all groups, averaged over the outer
+// iterations of a keff solve. Only the sweep phase is timed, not the ray
+// tracing nor the source updates.
+void BM_moc_sweep_c5g7(benchmark::State& state) {
+  const auto moc = make_driver(false);
+
+  double segments_per_second = 0.;
+  for (auto _ : state) {
+    moc->solve();
+    const auto& tel = moc->telemetry();
+    const double nsweeps =
+        static_cast<double>(std::max<std::size_t>(tel.iterations(), 1));
+    state.SetIterationTime(tel.phase_time("sweep") / nsweeps);
+    segments_per_second = tel.segments_per_second();
+  }
+
+  state.counters["nfsr"] = static_cast<double>(moc->nfsr());
+  state.counters["segments_per_second"] = segments_per_second;
+}
+BENCHMARK(BM_moc_sweep_c5g7)
+    ->UseManualTime()
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+// Time of the CMFD assembly and linear solve of one outer iteration, on a
+// pin-wise coarse mesh of three groups.
+void BM_cmfd_c5g7(benchmark::State& state) {
+  const auto moc = make_driver(true);
+
+  for (auto _ : state) {
+    moc->solve();
+    const auto& tel = moc->cmfd()->telemetry();
+    const double nsolves = static_cast<double>(
+        std::max<std::size_t>(moc->telemetry().iterations(), 1));
+    state.SetIterationTime(
+        (tel.phase_time("assembly") + tel.phase_time("linear_solve")) /
+        nsolves);
+  }
+}
+BENCHMARK(BM_cmfd_c5g7)
+    ->UseManualTime()
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
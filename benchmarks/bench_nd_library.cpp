@@ -0,0 +1,85 @@
+#include <data/nd_library.hpp>
+#include <utils/constants.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+// The library given by SCARABEE_ND_LIBRARY, loaded by the first benchmark
+// which needs it. The benchmarks are skipped when it is not set.
+std::shared_ptr<NDLibrary> nd_library() {
+  static std::shared_ptr<NDLibrary> ndl =
+      std::getenv(NDL_ENV_VAR) ? std::make_shared<NDLibrary>() : nullptr;
+  return ndl;
+}
+
+// Random temperatures and dilutions of the resonant groups of U238, in the
+// ranges seen in the self-shielding of LWR fuel
+std::vector<DilutionQuery> u238_queries(const NDLibrary& ndl, std::size_t n) {
+  const std::size_t id = ndl.nuclide_id("U238");
+  std::mt19937_64 rng(1234);
+  std::uniform_int_distribution<std::size_t> group(ndl.first_resonant_group(),
+                                                   ndl.last_resonant_group());
+  std::uniform_real_distribution<double> temp(293.6, 1800.);
+  std::uniform_real_distribution<double> log_dil(1., 5.);
+
+  std::vector<DilutionQuery> queries(n);
+  for (auto& q : queries) {
+    q = {id, group(rng), temp(rng), std::pow(10., log_dil(rng))};
+  }
+  return queries;
+}
+
+constexpr std::int64_t NQUERIES = 1024;
+
+void BM_nd_library_dilution_xs(benchmark::State& state) {
+  const auto ndl = nd_library();
+  if (ndl == nullptr) {
+    state.SkipWithMessage(NDL_ENV_VAR " is not set");
+    return;
+  }
+  ndl->load_nuclides({"U238"});
+  const auto queries = u238_queries(*ndl, static_cast<std::size_t>(NQUERIES));
+
+  for (auto _ : state) {
+    for (const auto& q : queries) {
+      benchmark::DoNotOptimize(ndl->dilution_xs(q.nuclide, q.group,
+                                                q.temperature, q.dilution));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * NQUERIES);
+}
+BENCHMARK(BM_nd_library_dilution_xs);
+
+void BM_nd_library_dilution_xs_batch(benchmark::State& state) {
+  const auto ndl = nd_library();
+  if (ndl == nullptr) {
+    state.SkipWithMessage(NDL_ENV_VAR " is not set");
+    return;
+  }
+  ndl->load_nuclides({"U238"});
+  const auto queries = u238_queries(*ndl, static_cast<std::size_t>(NQUERIES));
+  xt::xtensor<double, 2> out({5, queries.size()});
+
+  for (auto _ : state) {
+    ndl->dilution_xs_batch(queries, out);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * NQUERIES);
+}
+BENCHMARK(BM_nd_library_dilution_xs_batch);
+
+}  // namespace
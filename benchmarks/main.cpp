@@ -0,0 +1,30 @@
+#include <utils/logging.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <pybind11/embed.h>
+namespace py = pybind11;
+
+// Runs the micro-benchmarks of the solver kernels. All the usual options of
+// Google Benchmark are accepted, such that the results may be written as
+// JSON with --benchmark_out=results.json --benchmark_out_format=json, and a
+// subset selected with --benchmark_filter.
+int main(int argc, char** argv) {
+  // The log messages are printed through Python, so an interpreter must be
+  // running for as long as the solvers are.
+  py::scoped_interpreter interpreter;
+
+  // Only keep warnings, so that the solver output does not drown the results
+  scarabee::set_logging_level(scarabee::LogLevel::warn);
+
+  // The benchmarks themselves never touch Python objects, and release the GIL
+  // so that messages logged from worker threads may acquire it.
+  py::gil_scoped_release release;
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+// Standalone C++ driver for a reflected UO2 assembly of the C5G7 benchmark,
+// using the solvers without Python. It is built with
+//
+//   cmake -S . -B build -DSCARABEE_BUILD_LIBRARY=ON \
+//         -DSCARABEE_BUILD_EXAMPLES=ON
+//   cmake --build build --target scarabee_c5g7
+//
+// An installed library may be used in the same way from another project,
+// with find_package(scarabee) and linking to scarabee::scarabee.
+#include <moc/cartesian_2d.hpp>
+#include <moc/cmfd.hpp>
+#include <moc/empty_cell.hpp>
+#include <moc/moc_driver.hpp>
+#include <moc/pin_cell.hpp>
+#include <moc/quadrature/yamamoto_tabuchi.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <c5g7.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace scarabee;
+
+namespace {
+
+constexpr double PITCH = 1.26;
+constexpr std::size_t NPINS = 17;
+
+std::shared_ptr<Cartesian2D> uo2_assembly() {
+  const auto uo2 = bench::c5g7_uo2();
+  const auto h2o = bench::c5g7_h2o();
+  const auto gt = bench::c5g7_guide_tube();
+
+  const std::vector<double> radii{0.4, 0.54, 0.63};
+  const auto U2 = std::make_shared<PinCell>(
+      radii, std::vector{uo2, uo2, h2o, h2o}, PITCH, PITCH);
+  const auto GT = std::make_shared<PinCell>(
+      radii, std::vector{gt, gt, h2o, h2o}, PITCH, PITCH);
+
+  const std::vector<std::pair<std::size_t, std::size_t>> gt_pos{
+      {2, 5},  {2, 8},  {2, 11},  {3, 3},   {3, 13},  {5, 2},   {5, 5},
+      {5, 8},  {5, 11}, {5, 14},  {8, 2},   {8, 5},   {8, 8},   {8, 11},
+      {8, 14}, {11, 2}, {11, 5},  {11, 8},  {11, 11}, {11, 14}, {13, 3},
+      {13, 13}, {14, 5}, {14, 8}, {14, 11}};
+
+  std::vector<Cartesian2D::TileFill> fills(NPINS * NPINS, U2);
+  for (const auto& [j, i] : gt_pos) fills[j * NPINS + i] = GT;
+
+  const std::vector<double> dx(NPINS, PITCH);
+  auto geom = std::make_shared<Cartesian2D>(dx, dx);
+  geom->set_tiles(fills);
+  return geom;
+}
+
+// Assembly of water, with 4x4 flat source regions per pin cell
+std::shared_ptr<Cartesian2D> water_assembly() {
+  constexpr std::size_t NW = 4;
+  const std::vector<double> dw(NW, PITCH / NW);
+  const auto WC =
+      std::make_shared<EmptyCell>(bench::c5g7_h2o(), PITCH / NW, PITCH / NW);
+  auto WT = std::make_shared<Cartesian2D>(dw, dw);
+  WT->set_tiles(std::vector<Cartesian2D::TileFill>(NW * NW, WC));
+
+  const std::vector<double> dx(NPINS, PITCH);
+  auto WAS = std::make_shared<Cartesian2D>(dx, dx);
+  WAS->set_tiles(std::vector<Cartesian2D::TileFill>(NPINS * NPINS, WT));
+  return WAS;
+}
+
+}  // namespace
+
+int main() {
+  try {
+    // Quarter of a mini core, with the UO2 assembly in the reflected corner
+    // at the top left, and water on the vacuum sides
+    const auto UO2 = uo2_assembly();
+    const auto WAS = water_assembly();
+    const std::vector<double> dx(2, NPINS * PITCH);
+    auto core = std::make_shared<Cartesian2D>(dx, dx);
+    core->set_tiles({UO2, WAS, WAS, WAS});
+
+    MOCDriver moc(core, BoundaryCondition::Reflective,
+                  BoundaryCondition::Vacuum, BoundaryCondition::Vacuum,
+                  BoundaryCondition::Reflective);
+
+    const std::vector<double> dx_cmfd(2 * NPINS, PITCH);
+    moc.set_cmfd(std::make_shared<CMFD>(
+        dx_cmfd, dx_cmfd,
+        std::vector<std::pair<std::size_t, std::size_t>>{
+            {0, 1}, {2, 4}, {5, 6}}));
+    moc.generate_tracks(32, 0.05, YamamotoTabuchi<6>());
+    moc.set_keff_tolerance(1.E-5);
+    moc.set_flux_tolerance(1.E-5);
+    moc.solve();
+
+    spdlog::info("keff = {:.5f}", moc.keff());
+  } catch (const ScarabeeException&) {
+    // The error has already been logged
+    return 1;
+  }
+
+  return 0;
+}
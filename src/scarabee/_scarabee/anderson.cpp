@@ -0,0 +1,90 @@
+#include <utils/anderson.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <Eigen/Dense>
+
+namespace scarabee {
+
+AndersonMixer::AndersonMixer(std::size_t depth, double damping)
+    : depth_(depth), damping_(damping) {
+  if (damping_ <= 0. || damping_ > 1.) {
+    const auto mssg = "Anderson damping must be in the interval (0., 1.].";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+void AndersonMixer::reset() {
+  x_prev_.clear();
+  f_prev_.clear();
+  dX_.clear();
+  dF_.clear();
+}
+
+void AndersonMixer::mix(std::vector<double>& x,
+                        const std::vector<double>& gx) {
+  const std::size_t n = x.size();
+  if (gx.size() != n) {
+    const auto mssg = "Anderson iterate and image have different sizes.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // A change of size means a new problem
+  if (x_prev_.empty() == false && x_prev_.size() != n) this->reset();
+
+  std::vector<double> f(n);
+  for (std::size_t i = 0; i < n; i++) f[i] = gx[i] - x[i];
+
+  if (depth_ > 0 && x_prev_.empty() == false) {
+    if (dX_.size() == depth_) {
+      dX_.erase(dX_.begin());
+      dF_.erase(dF_.begin());
+    }
+    dX_.emplace_back(n);
+    dF_.emplace_back(n);
+    for (std::size_t i = 0; i < n; i++) {
+      dX_.back()[i] = x[i] - x_prev_[i];
+      dF_.back()[i] = f[i] - f_prev_[i];
+    }
+  }
+  if (depth_ > 0) {
+    x_prev_ = x;
+    f_prev_ = f;
+  }
+
+  // Coefficients which minimize the norm of f - dF gamma, from the normal
+  // equations, which are small.
+  const std::size_t m = dF_.size();
+  Eigen::VectorXd gamma = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(m));
+  if (m > 0) {
+    Eigen::MatrixXd A(m, m);
+    Eigen::VectorXd b(m);
+    for (std::size_t j = 0; j < m; j++) {
+      b(j) = 0.;
+      for (std::size_t i = 0; i < n; i++) b(j) += dF_[j][i] * f[i];
+      for (std::size_t k = 0; k <= j; k++) {
+        double Ajk = 0.;
+        for (std::size_t i = 0; i < n; i++) Ajk += dF_[j][i] * dF_[k][i];
+        A(j, k) = Ajk;
+        A(k, j) = Ajk;
+      }
+    }
+
+    // Small regularization, as the differences become nearly dependent
+    // close to convergence.
+    A.diagonal().array() += 1.E-12 * A.trace() / static_cast<double>(m);
+    gamma = A.ldlt().solve(b);
+  }
+
+  for (std::size_t i = 0; i < n; i++) {
+    double xi = x[i] + damping_ * f[i];
+    for (std::size_t j = 0; j < m; j++) {
+      xi -= gamma(j) * (dX_[j][i] + damping_ * dF_[j][i]);
+    }
+    x[i] = xi;
+  }
+}
+
+}  // namespace scarabee
@@ -213,6 +213,8 @@ BWRCornerPinCell::BWRCornerPinCell(
       build_IV();
       break;
   }
+
+  this->build_fsr_index();
 }
 
 void BWRCornerPinCell::build_I() {
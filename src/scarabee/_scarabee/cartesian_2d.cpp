@@ -4,6 +4,7 @@
 #include <utils/constants.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <optional>
 
 namespace scarabee {
@@ -13,7 +14,6 @@ Cartesian2D::Cartesian2D(const std::vector<std::shared_ptr<Surface>>& x_bounds,
     : x_bounds_(x_bounds),
       y_bounds_(y_bounds),
       tiles_(),
-      fsr_offset_map_(),
       nx_(),
       ny_() {
   // First, make sure we have at least 2 bounds in each direction
@@ -53,8 +53,6 @@ Cartesian2D::Cartesian2D(const std::vector<std::shared_ptr<Surface>>& x_bounds,
   // All tiles start as uninitialized
   tiles_.resize({nx_, ny_});
   tiles_.fill(Tile{nullptr, nullptr});
-
-  fsr_offset_map_.resize({nx_, ny_});
 }
 
 Cartesian2D::Cartesian2D(const std::vector<double>& dx,
@@ -119,8 +117,6 @@ Cartesian2D::Cartesian2D(const std::vector<double>& dx,
   // All tiles start as uninitialized
   tiles_.resize({nx_, ny_});
   tiles_.fill(Tile{nullptr, nullptr});
-
-  fsr_offset_map_.resize({nx_, ny_});
 }
 
 void Cartesian2D::set_tile(const TileIndex& ti,
@@ -259,7 +255,7 @@ UniqueFSR Cartesian2D::get_fsr(const Vector& r, const Direction& u) const {
 
   // Get unique ID
   if (out.fsr) {
-    out.instance += fsr_offset_map_(ti->i, ti->j).find(out.fsr->id())->second;
+    out.instance += fsr_offset(*ti, out.fsr->id());
   }
 
   return out;
@@ -298,7 +294,7 @@ std::vector<UniqueFSR> Cartesian2D::get_all_fsr_in_cell(
   for (auto& outi : out) {
     // Shouldn't need to check pointer, as the vector should only containvalid
     // valid FSRs
-    outi.instance += fsr_offset_map_(ti->i, ti->j).find(outi.fsr->id())->second;
+    outi.instance += fsr_offset(*ti, outi.fsr->id());
   }
 
   return out;
@@ -382,22 +378,29 @@ void Cartesian2D::fill_fsrs(
 }
 
 void Cartesian2D::make_offset_map() {
-  auto fsr_ids = this->get_all_fsr_ids();
-
-  // Set all offsets to be zero
-  for (auto& map : fsr_offset_map_) {
-    for (std::size_t fsr_id : fsr_ids) {
-      map[fsr_id] = 0;
-    }
-  }
-
-  // Now go through and build all offsets
+  const auto fsr_ids = this->get_all_fsr_ids();
+  nfsr_ids_ = fsr_ids.size();
+  fsr_local_.clear();
+  fsr_offsets_.clear();
+  if (fsr_ids.empty()) return;
+
+  // The ids are sorted, and mostly consecutive, as the FSRs of a cell are
+  // all made together
+  fsr_id_min_ = *fsr_ids.begin();
+  fsr_local_.assign(*fsr_ids.rbegin() - fsr_id_min_ + 1, 0);
+  std::uint32_t local = 0;
+  for (const auto fsr_id : fsr_ids) fsr_local_[fsr_id - fsr_id_min_] = local++;
+
+  // All offsets of the first tile are zero. Then go through and build all
+  // other offsets.
+  fsr_offsets_.assign(tiles_.size() * nfsr_ids_, 0);
   for (std::size_t i = 1; i < tiles_.size(); i++) {
     const auto& t = tiles_.flat(i - 1);
 
-    for (std::size_t fsr_id : fsr_ids) {
-      fsr_offset_map_.flat(i)[fsr_id] = fsr_offset_map_.flat(i - 1)[fsr_id];
-      fsr_offset_map_.flat(i)[fsr_id] += t.get_num_fsr_instances(fsr_id);
+    for (const auto fsr_id : fsr_ids) {
+      const std::size_t l = fsr_local_[fsr_id - fsr_id_min_];
+      fsr_offsets_[i * nfsr_ids_ + l] = fsr_offsets_[(i - 1) * nfsr_ids_ + l] +
+                                        t.get_num_fsr_instances(fsr_id);
     }
   }
 }
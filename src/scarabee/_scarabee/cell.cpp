@@ -2,6 +2,9 @@
 #include <utils/scarabee_exception.hpp>
 #include <utils/logging.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
 #include <sstream>
 
 namespace scarabee {
@@ -67,6 +70,105 @@ void Cell::check_surfaces() const {
   }
 }
 
+void Cell::build_fsr_index() {
+  constexpr std::size_t MAX_GRID_BINS = 32;  // Along each direction
+  constexpr std::size_t NSAMPLES = 4;        // Along each direction, per bin
+
+  for (auto& fsr : fsrs_) fsr.compile();
+
+  // Roughly one bin per FSR
+  const double nfsrs = static_cast<double>(fsrs_.size());
+  grid_n_ = static_cast<std::size_t>(std::ceil(std::sqrt(nfsrs)));
+  grid_n_ = std::clamp(grid_n_, std::size_t{1}, MAX_GRID_BINS);
+
+  // The candidates of each bin are the FSRs found on sample points of the
+  // bin, sorted by number of hits. Small FSRs may be missed by the samples,
+  // which is fine as get_fsr falls back on testing all FSRs.
+  grid_offsets_.assign(1, 0);
+  grid_fsrs_.clear();
+  const double bin_dx = this->dx() / static_cast<double>(grid_n_);
+  const double bin_dy = this->dy() / static_cast<double>(grid_n_);
+  const Direction u(1., 0.);
+  std::vector<std::size_t> hits(fsrs_.size(), 0);
+  std::vector<std::uint32_t> candidates;
+  for (std::size_t j = 0; j < grid_n_; j++) {
+    for (std::size_t i = 0; i < grid_n_; i++) {
+      std::fill(hits.begin(), hits.end(), 0);
+      for (std::size_t sj = 0; sj < NSAMPLES; sj++) {
+        const double y = y_min_->y0() + bin_dy * (static_cast<double>(j) +
+                                                   (sj + 0.5) / NSAMPLES);
+        for (std::size_t si = 0; si < NSAMPLES; si++) {
+          const double x = x_min_->x0() + bin_dx * (static_cast<double>(i) +
+                                                     (si + 0.5) / NSAMPLES);
+          for (std::size_t f = 0; f < fsrs_.size(); f++) {
+            if (fsrs_[f].inside(Vector(x, y), u)) {
+              hits[f]++;
+              break;
+            }
+          }
+        }
+      }
+
+      candidates.clear();
+      for (std::size_t f = 0; f < fsrs_.size(); f++) {
+        if (hits[f] > 0) candidates.push_back(static_cast<std::uint32_t>(f));
+      }
+      std::stable_sort(candidates.begin(), candidates.end(),
+                       [&hits](std::uint32_t a, std::uint32_t b) {
+                         return hits[a] > hits[b];
+                       });
+      grid_fsrs_.insert(grid_fsrs_.end(), candidates.begin(),
+                        candidates.end());
+      grid_offsets_.push_back(grid_fsrs_.size());
+    }
+  }
+
+  // Neighbors are the FSRs which share at least one surface
+  std::map<const Surface*, std::vector<std::uint32_t>> surf_fsrs;
+  for (std::size_t f = 0; f < fsrs_.size(); f++) {
+    for (const auto& token : fsrs_[f].tokens()) {
+      surf_fsrs[token.surface.get()].push_back(static_cast<std::uint32_t>(f));
+    }
+  }
+
+  neighbor_offsets_.assign(1, 0);
+  neighbor_fsrs_.clear();
+  for (std::size_t f = 0; f < fsrs_.size(); f++) {
+    std::set<std::uint32_t> neighbors;
+    for (const auto& token : fsrs_[f].tokens()) {
+      for (const auto n : surf_fsrs[token.surface.get()]) {
+        if (n != f) neighbors.insert(n);
+      }
+    }
+    neighbor_fsrs_.insert(neighbor_fsrs_.end(), neighbors.begin(),
+                          neighbors.end());
+    neighbor_offsets_.push_back(neighbor_fsrs_.size());
+  }
+}
+
+UniqueFSR Cell::next_fsr(const FlatSourceRegion& fsr, const Vector& r,
+                         const Direction& u) const {
+  if (this->inside(r, u) == false) {
+    return {nullptr, 0};
+  }
+
+  // Only use the neighbors if fsr belongs to this cell
+  const FlatSourceRegion* begin = fsrs_.data();
+  const FlatSourceRegion* end = begin + fsrs_.size();
+  if (std::less_equal<const FlatSourceRegion*>()(begin, &fsr) &&
+      std::less<const FlatSourceRegion*>()(&fsr, end) &&
+      neighbor_offsets_.size() == fsrs_.size() + 1) {
+    const auto f = static_cast<std::size_t>(&fsr - begin);
+    for (std::size_t k = neighbor_offsets_[f]; k < neighbor_offsets_[f + 1];
+         k++) {
+      const auto& nfsr = fsrs_[neighbor_fsrs_[k]];
+      if (nfsr.inside(r, u)) return {&nfsr, 0};
+    }
+  }
+
+  return this->get_fsr(r, u);
+}
+
 std::vector<UniqueFSR> Cell::get_all_fsr_in_cell(const Vector& /*r*/,
                                                  const Direction& /*u*/) const {
   std::vector<UniqueFSR> out;
@@ -2,9 +2,11 @@
 #include <moc/moc_driver.hpp>
 #include <utils/constants.hpp>
 #include <utils/logging.hpp>
+#include <utils/mpi.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/simulation_mode.hpp>
 #include <utils/timer.hpp>
+#include <utils/profiler.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -127,9 +129,12 @@ CMFD::CMFD(const std::vector<double>& dx, const std::vector<double>& dy,
   surface_currents_ =
       xt::zeros<double>({group_condensation_.size(), nx_surfs_ + ny_surfs_});
 
-  // Allocate the xs array
-  xs_.resize({nx_, ny_});
-  xs_.fill(nullptr);
+  // Allocate the homogenized cross section arrays
+  tile_D_ = xt::zeros<double>({nx_ * ny_, ng_});
+  tile_Er_ = xt::zeros<double>({nx_ * ny_, ng_});
+  tile_vEf_ = xt::zeros<double>({nx_ * ny_, ng_});
+  tile_chi_ = xt::zeros<double>({nx_ * ny_, ng_});
+  tile_Es_ = xt::zeros<double>({nx_ * ny_, ng_, ng_});
 
   // Allocate cell volume array
   volumes_.resize(nx_ * ny_);
@@ -250,7 +255,7 @@ std::size_t CMFD::tile_to_indx(const std::size_t& i,
   return j * nx_ + i;
 }
 
-std::array<std::size_t, 2> CMFD::indx_to_tile(std::size_t cell_index) {
+std::array<std::size_t, 2> CMFD::indx_to_tile(std::size_t cell_index) const {
   std::array<std::size_t, 2> tile;
   tile[0] = cell_index % nx_;
   tile[1] = (cell_index - tile[0]) / nx_;
@@ -274,28 +279,78 @@ double CMFD::y_max() const {
   return 0.5 * width_y;
 }
 
+MemoryUsage CMFD::memory_usage() const {
+  MemoryUsage usage;
+
+  usage["fsrs"] = array_bytes(temp_fsrs_) + array_bytes(fsrs_);
+  usage["currents"] = array_bytes(surface_currents_) +
+                      array_bytes(surface_partial_currents_) +
+                      array_bytes(thread_currents_) +
+                      array_bytes(surface_flux_) +
+                      array_bytes(thread_surface_flux_);
+  usage["xs"] = array_bytes(tile_D_) + array_bytes(tile_Er_) +
+                array_bytes(tile_vEf_) + array_bytes(tile_chi_) +
+                array_bytes(tile_Es_) + array_bytes(homog_scratch_) +
+                array_bytes(Et_) + array_bytes(D_transp_corr_);
+  usage["flux"] = array_bytes(flux_) + array_bytes(flux_cmfd_) +
+                  array_bytes(update_ratios_) + array_bytes(volumes_) +
+                  array_bytes(extern_src_);
+  for (const auto& flux : history_flux_) usage["flux"] += array_bytes(flux);
+  usage["matrices"] = array_bytes(M_) + array_bytes(QM_) + array_bytes(W_) +
+                      array_bytes(coarse_R_) + M_pattern_.memory_bytes() +
+                      QM_pattern_.memory_bytes() + array_bytes(coarse_indx_);
+
+  return usage;
+}
+
 void CMFD::insert_fsr(const std::array<std::size_t, 2>& tile, std::size_t fsr) {
   // Compute linear index
   const std::size_t i = this->tile_to_indx(tile);
-  temp_fsrs_.at(i).insert(fsr);
+  this->insert_fsr(i, fsr);
 }
 
 void CMFD::insert_fsr(std::size_t tile_indx, std::size_t fsr) {
-  temp_fsrs_.at(tile_indx).insert(fsr);
+  // Consecutive segments are often in the same FSR
+  auto& fsrs = temp_fsrs_.at(tile_indx);
+  if (fsrs.empty() || fsrs.back() != fsr) fsrs.push_back(fsr);
+}
+
+void CMFD::insert_fsrs(std::size_t tile_indx,
+                       const std::vector<std::size_t>& fsrs) {
+  auto& tile_fsrs = temp_fsrs_.at(tile_indx);
+  tile_fsrs.insert(tile_fsrs.end(), fsrs.begin(), fsrs.end());
 }
 
 void CMFD::pack_fsr_lists() {
   fsrs_.resize(nx_ * ny_, std::vector<std::size_t>());
 
-  for (std::size_t i = 0; i < fsrs_.size(); i++) {
-    fsrs_[i].insert(fsrs_[i].begin(), temp_fsrs_[i].begin(),
-                    temp_fsrs_[i].end());
+#pragma omp parallel for schedule(dynamic)
+  for (int ii = 0; ii < static_cast<int>(fsrs_.size()); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    auto& tile_fsrs = temp_fsrs_[i];
+    std::sort(tile_fsrs.begin(), tile_fsrs.end());
+    tile_fsrs.erase(std::unique(tile_fsrs.begin(), tile_fsrs.end()),
+                    tile_fsrs.end());
+    fsrs_[i].insert(fsrs_[i].begin(), tile_fsrs.begin(), tile_fsrs.end());
   }
 
   temp_fsrs_.clear();
   temp_fsrs_.shrink_to_fit();
 }
 
+void CMFD::remap_fsr_lists(const std::vector<std::size_t>& fsr_map,
+                           std::size_t nfsrs) {
+  temp_fsrs_.assign(nx_ * ny_, std::vector<std::size_t>());
+  for (std::size_t i = 0; i < fsrs_.size(); i++) {
+    for (const auto fsr : fsrs_[i]) {
+      if (fsr < fsr_map.size() && fsr_map[fsr] < nfsrs) {
+        temp_fsrs_[i].push_back(fsr_map[fsr]);
+      }
+    }
+  }
+  fsrs_.clear();
+}
+
 const std::vector<std::size_t>& CMFD::tile_fsr_list(std::size_t i,
                                                     std::size_t j) const {
   if (i >= nx_) {
@@ -373,6 +428,109 @@ const double& CMFD::current(const std::size_t G,
   return surface_currents_(G, surface);
 }
 
+double CMFD::partial_current(const std::size_t G, const std::size_t surface,
+                             bool positive) const {
+  if (partial_current_cmfd_ == false) {
+    auto mssg = "Partial currents are only tallied with partial_current_cmfd.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Checks the indices
+  current(G, surface);
+
+  if (surface_partial_currents_.size() == 0) return 0.;
+  return surface_partial_currents_(positive ? G : ng_ + G, surface);
+}
+
+double CMFD::surface_flux(std::size_t G, std::size_t surface) const {
+  // Checks the indices
+  current(G, surface);
+
+  if (surface_flux_tally_ == false || surface_flux_.size() == 0) {
+    auto mssg =
+        "Surface fluxes are only available after a MOC solve with "
+        "surface_flux_tally.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // The tally is the integral of the flux over the surface, which is
+  // divided by the length of the surface
+  double len = 0.;
+  if (surface < nx_surfs_) {
+    const std::size_t j = surface / (nx_ + 1);
+    len = dy_[j];
+  } else {
+    const std::size_t i = (surface - nx_surfs_) / (ny_ + 1);
+    len = dx_[i];
+  }
+
+  return surface_flux_(G, surface) / len;
+}
+
+double CMFD::x_line_flux(std::size_t i, std::size_t G) const {
+  if (i > nx_) {
+    auto mssg = "Index i of x line is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  double flx = 0.;
+  double len = 0.;
+  for (std::size_t j = 0; j < ny_; j++) {
+    flx += surface_flux(G, (nx_ + 1) * j + i) * dy_[j];
+    len += dy_[j];
+  }
+  return flx / len;
+}
+
+double CMFD::y_line_flux(std::size_t j, std::size_t G) const {
+  if (j > ny_) {
+    auto mssg = "Index j of y line is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  double flx = 0.;
+  double len = 0.;
+  for (std::size_t i = 0; i < nx_; i++) {
+    flx += surface_flux(G, nx_surfs_ + (ny_ + 1) * i + j) * dx_[i];
+    len += dx_[i];
+  }
+  return flx / len;
+}
+
+double CMFD::vertex_flux(std::size_t i, std::size_t j, std::size_t G) const {
+  if (i > nx_ || j > ny_) {
+    auto mssg = "Mesh vertex index is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // The x surfaces below and above the vertex, and the y surfaces to its
+  // left and right, when they exist
+  double flx = 0.;
+  std::size_t nsurfs = 0;
+  if (j > 0) {
+    flx += surface_flux(G, (nx_ + 1) * (j - 1) + i);
+    nsurfs++;
+  }
+  if (j < ny_) {
+    flx += surface_flux(G, (nx_ + 1) * j + i);
+    nsurfs++;
+  }
+  if (i > 0) {
+    flx += surface_flux(G, nx_surfs_ + (ny_ + 1) * (i - 1) + j);
+    nsurfs++;
+  }
+  if (i < nx_) {
+    flx += surface_flux(G, nx_surfs_ + (ny_ + 1) * i + j);
+    nsurfs++;
+  }
+  return flx / static_cast<double>(nsurfs);
+}
+
 std::size_t CMFD::get_x_neg_surf(const std::size_t i,
                                  const std::size_t j) const {
   if (i >= nx_) {
@@ -441,78 +599,107 @@ std::size_t CMFD::get_y_pos_surf(const std::size_t i,
   return get_y_neg_surf(i, j) + 1;
 }
 
-void CMFD::tally_current(double aflx, const Direction& u, std::size_t G,
-                         const CMFDSurfaceCrossing& surf) {
-  if (G >= surface_currents_.shape()[0]) {
-    auto mssg = "Group index out of range.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
+CMFDSurfaceTally CMFD::surface_tally(const CMFDSurfaceCrossing& surf) const {
+  CMFDSurfaceTally tally;
+  if (!surf) return tally;
 
   const auto tile = indx_to_tile(surf.cell_index);
   std::size_t i = tile[0];
   std::size_t j = tile[1];
 
+  auto add_x = [&tally](std::size_t si) {
+    tally.surfaces[tally.nsurfs] = si;
+    tally.x_surface[tally.nsurfs] = true;
+    tally.nsurfs++;
+  };
+  auto add_y = [&tally](std::size_t si) {
+    tally.surfaces[tally.nsurfs] = si;
+    tally.x_surface[tally.nsurfs] = false;
+    tally.nsurfs++;
+  };
+
   // Get surface index(s) from CMFDSurfaceCrossing
-  htl::static_vector<std::size_t, 4> surf_indexes;
   bool is_corner = false;
   if (surf.crossing == CMFDSurfaceCrossing::Type::XN) {
-    surf_indexes.push_back(get_x_neg_surf(i, j));
+    add_x(get_x_neg_surf(i, j));
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::XP) {
-    surf_indexes.push_back(get_x_pos_surf(i, j));
+    add_x(get_x_pos_surf(i, j));
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::YN) {
-    surf_indexes.push_back(get_y_neg_surf(i, j));
+    add_y(get_y_neg_surf(i, j));
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::YP) {
-    surf_indexes.push_back(get_y_pos_surf(i, j));
+    add_y(get_y_pos_surf(i, j));
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::I) {
     is_corner = true;
-    surf_indexes.push_back(get_x_pos_surf(i, j));
-    surf_indexes.push_back(get_y_pos_surf(i, j));
+    add_x(get_x_pos_surf(i, j));
+    add_y(get_y_pos_surf(i, j));
     if (i + 1 < nx_) {
-      surf_indexes.push_back(get_y_pos_surf(i + 1, j));
+      add_y(get_y_pos_surf(i + 1, j));
     }
     if (j + 1 < ny_) {
-      surf_indexes.push_back(get_x_pos_surf(i, j + 1));
+      add_x(get_x_pos_surf(i, j + 1));
     }
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::IV) {
     is_corner = true;
-    surf_indexes.push_back(get_x_pos_surf(i, j));
-    surf_indexes.push_back(get_y_neg_surf(i, j));
+    add_x(get_x_pos_surf(i, j));
+    add_y(get_y_neg_surf(i, j));
     if (i + 1 < nx_) {
-      surf_indexes.push_back(get_y_neg_surf(i + 1, j));
+      add_y(get_y_neg_surf(i + 1, j));
     }
     if (j != 0) {
-      surf_indexes.push_back(get_x_pos_surf(i, j - 1));
+      add_x(get_x_pos_surf(i, j - 1));
     }
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::III) {
     is_corner = true;
-    surf_indexes.push_back(get_x_neg_surf(i, j));
-    surf_indexes.push_back(get_y_neg_surf(i, j));
+    add_x(get_x_neg_surf(i, j));
+    add_y(get_y_neg_surf(i, j));
     if (i != 0) {
-      surf_indexes.push_back(get_y_neg_surf(i - 1, j));
+      add_y(get_y_neg_surf(i - 1, j));
     }
     if (j != 0) {
-      surf_indexes.push_back(get_x_neg_surf(i, j - 1));
+      add_x(get_x_neg_surf(i, j - 1));
     }
   } else if (surf.crossing == CMFDSurfaceCrossing::Type::II) {
     is_corner = true;
-    surf_indexes.push_back(get_x_neg_surf(i, j));
-    surf_indexes.push_back(get_y_pos_surf(i, j));
+    add_x(get_x_neg_surf(i, j));
+    add_y(get_y_pos_surf(i, j));
     if (i != 0) {
-      surf_indexes.push_back(get_y_pos_surf(i - 1, j));
+      add_y(get_y_pos_surf(i - 1, j));
     }
     if (j + 1 < ny_) {
-      surf_indexes.push_back(get_x_neg_surf(i, j + 1));
+      add_x(get_x_neg_surf(i, j + 1));
     }
   }
 
   if (is_corner) {
     // Split flux between two surfaces evenly
-    aflx *= 0.5;
+    tally.weight = 0.5;
   }
 
-  for (auto si : surf_indexes) {
-    if (si < nx_surfs_) {
+  return tally;
+}
+
+void CMFD::tally_current(double aflx, const Direction& u, std::size_t G,
+                         const CMFDSurfaceCrossing& surf) {
+  if (G >= surface_currents_.shape()[0]) {
+    auto mssg = "Group index out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const auto tally = surface_tally(surf);
+  aflx *= tally.weight;
+
+  for (std::size_t k = 0; k < tally.nsurfs; k++) {
+    const std::size_t si = tally.surfaces[k];
+    if (partial_current_cmfd_) {
+      const double u_perp = tally.x_surface[k] ? u.x() : u.y();
+      const std::size_t row = u_perp > 0. ? G : ng_ + G;
+      const double net = std::copysign(aflx, u_perp);
+#pragma omp atomic
+      surface_partial_currents_(row, si) += aflx;
+#pragma omp atomic
+      surface_currents_(G, si) += net;
+    } else if (tally.x_surface[k]) {
 #pragma omp atomic
       surface_currents_(G, si) += std::copysign(aflx, u.x());
     } else {
@@ -522,6 +709,87 @@ void CMFD::tally_current(double aflx, const Direction& u, std::size_t G,
   }
 }
 
+void CMFD::zero_currents() {
+  surface_currents_.fill(0.);
+  surface_currents_normalized_ = false;
+
+  // The surface fluxes have the layout of the net currents
+  if (surface_flux_tally_) {
+    surface_flux_.resize(surface_currents_.shape());
+    surface_flux_.fill(0.);
+    thread_surface_flux_.resize(tally_slots());
+    for (auto& sflux : thread_surface_flux_) {
+      sflux.resize(surface_currents_.shape());
+      sflux.fill(0.);
+    }
+  } else {
+    thread_surface_flux_.clear();
+  }
+
+  // With pCMFD, the thread buffers hold both partial currents
+  std::array<std::size_t, 2> shape{surface_currents_.shape()[0],
+                                   surface_currents_.shape()[1]};
+  if (partial_current_cmfd_) {
+    shape[0] *= 2;
+    surface_partial_currents_.resize(shape);
+    surface_partial_currents_.fill(0.);
+  } else {
+    surface_partial_currents_.resize({0, 0});
+  }
+
+  thread_currents_.resize(tally_slots());
+  for (auto& currents : thread_currents_) {
+    currents.resize(shape);
+    currents.fill(0.);
+  }
+}
+
+void CMFD::add_sweep_currents(const xt::xtensor<double, 2>& currents) {
+  if (partial_current_cmfd_ == false) {
+    surface_currents_ += currents;
+    return;
+  }
+
+  surface_partial_currents_ += currents;
+  surface_currents_ += xt::view(currents, xt::range(0, ng_), xt::all()) -
+                       xt::view(currents, xt::range(ng_, 2 * ng_), xt::all());
+}
+
+void CMFD::reduce_currents() {
+  // The buffers are zeroed, so that the currents of several sweeps in the
+  // same iteration can be reduced one sweep at a time.
+  if (thread_surface_flux_.empty() == false) {
+    auto& sweep_sflux = thread_surface_flux_.front();
+    for (std::size_t t = 1; t < thread_surface_flux_.size(); t++) {
+      sweep_sflux += thread_surface_flux_[t];
+      thread_surface_flux_[t].fill(0.);
+    }
+    if (mpi_size() > 1) {
+      mpi_allreduce_sum(sweep_sflux.data(), sweep_sflux.size());
+    }
+    surface_flux_ += sweep_sflux;
+    sweep_sflux.fill(0.);
+  }
+
+  if (mpi_size() == 1 || thread_currents_.empty()) {
+    for (auto& currents : thread_currents_) {
+      add_sweep_currents(currents);
+      currents.fill(0.);
+    }
+    return;
+  }
+
+  // The currents of this sweep are also summed over the tracks of all ranks
+  auto& sweep_currents = thread_currents_.front();
+  for (std::size_t t = 1; t < thread_currents_.size(); t++) {
+    sweep_currents += thread_currents_[t];
+    thread_currents_[t].fill(0.);
+  }
+  mpi_allreduce_sum(sweep_currents.data(), sweep_currents.size());
+  add_sweep_currents(sweep_currents);
+  sweep_currents.fill(0.);
+}
+
 void CMFD::normalize_currents() {
   // We must normalize the currents by the lengths of each surface
 
@@ -533,6 +801,9 @@ void CMFD::normalize_currents() {
 
     for (std::size_t xs = 0; xs < x_bounds_.size(); xs++) {
       xt::view(surface_currents_, xt::all(), s) *= invs_dy;
+      if (partial_current_cmfd_) {
+        xt::view(surface_partial_currents_, xt::all(), s) *= invs_dy;
+      }
       s++;
     }
   }
@@ -544,6 +815,9 @@ void CMFD::normalize_currents() {
 
     for (std::size_t ys = 0; ys < y_bounds_.size(); ys++) {
       xt::view(surface_currents_, xt::all(), s) *= invs_dx;
+      if (partial_current_cmfd_) {
+        xt::view(surface_partial_currents_, xt::all(), s) *= invs_dx;
+      }
       s++;
     }
   }
@@ -552,46 +826,152 @@ void CMFD::normalize_currents() {
 }
 
 void CMFD::compute_homogenized_xs_and_flux(const MOCDriver& moc) {
-#pragma omp parallel for
-  for (int ii = 0; ii < static_cast<int>(nx_); ii++) {
-    std::size_t i = static_cast<std::size_t>(ii);
+  // The few-group cross sections of each tile are condensed directly from the
+  // reaction rates of its FSRs. This gives the same values as homogenizing a
+  // fine-group CrossSection, taking its diffusion cross section, and
+  // condensing it with the homogenized flux spectrum, but without building
+  // any of these intermediates.
+  const std::size_t NG = moc.ngroups();
+  if (NG != moc_to_cmfd_group_map_.size()) {
+    auto mssg =
+        "The number of MOC groups disagrees with the CMFD condensation scheme.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+  const auto& moc_flux = moc.flux_array();
+
+  // Fine-group rates of each thread's tile: flux * volume, then the total,
+  // absorption, and production rates, and the fission spectrum rate.
+  if (homog_scratch_.size() != max_threads() ||
+      homog_scratch_.front().size() != 5 * NG) {
+    homog_scratch_.assign(max_threads(),
+                          xt::xtensor<double, 2>(xt::zeros<double>({5, NG})));
+  }
+
+  // Tile with a group which has no flux, if any
+  std::size_t zero_flux_tile = nx_ * ny_;
+
+#pragma omp parallel for schedule(dynamic)
+  for (int il = 0; il < static_cast<int>(nx_ * ny_); il++) {
+    const std::size_t l = static_cast<std::size_t>(il);
+    const auto [i, j] = indx_to_tile(l);
+    auto& rates = homog_scratch_[thread_index()];
+    rates.fill(0.);
+    auto Es = xt::view(tile_Es_, l, xt::all(), xt::all());
+    Es.fill(0.);
+
+    double sum_V = 0.;
+    double fiss_prod = 0.;
+    for (const auto fsr : fsrs_[l]) {
+      const auto& mat = moc.fsrs_[fsr]->xs();
+      const double V = moc.fsrs_[fsr]->volume();
+      sum_V += V;
+
+      double fsr_fiss_prod = 0.;
+      for (std::size_t g = 0; g < NG; g++) {
+        const double flxV = moc_flux(g, fsr, 0) * V;
+        const std::size_t G = moc_to_cmfd_group_map_[g];
 
-    for (std::size_t j = 0; j < ny_; j++) {
-      const auto indx = this->tile_to_indx(i, j);
-      const auto fg_xs = moc.homogenize(fsrs_[indx]);
-      const auto fg_dxs = fg_xs->diffusion_xs();
-      const auto flux_spec = moc.homogenize_flux_spectrum(fsrs_[indx]);
-      auto& xs = xs_(i, j);
-      if (xs)
-        *xs = *(fg_dxs->condense(group_condensation_, flux_spec));
-      else
-        xs = fg_dxs->condense(group_condensation_, flux_spec);
-
-      // Generate the flux and Et values for the tile
-      xt::view(flux_, xt::all(), i, j) = 0.;
-      xt::view(Et_, xt::all(), i, j) = 0.;
-      for (std::size_t g = 0; g < moc_to_cmfd_group_map_.size(); g++) {
-        flux_(moc_to_cmfd_group_map_[g], i, j) += flux_spec(g);
-        Et_(moc_to_cmfd_group_map_[g], i, j) += fg_xs->Etr(g) * flux_spec(g);
+        // Transport corrected scattering, condensed in the outgoing group.
+        // The row sum gives the reconstructed total cross section.
+        // Only the stored band of the matrix is visited.
+        double Es_g = 0.;
+        const std::size_t gg_min = mat->Es_XS2D().band_min(g);
+        const auto row = mat->Es_XS2D().band(0, g);
+        for (std::size_t k = 0; k < row.size(); k++) {
+          Es_g += row[k];
+          Es(G, moc_to_cmfd_group_map_[gg_min + k]) += flxV * row[k];
+        }
+
+        rates(0, g) += flxV;
+        rates(1, g) += flxV * (mat->Ea(g) + Es_g);
+        rates(2, g) += flxV * mat->Ea(g);
+        rates(3, g) += flxV * mat->vEf(g);
+        fsr_fiss_prod += flxV * mat->vEf(g);
+      }
+
+      fiss_prod += fsr_fiss_prod;
+      for (std::size_t g = 0; g < NG; g++) {
+        rates(4, g) += fsr_fiss_prod * mat->chi(g);
+      }
+    }
+
+    bool zero_flux = false;
+    for (std::size_t g = 0; g < NG; g++) {
+      if (rates(0, g) == 0.) zero_flux = true;
+    }
+    if (zero_flux) {
+#pragma omp critical
+      zero_flux_tile = std::min(zero_flux_tile, l);
+      continue;
+    }
+
+    // Condense the fine-group values
+    const double invs_fiss_prod = fiss_prod > 0. ? 1. / fiss_prod : 1.;
+    for (std::size_t G = 0; G < ng_; G++) {
+      tile_D_(l, G) = 0.;
+      tile_Er_(l, G) = 0.;
+      tile_vEf_(l, G) = 0.;
+      tile_chi_(l, G) = 0.;
+      flux_(G, i, j) = 0.;
+      Et_(G, i, j) = 0.;
+    }
+    for (std::size_t g = 0; g < NG; g++) {
+      const std::size_t G = moc_to_cmfd_group_map_[g];
+      const double Etr_g = rates(1, g) / rates(0, g);
+      flux_(G, i, j) += rates(0, g);
+      Et_(G, i, j) += rates(1, g);
+      tile_D_(l, G) += rates(0, g) / (3. * Etr_g);
+      tile_Er_(l, G) += rates(2, g);
+      tile_vEf_(l, G) += rates(3, g);
+      tile_chi_(l, G) += rates(4, g) * invs_fiss_prod;
+    }
+
+    for (std::size_t G = 0; G < ng_; G++) {
+      const double invs_fluxV = 1. / flux_(G, i, j);
+      tile_D_(l, G) *= invs_fluxV;
+      tile_vEf_(l, G) *= invs_fluxV;
+      Et_(G, i, j) *= invs_fluxV;
+      flux_(G, i, j) /= sum_V;
+
+      // Removal is absorption plus out-scattering
+      tile_Er_(l, G) *= invs_fluxV;
+      for (std::size_t GG = 0; GG < ng_; GG++) {
+        Es(G, GG) *= invs_fluxV;
+        if (GG != G) tile_Er_(l, G) += Es(G, GG);
       }
-      xt::view(Et_, xt::all(), i, j) /= xt::view(flux_, xt::all(), i, j);
     }
   }
+
+  if (zero_flux_tile < nx_ * ny_) {
+    const auto [i, j] = indx_to_tile(zero_flux_tile);
+    std::stringstream mssg;
+    mssg << "Cannot homogenize cross sections of CMFD tile (" << i << ", " << j
+         << "). The sum of FSR flux*volume is zero in at least one group. If "
+            "you see this error, try skipping several MOC iterations before "
+            "applying CMFD.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
 }
 
 void CMFD::homogenize_ext_src(const MOCDriver& moc) {
   // Reset external source array
   extern_src_.setZero();
   const std::size_t tot_cells = nx_ * ny_;
-  // Loop over all cells
-  for (std::size_t l = 0; l < tot_cells; l++) {
+  const std::size_t NG = moc_to_cmfd_group_map_.size();
+
+  // Each tile only writes its own entries, so the tiles are independent
+#pragma omp parallel for schedule(dynamic)
+  for (int il = 0; il < static_cast<int>(tot_cells); il++) {
+    const std::size_t l = static_cast<std::size_t>(il);
     const double invs_V = 1. / volumes_[l];
-    // Loop over MOC groups
-    for (std::size_t g = 0; g < moc_to_cmfd_group_map_.size(); g++) {
-      // Loop over FSRs in cell l
-      for (auto fsr : fsrs_[l]) {
+    // Loop over FSRs in cell l, then over MOC groups
+    for (const auto fsr : fsrs_[l]) {
+      const double V = invs_V * moc.volume(fsr);
+      for (std::size_t g = 0; g < NG; g++) {
         extern_src_[moc_to_cmfd_group_map_[g] * tot_cells + l] +=
-            invs_V * moc.volume(fsr) * moc.extern_src(fsr, g);
+            V * moc.extern_src(fsr, g);
       }
     }
   }
@@ -708,16 +1088,16 @@ double CMFD::calc_neutron_balance_residual_cmfd(const std::size_t i,
   const double J_yp = calc_surf_current_cmfd(i, j, g, TileSurf::YP, moc);
 
   // Get the xs for our tile
-  const auto& xs = *xs_(i, j);
-  const double chi_g_keff = xs.chi(g) / keff;
+  const std::size_t l = tile_to_indx(i, j);
+  const double chi_g_keff = tile_chi_(l, g) / keff;
 
   // Compute the fission and scatter sources
   double fiss_source = 0.;
   double scat_source = 0.;
   for (std::size_t gg = 0; gg < ng_; gg++) {
     const double flx_gg = this->flux(i, j, gg);
-    fiss_source += chi_g_keff * xs.vEf(gg) * flx_gg;
-    scat_source += xs.Es(gg, g) * flx_gg;
+    fiss_source += chi_g_keff * tile_vEf_(l, gg) * flx_gg;
+    scat_source += tile_Es_(l, gg, g) * flx_gg;
   }
 
   // Compute the total leakage from the currents
@@ -745,16 +1125,16 @@ double CMFD::calc_neutron_balance_residual_moc(const std::size_t i,
   const double J_yp = surface_currents_.at(g, this->get_y_pos_surf(i, j));
 
   // Get the xs for our tile
-  const auto& xs = *xs_(i, j);
-  const double chi_g_keff = xs.chi(g) / keff;
+  const std::size_t l = tile_to_indx(i, j);
+  const double chi_g_keff = tile_chi_(l, g) / keff;
 
   // Compute the fission and scatter sources
   double fiss_source = 0.;
   double scat_source = 0.;
   for (std::size_t gg = 0; gg < ng_; gg++) {
     const double flx_gg = flux_.at(gg, i, j);
-    fiss_source += chi_g_keff * xs.vEf(gg) * flx_gg;
-    scat_source += xs.Es(gg, g) * flx_gg;
+    fiss_source += chi_g_keff * tile_vEf_(l, gg) * flx_gg;
+    scat_source += tile_Es_(l, gg, g) * flx_gg;
   }
 
   // Compute the total leakage from the currents
@@ -796,6 +1176,64 @@ void CMFD::set_keff_tolerance(double ktol) {
   keff_tol_ = ktol;
 }
 
+void CMFD::set_linear_tolerance(double tol) {
+  if (tol <= 0. || tol >= 0.1) {
+    auto mssg =
+        "Tolerance for the CMFD linear solver must be in the interval "
+        "(0., 0.1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  linear_tol_ = tol;
+}
+
+void CMFD::set_forcing_factor(double eta) {
+  if (eta < 0. || eta >= 1.) {
+    auto mssg = "CMFD forcing factor must be in the interval [0., 1.).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  forcing_factor_ = eta;
+}
+
+void CMFD::update_forced_tolerance(std::size_t moc_iteration) {
+  if (forcing_factor_ <= 0.) {
+    forced_tol_ = 0.;
+    prev_moc_flux_ = xt::xtensor<double, 3>();
+    return;
+  }
+
+  // Largest relative change of the homogenized MOC flux since the previous
+  // CMFD solve, which measures the residual of the outer iteration
+  double residual = 1.;
+  if (prev_moc_flux_.shape() == flux_.shape()) {
+    residual = 0.;
+    for (std::size_t i = 0; i < flux_.size(); i++) {
+      const double diff =
+          std::abs(flux_.flat(i) - prev_moc_flux_.flat(i)) / flux_.flat(i);
+      residual = std::max(residual, diff);
+    }
+  }
+  prev_moc_flux_ = flux_;
+
+  // The tolerance is only tightened during an MOC solve
+  if (moc_iteration <= skip_moc_iterations_ + 1) forced_tol_ = MAX_FORCED_TOL;
+  forced_tol_ =
+      std::min({forced_tol_, MAX_FORCED_TOL, forcing_factor_ * residual});
+}
+
+void CMFD::set_wielandt_shift(double shift) {
+  if (shift <= 0.) {
+    auto mssg = "Wielandt shift must be greater than 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  wielandt_shift_ = shift;
+}
+
 void CMFD::set_larsen_correction(bool user_pref) {
   if (od_cmfd_ && user_pref) {
     auto mssg =
@@ -818,6 +1256,14 @@ void CMFD::set_od_cmfd(bool user_pref) {
   od_cmfd_ = user_pref;
 }
 
+void CMFD::set_partial_current_cmfd(bool user_pref) {
+  // The tallies of the current sweep would have the wrong layout
+  if (user_pref != partial_current_cmfd_) {
+    partial_current_cmfd_ = user_pref;
+    zero_currents();
+  }
+}
+
 std::variant<std::array<std::size_t, 2>, BoundaryCondition>
 CMFD::find_next_cell_or_bc(std::size_t i, std::size_t j, CMFD::TileSurf surf,
                            const MOCDriver& moc) const {
@@ -889,25 +1335,30 @@ double CMFD::get_cmfd_tile_width(std::size_t i, std::size_t j,
   return 0.;
 }
 
-double CMFD::get_current(std::size_t i, std::size_t j, std::size_t g,
-                         CMFD::TileSurf surf) const {
+std::size_t CMFD::get_surf(std::size_t i, std::size_t j,
+                           CMFD::TileSurf surf) const {
   switch (surf) {
     case CMFD::TileSurf::XP:
-      return surface_currents_(g, get_x_pos_surf(i, j));
+      return get_x_pos_surf(i, j);
       break;
     case CMFD::TileSurf::XN:
-      return surface_currents_(g, get_x_neg_surf(i, j));
+      return get_x_neg_surf(i, j);
       break;
     case CMFD::TileSurf::YP:
-      return surface_currents_(g, get_y_pos_surf(i, j));
+      return get_y_pos_surf(i, j);
       break;
     case CMFD::TileSurf::YN:
-      return surface_currents_(g, get_y_neg_surf(i, j));
+      return get_y_neg_surf(i, j);
       break;
   }
 
   // NEVER GETS HERE
-  return 0.;
+  return 0;
+}
+
+double CMFD::get_current(std::size_t i, std::size_t j, std::size_t g,
+                         CMFD::TileSurf surf) const {
+  return surface_currents_(g, get_surf(i, j, surf));
 }
 
 void CMFD::apply_larsen_correction(double& D, const double dx,
@@ -971,7 +1422,7 @@ std::pair<double, double> CMFD::calc_surf_diffusion_coeffs(
     const MOCDriver& moc) const {
   // Get flux and diffusion coefficient for current cell
   const double flx_ij = flux_(g, i, j);
-  double D_ij = xs_(i, j)->D(g);
+  double D_ij = tile_D_(tile_to_indx(i, j), g);
   const double dx_ij = get_cmfd_tile_width(i, j, surf);
   const double current = get_current(i, j, g, surf);
 
@@ -1018,7 +1469,7 @@ std::pair<double, double> CMFD::calc_surf_diffusion_coeffs(
       D_nl = -(current + D_surf * flx_ij) / flx_ij;
     }
 
-    if (flux_limiting_) {
+    if (flux_limiting_ && partial_current_cmfd_ == false) {
       if (surf == CMFD::TileSurf::XN || surf == CMFD::TileSurf::YN) {
         apply_flux_limiting(D_surf, D_nl, 0.);
       }
@@ -1036,7 +1487,7 @@ std::pair<double, double> CMFD::calc_surf_diffusion_coeffs(
 
   // Get flux, diffusion coefficient, and length for next tile
   const double flx_iijj = flux_(g, ii, jj);
-  double D_iijj = xs_(ii, jj)->D(g);
+  double D_iijj = tile_D_(tile_to_indx(ii, jj), g);
   const double dx_iijj = get_cmfd_tile_width(ii, jj, surf);
 
   // Modify material diffusion coefficient for cell ii, jj by Larsen's
@@ -1050,6 +1501,23 @@ std::pair<double, double> CMFD::calc_surf_diffusion_coeffs(
   // First, compute normal surface diffusion coefficient
   double D_surf = (2 * D_ij * D_iijj) / (D_ij * dx_iijj + D_iijj * dx_ij);
 
+  if (partial_current_cmfd_ && moc_iteration_ > 0) {
+    // With pCMFD, the partial currents through the surface are written as
+    // J+ = -(D/2)(flx_R - flx_L) + D+ flx_L and
+    // J- = (D/2)(flx_R - flx_L) + D- flx_R, where L and R are the tiles on
+    // the negative and positive sides of the surface. The net current is then
+    // recast in the usual form, with the equivalent D_surf and D_nl.
+    const bool pos = surf == CMFD::TileSurf::XP || surf == CMFD::TileSurf::YP;
+    const double flx_L = pos ? flx_ij : flx_iijj;
+    const double flx_R = pos ? flx_iijj : flx_ij;
+    const std::size_t s = get_surf(i, j, surf);
+    const double J_p = surface_partial_currents_(g, s);
+    const double J_m = surface_partial_currents_(ng_ + g, s);
+    const double D_p = (J_p + 0.5 * D_surf * (flx_R - flx_L)) / flx_L;
+    const double D_m = (J_m - 0.5 * D_surf * (flx_R - flx_L)) / flx_R;
+    return {D_surf + 0.5 * (D_p + D_m), 0.5 * (D_m - D_p)};
+  }
+
   // Compute non-linear diffusion coefficient
   double D_nl = 0.;
   if (surf == CMFD::TileSurf::XP || surf == CMFD::TileSurf::YP) {
@@ -1058,7 +1526,7 @@ std::pair<double, double> CMFD::calc_surf_diffusion_coeffs(
     D_nl = (D_surf * (flx_iijj - flx_ij) - current) / (flx_iijj + flx_ij);
   }
 
-  if (flux_limiting_) {
+  if (flux_limiting_ && partial_current_cmfd_ == false) {
     apply_flux_limiting(D_surf, D_nl, flx_iijj);
   }
 
@@ -1071,144 +1539,358 @@ std::pair<double, double> CMFD::calc_surf_diffusion_coeffs(
 }
 
 void CMFD::create_loss_matrix(const MOCDriver& moc) {
+  SCARABEE_PROFILE_ZONE("CMFD::create_loss_matrix");
   const std::size_t tot_cells = nx_ * ny_;
-  M_.resize(ng_ * tot_cells, ng_ * tot_cells);
-  M_.reserve(Eigen::VectorXi::Constant(ng_ * tot_cells, 5));
   // Initialize array to store n+1 diffusion coefficients
   xt::xtensor<double, 2> D_transp_corr_new =
       xt::zeros<double>({ng_, nx_surfs_ + ny_surfs_});
 
-  // Loop over all cells and groups, cell index changes fastest
-  for (std::size_t g = 0; g < ng_; ++g) {
-    for (std::size_t l = 0; l < nx_ * ny_; l++) {
-      const auto [i, j] = indx_to_tile(l);
-      const double dx = dx_[i];
-      const double dy = dy_[j];
-
-      const double invs_dx = 1. / dx;
-      const double invs_dy = 1. / dy;
-
-      const auto xpsurf = get_x_pos_surf(i, j);
-      const auto xnsurf = get_x_neg_surf(i, j);
-      const auto ypsurf = get_y_pos_surf(i, j);
-      const auto ynsurf = get_y_neg_surf(i, j);
-
-      // Get surface diffusion coefficients for Cell i,j
-      auto [Dxp, Dnl_xp] =
-          calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::XP, moc);
-      auto [Dyp, Dnl_yp] =
-          calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::YP, moc);
-      auto [Dxn, Dnl_xn] =
-          calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::XN, moc);
-      auto [Dyn, Dnl_yn] =
-          calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::YN, moc);
-
-      if (Dnl_xp > Dxp || Dnl_xn > Dxn || Dnl_yp > Dyp || Dnl_yn > Dyn) {
-        auto mssg =
-            "At least one transport corrected diffusion coefficient is greater "
-            "than its non-corrected counterpart";
-        spdlog::debug(mssg);
-      }
+  // Fills row g * tot_cells + l of M_. Rows of a group are filled in order by
+  // a single thread, as neighbouring cells both write the coefficient of
+  // their shared surface.
+  const auto fill_row = [&](std::size_t r, const auto& add) {
+    const std::size_t g = r / tot_cells;
+    const std::size_t l = r % tot_cells;
+    const auto [i, j] = indx_to_tile(l);
+    const double dx = dx_[i];
+    const double dy = dy_[j];
 
-      // Calculate n+1 diffusion coefficients from n-1 and n+1/2
-      Dnl_xp = (1 - damping_) * D_transp_corr_(g, xpsurf) + damping_ * Dnl_xp;
-      Dnl_xn = (1 - damping_) * D_transp_corr_(g, xnsurf) + damping_ * Dnl_xn;
-      Dnl_yp = (1 - damping_) * D_transp_corr_(g, ypsurf) + damping_ * Dnl_yp;
-      Dnl_yn = (1 - damping_) * D_transp_corr_(g, ynsurf) + damping_ * Dnl_yn;
-
-      // Store the current CMFD iteration's diffusion coefficients
-      D_transp_corr_new(g, xpsurf) = Dnl_xp;
-      D_transp_corr_new(g, xnsurf) = Dnl_xn;
-      D_transp_corr_new(g, ypsurf) = Dnl_yp;
-      D_transp_corr_new(g, ynsurf) = Dnl_yn;
-
-      // Streaming to adjacent X cells
-      if (i != 0) {
-        M_.coeffRef(g * tot_cells + l,
-                    g * tot_cells + tile_to_indx(i - 1, j)) +=
-            (Dnl_xn - Dxn) * invs_dx;
-      }
-      if (i != nx_ - 1) {
-        M_.coeffRef(g * tot_cells + l,
-                    g * tot_cells + tile_to_indx(i + 1, j)) +=
-            (-Dxp - Dnl_xp) * invs_dx;
-      }
-      M_.coeffRef(g * tot_cells + l, g * tot_cells + l) +=
-          (Dxn + Dxp + Dnl_xn - Dnl_xp) * invs_dx;
-
-      // Streaming to adjacent Y cells
-      if (j != 0) {
-        M_.coeffRef(g * tot_cells + l,
-                    g * tot_cells + tile_to_indx(i, j - 1)) +=
-            (Dnl_yn - Dyn) * invs_dy;
-      }
-      if (j != ny_ - 1) {
-        M_.coeffRef(g * tot_cells + l,
-                    g * tot_cells + tile_to_indx(i, j + 1)) +=
-            (-Dyp - Dnl_yp) * invs_dy;
-      }
-      M_.coeffRef(g * tot_cells + l, g * tot_cells + l) +=
-          (Dyn + Dyp + Dnl_yn - Dnl_yp) * invs_dy;
-
-      // Handle periodic BC
-      // X direction
-      if (i == 0 && moc.x_min_bc() == BoundaryCondition::Periodic) {
-        M_.coeffRef(g * tot_cells + l,
-                    g * tot_cells + tile_to_indx(nx_ - 1, j)) +=
-            (Dnl_xn - Dxn) * invs_dx;
-      }
-      if (i == nx_ - 1 && moc.x_max_bc() == BoundaryCondition::Periodic) {
-        M_.coeffRef(g * tot_cells + l, g * tot_cells + tile_to_indx(0, j)) +=
-            (-Dxp - Dnl_xp) * invs_dx;
-      }
-      // Y direction
-      if (j == 0 && moc.y_min_bc() == BoundaryCondition::Periodic) {
-        M_.coeffRef(g * tot_cells + l,
-                    g * tot_cells + tile_to_indx(i, ny_ - 1)) +=
-            (Dnl_yn - Dyn) * invs_dy;
-      }
-      if (j == nx_ - 1 && moc.y_max_bc() == BoundaryCondition::Periodic) {
-        M_.coeffRef(g * tot_cells + l, g * tot_cells + tile_to_indx(i, 0)) +=
-            (-Dyp - Dnl_yp) * invs_dy;
-      }
+    const double invs_dx = 1. / dx;
+    const double invs_dy = 1. / dy;
+
+    const auto xpsurf = get_x_pos_surf(i, j);
+    const auto xnsurf = get_x_neg_surf(i, j);
+    const auto ypsurf = get_y_pos_surf(i, j);
+    const auto ynsurf = get_y_neg_surf(i, j);
+
+    // Get surface diffusion coefficients for Cell i,j
+    auto [Dxp, Dnl_xp] =
+        calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::XP, moc);
+    auto [Dyp, Dnl_yp] =
+        calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::YP, moc);
+    auto [Dxn, Dnl_xn] =
+        calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::XN, moc);
+    auto [Dyn, Dnl_yn] =
+        calc_surf_diffusion_coeffs(i, j, g, CMFD::TileSurf::YN, moc);
+
+    if (Dnl_xp > Dxp || Dnl_xn > Dxn || Dnl_yp > Dyp || Dnl_yn > Dyn) {
+      auto mssg =
+          "At least one transport corrected diffusion coefficient is greater "
+          "than its non-corrected counterpart";
+      spdlog::debug(mssg);
+    }
 
-      // Add removal xs along diagonal
-      M_.coeffRef(g * tot_cells + l, g * tot_cells + l) += xs_(i, j)->Er(g);
+    // Calculate n+1 diffusion coefficients from n-1 and n+1/2
+    Dnl_xp = (1 - damping_) * D_transp_corr_(g, xpsurf) + damping_ * Dnl_xp;
+    Dnl_xn = (1 - damping_) * D_transp_corr_(g, xnsurf) + damping_ * Dnl_xn;
+    Dnl_yp = (1 - damping_) * D_transp_corr_(g, ypsurf) + damping_ * Dnl_yp;
+    Dnl_yn = (1 - damping_) * D_transp_corr_(g, ynsurf) + damping_ * Dnl_yn;
 
-      // Remove scattering sources
-      for (std::size_t gg = 0; gg < ng_; ++gg) {
-        if (gg != g) {
-          M_.coeffRef(g * tot_cells + l, gg * tot_cells + l) -=
-              xs_(i, j)->Es(gg, g);
-        }
+    // Store the current CMFD iteration's diffusion coefficients
+    D_transp_corr_new(g, xpsurf) = Dnl_xp;
+    D_transp_corr_new(g, xnsurf) = Dnl_xn;
+    D_transp_corr_new(g, ypsurf) = Dnl_yp;
+    D_transp_corr_new(g, ynsurf) = Dnl_yn;
+
+    // Streaming to adjacent X cells
+    if (i != 0) {
+      add(g * tot_cells + tile_to_indx(i - 1, j), (Dnl_xn - Dxn) * invs_dx);
+    }
+    if (i != nx_ - 1) {
+      add(g * tot_cells + tile_to_indx(i + 1, j), (-Dxp - Dnl_xp) * invs_dx);
+    }
+    add(r, (Dxn + Dxp + Dnl_xn - Dnl_xp) * invs_dx);
+
+    // Streaming to adjacent Y cells
+    if (j != 0) {
+      add(g * tot_cells + tile_to_indx(i, j - 1), (Dnl_yn - Dyn) * invs_dy);
+    }
+    if (j != ny_ - 1) {
+      add(g * tot_cells + tile_to_indx(i, j + 1), (-Dyp - Dnl_yp) * invs_dy);
+    }
+    add(r, (Dyn + Dyp + Dnl_yn - Dnl_yp) * invs_dy);
+
+    // Handle periodic BC
+    // X direction
+    if (i == 0 && moc.x_min_bc() == BoundaryCondition::Periodic) {
+      add(g * tot_cells + tile_to_indx(nx_ - 1, j), (Dnl_xn - Dxn) * invs_dx);
+    }
+    if (i == nx_ - 1 && moc.x_max_bc() == BoundaryCondition::Periodic) {
+      add(g * tot_cells + tile_to_indx(0, j), (-Dxp - Dnl_xp) * invs_dx);
+    }
+    // Y direction
+    if (j == 0 && moc.y_min_bc() == BoundaryCondition::Periodic) {
+      add(g * tot_cells + tile_to_indx(i, ny_ - 1), (Dnl_yn - Dyn) * invs_dy);
+    }
+    if (j == ny_ - 1 && moc.y_max_bc() == BoundaryCondition::Periodic) {
+      add(g * tot_cells + tile_to_indx(i, 0), (-Dyp - Dnl_yp) * invs_dy);
+    }
+
+    // Add removal xs along diagonal
+    add(r, tile_Er_(l, g));
+
+    // Remove scattering sources
+    for (std::size_t gg = 0; gg < ng_; ++gg) {
+      if (gg != g) {
+        add(gg * tot_cells + l, -tile_Es_(l, gg, g));
       }
     }
-  }
+  };
+
+  // The pattern is built on the first call. Afterwards, only the values of
+  // M_ are updated, in parallel over the groups.
+  M_pattern_.assemble(M_, ng_ * tot_cells, tot_cells, fill_row);
   D_transp_corr_ = D_transp_corr_new;
-  M_.makeCompressed();
 }
 
 void CMFD::create_source_matrix() {
+  SCARABEE_PROFILE_ZONE("CMFD::create_source_matrix");
   const std::size_t tot_cells = nx_ * ny_;
-  QM_.resize(ng_ * tot_cells, ng_ * tot_cells);
-  QM_.reserve(Eigen::VectorX<std::size_t>::Constant(ng_ * tot_cells, ng_));
 
-  // Loop over all cells and groups, cell index changes fastest
-  for (std::size_t g = 0; g < ng_; g++) {
-    for (std::size_t l = 0; l < nx_ * ny_; l++) {
-      auto [i, j] = indx_to_tile(l);
-      const double chi_g = xs_(i, j)->chi(g);
-      // Loop over all groups again for fission source
-      for (std::size_t gg = 0; gg < ng_; gg++) {
-        const double vEf_gg = xs_(i, j)->vEf(gg);
-        QM_.coeffRef(g * tot_cells + l, gg * tot_cells + l) = chi_g * vEf_gg;
+  // Fills row g * tot_cells + l of QM_ with the fission source
+  const auto fill_row = [&](std::size_t r, const auto& add) {
+    const std::size_t g = r / tot_cells;
+    const std::size_t l = r % tot_cells;
+    const double chi_g = tile_chi_(l, g);
+    // Loop over all groups again for fission source
+    for (std::size_t gg = 0; gg < ng_; gg++) {
+      const double vEf_gg = tile_vEf_(l, gg);
+      add(gg * tot_cells + l, chi_g * vEf_gg);
+    }
+  };
+
+  QM_pattern_.assemble(QM_, ng_ * tot_cells, 1, fill_row);
+}
+
+void CMFD::set_coarse_mesh(
+    const std::vector<std::size_t>& nx_tiles,
+    const std::vector<std::size_t>& ny_tiles,
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups) {
+  const auto check_tiles = [](const std::vector<std::size_t>& tiles,
+                              std::size_t n, const std::string& axis) {
+    std::size_t sum = 0;
+    for (const auto t : tiles) {
+      if (t == 0) {
+        auto mssg = "Coarse CMFD tiles must contain at least one CMFD tile.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
       }
+      sum += t;
+    }
+
+    if (sum != n) {
+      std::stringstream mssg;
+      mssg << "The coarse CMFD tiles along " << axis << " contain " << sum
+           << " CMFD tiles, instead of " << n << ".";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  };
+  check_tiles(nx_tiles, nx_, "x");
+  check_tiles(ny_tiles, ny_, "y");
+
+  if (groups.empty() || groups.front().first != 0 ||
+      groups.back().second + 1 != ng_) {
+    std::stringstream mssg;
+    mssg << "The coarse energy condensation scheme must cover the CMFD groups "
+            "0 to "
+         << ng_ - 1 << ".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  for (std::size_t i = 0; i < groups.size() - 1; i++) {
+    if (groups[i].second + 1 != groups[i + 1].first) {
+      std::stringstream mssg;
+      mssg << "Coarse groups " << i << " and " << i + 1
+           << " are not continuous.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  }
+
+  // Coarse tile along each axis, and coarse group, of each CMFD index
+  std::vector<std::size_t> coarse_i, coarse_j, coarse_g;
+  for (std::size_t I = 0; I < nx_tiles.size(); I++) {
+    coarse_i.insert(coarse_i.end(), nx_tiles[I], I);
+  }
+  for (std::size_t J = 0; J < ny_tiles.size(); J++) {
+    coarse_j.insert(coarse_j.end(), ny_tiles[J], J);
+  }
+  for (std::size_t G = 0; G < groups.size(); G++) {
+    const std::size_t ngrps = groups[G].second - groups[G].first + 1;
+    coarse_g.insert(coarse_g.end(), ngrps, G);
+  }
+
+  coarse_nx_tiles_ = nx_tiles;
+  coarse_ny_tiles_ = ny_tiles;
+  coarse_groups_ = groups;
+
+  const std::size_t tot_cells = nx_ * ny_;
+  const std::size_t coarse_cells = nx_tiles.size() * ny_tiles.size();
+  coarse_size_ = groups.size() * coarse_cells;
+  coarse_indx_.resize(ng_ * tot_cells);
+
+  std::vector<Eigen::Triplet<double>> entries;
+  entries.reserve(ng_ * tot_cells);
+  for (std::size_t g = 0; g < ng_; g++) {
+    for (std::size_t l = 0; l < tot_cells; l++) {
+      const auto [i, j] = indx_to_tile(l);
+      const std::size_t c = coarse_g[g] * coarse_cells +
+                            coarse_j[j] * nx_tiles.size() + coarse_i[i];
+      const std::size_t r = g * tot_cells + l;
+      coarse_indx_[r] = c;
+      entries.emplace_back(static_cast<int>(c), static_cast<int>(r),
+                           volumes_[l]);
+    }
+  }
+  coarse_R_.resize(static_cast<int>(coarse_size_),
+                   static_cast<int>(ng_ * tot_cells));
+  coarse_R_.setFromTriplets(entries.begin(), entries.end());
+}
+
+void CMFD::clear_coarse_mesh() {
+  coarse_nx_tiles_.clear();
+  coarse_ny_tiles_.clear();
+  coarse_groups_.clear();
+  coarse_size_ = 0;
+  coarse_indx_.clear();
+  coarse_R_.resize(0, 0);
+}
+
+std::size_t CMFD::coarse_correction(Eigen::VectorXd& flux, double& keff) {
+  const std::size_t N = static_cast<std::size_t>(flux.size());
+
+  // The prolongation scales the current fine flux shape by the coarse
+  // solution, so that the restricted operators preserve the fine balance.
+  std::vector<Eigen::Triplet<double>> entries;
+  entries.reserve(N);
+  for (std::size_t r = 0; r < N; r++) {
+    entries.emplace_back(static_cast<int>(r),
+                         static_cast<int>(coarse_indx_[r]), flux(r));
+  }
+  SpMat P(static_cast<int>(N), static_cast<int>(coarse_size_));
+  P.setFromTriplets(entries.begin(), entries.end());
+
+  const SpMat A = coarse_R_ * M_ * P;
+  const SpMat F = coarse_R_ * QM_ * P;
+  coarse_lu_.compute(A);
+  if (coarse_lu_.info() != Eigen::Success) {
+    auto mssg = "Could not factorize the coarse CMFD loss matrix.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Power iteration on the coarse problem, starting from the current flux
+  constexpr std::size_t MAX_COARSE_ITERS = 1000;
+  const double tol = 0.1 * std::min(keff_tol_, flux_tol_);
+  Eigen::VectorXd psi = Eigen::VectorXd::Ones(coarse_size_);
+  Eigen::VectorXd Fpsi = F * psi;
+  Eigen::VectorXd new_psi(coarse_size_);
+  double k = keff;
+  std::size_t iteration = 0;
+  while (iteration < MAX_COARSE_ITERS) {
+    iteration++;
+    new_psi = coarse_lu_.solve((1. / k) * Fpsi);
+
+    // Estimate keff, and keep the fission source of the previous iterate
+    Eigen::VectorXd new_Fpsi = F * new_psi;
+    const double ratio = new_Fpsi.sum() / Fpsi.sum();
+    const double new_k = k * ratio;
+    new_psi /= ratio;
+    new_Fpsi /= ratio;
+
+    const double k_diff = std::abs(new_k - k) / new_k;
+    double psi_diff = 0.;
+    for (std::size_t c = 0; c < coarse_size_; c++) {
+      psi_diff = std::max(psi_diff, std::abs(new_psi(c) - psi(c)) / new_psi(c));
     }
+
+    psi = new_psi;
+    Fpsi = new_Fpsi;
+    k = new_k;
+    if (k_diff < tol && psi_diff < tol) break;
+  }
+
+  // A non-positive rebalance factor means the coarse problem is not a good
+  // approximation yet, and the fine iterate is left as is.
+  if (psi.minCoeff() <= 0.) return iteration;
+
+  for (std::size_t r = 0; r < N; r++) flux(r) *= psi(coarse_indx_[r]);
+  keff = k;
+  return iteration;
+}
+
+CMFDLinearSolver CMFD::active_linear_solver() const {
+  if (linear_solver_ != CMFDLinearSolver::Auto) return linear_solver_;
+
+  if (ng_ * nx_ * ny_ <= direct_solver_max_size_) {
+    return CMFDLinearSolver::SparseLU;
+  }
+  return CMFDLinearSolver::ILUTBiCGSTAB;
+}
+
+void CMFD::prepare_linear_solver(const Eigen::SparseMatrix<double>& A) {
+  bool success = true;
+  switch (active_linear_solver()) {
+    case CMFDLinearSolver::BiCGSTAB:
+      bicgstab_.compute(A);
+      success = bicgstab_.info() == Eigen::Success;
+      break;
+
+    case CMFDLinearSolver::ILUTBiCGSTAB:
+      ilut_bicgstab_.compute(A);
+      success = ilut_bicgstab_.info() == Eigen::Success;
+      break;
+
+    case CMFDLinearSolver::SparseLU:
+    case CMFDLinearSolver::Auto: {
+      // The sparsity pattern of the CMFD matrices is fixed, so its ordering
+      // and symbolic analysis only need to be done once.
+      const auto rows = static_cast<std::size_t>(A.rows());
+      const auto nnz = static_cast<std::size_t>(A.nonZeros());
+      if (rows != lu_rows_ || nnz != lu_nnz_) {
+        lu_.analyzePattern(A);
+        lu_rows_ = rows;
+        lu_nnz_ = nnz;
+      }
+      lu_.factorize(A);
+      success = lu_.info() == Eigen::Success;
+      if (success == false) lu_rows_ = 0;
+    } break;
+  }
+
+  if (success == false) {
+    auto mssg = "Could not initialize CMFD linear solver";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
   }
-  QM_.makeCompressed();
+}
+
+std::size_t CMFD::solve_linear(const Eigen::VectorXd& b,
+                               const Eigen::VectorXd& guess,
+                               Eigen::VectorXd& x, double tol) {
+  switch (active_linear_solver()) {
+    case CMFDLinearSolver::BiCGSTAB:
+      bicgstab_.setTolerance(tol);
+      x = bicgstab_.solveWithGuess(b, guess);
+      return static_cast<std::size_t>(bicgstab_.iterations());
+
+    case CMFDLinearSolver::ILUTBiCGSTAB:
+      ilut_bicgstab_.setTolerance(tol);
+      x = ilut_bicgstab_.solveWithGuess(b, guess);
+      return static_cast<std::size_t>(ilut_bicgstab_.iterations());
+
+    case CMFDLinearSolver::SparseLU:
+    case CMFDLinearSolver::Auto:
+      x = lu_.solve(b);
+      return 0;
+  }
+  return 0;
 }
 
 void CMFD::power_iteration(double keff) {
+  SCARABEE_PROFILE_ZONE("CMFD::power_iteration");
   // Power Iteration to solve for Keff
   // Initialize flux and source vectors
   Eigen::VectorXd new_flux(ng_ * nx_ * ny_);
@@ -1217,35 +1899,93 @@ void CMFD::power_iteration(double keff) {
   // Initialize a vector for computing keff faster
   Eigen::VectorXd VvEf(ng_ * nx_ * ny_);
   for (std::size_t l = 0; l < nx_ * ny_; l++) {
-    auto [i, j] = indx_to_tile(l);
     for (std::size_t g = 0; g < ng_; g++) {
-      double vEf = xs_(i, j)->vEf(g);
+      double vEf = tile_vEf_(l, g);
       VvEf(l + g * ny_ * nx_) = volumes_[l] * vEf;
     }
   }
 
-  // Create a solver for the problem
-  Eigen::BiCGSTAB<Eigen::SparseMatrix<double>> solver;
-  solver.compute(M_);
-  solver.setTolerance(1.E-10);
-  if (solver.info() != Eigen::Success) {
-    std::stringstream mssg;
-    mssg << "Could not initialize CMFD iterative solver";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
+  // With the Wielandt shift, each power iteration solves
+  // (M - QM / k_s) phi' = (1 / k - 1 / k_s) QM phi, where the shifted keff
+  // k_s follows the keff estimate. The shifted matrix is only rebuilt when
+  // k_s drifts out of [k + shift / 2, k + 2 shift].
+  if (has_coarse_mesh() && acceleration_ == CMFDAcceleration::Chebyshev) {
+    auto mssg =
+        "Chebyshev acceleration cannot be used with a coarse CMFD mesh, as the "
+        "coarse corrections change the error modes of the iteration.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
   }
 
+  const bool wielandt = acceleration_ == CMFDAcceleration::Wielandt;
+  double k_shift = 0.;
+  const auto prepare = [&]() {
+    if (wielandt) {
+      k_shift = keff + wielandt_shift_;
+      W_ = M_ - (1. / k_shift) * QM_;
+      prepare_linear_solver(W_);
+    } else {
+      // Factorize or precondition the loss matrix, which is then used for
+      // all power iterations
+      prepare_linear_solver(M_);
+    }
+  };
+  prepare();
+  linear_iterations_ = 0;
+  power_keffs_.clear();
+  power_residuals_.clear();
+  dominance_ratio_ = 0.;
+
+  // The adaptive tolerance of the linear solves is this fraction of the
+  // largest difference of the previous power iteration, with an upper bound
+  constexpr double ADAPTIVE_TOL_RATIO = 1.E-2;
+  constexpr double MAX_ADAPTIVE_TOL = 1.E-4;
+
+  // Chebyshev extrapolation starts after at least CHEBYSHEV_FREE_ITERS
+  // unaccelerated power iterations, once the dominance ratio estimated from
+  // the decay of the flux changes has settled to within 1%. An extrapolation
+  // which makes the flux negative restarts the cycle.
+  const bool chebyshev = acceleration_ == CMFDAcceleration::Chebyshev;
+  constexpr std::size_t CHEBYSHEV_FREE_ITERS = 3;
+  constexpr double MIN_DOMINANCE_RATIO = 0.3;
+  constexpr double MAX_DOMINANCE_RATIO = 0.995;
+  Eigen::VectorXd old_flux = flux_cmfd_;  // Flux of the previous iteration
+  std::size_t free_iters = 0;
+  std::size_t cheb_step = 0;
+  double prev_step_norm = 0.;
+  double omega = 1.;
+
+  // Tolerances of this inexact solve, which are the fixed ones without
+  // forcing
+  const double keff_tol = std::max(keff_tol_, forced_tol_);
+  const double flux_tol = std::max(flux_tol_, forced_tol_);
+  const double linear_tol =
+      std::max(linear_tol_, FORCED_LINEAR_RATIO * forced_tol_);
+
   // Begin power iteration
   double keff_diff = 100.;
   double flux_diff = 100.;
   std::size_t iteration = 0;
-  while (keff_diff > keff_tol_ || flux_diff > flux_tol_) {
+  std::size_t coarse_iterations = 0;
+  while (keff_diff > keff_tol || flux_diff > flux_tol) {
     iteration++;
+    if (wielandt && (keff + 0.5 * wielandt_shift_ > k_shift ||
+                     keff + 2. * wielandt_shift_ < k_shift)) {
+      prepare();
+    }
+
     // Compute source vector
-    Q = (1. / keff) * QM_ * flux_cmfd_;
+    const double src_factor = wielandt ? 1. / keff - 1. / k_shift : 1. / keff;
+    Q = src_factor * QM_ * flux_cmfd_;
 
     // Get new flux
-    new_flux = solver.solveWithGuess(Q, flux_cmfd_);
+    double tol = linear_tol;
+    if (adaptive_linear_tol_) {
+      const double diff = std::max(keff_diff, flux_diff);
+      tol = std::max(linear_tol,
+                     std::min(MAX_ADAPTIVE_TOL, ADAPTIVE_TOL_RATIO * diff));
+    }
+    linear_iterations_ += solve_linear(Q, flux_cmfd_, new_flux, tol);
     // For some reason, this doesn't seem to be working with the new versions
     // of Eigen, despite clearly succeeding. Just commenting it out for now.
     // if (solver.info() != Eigen::Success) {
@@ -1255,11 +1995,68 @@ void CMFD::power_iteration(double keff) {
 
     // Estimate keff
     double prev_keff = keff;
-    keff = prev_keff * (VvEf.dot(new_flux) / VvEf.dot(flux_cmfd_));
+    const double ratio = VvEf.dot(new_flux) / VvEf.dot(flux_cmfd_);
+    if (wielandt) {
+      keff = 1. / (1. / k_shift + (1. / prev_keff - 1. / k_shift) / ratio);
+    } else {
+      keff = prev_keff * ratio;
+    }
     keff_diff = std::abs(keff - prev_keff) / keff;
 
-    // Normalize our new flux
-    new_flux *= prev_keff / keff;
+    // Normalize our new flux, to keep the fission source of the previous one
+    new_flux /= ratio;
+
+    // Rebalance the flux with the coarse level of the two-grid iteration
+    if (has_coarse_mesh()) {
+      coarse_iterations += coarse_correction(new_flux, keff);
+      keff_diff = std::abs(keff - prev_keff) / keff;
+    }
+
+    if (chebyshev) {
+      if (cheb_step == 0) {
+        free_iters++;
+        const double step_norm = (new_flux - flux_cmfd_).norm();
+        if (prev_step_norm > 0.) {
+          const double ratio_est =
+              std::min(step_norm / prev_step_norm, MAX_DOMINANCE_RATIO);
+          if (free_iters > CHEBYSHEV_FREE_ITERS &&
+              ratio_est > MIN_DOMINANCE_RATIO &&
+              std::abs(ratio_est - dominance_ratio_) < 0.01 * ratio_est) {
+            cheb_step = 1;
+          }
+          dominance_ratio_ = ratio_est;
+        }
+        prev_step_norm = step_norm;
+      }
+
+      if (cheb_step > 0) {
+        // Chebyshev semi-iteration for error modes with ratios in
+        // [0, dominance_ratio_]
+        const double sigma = dominance_ratio_;
+        const double gamma = 2. / (2. - sigma);
+        const double invs_xi2 = (sigma / (2. - sigma)) * (sigma / (2. - sigma));
+        if (cheb_step == 1) {
+          omega = 1.;
+        } else if (cheb_step == 2) {
+          omega = 1. / (1. - 0.5 * invs_xi2);
+        } else {
+          omega = 1. / (1. - 0.25 * invs_xi2 * omega);
+        }
+
+        Eigen::VectorXd extrap_flux =
+            omega * (gamma * new_flux + (1. - gamma) * flux_cmfd_) +
+            (1. - omega) * old_flux;
+        if (extrap_flux.minCoeff() > 0.) {
+          new_flux = extrap_flux;
+          cheb_step++;
+        } else {
+          cheb_step = 0;
+          free_iters = 0;
+          prev_step_norm = 0.;
+          dominance_ratio_ = 0.;
+        }
+      }
+    }
 
     // Find the max flux error
     flux_diff = 0.;
@@ -1267,12 +2064,22 @@ void CMFD::power_iteration(double keff) {
       double flux_diff_i = std::abs(new_flux(i) - flux_cmfd_(i)) / new_flux(i);
       if (flux_diff_i > flux_diff) flux_diff = flux_diff_i;
     }
+    if (chebyshev) old_flux = flux_cmfd_;
     flux_cmfd_ = new_flux;
+    power_keffs_.push_back(keff);
+    power_residuals_.push_back(flux_diff);
   }
   keff_ = keff;
+  telemetry_.add_count("power_iterations", iteration);
+  telemetry_.add_count("linear_iterations", linear_iterations_);
+  if (has_coarse_mesh()) {
+    telemetry_.add_count("coarse_iterations", coarse_iterations);
+  }
+  telemetry_.add_iteration(flux_diff, keff_);
 }
 
 void CMFD::fixed_source_solve() {
+  SCARABEE_PROFILE_ZONE("CMFD::fixed_source_solve");
   // Solve fixed source problem
   // Subtract fission source from loss matrix
   Eigen::SparseMatrix<double> L = M_ - QM_;
@@ -1280,19 +2087,14 @@ void CMFD::fixed_source_solve() {
   Eigen::VectorXd new_flux(ng_ * nx_ * ny_);
 
   // Create a solver for the problem
-  Eigen::BiCGSTAB<Eigen::SparseMatrix<double>> solver;
-  solver.compute(L);
-  solver.setTolerance(1.E-10);
-
-  if (solver.info() != Eigen::Success) {
-    std::stringstream mssg;
-    mssg << "Could not initialize CMFD iterative solver";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
-  }
+  prepare_linear_solver(L);
 
   // Get new flux
-  new_flux = solver.solveWithGuess(extern_src_, flux_cmfd_);
+  const double linear_tol =
+      std::max(linear_tol_, FORCED_LINEAR_RATIO * forced_tol_);
+  linear_iterations_ =
+      solve_linear(extern_src_, flux_cmfd_, new_flux, linear_tol);
+  telemetry_.add_count("linear_iterations", linear_iterations_);
   // For some reason, this doesn't seem to be working with the new versions
   // of Eigen, despite clearly succeeding. Just commenting it out for now.
   // if (solver.info() != Eigen::Success) {
@@ -1312,6 +2114,7 @@ void CMFD::update_moc_fluxes(MOCDriver& moc) {
   const double moc_norm = xt::sum(flux_)();
   flux_ /= moc_norm;
   surface_currents_ /= moc_norm;
+  surface_partial_currents_ /= moc_norm;
   flux_cmfd_ /= flux_cmfd_.sum();
 
   // Precompute update ratio in each CMFD cell
@@ -1392,9 +2195,9 @@ void CMFD::update_moc_fluxes(MOCDriver& moc) {
       for (std::size_t g = 0; g < moc_to_cmfd_group_map_.size(); g++) {
         const std::size_t G = moc_to_cmfd_group_map_[g];
         const std::size_t g_indx = G * tot_cells;
-        xt::view(track.entry_flux(), g, xt::all()) *=
+        xt::view(moc.track_flux_, track.entry_flux(), g, xt::all()) *=
             update_ratios_(g_indx + entry_cell);
-        xt::view(track.exit_flux(), g, xt::all()) *=
+        xt::view(moc.track_flux_, track.exit_flux(), g, xt::all()) *=
             update_ratios_(g_indx + exit_cell);
       }
     }
@@ -1406,12 +2209,58 @@ void CMFD::update_moc_fluxes(MOCDriver& moc) {
   }
 }
 
+void CMFD::save_solution(bool replace_last, std::size_t max_solutions) {
+  if (replace_last && history_keff_.empty() == false) {
+    history_flux_.pop_back();
+    history_keff_.pop_back();
+  }
+
+  history_flux_.push_back(flux_cmfd_);
+  history_keff_.push_back(keff_);
+
+  while (history_keff_.size() > max_solutions) {
+    history_flux_.erase(history_flux_.begin());
+    history_keff_.erase(history_keff_.begin());
+  }
+}
+
+void CMFD::extrapolate_solution(const std::vector<double>& weights) {
+  // The CMFD may have been added after some of the MOC solutions
+  if (weights.empty() || weights.size() > history_keff_.size()) return;
+
+  const std::size_t first = history_keff_.size() - weights.size();
+  const Eigen::VectorXd& last_flux = history_flux_.back();
+  if (last_flux.size() != flux_cmfd_.size()) return;
+
+  Eigen::VectorXd flux = Eigen::VectorXd::Zero(flux_cmfd_.size());
+  double keff = 0.;
+  for (std::size_t k = 0; k < weights.size(); k++) {
+    flux += weights[k] * history_flux_[first + k];
+    keff += weights[k] * history_keff_[first + k];
+  }
+
+  // Negative values would be unphysical, so we keep the last solution there
+  for (Eigen::Index i = 0; i < flux.size(); i++) {
+    if (flux(i) < 0.) flux(i) = last_flux(i);
+  }
+
+  flux_cmfd_ = flux;
+  keff_ = keff > 0. ? keff : history_keff_.back();
+}
+
+void CMFD::clear_solution_history() {
+  history_flux_.clear();
+  history_keff_.clear();
+}
+
 void CMFD::solve(MOCDriver& moc, double keff, std::size_t moc_iteration) {
+  SCARABEE_PROFILE_ZONE("CMFD::solve");
   Timer cmfd_timer;
   cmfd_timer.reset();
   cmfd_timer.start();
   solved_ = false;
   moc_iteration_ = moc_iteration;
+  if (moc_iteration <= 1) telemetry_.clear();
   if (moc.sim_mode() == SimulationMode::Keff) {
     mode_ = SimulationMode::Keff;
   } else if (moc.sim_mode() == SimulationMode::FixedSource) {
@@ -1422,17 +2271,30 @@ void CMFD::solve(MOCDriver& moc, double keff, std::size_t moc_iteration) {
   if (moc_iteration > skip_moc_iterations_) {
     cmfd_solves_++;
 
-    this->normalize_currents();
-    this->compute_homogenized_xs_and_flux(moc);
-    this->create_loss_matrix(moc);
-    this->create_source_matrix();
-    if (mode_ == SimulationMode::Keff) {
-      this->power_iteration(keff_);
-    } else if (mode_ == SimulationMode::FixedSource) {
-      this->fixed_source_solve();
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "homogenization");
+      this->normalize_currents();
+      this->compute_homogenized_xs_and_flux(moc);
+    }
+    this->update_forced_tolerance(moc_iteration);
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "assembly");
+      this->create_loss_matrix(moc);
+      this->create_source_matrix();
+    }
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "linear_solve");
+      if (mode_ == SimulationMode::Keff) {
+        this->power_iteration(keff_);
+      } else if (mode_ == SimulationMode::FixedSource) {
+        this->fixed_source_solve();
+      }
     }
     solved_ = true;
-    this->update_moc_fluxes(moc);
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "update_moc_flux");
+      this->update_moc_fluxes(moc);
+    }
 
     if (neutron_balance_check_) {
       for (std::size_t i = 0; i < nx_; i++) {
@@ -0,0 +1,307 @@
+#include <data/compiled_depletion_chain.hpp>
+#include <utils/constants.hpp>
+#include <utils/logging.hpp>
+#include <utils/nuclide_names.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <variant>
+
+namespace scarabee {
+
+namespace {
+constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+void target_branches(const Target& target,
+                     std::vector<std::pair<std::string, double>>& out) {
+  out.clear();
+  if (std::holds_alternative<SingleTarget>(target)) {
+    out.emplace_back(std::get<SingleTarget>(target).target(), 1.);
+  } else if (std::holds_alternative<BranchingTargets>(target)) {
+    for (const auto& branch : std::get<BranchingTargets>(target).branches()) {
+      out.emplace_back(branch.target, branch.branch_ratio);
+    }
+  }
+}
+
+const std::optional<Target>& reaction_target(const ChainEntry& entry,
+                                             std::size_t r) {
+  switch (r) {
+    case CompiledDepletionChain::Decay:
+      return entry.decay_targets();
+    case CompiledDepletionChain::NGamma:
+      return entry.n_gamma();
+    case CompiledDepletionChain::N2N:
+      return entry.n_2n();
+    case CompiledDepletionChain::N3N:
+      return entry.n_3n();
+    case CompiledDepletionChain::NP:
+      return entry.n_p();
+    default:
+      return entry.n_alpha();
+  }
+}
+}  // namespace
+
+CompiledDepletionChain::CompiledDepletionChain(
+    std::shared_ptr<const DepletionChain> chain)
+    : chain_(chain),
+      names_(),
+      ids_(),
+      has_entry_(),
+      decay_constant_(),
+      reactions_(),
+      fission_yields_(),
+      fission_(),
+      topological_order_() {
+  if (chain_ == nullptr) {
+    const auto mssg = "DepletionChain is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // All nuclides, with entries or only as targets
+  const std::set<std::string> entries = chain_->nuclides();
+  std::set<std::string> all_nuclides = entries;
+  std::vector<std::pair<std::string, double>> branches;
+  for (const auto& nuc : entries) {
+    const auto& entry = chain_->nuclide_data(nuc);
+    for (std::size_t r = 0; r < NREACTIONS; r++) {
+      const auto& target = reaction_target(entry, r);
+      if (target.has_value() == false) continue;
+      target_branches(*target, branches);
+      for (const auto& b : branches) all_nuclides.insert(b.first);
+    }
+    if (entry.n_fission()) {
+      for (const auto& t : entry.n_fission()->targets()) all_nuclides.insert(t);
+    }
+  }
+
+  // Sort nuclides by Z then A, as in a DepletionMatrix
+  names_.assign(all_nuclides.begin(), all_nuclides.end());
+  std::stable_sort(names_.begin(), names_.end(),
+                   [](const std::string& n1, const std::string& n2) {
+                     return nuclide_name_to_za(n1) < nuclide_name_to_za(n2);
+                   });
+
+  const std::size_t n = names_.size();
+  ids_.reserve(n);
+  for (std::size_t i = 0; i < n; i++) ids_.emplace(names_[i], i);
+
+  has_entry_.assign(n, 0);
+  decay_constant_.assign(n, 0.);
+  fission_yields_.assign(n, nullptr);
+  for (auto& adj : reactions_) {
+    adj.present.assign(n, 0);
+    adj.ptr.assign(1, 0);
+  }
+  fission_.present.assign(n, 0);
+  fission_.ptr.assign(1, 0);
+
+  for (std::size_t i = 0; i < n; i++) {
+    const ChainEntry* entry = nullptr;
+    if (entries.contains(names_[i])) {
+      entry = &chain_->nuclide_data(names_[i]);
+      has_entry_[i] = 1;
+
+      // Must convert half life to decay constant !
+      if (entry->half_life()) {
+        decay_constant_[i] = LN_2 / entry->half_life().value();
+      }
+    }
+
+    for (std::size_t r = 0; r < NREACTIONS; r++) {
+      auto& adj = reactions_[r];
+      if (entry && reaction_target(*entry, r).has_value()) {
+        adj.present[i] = 1;
+        target_branches(*reaction_target(*entry, r), branches);
+        for (const auto& b : branches) {
+          adj.target.push_back(ids_.at(b.first));
+          adj.ratio.push_back(b.second);
+        }
+      }
+      adj.ptr.push_back(adj.target.size());
+    }
+
+    if (entry && entry->n_fission()) {
+      fission_.present[i] = 1;
+      fission_yields_[i] = &entry->n_fission().value();
+      for (const auto& t : entry->n_fission()->targets()) {
+        fission_.target.push_back(ids_.at(t));
+      }
+    }
+    fission_.ptr.push_back(fission_.target.size());
+  }
+
+  this->compute_topological_order();
+}
+
+std::shared_ptr<const CompiledDepletionChain> CompiledDepletionChain::get(
+    std::shared_ptr<const DepletionChain> chain) {
+  if (chain == nullptr) {
+    const auto mssg = "DepletionChain is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Only a few chains are usually in use at once
+  constexpr std::size_t MAX_CHAINS = 16;
+  static std::mutex mtx;
+  static std::map<std::uint64_t, std::shared_ptr<const CompiledDepletionChain>>
+      cache;
+
+  const std::uint64_t uid = chain->uid();
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto it = cache.find(uid);
+    if (it != cache.end()) return it->second;
+  }
+
+  // Compiled outside of the lock. Two threads compiling the same chain is
+  // only wasted work, and only the first is kept.
+  auto compiled = std::make_shared<const CompiledDepletionChain>(chain);
+
+  std::lock_guard<std::mutex> lock(mtx);
+  if (cache.size() >= MAX_CHAINS) cache.clear();
+  const auto [it, inserted] = cache.emplace(uid, compiled);
+  return it->second;
+}
+
+bool CompiledDepletionChain::has_nuclide(const std::string& name) const {
+  return ids_.find(name) != ids_.end();
+}
+
+std::size_t CompiledDepletionChain::id(const std::string& name) const {
+  const auto it = ids_.find(name);
+  if (it != ids_.end()) return it->second;
+
+  const auto mssg = "Depletion chain does not contain \"" + name + "\".";
+  spdlog::error(mssg);
+  throw ScarabeeException(mssg);
+
+  // NEVER GETS HERE
+  return 0;
+}
+
+std::vector<std::size_t> CompiledDepletionChain::descend(
+    std::span<const std::size_t> ids) const {
+  std::vector<char> found(this->size(), 0);
+  std::vector<std::size_t> next;
+  for (const auto i : ids) {
+    if (found[i] == 0) {
+      found[i] = 1;
+      next.push_back(i);
+    }
+  }
+
+  auto visit = [&found, &next](std::span<const std::size_t> targets) {
+    for (const auto t : targets) {
+      if (found[t] == 0) {
+        found[t] = 1;
+        next.push_back(t);
+      }
+    }
+  };
+
+  while (next.empty() == false) {
+    const std::size_t i = next.back();
+    next.pop_back();
+    for (std::size_t r = 0; r < NREACTIONS; r++) {
+      visit(this->targets(i, static_cast<Reaction>(r)));
+    }
+    visit(this->fission_targets(i));
+  }
+
+  std::vector<std::size_t> out;
+  for (std::size_t i = 0; i < found.size(); i++) {
+    if (found[i]) out.push_back(i);
+  }
+  return out;
+}
+
+void CompiledDepletionChain::compute_topological_order() {
+  const std::size_t n = this->size();
+
+  // All successors of each nuclide, for all reactions
+  std::vector<std::size_t> succ_ptr(1, 0);
+  std::vector<std::size_t> succ;
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t r = 0; r < NREACTIONS; r++) {
+      const auto t = this->targets(i, static_cast<Reaction>(r));
+      succ.insert(succ.end(), t.begin(), t.end());
+    }
+    const auto t = this->fission_targets(i);
+    succ.insert(succ.end(), t.begin(), t.end());
+    succ_ptr.push_back(succ.size());
+  }
+
+  // Tarjan's algorithm, without recursion. Strongly connected components are
+  // found after all of the components they lead to, so the order of the
+  // components is reversed at the end.
+  std::vector<std::size_t> index(n, NONE);
+  std::vector<std::size_t> low(n, 0);
+  std::vector<char> on_stack(n, 0);
+  std::vector<std::size_t> stack;
+  std::vector<std::vector<std::size_t>> components;
+  std::vector<std::pair<std::size_t, std::size_t>> calls;
+  std::size_t next_index = 0;
+
+  auto start = [&](std::size_t v) {
+    index[v] = low[v] = next_index++;
+    stack.push_back(v);
+    on_stack[v] = 1;
+    calls.emplace_back(v, succ_ptr[v]);
+  };
+
+  for (std::size_t root = 0; root < n; root++) {
+    if (index[root] != NONE) continue;
+    start(root);
+
+    while (calls.empty() == false) {
+      const std::size_t v = calls.back().first;
+      const std::size_t e = calls.back().second;
+
+      if (e < succ_ptr[v + 1]) {
+        calls.back().second++;
+        const std::size_t w = succ[e];
+        if (index[w] == NONE) {
+          start(w);
+        } else if (on_stack[w]) {
+          low[v] = std::min(low[v], index[w]);
+        }
+        continue;
+      }
+
+      if (low[v] == index[v]) {
+        components.emplace_back();
+        std::size_t w = NONE;
+        do {
+          w = stack.back();
+          stack.pop_back();
+          on_stack[w] = 0;
+          components.back().push_back(w);
+        } while (w != v);
+      }
+
+      calls.pop_back();
+      if (calls.empty() == false) {
+        const std::size_t u = calls.back().first;
+        low[u] = std::min(low[u], low[v]);
+      }
+    }
+  }
+
+  topological_order_.clear();
+  topological_order_.reserve(n);
+  for (auto it = components.rbegin(); it != components.rend(); it++) {
+    topological_order_.insert(topological_order_.end(), it->begin(),
+                              it->end());
+  }
+}
+
+}  // namespace scarabee
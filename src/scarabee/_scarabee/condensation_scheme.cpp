@@ -0,0 +1,70 @@
+#include <data/condensation_scheme.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <sstream>
+
+namespace scarabee {
+
+CondensationScheme::CondensationScheme(
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups,
+    std::size_t ngroups)
+    : groups_(groups), macro_group_(ngroups, 0) {
+  const std::size_t NGOUT = groups_.size();
+  const std::size_t NG = ngroups;
+
+  if (groups_.size() == 0) {
+    auto mssg = "Empty energy condensation scheme provided.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (groups_.front().first != 0) {
+    auto mssg = "The energy condensation scheme does not start with 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (groups_.back().second != NG - 1) {
+    std::stringstream mssg;
+    mssg << "The energy condensation scheme does not end with " << NG - 1
+         << ".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  for (std::size_t i = 0; i < NGOUT - 1; i++) {
+    if (groups_[i].second + 1 != groups_[i + 1].first) {
+      std::stringstream mssg;
+      mssg << "Condensed groups " << i << " and " << i + 1
+           << " are not continuous.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  }
+
+  for (std::size_t G = 0; G < NGOUT; G++) {
+    if (groups_[G].first > groups_[G].second) {
+      std::stringstream mssg;
+      mssg << "Condensed group " << G << " is empty.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+
+    for (std::size_t g = groups_[G].first; g <= groups_[G].second; g++) {
+      macro_group_[g] = G;
+    }
+  }
+}
+
+void CondensationScheme::check_flux(std::size_t nflux) const {
+  if (nflux != ngroups()) {
+    auto mssg =
+        "The number of provided flux values diagrees with the number of energy "
+        "groups.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+}  // namespace scarabee
@@ -0,0 +1,270 @@
+#include <data/cram_elimination.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+namespace scarabee {
+
+namespace {
+std::size_t pattern_hash(const Eigen::SparseMatrix<double>& A) {
+  // FNV-1a over the compressed pattern
+  std::uint64_t h = 14695981039346656037ULL;
+  auto mix = [&h](std::uint64_t v) {
+    h ^= v;
+    h *= 1099511628211ULL;
+  };
+
+  mix(static_cast<std::uint64_t>(A.rows()));
+  const auto nouter = static_cast<std::size_t>(A.outerSize());
+  for (std::size_t c = 0; c <= nouter; c++) {
+    mix(static_cast<std::uint64_t>(A.outerIndexPtr()[c]));
+  }
+  const auto nnz = static_cast<std::size_t>(A.nonZeros());
+  for (std::size_t e = 0; e < nnz; e++) {
+    mix(static_cast<std::uint64_t>(A.innerIndexPtr()[e]));
+  }
+
+  return static_cast<std::size_t>(h);
+}
+
+void check_pattern_matrix(const Eigen::SparseMatrix<double>& A) {
+  if (A.isCompressed() == false) {
+    const auto mssg = "CRAM elimination requires a compressed matrix.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (A.rows() != A.cols()) {
+    const auto mssg = "CRAM elimination requires a square matrix.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+}  // namespace
+
+CRAMElimination::CRAMElimination(const Eigen::SparseMatrix<double>& A)
+    : row_ptr_(), col_(), diag_(), a_pos_(), eliminations_(), updates_(),
+      outer_(), inner_() {
+  check_pattern_matrix(A);
+
+  const std::size_t n = static_cast<std::size_t>(A.rows());
+  const std::size_t nnz = static_cast<std::size_t>(A.nonZeros());
+
+  outer_.assign(A.outerIndexPtr(), A.outerIndexPtr() + n + 1);
+  inner_.assign(A.innerIndexPtr(), A.innerIndexPtr() + nnz);
+
+  // Columns of the entries in each row of A, with the diagonal, which is
+  // always needed for the poles
+  std::vector<std::vector<std::size_t>> rows(n);
+  for (std::size_t c = 0; c < n; c++) {
+    for (std::size_t e = static_cast<std::size_t>(outer_[c]);
+         e < static_cast<std::size_t>(outer_[c + 1]); e++) {
+      rows[static_cast<std::size_t>(inner_[e])].push_back(c);
+    }
+  }
+
+  // Symbolic elimination, one row at a time. Eliminating entry (i, k) adds
+  // the pattern of the upper part of row k to row i, which may create new
+  // entries left of the diagonal which must also be eliminated.
+  std::vector<std::vector<std::size_t>> factor_rows(n);
+  for (std::size_t i = 0; i < n; i++) {
+    std::set<std::size_t> row(rows[i].begin(), rows[i].end());
+    row.insert(i);
+
+    for (auto it = row.begin(); *it < i; it++) {
+      const auto& row_k = factor_rows[*it];
+      auto kk = std::lower_bound(row_k.begin(), row_k.end(), *it);
+      row.insert(kk + 1, row_k.end());
+    }
+
+    factor_rows[i].assign(row.begin(), row.end());
+  }
+
+  // Row compressed storage of the factors
+  row_ptr_.assign(1, 0);
+  diag_.resize(n);
+  for (std::size_t i = 0; i < n; i++) {
+    for (const auto j : factor_rows[i]) {
+      if (j == i) diag_[i] = col_.size();
+      col_.push_back(j);
+    }
+    row_ptr_.push_back(col_.size());
+  }
+
+  // Positions of the entries of A in the factors
+  a_pos_.resize(nnz);
+  for (std::size_t c = 0; c < n; c++) {
+    for (std::size_t e = static_cast<std::size_t>(outer_[c]);
+         e < static_cast<std::size_t>(outer_[c + 1]); e++) {
+      const std::size_t r = static_cast<std::size_t>(inner_[e]);
+      const auto begin =
+          col_.begin() + static_cast<std::ptrdiff_t>(row_ptr_[r]);
+      const auto end =
+          col_.begin() + static_cast<std::ptrdiff_t>(row_ptr_[r + 1]);
+      const auto pos = std::lower_bound(begin, end, c);
+      a_pos_[e] = static_cast<std::size_t>(pos - col_.begin());
+    }
+  }
+
+  // Elimination operations, in the order they must be performed
+  constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> pos_in_row(n, NONE);
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t q = row_ptr_[i]; q < row_ptr_[i + 1]; q++) {
+      pos_in_row[col_[q]] = q;
+    }
+
+    for (std::size_t q = row_ptr_[i]; q < diag_[i]; q++) {
+      const std::size_t k = col_[q];
+      Elimination elim{q, diag_[k], updates_.size(), 0};
+      for (std::size_t kj = diag_[k] + 1; kj < row_ptr_[k + 1]; kj++) {
+        updates_.push_back({kj, pos_in_row[col_[kj]]});
+      }
+      elim.end = updates_.size();
+      eliminations_.push_back(elim);
+    }
+
+    for (std::size_t q = row_ptr_[i]; q < row_ptr_[i + 1]; q++) {
+      pos_in_row[col_[q]] = NONE;
+    }
+  }
+}
+
+std::shared_ptr<const CRAMElimination> CRAMElimination::get(
+    const Eigen::SparseMatrix<double>& A) {
+  check_pattern_matrix(A);
+
+  static std::mutex mtx;
+  static std::unordered_multimap<std::size_t,
+                                 std::shared_ptr<const CRAMElimination>>
+      cache;
+
+  const std::size_t h = pattern_hash(A);
+
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto [begin, end] = cache.equal_range(h);
+    for (auto it = begin; it != end; it++) {
+      if (it->second->matches(A)) return it->second;
+    }
+  }
+
+  // The structure is built outside of the lock. Two threads making the same
+  // structure is only wasted work, and only the first is kept.
+  auto elim = std::make_shared<const CRAMElimination>(A);
+
+  std::lock_guard<std::mutex> lock(mtx);
+  const auto [begin, end] = cache.equal_range(h);
+  for (auto it = begin; it != end; it++) {
+    if (it->second->matches(A)) return it->second;
+  }
+  cache.emplace(h, elim);
+  return elim;
+}
+
+bool CRAMElimination::matches(const Eigen::SparseMatrix<double>& A) const {
+  if (A.isCompressed() == false || A.rows() != A.cols() ||
+      static_cast<std::size_t>(A.rows()) != this->size() ||
+      static_cast<std::size_t>(A.nonZeros()) != inner_.size()) {
+    return false;
+  }
+
+  return std::equal(outer_.begin(), outer_.end(), A.outerIndexPtr()) &&
+         std::equal(inner_.begin(), inner_.end(), A.innerIndexPtr());
+}
+
+bool CRAMElimination::exponential_product(
+    const Eigen::SparseMatrix<double>& A, std::span<double> N,
+    std::span<const std::complex<double>> theta,
+    std::span<const std::complex<double>> alpha, double alpha0) const {
+  const std::size_t n = this->size();
+  const std::size_t P = theta.size();
+
+  // Values of the factors of all poles, with the poles of one entry next to
+  // each other so that each operation is a short loop over the poles. The
+  // work arrays are kept per thread, as many materials are usually depleted
+  // at the same time, and all have the same size.
+  thread_local std::vector<std::complex<double>> v;
+  thread_local std::vector<double> Nw;
+  thread_local std::vector<std::complex<double>> x;
+  v.assign(this->nonzeros() * P, 0.);
+  const double* a = A.valuePtr();
+  for (std::size_t e = 0; e < a_pos_.size(); e++) {
+    std::complex<double>* ve = v.data() + a_pos_[e] * P;
+    for (std::size_t p = 0; p < P; p++) ve[p] = a[e];
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    std::complex<double>* vii = v.data() + diag_[i] * P;
+    for (std::size_t p = 0; p < P; p++) vii[p] -= theta[p];
+  }
+
+  // Numeric factorization of all poles at once
+  for (const auto& elim : eliminations_) {
+    std::complex<double>* lik = v.data() + elim.ik * P;
+    const std::complex<double>* ukk = v.data() + elim.kk * P;
+    for (std::size_t p = 0; p < P; p++) lik[p] /= ukk[p];
+
+    for (std::size_t u = elim.begin; u < elim.end; u++) {
+      std::complex<double>* aij = v.data() + updates_[u].ij * P;
+      const std::complex<double>* ukj = v.data() + updates_[u].kj * P;
+      for (std::size_t p = 0; p < P; p++) aij[p] -= lik[p] * ukj[p];
+    }
+  }
+
+  for (std::size_t i = 0; i < n; i++) {
+    const std::complex<double>* uii = v.data() + diag_[i] * P;
+    for (std::size_t p = 0; p < P; p++) {
+      if (uii[p] == 0. || std::isfinite(uii[p].real()) == false ||
+          std::isfinite(uii[p].imag()) == false) {
+        return false;
+      }
+    }
+  }
+
+  // The poles are applied one after the other, each to the result of the
+  // previous one
+  Nw.assign(N.begin(), N.end());
+  x.resize(n);
+  for (std::size_t p = 0; p < P; p++) {
+    // Forward substitution with the unit lower factor
+    for (std::size_t i = 0; i < n; i++) {
+      std::complex<double> xi = Nw[i];
+      for (std::size_t q = row_ptr_[i]; q < diag_[i]; q++) {
+        xi -= v[q * P + p] * x[col_[q]];
+      }
+      x[i] = xi;
+    }
+
+    // Backward substitution with the upper factor
+    for (std::size_t ii = n; ii > 0; ii--) {
+      const std::size_t i = ii - 1;
+      std::complex<double> xi = x[i];
+      for (std::size_t q = diag_[i] + 1; q < row_ptr_[i + 1]; q++) {
+        xi -= v[q * P + p] * x[col_[q]];
+      }
+      x[i] = xi / v[diag_[i] * P + p];
+    }
+
+    const std::complex<double> a2 = 2. * alpha[p];
+    for (std::size_t i = 0; i < n; i++) Nw[i] += (a2 * x[i]).real();
+  }
+
+  for (std::size_t i = 0; i < n; i++) {
+    if (std::isfinite(Nw[i]) == false) return false;
+  }
+
+  for (std::size_t i = 0; i < n; i++) {
+    N[i] = Nw[i] * alpha0;
+    if (N[i] < 0.) N[i] = 0.;
+  }
+
+  return true;
+}
+
+}  // namespace scarabee
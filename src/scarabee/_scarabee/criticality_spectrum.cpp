@@ -1,12 +1,17 @@
 #include <utils/criticality_spectrum.hpp>
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
+#include <utils/threads.hpp>
 
 #include <xtensor/generators/xbuilder.hpp>
 
 #include <Eigen/Dense>
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 namespace scarabee {
 
@@ -46,22 +51,6 @@ void fill_alphas(xt::xtensor<double, 1>& a,
 
   for (std::size_t g = 0; g < NG; g++) {
     const double Et2 = xs->Et(g) * xs->Et(g);
-    const double y = B2 / Et2;
-
-    if (std::abs(y) < 0.01) {
-      const double x = (1. / 3.) - y * (0.2 - (1. / 7.) * y);
-      a[g] = (1. / 3.) * ((1. / x) - y);
-    } else if (y < 0.) {
-      const double x = std::min(std::sqrt(-y), 0.999);
-      const double xx = 0.5 * std::log((1. + x) / (1. - x));
-      a[g] = (1. / 3.) * y * xx / (x - xx);
-    } else {
-      // y > 0
-      const double x = std::sqrt(y);
-      const double xx = std::atan(x);
-      a[g] = (1. / 3.) * y * xx / (x - xx);
-    }
-
     const double x2 = std::abs(B2 / Et2);
     const double x = std::sqrt(x2);
 
@@ -81,60 +70,95 @@ void fill_alphas(xt::xtensor<double, 1>& a,
   }
 }
 
-P1CriticalitySpectrum::P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs) {
+struct CriticalitySpectrum::Workspace {
+  Eigen::MatrixXd A, Dinvs, D;
+  Eigen::VectorXd chi, vEf, flx, cur;
+  Eigen::PartialPivLU<Eigen::MatrixXd> A_solver;
+  xt::xtensor<double, 1> a;
+
+  // Only reallocates when the number of groups changes
+  void load(const std::shared_ptr<CrossSection>& xs) {
+    const std::size_t NG = xs->ngroups();
+    if (static_cast<std::size_t>(chi.size()) != NG) {
+      A.resize(NG, NG);
+      Dinvs.resize(NG, NG);
+      chi.resize(NG);
+      vEf.resize(NG);
+      a = xt::zeros<double>({NG});
+    }
+
+    for (std::size_t g = 0; g < NG; g++) {
+      chi(g) = xs->chi(g);
+      vEf(g) = xs->vEf(g);
+    }
+  }
+
+  // Computes D for the buckling. For the P1 approximation, the alphas are
+  // all 1 and D does not depend on B2.
+  void fill_D(const std::shared_ptr<CrossSection>& xs, bool b1, double B2) {
+    if (b1) {
+      fill_alphas(a, xs, B2);
+    } else {
+      a.fill(1.);
+    }
+    fill_Dinvs(Dinvs, xs, a);
+    D = Dinvs.inverse();
+  }
+
+  // Solves for the flux with the current D, and returns k
+  double solve(const std::shared_ptr<CrossSection>& xs, double B2) {
+    fill_A(A, xs, D, B2);
+    A_solver.compute(A);
+    flx = A_solver.solve(chi);
+    return vEf.dot(flx);
+  }
+
+  double k(const std::shared_ptr<CrossSection>& xs, bool b1, double B2) {
+    if (b1) fill_D(xs, b1, B2);
+    return solve(xs, B2);
+  }
+};
+
+void CriticalitySpectrum::solve_critical(std::shared_ptr<CrossSection> xs,
+                                         Workspace& ws, bool b1,
+                                         double B2_guess) {
   if (xs->fissile() == false) {
     std::stringstream mssg;
-    mssg << "Cannot compute P1 spectrum of homogenized material that is not "
-            "fissile.";
+    mssg << "Cannot compute " << (b1 ? "B1" : "P1")
+         << " spectrum of homogenized material that is not fissile.";
     spdlog::error(mssg.str());
     throw ScarabeeException(mssg.str());
   }
 
   const std::size_t NG = xs->ngroups();
+  ws.load(xs);
+  ws.fill_D(xs, b1, 0.);
 
-  // For P1 approximation, alphas are all 1
-  const xt::xtensor<double, 1> a = xt::ones<double>({NG});
-
-  // Make vectors for flux and current
-  Eigen::VectorXd flx(NG);
-  Eigen::VectorXd cur(NG);
-  Eigen::VectorXd chi(NG), vEf(NG);
-  for (std::size_t g = 0; g < NG; g++) {
-    chi(g) = xs->chi(g);
-    vEf(g) = xs->vEf(g);
-  }
+  // Solve B2 = 0 for k_inf
+  double B2_0 = 0.;
+  k_inf_ = ws.solve(xs, B2_0);
+  double f_0 = (1. / k_inf_) - 1.;
 
-  // Create the A matrix
-  Eigen::MatrixXd A(NG, NG);
-  Eigen::MatrixXd Dinvs(NG, NG);
-  fill_Dinvs(Dinvs, xs, a);
-  const Eigen::MatrixXd D = Dinvs.inverse();
+  // Solve for the guess, or for a small B2 from Stamm'ler and Abbate
+  B2_ = B2_guess;
+  if (B2_ == 0.) B2_ = k_inf_ < 1. ? -0.001 : 0.001;
+  double k = ws.k(xs, b1, B2_);
+  double f = (1. / k) - 1.;
 
-  // Solve B2 = 0 for k_inf
-  B2_ = 0.;
-  fill_A(A, xs, D, B2_);
-  auto A_solver = A.colPivHouseholderQr();
-  flx = A_solver.solve(chi);
-  k_inf_ = vEf.dot(flx);
-
-  // Solve for small B2 for k1
-  B2_ = 0.001;
-  if (k_inf_ < 1.) B2_ = -B2_;
-  fill_A(A, xs, D, B2_);
-  A_solver = A.colPivHouseholderQr();
-  flx = A_solver.solve(chi);
-  const double k_1 = vEf.dot(flx);
-
-  // Calculate the slope constant
-  const double k_inf_M2 = B2_ / ((1. / k_1) - (1. / k_inf_));
-
-  double k = k_1;
+  // Secant iteration on 1/k - 1, which is nearly linear in B2
   while (std::abs(k - 1.) > 1.E-6) {
-    B2_ += k_inf_M2 * (1. - (1. / k));
-    fill_A(A, xs, D, B2_);
-    A_solver = A.colPivHouseholderQr();
-    flx = A_solver.solve(chi);
-    k = vEf.dot(flx);
+    if (f == f_0) {
+      auto mssg = "Critical buckling search has stagnated.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    const double B2_new = B2_ - f * (B2_ - B2_0) / (f - f_0);
+    B2_0 = B2_;
+    f_0 = f;
+    B2_ = B2_new;
+    k = ws.k(xs, b1, B2_);
+    f = (1. / k) - 1.;
   }
 
   // We have converged on k = 1.
@@ -142,199 +166,107 @@ P1CriticalitySpectrum::P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs) {
   const double B = B2_ > 0. ? sqrt_abs_B2 : -sqrt_abs_B2;
 
   // Get the current
-  cur = B * D * flx;
+  ws.cur = B * ws.D * ws.flx;
 
-  // The output info is in the format (2,NG) where the first line has
-  // the flux spectrum, and the second has the diffusion coefficients.
   flux_.resize({NG});
   current_.resize({NG});
   diff_coeff_.resize({NG});
   for (std::size_t g = 0; g < NG; g++) {
-    flux_(g) = flx(g);
-    current_(g) = cur(g);
-    diff_coeff_(g) = cur(g) / (B * flx(g));
+    flux_(g) = ws.flx(g);
+    current_(g) = ws.cur(g);
+    diff_coeff_(g) = ws.cur(g) / (B * ws.flx(g));
   }
 }
 
-P1CriticalitySpectrum::P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
-                                             double B) {
+void CriticalitySpectrum::solve_buckling(std::shared_ptr<CrossSection> xs,
+                                         Workspace& ws, bool b1, double B) {
   const std::size_t NG = xs->ngroups();
-
-  // For P1 approximation, alphas are all 1
-  const xt::xtensor<double, 1> a = xt::ones<double>({NG});
-
-  // Make vectors for flux and current
-  Eigen::VectorXd flx(NG);
-  Eigen::VectorXd cur(NG);
-  Eigen::VectorXd chi(NG), vEf(NG);
-  for (std::size_t g = 0; g < NG; g++) {
-    chi(g) = xs->chi(g);
-    vEf(g) = xs->vEf(g);
-  }
-
-  // Create the A matrix
-  Eigen::MatrixXd A(NG, NG);
-  Eigen::MatrixXd Dinvs(NG, NG);
-  fill_Dinvs(Dinvs, xs, a);
-  const Eigen::MatrixXd D = Dinvs.inverse();
+  ws.load(xs);
 
   B2_ = B * B;
-  fill_A(A, xs, D, B2_);
-  auto A_solver = A.colPivHouseholderQr();
-  flx = A_solver.solve(chi);
-  k_inf_ = vEf.dot(flx);
+  ws.fill_D(xs, b1, B2_);
+  k_inf_ = ws.solve(xs, B2_);
 
   // Get the current
-  cur = std::abs(B) * D * flx;
+  ws.cur = std::abs(B) * ws.D * ws.flx;
 
-  // The output info is in the format (2,NG) where the first line has
-  // the flux spectrum, and the second has the diffusion coefficients.
   flux_.resize({NG});
   current_.resize({NG});
   diff_coeff_.resize({NG});
   for (std::size_t g = 0; g < NG; g++) {
-    flux_(g) = flx(g);
-    current_(g) = cur(g);
-    diff_coeff_(g) = cur(g) / (B * flx(g));
+    flux_(g) = ws.flx(g);
+    current_(g) = ws.cur(g);
+    diff_coeff_(g) = ws.cur(g) / (B * ws.flx(g));
   }
 }
 
-B1CriticalitySpectrum::B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs) {
-  if (xs->fissile() == false) {
-    std::stringstream mssg;
-    mssg << "Cannot compute B1 spectrum of homogenized material that is not "
-            "fissile.";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
-  }
-
-  const std::size_t NG = xs->ngroups();
-
-  xt::xtensor<double, 1> a = xt::zeros<double>({NG});
-
-  // First, we create and fill the Dinvs matrix for the current
-  Eigen::MatrixXd Dinvs(NG, NG);
+template <typename T>
+std::vector<T> CriticalitySpectrum::solve_batch(
+    const std::vector<std::shared_ptr<CrossSection>>& xs) {
+  constexpr bool b1 = std::is_same_v<T, B1CriticalitySpectrum>;
+  const std::size_t N = xs.size();
+  const std::size_t nchunks = std::max<std::size_t>(
+      1, std::min(max_threads(), N));
+
+  std::vector<std::unique_ptr<T>> solved(N);
+  parallel_for_each_index(nchunks, [&](std::size_t c) {
+    Workspace ws;
+    double B2_guess = 0.;
+    for (std::size_t i = c * N / nchunks; i < (c + 1) * N / nchunks; i++) {
+      solved[i].reset(new T());
+      solved[i]->solve_critical(xs[i], ws, b1, B2_guess);
+      B2_guess = solved[i]->B2_;
+    }
+  });
 
-  // Declare the D matrix
-  Eigen::MatrixXd D;
+  std::vector<T> spectra;
+  spectra.reserve(N);
+  for (auto& spec : solved) spectra.push_back(std::move(*spec));
+  return spectra;
+}
 
-  // Make the chi and vEf vectors
-  Eigen::VectorXd chi(NG), vEf(NG);
-  for (std::size_t g = 0; g < NG; g++) {
-    chi(g) = xs->chi(g);
-    vEf(g) = xs->vEf(g);
-  }
+P1CriticalitySpectrum::P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs) {
+  Workspace ws;
+  solve_critical(xs, ws, false, 0.);
+}
 
-  // Make vectors for flux and current
-  Eigen::VectorXd flx(NG);
-  Eigen::VectorXd cur(NG);
-
-  // Create the A matrix
-  Eigen::MatrixXd A(NG, NG);
-
-  // Get A for k_inf
-  B2_ = 0.;
-  fill_alphas(a, xs, B2_);
-  fill_Dinvs(Dinvs, xs, a);
-  D = Dinvs.inverse();
-  fill_A(A, xs, D, B2_);
-  auto A_solver = A.colPivHouseholderQr();
-  flx = A_solver.solve(chi);
-  k_inf_ = vEf.dot(flx);
-
-  // Get A for small B2, from Stamm'ler and Abbate
-  B2_ = 0.001;
-  if (k_inf_ < 1.) B2_ = -B2_;
-  fill_alphas(a, xs, B2_);
-  fill_Dinvs(Dinvs, xs, a);
-  D = Dinvs.inverse();
-  fill_A(A, xs, D, B2_);
-  A_solver = A.colPivHouseholderQr();
-  flx = A_solver.solve(chi);
-  const double k_1 = vEf.dot(flx);
-
-  // Calculate the slope constant
-  const double k_inf_M2 = B2_ / ((1. / k_1) - (1. / k_inf_));
-
-  double k = k_1;
-  while (std::abs(k - 1.) > 1.E-6) {
-    B2_ += k_inf_M2 * (1. - (1. / k));
-    fill_alphas(a, xs, B2_);
-    fill_Dinvs(Dinvs, xs, a);
-    D = Dinvs.inverse();
-    fill_A(A, xs, D, B2_);
-    A_solver = A.colPivHouseholderQr();
-    flx = A_solver.solve(chi);
-    k = vEf.dot(flx);
-  }
+P1CriticalitySpectrum::P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
+                                             double B) {
+  Workspace ws;
+  solve_buckling(xs, ws, false, B);
+}
 
-  // We have converged on k = 1.
-  const double sqrt_abs_B2 = std::sqrt(std::abs(B2_));
-  const double B = B2_ > 0. ? sqrt_abs_B2 : -sqrt_abs_B2;
+P1CriticalitySpectrum::P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
+                                             const CriticalitySpectrum& guess) {
+  Workspace ws;
+  solve_critical(xs, ws, false, guess.B2());
+}
 
-  // Get the current
-  cur = B * D * flx;
+std::vector<P1CriticalitySpectrum> P1CriticalitySpectrum::solve_batch(
+    const std::vector<std::shared_ptr<CrossSection>>& xs) {
+  return CriticalitySpectrum::solve_batch<P1CriticalitySpectrum>(xs);
+}
 
-  // The output info is in the format (2,NG) where the first line has
-  // the flux spectrum, and the second has the diffusion coefficients.
-  flux_.resize({NG});
-  current_.resize({NG});
-  diff_coeff_.resize({NG});
-  for (std::size_t g = 0; g < NG; g++) {
-    flux_(g) = flx(g);
-    current_(g) = cur(g);
-    diff_coeff_(g) = cur(g) / (B * flx(g));
-  }
+B1CriticalitySpectrum::B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs) {
+  Workspace ws;
+  solve_critical(xs, ws, true, 0.);
 }
 
 B1CriticalitySpectrum::B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
                                              double B) {
-  const std::size_t NG = xs->ngroups();
-
-  xt::xtensor<double, 1> a = xt::zeros<double>({NG});
-
-  // First, we create and fill the Dinvs matrix for the current
-  Eigen::MatrixXd Dinvs(NG, NG);
-
-  // Declare the D matrix
-  Eigen::MatrixXd D;
-
-  // Make the chi and vEf vectors
-  Eigen::VectorXd chi(NG), vEf(NG);
-  for (std::size_t g = 0; g < NG; g++) {
-    chi(g) = xs->chi(g);
-    vEf(g) = xs->vEf(g);
-  }
-
-  // Make vectors for flux and current
-  Eigen::VectorXd flx(NG);
-  Eigen::VectorXd cur(NG);
-
-  // Create the A matrix
-  Eigen::MatrixXd A(NG, NG);
-
-  B2_ = B * B;
-  fill_alphas(a, xs, B2_);
-  fill_Dinvs(Dinvs, xs, a);
-  D = Dinvs.inverse();
-  fill_A(A, xs, D, B2_);
-  auto A_solver = A.colPivHouseholderQr();
-  flx = A_solver.solve(chi);
-  k_inf_ = vEf.dot(flx);
+  Workspace ws;
+  solve_buckling(xs, ws, true, B);
+}
 
-  // Get the current
-  cur = std::abs(B) * D * flx;
+B1CriticalitySpectrum::B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
+                                             const CriticalitySpectrum& guess) {
+  Workspace ws;
+  solve_critical(xs, ws, true, guess.B2());
+}
 
-  // The output info is in the format (2,NG) where the first line has
-  // the flux spectrum, and the second has the diffusion coefficients.
-  flux_.resize({NG});
-  current_.resize({NG});
-  diff_coeff_.resize({NG});
-  for (std::size_t g = 0; g < NG; g++) {
-    flux_(g) = flx(g);
-    current_(g) = cur(g);
-    diff_coeff_(g) = cur(g) / (B * flx(g));
-  }
+std::vector<B1CriticalitySpectrum> B1CriticalitySpectrum::solve_batch(
+    const std::vector<std::shared_ptr<CrossSection>>& xs) {
+  return CriticalitySpectrum::solve_batch<B1CriticalitySpectrum>(xs);
 }
 
 }  // namespace scarabee
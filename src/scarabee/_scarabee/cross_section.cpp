@@ -2,6 +2,8 @@
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/constants.hpp>
+#include <utils/profiler.hpp>
+#include <utils/threads.hpp>
 
 #include <xtensor/generators/xbuilder.hpp>
 
@@ -11,10 +13,33 @@
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <span>
 #include <sstream>
 
 namespace scarabee {
 
+namespace {
+
+void hash_combine(std::size_t& seed, std::size_t v) {
+  seed ^= v + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+// Hash of v once its mantissa is rounded down to a multiple of rtol
+std::size_t rounded_hash(double v, double rtol) {
+  if (v == 0.) return 0;  // Same hash for +0 and -0
+  if (rtol <= 0.) return std::hash<double>{}(v);
+
+  int e = 0;
+  const double m = std::frexp(v, &e);
+  std::size_t h = std::hash<long long>{}(
+      static_cast<long long>(std::floor(m / rtol)));
+  hash_combine(h, std::hash<int>{}(e));
+  return h;
+}
+
+}  // namespace
+
 CrossSection::CrossSection(const xt::xtensor<double, 1>& Etr,
                            const xt::xtensor<double, 1>& Ea,
                            const xt::xtensor<double, 2>& Es_tr,
@@ -173,49 +198,16 @@ CrossSection::CrossSection(const XS1D& Et, const XS1D& Dtr, const XS1D& Ea,
 std::shared_ptr<CrossSection> CrossSection::condense(
     const std::vector<std::pair<std::size_t, std::size_t>>& groups,
     const xt::xtensor<double, 1>& flux) const {
-  const std::size_t NGOUT = groups.size();
-  const std::size_t NG = ngroups();
-
-  // First, we need to check the condensation scheme
-  if (groups.size() == 0) {
-    auto mssg = "Empty energy condensation scheme provided.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
-
-  if (groups.front().first != 0) {
-    auto mssg = "The energy condensation scheme does not start with 0.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
-
-  if (groups.back().second != NG - 1) {
-    std::stringstream mssg;
-    mssg << "The energy condensation scheme does not end with " << NG - 1
-         << ".";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
-  }
-
-  for (std::size_t i = 0; i < NGOUT - 1; i++) {
-    if (groups[i].second + 1 != groups[i + 1].first) {
-      std::stringstream mssg;
-      mssg << "Condensed groups " << i << " and " << i + 1
-           << " are not continuous.";
-      spdlog::error(mssg.str());
-      throw ScarabeeException(mssg.str());
-    }
-  }
-
-  if (flux.size() != NG) {
-    auto mssg =
-        "The number of provided flux values diagrees with the number of energy "
-        "groups.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
+  const CondensationScheme scheme(groups, ngroups());
+  scheme.check_flux(flux.size());
+  return this->condense(scheme,
+                        std::span<const double>(flux.data(), flux.size()));
+}
 
-  // Everything checks out, we can start the condensation.
+std::shared_ptr<CrossSection> CrossSection::condense(
+    const CondensationScheme& scheme, std::span<const double> flux) const {
+  const auto& groups = scheme.groups();
+  const std::size_t NGOUT = scheme.ncondensed_groups();
 
   xt::xtensor<double, 1> Et = xt::zeros<double>({NGOUT});
   xt::xtensor<double, 1> Dtr = xt::zeros<double>({NGOUT});
@@ -223,8 +215,11 @@ std::shared_ptr<CrossSection> CrossSection::condense(
   xt::xtensor<double, 1> Ef = xt::zeros<double>({NGOUT});
   xt::xtensor<double, 1> vEf = xt::zeros<double>({NGOUT});
   xt::xtensor<double, 1> chi = xt::zeros<double>({NGOUT});
-  xt::xtensor<double, 3> Es =
-      xt::zeros<double>({max_legendre_order() + 1, NGOUT, NGOUT});
+  // The 2D cross sections are condensed directly over the stored bands.
+  // Es_ does not contain the transport correction on the diagonal, but it
+  // always lands back on the diagonal of the macro group, where it is then
+  // restored.
+  xt::xtensor<double, 3> Es = Es_.condense(scheme, flux);
 
   for (std::size_t G = 0; G < NGOUT; G++) {  // Incoming macro groups
     const std::size_t g_min = groups[G].first;
@@ -232,12 +227,12 @@ std::shared_ptr<CrossSection> CrossSection::condense(
 
     // First, we get the sum of all flux values in the macro group
     double flux_G = 0.;
-    for (std::size_t g = g_min; g <= g_max; g++) flux_G += flux(g);
+    for (std::size_t g = g_min; g <= g_max; g++) flux_G += flux[g];
     const double invs_flux_G = 1. / flux_G;
 
     // First we do all of the 1D cross sections
     for (std::size_t g = g_min; g <= g_max; g++) {
-      const double fluxg_fluxG = flux(g) * invs_flux_G;
+      const double fluxg_fluxG = flux[g] * invs_flux_G;
       Dtr(G) += fluxg_fluxG * this->Dtr(g);
       Ea(G) += fluxg_fluxG * this->Ea(g);
       Ef(G) += fluxg_fluxG * this->Ef(g);
@@ -245,21 +240,7 @@ std::shared_ptr<CrossSection> CrossSection::condense(
       chi(G) += this->chi(g);  // chi doesn't need to be weighted
     }
 
-    // Next, we do all 2D cross sections
-    for (std::size_t l = 0; l <= max_legendre_order(); l++) {
-      for (std::size_t GG = 0; GG < NGOUT; GG++) {  // Outgoing macro groups
-        const std::size_t gg_min = groups[GG].first;
-        const std::size_t gg_max = groups[GG].second;
-
-        for (std::size_t g = g_min; g <= g_max; g++) {  // Incoming micro groups
-          const double fluxg_fluxG = flux(g) * invs_flux_G;
-          for (std::size_t gg = gg_min; gg <= gg_max;
-               gg++) {  // Outgoing micro groups
-            Es(l, G, GG) += fluxg_fluxG * this->Es(l, g, gg);
-          }
-        }
-      }
-    }
+    Es(0, G, G) += Dtr(G);
 
     // Reconstruct total xs from absorption and scattering
     Et(G) = Ea(G) + xt::sum(xt::view(Es, 0, G, xt::all()))();
@@ -271,6 +252,50 @@ std::shared_ptr<CrossSection> CrossSection::condense(
                                         this->name_);
 }
 
+std::vector<std::shared_ptr<CrossSection>> condense_cross_sections(
+    const std::vector<std::shared_ptr<CrossSection>>& xs,
+    const std::vector<xt::xtensor<double, 1>>& fluxes,
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups) {
+  SCARABEE_PROFILE_ZONE("condense_cross_sections");
+  if (xs.size() != fluxes.size()) {
+    auto mssg = "The number of cross sections and of flux spectra disagree.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::vector<std::shared_ptr<CrossSection>> out(xs.size(), nullptr);
+  if (xs.empty()) return out;
+
+  // All inputs are checked first, so that no exception is raised from the
+  // parallel region for bad input
+  for (const auto& xsi : xs) {
+    if (xsi == nullptr) {
+      auto mssg = "Cannot condense a None cross section.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  const CondensationScheme scheme(groups, xs.front()->ngroups());
+  for (std::size_t i = 0; i < xs.size(); i++) {
+    if (xs[i]->ngroups() != scheme.ngroups()) {
+      auto mssg = "All cross sections must have the same number of groups.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    scheme.check_flux(fluxes[i].size());
+  }
+
+  parallel_for_each_index(xs.size(), [&](std::size_t i) {
+    const auto& flux = fluxes[i];
+    out[i] = xs[i]->condense(
+        scheme, std::span<const double>(flux.data(), flux.size()));
+  });
+
+  return out;
+}
+
 CrossSection& CrossSection::operator+=(const CrossSection& R) {
   // Perform dimensionality checks
   if (ngroups() != R.ngroups()) {
@@ -340,8 +365,10 @@ std::shared_ptr<DiffusionCrossSection> CrossSection::diffusion_xs() const {
     vEf(g) = vEf_(g);
     chi(g) = chi_(g);
 
-    for (std::size_t gg = 0; gg < NG; gg++) {
-      Es(g, gg) = Es_(0, g, gg);
+    const std::size_t g_min = Es_.band_min(g);
+    const auto row = Es_.band(0, g);
+    for (std::size_t k = 0; k < row.size(); k++) {
+      Es(g, g_min + k) = row[k];
     }
   }
 
@@ -373,6 +400,74 @@ CrossSection& CrossSection::operator*=(double N) {
   return *this;
 }
 
+std::size_t CrossSection::content_hash(double rtol) const {
+  std::size_t h = std::hash<std::size_t>{}(ngroups());
+  hash_combine(h, std::hash<std::size_t>{}(max_legendre_order()));
+
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    hash_combine(h, rounded_hash(Etr_(g), rtol));
+    hash_combine(h, rounded_hash(Dtr_(g), rtol));
+    hash_combine(h, rounded_hash(Ea_(g), rtol));
+    hash_combine(h, rounded_hash(Ef_(g), rtol));
+    hash_combine(h, rounded_hash(vEf_(g), rtol));
+    hash_combine(h, rounded_hash(chi_(g), rtol));
+  }
+
+  // Only the non-zero scattering entries are hashed, so that the hash does
+  // not depend on the packing of the matrix
+  const auto& packing = Es_.packing();
+  for (std::size_t l = 0; l <= max_legendre_order(); l++) {
+    for (std::size_t g = 0; g < ngroups(); g++) {
+      for (std::size_t gg = packing(g, 1); gg <= packing(g, 2); gg++) {
+        const double v = Es_(l, g, gg);
+        if (v == 0.) continue;
+        hash_combine(h, std::hash<std::size_t>{}(g * ngroups() + gg));
+        hash_combine(h, rounded_hash(v, rtol));
+      }
+    }
+  }
+
+  return h;
+}
+
+bool CrossSection::approx_equal(const CrossSection& R, double rtol) const {
+  if (this == &R) return true;
+
+  if (ngroups() != R.ngroups() ||
+      max_legendre_order() != R.max_legendre_order()) {
+    return false;
+  }
+
+  auto close = [rtol](double a, double b) {
+    return std::abs(a - b) <= rtol * std::max(std::abs(a), std::abs(b));
+  };
+
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    if (close(Etr_(g), R.Etr_(g)) == false ||
+        close(Dtr_(g), R.Dtr_(g)) == false ||
+        close(Ea_(g), R.Ea_(g)) == false || close(Ef_(g), R.Ef_(g)) == false ||
+        close(vEf_(g), R.vEf_(g)) == false ||
+        close(chi_(g), R.chi_(g)) == false) {
+      return false;
+    }
+  }
+
+  // Compare over the union of both scattering bands
+  const auto& pL = Es_.packing();
+  const auto& pR = R.Es_.packing();
+  for (std::size_t l = 0; l <= max_legendre_order(); l++) {
+    for (std::size_t g = 0; g < ngroups(); g++) {
+      const std::size_t gg_min = std::min(pL(g, 1), pR(g, 1));
+      const std::size_t gg_max = std::max(pL(g, 2), pR(g, 2));
+      for (std::size_t gg = gg_min; gg <= gg_max; gg++) {
+        if (close(Es_(l, g, gg), R.Es_(l, g, gg)) == false) return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 CrossSection CrossSection::operator+(const CrossSection& R) const {
   CrossSection out = *this;
   out += R;
@@ -562,4 +657,22 @@ std::shared_ptr<CrossSection> CrossSection::load(const std::string& fname) {
   return out;
 }
 
+MemoryUsage CrossSection::memory_usage() const {
+  MemoryUsage usage;
+  usage["xs"] = array_bytes(Etr_.values()) + array_bytes(Dtr_.values()) +
+                array_bytes(Ea_.values()) + array_bytes(Ef_.values()) +
+                array_bytes(vEf_.values()) + array_bytes(chi_.values());
+  usage["scattering"] = array_bytes(Es_.data()) + array_bytes(Es_.packing());
+  return usage;
+}
+
+std::string CrossSection::to_bytes() const { return save_to_bytes(*this); }
+
+std::shared_ptr<CrossSection> CrossSection::from_bytes(
+    const std::string& data) {
+  std::shared_ptr<CrossSection> out(new CrossSection());
+  load_from_bytes(data, *out);
+  return out;
+}
+
 }  // namespace scarabee
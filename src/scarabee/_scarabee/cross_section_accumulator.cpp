@@ -0,0 +1,170 @@
+#include <data/cross_section_accumulator.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <xtensor/generators/xbuilder.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace scarabee {
+
+CrossSectionAccumulator::CrossSectionAccumulator(std::size_t ngroups)
+    : Etr_(xt::zeros<double>({ngroups})),
+      Dtr_(xt::zeros<double>({ngroups})),
+      Ea_(xt::zeros<double>({ngroups})),
+      Ef_(xt::zeros<double>({ngroups})),
+      vEf_(xt::zeros<double>({ngroups})),
+      chi_(xt::zeros<double>({ngroups})),
+      Dtr_diag_(xt::zeros<double>({ngroups})),
+      band_(xt::xtensor<std::uint32_t, 2>::from_shape({ngroups, 2})),
+      Es_() {
+  if (ngroups == 0) {
+    auto mssg = "Must have at least 1 energy group.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (std::size_t g = 0; g < ngroups; g++) {
+    band_(g, 0) = static_cast<std::uint32_t>(g);
+    band_(g, 1) = static_cast<std::uint32_t>(g);
+  }
+}
+
+void CrossSectionAccumulator::check_ngroups(std::size_t ng) const {
+  if (ng != ngroups()) {
+    std::stringstream mssg;
+    mssg << "Cross section has " << ng << " groups, but the accumulator has "
+         << ngroups() << ".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+}
+
+void CrossSectionAccumulator::reserve(const XS2D& Es) {
+  check_ngroups(Es.ngroups());
+
+  if (allocated_) {
+    // Contributions were already added, so the data must be repacked
+    Es_.repack_to_be_compatible(Es.packing());
+    return;
+  }
+
+  const auto& packing = Es.packing();
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    band_(g, 0) = std::min(band_(g, 0), packing(g, 1));
+    band_(g, 1) = std::max(band_(g, 1), packing(g, 2));
+  }
+  nl_ = std::max(nl_, Es.max_legendre_order() + 1);
+}
+
+void CrossSectionAccumulator::allocate() {
+  const std::size_t NG = ngroups();
+
+  auto packing = xt::xtensor<std::uint32_t, 2>::from_shape({NG, 3});
+  for (std::size_t g = 0; g < NG; g++) {
+    if (g == 0) {
+      packing(g, 0) = 0;
+    } else {
+      packing(g, 0) =
+          packing(g - 1, 0) + packing(g - 1, 2) + 1 - packing(g - 1, 1);
+    }
+    packing(g, 1) = band_(g, 0);
+    packing(g, 2) = band_(g, 1);
+  }
+
+  const std::size_t NDAT =
+      packing(NG - 1, 0) + packing(NG - 1, 2) + 1 - packing(NG - 1, 1);
+  Es_ = XS2D(xt::zeros<double>({nl_, NDAT}), packing);
+  allocated_ = true;
+}
+
+void CrossSectionAccumulator::add(double N, const CrossSection& xs) {
+  check_ngroups(xs.ngroups());
+  if (allocated_ == false) {
+    this->reserve(xs.Es_XS2D());
+    this->allocate();
+  }
+
+  double vEf_sum = 0.;
+  for (std::size_t g = 0; g < ngroups(); g++) vEf_sum += xs.vEf(g);
+  const double chi_wgt = N * vEf_sum;
+
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    Etr_(g) += N * xs.Etr(g);
+    Dtr_(g) += N * xs.Dtr(g);
+    Ea_(g) += N * xs.Ea(g);
+    Ef_(g) += N * xs.Ef(g);
+    vEf_(g) += N * xs.vEf(g);
+    chi_(g) += chi_wgt * xs.chi(g);
+  }
+
+  Es_.axpy(N, xs.Es_XS2D());
+}
+
+void CrossSectionAccumulator::add(double N, const MicroNuclideXS& xs) {
+  check_ngroups(xs.Es.ngroups());
+  if (allocated_ == false) {
+    this->reserve(xs.Es);
+    this->allocate();
+  }
+
+  double vEf_sum = 0.;
+  for (std::size_t g = 0; g < ngroups(); g++) vEf_sum += xs.nu(g) * xs.Ef(g);
+  const double chi_wgt = N * vEf_sum;
+
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    const double Dtr = xs.Dtr(g);
+    Etr_(g) += N * (xs.Et(g) - Dtr);
+    Dtr_(g) += N * Dtr;
+    Dtr_diag_(g) += N * Dtr;
+    Ea_(g) += N * xs.Ea(g);
+    Ef_(g) += N * xs.Ef(g);
+    vEf_(g) += N * xs.nu(g) * xs.Ef(g);
+    chi_(g) += chi_wgt * xs.chi(g);
+  }
+
+  Es_.axpy(N, xs.Es);
+}
+
+std::shared_ptr<CrossSection> CrossSectionAccumulator::cross_section(
+    const std::string& name) const {
+  if (allocated_ == false) {
+    auto mssg = "No cross section was added to the accumulator.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::shared_ptr<CrossSection> out(new CrossSection());
+  out->Etr_ = XS1D(Etr_);
+  out->Dtr_ = XS1D(Dtr_);
+  out->Ea_ = XS1D(Ea_);
+  out->Ef_ = XS1D(Ef_);
+  out->vEf_ = XS1D(vEf_);
+  out->Es_ = Es_;
+  out->name_ = name;
+  out->fissile_ = false;
+
+  // Apply the transport correction of the micro contributions. The diagonal
+  // is always in the band.
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    if (Dtr_diag_(g) != 0.) {
+      out->Es_.set_value(0, g, g, out->Es_(0, g, g) - Dtr_diag_(g));
+    }
+  }
+
+  // Normalize the fission spectrum. With no fission, all chi(g) are zero.
+  double chi_sum = 0.;
+  for (std::size_t g = 0; g < ngroups(); g++) chi_sum += chi_(g);
+  xt::xtensor<double, 1> chi = xt::zeros<double>({ngroups()});
+  if (chi_sum > 0.) {
+    for (std::size_t g = 0; g < ngroups(); g++) chi(g) = chi_(g) / chi_sum;
+  }
+  out->chi_ = XS1D(chi);
+
+  out->check_xs();
+
+  return out;
+}
+
+}  // namespace scarabee
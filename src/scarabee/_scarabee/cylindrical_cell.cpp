@@ -2,8 +2,10 @@
 #include <utils/math.hpp>
 #include <utils/constants.hpp>
 #include <utils/gauss_kronrod.hpp>
+#include <utils/gauss_legendre.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/logging.hpp>
+#include <utils/profiler.hpp>
 
 #include <xtensor/generators/xbuilder.hpp>
 
@@ -11,13 +13,27 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 
 namespace scarabee {
 
+namespace {
+void hash_combine(std::size_t& seed, std::size_t h) {
+  seed ^= h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+// Table shared by all cells, built on first use
+const Ki3Table& ki3_table() {
+  static const Ki3Table table;
+  return table;
+}
+}  // namespace
+
 CylindricalCell::CylindricalCell(
     const std::vector<double>& radii,
     const std::vector<std::shared_ptr<CrossSection>>& mats)
     : p_(),
+      p_hash_(),
       X_(),
       Y_(),
       Gamma_(),
@@ -86,6 +102,7 @@ CylindricalCell::CylindricalCell(
 }
 
 void CylindricalCell::solve(bool parallel) {
+  ThreadScope thread_scope(threads_);
   spdlog::info("Solving cylindrical cell.");
 
   if (parallel == false) {
@@ -99,22 +116,91 @@ void CylindricalCell::solve(bool parallel) {
   solved_ = true;
 }
 
+MemoryUsage CylindricalCell::memory_usage() const {
+  MemoryUsage usage;
+  usage["probabilities"] = array_bytes(p_) + array_bytes(p_hash_);
+  usage["response"] = array_bytes(X_) + array_bytes(Y_) + array_bytes(Gamma_);
+  usage["geometry"] = array_bytes(radii_) + array_bytes(vols_);
+  return usage;
+}
+
+std::vector<std::size_t> CylindricalCell::groups_to_update() {
+  const std::size_t NR = nregions();
+  const std::size_t npacked = NR * (NR + 1) / 2;
+  if (p_.shape()[0] != ngroups() || p_.shape()[1] != npacked) {
+    p_ = xt::zeros<double>({ngroups(), npacked});
+    p_hash_.clear();
+  }
+  p_hash_.resize(ngroups(), 0);
+
+  // The collision probabilities of a group only depend on the radii and on
+  // the transport cross sections of that group, and on how the chord
+  // integrals are evaluated
+  std::size_t geom_hash = std::hash<int>{}(static_cast<int>(ki3_mode_));
+  hash_combine(geom_hash, std::hash<int>{}(static_cast<int>(cp_quad_)));
+  for (const double r : radii_) hash_combine(geom_hash, std::hash<double>{}(r));
+
+  std::vector<std::size_t> groups;
+  for (std::size_t g = 0; g < ngroups(); g++) {
+    std::size_t h = geom_hash;
+    for (const auto& mat : mats_)
+      hash_combine(h, std::hash<double>{}(mat->Etr(g)));
+
+    // A hash of 0 marks a group which has never been computed
+    if (h == 0) h = 1;
+    if (h != p_hash_[g]) {
+      p_hash_[g] = h;
+      groups.push_back(g);
+    }
+  }
+
+  return groups;
+}
+
+void CylindricalCell::fill_p(std::size_t g, const xt::xtensor<double, 2>& S) {
+  for (std::size_t i = 0; i < nregions(); i++) {
+    for (std::size_t j = i; j < nregions(); j++) {
+      double& pij = p_(g, packed_indx(i, j));
+      pij = 0.;
+      if (i == j) pij += vols_[i] * mats_[i]->Etr(g);
+
+      pij += 2. * S(i, j);
+      if (i > 0 && j > 0) pij += 2. * S(i - 1, j - 1);
+      if (i > 0) pij -= 2. * S(i - 1, j);
+      if (j > 0) pij -= 2. * S(i, j - 1);
+    }
+  }
+}
+
 void CylindricalCell::calculate_collision_probabilities() {
+  SCARABEE_PROFILE_ZONE("CylindricalCell::calculate_collision_probabilities");
   spdlog::info("Calculating collision probabilities.");
 
-  // First, ensure we have a matrix of the proper size
-  p_ = xt::zeros<double>({ngroups(), nregions(), nregions()});
+  // Only the groups whose cross sections changed since the last solve are
+  // recomputed
+  const std::vector<std::size_t> groups = groups_to_update();
+  if (groups.size() < ngroups()) {
+    spdlog::info("Reusing collision probabilities of {} groups.",
+                 ngroups() - groups.size());
+  }
+
+  // With fixed nodes, the S_ij factors of all groups are computed at once
+  xt::xtensor<double, 3> S_fixed;
+  if (cp_quad_ == CPQuadrature::FixedNodes)
+    S_fixed = calculate_S_fixed_nodes(groups, false);
 
   // Create a matrix to temporarily hold the S_ij factors. We do one group at
   // a time, so we don't need a third axis
   xt::xtensor<double, 2> S = xt::zeros<double>({nregions(), nregions()});
 
   // Calculate the matrix for each energy group
-  for (std::uint32_t g = 0; g < ngroups(); g++) {
+  for (std::size_t ng = 0; ng < groups.size(); ng++) {
+    const std::size_t g = groups[ng];
     // Load S
     for (std::size_t i = 0; i < nregions(); i++) {
       for (std::size_t j = i; j < nregions(); j++) {
-        S(i, j) = calculate_S_ij(i, j, g);
+        S(i, j) = S_fixed.size() > 0 ? S_fixed(i, j, ng)
+                                     : calculate_S_ij(i, j, g);
 
         // These are symmetric, so we can assign the diagonal term too
         if (j != i) S(j, i) = S(i, j);
@@ -122,34 +208,33 @@ void CylindricalCell::calculate_collision_probabilities() {
     }
 
     // S has now been filled. We can now load p
-    for (std::size_t i = 0; i < nregions(); i++) {
-      for (std::size_t j = i; j < nregions(); j++) {
-        p_(g, i, j) = 0.;
-        if (i == j) p_(g, i, j) += vols_[i] * mats_[i]->Etr(g);
-
-        p_(g, i, j) += 2. * S(i, j);
-        if (i > 0 && j > 0) p_(g, i, j) += 2. * S(i - 1, j - 1);
-        if (i > 0) p_(g, i, j) -= 2. * S(i - 1, j);
-        if (j > 0) p_(g, i, j) -= 2. * S(i, j - 1);
-
-        if (i != j) p_(g, j, i) = p_(g, i, j);
-      }
-    }
-
-    S.fill(0.);
+    fill_p(g, S);
   }  // for groups
 }
 
 void CylindricalCell::parallel_calculate_collision_probabilities() {
+  SCARABEE_PROFILE_ZONE(
+      "CylindricalCell::parallel_calculate_collision_probabilities");
   spdlog::info("Calculating collision probabilities.");
 
-  // First, ensure we have a matrix of the proper size
-  p_ = xt::zeros<double>({ngroups(), nregions(), nregions()});
+  // Only the groups whose cross sections changed since the last solve are
+  // recomputed
+  const std::vector<std::size_t> groups = groups_to_update();
+  if (groups.size() < ngroups()) {
+    spdlog::info("Reusing collision probabilities of {} groups.",
+                 ngroups() - groups.size());
+  }
+
+  // With fixed nodes, the S_ij factors of all groups are computed at once
+  xt::xtensor<double, 3> S_fixed;
+  if (cp_quad_ == CPQuadrature::FixedNodes)
+    S_fixed = calculate_S_fixed_nodes(groups, true);
 
   // Calculate the matrix for each energy group
 #pragma omp parallel for
-  for (int ig = 0; ig < static_cast<int>(ngroups()); ig++) {
-    std::size_t g = static_cast<std::size_t>(ig);
+  for (int ig = 0; ig < static_cast<int>(groups.size()); ig++) {
+    const std::size_t ng = static_cast<std::size_t>(ig);
+    const std::size_t g = groups[ng];
     // Create a matrix to temporarily hold the S_ij factors. We do one group at
     // a time, so we don't need a third axis
     xt::xtensor<double, 2> S = xt::zeros<double>({nregions(), nregions()});
@@ -157,7 +242,8 @@ void CylindricalCell::parallel_calculate_collision_probabilities() {
     // Load S
     for (std::size_t i = 0; i < nregions(); i++) {
       for (std::size_t j = i; j < nregions(); j++) {
-        S(i, j) = calculate_S_ij(i, j, g);
+        S(i, j) = S_fixed.size() > 0 ? S_fixed(i, j, ng)
+                                     : calculate_S_ij(i, j, g);
 
         // These are symmetric, so we can assign the diagonal term too
         if (j != i) S(j, i) = S(i, j);
@@ -165,101 +251,69 @@ void CylindricalCell::parallel_calculate_collision_probabilities() {
     }
 
     // S has now been filled. We can now load p
-    for (std::size_t i = 0; i < nregions(); i++) {
-      for (std::size_t j = i; j < nregions(); j++) {
-        p_(g, i, j) = 0.;
-        if (i == j) p_(g, i, j) += vols_[i] * mats_[i]->Etr(g);
-
-        p_(g, i, j) += 2. * S(i, j);
-        if (i > 0 && j > 0) p_(g, i, j) += 2. * S(i - 1, j - 1);
-        if (i > 0) p_(g, i, j) -= 2. * S(i - 1, j);
-        if (j > 0) p_(g, i, j) -= 2. * S(i, j - 1);
-
-        if (i != j) p_(g, j, i) = p_(g, i, j);
-      }
-    }
+    fill_p(g, S);
   }  // for groups
 }
 
-void CylindricalCell::solve_systems() {
-  spdlog::info("Solving system of equations for cylindrical cell.");
-
-  // First, we allocate the needed memory to hold all of the X and Y terms
-  X_ = xt::zeros<double>({ngroups(), nregions(), nregions()});
-  Y_ = xt::zeros<double>({ngroups(), nregions()});
-  Gamma_ = xt::zeros<double>({ngroups()});
-
-  // The Y and X terms all depend on the energy group, and are described by
-  // the same matrix. We therefore load the matrix once, and solve it for
-  // all equations.
-  for (std::size_t g = 0; g < ngroups(); g++) {
-    // Initialize and fill matrix for group g
-    Eigen::MatrixXd M(nregions(), nregions());
-    for (long i = 0; i < static_cast<long>(nregions()); i++) {
-      for (long j = 0; j < static_cast<long>(nregions()); j++) {
-        const auto& mat = mats_[static_cast<std::size_t>(j)];
-        const double Etr = mat->Etr(g);
-        const double Es_tr = mat->Es_tr(g, g);
-        const double c_j = Es_tr / Etr;
-
-        M(i, j) = -c_j * p_(g, j, i);
-
-        if (j == i) {
-          M(i, j) += Etr * vols_[static_cast<std::size_t>(i)];
-        }
+void CylindricalCell::solve_group_systems(std::size_t g_begin,
+                                          std::size_t g_end) {
+  using RowMatrix =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const long n = static_cast<long>(nregions());
+  const double coeff = 4. / Sb();
+
+  // The scratch matrices are shared by all groups of the batch
+  Eigen::MatrixXd M(n, n);
+  Eigen::MatrixXd B(n, n + 1);
+  Eigen::MatrixXd S(n, n + 1);
+  Eigen::PartialPivLU<Eigen::MatrixXd> lu(n);
+
+  for (std::size_t g = g_begin; g < g_end; g++) {
+    // The Y and X terms all depend on the energy group, and are described by
+    // the same matrix
+    for (long j = 0; j < n; j++) {
+      const auto& mat = mats_[static_cast<std::size_t>(j)];
+      const double Etr = mat->Etr(g);
+      const double c_j = mat->Es_tr(g, g) / Etr;
+      for (long i = 0; i < n; i++) {
+        M(i, j) = -c_j * p(g, static_cast<std::size_t>(j),
+                           static_cast<std::size_t>(i));
       }
+      M(j, j) += Etr * vols_[static_cast<std::size_t>(j)];
     }
 
-    // Now that the matrix has been loaded for this group, we need to
-    // initialize a solver for it.
-    const auto solver = M.colPivHouseholderQr();
-
-    // There are nregions systems for solve for X
-    for (long k = 0; k < static_cast<long>(nregions()); k++) {
-      // Load the b vector
-      Eigen::VectorXd b(nregions());
-      const double Etr_k = mats_[static_cast<std::size_t>(k)]->Etr(g);
-      for (long i = 0; i < static_cast<long>(nregions()); i++) {
-        b(i) = p_(g, k, i) / Etr_k;
-      }
-
-      // Solve for this set of X_ik
-      auto X_k = solver.solve(b);
-
-      // Save the X_ik in the array
-      for (long i = 0; i < static_cast<long>(nregions()); i++) {
-        X_(g, i, k) = X_k(i);
+    // The nregions systems for X_ik are the first columns of the right hand
+    // side, and the system for Y_i is the last one
+    for (long k = 0; k < n; k++) {
+      const std::size_t kk = static_cast<std::size_t>(k);
+      const double invs_Etr_k = 1. / mats_[kk]->Etr(g);
+      for (long i = 0; i < n; i++) {
+        B(i, k) = p(g, kk, static_cast<std::size_t>(i)) * invs_Etr_k;
       }
     }
-
-    // We can now solve the equation for Y_i
-    Eigen::VectorXd b(nregions());
-    const double coeff = 4. / Sb();
-    for (long i = 0; i < static_cast<long>(nregions()); i++) {
-      const std::size_t indx = static_cast<std::size_t>(i);
-      const double Etr_i = mats_[indx]->Etr(g);
-      const double Vol_i = vols_[indx];
+    for (long i = 0; i < n; i++) {
+      const std::size_t ii = static_cast<std::size_t>(i);
       double sum_p = 0.;
-      for (std::size_t j = 0; j < nregions(); j++) {
-        sum_p += p_(g, i, j);
-      }
-
-      b(i) = coeff * (Etr_i * Vol_i - sum_p);
-    }
-    auto Y_i = solver.solve(b);
-    for (long i = 0; i < static_cast<long>(nregions()); i++) {
-      Y_(g, i) = Y_i(i);
+      for (std::size_t j = 0; j < nregions(); j++) sum_p += p(g, ii, j);
+      B(i, n) = coeff * (mats_[ii]->Etr(g) * vols_[ii] - sum_p);
     }
 
+    // One factorization, and one solve for all right hand sides
+    lu.compute(M);
+    S.noalias() = lu.solve(B);
+
+    Eigen::Map<RowMatrix>(&X_(g, 0, 0), n, n) = S.leftCols(n);
+    Eigen::Map<Eigen::VectorXd>(&Y_(g, 0), n) = S.col(n);
+
     // Calculate multicollision blackness for this group
     Gamma_(g) = 0.;
     for (std::size_t i = 0; i < nregions(); i++) {
       Gamma_(g) += mats_[i]->Er(g) * vols_[i] * Y_(g, i);
     }
-  }  // For all groups
+  }
 }
 
-void CylindricalCell::parallel_solve_systems() {
+void CylindricalCell::solve_systems() {
   spdlog::info("Solving system of equations for cylindrical cell.");
 
   // First, we allocate the needed memory to hold all of the X and Y terms
@@ -267,76 +321,27 @@ void CylindricalCell::parallel_solve_systems() {
   Y_ = xt::zeros<double>({ngroups(), nregions()});
   Gamma_ = xt::zeros<double>({ngroups()});
 
-  // The Y and X terms all depend on the energy group, and are described by
-  // the same matrix. We therefore load the matrix once, and solve it for
-  // all equations.
-#pragma omp parallel for
-  for (int ig = 0; ig < static_cast<int>(ngroups()); ig++) {
-    std::size_t g = static_cast<std::size_t>(ig);
-    // Initialize and fill matrix for group g
-    Eigen::MatrixXd M(nregions(), nregions());
-    for (long i = 0; i < static_cast<long>(nregions()); i++) {
-      for (long j = 0; j < static_cast<long>(nregions()); j++) {
-        const auto& mat = mats_[static_cast<std::size_t>(j)];
-        const double Etr = mat->Etr(g);
-        const double Es_tr = mat->Es_tr(g, g);
-        const double c_j = Es_tr / Etr;
-
-        M(i, j) = -c_j * p_(g, j, i);
-
-        if (j == i) {
-          M(i, j) += Etr * vols_[static_cast<std::size_t>(i)];
-        }
-      }
-    }
-
-    // Now that the matrix has been loaded for this group, we need to
-    // initialize a solver for it.
-    const auto solver = M.colPivHouseholderQr();
-
-    // There are nregions systems for solve for X
-    for (long k = 0; k < static_cast<long>(nregions()); k++) {
-      // Load the b vector
-      Eigen::VectorXd b(nregions());
-      const double Etr_k = mats_[static_cast<std::size_t>(k)]->Etr(g);
-      for (long i = 0; i < static_cast<long>(nregions()); i++) {
-        b(i) = p_(g, k, i) / Etr_k;
-      }
-
-      // Solve for this set of X_ik
-      auto X_k = solver.solve(b);
-
-      // Save the X_ik in the array
-      for (long i = 0; i < static_cast<long>(nregions()); i++) {
-        X_(g, i, k) = X_k(i);
-      }
-    }
+  solve_group_systems(0, ngroups());
+}
 
-    // We can now solve the equation for Y_i
-    Eigen::VectorXd b(nregions());
-    const double coeff = 4. / Sb();
-    for (long i = 0; i < static_cast<long>(nregions()); i++) {
-      const std::size_t indx = static_cast<std::size_t>(i);
-      const double Etr_i = mats_[indx]->Etr(g);
-      const double Vol_i = vols_[indx];
-      double sum_p = 0.;
-      for (std::size_t j = 0; j < nregions(); j++) {
-        sum_p += p_(g, i, j);
-      }
+void CylindricalCell::parallel_solve_systems() {
+  spdlog::info("Solving system of equations for cylindrical cell.");
 
-      b(i) = coeff * (Etr_i * Vol_i - sum_p);
-    }
-    auto Y_i = solver.solve(b);
-    for (long i = 0; i < static_cast<long>(nregions()); i++) {
-      Y_(g, i) = Y_i(i);
-    }
+  // First, we allocate the needed memory to hold all of the X and Y terms
+  X_ = xt::zeros<double>({ngroups(), nregions(), nregions()});
+  Y_ = xt::zeros<double>({ngroups(), nregions()});
+  Gamma_ = xt::zeros<double>({ngroups()});
 
-    // Calculate multicollision blackness for this group
-    Gamma_(g) = 0.;
-    for (std::size_t i = 0; i < nregions(); i++) {
-      Gamma_(g) += mats_[i]->Er(g) * vols_[i] * Y_(g, i);
-    }
-  }  // For all groups
+  // With few regions, the system of a group is too small to be worth a
+  // task, so consecutive groups are solved together
+  std::size_t batch = group_batch_size_;
+  if (batch == 0) {
+    batch = std::max<std::size_t>(1, 256 / (nregions() * nregions()));
+  }
+  const std::size_t nbatches = (ngroups() + batch - 1) / batch;
+  parallel_for_each_index(nbatches, [&](std::size_t b) {
+    solve_group_systems(b * batch, std::min((b + 1) * batch, ngroups()));
+  });
 }
 
 double CylindricalCell::calculate_S_ij(std::size_t i, std::size_t j,
@@ -350,6 +355,7 @@ double CylindricalCell::calculate_S_ij(std::size_t i, std::size_t j,
    * */
 
   double S_ij = 0.;
+  const Ki3Table& table = ki3_table();
 
   // Initialize a vector for the x coordinates
   std::vector<double> x;
@@ -367,7 +373,7 @@ double CylindricalCell::calculate_S_ij(std::size_t i, std::size_t j,
     x.resize(j + 1 - k, 0.);
 
     // Create a lambda for the integrand
-    auto integrand = [this, &x, k, i, j, g](double y) {
+    auto integrand = [this, &x, &table, k, i, j, g](double y) {
       const double y2 = y * y;
 
       // Get the x coordinates for the given y
@@ -398,6 +404,9 @@ double CylindricalCell::calculate_S_ij(std::size_t i, std::size_t j,
       }
       if (i == j) tau_min = 0.0;
 
+      if (ki3_mode_ == Ki3Mode::Table) {
+        return table(tau_pls) - table(tau_min);
+      }
       return Ki3(tau_pls) - Ki3(tau_min);
     };
 
@@ -413,4 +422,82 @@ double CylindricalCell::calculate_S_ij(std::size_t i, std::size_t j,
   return S_ij;
 }
 
+xt::xtensor<double, 3> CylindricalCell::calculate_S_fixed_nodes(
+    const std::vector<std::size_t>& groups, bool parallel) const {
+  SCARABEE_PROFILE_ZONE("CylindricalCell::calculate_S_fixed_nodes");
+
+  const std::size_t NR = nregions();
+  const std::size_t NG = groups.size();
+  const Ki3Table& table = ki3_table();
+
+  // Transport cross sections, contiguous in the groups
+  xt::xtensor<double, 2> Etr = xt::zeros<double>({NR, NG});
+  for (std::size_t m = 0; m < NR; m++) {
+    for (std::size_t g = 0; g < NG; g++) Etr(m, g) = mats_[m]->Etr(groups[g]);
+  }
+
+  auto eval_Ki3 = [this, &table](const double* tau, double* out,
+                                 std::size_t n) {
+    if (ki3_mode_ == Ki3Mode::Table) {
+      table.evaluate(tau, out, n);
+    } else {
+      for (std::size_t g = 0; g < n; g++) out[g] = Ki3(tau[g]);
+    }
+  };
+
+  xt::xtensor<double, 3> S = xt::zeros<double>({NR, NR, NG});
+
+  // In annulus k, y = Rmax - (Rmax - Rmin) u^2 with u in [0, 1]. This removes
+  // the square root behavior of the chord through radius Rmax as y -> Rmax,
+  // so that the Gauss-Legendre rule converges quickly.
+  const auto& mu = gl_16_abscissa;
+  const auto& wgt = gl_16_weights;
+
+  // Each thread fills the S_ij of one row i, with j >= i
+#pragma omp parallel for schedule(dynamic) if (parallel)
+  for (int ii = 0; ii < static_cast<int>(NR); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    std::vector<double> x(NR, 0.);
+    xt::xtensor<double, 2> tau = xt::zeros<double>({NR, NG});
+    std::vector<double> tau_pls(NG), tau_min(NG), ki3_pls(NG), ki3_min(NG);
+
+    for (std::size_t k = 0; k <= i; k++) {
+      const double Rmin = (k == 0 ? 0. : radii_[k - 1]);
+      const double Rmax = radii_[k];
+      const double d = Rmax - Rmin;
+
+      for (std::size_t n = 0; n < mu.size(); n++) {
+        const double u = 0.5 * (mu[n] + 1.);
+        const double y = Rmax - d * u * u;
+        const double w = wgt[n] * d * u;  // 0.5 w_n * 2 d u
+        const double y2 = y * y;
+
+        // Optical thickness from the y axis to each radius m >= k, which
+        // is the same cumulative chord for all groups
+        for (std::size_t m = k; m < NR; m++) {
+          x[m] = std::sqrt(std::max(radii_[m] * radii_[m] - y2, 0.));
+          const double t = (m == k ? x[m] : x[m] - x[m - 1]);
+          for (std::size_t g = 0; g < NG; g++) {
+            tau(m, g) = t * Etr(m, g) + (m == k ? 0. : tau(m - 1, g));
+          }
+        }
+
+        for (std::size_t j = i; j < NR; j++) {
+          for (std::size_t g = 0; g < NG; g++) {
+            tau_pls[g] = tau(i, g) + tau(j, g);
+            tau_min[g] = tau(j, g) - tau(i, g);
+          }
+          eval_Ki3(tau_pls.data(), ki3_pls.data(), NG);
+          eval_Ki3(tau_min.data(), ki3_min.data(), NG);
+          for (std::size_t g = 0; g < NG; g++) {
+            S(i, j, g) += w * (ki3_pls[g] - ki3_min[g]);
+          }
+        }
+      }
+    }
+  }
+
+  return S;
+}
+
 }  // namespace scarabee
@@ -1,10 +1,13 @@
 #include <cylindrical_flux_solver.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/logging.hpp>
+#include <utils/threads.hpp>
 #include <utils/timer.hpp>
 
 #include <xtensor/generators/xbuilder.hpp>
 
+#include <set>
+
 namespace scarabee {
 
 CylindricalFluxSolver::CylindricalFluxSolver(
@@ -202,6 +205,8 @@ void CylindricalFluxSolver::solve_single_thread() {
     old_keff = k_;
   }
 
+  if (direct_) factorize_direct(false);
+
   std::size_t outer_iter = 0;
 
   // Outer Generations
@@ -218,7 +223,13 @@ void CylindricalFluxSolver::solve_single_thread() {
     // in the inner iterations for the scattering source.
     next_flux = flux_;
 
-    double max_inner_flux_diff = 100.;
+    // The direct solve gives the flux of the generation in one pass
+    if (direct_) {
+      solve_direct(fiss_source, next_flux);
+      flux_ = next_flux;
+    }
+
+    double max_inner_flux_diff = direct_ ? 0. : 100.;
     std::size_t inner_iter = 0;
     // Inner Iterations
     while (max_inner_flux_diff > flux_tol_) {
@@ -313,6 +324,8 @@ void CylindricalFluxSolver::solve_parallel() {
     old_keff = k_;
   }
 
+  if (direct_) factorize_direct(true);
+
   std::size_t outer_iter = 0;
 
   // Outer Generations
@@ -329,7 +342,13 @@ void CylindricalFluxSolver::solve_parallel() {
     // in the inner iterations for the scattering source.
     next_flux = flux_;
 
-    double max_inner_flux_diff = 100.;
+    // The direct solve gives the flux of the generation in one pass
+    if (direct_) {
+      solve_direct(fiss_source, next_flux);
+      flux_ = next_flux;
+    }
+
+    double max_inner_flux_diff = direct_ ? 0. : 100.;
     std::size_t inner_iter = 0;
     // Inner Iterations
     while (max_inner_flux_diff > flux_tol_) {
@@ -401,6 +420,102 @@ void CylindricalFluxSolver::solve_parallel() {
   solved_ = true;
 }
 
+void CylindricalFluxSolver::factorize_direct(bool parallel) {
+  const std::size_t NG = ngroups();
+  const std::size_t NR = nregions();
+
+  // The groups below g_up_ only receive neutrons from lower groups, and are
+  // solved one after the other. The upscatter groups are coupled together.
+  g_up_ = NG;
+  for (std::size_t gg = 1; gg < NG; gg++) {
+    for (std::size_t g = 0; g < gg && g < g_up_; g++) {
+      for (std::size_t r = 0; r < NR; r++) {
+        if (cell_->xs(r)->Es_tr(gg, g) != 0.) {
+          g_up_ = g;
+          break;
+        }
+      }
+    }
+  }
+
+  const std::size_t NU = NG - g_up_;
+  spdlog::info("Direct solve with {} upscatter groups.", NU);
+  if (NU == 0) return;
+
+  // Loads (I - X Es) for the upscatter groups, indexed as (g - g_up_) NR + r
+  const long N = static_cast<long>(NU * NR);
+  Eigen::MatrixXd M = Eigen::MatrixXd::Identity(N, N);
+#pragma omp parallel for if (parallel)
+  for (int ig = 0; ig < static_cast<int>(NU); ig++) {
+    const std::size_t g = g_up_ + static_cast<std::size_t>(ig);
+    for (std::size_t r = 0; r < NR; r++) {
+      const long row = static_cast<long>((g - g_up_) * NR + r);
+      for (std::size_t k = 0; k < NR; k++) {
+        const double Xrk = cell_->X(a_, g, r, k);
+        const auto& xs = cell_->xs(k);
+        for (std::size_t gg = g_up_; gg < NG; gg++) {
+          if (gg == g) continue;
+          const long col = static_cast<long>((gg - g_up_) * NR + k);
+          M(row, col) -= Xrk * xs->Es_tr(gg, g);
+        }
+      }
+    }
+  }
+
+  up_lu_.compute(M);
+}
+
+void CylindricalFluxSolver::solve_direct(
+    const xt::xtensor<double, 2>& fiss_source,
+    xt::xtensor<double, 2>& flux) const {
+  const std::size_t NG = ngroups();
+  const std::size_t NR = nregions();
+
+  // Source in group g, with the scattering from the groups below gmax
+  std::vector<double> Q(NR, 0.);
+  auto fill_source = [&](std::size_t g, std::size_t gmax) {
+    for (std::size_t k = 0; k < NR; k++) {
+      const auto& xs = cell_->xs(k);
+      Q[k] = fiss_source(g, k) + extern_source_(g, k);
+      for (std::size_t gg = 0; gg < gmax; gg++) {
+        if (gg != g) Q[k] += xs->Es_tr(gg, g) * flux(gg, k);
+      }
+    }
+  };
+
+  // Downscatter groups, by back substitution
+  for (std::size_t g = 0; g < g_up_; g++) {
+    fill_source(g, g);
+    for (std::size_t r = 0; r < NR; r++) {
+      double Xr = 0.;
+      for (std::size_t k = 0; k < NR; k++) Xr += Q[k] * cell_->X(a_, g, r, k);
+      flux(g, r) = Xr + j_ext_[g] * cell_->Y(a_, g, r);
+    }
+  }
+
+  if (g_up_ == NG) return;
+
+  // Upscatter groups, with one solve of the coupled system
+  const long N = static_cast<long>((NG - g_up_) * NR);
+  Eigen::VectorXd b(N);
+  for (std::size_t g = g_up_; g < NG; g++) {
+    fill_source(g, g_up_);
+    for (std::size_t r = 0; r < NR; r++) {
+      double Xr = 0.;
+      for (std::size_t k = 0; k < NR; k++) Xr += Q[k] * cell_->X(a_, g, r, k);
+      b(static_cast<long>((g - g_up_) * NR + r)) =
+          Xr + j_ext_[g] * cell_->Y(a_, g, r);
+    }
+  }
+
+  const Eigen::VectorXd phi = up_lu_.solve(b);
+  for (std::size_t g = g_up_; g < NG; g++) {
+    for (std::size_t r = 0; r < NR; r++) {
+      flux(g, r) = phi(static_cast<long>((g - g_up_) * NR + r));
+    }
+  }
+}
+
 std::shared_ptr<CrossSection> CylindricalFluxSolver::homogenize() const {
   const std::size_t NR = this->nregions();
   std::vector<std::size_t> regions(NR, 0);
@@ -619,4 +734,52 @@ xt::xtensor<double, 1> CylindricalFluxSolver::homogenize_flux_spectrum(
   return spectrum;
 }
 
+void solve_cells(const std::vector<std::shared_ptr<CylindricalCell>>& cells) {
+  for (const auto& cell : cells) {
+    if (cell == nullptr) {
+      auto mssg = "Provided CylindricalCell was a nullptr.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  // The same cell may appear more than once, but must be solved only once
+  std::vector<std::shared_ptr<CylindricalCell>> unique_cells;
+  std::set<const CylindricalCell*> seen;
+  for (const auto& cell : cells) {
+    if (seen.insert(cell.get()).second) unique_cells.push_back(cell);
+  }
+
+  parallel_for_each_index(unique_cells.size(), [&unique_cells](std::size_t i) {
+    unique_cells[i]->solve(false);
+  });
+}
+
+void solve_flux_solvers(
+    const std::vector<std::shared_ptr<CylindricalFluxSolver>>& solvers) {
+  std::vector<std::shared_ptr<CylindricalCell>> cells;
+  std::set<const CylindricalFluxSolver*> seen;
+  for (const auto& solver : solvers) {
+    if (solver == nullptr) {
+      auto mssg = "Provided CylindricalFluxSolver was a nullptr.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (seen.insert(solver.get()).second == false) {
+      auto mssg = "The same CylindricalFluxSolver was provided more than once.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (solver->cell()->solved() == false) cells.push_back(solver->cell());
+  }
+
+  solve_cells(cells);
+
+  parallel_for_each_index(solvers.size(), [&solvers](std::size_t i) {
+    solvers[i]->solve(false);
+  });
+}
+
 }  // namespace scarabee
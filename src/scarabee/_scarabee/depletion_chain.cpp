@@ -1,4 +1,5 @@
 #include <data/depletion_chain.hpp>
+#include <data/compiled_depletion_chain.hpp>
 #include <utils/logging.hpp>
 #include <utils/nuclide_names.hpp>
 #include <utils/scarabee_exception.hpp>
@@ -9,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 
@@ -637,6 +639,11 @@ ChainEntry ChainEntry::from_hdf5_group(const H5::Group& grp) {
   return c;
 }
 
+std::uint64_t DepletionChain::next_uid() {
+  static std::atomic<std::uint64_t> uid{1};
+  return uid++;
+}
+
 bool DepletionChain::holds_nuclide_data(const std::string& nuclide) const {
   if (data_.find(nuclide) == data_.end()) {
     return false;
@@ -668,6 +675,7 @@ void DepletionChain::insert_entry(const std::string& nuclide,
   }
 
   data_[nuclide] = entry;
+  uid_ = next_uid();
 }
 
 std::set<std::string> DepletionChain::nuclides() const {
@@ -725,6 +733,105 @@ void DepletionChain::remove_nuclide(const std::string& nuclide) {
 
   // Delete nuclide from the chain
   data_.erase(nuclide);
+  uid_ = next_uid();
+}
+
+void DepletionChain::drop_nuclide(const std::string& nuclide) {
+  for (auto& entry : data_) entry.second.remove_nuclide(nuclide, NoTarget());
+  data_.erase(nuclide);
+  uid_ = next_uid();
+}
+
+std::shared_ptr<DepletionChain> DepletionChain::reduce(
+    double min_half_life, double min_fission_yield,
+    const std::set<std::string>& keep) const {
+  if (min_half_life < 0.) {
+    const auto mssg = "Minimum half life must be >= 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (min_fission_yield < 0.) {
+    const auto mssg = "Minimum fission yield must be >= 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  auto reduced = std::make_shared<DepletionChain>(*this);
+
+  // Short lived intermediates are replaced by their decay targets
+  std::vector<std::string> short_lived;
+  for (const auto& [name, entry] : data_) {
+    if (keep.contains(name) || entry.n_fission()) continue;
+    if (entry.half_life().has_value() == false ||
+        entry.half_life().value() >= min_half_life)
+      continue;
+    if (entry.decay_targets().has_value() == false ||
+        std::holds_alternative<NoTarget>(entry.decay_targets().value()))
+      continue;
+    short_lived.push_back(name);
+  }
+  for (const auto& name : short_lived) reduced->remove_nuclide(name);
+
+  if (min_fission_yield > 0.) {
+    // Importance of each nuclide is its largest cumulative fission yield, for
+    // all fissionable nuclides and incident energies. Yields of the short
+    // lived nuclides have already been lumped into their targets.
+    const CompiledDepletionChain cchain(reduced);
+    const std::size_t n = cchain.size();
+    std::vector<double> importance(n, 0.);
+    std::vector<double> cumulative(n, 0.);
+    for (std::size_t p = 0; p < n; p++) {
+      const FissionYields* fy = cchain.fission_yields(p);
+      if (fy == nullptr) continue;
+      const auto targets = cchain.fission_targets(p);
+
+      for (const double E : fy->incident_energies()) {
+        std::fill(cumulative.begin(), cumulative.end(), 0.);
+        for (std::size_t t = 0; t < targets.size(); t++) {
+          cumulative[targets[t]] += fy->yield(t, E);
+        }
+
+        for (const std::size_t i : cchain.topological_order()) {
+          if (cumulative[i] == 0.) continue;
+          const auto dt =
+              cchain.targets(i, CompiledDepletionChain::Reaction::Decay);
+          const auto dr =
+              cchain.ratios(i, CompiledDepletionChain::Reaction::Decay);
+          for (std::size_t t = 0; t < dt.size(); t++) {
+            if (dt[t] != i) cumulative[dt[t]] += dr[t] * cumulative[i];
+          }
+          importance[i] = std::max(importance[i], cumulative[i]);
+        }
+      }
+    }
+
+    std::vector<std::string> pruned;
+    for (std::size_t i = 0; i < n; i++) {
+      if (importance[i] == 0. || importance[i] >= min_fission_yield) continue;
+      if (cchain.fission_yields(i) || keep.contains(cchain.name(i))) continue;
+      pruned.push_back(cchain.name(i));
+    }
+
+    for (const auto& name : pruned) {
+      const bool decays =
+          reduced->holds_nuclide_data(name) &&
+          reduced->nuclide_data(name).decay_targets().has_value() &&
+          std::holds_alternative<NoTarget>(
+              reduced->nuclide_data(name).decay_targets().value()) == false;
+
+      if (decays) {
+        reduced->remove_nuclide(name);
+      } else {
+        reduced->drop_nuclide(name);
+      }
+    }
+  }
+
+  spdlog::info("Depletion chain reduced from {} to {} nuclides.",
+               data_.size(), reduced->data_.size());
+
+  return reduced;
 }
 
 // Helper functions for extracting new targets from various types of targets
@@ -0,0 +1,101 @@
+#include <data/depletion_checkpoint.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <cereal/archives/portable_binary.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+namespace scarabee {
+
+void DepletionCheckpoint::save(const std::string& fname) const {
+  if (std::filesystem::exists(fname)) {
+    std::filesystem::remove(fname);
+  }
+
+  std::ofstream file(fname, std::ios_base::binary);
+
+  cereal::PortableBinaryOutputArchive arc(file);
+
+  arc(*this);
+}
+
+std::shared_ptr<DepletionCheckpoint> DepletionCheckpoint::load(
+    const std::string& fname) {
+  if (std::filesystem::exists(fname) == false) {
+    std::stringstream mssg;
+    mssg << "The file \"" << fname << "\" does not exist.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  auto out = std::make_shared<DepletionCheckpoint>();
+
+  std::ifstream file(fname, std::ios_base::binary);
+
+  cereal::PortableBinaryInputArchive arc(file);
+
+  arc(*out);
+
+  return out;
+}
+
+CheckpointWriter::~CheckpointWriter() {
+  if (thread_.joinable()) thread_.join();
+}
+
+void CheckpointWriter::write(const DepletionCheckpoint& checkpoint,
+                             const std::string& fname) {
+  this->wait();
+
+  std::ostringstream buffer(std::ios_base::binary);
+  {
+    cereal::PortableBinaryOutputArchive arc(buffer);
+    arc(checkpoint);
+  }
+
+  thread_ = std::thread([this, data = std::move(buffer).str(), fname]() {
+    try {
+      const std::string tmp_fname = fname + ".tmp";
+      {
+        std::ofstream file(tmp_fname,
+                           std::ios_base::binary | std::ios_base::trunc);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        file.close();
+        if (file.fail()) {
+          std::stringstream mssg;
+          mssg << "Could not write checkpoint to \"" << tmp_fname << "\".";
+          throw ScarabeeException(mssg.str());
+        }
+      }
+      std::filesystem::rename(tmp_fname, fname);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mtx_);
+      error_ = std::current_exception();
+    }
+  });
+}
+
+void CheckpointWriter::wait() {
+  if (thread_.joinable()) thread_.join();
+
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    std::swap(error, error_);
+  }
+
+  if (error) {
+    try {
+      std::rethrow_exception(error);
+    } catch (const std::exception& e) {
+      spdlog::error(e.what());
+      throw;
+    }
+  }
+}
+
+}  // namespace scarabee
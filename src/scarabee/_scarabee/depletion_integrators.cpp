@@ -0,0 +1,106 @@
+#include <data/depletion_integrators.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <sstream>
+
+namespace scarabee {
+
+namespace {
+void check_time_step(double dt, const char* name) {
+  if (dt <= 0.) {
+    std::stringstream mssg;
+    mssg << "Depletion time step " << name << " must be > 0.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+}
+}  // namespace
+
+std::vector<std::vector<double>> celi_predictor_substeps(double dt) {
+  check_time_step(dt, "dt");
+  return {{dt}};
+}
+
+std::vector<std::vector<double>> celi_corrector_substeps(
+    double dt, std::size_t nsubsteps) {
+  check_time_step(dt, "dt");
+
+  if (nsubsteps == 0) {
+    const auto mssg = "Number of depletion substeps must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // The matrix at the fraction t of the step is (1 - t) A0 + t A1. Each
+  // substep [a, b] then applies exp(h (5/12 A(a) + 1/12 A(b))), followed by
+  // exp(h (1/12 A(a) + 5/12 A(b))).
+  const double n = static_cast<double>(nsubsteps);
+  const double h = dt / n;
+  std::vector<std::vector<double>> substeps;
+  substeps.reserve(2 * nsubsteps);
+  for (std::size_t s = 0; s < nsubsteps; s++) {
+    const double a = static_cast<double>(s) / n;
+    const double b = static_cast<double>(s + 1) / n;
+
+    substeps.push_back({h * (5. * (1. - a) + (1. - b)) / 12.,
+                        h * (5. * a + b) / 12.});
+    substeps.push_back({h * ((1. - a) + 5. * (1. - b)) / 12.,
+                        h * (a + 5. * b) / 12.});
+  }
+
+  return substeps;
+}
+
+std::vector<std::vector<double>> leqi_predictor_substeps(double dt,
+                                                         double dtm1) {
+  check_time_step(dt, "dt");
+  check_time_step(dtm1, "dtm1");
+
+  return {{dt * (-dt / (12. * dtm1)), dt * ((6. * dtm1 + dt) / (12. * dtm1))},
+          {dt * (-5. * dt / (12. * dtm1)),
+           dt * ((6. * dtm1 + 5. * dt) / (12. * dtm1))}};
+}
+
+std::vector<std::vector<double>> leqi_corrector_substeps(double dt,
+                                                         double dtm1) {
+  check_time_step(dt, "dt");
+  check_time_step(dtm1, "dtm1");
+
+  const double d = 12. * dtm1 * (dtm1 + dt);
+  return {{dt * (-dt * dt / d),
+           dt * ((5. * dtm1 * dtm1 + 6. * dtm1 * dt + dt * dt) / d),
+           dt * (dtm1 / (12. * (dtm1 + dt)))},
+          {dt * (-dt * dt / d),
+           dt * ((dtm1 * dtm1 + 2. * dtm1 * dt + dt * dt) / d),
+           dt * ((5. * dtm1 + 4. * dt) / (12. * (dtm1 + dt)))}};
+}
+
+std::vector<std::vector<double>> cf4_substeps(std::size_t stage, double dt) {
+  check_time_step(dt, "dt");
+
+  switch (stage) {
+    case 1:
+    case 2:
+      return {{0.5 * dt}};
+
+    case 3:
+      return {{-0.5 * dt, dt}};
+
+    case 4:
+      return {{dt * 3. / 12., dt * 2. / 12., dt * 2. / 12., -dt / 12.},
+              {-dt / 12., dt * 2. / 12., dt * 2. / 12., dt * 3. / 12.}};
+
+    default: {
+      std::stringstream mssg;
+      mssg << "CF4 stage must be 1, 2, 3, or 4, not " << stage << ".";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  }
+
+  // NEVER GETS HERE
+  return {};
+}
+
+}  // namespace scarabee
@@ -3,43 +3,56 @@
 #define EIGEN_DONT_PARALLELIZE
 
 #include <data/depletion_matrix.hpp>
+#include <data/cram_elimination.hpp>
+#include <data/depletion_matrix_template.hpp>
 #include <utils/constants.hpp>
 #include <utils/logging.hpp>
 #include <utils/nuclide_names.hpp>
 #include <utils/scarabee_exception.hpp>
+#include <utils/profiler.hpp>
+#include <utils/threads.hpp>
 
 #include <Eigen/Dense>
 #include <Eigen/SparseCore>
 #include <Eigen/SparseLU>
 
 #include <algorithm>
-#include <set>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <sstream>
 #include <utility>
+#include <vector>
 
 namespace scarabee {
 
 DepletionMatrix::DepletionMatrix(const std::vector<std::string>& nuclides)
-    : nuclides_(nuclides),
-      matrix_(static_cast<int>(size()), static_cast<int>(size())) {
+    : index_(), matrix_() {
   // Make sure nuclides are sorted
-  std::sort(nuclides_.begin(), nuclides_.end(),
+  auto index = std::make_shared<NuclideIndex>();
+  index->nuclides = nuclides;
+  std::sort(index->nuclides.begin(), index->nuclides.end(),
             [](const std::string& n1, const std::string& n2) {
               return nuclide_name_to_za(n1) < nuclide_name_to_za(n2);
             });
+
+  index->indices.reserve(index->nuclides.size());
+  for (std::size_t i = 0; i < index->nuclides.size(); i++) {
+    index->indices.emplace(index->nuclides[i], i);
+  }
+
+  index_ = index;
+  matrix_.resize(static_cast<int>(size()), static_cast<int>(size()));
 }
 
 bool DepletionMatrix::has_nuclide(const std::string& nuclide) const {
-  for (const auto& nuc : nuclides_) {
-    if (nuc == nuclide) return true;
-  }
-  return false;
+  return index_->indices.find(nuclide) != index_->indices.end();
 }
 
 std::size_t DepletionMatrix::get_nuclide_index(
     const std::string& nuclide) const {
-  for (std::size_t i = 0; i < nuclides_.size(); i++) {
-    if (nuclides_[i] == nuclide) return i;
-  }
+  const auto it = index_->indices.find(nuclide);
+  if (it != index_->indices.end()) return it->second;
 
   const auto mssg = "Depletion matrix does not contain \"" + nuclide + "\".";
   spdlog::error(mssg);
@@ -49,8 +62,9 @@ std::size_t DepletionMatrix::get_nuclide_index(
   return 0;
 }
 
-void DepletionMatrix::exponential_product(std::span<double> N,
-                                          bool cram48) const {
+void DepletionMatrix::exponential_product(std::span<double> N, bool cram48,
+                                          CRAMSolver solver) const {
+  SCARABEE_PROFILE_ZONE("DepletionMatrix::exponential_product");
   if (N.size() != this->size()) {
     const auto mssg =
         "The number of provided number densities does not agree with the size "
@@ -79,26 +93,88 @@ void DepletionMatrix::exponential_product(std::span<double> N,
     alpha0 = cram16_alpha0_;
   }
 
-  detail_exp_product(N, theta, alpha, alpha0);
+  if (solver == CRAMSolver::Elimination &&
+      elimination_exp_product(N, theta, alpha, alpha0)) {
+    return;
+  }
+
+  detail_exp_product(N, theta, alpha, alpha0,
+                     solver == CRAMSolver::ParallelSparseLU);
 }
 
-void DepletionMatrix::detail_exp_product(
+bool DepletionMatrix::elimination_exp_product(
     std::span<double> N, std::span<const std::complex<double>> theta,
     std::span<const std::complex<double>> alpha, double alpha0) const {
-  // Initialize the complex matrix
-  Eigen::SparseMatrix<std::complex<double>> Acmplx(this->size(), this->size());
+  // The structure is found from the compressed pattern, so an uncompressed
+  // matrix is compressed in a copy
+  std::optional<Eigen::SparseMatrix<double>> compressed;
+  if (matrix_.isCompressed() == false) {
+    compressed = matrix_;
+    compressed->makeCompressed();
+  }
+  const auto& A = compressed ? *compressed : matrix_;
 
-  // Complex A is initialized as the current real matrix.
-  // Effectively completes Acmplx = matrix_;
+  const auto elim = CRAMElimination::get(A);
+  if (elim->exponential_product(A, N, theta, alpha, alpha0)) return true;
+
+  spdlog::debug(
+      "A pivot vanished in the CRAM elimination. Using SparseLU instead.");
+  return false;
+}
+
+void DepletionMatrix::detail_exp_product(
+    std::span<double> N, std::span<const std::complex<double>> theta,
+    std::span<const std::complex<double>> alpha, double alpha0,
+    bool parallel_poles) const {
+  using CmplxMatrix = Eigen::SparseMatrix<std::complex<double>>;
+  const Eigen::Index NN = static_cast<Eigen::Index>(this->size());
+
+  // Complex A is initialized as the current real matrix, with every
+  // diagonal entry in its pattern, even if zero. The pattern is then the
+  // same for all poles.
+  std::vector<Eigen::Triplet<std::complex<double>, Eigen::Index>> entries;
+  entries.reserve(static_cast<std::size_t>(matrix_.nonZeros()) + this->size());
+  for (Eigen::Index j = 0; j < NN; j++) entries.emplace_back(j, j, 0.);
   for (int k = 0; k < matrix_.outerSize(); ++k) {
     for (Eigen::SparseMatrix<double>::InnerIterator it(matrix_, k); it; ++it) {
-      Acmplx.coeffRef(it.row(), it.col()) = {it.value(), 0.};
+      entries.emplace_back(it.row(), it.col(), it.value());
     }
   }
+  CmplxMatrix Acmplx(NN, NN);
+  Acmplx.setFromTriplets(entries.begin(), entries.end());
   Acmplx.makeCompressed();
 
-  // Create the solver object
-  Eigen::SparseLU<Eigen::SparseMatrix<std::complex<double>>> solver;
+  // Position of each diagonal entry in the compressed values, along with
+  // its real value, so that the poles may be subtracted without searching
+  std::vector<std::size_t> diag(this->size(), 0);
+  std::vector<double> diag_value(this->size(), 0.);
+  for (Eigen::Index j = 0; j < NN; j++) {
+    const auto* inner = Acmplx.innerIndexPtr();
+    const auto begin = Acmplx.outerIndexPtr()[j];
+    const auto end = Acmplx.outerIndexPtr()[j + 1];
+    const auto* pos = std::lower_bound(inner + begin, inner + end, j);
+    const std::size_t jj = static_cast<std::size_t>(j);
+    diag[jj] = static_cast<std::size_t>(pos - inner);
+    diag_value[jj] = Acmplx.valuePtr()[diag[jj]].real();
+  }
+
+  // Subtracts theta from the diagonal of a matrix with the pattern of Acmplx
+  auto shift_diagonal = [&diag, &diag_value](CmplxMatrix& M,
+                                             std::complex<double> t) {
+    std::complex<double>* values = M.valuePtr();
+    for (std::size_t j = 0; j < diag.size(); j++) {
+      values[diag[j]] = diag_value[j] - t;
+    }
+  };
+
+  auto check_factorization = [](const Eigen::SparseLU<CmplxMatrix>& solver) {
+    if (solver.info() != Eigen::ComputationInfo::Success) {
+      const auto mssg =
+          "Could not factorize complex depletion matrix in CRAM iterations.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  };
 
   // Initialize the complex vector for N
   Eigen::Matrix<std::complex<double>, Eigen::Dynamic, 1> Ncmplx(this->size());
@@ -109,22 +185,10 @@ void DepletionMatrix::detail_exp_product(
     Ncmplx(n).imag(0.);
   }
 
-  // Do all iterations for CRAM
-  for (std::size_t i = 0; i < theta.size(); i++) {
-    // Subtract theta[i] from diagonal
-    for (std::size_t j = 0; j < this->size(); j++) {
-      Acmplx.coeffRef(j, j) = matrix_.coeff(j, j) - theta[i];
-    }
-
+  // Applies pole i, with its factorized solver, to the current N
+  auto apply_pole = [&](const Eigen::SparseLU<CmplxMatrix>& solver,
+                        std::size_t i) {
     // Solve the system for Acmplx @ x = N
-    solver.analyzePattern(Acmplx);
-    solver.factorize(Acmplx);
-    if (solver.info() != Eigen::ComputationInfo::Success) {
-      const auto mssg =
-          "Could not factorize complex depletion matrix in CRAM iterations.";
-      spdlog::error(mssg);
-      throw ScarabeeException(mssg);
-    }
     Ncmplx_out = solver.solve(Ncmplx);
 
     // Multiply by complex alpha[i]
@@ -133,6 +197,41 @@ void DepletionMatrix::detail_exp_product(
       const double val = Ncmplx(j).real() + Ncmplx_out(j).real();
       Ncmplx(j).real(val);
     }
+  };
+
+  if (parallel_poles) {
+    // The factorizations of the poles are independent, and are all done at
+    // the same time, each with its own copy of the matrix. The solves must
+    // still be done in order, as each pole is applied to the result of the
+    // previous one.
+    std::vector<CmplxMatrix> shifted(theta.size(), Acmplx);
+    std::vector<std::unique_ptr<Eigen::SparseLU<CmplxMatrix>>> solvers(
+        theta.size());
+    parallel_for_each_index(theta.size(), [&](std::size_t i) {
+      shift_diagonal(shifted[i], theta[i]);
+      solvers[i] = std::make_unique<Eigen::SparseLU<CmplxMatrix>>();
+      solvers[i]->analyzePattern(shifted[i]);
+      solvers[i]->factorize(shifted[i]);
+      check_factorization(*solvers[i]);
+    });
+
+    for (std::size_t i = 0; i < theta.size(); i++) apply_pole(*solvers[i], i);
+  } else {
+    // The fill reducing ordering and the elimination tree only depend on the
+    // pattern, so the symbolic analysis is done once for all poles. Each pole
+    // then only needs a numeric factorization.
+    Eigen::SparseLU<CmplxMatrix> solver;
+    solver.analyzePattern(Acmplx);
+
+    // Do all iterations for CRAM
+    for (std::size_t i = 0; i < theta.size(); i++) {
+      // Subtract theta[i] from diagonal
+      shift_diagonal(Acmplx, theta[i]);
+
+      solver.factorize(Acmplx);
+      check_factorization(solver);
+      apply_pole(solver, i);
+    }
   }
 
   // Reassign number densities for the input span
@@ -143,169 +242,106 @@ void DepletionMatrix::detail_exp_product(
   }
 }
 
-double compute_loss_term(const ChainEntry& nucinfo,
-                         const DepletionReactionRates& nucrr) {
-  double loss = 0.;
-
-  // Get losses due to radioactive decay.
-  // Must convert half life to decay constant !
-  if (nucinfo.half_life()) loss += LN_2 / nucinfo.half_life().value();
-
-  // Accumulate losses due to transmutation.
-  if (nucinfo.n_gamma()) loss += nucrr.n_gamma;
-  if (nucinfo.n_2n()) loss += nucrr.n_2n;
-  if (nucinfo.n_3n()) loss += nucrr.n_3n;
-  if (nucinfo.n_p()) loss += nucrr.n_p;
-  if (nucinfo.n_alpha()) loss += nucrr.n_alpha;
-  if (nucinfo.n_fission()) loss += nucrr.n_fission;
-
-  return loss;
-}
+std::shared_ptr<DepletionMatrix> build_depletion_matrix(
+    std::shared_ptr<DepletionChain> chain, std::shared_ptr<Material> mat,
+    std::span<const double> flux, std::shared_ptr<NDLibrary> ndl) {
+  // The targets and the pattern of the matrix only depend on the nuclides in
+  // the material, and are only found once for the same chain and nuclides
+  const auto tmpl = DepletionMatrixTemplate::get(chain, mat->composition());
 
-void fill_target_gains(DepletionMatrix& /*matrix*/, const NoTarget& /*target*/,
-                       const double /*rate*/,
-                       const std::size_t /*parent_index*/) {
-  // Nothing to do when there is no target
-}
+  // Get the reaction rates for the nuclides in the material. The buffer is
+  // kept per thread, as many materials are usually built at the same time.
+  thread_local std::vector<DepletionReactionRates> nuc_rrs;
+  mat->compute_depletion_reaction_rates(flux, *ndl, nuc_rrs);
 
-void fill_target_gains(DepletionMatrix& matrix, const SingleTarget& target,
-                       const double rate, const std::size_t parent_index) {
-  const std::size_t target_index = matrix.get_nuclide_index(target.target());
-  matrix.ref(target_index, parent_index) += rate;
+  return tmpl->build(nuc_rrs);
 }
 
-void fill_target_gains(DepletionMatrix& matrix, const BranchingTargets& targets,
-                       const double rate, const std::size_t parent_index) {
-  for (const auto& branch : targets.branches()) {
-    const std::size_t target_index = matrix.get_nuclide_index(branch.target);
-    matrix.ref(target_index, parent_index) += rate * branch.branch_ratio;
-  }
-}
+std::vector<DepletionResult> deplete_materials(
+    std::shared_ptr<DepletionChain> chain,
+    const std::vector<DepletionRequest>& requests,
+    std::shared_ptr<NDLibrary> ndl, bool cram48) {
+  SCARABEE_PROFILE_ZONE("deplete_materials");
 
-void fill_target_gains(DepletionMatrix& matrix, const FissionYields& fy,
-                       const double rate, const double E,
-                       const std::size_t parent_index) {
-  for (std::size_t fyi = 0; fyi < fy.size(); fyi++) {
-    const std::size_t target_index =
-        matrix.get_nuclide_index(fy.targets()[fyi]);
-    matrix.ref(target_index, parent_index) += rate * fy.yield(fyi, E);
+  if (chain == nullptr) {
+    auto mssg = "DepletionChain is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
   }
-}
 
-void fill_target_gains(DepletionMatrix& matrix, const Target& target,
-                       const double rate, const std::size_t parent_index) {
-  if (std::holds_alternative<NoTarget>(target)) {
-    fill_target_gains(matrix, std::get<NoTarget>(target), rate, parent_index);
-  } else if (std::holds_alternative<SingleTarget>(target)) {
-    fill_target_gains(matrix, std::get<SingleTarget>(target), rate,
-                      parent_index);
-  } else {
-    // Must hold BranchingTargets
-    fill_target_gains(matrix, std::get<BranchingTargets>(target), rate,
-                      parent_index);
+  if (ndl == nullptr) {
+    auto mssg = "NDLibrary is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
   }
-}
-
-void fill_gain_terms(DepletionMatrix& matrix, const ChainEntry& nucinfo,
-                     const DepletionReactionRates& nucrr, const std::size_t i) {
-  if (nucinfo.decay_targets())
-    fill_target_gains(matrix, nucinfo.decay_targets().value(),
-                      LN_2 / nucinfo.half_life().value(), i);
-
-  if (nucinfo.n_gamma() && nucrr.n_gamma > 0.)
-    fill_target_gains(matrix, nucinfo.n_gamma().value(), nucrr.n_gamma, i);
-
-  if (nucinfo.n_2n() && nucrr.n_2n > 0.)
-    fill_target_gains(matrix, nucinfo.n_2n().value(), nucrr.n_2n, i);
-
-  if (nucinfo.n_3n() && nucrr.n_3n > 0.)
-    fill_target_gains(matrix, nucinfo.n_3n().value(), nucrr.n_3n, i);
 
-  if (nucinfo.n_p() && nucrr.n_p > 0.)
-    fill_target_gains(matrix, nucinfo.n_p().value(), nucrr.n_p, i);
-
-  if (nucinfo.n_alpha() && nucrr.n_alpha > 0.)
-    fill_target_gains(matrix, nucinfo.n_alpha().value(), nucrr.n_alpha, i);
+  for (std::size_t r = 0; r < requests.size(); r++) {
+    const auto& req = requests[r];
+    if (req.material == nullptr || req.initial == nullptr) {
+      std::stringstream mssg;
+      mssg << "A material of depletion request " << r << " is None.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
 
-  if (nucinfo.n_fission() && nucrr.n_fission > 0.)
-    fill_target_gains(matrix, nucinfo.n_fission().value(), nucrr.n_fission,
-                      nucrr.average_fission_energy, i);
-}
+    for (const auto& M : req.matrices) {
+      if (M == nullptr) {
+        std::stringstream mssg;
+        mssg << "A matrix of depletion request " << r << " is None.";
+        spdlog::error(mssg.str());
+        throw ScarabeeException(mssg.str());
+      }
+    }
 
-std::shared_ptr<DepletionMatrix> build_depletion_matrix(
-    std::shared_ptr<DepletionChain> chain, std::shared_ptr<Material> mat,
-    std::span<const double> flux, std::shared_ptr<NDLibrary> ndl) {
-  // Start by making a set of initial nuclides.
-  // These are only the depletable nuclides !!
-  std::set<std::string> initial_dep_nuclides;
-  for (const auto& nuc : mat->composition().nuclides) {
-    initial_dep_nuclides.insert(nuclide_name_to_simple_name(nuc.name));
+    for (const auto& c : req.substeps) {
+      if (c.size() != req.matrices.size() + 1) {
+        std::stringstream mssg;
+        mssg << "A substep of depletion request " << r << " has " << c.size()
+             << " coefficients, but " << req.matrices.size() + 1
+             << " are required.";
+        spdlog::error(mssg.str());
+        throw ScarabeeException(mssg.str());
+      }
+    }
   }
 
-  // Get the sorted list of all possible targets
-  std::vector<std::string> all_targets =
-      chain->descend_chains(initial_dep_nuclides);
-
-  // Get the vector of all reaction rate objects for the nuclides in the
-  // material
-  std::vector<DepletionReactionRates> nuc_rrs =
-      mat->compute_depletion_reaction_rates(flux, ndl);
-
-  // With this, we can build the matrix object
-  std::shared_ptr<DepletionMatrix> matrix_ptr =
-      std::make_shared<DepletionMatrix>(all_targets);
-  DepletionMatrix& matrix = *matrix_ptr;
-
-  // Now, go through each initial nuclide that is in the material and has
-  // reaction rates. We fill the matrix elements for targets of this nuclide.
-  for (const auto& nucrr : nuc_rrs) {
-    // Remove the nuclide from the all_targets list if it has reaction rates.
-    // This way, after the reaction rate terms, we can go through all the
-    // remaining nuclides in all_targets which don't have a reaction rate, but
-    // which almost certainly have radioactive decay !
-    std::ignore =
-        std::remove(all_targets.begin(), all_targets.end(), nucrr.nuclide);
-
-    // Skip the nuclide if it isn't in the depletion chain, even if it might
-    // have depletion cross section nuclear data and reaction rates.
-    if (chain->holds_nuclide_data(nucrr.nuclide) == false) continue;
-
-    // Get the depletion chain entry for the nuclide
-    const auto& nucinfo = chain->nuclide_data(nucrr.nuclide);
-
-    // Get the index of the nuclide
-    const std::size_t i = matrix.get_nuclide_index(nucrr.nuclide);
-
-    // First, account for all losses due to decay and transmutation.
-    matrix.ref(i, i) -= compute_loss_term(nucinfo, nucrr);
-
-    // Now we fill the gain terms for all targets
-    fill_gain_terms(matrix, nucinfo, nucrr, i);
-  }
+  std::vector<DepletionResult> results(requests.size());
+  parallel_for_each_index(requests.size(), [&](std::size_t r) {
+    const auto& req = requests[r];
 
-  // Now we need to go over all the nuclides that remain in all_targets, which
-  // weren't in the material and therefore don't have reaction rates.
-  DepletionReactionRates zero_rr;
-  for (const auto& nuclide : all_targets) {
-    // Skip the nuclide if it isn't in the depletion chain, even if it might
-    // have depletion cross section nuclear data and reaction rates.
-    if (chain->holds_nuclide_data(nuclide) == false) continue;
+    auto A = build_depletion_matrix(chain, req.material, req.flux, ndl);
+    const auto& nuclides = A->nuclides();
 
-    // Get the depletion chain entry for the nuclide
-    const auto& nucinfo = chain->nuclide_data(nuclide);
+    std::vector<double> N(A->size());
+    for (std::size_t i = 0; i < N.size(); i++) {
+      N[i] = req.initial->atom_density(nuclides[i]);
+    }
 
-    // Get the index of the nuclide
-    const std::size_t i = matrix.get_nuclide_index(nuclide);
+    for (const auto& c : req.substeps) {
+      DepletionMatrix F = *A * c.back();
+      for (std::size_t k = 0; k < req.matrices.size(); k++) {
+        F += *req.matrices[k] * c[k];
+      }
+      F.exponential_product(N, cram48);
+    }
 
-    // First, account for all losses due to decay and transmutation.
-    matrix.ref(i, i) -= compute_loss_term(nucinfo, zero_rr);
+    MaterialComposition comp;
+    for (std::size_t i = 0; i < N.size(); i++) {
+      if (N[i] > 0.) comp.add_nuclide(nuclides[i], N[i]);
+    }
 
-    // Now we fill the gain terms for all targets
-    fill_gain_terms(matrix, nucinfo, zero_rr, i);
+    results[r].matrix = A;
+    results[r].material =
+        std::make_shared<Material>(comp, req.material->temperature(), ndl);
+  });
+
+  // Cleared after all matrices are built, as a material may be used by more
+  // than one request
+  for (const auto& req : requests) {
+    if (req.clear_micro_xs) req.material->clear_all_micro_xs_data();
   }
 
-  matrix.compress();
-  return matrix_ptr;
+  return results;
 }
 
 // Constants for taking matrix exponential with CRAM.
@@ -391,4 +427,77 @@ const double DepletionMatrix::cram48_alpha0_{2.258038182743983e-47};
 //     Application to Burnup Equations,” Nucl. Sci. Eng., vol. 182, no. 3,
 //     pp. 297–318, 2016, doi: 10.13182/nse15-26.
 
+ChainReductionError estimate_chain_reduction_error(
+    std::shared_ptr<DepletionChain> full_chain,
+    std::shared_ptr<DepletionChain> reduced_chain,
+    std::shared_ptr<Material> mat, std::span<const double> flux,
+    std::shared_ptr<NDLibrary> ndl, double dt, std::size_t nsteps,
+    double min_fraction, bool cram48) {
+  if (full_chain == nullptr || reduced_chain == nullptr) {
+    auto mssg = "DepletionChain is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (mat == nullptr) {
+    auto mssg = "Material is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (ndl == nullptr) {
+    auto mssg = "NDLibrary is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (dt <= 0.) {
+    auto mssg = "Depletion time step dt must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  auto deplete = [&](std::shared_ptr<DepletionChain> chain,
+                     std::vector<double>& N) {
+    auto A = build_depletion_matrix(chain, mat, flux, ndl);
+    N.resize(A->size());
+    for (std::size_t i = 0; i < N.size(); i++) {
+      N[i] = mat->atom_density(A->nuclides()[i]);
+    }
+
+    const DepletionMatrix Adt = *A * dt;
+    for (std::size_t s = 0; s < nsteps; s++) Adt.exponential_product(N, cram48);
+    return A;
+  };
+
+  std::vector<double> Nf, Nr;
+  const auto Af = deplete(full_chain, Nf);
+  const auto Ar = deplete(reduced_chain, Nr);
+
+  double Nsum = 0.;
+  for (const double n : Nf) Nsum += n;
+  const double Nmin = min_fraction * Nsum;
+
+  ChainReductionError err;
+  for (std::size_t i = 0; i < Ar->size(); i++) {
+    const auto& nuc = Ar->nuclides()[i];
+    if (Af->has_nuclide(nuc) == false) continue;
+    const double nf = Nf[Af->get_nuclide_index(nuc)];
+    if (nf <= 0. || nf < Nmin) continue;
+
+    const double rel_err = std::abs(Nr[i] - nf) / nf;
+    err.nuclides.push_back(nuc);
+    err.full_densities.push_back(nf);
+    err.reduced_densities.push_back(Nr[i]);
+    err.relative_errors.push_back(rel_err);
+
+    if (rel_err > err.max_relative_error || err.max_error_nuclide.empty()) {
+      err.max_relative_error = rel_err;
+      err.max_error_nuclide = nuc;
+    }
+  }
+
+  return err;
+}
+
 }  // namespace scarabee
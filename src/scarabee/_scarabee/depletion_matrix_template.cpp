@@ -0,0 +1,289 @@
+#include <data/depletion_matrix_template.hpp>
+#include <utils/constants.hpp>
+#include <utils/logging.hpp>
+#include <utils/nuclide_names.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <Eigen/SparseCore>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace scarabee {
+
+namespace {
+using Reaction = CompiledDepletionChain::Reaction;
+
+std::vector<std::string> descend_material_chains(
+    const CompiledDepletionChain& chain,
+    const std::vector<std::string>& nuclides) {
+  // These are only the depletable nuclides !! Those which are not in the
+  // chain at all are kept, as they are by DepletionChain::descend_chains.
+  std::set<std::string> unknown_nuclides;
+  std::vector<std::size_t> initial_ids;
+  for (const auto& nuc : nuclides) {
+    const std::string simple_name = nuclide_name_to_simple_name(nuc);
+    if (chain.has_nuclide(simple_name)) {
+      initial_ids.push_back(chain.id(simple_name));
+    } else {
+      unknown_nuclides.insert(simple_name);
+    }
+  }
+
+  std::vector<std::string> names(unknown_nuclides.begin(),
+                                 unknown_nuclides.end());
+  for (const std::size_t id : chain.descend(initial_ids)) {
+    names.push_back(chain.name(id));
+  }
+  return names;
+}
+
+double reaction_rate(const DepletionReactionRates& nucrr, Reaction r) {
+  switch (r) {
+    case Reaction::NGamma:
+      return nucrr.n_gamma;
+    case Reaction::N2N:
+      return nucrr.n_2n;
+    case Reaction::N3N:
+      return nucrr.n_3n;
+    case Reaction::NP:
+      return nucrr.n_p;
+    case Reaction::NAlpha:
+      return nucrr.n_alpha;
+    default:
+      return 0.;
+  }
+}
+
+double compute_loss_term(const CompiledDepletionChain& chain, std::size_t id,
+                         const DepletionReactionRates& nucrr) {
+  // Get losses due to radioactive decay
+  double loss = chain.decay_constant(id);
+
+  // Accumulate losses due to transmutation.
+  for (std::size_t r = Reaction::NGamma; r < CompiledDepletionChain::NREACTIONS;
+       r++) {
+    if (chain.has_reaction(id, static_cast<Reaction>(r)))
+      loss += reaction_rate(nucrr, static_cast<Reaction>(r));
+  }
+  if (chain.fission_yields(id)) loss += nucrr.n_fission;
+
+  return loss;
+}
+
+void fill_target_gains(double* values, const std::vector<std::size_t>& pos,
+                       std::span<const double> ratios, const double rate) {
+  for (std::size_t b = 0; b < ratios.size(); b++) {
+    values[pos[b]] += rate * ratios[b];
+  }
+}
+
+void fill_target_gains(double* values, const std::vector<std::size_t>& pos,
+                       const FissionYields& fy, const double rate,
+                       const double E) {
+  for (std::size_t fyi = 0; fyi < fy.size(); fyi++) {
+    values[pos[fyi]] += rate * fy.yield(fyi, E);
+  }
+}
+}  // namespace
+
+DepletionMatrixTemplate::DepletionMatrixTemplate(
+    std::shared_ptr<const DepletionChain> chain,
+    const std::vector<std::string>& nuclides)
+    : chain_(CompiledDepletionChain::get(chain)),
+      skeleton_(descend_material_chains(*chain_, nuclides)),
+      columns_(),
+      rr_columns_(),
+      decay_columns_() {
+  const CompiledDepletionChain& cchain = *chain_;
+  const std::size_t n = skeleton_.size();
+  columns_.resize(n, Column{NONE, NONE, {}, {}});
+
+  // Columns with reaction rates. Like the reaction rates, these are found by
+  // the names of the nuclides in the material.
+  std::vector<bool> has_rr(n, false);
+  rr_columns_.resize(nuclides.size(), NONE);
+  for (std::size_t ni = 0; ni < nuclides.size(); ni++) {
+    if (skeleton_.has_nuclide(nuclides[ni])) {
+      has_rr[skeleton_.get_nuclide_index(nuclides[ni])] = true;
+    }
+
+    // Skip the nuclide if it isn't in the depletion chain, even if it might
+    // have depletion cross section nuclear data and reaction rates.
+    if (cchain.has_nuclide(nuclides[ni]) == false ||
+        cchain.has_entry(cchain.id(nuclides[ni])) == false)
+      continue;
+    rr_columns_[ni] = skeleton_.get_nuclide_index(nuclides[ni]);
+  }
+
+  // Rows of the compiled chain nuclides in the skeleton
+  std::vector<std::size_t> rows(cchain.size(), NONE);
+  for (std::size_t col = 0; col < n; col++) {
+    const auto& nuclide = skeleton_.nuclides()[col];
+    if (cchain.has_nuclide(nuclide)) rows[cchain.id(nuclide)] = col;
+  }
+
+  // Entries of the pattern, each with the list of positions where it must be
+  // saved once the pattern is compressed. Diagonal entries have no list.
+  std::vector<Eigen::Triplet<double, int>> entries;
+  std::vector<std::vector<std::size_t>*> entry_pos;
+  std::vector<std::size_t> entry_pos_index;
+  auto add_entries = [&](std::vector<std::size_t>* pos,
+                         std::span<const std::size_t> targets,
+                         std::size_t col) {
+    for (std::size_t t = 0; t < targets.size(); t++) {
+      const std::size_t row = rows[targets[t]];
+      entries.emplace_back(static_cast<int>(row), static_cast<int>(col), 0.);
+      entry_pos.push_back(pos);
+      entry_pos_index.push_back(t);
+    }
+    if (pos != nullptr) pos->resize(targets.size(), NONE);
+  };
+
+  for (std::size_t col = 0; col < n; col++) {
+    const auto& nuclide = skeleton_.nuclides()[col];
+    if (cchain.has_nuclide(nuclide) == false) continue;
+    const std::size_t id = cchain.id(nuclide);
+    if (cchain.has_entry(id) == false) continue;
+
+    Column& column = columns_[col];
+    column.id = id;
+
+    entries.emplace_back(static_cast<int>(col), static_cast<int>(col), 0.);
+    entry_pos.push_back(nullptr);
+    entry_pos_index.push_back(0);
+
+    add_entries(&column.gains[Reaction::Decay],
+                cchain.targets(id, Reaction::Decay), col);
+
+    // Columns without reaction rates only have decay terms
+    if (has_rr[col] == false) {
+      decay_columns_.push_back(col);
+      continue;
+    }
+
+    for (std::size_t r = Reaction::NGamma;
+         r < CompiledDepletionChain::NREACTIONS; r++) {
+      add_entries(&column.gains[r],
+                  cchain.targets(id, static_cast<Reaction>(r)), col);
+    }
+    add_entries(&column.n_fission, cchain.fission_targets(id), col);
+  }
+
+  Eigen::SparseMatrix<double>& A = skeleton_.matrix_;
+  A.setFromTriplets(entries.begin(), entries.end());
+  A.makeCompressed();
+
+  auto position = [&A](std::size_t row, std::size_t col) {
+    const int* inner = A.innerIndexPtr();
+    const int* begin = inner + A.outerIndexPtr()[col];
+    const int* end = inner + A.outerIndexPtr()[col + 1];
+    const int* pos = std::lower_bound(begin, end, static_cast<int>(row));
+    return static_cast<std::size_t>(pos - inner);
+  };
+
+  for (std::size_t e = 0; e < entries.size(); e++) {
+    const std::size_t row = static_cast<std::size_t>(entries[e].row());
+    const std::size_t col = static_cast<std::size_t>(entries[e].col());
+    if (entry_pos[e] == nullptr) {
+      columns_[col].diag = position(row, col);
+    } else {
+      (*entry_pos[e])[entry_pos_index[e]] = position(row, col);
+    }
+  }
+}
+
+std::shared_ptr<const DepletionMatrixTemplate> DepletionMatrixTemplate::get(
+    std::shared_ptr<const DepletionChain> chain,
+    const MaterialComposition& comp) {
+  if (chain == nullptr) {
+    const auto mssg = "DepletionChain is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Only a limited number of templates are kept, as the nuclides of the
+  // materials change from one depletion step to the next
+  constexpr std::size_t MAX_TEMPLATES = 256;
+  using Key = std::pair<std::uint64_t, std::vector<std::string>>;
+  static std::mutex mtx;
+  static std::map<Key, std::shared_ptr<const DepletionMatrixTemplate>> cache;
+
+  Key key{chain->uid(), {}};
+  key.second.reserve(comp.nuclides.size());
+  for (const auto& nuc : comp.nuclides) key.second.push_back(nuc.name);
+
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto it = cache.find(key);
+    if (it != cache.end()) return it->second;
+  }
+
+  // The template is built outside of the lock. Two threads making the same
+  // template is only wasted work, and only the first is kept.
+  auto tmpl =
+      std::make_shared<const DepletionMatrixTemplate>(chain, key.second);
+
+  std::lock_guard<std::mutex> lock(mtx);
+  if (cache.size() >= MAX_TEMPLATES) cache.clear();
+  const auto [it, inserted] = cache.emplace(std::move(key), tmpl);
+  return it->second;
+}
+
+std::shared_ptr<DepletionMatrix> DepletionMatrixTemplate::build(
+    std::span<const DepletionReactionRates> nuc_rrs) const {
+  if (nuc_rrs.size() != rr_columns_.size()) {
+    const auto mssg =
+        "The number of reaction rates does not agree with the number of "
+        "nuclides of the depletion matrix template.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // A copy of the skeleton shares its pattern and nuclides
+  auto matrix = std::make_shared<DepletionMatrix>(skeleton_);
+  double* values = matrix->matrix_.valuePtr();
+
+  const CompiledDepletionChain& cchain = *chain_;
+  auto fill_column = [this, &cchain, values](
+                         std::size_t col, const DepletionReactionRates& nucrr) {
+    const Column& column = columns_[col];
+    const std::size_t id = column.id;
+
+    // First, account for all losses due to decay and transmutation.
+    values[column.diag] -= compute_loss_term(cchain, id, nucrr);
+
+    // Now we fill the gain terms for all targets
+    fill_target_gains(values, column.gains[Reaction::Decay],
+                      cchain.ratios(id, Reaction::Decay),
+                      cchain.decay_constant(id));
+
+    for (std::size_t r = Reaction::NGamma;
+         r < CompiledDepletionChain::NREACTIONS; r++) {
+      const double rate = reaction_rate(nucrr, static_cast<Reaction>(r));
+      if (rate > 0.)
+        fill_target_gains(values, column.gains[r],
+                          cchain.ratios(id, static_cast<Reaction>(r)), rate);
+    }
+
+    if (cchain.fission_yields(id) && nucrr.n_fission > 0.)
+      fill_target_gains(values, column.n_fission, *cchain.fission_yields(id),
+                        nucrr.n_fission, nucrr.average_fission_energy);
+  };
+
+  for (std::size_t ni = 0; ni < nuc_rrs.size(); ni++) {
+    if (rr_columns_[ni] != NONE) fill_column(rr_columns_[ni], nuc_rrs[ni]);
+  }
+
+  // Nuclides which weren't in the material don't have reaction rates, but
+  // almost certainly have radioactive decay !
+  const DepletionReactionRates zero_rr;
+  for (const std::size_t col : decay_columns_) fill_column(col, zero_rr);
+
+  return matrix;
+}
+
+}  // namespace scarabee
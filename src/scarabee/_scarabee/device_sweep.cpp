@@ -0,0 +1,267 @@
+#include <moc/device_sweep.hpp>
+#include <utils/constants.hpp>
+#include <utils/math.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <algorithm>
+#include <string>
+
+// Without an offload target, the device loops run on the host threads, and
+// the data directives have nothing to do. Pointers referenced in a target
+// region are translated to the device copies made by the enter data
+// directives.
+#if defined(SCARABEE_USE_GPU)
+#define SCARABEE_DEVICE_LOOP \
+  _Pragma("omp target teams distribute parallel for")
+#define SCARABEE_DEVICE_PRAGMA(x) _Pragma(#x)
+#else
+#define SCARABEE_DEVICE_LOOP _Pragma("omp parallel for")
+#define SCARABEE_DEVICE_PRAGMA(x)
+#endif
+
+namespace scarabee {
+
+DeviceSweep::~DeviceSweep() { this->release(); }
+
+void DeviceSweep::upload(const std::vector<std::vector<Track>>& tracks,
+                         const SegmentStore& segs,
+                         const xt::xtensor<double, 2>& mat_Et,
+                         std::span<const double> invs_sin,
+                         std::span<const double> wsin,
+                         const xt::xtensor<StoredReal, 3>& track_flux,
+                         std::size_t nfsrs) {
+  this->release();
+
+  if (invs_sin.size() > MAX_POLAR) {
+    const auto mssg = "The device sweep supports at most " +
+                      std::to_string(MAX_POLAR) + " polar angles.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  ntracks_ = segs.ntracks();
+  nsegs_ = segs.nsegments();
+  nmats_ = mat_Et.shape()[0];
+  ngroups_ = mat_Et.shape()[1];
+  npol_ = invs_sin.size();
+  nfsrs_ = nfsrs;
+  nrows_ = track_flux.shape()[0];
+
+  // Segments of each track, in the order of the SegmentStore
+  seg_offsets_.resize(ntracks_ + 1);
+  fsr_.resize(nsegs_);
+  xs_.resize(nsegs_);
+  length_.resize(nsegs_);
+  for (std::size_t tt = 0; tt < ntracks_; tt++) {
+    seg_offsets_[tt] = segs.segments_begin(tt);
+  }
+  seg_offsets_[ntracks_] = nsegs_;
+  for (std::size_t s = 0; s < nsegs_; s++) {
+    fsr_[s] = static_cast<std::uint32_t>(segs.fsr_indx(s));
+    xs_[s] = static_cast<std::uint32_t>(segs.xs_indx(s));
+    length_[s] = segs.length(s);
+  }
+
+  // Weights and boundary rows of each track, for the forward (0) and backward
+  // (1) directions.
+  tw_.resize(ntracks_);
+  in_rows_.resize(2 * ntracks_);
+  out_rows_.resize(2 * ntracks_);
+  vacuum_.resize(2 * ntracks_);
+  for (std::size_t a = 0; a < tracks.size(); a++) {
+    for (std::size_t t = 0; t < tracks[a].size(); t++) {
+      const Track& track = tracks[a][t];
+      const std::size_t tt = segs.track_index(a, t);
+      tw_[tt] = 4. * PI * track.wgt() * track.width();
+      in_rows_[2 * tt] = track.entry_flux();
+      in_rows_[2 * tt + 1] = track.exit_flux();
+      out_rows_[2 * tt] = track.exit_track_flux();
+      out_rows_[2 * tt + 1] = track.entry_track_flux();
+      vacuum_[2 * tt] = track.exit_bc() == BoundaryCondition::Vacuum;
+      vacuum_[2 * tt + 1] = track.entry_bc() == BoundaryCondition::Vacuum;
+    }
+  }
+
+  Et_.assign(mat_Et.begin(), mat_Et.end());
+  invs_Et_.resize(Et_.size());
+  for (std::size_t i = 0; i < Et_.size(); i++) invs_Et_[i] = 1. / Et_[i];
+  invs_sin_.assign(invs_sin.begin(), invs_sin.end());
+  wsin_.assign(wsin.begin(), wsin.end());
+
+  psi_in_.assign(track_flux.begin(), track_flux.end());
+  psi_out_ = psi_in_;
+  src_.assign(ngroups_ * nfsrs_, 0.);
+  tally_.assign(ngroups_ * nfsrs_, 0.);
+
+  [[maybe_unused]] std::uint64_t* offsets = seg_offsets_.data();
+  [[maybe_unused]] std::uint32_t* fsr = fsr_.data();
+  [[maybe_unused]] std::uint32_t* xs = xs_.data();
+  [[maybe_unused]] StoredReal* len = length_.data();
+  [[maybe_unused]] double* tw = tw_.data();
+  [[maybe_unused]] std::uint64_t* in_rows = in_rows_.data();
+  [[maybe_unused]] std::uint64_t* out_rows = out_rows_.data();
+  [[maybe_unused]] std::uint8_t* vacuum = vacuum_.data();
+  [[maybe_unused]] double* Et = Et_.data();
+  [[maybe_unused]] double* invs_Et = invs_Et_.data();
+  [[maybe_unused]] double* isin = invs_sin_.data();
+  [[maybe_unused]] double* ws = wsin_.data();
+  [[maybe_unused]] StoredReal* psi_in = psi_in_.data();
+  [[maybe_unused]] StoredReal* psi_out = psi_out_.data();
+  [[maybe_unused]] double* src = src_.data();
+  [[maybe_unused]] double* tally = tally_.data();
+  [[maybe_unused]] const std::size_t nt = ntracks_;
+  [[maybe_unused]] const std::size_t nsegs = nsegs_;
+  [[maybe_unused]] const std::size_t npol = npol_;
+  [[maybe_unused]] const std::size_t ntw = 2 * ntracks_;
+  [[maybe_unused]] const std::size_t nxs = Et_.size();
+  [[maybe_unused]] const std::size_t npsi = psi_in_.size();
+  [[maybe_unused]] const std::size_t nsrc = src_.size();
+  SCARABEE_DEVICE_PRAGMA(
+      omp target enter data map(to: offsets[0:nt + 1],
+      fsr[0:nsegs], xs[0:nsegs], len[0:nsegs], tw[0:nt], in_rows[0:ntw],
+      out_rows[0:ntw], vacuum[0:ntw], Et[0:nxs], invs_Et[0:nxs],
+      isin[0:npol], ws[0:npol], psi_in[0:npsi],
+      psi_out[0:npsi]) map(alloc: src[0:nsrc], tally[0:nsrc]))
+
+  resident_ = true;
+}
+
+void DeviceSweep::sweep(const xt::xtensor<double, 2>& src,
+                        xt::xtensor<double, 3>& sflux, std::size_t g_begin,
+                        std::size_t g_end) {
+  if (resident_ == false) {
+    const auto mssg = "The device sweep data has not been uploaded.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t ng = ngroups_;
+  const std::size_t np = npol_;
+  const std::size_t nf = nfsrs_;
+  const std::size_t ngr = g_end - g_begin;
+  const std::size_t first = g_begin * nf;
+  const std::size_t count = ngr * nf;
+
+  // Only the source of the swept groups is sent
+  std::copy(src.begin() + first, src.begin() + first + count,
+            src_.begin() + first);
+
+  const std::uint64_t* offsets = seg_offsets_.data();
+  const std::uint32_t* fsr = fsr_.data();
+  const std::uint32_t* xs = xs_.data();
+  const StoredReal* len = length_.data();
+  const double* tw = tw_.data();
+  const std::uint64_t* in_rows = in_rows_.data();
+  const std::uint64_t* out_rows = out_rows_.data();
+  const std::uint8_t* vacuum = vacuum_.data();
+  const double* Et = Et_.data();
+  const double* invs_Et = invs_Et_.data();
+  const double* isin = invs_sin_.data();
+  const double* ws = wsin_.data();
+  StoredReal* psi_in = psi_in_.data();
+  StoredReal* psi_out = psi_out_.data();
+  double* dsrc = src_.data();
+  double* tally = tally_.data();
+  SCARABEE_DEVICE_PRAGMA(omp target update to(dsrc[first:count]))
+
+  SCARABEE_DEVICE_LOOP
+  for (long long k = 0; k < static_cast<long long>(count); k++) {
+    tally[first + static_cast<std::size_t>(k)] = 0.;
+  }
+
+  // One work item for each track, group, and direction
+  const long long nitems = static_cast<long long>(ntracks_ * ngr * 2);
+  SCARABEE_DEVICE_LOOP
+  for (long long k = 0; k < nitems; k++) {
+    const std::size_t kk = static_cast<std::size_t>(k);
+    const std::size_t d = kk % 2;
+    const std::size_t g = g_begin + (kk / 2) % ngr;
+    const std::size_t tt = kk / (2 * ngr);
+    const std::size_t dt = 2 * tt + d;
+
+    double psi[MAX_POLAR];
+    const StoredReal* in = psi_in + (in_rows[dt] * ng + g) * np;
+    for (std::size_t p = 0; p < np; p++) psi[p] = in[p];
+
+    const std::size_t s_begin = offsets[tt];
+    const std::size_t nseg = offsets[tt + 1] - s_begin;
+    for (std::size_t n = 0; n < nseg; n++) {
+      const std::size_t s = d == 0 ? s_begin + n : s_begin + nseg - 1 - n;
+      const std::size_t i = fsr[s];
+      const std::size_t mg = xs[s] * ng + g;
+      const double lEt = len[s] * Et[mg];
+      const double Q_Et = dsrc[g * nf + i] * invs_Et[mg];
+      double delta_sum = 0.;
+      for (std::size_t p = 0; p < np; p++) {
+        const double delta_flx = (psi[p] - Q_Et) * mexp(lEt * isin[p]);
+        psi[p] -= delta_flx;
+        delta_sum += ws[p] * delta_flx;
+      }
+#pragma omp atomic
+      tally[g * nf + i] += tw[tt] * delta_sum;
+    }
+
+    StoredReal* out = psi_out + (out_rows[dt] * ng + g) * np;
+    for (std::size_t p = 0; p < np; p++) {
+      out[p] = vacuum[dt] ? StoredReal(0.) : static_cast<StoredReal>(psi[p]);
+    }
+  }
+
+  // The outgoing fluxes become the incoming fluxes of the next sweep. Only
+  // the swept groups are copied, as the other groups may be swept later with
+  // the fluxes they already have.
+  const long long npsi = static_cast<long long>(nrows_ * ngr * np);
+  SCARABEE_DEVICE_LOOP
+  for (long long k = 0; k < npsi; k++) {
+    const std::size_t kk = static_cast<std::size_t>(k);
+    const std::size_t r = kk / (ngr * np);
+    const std::size_t g = g_begin + (kk / np) % ngr;
+    const std::size_t indx = (r * ng + g) * np + kk % np;
+    psi_in[indx] = psi_out[indx];
+  }
+
+  SCARABEE_DEVICE_PRAGMA(omp target update from(tally[first:count]))
+  for (std::size_t g = g_begin; g < g_end; g++) {
+    for (std::size_t i = 0; i < nf; i++) sflux(g, i, 0) += tally_[g * nf + i];
+  }
+}
+
+void DeviceSweep::download(xt::xtensor<StoredReal, 3>& track_flux) {
+  if (resident_ == false) return;
+
+  [[maybe_unused]] StoredReal* psi_in = psi_in_.data();
+  [[maybe_unused]] const std::size_t npsi = psi_in_.size();
+  SCARABEE_DEVICE_PRAGMA(omp target update from(psi_in[0:npsi]))
+  std::copy(psi_in_.begin(), psi_in_.end(), track_flux.begin());
+}
+
+void DeviceSweep::release() {
+  if (resident_ == false) return;
+
+  [[maybe_unused]] std::uint64_t* offsets = seg_offsets_.data();
+  [[maybe_unused]] std::uint32_t* fsr = fsr_.data();
+  [[maybe_unused]] std::uint32_t* xs = xs_.data();
+  [[maybe_unused]] StoredReal* len = length_.data();
+  [[maybe_unused]] double* tw = tw_.data();
+  [[maybe_unused]] std::uint64_t* in_rows = in_rows_.data();
+  [[maybe_unused]] std::uint64_t* out_rows = out_rows_.data();
+  [[maybe_unused]] std::uint8_t* vacuum = vacuum_.data();
+  [[maybe_unused]] double* Et = Et_.data();
+  [[maybe_unused]] double* invs_Et = invs_Et_.data();
+  [[maybe_unused]] double* isin = invs_sin_.data();
+  [[maybe_unused]] double* ws = wsin_.data();
+  [[maybe_unused]] StoredReal* psi_in = psi_in_.data();
+  [[maybe_unused]] StoredReal* psi_out = psi_out_.data();
+  [[maybe_unused]] double* src = src_.data();
+  [[maybe_unused]] double* tally = tally_.data();
+  SCARABEE_DEVICE_PRAGMA(
+      omp target exit data map(delete: offsets[0:0], fsr[0:0], xs[0:0],
+      len[0:0], tw[0:0], in_rows[0:0], out_rows[0:0], vacuum[0:0], Et[0:0],
+      invs_Et[0:0], isin[0:0], ws[0:0], psi_in[0:0], psi_out[0:0], src[0:0],
+      tally[0:0]))
+
+  resident_ = false;
+}
+
+}  // namespace scarabee
@@ -2,6 +2,8 @@
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/constants.hpp>
+#include <utils/profiler.hpp>
+#include <utils/threads.hpp>
 
 #include <cereal/archives/portable_binary.hpp>
 
@@ -165,49 +167,18 @@ void DiffusionCrossSection::check_xs() {
 std::shared_ptr<DiffusionCrossSection> DiffusionCrossSection::condense(
     const std::vector<std::pair<std::size_t, std::size_t>>& groups,
     const xt::xtensor<double, 1>& flux) const {
-  const std::size_t NGOUT = groups.size();
-  const std::size_t NG = ngroups();
-
-  // First, we need to check the condensation scheme
-  if (groups.size() == 0) {
-    auto mssg = "Empty energy condensation scheme provided.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
-
-  if (groups.front().first != 0) {
-    auto mssg = "The energy condensation scheme does not start with 0.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
-
-  if (groups.back().second != NG - 1) {
-    std::stringstream mssg;
-    mssg << "The energy condensation scheme does not end with " << NG - 1
-         << ".";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
-  }
-
-  for (std::size_t i = 0; i < NGOUT - 1; i++) {
-    if (groups[i].second + 1 != groups[i + 1].first) {
-      std::stringstream mssg;
-      mssg << "Condensed groups " << i << " and " << i + 1
-           << " are not continuous.";
-      spdlog::error(mssg.str());
-      throw ScarabeeException(mssg.str());
-    }
-  }
-
-  if (flux.size() != NG) {
-    auto mssg =
-        "The number of provided flux values diagrees with the number of energy "
-        "groups.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
+  const CondensationScheme scheme(groups, ngroups());
+  scheme.check_flux(flux.size());
+  return this->condense(scheme,
+                        std::span<const double>(flux.data(), flux.size()));
+}
 
-  // Everything checks out, we can start the condensation.
+std::shared_ptr<DiffusionCrossSection> DiffusionCrossSection::condense(
+    const CondensationScheme& scheme, std::span<const double> flux) const {
+  const auto& groups = scheme.groups();
+  const std::size_t NGOUT = scheme.ncondensed_groups();
+  const std::size_t NG = ngroups();
+  const std::size_t* macro_group = scheme.macro_groups().data();
 
   xt::xtensor<double, 1> D = xt::zeros<double>({NGOUT});
   xt::xtensor<double, 1> Ea = xt::zeros<double>({NGOUT});
@@ -222,30 +193,23 @@ std::shared_ptr<DiffusionCrossSection> DiffusionCrossSection::condense(
 
     // First, we get the sum of all flux values in the macro group
     double flux_G = 0.;
-    for (std::size_t g = g_min; g <= g_max; g++) flux_G += flux(g);
+    for (std::size_t g = g_min; g <= g_max; g++) flux_G += flux[g];
     const double invs_flux_G = 1. / flux_G;
 
-    // First we do all of the 1D cross sections
+    // Each fine row of the scattering matrix is added to the row of its
+    // macro group in a single pass, along with the 1D cross sections
+    double* Es_G = &Es(G, 0);
     for (std::size_t g = g_min; g <= g_max; g++) {
-      const double fluxg_fluxG = flux(g) * invs_flux_G;
+      const double fluxg_fluxG = flux[g] * invs_flux_G;
       D(G) += fluxg_fluxG * this->D(g);
       Ea(G) += fluxg_fluxG * this->Ea(g);
       Ef(G) += fluxg_fluxG * this->Ef(g);
       vEf(G) += fluxg_fluxG * this->vEf(g);
       chi(G) += this->chi(g);  // chi doesn't need to be weighted
-    }
 
-    // Next, we do all 2D cross sections
-    for (std::size_t GG = 0; GG < NGOUT; GG++) {  // Outgoing macro groups
-      const std::size_t gg_min = groups[GG].first;
-      const std::size_t gg_max = groups[GG].second;
-
-      for (std::size_t g = g_min; g <= g_max; g++) {  // Incoming micro groups
-        const double fluxg_fluxG = flux(g) * invs_flux_G;
-        for (std::size_t gg = gg_min; gg <= gg_max;
-             gg++) {  // Outgoing micro groups
-          Es(G, GG) += fluxg_fluxG * this->Es(g, gg);
-        }
+      const double* Es_g = &Es_(g, 0);
+      for (std::size_t gg = 0; gg < NG; gg++) {
+        Es_G[macro_group[gg]] += fluxg_fluxG * Es_g[gg];
       }
     }
   }
@@ -254,6 +218,51 @@ std::shared_ptr<DiffusionCrossSection> DiffusionCrossSection::condense(
                                                  this->name_);
 }
 
+std::vector<std::shared_ptr<DiffusionCrossSection>>
+condense_diffusion_cross_sections(
+    const std::vector<std::shared_ptr<DiffusionCrossSection>>& xs,
+    const std::vector<xt::xtensor<double, 1>>& fluxes,
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups) {
+  SCARABEE_PROFILE_ZONE("condense_diffusion_cross_sections");
+  if (xs.size() != fluxes.size()) {
+    auto mssg = "The number of cross sections and of flux spectra disagree.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::vector<std::shared_ptr<DiffusionCrossSection>> out(xs.size(), nullptr);
+  if (xs.empty()) return out;
+
+  // All inputs are checked first, so that no exception is raised from the
+  // parallel region for bad input
+  for (const auto& xsi : xs) {
+    if (xsi == nullptr) {
+      auto mssg = "Cannot condense a None cross section.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  const CondensationScheme scheme(groups, xs.front()->ngroups());
+  for (std::size_t i = 0; i < xs.size(); i++) {
+    if (xs[i]->ngroups() != scheme.ngroups()) {
+      auto mssg = "All cross sections must have the same number of groups.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    scheme.check_flux(fluxes[i].size());
+  }
+
+  parallel_for_each_index(xs.size(), [&](std::size_t i) {
+    const auto& flux = fluxes[i];
+    out[i] = xs[i]->condense(
+        scheme, std::span<const double>(flux.data(), flux.size()));
+  });
+
+  return out;
+}
+
 void DiffusionCrossSection::save(const std::string& fname) const {
   if (std::filesystem::exists(fname)) {
     std::filesystem::remove(fname);
@@ -286,4 +295,15 @@ std::shared_ptr<DiffusionCrossSection> DiffusionCrossSection::load(
   return out;
 }
 
+std::string DiffusionCrossSection::to_bytes() const {
+  return save_to_bytes(*this);
+}
+
+std::shared_ptr<DiffusionCrossSection> DiffusionCrossSection::from_bytes(
+    const std::string& data) {
+  std::shared_ptr<DiffusionCrossSection> out(new DiffusionCrossSection());
+  load_from_bytes(data, *out);
+  return out;
+}
+
 }  // namespace scarabee
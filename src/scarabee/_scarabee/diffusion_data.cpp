@@ -214,4 +214,13 @@ std::shared_ptr<DiffusionData> DiffusionData::load(const std::string& fname) {
   return out;
 }
 
+std::string DiffusionData::to_bytes() const { return save_to_bytes(*this); }
+
+std::shared_ptr<DiffusionData> DiffusionData::from_bytes(
+    const std::string& data) {
+  std::shared_ptr<DiffusionData> out(new DiffusionData());
+  load_from_bytes(data, *out);
+  return out;
+}
+
 }  // namespace scarabee
@@ -3,8 +3,11 @@
 #include <utils/scarabee_exception.hpp>
 
 #include <xtensor/core/xstrides.hpp>
+#include <xtensor/generators/xbuilder.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <string>
 #include <sstream>
 
 namespace scarabee {
@@ -130,6 +133,7 @@ DiffusionGeometry::DiffusionGeometry(const std::vector<TileFill>& tiles,
   }
 
   fill_x_bounds();
+  fill_connectivity();
 }
 
 DiffusionGeometry::DiffusionGeometry(const std::vector<TileFill>& tiles,
@@ -138,7 +142,8 @@ DiffusionGeometry::DiffusionGeometry(const std::vector<TileFill>& tiles,
                                      const std::vector<double>& dy,
                                      const std::vector<std::size_t>& ydivs,
                                      double albedo_xn, double albedo_xp,
-                                     double albedo_yn, double albedo_yp)
+                                     double albedo_yn, double albedo_yp,
+                                     DiffusionSymmetry symmetry)
     : tiles_(),
       xn_(),
       xp_(),
@@ -160,7 +165,8 @@ DiffusionGeometry::DiffusionGeometry(const std::vector<TileFill>& tiles,
       nx_(0),
       ny_(0),
       nz_(0),
-      geom_shape_() {
+      geom_shape_(),
+      symmetry_(symmetry) {
   // Make sure numbers are coherent !
   if ((tile_dx_.size() != x_divs_per_tile_.size()) ||
       (tile_dy_.size() != y_divs_per_tile_.size())) {
@@ -334,6 +340,8 @@ DiffusionGeometry::DiffusionGeometry(const std::vector<TileFill>& tiles,
 
   fill_x_bounds();
   fill_y_bounds();
+  check_symmetry();
+  fill_connectivity();
 }
 
 DiffusionGeometry::DiffusionGeometry(
@@ -341,7 +349,8 @@ DiffusionGeometry::DiffusionGeometry(
     const std::vector<std::size_t>& xdivs, const std::vector<double>& dy,
     const std::vector<std::size_t>& ydivs, const std::vector<double>& dz,
     const std::vector<std::size_t>& zdivs, double albedo_xn, double albedo_xp,
-    double albedo_yn, double albedo_yp, double albedo_zn, double albedo_zp)
+    double albedo_yn, double albedo_yp, double albedo_zn, double albedo_zp,
+    DiffusionSymmetry symmetry)
     : tiles_(),
       xn_(),
       xp_(),
@@ -363,7 +372,8 @@ DiffusionGeometry::DiffusionGeometry(
       nx_(0),
       ny_(0),
       nz_(0),
-      geom_shape_() {
+      geom_shape_(),
+      symmetry_(symmetry) {
   // Make sure numbers are coherent !
   if ((tile_dx_.size() != x_divs_per_tile_.size()) ||
       (tile_dy_.size() != y_divs_per_tile_.size()) ||
@@ -589,6 +599,8 @@ DiffusionGeometry::DiffusionGeometry(
   fill_x_bounds();
   fill_y_bounds();
   fill_z_bounds();
+  check_symmetry();
+  fill_connectivity();
 }
 
 std::size_t DiffusionGeometry::ngroups() const {
@@ -603,13 +615,22 @@ DiffusionGeometry::neighbor(std::size_t m, Neighbor n) const {
     throw ScarabeeException(mssg);
   }
 
-  if (ndims() == 1) {
-    return neighbor_1d(m, n);
-  } else if (ndims() == 2) {
-    return neighbor_2d(m, n);
+  if ((ndims() == 1 && n != Neighbor::XN && n != Neighbor::XP) ||
+      (ndims() == 2 && (n == Neighbor::ZN || n == Neighbor::ZP))) {
+    auto mssg = "Invalid neighbor requested for " + std::to_string(ndims()) +
+                "D geometry.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const Face& f = face(m, n);
+  Tile tile;
+  if (f.mat) {
+    tile.xs = mat_xs_[f.mat.value()];
   } else {
-    return neighbor_3d(m, n);
+    tile.albedo = f.albedo;
   }
+  return {tile, f.mat};
 }
 
 std::pair<DiffusionGeometry::Tile, std::optional<std::size_t>>
@@ -743,9 +764,7 @@ const std::shared_ptr<DiffusionData>& DiffusionGeometry::mat(
     throw ScarabeeException(mssg);
   }
 
-  const auto geo_indx = geom_indx(m);
-  const auto tile_indx = geom_to_tile_indx(geo_indx);
-  return tiles_.element(tile_indx.begin(), tile_indx.end()).xs;
+  return mat_xs_[m];
 }
 
 const std::shared_ptr<DiffusionData>& DiffusionGeometry::mat(
@@ -761,13 +780,106 @@ xt::svector<std::size_t> DiffusionGeometry::geom_indx(std::size_t m) const {
     throw ScarabeeException(mssg);
   }
 
-  std::size_t flat_geom_indx = mat_indx_to_flat_geom_indx_[m];
-  std::array<std::size_t, 1> flat_geom_vec{flat_geom_indx};
+  const auto& ijk = mat_ijk_[m];
+  return xt::svector<std::size_t>(ijk.begin(), ijk.begin() + ndims());
+}
+
+DiffusionGeometry::Tile& DiffusionGeometry::material_tile(
+    const std::vector<std::size_t>& tile_indx,
+    const std::shared_ptr<DiffusionData>& xs) {
+  if (xs == nullptr) {
+    auto mssg = "Tile cross sections must not be None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (xs->ngroups() != ngroups()) {
+    auto mssg =
+        "Tile cross sections do not have the same number of groups as the "
+        "geometry.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (tile_indx.size() != ndims()) {
+    auto mssg = "Tile index does not agree with the number of dimensions.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (std::size_t d = 0; d < ndims(); d++) {
+    if (tile_indx[d] >= tiles_.shape()[d]) {
+      auto mssg = "Tile index out of range.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  Tile& tile = tiles_.element(tile_indx.begin(), tile_indx.end());
+  if (tile.xs == nullptr) {
+    auto mssg = "Only the cross sections of material tiles can be replaced.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  return tile;
+}
+
+void DiffusionGeometry::set_tile_xs(const std::vector<std::size_t>& tile_indx,
+                                    std::shared_ptr<DiffusionData> xs) {
+  Tile& tile = material_tile(tile_indx, xs);
+  tile.xs = std::move(xs);
+  fill_connectivity();
+}
+
+void DiffusionGeometry::set_tiles_xs(
+    const std::vector<std::vector<std::size_t>>& tile_indices,
+    const std::vector<std::shared_ptr<DiffusionData>>& xs) {
+  if (tile_indices.size() != xs.size()) {
+    auto mssg =
+        "The number of tile indices and of cross sections are not the same.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // All tiles are checked before any is changed
+  std::vector<Tile*> tiles;
+  tiles.reserve(xs.size());
+  for (std::size_t t = 0; t < xs.size(); t++) {
+    tiles.push_back(&material_tile(tile_indices[t], xs[t]));
+  }
+
+  for (std::size_t t = 0; t < xs.size(); t++) tiles[t]->xs = xs[t];
+  if (xs.empty() == false) fill_connectivity();
+}
+
+std::size_t DiffusionGeometry::replace_xs(
+    const std::shared_ptr<DiffusionData>& old_xs,
+    std::shared_ptr<DiffusionData> new_xs) {
+  if (old_xs == nullptr || new_xs == nullptr) {
+    auto mssg = "Tile cross sections must not be None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (new_xs->ngroups() != ngroups()) {
+    auto mssg =
+        "Tile cross sections do not have the same number of groups as the "
+        "geometry.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
 
-  // Now get the complete geometry index
-  auto geom_inds = xt::unravel_indices(flat_geom_vec, geom_shape_,
-                                       xt::layout_type::column_major)[0];
-  return xt::svector<std::size_t>(geom_inds.begin(), geom_inds.end());
+  std::size_t ntiles = 0;
+  for (auto& tile : tiles_) {
+    if (tile.xs == old_xs) {
+      tile.xs = new_xs;
+      ntiles++;
+    }
+  }
+
+  if (ntiles > 0) fill_connectivity();
+  return ntiles;
 }
 
 xt::svector<std::size_t> DiffusionGeometry::geom_to_tile_indx(
@@ -800,176 +912,50 @@ std::optional<std::size_t> DiffusionGeometry::geom_to_mat_indx(
 }
 
 double DiffusionGeometry::adf_xp(std::size_t m, std::size_t g) const {
-  // Get geometry index for m
-  const auto geo_indx_m = geom_indx(m);
-  if (geo_indx_m[0] == nx() - 1) {
-    return mat(m)->adf_xp(g);
-  }
-
-  auto geo_indx_n = geo_indx_m;
-  geo_indx_n[0]++;
-  const auto n = geom_to_mat_indx(geo_indx_n);
-
-  if (n.has_value() == false) {
-    // There is no neighbor on that side in the geometry.
-    // Use the current tile ADF.
-    return mat(m)->adf_xp(g);
-  }
-
-  // The the x-index of the tile for the current m and the neighbor mat.
-  const std::size_t tile_indx_m = geom_x_indx_to_tile_x_indx(geo_indx_m[0]);
-  const std::size_t tile_indx_n = geom_x_indx_to_tile_x_indx(geo_indx_n[0]);
-
-  // If the current m and neighbor n are in the same tile, we don't have a
-  // discontinuity, so the ADF is 1.
-  if (tile_indx_m == tile_indx_n) return 1.;
-
-  // We are at the boarder of a tile, so we return the mat ADF.
+  // If the neighbor is in the same tile, we don't have a discontinuity, so
+  // the ADF is 1. Otherwise, we are at the border of a tile (or next to a
+  // boundary), so we return the mat ADF.
+  if (face(m, Neighbor::XP).same_tile) return 1.;
   return mat(m)->adf_xp(g);
 }
 
 double DiffusionGeometry::adf_xn(std::size_t m, std::size_t g) const {
-  // Get geometry index for m
-  const auto geo_indx_m = geom_indx(m);
-  if (geo_indx_m[0] == 0) {
-    return mat(m)->adf_xn(g);
-  }
-
-  auto geo_indx_n = geo_indx_m;
-  geo_indx_n[0]--;
-  const auto n = geom_to_mat_indx(geo_indx_n);
-
-  if (n.has_value() == false) {
-    // There is no neighbor on that side in the geometry.
-    // Use the current tile ADF.
-    return mat(m)->adf_xn(g);
-  }
-
-  // The the x-index of the tile for the current m and the neighbor mat.
-  const std::size_t tile_indx_m = geom_x_indx_to_tile_x_indx(geo_indx_m[0]);
-  const std::size_t tile_indx_n = geom_x_indx_to_tile_x_indx(geo_indx_n[0]);
-
-  // If the current m and neighbor n are in the same tile, we don't have a
-  // discontinuity, so the ADF is 1.
-  if (tile_indx_m == tile_indx_n) return 1.;
-
-  // We are at the boarder of a tile, so we return the mat ADF.
+  // If the neighbor is in the same tile, we don't have a discontinuity, so
+  // the ADF is 1. Otherwise, we are at the border of a tile (or next to a
+  // boundary), so we return the mat ADF.
+  if (face(m, Neighbor::XN).same_tile) return 1.;
   return mat(m)->adf_xn(g);
 }
 
 double DiffusionGeometry::adf_yp(std::size_t m, std::size_t g) const {
-  // Get geometry index for m
-  const auto geo_indx_m = geom_indx(m);
-  if (geo_indx_m[1] == ny() - 1) {
-    return mat(m)->adf_yp(g);
-  }
-
-  auto geo_indx_n = geo_indx_m;
-  geo_indx_n[1]++;
-  const auto n = geom_to_mat_indx(geo_indx_n);
-
-  if (n.has_value() == false) {
-    // There is no neighbor on that side in the geometry.
-    // Use the current tile ADF.
-    return mat(m)->adf_yp(g);
-  }
-
-  // The the y-index of the tile for the current m and the neighbor mat.
-  const std::size_t tile_indx_m = geom_y_indx_to_tile_y_indx(geo_indx_m[1]);
-  const std::size_t tile_indx_n = geom_y_indx_to_tile_y_indx(geo_indx_n[1]);
-
-  // If the current m and neighbor n are in the same tile, we don't have a
-  // discontinuity, so the ADF is 1.
-  if (tile_indx_m == tile_indx_n) return 1.;
-
-  // We are at the boarder of a tile, so we return the mat ADF.
+  // If the neighbor is in the same tile, we don't have a discontinuity, so
+  // the ADF is 1. Otherwise, we are at the border of a tile (or next to a
+  // boundary), so we return the mat ADF.
+  if (face(m, Neighbor::YP).same_tile) return 1.;
   return mat(m)->adf_yp(g);
 }
 
 double DiffusionGeometry::adf_yn(std::size_t m, std::size_t g) const {
-  // Get geometry index for m
-  const auto geo_indx_m = geom_indx(m);
-  if (geo_indx_m[1] == 0) {
-    return mat(m)->adf_yn(g);
-  }
-
-  auto geo_indx_n = geo_indx_m;
-  geo_indx_n[1]--;
-  const auto n = geom_to_mat_indx(geo_indx_n);
-
-  if (n.has_value() == false) {
-    // There is no neighbor on that side in the geometry.
-    // Use the current tile ADF.
-    return mat(m)->adf_yn(g);
-  }
-
-  // The the y-index of the tile for the current m and the neighbor mat.
-  const std::size_t tile_indx_m = geom_y_indx_to_tile_y_indx(geo_indx_m[1]);
-  const std::size_t tile_indx_n = geom_y_indx_to_tile_y_indx(geo_indx_n[1]);
-
-  // If the current m and neighbor n are in the same tile, we don't have a
-  // discontinuity, so the ADF is 1.
-  if (tile_indx_m == tile_indx_n) return 1.;
-
-  // We are at the boarder of a tile, so we return the mat ADF.
+  // If the neighbor is in the same tile, we don't have a discontinuity, so
+  // the ADF is 1. Otherwise, we are at the border of a tile (or next to a
+  // boundary), so we return the mat ADF.
+  if (face(m, Neighbor::YN).same_tile) return 1.;
   return mat(m)->adf_yn(g);
 }
 
 double DiffusionGeometry::adf_zp(std::size_t m, std::size_t g) const {
-  // Get geometry index for m
-  const auto geo_indx_m = geom_indx(m);
-  if (geo_indx_m[2] == nz() - 1) {
-    return mat(m)->adf_zp(g);
-  }
-
-  auto geo_indx_n = geo_indx_m;
-  geo_indx_n[2]++;
-  const auto n = geom_to_mat_indx(geo_indx_n);
-
-  if (n.has_value() == false) {
-    // There is no neighbor on that side in the geometry.
-    // Use the current tile ADF.
-    return mat(m)->adf_zp(g);
-  }
-
-  // The the z-index of the tile for the current m and the neighbor mat.
-  const std::size_t tile_indx_m = geom_z_indx_to_tile_z_indx(geo_indx_m[2]);
-  const std::size_t tile_indx_n = geom_z_indx_to_tile_z_indx(geo_indx_n[2]);
-
-  // If the current m and neighbor n are in the same tile, we don't have a
-  // discontinuity, so the ADF is 1.
-  if (tile_indx_m == tile_indx_n) return 1.;
-
-  // We are at the boarder of a tile, so we return the mat ADF.
+  // If the neighbor is in the same tile, we don't have a discontinuity, so
+  // the ADF is 1. Otherwise, we are at the border of a tile (or next to a
+  // boundary), so we return the mat ADF.
+  if (face(m, Neighbor::ZP).same_tile) return 1.;
   return mat(m)->adf_zp(g);
 }
 
 double DiffusionGeometry::adf_zn(std::size_t m, std::size_t g) const {
-  // Get geometry index for m
-  const auto geo_indx_m = geom_indx(m);
-  if (geo_indx_m[2] == 0) {
-    return mat(m)->adf_zn(g);
-  }
-
-  auto geo_indx_n = geo_indx_m;
-  geo_indx_n[2]--;
-  const auto n = geom_to_mat_indx(geo_indx_n);
-
-  if (n.has_value() == false) {
-    // There is no neighbor on that side in the geometry.
-    // Use the current tile ADF.
-    return mat(m)->adf_zn(g);
-  }
-
-  // The the z-index of the tile for the current m and the neighbor mat.
-  const std::size_t tile_indx_m = geom_z_indx_to_tile_z_indx(geo_indx_m[2]);
-  const std::size_t tile_indx_n = geom_z_indx_to_tile_z_indx(geo_indx_n[2]);
-
-  // If the current m and neighbor n are in the same tile, we don't have a
-  // discontinuity, so the ADF is 1.
-  if (tile_indx_m == tile_indx_n) return 1.;
-
-  // We are at the boarder of a tile, so we return the mat ADF.
+  // If the neighbor is in the same tile, we don't have a discontinuity, so
+  // the ADF is 1. Otherwise, we are at the border of a tile (or next to a
+  // boundary), so we return the mat ADF.
+  if (face(m, Neighbor::ZN).same_tile) return 1.;
   return mat(m)->adf_zn(g);
 }
 
@@ -1188,6 +1174,191 @@ std::optional<std::size_t> DiffusionGeometry::z_to_k(double z) const {
   return z_bounds_.size() - 1;
 }
 
+double DiffusionGeometry::adf(std::size_t m, Neighbor n,
+                              std::size_t g) const {
+  switch (n) {
+    case Neighbor::XN:
+      return adf_xn(m, g);
+    case Neighbor::XP:
+      return adf_xp(m, g);
+    case Neighbor::YN:
+      return adf_yn(m, g);
+    case Neighbor::YP:
+      return adf_yp(m, g);
+    case Neighbor::ZN:
+      return adf_zn(m, g);
+    default:
+      return adf_zp(m, g);
+  }
+}
+
+std::pair<double, double> DiffusionGeometry::fold_xy(double x,
+                                                     double y) const {
+  if (symmetry_ == DiffusionSymmetry::Full) return {x, y};
+
+  // Coordinates relative to the core center
+  const double u = x - x_bounds_.back();
+  const double v = y - y_bounds_.back();
+  if (symmetry_ == DiffusionSymmetry::QuarterMirror) {
+    return {std::abs(u), std::abs(v)};
+  }
+
+  // Rotate the point into the first quadrant
+  if (u >= 0. && v >= 0.) return {u, v};
+  if (u < 0. && v >= 0.) return {v, -u};
+  if (u < 0.) return {-u, -v};
+  return {-v, u};
+}
+
+std::pair<std::size_t, std::size_t> DiffusionGeometry::fold_ij(
+    std::size_t i, std::size_t j) const {
+  if (symmetry_ == DiffusionSymmetry::Full) return {i, j};
+
+  // Index of the mesh away from the core center, along each axis
+  const bool neg_x = i < nx_;
+  const bool neg_y = j < ny_;
+  const std::size_t p = neg_x ? nx_ - 1 - i : i - nx_;
+  const std::size_t q = neg_y ? ny_ - 1 - j : j - ny_;
+
+  // The second and fourth quadrants are the first one rotated by 90 degrees
+  if (symmetry_ == DiffusionSymmetry::QuarterRotational && neg_x != neg_y) {
+    return {q, p};
+  }
+  return {p, q};
+}
+
+namespace {
+// Mesh bounds of the whole core, from those of one half starting at 0
+std::vector<double> unfold_bounds(const std::vector<double>& bounds) {
+  const double L = bounds.back();
+  std::vector<double> out;
+  out.reserve(2 * bounds.size() - 1);
+  for (std::size_t r = bounds.size() - 1; r > 0; r--) {
+    out.push_back(L - bounds[r]);
+  }
+  for (std::size_t r = 0; r < bounds.size(); r++) out.push_back(L + bounds[r]);
+  return out;
+}
+
+std::vector<double> unfold_widths(const std::vector<double>& widths) {
+  std::vector<double> out(widths.rbegin(), widths.rend());
+  out.insert(out.end(), widths.begin(), widths.end());
+  return out;
+}
+}  // namespace
+
+std::vector<double> DiffusionGeometry::unfolded_x_bounds() const {
+  if (symmetry_ == DiffusionSymmetry::Full) return x_bounds_;
+  return unfold_bounds(x_bounds_);
+}
+
+std::vector<double> DiffusionGeometry::unfolded_y_bounds() const {
+  if (symmetry_ == DiffusionSymmetry::Full) return y_bounds_;
+  return unfold_bounds(y_bounds_);
+}
+
+std::vector<double> DiffusionGeometry::unfolded_tile_dx() const {
+  if (symmetry_ == DiffusionSymmetry::Full) return tile_dx_;
+  return unfold_widths(tile_dx_);
+}
+
+std::vector<double> DiffusionGeometry::unfolded_tile_dy() const {
+  if (symmetry_ == DiffusionSymmetry::Full) return tile_dy_;
+  return unfold_widths(tile_dy_);
+}
+
+void DiffusionGeometry::check_symmetry() const {
+  if (symmetry_ != DiffusionSymmetry::QuarterRotational) return;
+
+  // The x = x_min face is mapped onto the y = y_min face by the rotation, so
+  // the meshes along x and y must be the same.
+  if (tile_dx_ != tile_dy_ || x_divs_per_tile_ != y_divs_per_tile_) {
+    auto mssg =
+        "Rotational symmetry requires the same tiles and divisions along x "
+        "and y.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+void DiffusionGeometry::fill_connectivity() {
+  // Geometry index of each material
+  mat_ijk_.assign(nmats_, {0, 0, 0});
+  for (std::size_t m = 0; m < nmats_; m++) {
+    std::array<std::size_t, 1> flat_geom_vec{mat_indx_to_flat_geom_indx_[m]};
+    const auto geom_inds = xt::unravel_indices(
+        flat_geom_vec, geom_shape_, xt::layout_type::column_major)[0];
+    for (std::size_t d = 0; d < ndims(); d++) mat_ijk_[m][d] = geom_inds[d];
+  }
+
+  // Cross sections of each material
+  mat_xs_.resize(nmats_);
+  for (std::size_t m = 0; m < nmats_; m++) {
+    const auto tile_indx = geom_to_tile_indx(geom_indx(m));
+    mat_xs_[m] = tiles_.element(tile_indx.begin(), tile_indx.end()).xs;
+  }
+
+  // Neighbors on each face of the materials
+  faces_.assign(6 * nmats_, Face());
+  for (std::size_t m = 0; m < nmats_; m++) {
+    const auto tile_indx_m = geom_to_tile_indx(geom_indx(m));
+    for (std::size_t f = 0; f < 2 * ndims(); f++) {
+      const Neighbor n = static_cast<Neighbor>(f);
+      std::pair<Tile, std::optional<std::size_t>> nb;
+      if (ndims() == 1) {
+        nb = neighbor_1d(m, n);
+      } else if (ndims() == 2) {
+        nb = neighbor_2d(m, n);
+      } else {
+        nb = neighbor_3d(m, n);
+      }
+
+      Face& face = faces_[6 * m + f];
+      face.mat = nb.second;
+      face.albedo = nb.first.albedo;
+      face.nb_face = static_cast<Neighbor>(f ^ 1);
+      if (face.mat) {
+        face.same_tile =
+            geom_to_tile_indx(geom_indx(face.mat.value())) == tile_indx_m;
+      }
+    }
+  }
+
+  if (symmetry_ == DiffusionSymmetry::Full) return;
+
+  // Faces on the x = x_min and y = y_min planes of the quadrant
+  for (std::size_t m = 0; m < nmats_; m++) {
+    const auto& ijk = mat_ijk_[m];
+    for (const Neighbor n : {Neighbor::XN, Neighbor::YN}) {
+      const std::size_t a = n == Neighbor::XN ? 0 : 1;
+      if (ijk[a] != 0) continue;
+
+      Face& face = faces_[6 * m + static_cast<std::size_t>(n)];
+      face = Face();
+      if (symmetry_ == DiffusionSymmetry::QuarterMirror) {
+        face.albedo = 1.;
+        continue;
+      }
+
+      // The region across the face is the rotated image of the region along
+      // the other face: mesh (0, j) sees (j, 0) across x = x_min, and mesh
+      // (i, 0) sees (0, i) across y = y_min.
+      xt::svector<std::size_t> img(ijk.begin(), ijk.begin() + ndims());
+      std::swap(img[0], img[1]);
+      face.nb_face = n == Neighbor::XN ? Neighbor::YN : Neighbor::XN;
+      face.mat = geom_to_mat_indx(img);
+      if (face.mat) {
+        face.same_tile = geom_to_tile_indx(img) ==
+                         geom_to_tile_indx(geom_indx(m));
+      } else {
+        const auto tile_indx = geom_to_tile_indx(img);
+        face.albedo =
+            tiles_.element(tile_indx.begin(), tile_indx.end()).albedo;
+      }
+    }
+  }
+}
+
 double DiffusionGeometry::form_factor(double x, double y, double z) const {
   if (ndims() == 1) return 1.;
 
@@ -1239,6 +1410,104 @@ double DiffusionGeometry::form_factor(double x, double y, double z) const {
   return tile.xs->form_factors()(j, i);
 }
 
+xt::xtensor<double, 3> DiffusionGeometry::form_factor_grid(
+    std::size_t x_shp, std::size_t y_shp,
+    const xt::xtensor<double, 1>& z) const {
+  if (x_shp == 0 || y_shp == 0) {
+    auto mssg = "Form factor shape must be at least 1 pin along x and y.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (ndims() == 1) {
+    return xt::ones<double>(
+        {x_shp * tile_dx_.size(), y_shp * tile_dy_.size(), z.size()});
+  }
+
+  if (symmetry_ == DiffusionSymmetry::QuarterRotational && x_shp != y_shp) {
+    auto mssg =
+        "Rotational symmetry requires the same number of pins along x and y.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (const auto& tile : tiles_) {
+    if (tile.xs == nullptr || tile.xs->form_factors().size() == 0) continue;
+    const auto& ff = tile.xs->form_factors();
+    if (ff.shape()[0] != y_shp || ff.shape()[1] != x_shp) {
+      auto mssg = "Tile form factors do not have the requested shape.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  // Index of the tile along z of each axial position, if in the core
+  std::vector<std::optional<std::size_t>> tz(z.size(), std::size_t{0});
+  if (ndims() == 3) {
+    for (std::size_t k = 0; k < z.size(); k++) {
+      const auto ok = z_to_k(z[k]);
+      tz[k] = ok ? std::optional<std::size_t>(
+                       geom_z_indx_to_tile_z_indx(ok.value()))
+                 : std::nullopt;
+    }
+  }
+
+  // Pin form factors of the described geometry, copied tile by tile. The
+  // rows of the form factors of a tile go from the top (y_max) to the
+  // bottom, as in form_factor.
+  const std::size_t ntx = tile_dx_.size();
+  const std::size_t nty = tile_dy_.size();
+  xt::xtensor<double, 3> ff_geom =
+      xt::ones<double>({ntx * x_shp, nty * y_shp, z.size()});
+#pragma omp parallel for
+  for (int kk = 0; kk < static_cast<int>(z.size()); kk++) {
+    const std::size_t k = static_cast<std::size_t>(kk);
+    if (tz[k].has_value() == false) continue;
+
+    for (std::size_t ti = 0; ti < ntx; ti++) {
+      for (std::size_t tj = 0; tj < nty; tj++) {
+        const Tile& tile = ndims() == 2 ? tiles_(ti, tj)
+                                        : tiles_(ti, tj, tz[k].value());
+        if (tile.xs == nullptr) continue;
+
+        const auto& ff = tile.xs->form_factors();
+        if (ff.size() == 0) continue;
+
+        for (std::size_t p = 0; p < x_shp; p++) {
+          for (std::size_t q = 0; q < y_shp; q++) {
+            ff_geom(ti * x_shp + p, tj * y_shp + q, k) = ff(y_shp - 1 - q, p);
+          }
+        }
+      }
+    }
+  }
+
+  if (symmetry_ == DiffusionSymmetry::Full) return ff_geom;
+
+  // Unfold the quadrant over the whole core, as in fold_ij
+  const std::size_t npx = ntx * x_shp;
+  const std::size_t npy = nty * y_shp;
+  xt::xtensor<double, 3> ff_out;
+  ff_out.resize({2 * npx, 2 * npy, z.size()});
+#pragma omp parallel for
+  for (int ii = 0; ii < static_cast<int>(2 * npx); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    const bool neg_x = i < npx;
+    const std::size_t p = neg_x ? npx - 1 - i : i - npx;
+    for (std::size_t j = 0; j < 2 * npy; j++) {
+      const bool neg_y = j < npy;
+      const std::size_t q = neg_y ? npy - 1 - j : j - npy;
+      const bool rotated =
+          symmetry_ == DiffusionSymmetry::QuarterRotational && neg_x != neg_y;
+      for (std::size_t k = 0; k < z.size(); k++) {
+        ff_out(i, j, k) = rotated ? ff_geom(q, p, k) : ff_geom(p, q, k);
+      }
+    }
+  }
+
+  return ff_out;
+}
+
 std::size_t DiffusionGeometry::geom_x_indx_to_tile_x_indx(std::size_t i) const {
   if (i >= nx()) {
     auto mssg = "Index along x is out of range.";
@@ -1368,4 +1637,13 @@ void DiffusionGeometry::fill_z_bounds() {
   }
 }
 
+std::string DiffusionGeometry::to_bytes() const { return save_to_bytes(*this); }
+
+std::shared_ptr<DiffusionGeometry> DiffusionGeometry::from_bytes(
+    const std::string& data) {
+  std::shared_ptr<DiffusionGeometry> out(new DiffusionGeometry());
+  load_from_bytes(data, *out);
+  return out;
+}
+
 }  // namespace scarabee
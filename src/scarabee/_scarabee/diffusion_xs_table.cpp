@@ -0,0 +1,352 @@
+#include <diffusion/diffusion_xs_table.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/threads.hpp>
+
+#include <cereal/archives/portable_binary.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace scarabee {
+
+DiffusionXSTable::DiffusionXSTable(
+    const std::vector<std::string>& params,
+    const std::vector<std::vector<double>>& grids,
+    const std::vector<std::shared_ptr<DiffusionData>>& data)
+    : params_(params), grids_(grids) {
+  if (params_.empty()) {
+    auto mssg = "A cross section table must have at least one parameter.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (grids_.size() != params_.size()) {
+    auto mssg = "Number of grids does not agree with the number of parameters.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  check_grids();
+
+  std::size_t npts = 1;
+  for (const auto& grid : grids_) npts *= grid.size();
+  if (data.size() != npts) {
+    std::stringstream mssg;
+    mssg << "Cross section table has " << data.size() << " data points, but "
+         << npts << " grid points.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  for (const auto& d : data) {
+    if (d == nullptr) {
+      auto mssg = "Cross section table data must not be None.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  // The first point sets the number of groups and the optional data, which
+  // all other points must agree with
+  const DiffusionData& first = *data.front();
+  ngroups_ = first.ngroups();
+  has_adf_ = first.adf().size() > 0;
+  has_cdf_ = first.cdf().size() > 0;
+  if (first.form_factors().size() > 0) {
+    ff_shape_.assign(first.form_factors().shape().begin(),
+                     first.form_factors().shape().end());
+  }
+
+  for (const auto& d : data) {
+    if (d->ngroups() != ngroups_) {
+      auto mssg =
+          "All cross section table data must have the same number of groups.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if ((d->adf().size() > 0) != has_adf_ ||
+        (d->cdf().size() > 0) != has_cdf_) {
+      auto mssg =
+          "Either all or none of the cross section table data must have "
+          "ADFs and CDFs.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    const auto& ff = d->form_factors();
+    const bool same_ff =
+        ff.size() > 0
+            ? std::equal(ff.shape().begin(), ff.shape().end(),
+                         ff_shape_.begin(), ff_shape_.end())
+            : ff_shape_.empty();
+    if (same_ff == false) {
+      auto mssg =
+          "Either all or none of the cross section table data must have "
+          "form factors, all with the same shape.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  table_.resize({npts, nvalues()});
+  for (std::size_t i = 0; i < npts; i++) pack(i, *data[i]);
+}
+
+void DiffusionXSTable::check_grids() const {
+  for (std::size_t p = 0; p < grids_.size(); p++) {
+    const auto& grid = grids_[p];
+    if (grid.empty()) {
+      std::stringstream mssg;
+      mssg << "The grid of parameter \"" << params_[p] << "\" is empty.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+
+    for (std::size_t i = 1; i < grid.size(); i++) {
+      if (grid[i] <= grid[i - 1]) {
+        std::stringstream mssg;
+        mssg << "The grid of parameter \"" << params_[p]
+             << "\" is not strictly increasing.";
+        spdlog::error(mssg.str());
+        throw ScarabeeException(mssg.str());
+      }
+    }
+  }
+}
+
+const std::vector<double>& DiffusionXSTable::grid(std::size_t p) const {
+  if (p >= nparams()) {
+    auto mssg = "Parameter index out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  return grids_[p];
+}
+
+std::size_t DiffusionXSTable::param_index(const std::string& name) const {
+  const auto it = std::find(params_.begin(), params_.end(), name);
+  if (it == params_.end()) {
+    std::stringstream mssg;
+    mssg << "The cross section table has no parameter \"" << name << "\".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  return static_cast<std::size_t>(it - params_.begin());
+}
+
+std::size_t DiffusionXSTable::nvalues() const {
+  std::size_t nff = ff_shape_.empty() ? 0 : 1;
+  for (const auto n : ff_shape_) nff *= n;
+  return ff_offset() + nff;
+}
+
+void DiffusionXSTable::pack(std::size_t i, const DiffusionData& data) {
+  const std::size_t NG = ngroups_;
+  const auto& xs = *data.xs();
+  double* row = &table_(i, 0);
+
+  for (std::size_t g = 0; g < NG; g++) {
+    row[g] = xs.D(g);
+    row[NG + g] = xs.Ea(g);
+    row[2 * NG + g] = xs.Ef(g);
+    row[3 * NG + g] = xs.vEf(g);
+    row[4 * NG + g] = xs.chi(g);
+    for (std::size_t gg = 0; gg < NG; gg++) {
+      row[5 * NG + g * NG + gg] = xs.Es(g, gg);
+    }
+  }
+
+  if (has_adf_) {
+    std::copy(data.adf().begin(), data.adf().end(), row + adf_offset());
+  }
+  if (has_cdf_) {
+    std::copy(data.cdf().begin(), data.cdf().end(), row + cdf_offset());
+  }
+  if (ff_shape_.empty() == false) {
+    std::copy(data.form_factors().begin(), data.form_factors().end(),
+              row + ff_offset());
+  }
+}
+
+std::shared_ptr<DiffusionData> DiffusionXSTable::unpack(
+    std::span<const double> row) const {
+  const std::size_t NG = ngroups_;
+  xt::xtensor<double, 1> D({NG}), Ea({NG}), Ef({NG}), vEf({NG}), chi({NG});
+  xt::xtensor<double, 2> Es({NG, NG});
+  for (std::size_t g = 0; g < NG; g++) {
+    D(g) = row[g];
+    Ea(g) = row[NG + g];
+    Ef(g) = row[2 * NG + g];
+    vEf(g) = row[3 * NG + g];
+    chi(g) = row[4 * NG + g];
+    for (std::size_t gg = 0; gg < NG; gg++) {
+      Es(g, gg) = row[5 * NG + g * NG + gg];
+    }
+  }
+
+  auto xs = std::make_shared<DiffusionCrossSection>(D, Ea, Es, Ef, vEf, chi);
+
+  xt::xtensor<double, 2> ff;
+  if (ff_shape_.empty() == false) {
+    ff.resize({ff_shape_[0], ff_shape_[1]});
+    std::copy_n(row.begin() + ff_offset(), ff.size(), ff.begin());
+  }
+  auto out = std::make_shared<DiffusionData>(xs, ff);
+
+  if (has_adf_) {
+    xt::xtensor<double, 2> adf({NG, 6});
+    std::copy_n(row.begin() + adf_offset(), adf.size(), adf.begin());
+    out->set_adf(adf);
+  }
+
+  if (has_cdf_) {
+    xt::xtensor<double, 2> cdf({NG, 4});
+    std::copy_n(row.begin() + cdf_offset(), cdf.size(), cdf.begin());
+    out->set_cdf(cdf);
+  }
+
+  return out;
+}
+
+void DiffusionXSTable::interpolate_row(std::span<const double> state,
+                                       std::span<double> row) const {
+  const std::size_t NP = nparams();
+  if (state.size() != NP) {
+    std::stringstream mssg;
+    mssg << "State has " << state.size() << " values, but the cross section "
+         << "table has " << NP << " parameters.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  // Lower grid index and weight of the upper point along each parameter.
+  // The stride of the last parameter is one.
+  std::vector<std::size_t> lo(NP), stride(NP);
+  std::vector<double> t(NP);
+  std::size_t s = 1;
+  for (std::size_t p = NP; p-- > 0;) {
+    const auto& grid = grids_[p];
+    stride[p] = s;
+    s *= grid.size();
+
+    lo[p] = 0;
+    t[p] = 0.;
+    if (grid.size() == 1) continue;
+
+    const double x = std::clamp(state[p], grid.front(), grid.back());
+    const auto it = std::upper_bound(grid.begin(), grid.end(), x);
+    lo[p] = std::min(static_cast<std::size_t>(it - grid.begin()),
+                     grid.size() - 1) -
+            1;
+    t[p] = (x - grid[lo[p]]) / (grid[lo[p] + 1] - grid[lo[p]]);
+  }
+
+  // Weighted sum over the corners of the grid cell, skipping the corners
+  // with no weight, such as those across a clamped bound
+  std::fill(row.begin(), row.end(), 0.);
+  const std::size_t ncorners = std::size_t{1} << NP;
+  for (std::size_t c = 0; c < ncorners; c++) {
+    double w = 1.;
+    std::size_t indx = 0;
+    for (std::size_t p = 0; p < NP; p++) {
+      const bool upper = (c >> p) & 1;
+      w *= upper ? t[p] : 1. - t[p];
+      indx += (lo[p] + (upper ? 1 : 0)) * stride[p];
+    }
+    if (w == 0.) continue;
+
+    const double* pt = &table_(indx, 0);
+    for (std::size_t v = 0; v < row.size(); v++) row[v] += w * pt[v];
+  }
+}
+
+std::shared_ptr<DiffusionData> DiffusionXSTable::interpolate(
+    std::span<const double> state) const {
+  std::vector<double> row(nvalues());
+  interpolate_row(state, row);
+  return unpack(row);
+}
+
+std::vector<std::shared_ptr<DiffusionData>> DiffusionXSTable::interpolate(
+    const xt::xtensor<double, 2>& states) const {
+  const std::size_t NS = states.shape()[0];
+  if (NS > 0 && states.shape()[1] != nparams()) {
+    std::stringstream mssg;
+    mssg << "States have " << states.shape()[1]
+         << " values, but the cross section table has " << nparams()
+         << " parameters.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  std::vector<std::shared_ptr<DiffusionData>> out(NS);
+  const std::size_t NV = nvalues();
+  parallel_for_each_index(NS, [&](std::size_t i) {
+    std::vector<double> row(NV);
+    interpolate_row(std::span<const double>(&states(i, 0), nparams()), row);
+    out[i] = unpack(row);
+  });
+
+  return out;
+}
+
+void DiffusionXSTable::update_geometry(
+    DiffusionGeometry& geom, const std::vector<std::vector<std::size_t>>& tiles,
+    const xt::xtensor<double, 2>& states) const {
+  if (tiles.size() != states.shape()[0]) {
+    auto mssg = "The number of tiles and states are not the same.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  geom.set_tiles_xs(tiles, interpolate(states));
+}
+
+std::string DiffusionXSTable::to_bytes() const { return save_to_bytes(*this); }
+
+std::shared_ptr<DiffusionXSTable> DiffusionXSTable::from_bytes(
+    const std::string& data) {
+  std::shared_ptr<DiffusionXSTable> out(new DiffusionXSTable());
+  load_from_bytes(data, *out);
+  return out;
+}
+
+void DiffusionXSTable::save(const std::string& fname) const {
+  if (std::filesystem::exists(fname)) {
+    std::filesystem::remove(fname);
+  }
+
+  std::ofstream file(fname, std::ios_base::binary);
+
+  cereal::PortableBinaryOutputArchive arc(file);
+
+  arc(*this);
+}
+
+std::shared_ptr<DiffusionXSTable> DiffusionXSTable::load(
+    const std::string& fname) {
+  if (std::filesystem::exists(fname) == false) {
+    std::stringstream mssg;
+    mssg << "The file \"" << fname << "\" does not exist.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  std::shared_ptr<DiffusionXSTable> out(new DiffusionXSTable());
+
+  std::ifstream file(fname, std::ios_base::binary);
+
+  cereal::PortableBinaryInputArchive arc(file);
+
+  arc(*out);
+
+  return out;
+}
+
+}  // namespace scarabee
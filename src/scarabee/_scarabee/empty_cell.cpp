@@ -24,6 +24,8 @@ EmptyCell::EmptyCell(const std::shared_ptr<CrossSection>& mat, double dx,
   fsrs_.back().tokens().push_back({x_max_, Surface::Side::Negative});
   fsrs_.back().tokens().push_back({y_min_, Surface::Side::Positive});
   fsrs_.back().tokens().push_back({y_max_, Surface::Side::Negative});
+
+  this->build_fsr_index();
 }
 
 }  // namespace scarabee
@@ -0,0 +1,40 @@
+#include <utils/exp_table.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <cmath>
+
+namespace scarabee {
+
+ExpTable::ExpTable(double max_error)
+    : max_error_(max_error), x_max_(), invs_dx_(), coeffs_() {
+  if (max_error_ <= 0. || max_error_ >= 0.1) {
+    const auto mssg = "Exponential table maximum error must be in (0, 0.1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Past x_max, 1 - exp(-x) is within max_error of 1
+  x_max_ = -std::log(max_error_);
+
+  // The error of linear interpolation is bounded by dx^2 max|f''| / 8, with
+  // |f''(x)| = exp(-x) <= 1.
+  const double dx_max = std::sqrt(8. * max_error_);
+  const std::size_t n = static_cast<std::size_t>(std::ceil(x_max_ / dx_max));
+  const double dx = x_max_ / static_cast<double>(n);
+  invs_dx_ = 1. / dx;
+
+  // One extra interval guards against round off in the index for x ~ x_max
+  coeffs_.resize(2 * (n + 1));
+  for (std::size_t i = 0; i <= n; i++) {
+    const double x0 = static_cast<double>(i) * dx;
+    const double x1 = x0 + dx;
+    const double f0 = 1. - std::exp(-x0);
+    const double f1 = 1. - std::exp(-x1);
+    const double slope = (f1 - f0) * invs_dx_;
+    coeffs_[2 * i] = slope;
+    coeffs_[2 * i + 1] = f0 - slope * x0;
+  }
+}
+
+}  // namespace scarabee
@@ -2,34 +2,41 @@
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/timer.hpp>
+#include <utils/profiler.hpp>
+#include <utils/sparse_pattern.hpp>
 
 #include <Eigen/Sparse>
 #include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseLU>
 
 #include <cereal/archives/portable_binary.hpp>
 
+#include <array>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <memory>
 #include <sstream>
+#include <tuple>
 #include "utils/simulation_mode.hpp"
 
 namespace scarabee {
 
-void set_x_current_diff(DiffusionGeometry& geom,
-                        Eigen::SparseMatrix<double, Eigen::RowMajor>& M,
+// Calls add(column, value) for the streaming terms in the x direction of
+// the row of group g and material tile m
+template <typename Add>
+void set_x_current_diff(const DiffusionGeometry& geom, const Add& add,
                         const std::size_t g, const std::size_t m) {
   // Get material index
-  const auto indxs = geom.geom_indx(m);
+  const auto& indxs = geom.mat_ijk(m);
 
   // Get our left and right neighbors info
-  DiffusionGeometry::Tile tile_mm1, tile_mp1;
-  std::optional<std::size_t> op_mm1, op_mp1;
-
-  std::tie(tile_mm1, op_mm1) =
-      geom.neighbor(m, DiffusionGeometry::Neighbor::XN);
-  std::tie(tile_mp1, op_mp1) =
-      geom.neighbor(m, DiffusionGeometry::Neighbor::XP);
+  const auto& face_mm1 = geom.face(m, DiffusionGeometry::Neighbor::XN);
+  const auto& face_mp1 = geom.face(m, DiffusionGeometry::Neighbor::XP);
+  const std::optional<std::size_t>& op_mm1 = face_mm1.mat;
+  const std::optional<std::size_t>& op_mp1 = face_mp1.mat;
 
   // Get parameters for the tile in question
   const double D_m = geom.mat(m)->D(g);
@@ -51,12 +58,12 @@ void set_x_current_diff(DiffusionGeometry& geom,
     const double D_mp1 = geom.mat(mp1)->D(g);
 
     // Get widths
-    const double dx_mm1 = geom.dx(indxs[0] - 1);
-    const double dx_mp1 = geom.dx(indxs[0] + 1);
+    const double dx_mm1 = geom.width(mm1, face_mm1.nb_face);
+    const double dx_mp1 = geom.width(mp1, face_mp1.nb_face);
 
     // Get discontinuity factors
-    const double f_mp = geom.adf_xp(mm1, g);
-    const double f_pm = geom.adf_xn(mp1, g);
+    const double f_mp = geom.adf(mm1, face_mm1.nb_face, g);
+    const double f_pm = geom.adf(mp1, face_mp1.nb_face, g);
     const double r_p = f_p / f_pm;
     const double r_m = f_m / f_mp;
 
@@ -72,51 +79,51 @@ void set_x_current_diff(DiffusionGeometry& geom,
     const double b = -(r_p * a + r_m * c);                   // for flux m
 
     // Set matrix components
-    M.coeffRef(m + g * geom.nmats(), mp1 + g * geom.nmats()) += a;
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
-    M.coeffRef(m + g * geom.nmats(), mm1 + g * geom.nmats()) += c;
+    add(mp1 + g * geom.nmats(), a);
+    add(m + g * geom.nmats(), b);
+    add(mm1 + g * geom.nmats(), c);
   } else if (op_mm1) {
     // Boundary condition on the right
     const std::size_t mm1 = op_mm1.value();
     const double D_mm1 = geom.mat(mm1)->D(g);
-    const double dx_mm1 = geom.dx(indxs[0] - 1);
+    const double dx_mm1 = geom.width(mm1, face_mm1.nb_face);
     const double d_mm1 = D_mm1 / dx_mm1;
 
     // Get discontinuity factors
-    const double f_mp = geom.adf_xp(mm1, g);
+    const double f_mp = geom.adf(mm1, face_mm1.nb_face, g);
     const double r_m = f_m / f_mp;
 
     const double c =
         -(2. / dx_m) * (d_m * d_mm1 / (d_m + r_m * d_mm1));  // for flux m-1
-    const double alb = tile_mp1.albedo.value();
+    const double alb = face_mp1.albedo.value();
     const double R = (1. - alb) / (1. + alb);
     const double b =
         -r_m * c + (2. * d_m * R / (dx_m * (4. * d_m + R)));  // for flux m
     // const double b = -c + (2.*d_m/dx_m); // for zero flux at boundary
 
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
-    M.coeffRef(m + g * geom.nmats(), mm1 + g * geom.nmats()) += c;
+    add(m + g * geom.nmats(), b);
+    add(mm1 + g * geom.nmats(), c);
   } else if (op_mp1) {
     // Boundary condition on the left
     const std::size_t mp1 = op_mp1.value();
     const double D_mp1 = geom.mat(mp1)->D(g);
-    const double dx_mp1 = geom.dx(indxs[0] + 1);
+    const double dx_mp1 = geom.width(mp1, face_mp1.nb_face);
     const double d_mp1 = D_mp1 / dx_mp1;
 
     // Get discontinuity factors
-    const double f_pm = geom.adf_xn(mp1, g);
+    const double f_pm = geom.adf(mp1, face_mp1.nb_face, g);
     const double r_p = f_p / f_pm;
 
     const double a =
         -(2. / dx_m) * (d_m * d_mp1 / (d_m + r_p * d_mp1));  // for flux m+1
-    const double alb = tile_mm1.albedo.value();
+    const double alb = face_mm1.albedo.value();
     const double R = (1. - alb) / (1. + alb);
     const double b =
         -r_p * a + (2. * d_m * R / (dx_m * (4. * d_m + R)));  // for flux m
     // const double b = -a + (2.*d_m/dx_m); // for zero flux at boundary
 
-    M.coeffRef(m + g * geom.nmats(), mp1 + g * geom.nmats()) += a;
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
+    add(mp1 + g * geom.nmats(), a);
+    add(m + g * geom.nmats(), b);
   } else {
     // Both sides are boundary conditions. Nothing we can do here.
     std::stringstream mssg;
@@ -126,20 +133,19 @@ void set_x_current_diff(DiffusionGeometry& geom,
   }
 }
 
-void set_y_current_diff(DiffusionGeometry& geom,
-                        Eigen::SparseMatrix<double, Eigen::RowMajor>& M,
+// Calls add(column, value) for the streaming terms in the y direction of
+// the row of group g and material tile m
+template <typename Add>
+void set_y_current_diff(const DiffusionGeometry& geom, const Add& add,
                         const std::size_t g, const std::size_t m) {
   // Get material index
-  const auto indxs = geom.geom_indx(m);
+  const auto& indxs = geom.mat_ijk(m);
 
   // Get our left and right neighbors info
-  DiffusionGeometry::Tile tile_mm1, tile_mp1;
-  std::optional<std::size_t> op_mm1, op_mp1;
-
-  std::tie(tile_mm1, op_mm1) =
-      geom.neighbor(m, DiffusionGeometry::Neighbor::YN);
-  std::tie(tile_mp1, op_mp1) =
-      geom.neighbor(m, DiffusionGeometry::Neighbor::YP);
+  const auto& face_mm1 = geom.face(m, DiffusionGeometry::Neighbor::YN);
+  const auto& face_mp1 = geom.face(m, DiffusionGeometry::Neighbor::YP);
+  const std::optional<std::size_t>& op_mm1 = face_mm1.mat;
+  const std::optional<std::size_t>& op_mp1 = face_mp1.mat;
 
   // Get parameters for the tile in question
   const double D_m = geom.mat(m)->D(g);
@@ -161,12 +167,12 @@ void set_y_current_diff(DiffusionGeometry& geom,
     const double D_mp1 = geom.mat(mp1)->D(g);
 
     // Get widths
-    const double dy_mm1 = geom.dy(indxs[1] - 1);
-    const double dy_mp1 = geom.dy(indxs[1] + 1);
+    const double dy_mm1 = geom.width(mm1, face_mm1.nb_face);
+    const double dy_mp1 = geom.width(mp1, face_mp1.nb_face);
 
     // Get discontinuity factors
-    const double f_mp = geom.adf_yp(mm1, g);
-    const double f_pm = geom.adf_yn(mp1, g);
+    const double f_mp = geom.adf(mm1, face_mm1.nb_face, g);
+    const double f_pm = geom.adf(mp1, face_mp1.nb_face, g);
     const double r_p = f_p / f_pm;
     const double r_m = f_m / f_mp;
 
@@ -182,51 +188,51 @@ void set_y_current_diff(DiffusionGeometry& geom,
     const double b = -(r_p * a + r_m * c);                   // for flux m
 
     // Set matrix components
-    M.coeffRef(m + g * geom.nmats(), mp1 + g * geom.nmats()) += a;
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
-    M.coeffRef(m + g * geom.nmats(), mm1 + g * geom.nmats()) += c;
+    add(mp1 + g * geom.nmats(), a);
+    add(m + g * geom.nmats(), b);
+    add(mm1 + g * geom.nmats(), c);
   } else if (op_mm1) {
     // Boundary condition on the right
     const std::size_t mm1 = op_mm1.value();
     const double D_mm1 = geom.mat(mm1)->D(g);
-    const double dy_mm1 = geom.dy(indxs[1] - 1);
+    const double dy_mm1 = geom.width(mm1, face_mm1.nb_face);
     const double d_mm1 = D_mm1 / dy_mm1;
 
     // Get discontinuity factors
-    const double f_mp = geom.adf_yp(mm1, g);
+    const double f_mp = geom.adf(mm1, face_mm1.nb_face, g);
     const double r_m = f_m / f_mp;
 
     const double c =
         -(2. / dy_m) * (d_m * d_mm1 / (d_m + r_m * d_mm1));  // for flux m-1
-    const double alb = tile_mp1.albedo.value();
+    const double alb = face_mp1.albedo.value();
     const double R = (1. - alb) / (1. + alb);
     const double b =
         -r_m * c + (2. * d_m * R / (dy_m * (4. * d_m + R)));  // for flux m
     // const double b = -c + (2.*d_m/dy_m); // for zero flux at boundary
 
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
-    M.coeffRef(m + g * geom.nmats(), mm1 + g * geom.nmats()) += c;
+    add(m + g * geom.nmats(), b);
+    add(mm1 + g * geom.nmats(), c);
   } else if (op_mp1) {
     // Boundary condition on the left
     const std::size_t mp1 = op_mp1.value();
     const double D_mp1 = geom.mat(mp1)->D(g);
-    const double dy_mp1 = geom.dy(indxs[1] + 1);
+    const double dy_mp1 = geom.width(mp1, face_mp1.nb_face);
     const double d_mp1 = D_mp1 / dy_mp1;
 
     // Get discontinuity factors
-    const double f_pm = geom.adf_yn(mp1, g);
+    const double f_pm = geom.adf(mp1, face_mp1.nb_face, g);
     const double r_p = f_p / f_pm;
 
     const double a =
         -(2. / dy_m) * (d_m * d_mp1 / (d_m + r_p * d_mp1));  // for flux m+1
-    const double alb = tile_mm1.albedo.value();
+    const double alb = face_mm1.albedo.value();
     const double R = (1. - alb) / (1. + alb);
     const double b =
         -r_p * a + (2. * d_m * R / (dy_m * (4. * d_m + R)));  // for flux m
     // const double b = -a + (2.*d_m/dy_m); // for zero flux at boundary
 
-    M.coeffRef(m + g * geom.nmats(), mp1 + g * geom.nmats()) += a;
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
+    add(mp1 + g * geom.nmats(), a);
+    add(m + g * geom.nmats(), b);
   } else {
     // Both sides are boundary conditions. Nothing we can do here.
     std::stringstream mssg;
@@ -236,20 +242,19 @@ void set_y_current_diff(DiffusionGeometry& geom,
   }
 }
 
-void set_z_current_diff(DiffusionGeometry& geom,
-                        Eigen::SparseMatrix<double, Eigen::RowMajor>& M,
+// Calls add(column, value) for the streaming terms in the z direction of
+// the row of group g and material tile m
+template <typename Add>
+void set_z_current_diff(const DiffusionGeometry& geom, const Add& add,
                         const std::size_t g, const std::size_t m) {
   // Get material index
-  const auto indxs = geom.geom_indx(m);
+  const auto& indxs = geom.mat_ijk(m);
 
   // Get our left and right neighbors info
-  DiffusionGeometry::Tile tile_mm1, tile_mp1;
-  std::optional<std::size_t> op_mm1, op_mp1;
-
-  std::tie(tile_mm1, op_mm1) =
-      geom.neighbor(m, DiffusionGeometry::Neighbor::ZN);
-  std::tie(tile_mp1, op_mp1) =
-      geom.neighbor(m, DiffusionGeometry::Neighbor::ZP);
+  const auto& face_mm1 = geom.face(m, DiffusionGeometry::Neighbor::ZN);
+  const auto& face_mp1 = geom.face(m, DiffusionGeometry::Neighbor::ZP);
+  const std::optional<std::size_t>& op_mm1 = face_mm1.mat;
+  const std::optional<std::size_t>& op_mp1 = face_mp1.mat;
 
   // Get parameters for the tile in question
   const double D_m = geom.mat(m)->D(g);
@@ -271,12 +276,12 @@ void set_z_current_diff(DiffusionGeometry& geom,
     const double D_mp1 = geom.mat(mp1)->D(g);
 
     // Get widths
-    const double dz_mm1 = geom.dz(indxs[2] - 1);
-    const double dz_mp1 = geom.dz(indxs[2] + 1);
+    const double dz_mm1 = geom.width(mm1, face_mm1.nb_face);
+    const double dz_mp1 = geom.width(mp1, face_mp1.nb_face);
 
     // Get discontinuity factors
-    const double f_mp = geom.adf_zp(mm1, g);
-    const double f_pm = geom.adf_zn(mp1, g);
+    const double f_mp = geom.adf(mm1, face_mm1.nb_face, g);
+    const double f_pm = geom.adf(mp1, face_mp1.nb_face, g);
     const double r_p = f_p / f_pm;
     const double r_m = f_m / f_mp;
 
@@ -292,51 +297,51 @@ void set_z_current_diff(DiffusionGeometry& geom,
     const double b = -(r_p * a + r_m * c);                   // for flux m
 
     // Set matrix components
-    M.coeffRef(m + g * geom.nmats(), mp1 + g * geom.nmats()) += a;
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
-    M.coeffRef(m + g * geom.nmats(), mm1 + g * geom.nmats()) += c;
+    add(mp1 + g * geom.nmats(), a);
+    add(m + g * geom.nmats(), b);
+    add(mm1 + g * geom.nmats(), c);
   } else if (op_mm1) {
     // Boundary condition on the right
     const std::size_t mm1 = op_mm1.value();
     const double D_mm1 = geom.mat(mm1)->D(g);
-    const double dz_mm1 = geom.dz(indxs[2] - 1);
+    const double dz_mm1 = geom.width(mm1, face_mm1.nb_face);
     const double d_mm1 = D_mm1 / dz_mm1;
 
     // Get discontinuity factors
-    const double f_mp = geom.adf_zp(mm1, g);
+    const double f_mp = geom.adf(mm1, face_mm1.nb_face, g);
     const double r_m = f_m / f_mp;
 
     const double c =
         -(2. / dz_m) * (d_m * d_mm1 / (d_m + r_m * d_mm1));  // for flux m-1
-    const double alb = tile_mp1.albedo.value();
+    const double alb = face_mp1.albedo.value();
     const double R = (1. - alb) / (1. + alb);
     const double b =
         -r_m * c + (2. * d_m * R / (dz_m * (4. * d_m + R)));  // for flux m
     // const double b = -c + (2.*d_m/dy_m); // for zero flux at boundary
 
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
-    M.coeffRef(m + g * geom.nmats(), mm1 + g * geom.nmats()) += c;
+    add(m + g * geom.nmats(), b);
+    add(mm1 + g * geom.nmats(), c);
   } else if (op_mp1) {
     // Boundary condition on the left
     const std::size_t mp1 = op_mp1.value();
     const double D_mp1 = geom.mat(mp1)->D(g);
-    const double dz_mp1 = geom.dz(indxs[2] + 1);
+    const double dz_mp1 = geom.width(mp1, face_mp1.nb_face);
     const double d_mp1 = D_mp1 / dz_mp1;
 
     // Get discontinuity factors
-    const double f_pm = geom.adf_zn(mp1, g);
+    const double f_pm = geom.adf(mp1, face_mp1.nb_face, g);
     const double r_p = f_p / f_pm;
 
     const double a =
         -(2. / dz_m) * (d_m * d_mp1 / (d_m + r_p * d_mp1));  // for flux m+1
-    const double alb = tile_mm1.albedo.value();
+    const double alb = face_mm1.albedo.value();
     const double R = (1. - alb) / (1. + alb);
     const double b =
         -r_p * a + (2. * d_m * R / (dz_m * (4. * d_m + R)));  // for flux m
     // const double b = -a + (2.*d_m/dz_m); // for zero flux at boundary
 
-    M.coeffRef(m + g * geom.nmats(), mp1 + g * geom.nmats()) += a;
-    M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += b;
+    add(mp1 + g * geom.nmats(), a);
+    add(m + g * geom.nmats(), b);
   } else {
     // Both sides are boundary conditions. Nothing we can do here.
     std::stringstream mssg;
@@ -346,70 +351,169 @@ void set_z_current_diff(DiffusionGeometry& geom,
   }
 }
 
-void load_loss_matrix(DiffusionGeometry& geom,
-                      Eigen::SparseMatrix<double, Eigen::RowMajor>& M) {
-  const std::size_t NMATS = geom.nmats();
-  const std::size_t NGRPS = geom.ngroups();
+// Calls add(column, value) for the streaming terms in all directions of the
+// row of group g and material tile m
+template <typename Add>
+void set_current_diff(const DiffusionGeometry& geom, const Add& add,
+                      const std::size_t g, const std::size_t m) {
+  set_x_current_diff(geom, add, g, m);
 
-  // Allocate M
-  M.resize(NGRPS * NMATS, NGRPS * NMATS);
+  if (geom.ndims() > 1) set_y_current_diff(geom, add, g, m);
 
-  if (geom.ndims() == 1) {
-    M.reserve(Eigen::VectorX<std::size_t>::Constant(NGRPS * NMATS, 2 + NGRPS));
-  } else if (geom.ndims() == 2) {
-    M.reserve(Eigen::VectorX<std::size_t>::Constant(NGRPS * NMATS, 4 + NGRPS));
-  } else {
-    M.reserve(Eigen::VectorX<std::size_t>::Constant(NGRPS * NMATS, 6 + NGRPS));
-  }
+  if (geom.ndims() > 2) set_z_current_diff(geom, add, g, m);
+}
 
-  for (std::size_t m = 0; m < geom.nmats(); m++) {
-    const auto& mat = geom.mat(m);
-    for (std::size_t g = 0; g < geom.ngroups(); g++) {
-      set_x_current_diff(geom, M, g, m);
+void load_loss_matrix(const DiffusionGeometry& geom,
+                      Eigen::SparseMatrix<double, Eigen::RowMajor>& M,
+                      SparsePattern& pattern) {
+  const std::size_t NMATS = geom.nmats();
+  const std::size_t NGRPS = geom.ngroups();
 
-      if (geom.ndims() > 1) set_y_current_diff(geom, M, g, m);
+  // Fills row m + g * NMATS of M
+  const auto fill_row = [&](std::size_t r, const auto& add) {
+    const std::size_t m = r % NMATS;
+    const std::size_t g = r / NMATS;
+    const auto& mat = geom.mat(m);
 
-      if (geom.ndims() > 2) set_z_current_diff(geom, M, g, m);
+    set_current_diff(geom, add, g, m);
 
-      // Get removal xs for m
-      const double Er = mat->Er(g);
+    // Get removal xs for m
+    const double Er = mat->Er(g);
 
-      // Add removal xs along the diagonal
-      M.coeffRef(m + g * geom.nmats(), m + g * geom.nmats()) += Er;
+    // Add removal xs along the diagonal
+    add(r, Er);
 
-      // Remove scattering sources
-      for (std::size_t gg = 0; gg < geom.ngroups(); gg++) {
-        if (gg != g) {
-          M.coeffRef(m + g * geom.nmats(), m + gg * geom.nmats()) -=
-              mat->Es(gg, g);
-        }
+    // Remove scattering sources
+    for (std::size_t gg = 0; gg < NGRPS; gg++) {
+      if (gg != g) {
+        add(m + gg * NMATS, -mat->Es(gg, g));
       }
     }
-  }
-  M.makeCompressed();
+  };
+
+  pattern.assemble(M, NGRPS * NMATS, 1, fill_row);
 }
 
 void load_source_matrix(const DiffusionGeometry& geom,
-                        Eigen::SparseMatrix<double, Eigen::RowMajor>& QM) {
+                        Eigen::SparseMatrix<double, Eigen::RowMajor>& QM,
+                        SparsePattern& pattern) {
   const std::size_t NMATS = geom.nmats();
   const std::size_t NGRPS = geom.ngroups();
 
-  QM.resize(NGRPS * NMATS, NGRPS * NMATS);
-  QM.reserve(Eigen::VectorX<std::size_t>::Constant(NGRPS * NMATS, NGRPS));
-
-  for (std::size_t m = 0; m < NMATS; m++) {
+  // Fills row m + g * NMATS of QM
+  const auto fill_row = [&](std::size_t r, const auto& add) {
+    const std::size_t m = r % NMATS;
+    const std::size_t g = r / NMATS;
     const DiffusionData& xs = *geom.mat(m);
+    const double chi_g = xs.chi(g);
 
-    for (std::size_t g = 0; g < NGRPS; g++) {
-      const double chi_g = xs.chi(g);
+    for (std::size_t gg = 0; gg < NGRPS; gg++) {
+      add(m + gg * NMATS, chi_g * xs.vEf(gg));
+    }
+  };
+
+  pattern.assemble(QM, NGRPS * NMATS, 1, fill_row);
+}
 
-      for (std::size_t gg = 0; gg < NGRPS; gg++) {
-        QM.coeffRef(m + g * NMATS, m + gg * NMATS) = chi_g * xs.vEf(gg);
+void load_operator(const DiffusionGeometry& geom, FDOperator& op) {
+  op.build(geom, [&geom](std::size_t g, std::size_t m, const auto& add) {
+    set_current_diff(geom, add, g, m);
+  });
+}
+
+// Coarsens a row of cells, given the block of each cell, by merging pairs of
+// neighboring cells of the same block. Once each block only holds a single
+// cell, pairs of blocks are merged instead. Returns the coarse cell of each
+// cell, and replaces blocks by the blocks of the coarse cells.
+std::vector<std::size_t> coarsen_axis(std::vector<std::size_t>& blocks) {
+  bool single_cells = true;
+  for (std::size_t i = 1; i < blocks.size(); i++) {
+    if (blocks[i] == blocks[i - 1]) single_cells = false;
+  }
+  if (single_cells) {
+    for (std::size_t i = 0; i < blocks.size(); i++) blocks[i] = i / 2;
+  }
+
+  std::vector<std::size_t> coarse_cell(blocks.size());
+  std::vector<std::size_t> coarse_blocks;
+  std::size_t p = 0;  // Position of the cell in its block
+  for (std::size_t i = 0; i < blocks.size(); i++) {
+    if (i == 0 || blocks[i] != blocks[i - 1]) p = 0;
+    if (p % 2 == 0) coarse_blocks.push_back(blocks[i]);
+    coarse_cell[i] = coarse_blocks.size() - 1;
+    p++;
+  }
+
+  blocks = coarse_blocks;
+  return coarse_cell;
+}
+
+// Aggregates of the multigrid levels. The mesh cells are first merged in
+// pairs along each axis inside of each tile, so that the coarse unknowns do
+// not straddle two materials until the tile level is reached. The tiles are
+// then merged in the same manner, until the coarsest level is small enough to
+// be factorized.
+MultigridPreconditioner::Aggregates multigrid_aggregates(
+    const DiffusionGeometry& geom) {
+  constexpr std::size_t MAX_COARSE_SIZE = 1000;
+  const std::size_t ndims = geom.ndims();
+
+  // The blocks of each axis are initially the tiles
+  const std::array<const std::vector<std::size_t>*, 3> divs{
+      &geom.x_divs_per_tile(), &geom.y_divs_per_tile(),
+      &geom.z_divs_per_tile()};
+  std::array<std::vector<std::size_t>, 3> blocks;
+  for (std::size_t d = 0; d < 3; d++) {
+    if (d >= ndims) {
+      blocks[d] = {0};
+      continue;
+    }
+    for (std::size_t t = 0; t < divs[d]->size(); t++) {
+      blocks[d].insert(blocks[d].end(), (*divs[d])[t], t);
+    }
+  }
+
+  // Cell of each unknown on the current level
+  std::vector<std::array<std::size_t, 3>> cells(geom.nmats(), {0, 0, 0});
+  for (std::size_t m = 0; m < geom.nmats(); m++) {
+    cells[m] = geom.mat_ijk(m);
+  }
+
+  MultigridPreconditioner::Aggregates aggregates;
+  while (cells.size() > MAX_COARSE_SIZE) {
+    std::array<std::vector<std::size_t>, 3> coarse_cell;
+    for (std::size_t d = 0; d < 3; d++) {
+      coarse_cell[d] = coarsen_axis(blocks[d]);
+    }
+    const std::size_t nx = blocks[0].size();
+    const std::size_t ny = blocks[1].size();
+    const std::size_t nz = blocks[2].size();
+
+    // Coarse cells which hold no unknown (e.g. albedo tiles) are skipped
+    constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> cell_unknown(nx * ny * nz, NONE);
+    std::vector<std::array<std::size_t, 3>> coarse_cells;
+    std::vector<std::size_t> agg(cells.size());
+    for (std::size_t u = 0; u < cells.size(); u++) {
+      const std::array<std::size_t, 3> c{coarse_cell[0][cells[u][0]],
+                                         coarse_cell[1][cells[u][1]],
+                                         coarse_cell[2][cells[u][2]]};
+      const std::size_t flat = (c[2] * ny + c[1]) * nx + c[0];
+      if (cell_unknown[flat] == NONE) {
+        cell_unknown[flat] = coarse_cells.size();
+        coarse_cells.push_back(c);
       }
+      agg[u] = cell_unknown[flat];
     }
+
+    // The mesh can not be coarsened any further
+    if (coarse_cells.size() == cells.size()) break;
+
+    aggregates.push_back(std::move(agg));
+    cells = std::move(coarse_cells);
   }
 
-  QM.makeCompressed();
+  return aggregates;
 }
 
 FDDiffusionDriver::FDDiffusionDriver(std::shared_ptr<DiffusionGeometry> geom)
@@ -459,6 +563,16 @@ void FDDiffusionDriver::set_keff_tolerance(double ktol) {
   keff_tol_ = ktol;
 }
 
+void FDDiffusionDriver::set_upscatter_iterations(std::size_t niters) {
+  if (niters == 0) {
+    auto mssg = "Number of upscatter iterations must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  upscatter_iterations_ = niters;
+}
+
 double FDDiffusionDriver::flux(std::size_t i, std::size_t g) const {
   if (geom_->ndims() != 1) {
     std::stringstream mssg;
@@ -796,16 +910,33 @@ void FDDiffusionDriver::set_extern_src(std::size_t i, std::size_t j,
 void FDDiffusionDriver::power_iteration() {
   Timer sim_timer;
   sim_timer.start();
+  telemetry_.clear();
 
   spdlog::info("Solving for keff.");
   spdlog::info("keff tolerance: {:.5E}", keff_tol_);
   spdlog::info("Flux tolerance: {:.5E}", flux_tol_);
 
-  // First, we create our loss matrix
-  Eigen::SparseMatrix<double, Eigen::RowMajor> M;
+  // The previous solution is the initial guess of a warm start
+  if (warm_start_ && solved_) {
+    spdlog::info("Starting from the previous solution.");
+  } else {
+    flux_.fill(1.);
+    keff_ = 1.;
+  }
 
-  // Load the loss matrix
-  load_loss_matrix(*geom_, M);
+  // First, we create our loss matrix
+  Timer assembly_timer;
+  assembly_timer.start();
+  const bool matrix_free = linear_solver_ == FDLinearSolver::MatrixFree;
+  if (matrix_free) {
+    load_operator(*geom_, op_);
+    op_.set_fixed_source(false);
+    release_matrices();
+  } else {
+    // Load the loss matrix. Its pattern is kept from the previous solve.
+    load_loss_matrix(*geom_, M_, M_pattern_);
+    op_ = FDOperator();
+  }
 
   // Initialize flux and source vectors
   Eigen::VectorXd new_flux(geom_->ngroups() * geom_->nmats());
@@ -824,20 +955,29 @@ void FDDiffusionDriver::power_iteration() {
   }
 
   // Initialize a vector for computing the source vector Q faster
-  Eigen::SparseMatrix<double, Eigen::RowMajor> QM;
-  load_source_matrix(*geom_, QM);
+  if (matrix_free == false) load_source_matrix(*geom_, QM_, QM_pattern_);
 
   // Create a solver for the problem
   spdlog::info("Initializing iterative solver");
   Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>> solver;
-  solver.compute(M);
-  solver.setTolerance(1.E-8);
-  if (solver.info() != Eigen::Success) {
-    std::stringstream mssg;
-    mssg << "Could not initialize iterative solver";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
+  Eigen::BiCGSTAB<FDOperator, FDOperator::Jacobi> mf_solver;
+  if (linear_solver_ == FDLinearSolver::BiCGSTAB) {
+    solver.compute(M_);
+    solver.setTolerance(1.E-8);
+    if (solver.info() != Eigen::Success) {
+      std::stringstream mssg;
+      mssg << "Could not initialize iterative solver";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  } else if (matrix_free) {
+    mf_solver.compute(op_);
+    mf_solver.setTolerance(1.E-8);
+  } else {
+    prepare_group_systems();
   }
+  assembly_timer.stop();
+  telemetry_.add_time("assembly", assembly_timer.elapsed_time());
 
   // Begin power iteration
   double keff_diff = 100.;
@@ -850,10 +990,31 @@ void FDDiffusionDriver::power_iteration() {
     iteration++;
 
     // Compute source vector
-    Q = (1. / keff_) * QM * flux_;
+    if (matrix_free) {
+      op_.fission(flux_, Q);
+      Q *= 1. / keff_;
+    } else {
+      Q = (1. / keff_) * QM_ * flux_;
+    }
 
     // Get new flux
-    new_flux = solver.solveWithGuess(Q, flux_);
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "linear_solve");
+      if (linear_solver_ == FDLinearSolver::BiCGSTAB) {
+        new_flux = solver.solveWithGuess(Q, flux_);
+        telemetry_.add_count("linear_iterations",
+                             static_cast<std::size_t>(solver.iterations()));
+      } else if (matrix_free) {
+        new_flux = mf_solver.solveWithGuess(Q, flux_);
+        telemetry_.add_count(
+            "linear_iterations",
+            static_cast<std::size_t>(mf_solver.iterations()));
+      } else {
+        new_flux = flux_;
+        telemetry_.add_count("linear_iterations",
+                             group_gauss_seidel(Q, new_flux));
+      }
+    }
     // For some reason, this doesn't seem to be working with the new versions
     // of Eigen, despite clearly succeeding. Just commenting it out for now.
     // if (solver.info() != Eigen::Success) {
@@ -876,6 +1037,7 @@ void FDDiffusionDriver::power_iteration() {
       if (flux_diff_i > flux_diff) flux_diff = flux_diff_i;
     }
     flux_ = new_flux;
+    telemetry_.add_iteration(flux_diff, keff_);
 
     // Write information
     spdlog::info("-------------------------------------");
@@ -889,54 +1051,257 @@ void FDDiffusionDriver::power_iteration() {
   solved_ = true;
 
   sim_timer.stop();
+  telemetry_.add_time("solve", sim_timer.elapsed_time());
   spdlog::info("");
   spdlog::info("Simulation Time: {:.5E} s", sim_timer.elapsed_time());
 }
 
-void FDDiffusionDriver::fixed_source() {
-  Timer sim_timer;
-  sim_timer.start();
-
-  spdlog::info("Solving fixed source problem.");
-  spdlog::info("Flux tolerance: {:.5E}", flux_tol_);
+void FDDiffusionDriver::prepare_group_systems() {
+  const std::size_t NM = geom_->nmats();
+  const std::size_t NG = geom_->ngroups();
 
-  // First, we create our loss matrix
-  Eigen::SparseMatrix<double, Eigen::RowMajor> M;
+  if (group_systems_.size() != NG) {
+    group_systems_.clear();
+    for (std::size_t g = 0; g < NG; g++) {
+      group_systems_.push_back(std::make_unique<GroupSystem>());
+    }
+  }
 
-  // Load the loss matrix
-  load_loss_matrix(*geom_, M);
+  volumes_.resize(static_cast<Eigen::Index>(NM));
+  upscatter_ = false;
+  for (std::size_t m = 0; m < NM; m++) {
+    volumes_(m) = geom_->volume(m);
 
-  // Initialize a vector for computing keff faster
-  Eigen::VectorXd VvEf(geom_->ngroups() * geom_->nmats());
-  for (std::size_t m = 0; m < geom_->nmats(); m++) {
-    const double Vm = geom_->volume(m);
     const auto& mat = geom_->mat(m);
-    for (std::size_t g = 0; g < geom_->ngroups(); g++) {
-      VvEf(m + g * geom_->nmats()) = Vm * mat->vEf(g);
+    for (std::size_t g = 0; g < NG; g++) {
+      for (std::size_t gg = g + 1; gg < NG; gg++) {
+        if (mat->Es(gg, g) != 0.) upscatter_ = true;
+      }
     }
   }
 
-  // Initialize a vector for computing the source vector Q faster
-  Eigen::SparseMatrix<double, Eigen::RowMajor> QM;
-  load_source_matrix(*geom_, QM);
+  // The multigrid levels only depend on the mesh, and are shared by all groups
+  std::shared_ptr<const MultigridPreconditioner::Aggregates> aggregates;
+  if (linear_solver_ == FDLinearSolver::GroupMultigrid) {
+    aggregates = std::make_shared<const MultigridPreconditioner::Aggregates>(
+        multigrid_aggregates(*geom_));
+    spdlog::info("Multigrid levels: {}", aggregates->size() + 1);
+  }
+
+  bool non_symmetric = false;
+  for (std::size_t g = 0; g < NG; g++) {
+    GroupSystem& sys = *group_systems_[g];
+    const auto n = static_cast<Eigen::Index>(NM);
+    const auto g0 = static_cast<Eigen::Index>(g * NM);
+    sys.A = volumes_.asDiagonal() * M_.block(g0, g0, n, n);
+    sys.A.makeCompressed();
+
+    const bool was_symmetric = sys.symmetric;
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> At = sys.A.transpose();
+    sys.symmetric = (sys.A - At).norm() <= 1.E-12 * sys.A.norm();
+    if (sys.symmetric == false) non_symmetric = true;
+
+    bool success = true;
+    switch (linear_solver_) {
+      case FDLinearSolver::GroupCG:
+        if (sys.symmetric) {
+          sys.cg.compute(sys.A);
+          sys.cg.setTolerance(1.E-8);
+          success = sys.cg.info() == Eigen::Success;
+        } else {
+          sys.bicgstab.compute(sys.A);
+          sys.bicgstab.setTolerance(1.E-8);
+          success = sys.bicgstab.info() == Eigen::Success;
+        }
+        break;
+
+      case FDLinearSolver::GroupMultigrid:
+        if (sys.symmetric) {
+          sys.mg_cg.preconditioner().set_aggregates(aggregates);
+          sys.mg_cg.compute(sys.A);
+          sys.mg_cg.setTolerance(1.E-8);
+          success = sys.mg_cg.info() == Eigen::Success;
+        } else {
+          sys.mg_bicgstab.preconditioner().set_aggregates(aggregates);
+          sys.mg_bicgstab.compute(sys.A);
+          sys.mg_bicgstab.setTolerance(1.E-8);
+          success = sys.mg_bicgstab.info() == Eigen::Success;
+        }
+        break;
+
+      default: {
+        // The factorizations are kept for all the power iterations. As the
+        // pattern only depends on the mesh, its symbolic analysis is also
+        // kept between solves.
+        const Eigen::SparseMatrix<double> Acol = sys.A;
+        if (sys.analyzed == false || sys.symmetric != was_symmetric) {
+          if (sys.symmetric) {
+            sys.ldlt.analyzePattern(Acol);
+          } else {
+            sys.lu.analyzePattern(Acol);
+          }
+          sys.analyzed = true;
+        }
+        if (sys.symmetric) {
+          sys.ldlt.factorize(Acol);
+          success = sys.ldlt.info() == Eigen::Success;
+        } else {
+          sys.lu.factorize(Acol);
+          success = sys.lu.info() == Eigen::Success;
+        }
+      } break;
+    }
 
-  // Subtract source matrix from loss matrix (only for fixed-source problems)
-  M -= QM;
+    if (success == false) {
+      std::stringstream mssg;
+      mssg << "Could not initialize the solver for group " << g << ".";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  }
 
-  // Create a solver for the problem
-  spdlog::info("Initializing iterative solver");
-  Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>> solver;
-  solver.compute(M);
-  solver.setTolerance(flux_tol_);
-  if (solver.info() != Eigen::Success) {
-    std::stringstream mssg;
-    mssg << "Could not initialize iterative solver";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
+  if (non_symmetric) {
+    spdlog::warn(
+        "Within-group systems are not symmetric, due to the discontinuity "
+        "factors. These groups are solved with {}.",
+        linear_solver_ == FDLinearSolver::GroupLDLT ? "SparseLU" : "BiCGSTAB");
+  }
+}
+
+std::size_t FDDiffusionDriver::group_gauss_seidel(const Eigen::VectorXd& Q,
+                                                  Eigen::VectorXd& flux) {
+  const std::size_t NM = geom_->nmats();
+  const std::size_t NG = geom_->ngroups();
+
+  // Without upscattering, one sweep over the groups solves the system exactly
+  const std::size_t nsweeps = upscatter_ ? upscatter_iterations_ : 1;
+
+  std::size_t iterations = 0;
+  Eigen::VectorXd b(static_cast<Eigen::Index>(NM));
+  Eigen::VectorXd guess(static_cast<Eigen::Index>(NM));
+  Eigen::VectorXd x(static_cast<Eigen::Index>(NM));
+  for (std::size_t sweep = 0; sweep < nsweeps; sweep++) {
+    for (std::size_t g = 0; g < NG; g++) {
+      const std::size_t r0 = g * NM;
+      const std::size_t r1 = r0 + NM;
+
+      // Source of group g, with the scattering from the latest flux of all
+      // other groups
+#pragma omp parallel for
+      for (int im = 0; im < static_cast<int>(NM); im++) {
+        const std::size_t m = static_cast<std::size_t>(im);
+        double src = Q(r0 + m);
+        for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(
+                 M_, static_cast<Eigen::Index>(r0 + m));
+             it; ++it) {
+          const auto c = static_cast<std::size_t>(it.col());
+          if (c < r0 || c >= r1) src -= it.value() * flux(c);
+        }
+        b(m) = volumes_(m) * src;
+      }
+
+      GroupSystem& sys = *group_systems_[g];
+      guess = flux.segment(r0, NM);
+      switch (linear_solver_) {
+        case FDLinearSolver::GroupCG:
+          if (sys.symmetric) {
+            x = sys.cg.solveWithGuess(b, guess);
+            iterations += static_cast<std::size_t>(sys.cg.iterations());
+          } else {
+            x = sys.bicgstab.solveWithGuess(b, guess);
+            iterations += static_cast<std::size_t>(sys.bicgstab.iterations());
+          }
+          break;
+
+        case FDLinearSolver::GroupMultigrid:
+          if (sys.symmetric) {
+            x = sys.mg_cg.solveWithGuess(b, guess);
+            iterations += static_cast<std::size_t>(sys.mg_cg.iterations());
+          } else {
+            x = sys.mg_bicgstab.solveWithGuess(b, guess);
+            iterations +=
+                static_cast<std::size_t>(sys.mg_bicgstab.iterations());
+          }
+          break;
+
+        default:
+          x = sys.symmetric ? Eigen::VectorXd(sys.ldlt.solve(b))
+                            : Eigen::VectorXd(sys.lu.solve(b));
+          iterations++;
+          break;
+      }
+      flux.segment(r0, NM) = x;
+    }
   }
 
-  // Get new flux
-  flux_ = solver.solve(extern_src_);
+  return iterations;
+}
+
+void FDDiffusionDriver::fixed_source() {
+  Timer sim_timer;
+  sim_timer.start();
+  telemetry_.clear();
+
+  spdlog::info("Solving fixed source problem.");
+  spdlog::info("Flux tolerance: {:.5E}", flux_tol_);
+
+  // The previous solution is the initial guess of a warm start
+  const bool warm = warm_start_ && solved_;
+  if (warm) spdlog::info("Starting from the previous solution.");
+
+  const bool matrix_free = linear_solver_ == FDLinearSolver::MatrixFree;
+  if (matrix_free) {
+    Timer assembly_timer;
+    assembly_timer.start();
+    load_operator(*geom_, op_);
+    op_.set_fixed_source(true);
+    release_matrices();
+
+    spdlog::info("Initializing iterative solver");
+    Eigen::BiCGSTAB<FDOperator, FDOperator::Jacobi> solver;
+    solver.compute(op_);
+    solver.setTolerance(flux_tol_);
+    assembly_timer.stop();
+    telemetry_.add_time("assembly", assembly_timer.elapsed_time());
+
+    SolverTelemetry::ScopedPhase phase(telemetry_, "linear_solve");
+    flux_ = warm ? Eigen::VectorXd(solver.solveWithGuess(extern_src_, flux_))
+                 : Eigen::VectorXd(solver.solve(extern_src_));
+    telemetry_.add_count("linear_iterations",
+                         static_cast<std::size_t>(solver.iterations()));
+  } else {
+    // First, we create our loss matrix
+    Timer assembly_timer;
+    assembly_timer.start();
+    // Load the loss matrix. Its pattern is kept from the previous solve.
+    load_loss_matrix(*geom_, M_, M_pattern_);
+    op_ = FDOperator();
+
+    // Initialize a vector for computing the source vector Q faster
+    load_source_matrix(*geom_, QM_, QM_pattern_);
+
+    // Subtract source matrix from loss matrix (only for fixed-source problems)
+    const Eigen::SparseMatrix<double, Eigen::RowMajor> M = M_ - QM_;
+
+    // Create a solver for the problem
+    spdlog::info("Initializing iterative solver");
+    Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>> solver;
+    solver.compute(M);
+    solver.setTolerance(flux_tol_);
+    if (solver.info() != Eigen::Success) {
+      std::stringstream mssg;
+      mssg << "Could not initialize iterative solver";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+    assembly_timer.stop();
+    telemetry_.add_time("assembly", assembly_timer.elapsed_time());
+
+    // Get new flux
+    SolverTelemetry::ScopedPhase phase(telemetry_, "linear_solve");
+    flux_ = warm ? Eigen::VectorXd(solver.solveWithGuess(extern_src_, flux_))
+                 : Eigen::VectorXd(solver.solve(extern_src_));
+  }
   // For some reason, this doesn't seem to be working with the new versions
   // of Eigen, despite clearly succeeding. Just commenting it out for now.
   // if (solver.info() != Eigen::Success) {
@@ -947,18 +1312,96 @@ void FDDiffusionDriver::fixed_source() {
   solved_ = true;
 
   sim_timer.stop();
+  telemetry_.add_time("solve", sim_timer.elapsed_time());
   spdlog::info("");
   spdlog::info("Simulation Time: {:.5E} s", sim_timer.elapsed_time());
 }
 
+void FDDiffusionDriver::release_matrices() {
+  M_ = Eigen::SparseMatrix<double, Eigen::RowMajor>();
+  QM_ = Eigen::SparseMatrix<double, Eigen::RowMajor>();
+  M_pattern_.clear();
+  QM_pattern_.clear();
+  group_systems_.clear();
+}
+
 void FDDiffusionDriver::solve() {
+  SCARABEE_PROFILE_ZONE("FDDiffusionDriver::solve");
+  ThreadScope thread_scope(threads_);
   if (sim_mode() == SimulationMode::Keff) {
     this->power_iteration();
   } else {
     this->fixed_source();
   }
+
+  log_memory_usage("FDDiffusionDriver", memory_usage());
+}
+
+MemoryUsage FDDiffusionDriver::memory_usage() const {
+  MemoryUsage usage;
+  usage["flux"] = array_bytes(flux_) + array_bytes(extern_src_);
+  usage["matrices"] = array_bytes(M_) + array_bytes(QM_) +
+                      M_pattern_.memory_bytes() + QM_pattern_.memory_bytes();
+  for (const auto& sys : group_systems_) {
+    usage["matrices"] += array_bytes(sys->A);
+  }
+  usage["operator"] = op_.memory_bytes();
+  usage["volumes"] = array_bytes(volumes_);
+  return usage;
+}
+
+namespace {
+
+// Calls fill(m, inds) for each mesh of the core holding material m, where
+// inds are the indices of the mesh. When the geometry is one quadrant of a
+// symmetric core, the meshes of the whole core are visited.
+template <typename Fill>
+void for_each_core_mesh(const DiffusionGeometry& geom, const Fill& fill) {
+  if (geom.symmetry() == DiffusionSymmetry::Full) {
+    for (std::size_t m = 0; m < geom.nmats(); m++) fill(m, geom.geom_indx(m));
+    return;
+  }
+
+  const std::size_t nz = geom.ndims() > 2 ? geom.nz() : 1;
+  for (std::size_t i = 0; i < geom.unfolded_nx(); i++) {
+    for (std::size_t j = 0; j < geom.unfolded_ny(); j++) {
+      const auto [fi, fj] = geom.fold_ij(i, j);
+      for (std::size_t k = 0; k < nz; k++) {
+        xt::svector<std::size_t> inds{i, j};
+        xt::svector<std::size_t> folded{fi, fj};
+        if (geom.ndims() > 2) {
+          inds.push_back(k);
+          folded.push_back(k);
+        }
+
+        const auto om = geom.geom_to_mat_indx(folded);
+        if (om.has_value()) fill(om.value(), inds);
+      }
+    }
+  }
 }
 
+// Mesh bounds along each axis of the core
+std::tuple<xt::xarray<double>, std::optional<xt::xarray<double>>,
+           std::optional<xt::xarray<double>>>
+core_mesh_bounds(const DiffusionGeometry& geom) {
+  const auto to_array = [](const std::vector<double>& b) {
+    xt::xarray<double> out = xt::zeros<double>({b.size()});
+    for (std::size_t i = 0; i < b.size(); i++) out(i) = b[i];
+    return out;
+  };
+
+  xt::xarray<double> x_bounds = to_array(geom.unfolded_x_bounds());
+  std::optional<xt::xarray<double>> y_bounds = std::nullopt;
+  std::optional<xt::xarray<double>> z_bounds = std::nullopt;
+  if (geom.ndims() > 1) y_bounds = to_array(geom.unfolded_y_bounds());
+  if (geom.ndims() > 2) z_bounds = to_array(geom.z_bounds());
+
+  return {x_bounds, y_bounds, z_bounds};
+}
+
+}  // namespace
+
 std::tuple<xt::xarray<double>, xt::xarray<double>,
            std::optional<xt::xarray<double>>, std::optional<xt::xarray<double>>>
 FDDiffusionDriver::flux() const {
@@ -970,19 +1413,20 @@ FDDiffusionDriver::flux() const {
   }
 
   // Initialize empty flux array with zeros
+  const std::size_t nx = geom_->unfolded_nx();
+  const std::size_t ny = geom_->unfolded_ny();
   xt::xarray<double> flux;
   if (geom_->ndims() == 1) {
-    flux = xt::zeros<double>({geom_->ngroups(), geom_->nx()});
+    flux = xt::zeros<double>({geom_->ngroups(), nx});
   } else if (geom_->ndims() == 2) {
-    flux = xt::zeros<double>({geom_->ngroups(), geom_->nx(), geom_->ny()});
+    flux = xt::zeros<double>({geom_->ngroups(), nx, ny});
   } else {
-    flux = xt::zeros<double>(
-        {geom_->ngroups(), geom_->nx(), geom_->ny(), geom_->nz()});
+    flux = xt::zeros<double>({geom_->ngroups(), nx, ny, geom_->nz()});
   }
 
   // Fill the flux
-  for (std::size_t m = 0; m < geom_->nmats(); m++) {
-    auto tmp_inds = geom_->geom_indx(m);
+  for_each_core_mesh(*geom_, [&](std::size_t m,
+                                 const xt::svector<std::size_t>& tmp_inds) {
     xt::svector<std::size_t> inds;
     inds.push_back(0);
     for (std::size_t i = 0; i < tmp_inds.size(); i++) {
@@ -993,31 +1437,10 @@ FDDiffusionDriver::flux() const {
       inds[0] = g;
       flux.element(inds.begin(), inds.end()) = flux_(m + g * geom_->nmats());
     }
-  }
+  });
 
   // Create the arrays for the x, y, and z bounds
-  xt::xarray<double> x_bounds;
-  std::optional<xt::xarray<double>> y_bounds = std::nullopt;
-  std::optional<xt::xarray<double>> z_bounds = std::nullopt;
-
-  x_bounds = xt::zeros<double>({geom_->nx() + 1});
-  for (std::size_t i = 0; i < geom_->nx(); i++) {
-    x_bounds(i + 1) = x_bounds(i) + geom_->dx(i);
-  }
-
-  if (geom_->ndims() > 1) {
-    y_bounds = xt::zeros<double>({geom_->ny() + 1});
-    for (std::size_t j = 0; j < geom_->ny(); j++) {
-      y_bounds.value()(j + 1) = y_bounds.value()(j) + geom_->dy(j);
-    }
-  }
-
-  if (geom_->ndims() > 2) {
-    z_bounds = xt::zeros<double>({geom_->nz() + 1});
-    for (std::size_t k = 0; k < geom_->nz(); k++) {
-      z_bounds.value()(k + 1) = z_bounds.value()(k) + geom_->dz(k);
-    }
-  }
+  auto [x_bounds, y_bounds, z_bounds] = core_mesh_bounds(*geom_);
 
   return {flux, x_bounds, y_bounds, z_bounds};
 }
@@ -1033,49 +1456,30 @@ FDDiffusionDriver::power() const {
   }
 
   // Initialize empty power array with zeros
+  const std::size_t nx = geom_->unfolded_nx();
+  const std::size_t ny = geom_->unfolded_ny();
   xt::xarray<double> power;
   if (geom_->ndims() == 1) {
-    power = xt::zeros<double>({geom_->nx()});
+    power = xt::zeros<double>({nx});
   } else if (geom_->ndims() == 2) {
-    power = xt::zeros<double>({geom_->nx(), geom_->ny()});
+    power = xt::zeros<double>({nx, ny});
   } else {
-    power = xt::zeros<double>({geom_->nx(), geom_->ny(), geom_->nz()});
+    power = xt::zeros<double>({nx, ny, geom_->nz()});
   }
 
   // Fill the power
-  for (std::size_t m = 0; m < geom_->nmats(); m++) {
-    auto inds = geom_->geom_indx(m);
+  for_each_core_mesh(*geom_, [&](std::size_t m,
+                                 const xt::svector<std::size_t>& inds) {
     const auto& xs = geom_->mat(m);
 
     for (std::size_t g = 0; g < geom_->ngroups(); g++) {
       power.element(inds.begin(), inds.end()) +=
           flux_(m + g * geom_->nmats()) * xs->Ef(g);
     }
-  }
+  });
 
   // Create the arrays for the x, y, and z bounds
-  xt::xarray<double> x_bounds;
-  std::optional<xt::xarray<double>> y_bounds = std::nullopt;
-  std::optional<xt::xarray<double>> z_bounds = std::nullopt;
-
-  x_bounds = xt::zeros<double>({geom_->nx() + 1});
-  for (std::size_t i = 0; i < geom_->nx(); i++) {
-    x_bounds(i + 1) = x_bounds(i) + geom_->dx(i);
-  }
-
-  if (geom_->ndims() > 1) {
-    y_bounds = xt::zeros<double>({geom_->ny() + 1});
-    for (std::size_t j = 0; j < geom_->ny(); j++) {
-      y_bounds.value()(j + 1) = y_bounds.value()(j) + geom_->dy(j);
-    }
-  }
-
-  if (geom_->ndims() > 2) {
-    z_bounds = xt::zeros<double>({geom_->nz() + 1});
-    for (std::size_t k = 0; k < geom_->nz(); k++) {
-      z_bounds.value()(k + 1) = z_bounds.value()(k) + geom_->dz(k);
-    }
-  }
+  auto [x_bounds, y_bounds, z_bounds] = core_mesh_bounds(*geom_);
 
   return {power, x_bounds, y_bounds, z_bounds};
 }
@@ -0,0 +1,78 @@
+#include <diffusion/fd_operator.hpp>
+
+namespace scarabee {
+
+void FDOperator::loss(const Eigen::VectorXd& x, Eigen::VectorXd& y) const {
+  y.resize(rows());
+  const double* xp = x.data();
+  double* yp = y.data();
+
+#pragma omp parallel for
+  for (int im = 0; im < static_cast<int>(nm_); im++) {
+    const std::size_t m = static_cast<std::size_t>(im);
+    const std::uint32_t* nbrs = nbrs_.data() + m * NNBRS;
+    const std::size_t mat = mats_[m];
+    const double* Es = Es_.data() + mat * ng_ * ng_;
+
+    double fiss = 0.;
+    if (fixed_source_) {
+      for (std::size_t gg = 0; gg < ng_; gg++) {
+        fiss += vEf_[mat * ng_ + gg] * xp[m + gg * nm_];
+      }
+    }
+
+    for (std::size_t g = 0; g < ng_; g++) {
+      const std::size_t g0 = g * nm_;
+      const double* coeffs = stencil_.data() + (m + g0) * STENCIL;
+
+      double v = coeffs[0] * xp[m + g0];
+      for (std::size_t k = 0; k < NNBRS; k++) {
+        v += coeffs[k + 1] * xp[nbrs[k] + g0];
+      }
+      for (std::size_t gg = 0; gg < ng_; gg++) {
+        v -= Es[g * ng_ + gg] * xp[m + gg * nm_];
+      }
+      if (fixed_source_) v -= chi_[mat * ng_ + g] * fiss;
+
+      yp[m + g0] = v;
+    }
+  }
+}
+
+void FDOperator::fission(const Eigen::VectorXd& x, Eigen::VectorXd& y) const {
+  y.resize(rows());
+  const double* xp = x.data();
+  double* yp = y.data();
+
+#pragma omp parallel for
+  for (int im = 0; im < static_cast<int>(nm_); im++) {
+    const std::size_t m = static_cast<std::size_t>(im);
+    const std::size_t mat = mats_[m];
+
+    double fiss = 0.;
+    for (std::size_t gg = 0; gg < ng_; gg++) {
+      fiss += vEf_[mat * ng_ + gg] * xp[m + gg * nm_];
+    }
+    for (std::size_t g = 0; g < ng_; g++) {
+      yp[m + g * nm_] = chi_[mat * ng_ + g] * fiss;
+    }
+  }
+}
+
+Eigen::VectorXd FDOperator::diagonal() const {
+  Eigen::VectorXd d(rows());
+  for (std::size_t m = 0; m < nm_; m++) {
+    const std::size_t mat = mats_[m];
+    for (std::size_t g = 0; g < ng_; g++) {
+      const std::size_t r = m + g * nm_;
+      d(static_cast<Eigen::Index>(r)) = stencil_[r * STENCIL];
+      if (fixed_source_) {
+        d(static_cast<Eigen::Index>(r)) -=
+            chi_[mat * ng_ + g] * vEf_[mat * ng_ + g];
+      }
+    }
+  }
+  return d;
+}
+
+}  // namespace scarabee
@@ -1,7 +1,113 @@
 #include <moc/flat_source_region.hpp>
+#include <moc/surface_kernels.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace scarabee {
 
 std::size_t FlatSourceRegion::id_counter{0};
 
-}
\ No newline at end of file
+void FlatSourceRegion::compile() {
+  shape_ = CompiledShape();
+
+  auto add_plane = [this](double A, double B, double C, bool axis, bool pos) {
+    const std::size_t p = shape_.nplanes++;
+    shape_.A[p] = A;
+    shape_.B[p] = B;
+    shape_.C[p] = C;
+    shape_.axis[p] = axis;
+    shape_.plane_positive[p] = pos;
+  };
+
+  for (std::size_t t = 0; t < tokens_.size(); t++) {
+    const Surface& surf = *tokens_[t].surface;
+    const bool pos = tokens_[t].side == Surface::Side::Positive;
+    switch (surf.type()) {
+      case Surface::Type::XPlane:
+        add_plane(1., 0., surf.x0(), true, pos);
+        break;
+
+      case Surface::Type::YPlane:
+        add_plane(0., 1., surf.y0(), true, pos);
+        break;
+
+      case Surface::Type::Plane:
+        add_plane(surf.A(), surf.B(), surf.C(), false, pos);
+        break;
+
+      case Surface::Type::Cylinder: {
+        const std::size_t c = shape_.ncylinders++;
+        shape_.x0[c] = surf.x0();
+        shape_.y0[c] = surf.y0();
+        shape_.rc[c] = surf.r();
+        shape_.cylinder_positive[c] = pos;
+      } break;
+
+      default:
+        shape_.other[shape_.nother++] = static_cast<std::uint8_t>(t);
+        break;
+    }
+  }
+
+  shape_.compiled = true;
+}
+
+bool FlatSourceRegion::compiled_inside(const Vector& r,
+                                       const Direction& u) const {
+  // Same as plane_side, which also gives xplane_side and yplane_side for
+  // their coefficients, as multiplying by one and adding zero are exact
+  bool in = true;
+  for (std::size_t p = 0; p < shape_.nplanes; p++) {
+    const double eval = shape_.A[p] * r.x() + shape_.B[p] * r.y() - shape_.C[p];
+    const double dot = shape_.A[p] * u.x() + shape_.B[p] * u.y();
+    const bool positive = (eval > SURFACE_COINCIDENT) |
+                          ((eval >= -SURFACE_COINCIDENT) & (dot > 0.));
+    in &= positive == shape_.plane_positive[p];
+  }
+  if (in == false) return false;
+
+  for (std::size_t c = 0; c < shape_.ncylinders; c++) {
+    const bool positive =
+        cylinder_side(shape_.x0[c], shape_.y0[c], shape_.rc[c], r, u) ==
+        Surface::Side::Positive;
+    if (positive != shape_.cylinder_positive[c]) return false;
+  }
+
+  for (std::size_t k = 0; k < shape_.nother; k++) {
+    if (tokens_[shape_.other[k]].inside(r, u) == false) return false;
+  }
+
+  return true;
+}
+
+double FlatSourceRegion::compiled_distance(const Vector& r,
+                                           const Direction& u) const {
+  // Same as plane_distance, except that x and y planes test the distance
+  // along their normal for coincidence, as xplane_distance and
+  // yplane_distance do
+  double min_dist = INF;
+  for (std::size_t p = 0; p < shape_.nplanes; p++) {
+    const double num = shape_.C[p] - shape_.A[p] * r.x() - shape_.B[p] * r.y();
+    const double denom = shape_.A[p] * u.x() + shape_.B[p] * u.y();
+    const double d = num / denom;
+    const double t = shape_.axis[p] ? num : d;
+    const bool miss =
+        (std::abs(t) < SURFACE_COINCIDENT) | (denom == 0.) | (d < 0.);
+    min_dist = std::min(min_dist, miss ? INF : d);
+  }
+
+  for (std::size_t c = 0; c < shape_.ncylinders; c++) {
+    min_dist = std::min(min_dist, cylinder_distance(shape_.x0[c], shape_.y0[c],
+                                                    shape_.rc[c], r, u));
+  }
+
+  for (std::size_t k = 0; k < shape_.nother; k++) {
+    min_dist =
+        std::min(min_dist, tokens_[shape_.other[k]].surface->distance(r, u));
+  }
+
+  return min_dist;
+}
+
+}  // namespace scarabee
@@ -2,6 +2,7 @@
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace scarabee {
@@ -19,8 +20,7 @@ FluxCalculator::FluxCalculator(const xt::xtensor<double, 1>& energy_boundaries,
       chi_(),
       background_nuclides_(),
       A_r_(awr_r),
-      a_r_(this->a_from_awr(A_r_)),
-      g_max_r(0) {
+      a_r_(this->a_from_awr(A_r_)) {
   if (sig_t_r_.size() != energy_boundaries_.size() - 1) {
     auto mssg =
         "Number of total cross sections does not agree with the number of "
@@ -84,7 +84,7 @@ void FluxCalculator::add_background_nuclide(double sig_b, double awr) {
     throw ScarabeeException(mssg);
   }
 
-  background_nuclides_.push_back({awr, a_from_awr(awr), sig_b, 0});
+  background_nuclides_.push_back({awr, a_from_awr(awr), sig_b});
 }
 
 void FluxCalculator::solve() {
@@ -94,16 +94,30 @@ void FluxCalculator::solve() {
   double sig_b = 0.;
   for (const auto& n : background_nuclides_) sig_b += n.sig_b;
 
-  // Sett the starting g_max indices to be NG-1 for all nuclides
-  g_max_r = NG - 1;
-  for (auto& n : background_nuclides_) n.g_max = NG - 1;
+  // Background nuclides with the same alpha share the same scattering
+  // window, and are therefore merged together.
+  std::vector<ScatterWindow> windows;
+  for (const auto& n : background_nuclides_) {
+    auto it = std::find_if(windows.begin(), windows.end(),
+                           [&n](const ScatterWindow& w) { return w.a == n.a; });
+    if (it == windows.end()) {
+      windows.push_back({n.a, 0., NG - 1});
+      it = windows.end() - 1;
+    }
+    it->coeff += n.sig_b / (1. - n.a);
+  }
+  ScatterWindow res_window{a_r_, 1. / (1. - a_r_), NG - 1};
+
+  // Running sums of flux(g) dE(g) / E(g) from the top of the energy grid,
+  // with and without the resonant scattering xs. Element g holds the sum
+  // over groups g to NG-1, and element NG is zero.
+  xt::xtensor<double, 1> sum_flux = xt::zeros<double>({NG + 1});
+  xt::xtensor<double, 1> sum_res_flux = xt::zeros<double>({NG + 1});
 
   // We work from HIGH energy (end of arrays) to LOW energy (beginning of
   // arrays). To start, we set the flux at the highest energy
   flux_(NG - 1) = chi_(NG - 1) / (sig_t_r_(NG - 1) + sig_b);
-
-  // Source in previous group
-  double Sgm1 = 0.;
+  add_to_sums(NG - 1, sum_flux, sum_res_flux);
 
   // Iterate over energy BACKWARDS
   for (int ig = static_cast<int>(NG - 2); ig >= 0; ig--) {
@@ -113,63 +127,35 @@ void FluxCalculator::solve() {
     const double Et_g = sig_t_r_(g) + sig_b;
 
     // Compute source
-    double Sg = compute_scatter_source(Sgm1, g);
+    double Sg = res_window.source(avg_energy_, sum_res_flux, g);
+    for (auto& w : windows) Sg += w.source(avg_energy_, sum_flux, g);
 
     // Compute flux
     flux_(g) = (Sg + chi_(g)) / Et_g;
 
-    // Set previous source for next iteration
-    Sgm1 = Sg;
+    add_to_sums(g, sum_flux, sum_res_flux);
   }
 }
 
-double FluxCalculator::compute_scatter_source(double Sgm1, std::size_t g) {
-  const double Eg = avg_energy_(g);
-
-  double Sg = Sgm1;
-
-  // Add contribution for the previous group of all nuclides.
-  // Previous group means go up an energy ! Hence the g+1 !
-  const double flux_gm1 = flux_(g + 1);
-  const double Dlt_Egm1 = dlt_energy_(g + 1);
-  const double Egm1 = avg_energy_(g + 1);
-
-  Sg += sig_s_r_(g + 1) * flux_gm1 * Dlt_Egm1 / ((1. - a_r_) * Egm1);
-  for (const auto& n : background_nuclides_) {
-    Sg += n.sig_b * flux_gm1 * Dlt_Egm1 / ((1. - n.a) * Egm1);
-  }
-
-  // We now remove the no-longer needed contributions from energies that
-  // are too high to reach our current energy. Start with that from the
-  // resonant isotope first.
-  double Emax_prev = Egm1 / a_r_;
-  double Emax = Eg / a_r_;
-  while (avg_energy_(g_max_r) > Emax_prev) g_max_r -= 1;
-  for (std::size_t gg = g_max_r; gg > g; gg--) {
-    if (avg_energy_(gg) > Emax) {
-      Sg -= sig_s_r_(gg) * flux_(gg) * dlt_energy_(gg) /
-            ((1. - a_r_) * avg_energy_(gg));
-    } else {
-      break;
-    }
-  }
-
-  // Do components from other nuclides
-  for (auto& n : background_nuclides_) {
-    Emax_prev = Egm1 / n.a;
-    Emax = Eg / n.a;
-    while (avg_energy_(n.g_max) > Emax_prev) n.g_max -= 1;
-    for (std::size_t gg = n.g_max; gg > g; gg--) {
-      if (avg_energy_(gg) > Emax) {
-        Sg -= n.sig_b * flux_(gg) * dlt_energy_(gg) /
-              ((1. - n.a) * avg_energy_(gg));
-      } else {
-        break;
-      }
-    }
-  }
+void FluxCalculator::add_to_sums(std::size_t g,
+                                 xt::xtensor<double, 1>& sum_flux,
+                                 xt::xtensor<double, 1>& sum_res_flux) const {
+  const double phi = flux_(g) * dlt_energy_(g) / avg_energy_(g);
+  sum_flux(g) = sum_flux(g + 1) + phi;
+  sum_res_flux(g) = sum_res_flux(g + 1) + sig_s_r_(g) * phi;
+}
 
-  return Sg;
+double FluxCalculator::ScatterWindow::source(
+    const xt::xtensor<double, 1>& avg_energy,
+    const xt::xtensor<double, 1>& sum, std::size_t g) {
+  // Move the top of the window down to the highest group from which a
+  // neutron can still reach our current energy. This never moves up as we
+  // go down in energy, so each group is only passed once.
+  const double Emax = avg_energy(g) / a;
+  while (g_up > g && avg_energy(g_up) > Emax) g_up--;
+
+  // Groups g+1 to g_up scatter into g
+  return coeff * (sum(g + 1) - sum(g_up + 1));
 }
 
 }  // namespace scarabee
@@ -0,0 +1,324 @@
+#include <moc/geometry_raster.hpp>
+#include <moc/moc_driver.hpp>
+#include <utils/constants.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/threads.hpp>
+
+#include <ImApp/imapp.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace scarabee {
+
+namespace {
+
+// Number of rows or columns traced by a thread at a time
+constexpr std::size_t TILE_LINES = 16;
+
+// Traces a line of n pixels of width step from start along u, calling
+// set(k, ufsr, boundary) for each pixel k. The last pixel before each
+// boundary, and the last pixel of the line, are marked as boundaries.
+template <typename F>
+void trace_line(const Cartesian2D& geom, Vector strt, const Direction& u,
+                std::size_t n, double step, F set) {
+  auto ufsr_r = geom.get_fsr_r_local(strt, u);
+
+  std::size_t k = 0;
+  while (k < n) {
+    // Get the boundary distance
+    double bound_distance = INF;
+    if (ufsr_r.first.fsr) {
+      bound_distance = ufsr_r.first.fsr->distance(ufsr_r.second, u);
+    } else {
+      bound_distance = geom.distance(ufsr_r.second, u);
+    }
+
+    // Get the number of pixels till the boundary
+    const double pixels_to_bound = bound_distance / step;
+    std::size_t npixels = n - k;
+    if (bound_distance != INF && pixels_to_bound < static_cast<double>(n)) {
+      npixels = std::min(
+          npixels, static_cast<std::size_t>(std::round(pixels_to_bound)));
+    }
+    const double npixels_dist = static_cast<double>(npixels) * step;
+
+    // Set all pixels
+    for (std::size_t p = 0; p < npixels; p++) {
+      set(k, ufsr_r.first, p == npixels - 1 || k == n - 1);
+      k++;
+    }
+    if (k >= n) break;
+
+    // Cross boundary, and get the new FSR. When the boundary is close to the
+    // end of the pixel, the next pixel is already in the new FSR.
+    const bool next_pixel =
+        pixels_to_bound - static_cast<double>(npixels) < 0.5;
+    strt = strt + (next_pixel ? npixels_dist + step : npixels_dist) * u;
+    ufsr_r = geom.get_fsr_r_local(strt, u);
+    if (next_pixel) {
+      set(k, ufsr_r.first, false);
+      k++;
+    }
+  }
+}
+
+RGB flux_color(double v) {
+  // Control points of a perceptually uniform map from dark blue to yellow
+  static constexpr std::array<RGB, 5> points{RGB{68, 1, 84}, RGB{59, 82, 139},
+                                             RGB{33, 145, 140},
+                                             RGB{94, 201, 98},
+                                             RGB{253, 231, 37}};
+
+  v = std::clamp(v, 0., 1.) * static_cast<double>(points.size() - 1);
+  const std::size_t k = std::min(static_cast<std::size_t>(v),
+                                 points.size() - 2);
+  const double f = v - static_cast<double>(k);
+
+  RGB out;
+  for (std::size_t c = 0; c < 3; c++) {
+    const double a = static_cast<double>(points[k][c]);
+    const double b = static_cast<double>(points[k + 1][c]);
+    out[c] = static_cast<std::uint8_t>(std::round(a + f * (b - a)));
+  }
+  return out;
+}
+
+void check_image_size(std::size_t nx, std::size_t ny) {
+  if (nx == 0 || ny == 0) {
+    auto mssg = "An image must have at least one pixel along x and y.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+RasterView full_view(const Cartesian2D& geom, std::size_t nx,
+                     std::size_t ny) {
+  RasterView view;
+  view.x_min = geom.x_min();
+  view.x_max = geom.x_max();
+  view.y_min = geom.y_min();
+  view.y_max = geom.y_max();
+  view.nx = nx;
+  view.ny = ny;
+  return view;
+}
+
+}  // namespace
+
+GeometryRaster rasterize_geometry(const Cartesian2D& geom,
+                                  const RasterView& view, bool boundaries) {
+  GeometryRaster raster;
+  raster.nx = view.nx;
+  raster.ny = view.ny;
+  raster.fsrs.resize(view.nx * view.ny);
+  raster.boundary.assign(view.nx * view.ny, 0);
+
+  const double dx = view.dx();
+  const double dy = view.dy();
+
+  // Trace the rows from left to right
+  const Direction u_row(1., 0.);
+  const std::size_t nrow_tiles = (view.ny + TILE_LINES - 1) / TILE_LINES;
+  parallel_for_each_index(nrow_tiles, [&](std::size_t t) {
+    const std::size_t j_end = std::min((t + 1) * TILE_LINES, view.ny);
+    for (std::size_t j = t * TILE_LINES; j < j_end; j++) {
+      const Vector strt(view.x_min,
+                        view.y_max - (static_cast<double>(j) + 0.5) * dy);
+      UniqueFSR* row = raster.fsrs.data() + j * view.nx;
+      std::uint8_t* brow = raster.boundary.data() + j * view.nx;
+      trace_line(geom, strt, u_row, view.nx, dx,
+                 [&](std::size_t i, const UniqueFSR& ufsr, bool b) {
+                   row[i] = ufsr;
+                   brow[i] = boundaries && b;
+                 });
+    }
+  });
+
+  if (boundaries == false) return raster;
+
+  // Trace the columns from top to bottom, only marking the boundaries
+  const Direction u_col(0., -1.);
+  const std::size_t ncol_tiles = (view.nx + TILE_LINES - 1) / TILE_LINES;
+  parallel_for_each_index(ncol_tiles, [&](std::size_t t) {
+    const std::size_t i_end = std::min((t + 1) * TILE_LINES, view.nx);
+    for (std::size_t i = t * TILE_LINES; i < i_end; i++) {
+      const Vector strt(view.x_min + (static_cast<double>(i) + 0.5) * dx,
+                        view.y_max);
+      trace_line(geom, strt, u_col, view.ny, dy,
+                 [&](std::size_t j, const UniqueFSR&, bool b) {
+                   if (b) raster.boundary[j * view.nx + i] = 1;
+                 });
+    }
+  });
+
+  return raster;
+}
+
+RGB PlotColors::random_color() {
+  std::uniform_int_distribution<int> dist(0, 255);
+  return {static_cast<std::uint8_t>(dist(rng_)),
+          static_cast<std::uint8_t>(dist(rng_)),
+          static_cast<std::uint8_t>(dist(rng_))};
+}
+
+RGB PlotColors::get(const UniqueFSR& ufsr, PlotColorBy by) {
+  auto find_or_add = [this](auto& table, const auto& key) {
+    auto it = table.find(key);
+    if (it == table.end()) it = table.emplace(key, random_color()).first;
+    return it->second;
+  };
+
+  switch (by) {
+    case PlotColorBy::Cell:
+      return find_or_add(cell_, ufsr.fsr->id());
+    case PlotColorBy::UniqueCell:
+      return find_or_add(unique_cell_, ufsr);
+    case PlotColorBy::Material:
+      return find_or_add(
+          material_, static_cast<const CrossSection*>(ufsr.fsr->xs().get()));
+    case PlotColorBy::MaterialName:
+    default:
+      return find_or_add(material_name_, ufsr.fsr->xs()->name());
+  }
+}
+
+void PlotColors::set(const UniqueFSR& ufsr, PlotColorBy by, const RGB& color) {
+  switch (by) {
+    case PlotColorBy::Cell:
+      cell_[ufsr.fsr->id()] = color;
+      break;
+    case PlotColorBy::UniqueCell:
+      unique_cell_[ufsr] = color;
+      break;
+    case PlotColorBy::Material:
+      material_[ufsr.fsr->xs().get()] = color;
+      break;
+    case PlotColorBy::MaterialName:
+    default:
+      material_name_[ufsr.fsr->xs()->name()] = color;
+      break;
+  }
+}
+
+xt::xtensor<std::uint8_t, 3> color_raster(const GeometryRaster& raster,
+                                          PlotColors& colors, PlotColorBy by,
+                                          bool outline,
+                                          const RGB& background) {
+  xt::xtensor<std::uint8_t, 3> rgb({raster.ny, raster.nx, 3});
+
+  // Consecutive pixels are mostly in the same FSR, so the color is only
+  // looked up when the FSR changes
+  UniqueFSR prev{nullptr, 0};
+  RGB prev_color = background;
+  for (std::size_t j = 0; j < raster.ny; j++) {
+    for (std::size_t i = 0; i < raster.nx; i++) {
+      const UniqueFSR& ufsr = raster.fsr(j, i);
+      RGB color = background;
+      if (outline && raster.on_boundary(j, i)) {
+        color = {0, 0, 0};
+      } else if (ufsr.fsr) {
+        if ((ufsr == prev) == false) {
+          prev = ufsr;
+          prev_color = colors.get(ufsr, by);
+        }
+        color = prev_color;
+      }
+
+      for (std::size_t c = 0; c < 3; c++) rgb(j, i, c) = color[c];
+    }
+  }
+
+  return rgb;
+}
+
+void write_png(const std::filesystem::path& fname,
+               const xt::xtensor<std::uint8_t, 3>& rgb) {
+  const std::size_t ny = rgb.shape()[0];
+  const std::size_t nx = rgb.shape()[1];
+  check_image_size(nx, ny);
+
+  ImApp::Image image(static_cast<std::uint32_t>(ny),
+                     static_cast<std::uint32_t>(nx));
+  for (std::uint32_t j = 0; j < image.height(); j++) {
+    for (std::uint32_t i = 0; i < image.width(); i++) {
+      image.at(j, i) = ImApp::Pixel(rgb(j, i, 0), rgb(j, i, 1), rgb(j, i, 2));
+    }
+  }
+  image.save_png(fname);
+}
+
+void render_geometry_png(const Cartesian2D& geom,
+                         const std::filesystem::path& fname, std::size_t nx,
+                         std::size_t ny, PlotColorBy by, bool outline) {
+  check_image_size(nx, ny);
+
+  const auto raster = rasterize_geometry(geom, full_view(geom, nx, ny),
+                                         outline);
+  PlotColors colors;
+  write_png(fname, color_raster(raster, colors, by, outline, {255, 255, 255}));
+}
+
+void render_flux_png(const MOCDriver& moc, const std::filesystem::path& fname,
+                     std::size_t nx, std::size_t ny, std::size_t g,
+                     bool outline) {
+  check_image_size(nx, ny);
+
+  if (moc.solved() == false) {
+    auto mssg = "Cannot render the flux. System has not been solved.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (g >= moc.ngroups()) {
+    std::stringstream mssg;
+    mssg << "Group index g = " << g << " is out of range.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  const auto raster =
+      rasterize_geometry(*moc.geometry(), full_view(*moc.geometry(), nx, ny),
+                         outline);
+
+  // Flux of each pixel, which is NaN outside of the geometry
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> values(nx * ny, nan);
+  parallel_for_each_index(ny, [&](std::size_t j) {
+    for (std::size_t i = 0; i < nx; i++) {
+      const UniqueFSR& ufsr = raster.fsr(j, i);
+      if (ufsr.fsr) values[j * nx + i] = moc.flux(moc.get_fsr_indx(ufsr), g);
+    }
+  });
+
+  double vmin = INF;
+  double vmax = -INF;
+  for (const double v : values) {
+    if (std::isnan(v)) continue;
+    vmin = std::min(vmin, v);
+    vmax = std::max(vmax, v);
+  }
+  const double invs_range = vmax > vmin ? 1. / (vmax - vmin) : 0.;
+
+  xt::xtensor<std::uint8_t, 3> rgb({ny, nx, 3});
+  for (std::size_t j = 0; j < ny; j++) {
+    for (std::size_t i = 0; i < nx; i++) {
+      const double v = values[j * nx + i];
+      RGB color{255, 255, 255};
+      if (outline && raster.on_boundary(j, i)) {
+        color = {0, 0, 0};
+      } else if (std::isnan(v) == false) {
+        color = flux_color((v - vmin) * invs_range);
+      }
+
+      for (std::size_t c = 0; c < 3; c++) rgb(j, i, c) = color[c];
+    }
+  }
+
+  write_png(fname, rgb);
+}
+
+}  // namespace scarabee
@@ -3,7 +3,10 @@
 
 #include <data/cross_section.hpp>
 #include <utils/constants.hpp>
+#include <utils/ki3_table.hpp>
+#include <utils/memory_usage.hpp>
 #include <utils/serialization.hpp>
+#include <utils/threads.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
 
@@ -11,16 +14,35 @@
 #include <cereal/types/memory.hpp>
 #include <cereal/types/vector.hpp>
 
+#include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace scarabee {
 
+// Quadrature used for the integrals S_ij over the chords of the cell.
+// Adaptive integrates each S_ij of each group separately with an adaptive
+// Gauss-Kronrod rule. FixedNodes uses the same Gauss-Legendre nodes in each
+// annulus for all groups, so that the chords are computed only once.
+enum class CPQuadrature : std::uint8_t { Adaptive, FixedNodes };
+
 class CylindricalCell {
  public:
   CylindricalCell(const std::vector<double>& radii,
                   const std::vector<std::shared_ptr<CrossSection>>& mats);
   bool solved() const { return solved_; }
+
+  // Number of threads of the parallel regions of the solver. When 0, the
+  // solver uses one thread per pinned core, or the process wide default.
+  std::size_t num_threads() const { return threads_.num_threads; }
+  void set_num_threads(std::size_t n) { threads_.num_threads = n; }
+
+  // Cores to which the threads of the solver are pinned, none if empty
+  const std::vector<std::size_t>& cores() const { return threads_.cores; }
+  void set_cores(const std::vector<std::size_t>& cores) {
+    threads_.set_cores(cores);
+  }
   void solve(bool parallel = false);
 
   std::size_t ngroups() const { return ngroups_; }
@@ -56,15 +78,40 @@ class CylindricalCell {
   double Gamma(std::size_t g) const { return Gamma_(g); }
 
   double p(std::size_t g, std::size_t i, std::size_t j) const {
-    return p_(g, i, j);
+    return p_(g, packed_indx(i, j));
   }
 
   const std::shared_ptr<CrossSection>& xs(std::size_t i) const {
     return mats_[i];
   }
 
+  // Method used to evaluate Ki3 when computing the collision probabilities
+  Ki3Mode ki3_mode() const { return ki3_mode_; }
+  void set_ki3_mode(Ki3Mode mode) { ki3_mode_ = mode; }
+
+  // Quadrature used for the S_ij integrals
+  CPQuadrature cp_quadrature() const { return cp_quad_; }
+  void set_cp_quadrature(CPQuadrature quad) { cp_quad_ = quad; }
+
+  // Number of consecutive groups whose response systems are solved by one
+  // thread at a time in a parallel solve. When 0, it is chosen from the
+  // number of regions, so that the tiny systems of cells with few regions
+  // are batched together.
+  std::size_t group_batch_size() const { return group_batch_size_; }
+  void set_group_batch_size(std::size_t n) { group_batch_size_ = n; }
+
+  // Bytes held by the collision probabilities and the response terms, by
+  // component. The cross sections are shared with the caller, and are not
+  // included.
+  MemoryUsage memory_usage() const;
+
  private:
-  xt::xtensor<double, 3> p_;
+  // The collision probabilities are symmetric, and only the upper triangle
+  // of each group is stored, row by row. The hash of the data which the
+  // probabilities of each group were computed from allows solve to only
+  // recompute the groups which changed.
+  xt::xtensor<double, 2> p_;
+  std::vector<std::size_t> p_hash_;
   xt::xtensor<double, 3> X_;
   xt::xtensor<double, 2> Y_;
   xt::xtensor<double, 1> Gamma_;  // Multicollision blackness in each group
@@ -73,14 +120,32 @@ class CylindricalCell {
   std::vector<std::shared_ptr<CrossSection>> mats_;
   std::size_t ngroups_;
   bool solved_;
+  ThreadSettings threads_;  // Not saved, as it depends on the machine
+  Ki3Mode ki3_mode_{Ki3Mode::Series};
+  CPQuadrature cp_quad_{CPQuadrature::Adaptive};
+  std::size_t group_batch_size_{0};  // Not saved, as it is a solver option
+
+  std::size_t packed_indx(std::size_t i, std::size_t j) const {
+    if (i > j) std::swap(i, j);
+    return i * (2 * nregions() - i - 1) / 2 + j;
+  }
+  std::vector<std::size_t> groups_to_update();
+  void fill_p(std::size_t g, const xt::xtensor<double, 2>& S);
 
   void calculate_collision_probabilities();
   void solve_systems();
+  // Fills X_, Y_, and Gamma_ for the groups in [g_begin, g_end), with one LU
+  // factorization per group, solved for all right hand sides at once
+  void solve_group_systems(std::size_t g_begin, std::size_t g_end);
 
   void parallel_calculate_collision_probabilities();
   void parallel_solve_systems();
 
   double calculate_S_ij(std::size_t i, std::size_t j, std::size_t g) const;
+  // S_ij of the given groups with the fixed node quadrature, indexed as
+  // (i, j, g), with g the position in groups
+  xt::xtensor<double, 3> calculate_S_fixed_nodes(
+      const std::vector<std::size_t>& groups, bool parallel) const;
 
   friend cereal::access;
   CylindricalCell() {}
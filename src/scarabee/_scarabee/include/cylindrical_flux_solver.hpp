@@ -8,6 +8,8 @@
 
 #include <xtensor/containers/xtensor.hpp>
 
+#include <Eigen/Dense>
+
 #include <cereal/cereal.hpp>
 #include <cereal/types/memory.hpp>
 #include <cereal/types/vector.hpp>
@@ -21,6 +23,8 @@ class CylindricalFluxSolver {
  public:
   CylindricalFluxSolver(std::shared_ptr<CylindricalCell> cell);
 
+  const std::shared_ptr<CylindricalCell>& cell() const { return cell_; }
+
   std::size_t ngroups() const { return cell_->ngroups(); }
   std::size_t nregions() const { return cell_->nregions(); }
 
@@ -40,6 +44,15 @@ class CylindricalFluxSolver {
     extern_source_(g, i) = src;
   }
 
+  // If true, the flux of each generation is obtained with a direct solve of
+  // the multigroup system, instead of inner iterations on the scattering
+  // source
+  bool direct() const { return direct_; }
+  void set_direct(bool direct) {
+    direct_ = direct;
+    solved_ = false;
+  }
+
   SimulationMode& sim_mode() { return mode_; }
   const SimulationMode& sim_mode() const { return mode_; }
 
@@ -95,6 +108,12 @@ class CylindricalFluxSolver {
   double flux_tol_;
   SimulationMode mode_;
   bool solved_;
+  bool direct_{false};
+
+  // First group of the upscatter range, and factorization of the coupled
+  // system of the upscatter groups, used by the direct solve
+  std::size_t g_up_{0};
+  Eigen::PartialPivLU<Eigen::MatrixXd> up_lu_;
 
   double calc_keff(const xt::xtensor<double, 2>& flux) const;
   double calc_flux_rel_diff(const xt::xtensor<double, 2>& flux,
@@ -108,6 +127,10 @@ class CylindricalFluxSolver {
   double Qfiss(std::uint32_t g, std::size_t i,
                const xt::xtensor<double, 2>& flux) const;
 
+  void factorize_direct(bool parallel);
+  void solve_direct(const xt::xtensor<double, 2>& fiss_source,
+                    xt::xtensor<double, 2>& flux) const;
+
   void solve_single_thread();
   void solve_parallel();
 
@@ -122,6 +145,15 @@ class CylindricalFluxSolver {
   }
 };
 
+// Solves many cells concurrently, one cell per thread, for pin by pin self
+// shielding. Each cell is solved serially, as in CylindricalCell::solve.
+void solve_cells(const std::vector<std::shared_ptr<CylindricalCell>>& cells);
+
+// Solves many flux solvers concurrently, one solver per thread. The cells of
+// the solvers which are not yet solved are solved first, with solve_cells.
+void solve_flux_solvers(
+    const std::vector<std::shared_ptr<CylindricalFluxSolver>>& solvers);
+
 }  // namespace scarabee
 
 #endif
@@ -0,0 +1,106 @@
+#ifndef SCARABEE_COMPILED_DEPLETION_CHAIN_H
+#define SCARABEE_COMPILED_DEPLETION_CHAIN_H
+
+#include <data/depletion_chain.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace scarabee {
+
+// Read only form of a DepletionChain, with integer nuclide IDs. Nuclides are
+// numbered in ZA order, and include all targets, even those without a chain
+// entry. The targets of each reaction are stored in compressed rows, with
+// their branch ratios, so that the chain may be walked without any string
+// lookups. The DepletionChain remains the representation which is edited.
+class CompiledDepletionChain {
+ public:
+  // Reactions with fixed targets. Fission, with energy dependent yields, is
+  // stored separately.
+  enum Reaction : std::size_t { Decay, NGamma, N2N, N3N, NP, NAlpha };
+  static constexpr std::size_t NREACTIONS = 6;
+
+  CompiledDepletionChain(std::shared_ptr<const DepletionChain> chain);
+
+  // Returns the compiled form of the current contents of the chain, only
+  // compiling it if it has changed since it was last compiled. Thread safe.
+  static std::shared_ptr<const CompiledDepletionChain> get(
+      std::shared_ptr<const DepletionChain> chain);
+
+  std::size_t size() const { return names_.size(); }
+
+  const std::string& name(std::size_t id) const { return names_[id]; }
+  bool has_nuclide(const std::string& name) const;
+  std::size_t id(const std::string& name) const;
+
+  // True if the nuclide has an entry in the chain, and not only as a target
+  bool has_entry(std::size_t id) const { return has_entry_[id]; }
+
+  // Zero for stable nuclides
+  double decay_constant(std::size_t id) const { return decay_constant_[id]; }
+
+  bool has_reaction(std::size_t id, Reaction r) const {
+    return reactions_[r].present[id];
+  }
+
+  std::span<const std::size_t> targets(std::size_t id, Reaction r) const {
+    const auto& adj = reactions_[r];
+    return {adj.target.data() + adj.ptr[id], adj.ptr[id + 1] - adj.ptr[id]};
+  }
+
+  std::span<const double> ratios(std::size_t id, Reaction r) const {
+    const auto& adj = reactions_[r];
+    return {adj.ratio.data() + adj.ptr[id], adj.ptr[id + 1] - adj.ptr[id]};
+  }
+
+  // nullptr if the nuclide does not fission. Targets are in the order of
+  // the yields.
+  const FissionYields* fission_yields(std::size_t id) const {
+    return fission_yields_[id];
+  }
+
+  std::span<const std::size_t> fission_targets(std::size_t id) const {
+    return {fission_.target.data() + fission_.ptr[id],
+            fission_.ptr[id + 1] - fission_.ptr[id]};
+  }
+
+  // All nuclides, ordered so that every nuclide comes after the nuclides
+  // which produce it. Nuclides of a cycle, such as (n,gamma) followed by
+  // (n,2n), are next to each other in an arbitrary order.
+  const std::vector<std::size_t>& topological_order() const {
+    return topological_order_;
+  }
+
+  // Sorted IDs of the given nuclides and all of their descendants
+  std::vector<std::size_t> descend(std::span<const std::size_t> ids) const;
+
+ private:
+  struct Adjacency {
+    std::vector<char> present;
+    std::vector<std::size_t> ptr;
+    std::vector<std::size_t> target;
+    std::vector<double> ratio;
+  };
+
+  // Kept alive for the fission yields
+  std::shared_ptr<const DepletionChain> chain_;
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, std::size_t> ids_;
+  std::vector<char> has_entry_;
+  std::vector<double> decay_constant_;
+  std::array<Adjacency, NREACTIONS> reactions_;
+  std::vector<const FissionYields*> fission_yields_;
+  Adjacency fission_;
+  std::vector<std::size_t> topological_order_;
+
+  void compute_topological_order();
+};
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef SCARABEE_CONDENSATION_SCHEME_H
+#define SCARABEE_CONDENSATION_SCHEME_H
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace scarabee {
+
+// Energy condensation scheme which has been checked against the number of
+// fine groups. The macro group of each fine group is found once, so that
+// the same scheme may be applied to many cross sections.
+class CondensationScheme {
+ public:
+  CondensationScheme(
+      const std::vector<std::pair<std::size_t, std::size_t>>& groups,
+      std::size_t ngroups);
+
+  // Number of fine groups
+  std::size_t ngroups() const { return macro_group_.size(); }
+
+  // Number of macro groups
+  std::size_t ncondensed_groups() const { return groups_.size(); }
+
+  const std::vector<std::pair<std::size_t, std::size_t>>& groups() const {
+    return groups_;
+  }
+
+  // Macro group which contains fine group g
+  std::size_t macro_group(std::size_t g) const { return macro_group_[g]; }
+
+  std::span<const std::size_t> macro_groups() const { return macro_group_; }
+
+  // Checks that the flux has a value for each fine group
+  void check_flux(std::size_t nflux) const;
+
+ private:
+  std::vector<std::pair<std::size_t, std::size_t>> groups_;
+  std::vector<std::size_t> macro_group_;
+};
+
+}  // namespace scarabee
+
+#endif
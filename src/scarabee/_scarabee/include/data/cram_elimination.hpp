@@ -0,0 +1,83 @@
+#ifndef SCARABEE_CRAM_ELIMINATION_H
+#define SCARABEE_CRAM_ELIMINATION_H
+
+#include <Eigen/SparseCore>
+
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace scarabee {
+
+// Symbolic structure of the Gaussian elimination, without pivoting, of a
+// depletion matrix shifted by the CRAM poles, A - theta I. The nuclides of
+// a depletion matrix are sorted by ZA, so that most reactions and decays
+// land close to the diagonal and the elimination only creates a little
+// fill. The structure only depends on the sparsity pattern of A, which is
+// the same for all materials depleted with the same chain, so it is
+// computed once per pattern and then shared.
+class CRAMElimination {
+ public:
+  // A must be compressed, and column major
+  CRAMElimination(const Eigen::SparseMatrix<double>& A);
+
+  // Returns the structure for the pattern of A, building it only if no
+  // structure has yet been made for the same pattern. Thread safe.
+  static std::shared_ptr<const CRAMElimination> get(
+      const Eigen::SparseMatrix<double>& A);
+
+  std::size_t size() const { return diag_.size(); }
+
+  // Number of entries of the factors, including the fill
+  std::size_t nonzeros() const { return col_.size(); }
+
+  // True if A has exactly the pattern used to make this structure
+  bool matches(const Eigen::SparseMatrix<double>& A) const;
+
+  // Computes N = alpha0 * prod_i (1 + 2 Re(alpha_i (A - theta_i I)^-1)) N,
+  // the incomplete partial fraction form of CRAM. All poles are factorized
+  // in a single pass over the structure. Returns false, leaving N
+  // untouched, if a pivot vanished.
+  bool exponential_product(const Eigen::SparseMatrix<double>& A,
+                           std::span<double> N,
+                           std::span<const std::complex<double>> theta,
+                           std::span<const std::complex<double>> alpha,
+                           double alpha0) const;
+
+ private:
+  // Row compressed structure of L + U, with the fill. The diagonal of L is
+  // one, and is not stored.
+  std::vector<std::size_t> row_ptr_;
+  std::vector<std::size_t> col_;
+  std::vector<std::size_t> diag_;  // Position of the diagonal in each row
+
+  // Position in the structure of each stored entry of A, in its order
+  std::vector<std::size_t> a_pos_;
+
+  // Elimination of the entry (i, k) of row i by the pivot row k. The entry
+  // becomes l_ik = a_ik / a_kk, and updates [begin, end) are then applied.
+  struct Elimination {
+    std::size_t ik;
+    std::size_t kk;
+    std::size_t begin;
+    std::size_t end;
+  };
+  std::vector<Elimination> eliminations_;
+
+  // a_ij -= l_ik * a_kj, as the positions of (k, j) and (i, j)
+  struct Update {
+    std::size_t kj;
+    std::size_t ij;
+  };
+  std::vector<Update> updates_;
+
+  // Pattern of A, to check matches
+  std::vector<std::int64_t> outer_;
+  std::vector<std::int64_t> inner_;
+};
+
+}  // namespace scarabee
+
+#endif
@@ -3,7 +3,9 @@
 
 #include <data/xs1d.hpp>
 #include <data/xs2d.hpp>
+#include <data/condensation_scheme.hpp>
 #include <data/diffusion_cross_section.hpp>
+#include <utils/memory_usage.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
 #include <xtensor/views/xview.hpp>
@@ -14,7 +16,9 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace scarabee {
 
@@ -125,6 +129,8 @@ class CrossSection {
   std::shared_ptr<CrossSection> condense(
       const std::vector<std::pair<std::size_t, std::size_t>>& groups,
       const xt::xtensor<double, 1>& flux) const;
+  std::shared_ptr<CrossSection> condense(const CondensationScheme& scheme,
+                                         std::span<const double> flux) const;
 
   std::shared_ptr<DiffusionCrossSection> diffusion_xs() const;
 
@@ -136,6 +142,18 @@ class CrossSection {
   const XS1D& chi_XS1D() const { return chi_; }
   const XS2D& Es_XS2D() const { return Es_; }
 
+  // Hash of all cross section values, rounded to a relative precision of
+  // rtol. Cross sections which are approx_equal usually have the same hash,
+  // but may not when values fall on different sides of a rounding step.
+  // Equal cross sections always have the same hash.
+  std::size_t content_hash(double rtol = 0.) const;
+
+  // True if all values agree within a relative tolerance of rtol
+  bool approx_equal(const CrossSection& R, double rtol = 0.) const;
+
+  // Bytes held by the reaction cross sections and the scattering matrices
+  MemoryUsage memory_usage() const;
+
   // Operators for constructing compound cross sections
   CrossSection operator+(const CrossSection& R) const;
   CrossSection operator*(double N) const;
@@ -145,6 +163,10 @@ class CrossSection {
   void save(const std::string& fname) const;
   static std::shared_ptr<CrossSection> load(const std::string& fname);
 
+  // Portable binary representation, used for pickling
+  std::string to_bytes() const;
+  static std::shared_ptr<CrossSection> from_bytes(const std::string& data);
+
  private:
   XS1D Etr_;  // Transport xs
   XS1D Dtr_;  // Transport Correction xs
@@ -160,6 +182,7 @@ class CrossSection {
 
   void check_xs();
 
+  friend class CrossSectionAccumulator;
   friend class cereal::access;
 
   CrossSection() {}
@@ -172,6 +195,14 @@ class CrossSection {
   }
 };
 
+// Condenses each cross section with its own flux spectrum, applying the
+// same condensation scheme to all of them. The scheme is only checked once,
+// and the cross sections are condensed in parallel.
+std::vector<std::shared_ptr<CrossSection>> condense_cross_sections(
+    const std::vector<std::shared_ptr<CrossSection>>& xs,
+    const std::vector<xt::xtensor<double, 1>>& fluxes,
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups);
+
 }  // namespace scarabee
 
 #endif
@@ -0,0 +1,66 @@
+#ifndef SCARABEE_CROSS_SECTION_ACCUMULATOR_H
+#define SCARABEE_CROSS_SECTION_ACCUMULATOR_H
+
+#include <data/cross_section.hpp>
+#include <data/micro_cross_sections.hpp>
+#include <data/xs2d.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace scarabee {
+
+// Sums many scaled cross sections, such as the N * sigma contributions of
+// all nuclides in a material, into a single set of arrays. Contrary to
+// CrossSection::operator+= and operator*=, no temporary CrossSection is
+// built for the contributions. When the scattering matrices of all
+// contributions are reserved beforehand, the union of their bands is only
+// computed once, and the packed scattering matrix is allocated once.
+class CrossSectionAccumulator {
+ public:
+  CrossSectionAccumulator(std::size_t ngroups);
+
+  std::size_t ngroups() const { return Etr_.size(); }
+
+  // Widens the scattering band of the sum so that it holds that of Es
+  void reserve(const XS2D& Es);
+
+  // Adds N * xs. The fission spectrum of xs is weighted by N * sum(vEf).
+  void add(double N, const CrossSection& xs);
+
+  // Adds N times the microscopic cross sections of a nuclide, for which the
+  // total xs and the P0 scattering matrix are not yet transport corrected.
+  // The fission spectrum is weighted by N * sum(nu * Ef).
+  void add(double N, const MicroNuclideXS& xs);
+
+  // Builds the summed cross section. The accumulator may still be used.
+  std::shared_ptr<CrossSection> cross_section(
+      const std::string& name = "") const;
+
+ private:
+  xt::xtensor<double, 1> Etr_;
+  xt::xtensor<double, 1> Dtr_;
+  xt::xtensor<double, 1> Ea_;
+  xt::xtensor<double, 1> Ef_;
+  xt::xtensor<double, 1> vEf_;
+  xt::xtensor<double, 1> chi_;  // Weighted, but not normalized
+  // Transport correction of the micro contributions, which is removed from
+  // the diagonal of the P0 scattering matrix when building the result
+  xt::xtensor<double, 1> Dtr_diag_;
+  // Lowest and highest outgoing group of each incident group, which always
+  // contain the diagonal
+  xt::xtensor<std::uint32_t, 2> band_;
+  std::size_t nl_{1};
+  XS2D Es_;
+  bool allocated_{false};
+
+  void allocate();
+  void check_ngroups(std::size_t ng) const;
+};
+
+}  // namespace scarabee
+
+#endif
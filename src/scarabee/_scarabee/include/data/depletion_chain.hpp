@@ -1,6 +1,7 @@
 #ifndef SCARABEE_DEPLETION_CHAIN_H
 #define SCARABEE_DEPLETION_CHAIN_H
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -266,7 +267,20 @@ class ChainEntry {
 
 class DepletionChain {
  public:
-  DepletionChain() : data_() {}
+  DepletionChain() : data_(), uid_(next_uid()) {}
+
+  // Copies get their own uid, as they may then be modified independently
+  DepletionChain(const DepletionChain& other)
+      : data_(other.data_), uid_(next_uid()) {}
+  DepletionChain& operator=(const DepletionChain& other) {
+    data_ = other.data_;
+    uid_ = next_uid();
+    return *this;
+  }
+
+  // Identifier of the contents of the chain, which changes whenever the chain
+  // is modified, so that data derived from the chain may be cached
+  std::uint64_t uid() const { return uid_; }
 
   bool holds_nuclide_data(const std::string& nuclide) const;
   const ChainEntry& nuclide_data(const std::string& nuclide) const;
@@ -280,6 +294,18 @@ class DepletionChain {
 
   void remove_nuclide(const std::string& nuclide);
 
+  // Returns a reduced copy of the chain, for fast scoping calculations. First,
+  // all nuclides with a half life below min_half_life are removed with
+  // remove_nuclide, lumping their branch ratios into their parents. Then, all
+  // fission products with a cumulative fission yield below min_fission_yield
+  // are pruned: those which decay are removed in the same way, and stable
+  // ones are dropped from the chain and from all targets. Fissionable
+  // nuclides, nuclides which are not produced by fission, and the nuclides
+  // in keep are never removed.
+  std::shared_ptr<DepletionChain> reduce(
+      double min_half_life, double min_fission_yield,
+      const std::set<std::string>& keep = {}) const;
+
   void save(const std::string& fname) const;
   static std::shared_ptr<DepletionChain> load(const std::string& fname);
 
@@ -288,6 +314,12 @@ class DepletionChain {
 
  private:
   std::map<std::string, ChainEntry> data_;
+  std::uint64_t uid_;
+
+  static std::uint64_t next_uid();
+
+  // Removes all instances of the nuclide, without replacing it by anything
+  void drop_nuclide(const std::string& nuclide);
 
   friend class cereal::access;
 
@@ -0,0 +1,96 @@
+#ifndef SCARABEE_DEPLETION_CHECKPOINT_H
+#define SCARABEE_DEPLETION_CHECKPOINT_H
+
+#include <data/depletion_matrix.hpp>
+#include <data/material.hpp>
+#include <diffusion/diffusion_data.hpp>
+#include <utils/serialization.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cereal/cereal.hpp>
+#include <cereal/types/memory.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace scarabee {
+
+// State of a depletion history after a completed time step, from which the
+// history may be resumed. The depleted regions are listed in an order which
+// is only known to the code writing and reading the checkpoint.
+struct DepletionCheckpoint {
+  std::size_t completed_steps{0};
+  std::vector<double> keff;
+  std::vector<double> exposures;
+  std::vector<double> times;
+
+  // All compositions of each depleted region, one per step
+  std::vector<std::vector<std::shared_ptr<Material>>> material_histories;
+
+  // Depletion matrix of the previous step of each region, or None
+  std::vector<std::shared_ptr<DepletionMatrix>> previous_matrices;
+
+  // Dancoff corrections of each fuel and cladding region, one per step
+  std::vector<std::vector<double>> fuel_dancoff_corrections;
+  std::vector<std::vector<double>> clad_dancoff_corrections;
+
+  // Last transport solution, for a warm start
+  double moc_keff{1.};
+  xt::xtensor<double, 3> moc_flux;
+
+  std::vector<std::shared_ptr<DiffusionData>> diffusion_data;
+
+  // Results of the branch calculations of each completed step
+  std::vector<std::vector<double>> branch_keff;
+  std::vector<std::vector<std::shared_ptr<DiffusionData>>>
+      branch_diffusion_data;
+
+  void save(const std::string& fname) const;
+  static std::shared_ptr<DepletionCheckpoint> load(const std::string& fname);
+
+  template <class Archive>
+  void serialize(Archive& arc) {
+    arc(CEREAL_NVP(completed_steps), CEREAL_NVP(keff), CEREAL_NVP(exposures),
+        CEREAL_NVP(times), CEREAL_NVP(material_histories),
+        CEREAL_NVP(previous_matrices), CEREAL_NVP(fuel_dancoff_corrections),
+        CEREAL_NVP(clad_dancoff_corrections), CEREAL_NVP(moc_keff),
+        CEREAL_NVP(moc_flux), CEREAL_NVP(diffusion_data),
+        CEREAL_NVP(branch_keff), CEREAL_NVP(branch_diffusion_data));
+  }
+};
+
+// Writes checkpoints in the background. A checkpoint is serialized in the
+// calling thread, so that it may be modified as soon as write returns, and
+// only the file is written by another thread. The file is first written
+// under a temporary name and then renamed, so that a failure while writing
+// never destroys the previous checkpoint.
+class CheckpointWriter {
+ public:
+  CheckpointWriter() = default;
+  CheckpointWriter(const CheckpointWriter&) = delete;
+  CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+  ~CheckpointWriter();
+
+  // Waits for the previous write to finish before starting this one
+  void write(const DepletionCheckpoint& checkpoint, const std::string& fname);
+
+  // Waits for the last write to finish, and raises its error if it failed
+  void wait();
+
+ private:
+  std::thread thread_;
+  std::mutex mtx_;
+  std::exception_ptr error_;
+};
+
+}  // namespace scarabee
+
+#endif
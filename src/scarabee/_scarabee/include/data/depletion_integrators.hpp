@@ -0,0 +1,44 @@
+#ifndef SCARABEE_DEPLETION_INTEGRATORS_H
+#define SCARABEE_DEPLETION_INTEGRATORS_H
+
+#include <cstddef>
+#include <vector>
+
+namespace scarabee {
+
+// Substeps of the integrators of the Bateman equation, as used by the
+// substeps of a DepletionRequest. The coefficients of each substep are given
+// for the known matrices of the stage, in the order listed for each
+// integrator, followed by the matrix built for the request. They include the
+// time step dt, with dtm1 being the previous time step.
+
+// CE/LI predictor. Known: none. Built: A0.
+std::vector<std::vector<double>> celi_predictor_substeps(double dt);
+
+// CE/LI corrector. Known: A0. Built: A1. With more than one substep, the
+// matrix is interpolated linearly between A0 and A1, and the CE/LI rule is
+// applied to each substep.
+std::vector<std::vector<double>> celi_corrector_substeps(
+    double dt, std::size_t nsubsteps = 1);
+
+// LE/QI predictor. Known: Am1. Built: A0.
+std::vector<std::vector<double>> leqi_predictor_substeps(double dt,
+                                                         double dtm1);
+
+// LE/QI corrector. Known: Am1, A0. Built: A1.
+std::vector<std::vector<double>> leqi_corrector_substeps(double dt,
+                                                         double dtm1);
+
+// Stages of the fourth order commutator-free integrator CF4, where Fi is the
+// matrix of stage i, built from the initial densities y0 for the first
+// stage, and from the result yi of stage i for the others.
+//  Stage 1: initial y0. Known: none. Built: F1 from y0. Result y1.
+//  Stage 2: initial y0. Known: none. Built: F2 from y1. Result y2.
+//  Stage 3: initial y1. Known: F1. Built: F3 from y2. Result y3.
+//  Stage 4: initial y0. Known: F1, F2, F3. Built: F4 from y3. Result is the
+//           end of the time step.
+std::vector<std::vector<double>> cf4_substeps(std::size_t stage, double dt);
+
+}  // namespace scarabee
+
+#endif
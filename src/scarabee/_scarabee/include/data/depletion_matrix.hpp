@@ -9,24 +9,39 @@
 
 #include <Eigen/SparseCore>
 
+#include <cereal/cereal.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
 #include <array>
 #include <complex>
 #include <memory>
 #include <span>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace scarabee {
 
+// Linear solver used for the CRAM poles. Elimination uses a cached symbolic
+// Gaussian elimination of the pattern, without pivoting, and factorizes all
+// poles in one pass. SparseLU is the generic partial pivoting solver of
+// Eigen, which Elimination also falls back to if a pivot vanishes.
+// ParallelSparseLU factorizes all poles concurrently with SparseLU, which is
+// worth it for a single large matrix, but not when many materials are
+// already depleted in parallel.
+enum class CRAMSolver { Elimination, SparseLU, ParallelSparseLU };
+
 class DepletionMatrix {
  public:
   DepletionMatrix(const std::vector<std::string>& nuclides);
 
-  const std::vector<std::string>& nuclides() const { return nuclides_; }
+  const std::vector<std::string>& nuclides() const { return index_->nuclides; }
   bool has_nuclide(const std::string& nuclide) const;
   std::size_t get_nuclide_index(const std::string& nuclide) const;
 
-  std::size_t size() const { return nuclides_.size(); }
+  std::size_t size() const { return index_->nuclides.size(); }
 
   double value(std::size_t row, std::size_t col) const {
     return matrix_.coeff(row, col);
@@ -41,10 +56,12 @@ class DepletionMatrix {
   bool is_compressed() const { return matrix_.isCompressed(); }
   void compress() { matrix_.makeCompressed(); }
 
-  void exponential_product(std::span<double> N, bool cram48 = false) const;
+  void exponential_product(
+      std::span<double> N, bool cram48 = false,
+      CRAMSolver solver = CRAMSolver::Elimination) const;
 
   DepletionMatrix& operator+=(const DepletionMatrix& A) {
-    if (same_nuclides(this->nuclides(), A.nuclides()) == false) {
+    if (same_nuclides(A) == false) {
       const auto mssg = "Depletion matrices do not have the same nuclides.";
       spdlog::error(mssg);
       throw ScarabeeException(mssg);
@@ -55,7 +72,7 @@ class DepletionMatrix {
   }
 
   DepletionMatrix& operator-=(const DepletionMatrix& A) {
-    if (same_nuclides(this->nuclides(), A.nuclides()) == false) {
+    if (same_nuclides(A) == false) {
       const auto mssg = "Depletion matrices do not have the same nuclides.";
       spdlog::error(mssg);
       throw ScarabeeException(mssg);
@@ -100,11 +117,63 @@ class DepletionMatrix {
   }
 
  private:
-  std::vector<std::string> nuclides_;
+  // Sorted nuclides, with the index of each. It is shared by copies of a
+  // matrix, and by all matrices made from the same template, so that copies
+  // only need to copy the values.
+  struct NuclideIndex {
+    std::vector<std::string> nuclides;
+    std::unordered_map<std::string, std::size_t> indices;
+  };
+  std::shared_ptr<const NuclideIndex> index_;
   Eigen::SparseMatrix<double> matrix_;
 
-  bool same_nuclides(const std::vector<std::string>& n1,
-                     const std::vector<std::string>& n2) const {
+  friend class DepletionMatrixTemplate;
+
+  friend class cereal::access;
+  DepletionMatrix() : index_(), matrix_() {}
+
+  // Only the nuclides and the compressed matrix are saved
+  template <class Archive>
+  void save(Archive& arc) const {
+    Eigen::SparseMatrix<double> A = matrix_;
+    A.makeCompressed();
+    const std::vector<int> outer(A.outerIndexPtr(),
+                                 A.outerIndexPtr() + A.outerSize() + 1);
+    const std::vector<int> inner(A.innerIndexPtr(),
+                                 A.innerIndexPtr() + A.nonZeros());
+    const std::vector<double> values(A.valuePtr(), A.valuePtr() + A.nonZeros());
+    arc(cereal::make_nvp("nuclides", this->nuclides()), CEREAL_NVP(outer),
+        CEREAL_NVP(inner), CEREAL_NVP(values));
+  }
+
+  template <class Archive>
+  void load(Archive& arc) {
+    std::vector<std::string> nuclides;
+    std::vector<int> outer, inner;
+    std::vector<double> values;
+    arc(CEREAL_NVP(nuclides), CEREAL_NVP(outer), CEREAL_NVP(inner),
+        CEREAL_NVP(values));
+
+    // Nuclides were saved in their sorted order
+    auto index = std::make_shared<NuclideIndex>();
+    index->nuclides = std::move(nuclides);
+    index->indices.reserve(index->nuclides.size());
+    for (std::size_t i = 0; i < index->nuclides.size(); i++) {
+      index->indices.emplace(index->nuclides[i], i);
+    }
+    index_ = index;
+
+    const int n = static_cast<int>(this->size());
+    matrix_ = Eigen::Map<const Eigen::SparseMatrix<double>>(
+        n, n, static_cast<int>(values.size()), outer.data(), inner.data(),
+        values.data());
+  }
+
+  bool same_nuclides(const DepletionMatrix& A) const {
+    if (index_ == A.index_) return true;
+
+    const auto& n1 = this->nuclides();
+    const auto& n2 = A.nuclides();
     if (n1.size() != n2.size()) return false;
 
     for (std::size_t i = 0; i < n1.size(); i++) {
@@ -117,7 +186,12 @@ class DepletionMatrix {
   void detail_exp_product(std::span<double> N,
                           std::span<const std::complex<double>> theta,
                           std::span<const std::complex<double>> alpha,
-                          double alpha0) const;
+                          double alpha0, bool parallel_poles) const;
+
+  bool elimination_exp_product(std::span<double> N,
+                               std::span<const std::complex<double>> theta,
+                               std::span<const std::complex<double>> alpha,
+                               double alpha0) const;
 
   // Static data for performing matrix exponentials
   static const std::array<std::complex<double>, 8> cram16_alpha_;
@@ -133,6 +207,55 @@ std::shared_ptr<DepletionMatrix> build_depletion_matrix(
     std::shared_ptr<DepletionChain> chain, std::shared_ptr<Material> mat,
     std::span<const double> flux, std::shared_ptr<NDLibrary> ndl);
 
+// Depletion of one material over a time step, to be evaluated along with many
+// others by deplete_materials. A new matrix A is built from the material and
+// flux, and the initial number densities are then multiplied by exp(F_s) for
+// each substep s, where F_s is the sum of matrices[k] * substeps[s][k], plus
+// A * substeps[s].back(). The time step is part of the coefficients.
+struct DepletionRequest {
+  std::shared_ptr<Material> material;  // Material used to build A
+  std::shared_ptr<Material> initial;   // Initial number densities
+  std::vector<double> flux;
+  std::vector<std::shared_ptr<DepletionMatrix>> matrices;
+  std::vector<std::vector<double>> substeps;
+  bool clear_micro_xs{false};  // Clear micro xs of material once A is built
+};
+
+struct DepletionResult {
+  std::shared_ptr<DepletionMatrix> matrix;  // A
+  std::shared_ptr<Material> material;       // Depleted material
+};
+
+// Evaluates all requests in parallel, with results returned in the order of
+// the requests. The depleted materials have the temperature of the material
+// used to build A.
+std::vector<DepletionResult> deplete_materials(
+    std::shared_ptr<DepletionChain> chain,
+    const std::vector<DepletionRequest>& requests,
+    std::shared_ptr<NDLibrary> ndl, bool cram48 = false);
+
+// Comparison of the depletion of a material with a reduced chain, against
+// the depletion with the full chain, for nsteps time steps of length dt with
+// a constant flux. Relative errors are given for all nuclides of the reduced
+// chain with a number density, found with the full chain, which is at least
+// min_fraction of the total number density, so that trace nuclides do not
+// hide the errors of the others.
+struct ChainReductionError {
+  std::vector<std::string> nuclides;
+  std::vector<double> full_densities;
+  std::vector<double> reduced_densities;
+  std::vector<double> relative_errors;
+  std::string max_error_nuclide;
+  double max_relative_error{0.};
+};
+
+ChainReductionError estimate_chain_reduction_error(
+    std::shared_ptr<DepletionChain> full_chain,
+    std::shared_ptr<DepletionChain> reduced_chain,
+    std::shared_ptr<Material> mat, std::span<const double> flux,
+    std::shared_ptr<NDLibrary> ndl, double dt, std::size_t nsteps = 1,
+    double min_fraction = 1.E-10, bool cram48 = false);
+
 }  // namespace scarabee
 
 #endif
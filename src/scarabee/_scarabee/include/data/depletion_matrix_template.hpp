@@ -0,0 +1,69 @@
+#ifndef SCARABEE_DEPLETION_MATRIX_TEMPLATE_H
+#define SCARABEE_DEPLETION_MATRIX_TEMPLATE_H
+
+#include <data/compiled_depletion_chain.hpp>
+#include <data/depletion_chain.hpp>
+#include <data/depletion_matrix.hpp>
+#include <data/material.hpp>
+#include <data/micro_cross_sections.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace scarabee {
+
+// Everything needed to build the depletion matrix of a material which only
+// depends on the chain and on the nuclides of the material: the sorted list
+// of targets, a compressed skeleton of the matrix, and the position in the
+// values of the skeleton of every loss and gain term. Building a matrix is
+// then only a copy of the skeleton, and the accumulation of the reaction
+// rates at the known positions.
+class DepletionMatrixTemplate {
+ public:
+  DepletionMatrixTemplate(std::shared_ptr<const DepletionChain> chain,
+                          const std::vector<std::string>& nuclides);
+
+  // Returns the template for the chain and the nuclides of the composition,
+  // building it only if the same nuclides have not already been seen with
+  // the same chain contents. Thread safe.
+  static std::shared_ptr<const DepletionMatrixTemplate> get(
+      std::shared_ptr<const DepletionChain> chain,
+      const MaterialComposition& comp);
+
+  std::size_t size() const { return skeleton_.size(); }
+
+  // Reaction rates must be in the order of the nuclides of the template
+  std::shared_ptr<DepletionMatrix> build(
+      std::span<const DepletionReactionRates> nuc_rrs) const;
+
+ private:
+  static constexpr std::size_t NONE = std::numeric_limits<std::size_t>::max();
+
+  // Positions of the terms of one column, with gains in the order of the
+  // targets of each reaction in the compiled chain
+  struct Column {
+    std::size_t id;  // In the compiled chain
+    std::size_t diag;
+    std::array<std::vector<std::size_t>, CompiledDepletionChain::NREACTIONS>
+        gains;
+    std::vector<std::size_t> n_fission;
+  };
+
+  std::shared_ptr<const CompiledDepletionChain> chain_;
+  DepletionMatrix skeleton_;
+  std::vector<Column> columns_;
+
+  // Column of each nuclide of the material, or NONE if the nuclide is not in
+  // the chain. All other columns of the chain only have decay terms.
+  std::vector<std::size_t> rr_columns_;
+  std::vector<std::size_t> decay_columns_;
+};
+
+}  // namespace scarabee
+
+#endif
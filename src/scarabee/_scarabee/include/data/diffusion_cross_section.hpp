@@ -1,6 +1,7 @@
 #ifndef SCARABEE_DIFFUISON_CROSS_SECTIONS_H
 #define SCARABEE_DIFFUISON_CROSS_SECTIONS_H
 
+#include <data/condensation_scheme.hpp>
 #include <utils/serialization.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
@@ -11,7 +12,10 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace scarabee {
 
@@ -63,13 +67,27 @@ class DiffusionCrossSection {
     return xt::sum(xt::view(Es_, gin, xt::all()))();
   }
 
+  const xt::xtensor<double, 1>& D_array() const { return D_; }
+  const xt::xtensor<double, 1>& Ea_array() const { return Ea_; }
+  const xt::xtensor<double, 1>& Ef_array() const { return Ef_; }
+  const xt::xtensor<double, 1>& vEf_array() const { return vEf_; }
+  const xt::xtensor<double, 1>& chi_array() const { return chi_; }
+  const xt::xtensor<double, 2>& Es_array() const { return Es_; }
+
   std::shared_ptr<DiffusionCrossSection> condense(
       const std::vector<std::pair<std::size_t, std::size_t>>& groups,
       const xt::xtensor<double, 1>& flux) const;
+  std::shared_ptr<DiffusionCrossSection> condense(
+      const CondensationScheme& scheme, std::span<const double> flux) const;
 
   void save(const std::string& fname) const;
   static std::shared_ptr<DiffusionCrossSection> load(const std::string& fname);
 
+  // Portable binary representation, used for pickling
+  std::string to_bytes() const;
+  static std::shared_ptr<DiffusionCrossSection> from_bytes(
+      const std::string& data);
+
  private:
   xt::xtensor<double, 2> Es_;   // Scattering matrix
   xt::xtensor<double, 1> D_;    // Diffusion coefficients
@@ -94,6 +112,15 @@ class DiffusionCrossSection {
   }
 };
 
+// Condenses each diffusion cross section with its own flux spectrum,
+// applying the same condensation scheme to all of them. The scheme is only
+// checked once, and the cross sections are condensed in parallel.
+std::vector<std::shared_ptr<DiffusionCrossSection>>
+condense_diffusion_cross_sections(
+    const std::vector<std::shared_ptr<DiffusionCrossSection>>& xs,
+    const std::vector<xt::xtensor<double, 1>>& fluxes,
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups);
+
 }  // namespace scarabee
 
 #endif
@@ -14,7 +14,6 @@ class FluxCalculator {
     double A;
     double a;
     double sig_b;
-    std::size_t g_max;
   };
 
   FluxCalculator(const xt::xtensor<double, 1>& energy_boundaries,
@@ -53,7 +52,18 @@ class FluxCalculator {
   xt::xtensor<double, 1> chi_;
   std::vector<BackgroundNuclide> background_nuclides_;
   double A_r_, a_r_;
-  std::size_t g_max_r;
+
+  // Range of higher groups which elastically scatter into the current group
+  // for a given alpha. The scatter source is the difference of two running
+  // sums, making it O(1) per group for each distinct alpha.
+  struct ScatterWindow {
+    double a;
+    double coeff;
+    std::size_t g_up;
+
+    double source(const xt::xtensor<double, 1>& avg_energy,
+                  const xt::xtensor<double, 1>& sum, std::size_t g);
+  };
 
   double a_from_awr(double A) const {
     double res = (A - 1.) / (A + 1.);
@@ -62,7 +72,8 @@ class FluxCalculator {
 
   void generate_watt_spectrum();
 
-  double compute_scatter_source(double Sgm1, std::size_t g);
+  void add_to_sums(std::size_t g, xt::xtensor<double, 1>& sum_flux,
+                   xt::xtensor<double, 1>& sum_res_flux) const;
 };
 
 }  // namespace scarabee
@@ -9,6 +9,8 @@
 #include <cereal/types/string.hpp>
 #include <cereal/types/vector.hpp>
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <span>
@@ -73,7 +75,15 @@ class Material {
   void set_name(const std::string& new_name) { name_ = new_name; }
 
   std::size_t max_legendre_order() const { return max_l_; }
-  void set_max_legendre_order(std::size_t max_l) { max_l_ = max_l; }
+  void set_max_legendre_order(std::size_t max_l) {
+    if (max_l == max_l_) return;
+    max_l_ = max_l;
+    version_++;
+  }
+
+  // Incremented whenever a property used to compute cross sections changes,
+  // so that cross sections computed earlier may be known to still be valid
+  std::uint64_t version() const { return version_; }
 
   bool has_component(const std::string& name) const;
   double atom_density(const std::string& name) const;
@@ -127,6 +137,16 @@ class Material {
       std::span<const double> flux,
       const std::shared_ptr<const NDLibrary> ndl) const;
 
+  // Writes the reaction rates into dep_rrs, which is resized to the number of
+  // nuclides, so that the same buffer may be reused for many materials
+  void compute_depletion_reaction_rates(
+      std::span<const double> flux, const NDLibrary& ndl,
+      std::vector<DepletionReactionRates>& dep_rrs) const;
+
+  // Portable binary representation, used for pickling
+  std::string to_bytes() const;
+  static std::shared_ptr<Material> from_bytes(const std::string& data);
+
  private:
   MaterialComposition composition_;
   std::string name_;
@@ -136,6 +156,7 @@ class Material {
   double grams_per_cm3_;
   double potential_xs_;
   std::size_t max_l_{1};
+  std::uint64_t version_{0};
   bool fissile_;
   bool resonant_;
 
@@ -143,11 +164,36 @@ class Material {
   std::vector<MicroNuclideXS> micro_nuc_xs_data_;
   std::vector<MicroDepletionXS> micro_dep_xs_data_;
 
+  // Depletion xs of all nuclides, packed with one row per reaction and
+  // nuclide, so that all reaction rates are found with a single product with
+  // the flux. Kept up to date with micro_dep_xs_data_, but not serialized, so
+  // it is made again when missing.
+  struct PackedDepletionXS {
+    static constexpr std::size_t NREACTIONS = 6;
+    xt::xtensor<double, 2> xs;  // Row is reaction * nnuclides + nuclide
+    std::array<std::size_t, NREACTIONS> ngroups{};  // Groups of each reaction
+    std::vector<char> has_fission;
+  };
+  PackedDepletionXS packed_dep_xs_;
+
+  static PackedDepletionXS pack_depletion_xs(
+      const std::vector<MicroDepletionXS>& dep_xs);
+
+  // IDs of the nuclides in the NDLibrary given at construction, in the same
+  // order as in the MaterialComposition. They are not serialized, and are
+  // only used with the library they came from.
+  std::vector<std::size_t> nuclide_ids_;
+  std::uint64_t ndl_uid_{0};
+
+  std::vector<std::size_t> nuclide_ids(const NDLibrary& ndl) const;
+
   double calc_avg_molar_mass(const NDLibrary& ndl) const;
   void normalize_fractions();
 
   void initialize_inf_dil_xs(std::shared_ptr<NDLibrary> ndl, std::size_t max_l);
-  double lambda_pot_xs(std::shared_ptr<NDLibrary> ndl, std::size_t g);
+  double lambda_pot_xs(const NDLibrary& ndl,
+                       const std::vector<std::size_t>& ids,
+                       std::size_t g) const;
   std::shared_ptr<CrossSection> create_xs_from_micro_data();
   void assign_resonant_xs(const std::size_t i, const std::size_t g,
                           const ResonantOneGroupXS& res_data);
@@ -170,6 +216,29 @@ class Material {
   }
 };
 
+enum class SelfShieldingMethod { Dilution, Roman, Carlvik, RingCarlvik };
+
+// Self-shielding of one material, to be evaluated along with many others by
+// self_shield_materials. Only the parameters of the chosen method are used.
+struct SelfShieldingRequest {
+  std::shared_ptr<Material> material;
+  SelfShieldingMethod method{SelfShieldingMethod::Dilution};
+  double C{0.};              // Dancoff correction
+  double Ee{0.};             // Escape xs, for Roman and Carlvik
+  double Rfuel{0.};          // Fuel and ring radii, for RingCarlvik
+  double Rin{0.};
+  double Rout{0.};
+  std::vector<double> dils;  // Dilution of each nuclide, for Dilution
+  std::optional<std::size_t> max_l{std::nullopt};
+};
+
+// Computes the cross sections of all requests in parallel, returned in the
+// order of the requests. Requests for the same material are evaluated one
+// after the other, as each one modifies the micro xs data of the material.
+std::vector<std::shared_ptr<CrossSection>> self_shield_materials(
+    const std::vector<SelfShieldingRequest>& requests,
+    std::shared_ptr<NDLibrary> ndl);
+
 enum class MixingFraction { Atoms, Weight, Volume };
 
 std::shared_ptr<Material> mix_materials(
@@ -177,6 +246,15 @@ std::shared_ptr<Material> mix_materials(
     std::vector<double> fracs, MixingFraction f,
     std::shared_ptr<NDLibrary> ndl);
 
+// Makes many mixtures of the same materials, with the fractions indexed by
+// mixture then material. The nuclides of the materials are only merged once
+// for all mixtures. Nuclides which are only in materials with a zero
+// fraction are left out of a mixture.
+std::vector<std::shared_ptr<Material>> mix_materials_batch(
+    const std::vector<std::shared_ptr<Material>>& mats,
+    const xt::xtensor<double, 2>& fracs, MixingFraction f,
+    std::shared_ptr<NDLibrary> ndl);
+
 }  // namespace scarabee
 
 #endif
@@ -0,0 +1,86 @@
+#ifndef SCARABEE_MATERIAL_CACHE_H
+#define SCARABEE_MATERIAL_CACHE_H
+
+#include <data/material.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace scarabee {
+
+class NDLibrary;
+
+// Least recently used cache of the materials made by borated_water and
+// mix_materials, for branch and search calculations which ask for the same
+// state points many times. Requests whose parameters all agree within the
+// relative tolerance are given the same Material, so that the cross sections
+// already computed for it may be reused. The materials must therefore not
+// be modified by their users. Mixtures are keyed by the identity and version
+// of their components, which are kept alive by the cache.
+class MaterialCache {
+ public:
+  MaterialCache(std::size_t capacity = 64, double tolerance = 1.E-6);
+
+  std::shared_ptr<Material> borated_water(double boron_ppm,
+                                          double temperature, double pressure,
+                                          std::shared_ptr<NDLibrary> ndl);
+
+  std::shared_ptr<Material> mix_materials(
+      const std::vector<std::shared_ptr<Material>>& mats,
+      const std::vector<double>& fracs, MixingFraction f,
+      std::shared_ptr<NDLibrary> ndl);
+
+  std::size_t capacity() const { return capacity_; }
+  void set_capacity(std::size_t capacity);
+
+  double tolerance() const { return tol_; }
+  void set_tolerance(double tol);
+
+  std::size_t size() const;
+  std::size_t hits() const;
+  void clear();
+
+ private:
+  struct Key {
+    std::uint8_t kind;
+    std::uint64_t ndl_uid;
+    std::vector<const Material*> mats;
+    std::vector<std::uint64_t> versions;
+    std::vector<std::int64_t> params;
+
+    bool operator==(const Key&) const = default;
+  };
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+  struct Entry {
+    Key key;
+    std::shared_ptr<Material> material;
+    // Components of a mixture, which must outlive the key
+    std::vector<std::shared_ptr<Material>> components;
+  };
+
+  // Most recently used first
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> map_;
+  std::size_t capacity_;
+  double tol_;
+  std::size_t hits_{0};
+  mutable std::mutex mtx_;
+
+  void quantize(Key& key, std::span<const double> params) const;
+  std::shared_ptr<Material> find(const Key& key);
+  void insert(Key&& key, std::shared_ptr<Material> material,
+              std::vector<std::shared_ptr<Material>> components);
+  void evict();
+};
+
+}  // namespace scarabee
+
+#endif
@@ -5,18 +5,28 @@
 #include <data/cross_section.hpp>
 #include <data/micro_cross_sections.hpp>
 #include <data/depletion_chain.hpp>
+#include <data/nd_precision.hpp>
+#include <utils/memory_usage.hpp>
 
+#include <xtensor/containers/xadapt.hpp>
 #include <xtensor/containers/xtensor.hpp>
 
 #include <highfive/highfive.hpp>
 
 namespace H5 = HighFive;
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <future>
+#include <initializer_list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -24,6 +34,31 @@ namespace scarabee {
 
 class NDLibrary;
 
+// Read only nuclear data array, which does not own its memory. The
+// shared_ptr holding it keeps alive either the buffer read from the HDF5
+// file, or the mapping of a binary library.
+template <typename T, std::size_t N>
+using NDArray = decltype(xt::adapt(std::declval<T*>(), std::size_t(),
+                                   xt::no_ownership(),
+                                   std::declval<std::array<std::size_t, N>>()));
+
+// Atomic flag which may be copied along with the NuclideHandle holding it
+class LoadedFlag {
+ public:
+  LoadedFlag() = default;
+  LoadedFlag(const LoadedFlag& o) : value_(o.get()) {}
+  LoadedFlag& operator=(const LoadedFlag& o) {
+    set(o.get());
+    return *this;
+  }
+
+  bool get() const { return value_.load(std::memory_order_acquire); }
+  void set(bool v) { value_.store(v, std::memory_order_release); }
+
+ private:
+  std::atomic<bool> value_{false};
+};
+
 struct NuclideHandle {
   std::string name;
   std::string label;
@@ -38,38 +73,47 @@ struct NuclideHandle {
   bool resonant;
 
   // Packing structure for scattering matrices, both inf and res !
-  std::shared_ptr<xt::xtensor<std::uint32_t, 2>> packing;
+  std::shared_ptr<const NDArray<std::uint32_t, 2>> packing;
 
   // Nu and chi are independent of temperature AND dilution in Scarabée
-  std::shared_ptr<xt::xtensor<double, 1>> chi;
-  std::shared_ptr<xt::xtensor<double, 1>> nu;
+  std::shared_ptr<const NDArray<NDReal, 1>> chi;
+  std::shared_ptr<const NDArray<NDReal, 1>> nu;
 
   // Infinite dilution data, only dependent on temperature
-  std::shared_ptr<xt::xtensor<double, 2>> inf_absorption;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_transport_correction;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_scatter;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_p1_scatter;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_p2_scatter;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_p3_scatter;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_fission;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_n_gamma;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_n_2n;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_n_3n;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_n_a;
-  std::shared_ptr<xt::xtensor<double, 2>> inf_n_p;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_absorption;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_transport_correction;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_scatter;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_p1_scatter;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_p2_scatter;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_p3_scatter;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_fission;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_n_gamma;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_n_2n;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_n_3n;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_n_a;
+  std::shared_ptr<const NDArray<NDReal, 2>> inf_n_p;
 
   // Dilution dependent data
   // First index temperature, second dilution
-  std::shared_ptr<xt::xtensor<double, 3>> res_absorption;
-  std::shared_ptr<xt::xtensor<double, 3>> res_transport_correction;
-  std::shared_ptr<xt::xtensor<double, 3>> res_scatter;
-  std::shared_ptr<xt::xtensor<double, 3>> res_p1_scatter;
-  std::shared_ptr<xt::xtensor<double, 3>> res_p2_scatter;
-  std::shared_ptr<xt::xtensor<double, 3>> res_p3_scatter;
-  std::shared_ptr<xt::xtensor<double, 3>> res_fission;
-  std::shared_ptr<xt::xtensor<double, 3>> res_n_gamma;
-
-  bool loaded() const { return inf_absorption != nullptr; }
+  std::shared_ptr<const NDArray<NDReal, 3>> res_absorption;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_transport_correction;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_scatter;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_p1_scatter;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_p2_scatter;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_p3_scatter;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_fission;
+  std::shared_ptr<const NDArray<NDReal, 3>> res_n_gamma;
+
+  // Keeps the data alive while it is shared with the NuclideHandles of other
+  // NDLibrary instances reading the same file
+  std::shared_ptr<const NuclideHandle> shared_data;
+  LoadedFlag loaded_flag;
+
+  // Once true, the data may be read from any thread without locking
+  bool loaded() const { return loaded_flag.get(); }
+  // Thread safe. Reads are serialized through a single lock on all HDF5
+  // files, and data already loaded by another NDLibrary for the same file
+  // is shared instead of read again.
   void load_xs_from_hdf5(const NDLibrary& ndl, std::size_t max_l);
   void load_inf_data(const NDLibrary& ndl, const H5::Group& grp,
                      std::size_t max_l);
@@ -77,10 +121,20 @@ struct NuclideHandle {
   void unload();
 };
 
+// One lookup in the resonance tables of a nuclide, evaluated by
+// NDLibrary::dilution_xs_batch
+struct DilutionQuery {
+  std::size_t nuclide;  // ID of the nuclide in the library
+  std::size_t group;    // Global index of a resonant energy group
+  double temperature;
+  double dilution;
+};
+
 class NDLibrary {
  public:
   NDLibrary();
   NDLibrary(const std::string& fname);
+  ~NDLibrary();
 
   std::size_t ngroups() const { return ngroups_; }
 
@@ -107,20 +161,39 @@ class NDLibrary {
     return cmfd_condensation_scheme_;
   }
 
+  // Index of the nuclide in this library. Looking a handle up by its ID is
+  // only an array access, so callers which repeatedly use the same nuclides
+  // should find their IDs once.
+  std::size_t nuclide_id(const std::string& name) const;
+
   NuclideHandle& get_nuclide(const std::string& name);
   const NuclideHandle& get_nuclide(const std::string& name) const;
 
+  NuclideHandle& get_nuclide(std::size_t id) { return nuclide_handles_[id]; }
+  const NuclideHandle& get_nuclide(std::size_t id) const {
+    return nuclide_handles_[id];
+  }
+
   std::pair<MicroNuclideXS, MicroDepletionXS> infinite_dilution_xs(
       const std::string& name, const double temp, std::size_t max_l = 1);
+  std::pair<MicroNuclideXS, MicroDepletionXS> infinite_dilution_xs(
+      std::size_t id, const double temp, std::size_t max_l = 1);
 
   ResonantOneGroupXS dilution_xs(const std::string& name, std::size_t g,
                                  const double temp, const double dil,
                                  std::size_t max_l = 1);
+  ResonantOneGroupXS dilution_xs(std::size_t id, std::size_t g,
+                                 const double temp, const double dil,
+                                 std::size_t max_l = 1);
 
   ResonantOneGroupXS two_term_xs(const std::string& name, std::size_t g,
                                  const double temp, const double b1,
                                  const double b2, const double bg_xs_1,
                                  const double bg_xs_2, std::size_t max_l = 1);
+  ResonantOneGroupXS two_term_xs(std::size_t id, std::size_t g,
+                                 const double temp, const double b1,
+                                 const double b2, const double bg_xs_1,
+                                 const double bg_xs_2, std::size_t max_l = 1);
 
   ResonantOneGroupXS ring_two_term_xs(const std::string& name, std::size_t g,
                                       const double temp, const double a1,
@@ -129,13 +202,81 @@ class NDLibrary {
                                       const double N, const double Rfuel,
                                       const double Rin, const double Rout,
                                       std::size_t max_l = 1);
+  ResonantOneGroupXS ring_two_term_xs(std::size_t id, std::size_t g,
+                                      const double temp, const double a1,
+                                      const double a2, const double b1,
+                                      const double b2, const double mat_pot_xs,
+                                      const double N, const double Rfuel,
+                                      const double Rin, const double Rout,
+                                      std::size_t max_l = 1);
+
+  // Memoization of the results of two_term_xs and ring_two_term_xs. Queries
+  // of a nuclide and group whose temperature and escape parameters all agree
+  // within the relative tolerance share one result, so that the many pins
+  // of a lattice with nearly the same background are only interpolated
+  // once. The cache is shared by all materials using the library, and
+  // should be cleared at each step in which the compositions or
+  // temperatures change. A tolerance of zero only reuses identical queries.
+  bool xs_cache() const { return xs_cache_; }
+  void set_xs_cache(bool cache);
+  double xs_cache_tolerance() const { return xs_cache_tol_; }
+  void set_xs_cache_tolerance(double tol);
+  void clear_xs_cache();
+  std::size_t xs_cache_size() const;
+  std::size_t xs_cache_hits() const;
+
+  // Interpolates the resonant cross sections of many queries at once. The
+  // rows of out, which must have shape (5, queries.size()), receive Dtr, Ea,
+  // Ef, n_gamma, and the P0 scattering xs summed over all outgoing groups.
+  // Reactions which are not tabulated for a nuclide are set to zero. Queries
+  // of the same nuclide should be contiguous, as tables are looked up once
+  // per run of queries.
+  void dilution_xs_batch(std::span<const DilutionQuery> queries,
+                         xt::xtensor<double, 2>& out);
 
   const std::shared_ptr<H5::File>& h5() const { return h5_; }
 
+  // Identifier which is unique to this instance in the process
+  std::uint64_t uid() const { return uid_; }
+
+  // Canonical path of the HDF5 file
+  const std::string& file_name() const { return fname_; }
+
+  // Writes the data of all nuclides to a flat binary file, with every
+  // array aligned, which can later be memory mapped by map_binary
+  void save_binary(const std::string& fname) const;
+
+  // Memory maps a binary file written by save_binary for this library. The
+  // data of all nuclides then become views of the mapped pages, which are
+  // only read from the disk when first accessed, and are shared by all
+  // processes mapping the same file.
+  void map_binary(const std::string& fname);
+
+  // Loads the data of many nuclides at once, so that they may then be
+  // used concurrently without any further I/O
+  void load_nuclides(const std::vector<std::string>& names,
+                     std::size_t max_l = 1);
+
+  // Starts loading the data of many nuclides on another thread, so that the
+  // file is read while the model is still being built. Nuclides which are
+  // used before they have been read are loaded by the caller, or waited for
+  // if their read has already started. Unknown names raise an error at once.
+  void prefetch(const std::vector<std::string>& names, std::size_t max_l = 1);
+  // Waits for all prefetches to finish, and raises the error of any which
+  // failed
+  void wait_prefetch();
+  bool prefetching() const;
+
   void unload();
 
+  // Bytes of nuclear data of the loaded nuclides, by component. Data shared
+  // with other libraries reading the same file, or mapped from a binary
+  // library, are counted in full.
+  MemoryUsage memory_usage() const;
+
  private:
-  std::map<std::string, NuclideHandle> nuclide_handles_;
+  std::vector<NuclideHandle> nuclide_handles_;
+  std::unordered_map<std::string, std::size_t> nuclide_ids_;
   std::vector<double> group_bounds_;
   std::optional<std::vector<std::pair<std::size_t, std::size_t>>>
       condensation_scheme_;
@@ -146,23 +287,64 @@ class NDLibrary {
   std::size_t ngroups_;
   std::size_t first_resonant_group_;
   std::size_t last_resonant_group_;
+  std::string fname_;
+  std::uint64_t uid_;
   std::shared_ptr<H5::File> h5_;
   std::shared_ptr<DepletionChain> depletion_chain_;
+  std::vector<std::future<void>> prefetches_;
+  mutable std::mutex prefetch_mtx_;
+
+  // Nuclide, group, max_l, and the quantized temperature and escape
+  // parameters of a self-shielding query
+  struct XSCacheKey {
+    std::size_t id;
+    std::size_t g;
+    std::size_t max_l;
+    std::vector<std::int64_t> params;
+
+    bool operator==(const XSCacheKey&) const = default;
+  };
+  struct XSCacheKeyHash {
+    std::size_t operator()(const XSCacheKey& key) const;
+  };
+
+  bool xs_cache_{false};
+  double xs_cache_tol_{1.E-6};
+  std::unordered_map<XSCacheKey, ResonantOneGroupXS, XSCacheKeyHash>
+      xs_cache_map_;
+  std::size_t xs_cache_hits_{0};
+  mutable std::mutex xs_cache_mtx_;
 
   NDLibrary(const NDLibrary&) = delete;
   NDLibrary& operator=(const NDLibrary&) = delete;
 
   void init();
 
+  XSCacheKey xs_cache_key(std::size_t id, std::size_t g, std::size_t max_l,
+                          std::initializer_list<double> params) const;
+  std::optional<ResonantOneGroupXS> find_cached_xs(const XSCacheKey& key);
+  void cache_xs(XSCacheKey&& key, const ResonantOneGroupXS& xs);
+
+  ResonantOneGroupXS interp_two_term_xs(std::size_t id, std::size_t g,
+                                        const double temp, const double b1,
+                                        const double b2, const double bg_xs_1,
+                                        const double bg_xs_2,
+                                        std::size_t max_l);
+  ResonantOneGroupXS interp_ring_two_term_xs(
+      std::size_t id, std::size_t g, const double temp, const double a1,
+      const double a2, const double b1, const double b2,
+      const double mat_pot_xs, const double N, const double Rfuel,
+      const double Rin, const double Rout, std::size_t max_l);
+
   void get_temp_interp_params(double temp, const NuclideHandle& nuc,
                               std::size_t& i, double& f) const;
   void get_dil_interp_params(double dil, const NuclideHandle& nuc,
                              std::size_t& i, double& f) const;
 
-  void interp_temp(xt::xtensor<double, 1>& E, const xt::xtensor<double, 2>& nE,
+  void interp_temp(xt::xtensor<double, 1>& E, const NDArray<NDReal, 2>& nE,
                    std::size_t it, double f_temp) const;
 
-  double interp_temp_dil(const xt::xtensor<double, 3>& nE, std::size_t g,
+  double interp_temp_dil(const NDArray<NDReal, 3>& nE, std::size_t g,
                          std::size_t it, double f_temp, std::size_t id,
                          double f_dil) const;
 
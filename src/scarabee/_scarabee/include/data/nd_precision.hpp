@@ -0,0 +1,19 @@
+#ifndef SCARABEE_ND_PRECISION_H
+#define SCARABEE_ND_PRECISION_H
+
+namespace scarabee {
+
+// Floating point type used to store the tables of a nuclear data library,
+// whether read from the HDF5 file or mapped from a binary library. Building
+// with SCARABEE_SINGLE_PRECISION_ND stores them in single precision, which
+// halves the memory held by the loaded nuclides. All interpolations and the
+// resulting cross sections are always computed in double precision.
+#ifdef SCARABEE_SINGLE_PRECISION_ND
+using NDReal = float;
+#else
+using NDReal = double;
+#endif
+
+}  // namespace scarabee
+
+#endif
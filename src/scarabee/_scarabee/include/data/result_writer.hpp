@@ -0,0 +1,96 @@
+#ifndef SCARABEE_RESULT_WRITER_H
+#define SCARABEE_RESULT_WRITER_H
+
+#include <xtensor/containers/xarray.hpp>
+#include <xtensor/containers/xtensor.hpp>
+
+#include <highfive/highfive.hpp>
+
+namespace H5 = HighFive;
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace scarabee {
+
+class MOCDriver;
+class NEMDiffusionDriver;
+
+// Writes large solver results to an HDF5 file, straight from the arrays of
+// the solvers, so that they never go through Python. Each field is a chunked
+// dataset, which is compressed with deflate when the HDF5 library has the
+// filter. In the background, a field is copied when it is written, so that
+// the solver may go on at once, and only the file is written by another
+// thread. One file is usually written per depletion step or branch, by
+// opening a new file with the same writer.
+class ResultWriter {
+ public:
+  ResultWriter(const std::string& fname, bool background = false);
+  ResultWriter(const ResultWriter&) = delete;
+  ResultWriter& operator=(const ResultWriter&) = delete;
+  ~ResultWriter();
+
+  const std::string& file_name() const { return fname_; }
+  bool background() const { return background_; }
+
+  // Deflate level, from 0 for no compression to 9. Default is 4.
+  std::size_t compression() const { return compression_; }
+  void set_compression(std::size_t level);
+
+  // Waits for the last write to finish, closes the current file, and
+  // creates the new one, replacing any previous file of that name
+  void open(const std::string& fname);
+
+  // Each field is written at a path in the file, whose groups are created
+  // as needed. A field written again at the same path replaces the old one.
+  void write(const std::string& path, const xt::xarray<double>& data);
+
+  // Scalar flux of a solved MOCDriver, indexed by group then FSR
+  void write_flux(const std::string& path, const MOCDriver& moc);
+
+  // Result of tally t of a MOCDriver, indexed by set then group
+  void write_tally(const std::string& path, const MOCDriver& moc,
+                   std::size_t t);
+
+  // Node average flux of a solved NEMDiffusionDriver
+  void write_flux(const std::string& path, const NEMDiffusionDriver& nem);
+
+  // Pin powers reconstructed at the heights z, in the dataset power of the
+  // group at path, with the pin bounds in the datasets x and y
+  void write_pin_power(const std::string& path, const NEMDiffusionDriver& nem,
+                       const xt::xtensor<double, 1>& z);
+
+  // Attribute of the root of the file, such as the burnup or keff
+  void set_attribute(const std::string& name, double value);
+
+  // Waits for the last write to finish, and raises its error if it failed
+  void wait();
+
+  // Waits for the last write to finish, and closes the file
+  void close();
+
+ private:
+  std::string fname_;
+  std::unique_ptr<H5::File> file_;
+  bool background_;
+  std::size_t compression_{4};
+  std::thread thread_;
+  std::mutex mtx_;
+  std::exception_ptr error_;
+
+  void check_open() const;
+  // Writes the field now, or copies it and writes it in the background
+  void write_array(const std::string& path, const double* data,
+                   const std::vector<std::size_t>& dims);
+  void write_dataset(const std::string& path, const double* data,
+                     const std::vector<std::size_t>& dims) const;
+};
+
+}  // namespace scarabee
+
+#endif
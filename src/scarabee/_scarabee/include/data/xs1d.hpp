@@ -30,6 +30,8 @@ class XS1D {
 
   double xs_fast(const std::size_t g) const { return xs_(g); }
 
+  const xt::xtensor<double, 1>& values() const { return xs_; }
+
   void set_value(const std::size_t g, const double v) {
     if (g >= xs_.size()) {
       const auto mssg = "Group index is out of range.";
@@ -57,7 +59,7 @@ class XS1D {
     return out;
   }
 
-  XS1D& operator+=(const XS1D xs2) {
+  XS1D& operator+=(const XS1D& xs2) {
     if (this->ngroups() < xs2.ngroups()) {
       this->resize(xs2.ngroups());
     }
@@ -67,7 +69,7 @@ class XS1D {
     return *this;
   }
 
-  XS1D& operator-=(const XS1D xs2) {
+  XS1D& operator-=(const XS1D& xs2) {
     if (this->ngroups() < xs2.ngroups()) {
       this->resize(xs2.ngroups());
     }
@@ -77,6 +79,17 @@ class XS1D {
     return *this;
   }
 
+  // Adds a * xs2, without any temporary
+  XS1D& axpy(const double a, const XS1D& xs2) {
+    if (this->ngroups() < xs2.ngroups()) {
+      this->resize(xs2.ngroups());
+    }
+
+    for (std::size_t g = 0; g < xs2.ngroups(); g++) xs_(g) += a * xs2.xs_(g);
+
+    return *this;
+  }
+
   XS1D& operator*=(const double v) {
     xs_ *= v;
     return *this;
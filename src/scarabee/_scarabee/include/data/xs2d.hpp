@@ -1,6 +1,7 @@
 #ifndef SCARABEE_XS2D_H
 #define SCARABEE_XS2D_H
 
+#include <data/condensation_scheme.hpp>
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/serialization.hpp>
@@ -12,7 +13,10 @@
 
 #include <cmath>
 #include <cstdint>
+#include <span>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace scarabee {
 
@@ -361,49 +365,132 @@ class XS2D {
 
   const xt::xtensor<std::uint32_t, 2>& packing() const { return packing_; }
 
-  XS2D zeros_like() const {
-    XS2D out(*this);
-    out.xs_.fill(0.);
-    return out;
-  }
+  // Compressed data, indexed by legendre moment and packed entry
+  const xt::xtensor<double, 2>& data() const { return xs_; }
 
-  XS2D& operator+=(const XS2D& xs2) {
-    if (ngroups() != xs2.ngroups()) {
-      const auto mssg =
-          "Cross section matrices have different number of groups.";
-      spdlog::error(mssg);
-      throw ScarabeeException(mssg);
+  // Unpacked matrix of all moments, indexed by (l, gin, gout)
+  xt::xtensor<double, 3> dense() const {
+    const std::size_t NG = ngroups();
+    xt::xtensor<double, 3> out =
+        xt::zeros<double>({max_legendre_order() + 1, NG, NG});
+
+    for (std::size_t l = 0; l <= max_legendre_order(); l++) {
+      for (std::size_t gin = 0; gin < NG; gin++) {
+        const std::size_t g_min = packing_(gin, 1);
+        const auto row = this->band(l, gin);
+        for (std::size_t k = 0; k < row.size(); k++) {
+          out(l, gin, g_min + k) = row[k];
+        }
+      }
     }
 
-    // Make the packing format compatible
-    this->repack_to_be_compatible(xs2.packing_);
+    return out;
+  }
 
-    // Must deal with unequal legendre orders
-    if (max_legendre_order() < xs2.max_legendre_order()) {
-      const std::size_t NL = std::max(this->xs_.shape()[0], xs2.xs_.shape()[0]);
-      xt::xtensor<double, 2> new_xs = xt::zeros<double>({NL, xs_.shape()[1]});
+  // Lowest and highest outgoing groups stored for incident group gin. All
+  // entries outside of this band are zero.
+  std::size_t band_min(const std::size_t gin) const {
+    return packing_(gin, 1);
+  }
+  std::size_t band_max(const std::size_t gin) const {
+    return packing_(gin, 2);
+  }
 
-      xt::view(new_xs, xt::range(0, xs_.shape()[0]), xt::all()) = xs_;
-      xs_ = new_xs;
+  // Stored values of moment l for incident group gin, from outgoing group
+  // band_min(gin) to band_max(gin). No bounds are checked, and l must be at
+  // most max_legendre_order().
+  std::span<const double> band(const std::size_t l,
+                               const std::size_t gin) const {
+    return {xs_.data() + l * xs_.shape()[1] + packing_(gin, 0),
+            1 + packing_(gin, 2) - packing_(gin, 1)};
+  }
+
+  // Adds the scattering of moment l out of the flux of all incident groups:
+  // src(gout) += a * sum_gin Es(l, gin, gout) * flux(gin). Both flux and src
+  // are 1D containers or views indexed by group.
+  template <typename F, typename S>
+  void scatter(const std::size_t l, const F& flux, S& src,
+               const double a = 1.) const {
+    if (l > this->max_legendre_order()) return;
+
+    for (std::size_t gin = 0; gin < ngroups(); gin++) {
+      const double flx = a * flux(gin);
+      if (flx == 0.) continue;
+
+      const std::size_t g_min = packing_(gin, 1);
+      const auto row = this->band(l, gin);
+      for (std::size_t k = 0; k < row.size(); k++) {
+        src(g_min + k) += row[k] * flx;
+      }
     }
+  }
 
-    // Shapes are now completely equivalent.
+  // Adds wgt[gin] * Es(l, gin, gout) to dense(l, gin, gout) for all stored
+  // entries. dense must have at least max_legendre_order() + 1 moments.
+  void add_weighted_to(xt::xtensor<double, 3>& dense,
+                       std::span<const double> wgt) const {
     for (std::size_t l = 0; l <= max_legendre_order(); l++) {
-      for (std::size_t g = 0; g < ngroups(); g++) {
-        const auto strt = packing_(g, 0);
-        const auto g_min = packing_(g, 1);
-        const auto g_max = packing_(g, 2);
+      for (std::size_t gin = 0; gin < ngroups(); gin++) {
+        const std::size_t g_min = packing_(gin, 1);
+        const auto row = this->band(l, gin);
+        for (std::size_t k = 0; k < row.size(); k++) {
+          dense(l, gin, g_min + k) += wgt[gin] * row[k];
+        }
+      }
+    }
+  }
 
-        for (std::size_t gg = g_min; gg <= g_max; gg++) {
-          xs_(l, strt + gg - g_min) += xs2(l, g, gg);
+  // Condenses the matrix to the macro groups of the scheme, weighting the
+  // incident groups with the flux:
+  // out(l, G, GG) = sum_{g in G} flux(g) / flux(G) sum_{gg in GG} Es(l, g, gg)
+  xt::xtensor<double, 3> condense(const CondensationScheme& scheme,
+                                  std::span<const double> flux) const {
+    const std::size_t NGOUT = scheme.ncondensed_groups();
+    const auto macro_group = scheme.macro_groups();
+
+    auto out = xt::xtensor<double, 3>::from_shape(
+        {max_legendre_order() + 1, NGOUT, NGOUT});
+    out.fill(0.);
+    for (std::size_t G = 0; G < NGOUT; G++) {
+      const std::size_t g_min = scheme.groups()[G].first;
+      const std::size_t g_max = scheme.groups()[G].second;
+
+      double flux_G = 0.;
+      for (std::size_t g = g_min; g <= g_max; g++) flux_G += flux[g];
+      const double invs_flux_G = 1. / flux_G;
+
+      for (std::size_t l = 0; l <= max_legendre_order(); l++) {
+        // Rows of the output are contiguous, so each band is scattered into
+        // a single row of macro groups
+        double* out_G = &out(l, G, 0);
+        for (std::size_t g = g_min; g <= g_max; g++) {
+          const double w = flux[g] * invs_flux_G;
+          const std::size_t gg_min = packing_(g, 1);
+          const std::size_t* macro_gg = macro_group.data() + gg_min;
+          const auto row = this->band(l, g);
+          for (std::size_t k = 0; k < row.size(); k++) {
+            out_G[macro_gg[k]] += w * row[k];
+          }
         }
       }
     }
 
-    return *this;
+    return out;
   }
 
-  XS2D& operator-=(const XS2D& xs2) {
+  XS2D zeros_like() const {
+    XS2D out(*this);
+    out.xs_.fill(0.);
+    return out;
+  }
+
+  XS2D& operator+=(const XS2D& xs2) { return this->axpy(1., xs2); }
+
+  XS2D& operator-=(const XS2D& xs2) { return this->axpy(-1., xs2); }
+
+  // Adds a * xs2 directly from the packed data of xs2, without any temporary
+  // matrix. The packing is only widened if xs2 has entries outside of it.
+  XS2D& axpy(const double a, const XS2D& xs2) {
     if (ngroups() != xs2.ngroups()) {
       const auto mssg =
           "Cross section matrices have different number of groups.";
@@ -423,15 +510,16 @@ class XS2D {
       xs_ = new_xs;
     }
 
-    // Shapes are now completely equivalent.
-    for (std::size_t l = 0; l <= max_legendre_order(); l++) {
+    // The band of xs2 is now within ours, for every incident group
+    for (std::size_t l = 0; l <= xs2.max_legendre_order(); l++) {
       for (std::size_t g = 0; g < ngroups(); g++) {
-        const auto strt = packing_(g, 0);
-        const auto g_min = packing_(g, 1);
-        const auto g_max = packing_(g, 2);
+        const std::size_t src = xs2.packing_(g, 0);
+        const std::size_t len = 1 + xs2.packing_(g, 2) - xs2.packing_(g, 1);
+        const std::size_t dst =
+            packing_(g, 0) + xs2.packing_(g, 1) - packing_(g, 1);
 
-        for (std::size_t gg = g_min; gg <= g_max; gg++) {
-          xs_(l, strt + gg - g_min) -= xs2(l, g, gg);
+        for (std::size_t k = 0; k < len; k++) {
+          xs_(l, dst + k) += a * xs2.xs_(l, src + k);
         }
       }
     }
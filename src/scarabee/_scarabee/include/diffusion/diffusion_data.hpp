@@ -147,6 +147,10 @@ class DiffusionData {
   void save(const std::string& fname) const;
   static std::shared_ptr<DiffusionData> load(const std::string& fname);
 
+  // Portable binary representation, used for pickling
+  std::string to_bytes() const;
+  static std::shared_ptr<DiffusionData> from_bytes(const std::string& data);
+
  private:
   std::shared_ptr<DiffusionCrossSection> xs_;
   xt::xtensor<double, 2> form_factors_;
@@ -2,9 +2,11 @@
 #define SCARABEE_DIFFUSION_GEOMETRY_H
 
 #include <diffusion/diffusion_data.hpp>
+#include <diffusion/diffusion_symmetry.hpp>
 #include <utils/serialization.hpp>
 
 #include <xtensor/containers/xarray.hpp>
+#include <xtensor/containers/xtensor.hpp>
 
 #include <cereal/cereal.hpp>
 #include <cereal/types/memory.hpp>
@@ -12,9 +14,11 @@
 #include <cereal/types/vector.hpp>
 #include <cereal/archives/portable_binary.hpp>
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -39,6 +43,16 @@ class DiffusionGeometry {
 
   enum class Neighbor : std::uint8_t { XN, XP, YN, YP, ZN, ZP };
 
+  // Precomputed connectivity of one face of a material
+  struct Face {
+    std::optional<std::size_t> mat;  // Neighboring material, if any
+    std::optional<double> albedo;    // Albedo of the boundary or albedo tile
+    bool same_tile{false};  // True if the neighboring material is in the tile
+    // Face of the neighboring material which touches this face. It is the
+    // opposite face, except on the faces coupled by rotational symmetry.
+    Neighbor nb_face{Neighbor::XN};
+  };
+
   DiffusionGeometry(const std::vector<TileFill>& tiles,
                     const std::vector<double>& dx,
                     const std::vector<std::size_t>& xdivs, double albedo_xn,
@@ -49,14 +63,16 @@ class DiffusionGeometry {
                     const std::vector<std::size_t>& xdivs,
                     const std::vector<double>& dy,
                     const std::vector<std::size_t>& ydivs, double albedo_xn,
-                    double albedo_xp, double albedo_yn, double albedo_yp);
+                    double albedo_xp, double albedo_yn, double albedo_yp,
+                    DiffusionSymmetry symmetry = DiffusionSymmetry::Full);
 
   DiffusionGeometry(
       const std::vector<TileFill>& tiles, const std::vector<double>& dx,
       const std::vector<std::size_t>& xdivs, const std::vector<double>& dy,
       const std::vector<std::size_t>& ydivs, const std::vector<double>& dz,
       const std::vector<std::size_t>& zdivs, double albedo_xn, double albedo_xp,
-      double albedo_yn, double albedo_yp, double albedo_zn, double albedo_zp);
+      double albedo_yn, double albedo_yp, double albedo_zn, double albedo_zp,
+      DiffusionSymmetry symmetry = DiffusionSymmetry::Full);
 
   std::size_t ngroups() const;
   std::size_t ndims() const {
@@ -71,10 +87,65 @@ class DiffusionGeometry {
 
   std::pair<Tile, std::optional<std::size_t>> neighbor(std::size_t m,
                                                        Neighbor n) const;
+
+  // Unchecked table lookups, for the assembly loops of the drivers. The
+  // geometry index has zeros for the dimensions which are not used.
+  const Face& face(std::size_t m, Neighbor n) const {
+    return faces_[6 * m + static_cast<std::size_t>(n)];
+  }
+  const std::array<std::size_t, 3>& mat_ijk(std::size_t m) const {
+    return mat_ijk_[m];
+  }
+
+  // Width of material m normal to its face n
+  double width(std::size_t m, Neighbor n) const {
+    const std::size_t a = static_cast<std::size_t>(n) / 2;
+    if (a == 0) return dx(mat_ijk_[m][0]);
+    if (a == 1) return dy(mat_ijk_[m][1]);
+    return dz(mat_ijk_[m][2]);
+  }
+
+  // ADF of material m on its face n
+  double adf(std::size_t m, Neighbor n, std::size_t g) const;
+
+  // When only a quadrant of the core is described, the full core spans
+  // [0, 2 x_max] x [0, 2 y_max], with the quadrant in the upper right. These
+  // map a point or a mesh index of the full core to that of the quadrant,
+  // and give the mesh bounds of the full core.
+  DiffusionSymmetry symmetry() const { return symmetry_; }
+  std::pair<double, double> fold_xy(double x, double y) const;
+  std::pair<std::size_t, std::size_t> fold_ij(std::size_t i,
+                                              std::size_t j) const;
+  std::size_t unfolded_nx() const {
+    return symmetry_ == DiffusionSymmetry::Full ? nx_ : 2 * nx_;
+  }
+  std::size_t unfolded_ny() const {
+    return symmetry_ == DiffusionSymmetry::Full ? ny_ : 2 * ny_;
+  }
+  std::vector<double> unfolded_x_bounds() const;
+  std::vector<double> unfolded_y_bounds() const;
+  std::vector<double> unfolded_tile_dx() const;
+  std::vector<double> unfolded_tile_dy() const;
+
   const std::shared_ptr<DiffusionData>& mat(std::size_t m) const;
   const std::shared_ptr<DiffusionData>& mat(
       const xt::svector<std::size_t>& geo_indx) const;
   xt::svector<std::size_t> geom_indx(std::size_t m) const;
+
+  // Replaces the cross sections of the material tile with the given tile
+  // index, leaving the mesh unchanged. Drivers using this geometry then
+  // solve with the new data, starting from their previous solution.
+  void set_tile_xs(const std::vector<std::size_t>& tile_indx,
+                   std::shared_ptr<DiffusionData> xs);
+  // Replaces the cross sections of many material tiles at once, such as all
+  // nodes of a core after a feedback update, rebuilding the connectivity of
+  // the geometry only once
+  void set_tiles_xs(const std::vector<std::vector<std::size_t>>& tile_indices,
+                    const std::vector<std::shared_ptr<DiffusionData>>& xs);
+  // Replaces old_xs by new_xs in all tiles, and returns the number of tiles
+  // which were changed
+  std::size_t replace_xs(const std::shared_ptr<DiffusionData>& old_xs,
+                         std::shared_ptr<DiffusionData> new_xs);
   std::optional<std::size_t> geom_to_mat_indx(
       const xt::svector<std::size_t>& geo_indx) const;
   double volume(std::size_t m) const;
@@ -107,7 +178,25 @@ class DiffusionGeometry {
   const std::vector<double> tile_dx() const { return tile_dx_; }
   const std::vector<double> tile_dy() const { return tile_dy_; }
   const std::vector<double> tile_dz() const { return tile_dz_; }
+  const std::vector<std::size_t>& x_divs_per_tile() const {
+    return x_divs_per_tile_;
+  }
+  const std::vector<std::size_t>& y_divs_per_tile() const {
+    return y_divs_per_tile_;
+  }
+  const std::vector<std::size_t>& z_divs_per_tile() const {
+    return z_divs_per_tile_;
+  }
   double form_factor(double x, double y, double z) const;
+  // Form factors of every pin of the whole core at the axial positions z,
+  // indexed as (x, y, z). Each tile holds x_shp by y_shp pins. Tiles without
+  // form factors, and positions outside the core, have a form factor of 1.
+  xt::xtensor<double, 3> form_factor_grid(std::size_t x_shp, std::size_t y_shp,
+                                          const xt::xtensor<double, 1>& z) const;
+
+  // Portable binary representation, used for pickling
+  std::string to_bytes() const;
+  static std::shared_ptr<DiffusionGeometry> from_bytes(const std::string& data);
 
  private:
   xt::xarray<Tile> tiles_;
@@ -132,10 +221,20 @@ class DiffusionGeometry {
 
   std::size_t nx_, ny_, nz_;
   xt::svector<std::size_t> geom_shape_;
+  DiffusionSymmetry symmetry_{DiffusionSymmetry::Full};
+
+  // Connectivity tables, built from the tiles after construction or loading
+  std::vector<std::array<std::size_t, 3>> mat_ijk_;
+  std::vector<std::shared_ptr<DiffusionData>> mat_xs_;
+  std::vector<Face> faces_;  // Indexed by 6 * m + Neighbor
 
   xt::svector<std::size_t> geom_to_tile_indx(
       const xt::svector<std::size_t>& geo_indx) const;
 
+  // Checks that xs may replace the data of the material tile, and returns it
+  Tile& material_tile(const std::vector<std::size_t>& tile_indx,
+                      const std::shared_ptr<DiffusionData>& xs);
+
   std::pair<Tile, std::optional<std::size_t>> neighbor_1d(std::size_t m,
                                                           Neighbor n) const;
   std::pair<Tile, std::optional<std::size_t>> neighbor_2d(std::size_t m,
@@ -150,6 +249,8 @@ class DiffusionGeometry {
   void fill_x_bounds();
   void fill_y_bounds();
   void fill_z_bounds();
+  void fill_connectivity();
+  void check_symmetry() const;
 
   friend class cereal::access;
   DiffusionGeometry() {}
@@ -162,7 +263,10 @@ class DiffusionGeometry {
         CEREAL_NVP(z_divs_per_tile_), CEREAL_NVP(x_bounds_),
         CEREAL_NVP(y_bounds_), CEREAL_NVP(z_bounds_), CEREAL_NVP(nmats_),
         CEREAL_NVP(mat_indx_to_flat_geom_indx_), CEREAL_NVP(nx_),
-        CEREAL_NVP(ny_), CEREAL_NVP(nz_), CEREAL_NVP(geom_shape_));
+        CEREAL_NVP(ny_), CEREAL_NVP(nz_), CEREAL_NVP(geom_shape_),
+        CEREAL_NVP(symmetry_));
+
+    if constexpr (Archive::is_loading::value) fill_connectivity();
   }
 };
 
@@ -0,0 +1,23 @@
+#ifndef SCARABEE_DIFFUSION_SYMMETRY_H
+#define SCARABEE_DIFFUSION_SYMMETRY_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Symmetry of a core, of which a DiffusionGeometry only describes one
+// quadrant. The (x_min, y_min) corner of the geometry is then the center of
+// the core. With QuarterMirror, the core is symmetric under reflections about
+// the x = x_min and y = y_min planes, which become reflective boundaries.
+// With QuarterRotational, the core is symmetric under 90 degree rotations
+// about the center, so that the x = x_min face of the quadrant is coupled to
+// its y = y_min face. Full means that the geometry describes the whole core.
+enum class DiffusionSymmetry : std::uint8_t {
+  Full,
+  QuarterMirror,
+  QuarterRotational
+};
+
+}  // namespace scarabee
+
+#endif
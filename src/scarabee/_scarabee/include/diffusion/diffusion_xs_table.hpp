@@ -0,0 +1,108 @@
+#ifndef SCARABEE_DIFFUSION_XS_TABLE_H
+#define SCARABEE_DIFFUSION_XS_TABLE_H
+
+#include <diffusion/diffusion_data.hpp>
+#include <diffusion/diffusion_geometry.hpp>
+#include <utils/serialization.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cereal/cereal.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace scarabee {
+
+// Few-group diffusion data tabulated on a rectangular grid of state
+// parameters, such as the boron concentration, fuel temperature, moderator
+// density, and burnup. The data of all grid points is packed in one array,
+// with a row per grid point, so that a state is interpolated by a weighted
+// sum of the 2^d rows of its grid cell. States outside of the grid are
+// clamped to its bounds, so that the interpolated data is always a convex
+// combination of tabulated data.
+class DiffusionXSTable {
+ public:
+  // The data is given for each grid point, with the index of the last
+  // parameter varying fastest. All data must have the same number of groups,
+  // and either all or none may have ADFs, CDFs, and form factors.
+  DiffusionXSTable(const std::vector<std::string>& params,
+                   const std::vector<std::vector<double>>& grids,
+                   const std::vector<std::shared_ptr<DiffusionData>>& data);
+
+  std::size_t ngroups() const { return ngroups_; }
+  std::size_t nparams() const { return params_.size(); }
+  std::size_t npoints() const { return table_.shape()[0]; }
+
+  const std::vector<std::string>& params() const { return params_; }
+  const std::vector<double>& grid(std::size_t p) const;
+  // Index of the parameter with the given name
+  std::size_t param_index(const std::string& name) const;
+
+  // Data at one state, given the value of each parameter
+  std::shared_ptr<DiffusionData> interpolate(
+      std::span<const double> state) const;
+
+  // Data at many states, indexed by state then parameter. The states are
+  // interpolated in parallel.
+  std::vector<std::shared_ptr<DiffusionData>> interpolate(
+      const xt::xtensor<double, 2>& states) const;
+
+  // Interpolates the data at the state of each tile, and replaces the cross
+  // sections of the tiles in the geometry. The connectivity of the geometry
+  // is only rebuilt once, and drivers using the geometry are solved again
+  // from their previous solution.
+  void update_geometry(DiffusionGeometry& geom,
+                       const std::vector<std::vector<std::size_t>>& tiles,
+                       const xt::xtensor<double, 2>& states) const;
+
+  // Portable binary representation, used for pickling
+  std::string to_bytes() const;
+  static std::shared_ptr<DiffusionXSTable> from_bytes(const std::string& data);
+
+  void save(const std::string& fname) const;
+  static std::shared_ptr<DiffusionXSTable> load(const std::string& fname);
+
+ private:
+  std::vector<std::string> params_;
+  std::vector<std::vector<double>> grids_;
+  xt::xtensor<double, 2> table_;  // Grid point, then packed value
+  std::vector<std::size_t> ff_shape_;  // Empty without form factors
+  std::size_t ngroups_{0};
+  bool has_adf_{false};
+  bool has_cdf_{false};
+
+  // Offsets of each block of values in a row of the table
+  std::size_t nvalues() const;
+  std::size_t adf_offset() const { return ngroups_ * (5 + ngroups_); }
+  std::size_t cdf_offset() const {
+    return adf_offset() + (has_adf_ ? 6 * ngroups_ : 0);
+  }
+  std::size_t ff_offset() const {
+    return cdf_offset() + (has_cdf_ ? 4 * ngroups_ : 0);
+  }
+
+  void check_grids() const;
+  void pack(std::size_t i, const DiffusionData& data);
+  std::shared_ptr<DiffusionData> unpack(std::span<const double> row) const;
+  void interpolate_row(std::span<const double> state,
+                       std::span<double> row) const;
+
+  friend class cereal::access;
+  DiffusionXSTable() {}
+  template <class Archive>
+  void serialize(Archive& arc) {
+    arc(CEREAL_NVP(params_), CEREAL_NVP(grids_), CEREAL_NVP(table_),
+        CEREAL_NVP(ff_shape_), CEREAL_NVP(ngroups_), CEREAL_NVP(has_adf_),
+        CEREAL_NVP(has_cdf_));
+  }
+};
+
+}  // namespace scarabee
+
+#endif
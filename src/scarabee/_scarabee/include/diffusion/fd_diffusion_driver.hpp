@@ -3,8 +3,15 @@
 
 #include <diffusion/diffusion_data.hpp>
 #include <diffusion/diffusion_geometry.hpp>
+#include <diffusion/fd_linear_solver.hpp>
+#include <diffusion/fd_operator.hpp>
+#include <utils/memory_usage.hpp>
 #include <utils/serialization.hpp>
 #include <utils/simulation_mode.hpp>
+#include <utils/solver_telemetry.hpp>
+#include <utils/multigrid.hpp>
+#include <utils/sparse_pattern.hpp>
+#include <utils/threads.hpp>
 
 #include <xtensor/containers/xarray.hpp>
 #include <xtensor/containers/xtensor.hpp>
@@ -13,10 +20,15 @@
 #include <cereal/types/memory.hpp>
 
 #include <Eigen/Dense>
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/Sparse>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseLU>
 
 #include <memory>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 namespace scarabee {
 
@@ -40,8 +52,41 @@ class FDDiffusionDriver {
   double flux_tolerance() const { return flux_tol_; }
   void set_flux_tolerance(double ftol);
 
+  FDLinearSolver linear_solver() const { return linear_solver_; }
+  void set_linear_solver(FDLinearSolver solver) { linear_solver_ = solver; }
+
+  // Number of Gauss-Seidel sweeps over the groups in each power iteration,
+  // when the group-wise solvers are used. Additional sweeps only change the
+  // result when there is upscattering, so a single sweep is otherwise made.
+  std::size_t upscatter_iterations() const { return upscatter_iterations_; }
+  void set_upscatter_iterations(std::size_t niters);
+
+  // When the driver has already been solved, the next solve starts from its
+  // flux and keff. This speeds up the repeated solves of a search, after the
+  // cross sections of the geometry have been changed.
+  bool warm_start() const { return warm_start_; }
+  void set_warm_start(bool user_pref) { warm_start_ = user_pref; }
+
   double keff() const { return keff_; }
 
+  // Phase times and convergence history of the last solve
+  const SolverTelemetry& telemetry() const { return telemetry_; }
+
+  // Bytes held by the arrays of the solver, by component. The storage of the
+  // factorizations and preconditioners is not included.
+  MemoryUsage memory_usage() const;
+
+  // Number of threads of the parallel regions of the solver. When 0, the
+  // solver uses one thread per pinned core, or the process wide default.
+  std::size_t num_threads() const { return threads_.num_threads; }
+  void set_num_threads(std::size_t n) { threads_.num_threads = n; }
+
+  // Cores to which the threads of the solver are pinned, none if empty
+  const std::vector<std::size_t>& cores() const { return threads_.cores; }
+  void set_cores(const std::vector<std::size_t>& cores) {
+    threads_.set_cores(cores);
+  }
+
   double flux(std::size_t i, std::size_t g) const;
   double flux(std::size_t i, std::size_t j, std::size_t g) const;
   double flux(std::size_t i, std::size_t j, std::size_t k, std::size_t g) const;
@@ -78,16 +123,65 @@ class FDDiffusionDriver {
   double flux_tol_ = 1.E-5;
   double keff_tol_ = 1.E-5;
   bool solved_{false};
+  bool warm_start_{true};
+  SolverTelemetry telemetry_;
+  ThreadSettings threads_;  // Not saved, as it depends on the machine
+
+  // Loss and source matrices, which keep their sparsity pattern between
+  // solves. They are not saved, and are rebuilt on the first solve.
+  Eigen::SparseMatrix<double, Eigen::RowMajor> M_;
+  Eigen::SparseMatrix<double, Eigen::RowMajor> QM_;
+  SparsePattern M_pattern_;
+  SparsePattern QM_pattern_;
+
+  // Loss and fission operators, used in place of M_ and QM_ by the
+  // MatrixFree solver. They are not saved either.
+  FDOperator op_;
+
+  FDLinearSolver linear_solver_{FDLinearSolver::BiCGSTAB};
+  std::size_t upscatter_iterations_ = 1;
+
+  // Within-group system of a group, with each row multiplied by the volume
+  // of its tile, making it symmetric unless discontinuity factors are used.
+  // Non-symmetric systems use BiCGSTAB or SparseLU instead of CG or LDLT,
+  // with the same multigrid preconditioner for GroupMultigrid.
+  struct GroupSystem {
+    Eigen::SparseMatrix<double, Eigen::RowMajor> A;
+    bool symmetric{true};
+    bool analyzed{false};
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double, Eigen::RowMajor>,
+                             Eigen::Lower | Eigen::Upper>
+        cg;
+    Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>> bicgstab;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt;
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> lu;
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double, Eigen::RowMajor>,
+                             Eigen::Lower | Eigen::Upper,
+                             MultigridPreconditioner>
+        mg_cg;
+    Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>,
+                    MultigridPreconditioner>
+        mg_bicgstab;
+  };
+  std::vector<std::unique_ptr<GroupSystem>> group_systems_;
+  Eigen::VectorXd volumes_;
+  bool upscatter_{false};
 
   void power_iteration();
   void fixed_source();
+  void prepare_group_systems();
+  void release_matrices();
+  std::size_t group_gauss_seidel(const Eigen::VectorXd& Q,
+                                 Eigen::VectorXd& flux);
 
   friend class cereal::access;
   FDDiffusionDriver() {}
   template <class Archive>
   void serialize(Archive& arc) {
     arc(CEREAL_NVP(geom_), CEREAL_NVP(flux_), CEREAL_NVP(keff_),
-        CEREAL_NVP(flux_tol_), CEREAL_NVP(keff_tol_), CEREAL_NVP(solved_));
+        CEREAL_NVP(flux_tol_), CEREAL_NVP(keff_tol_), CEREAL_NVP(solved_),
+        CEREAL_NVP(linear_solver_), CEREAL_NVP(upscatter_iterations_),
+        CEREAL_NVP(warm_start_));
   }
 };
 
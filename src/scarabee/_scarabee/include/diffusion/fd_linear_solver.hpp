@@ -0,0 +1,29 @@
+#ifndef SCARABEE_FD_LINEAR_SOLVER_H
+#define SCARABEE_FD_LINEAR_SOLVER_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Method used by the FDDiffusionDriver to solve for the flux in each power
+// iteration. BiCGSTAB solves the full multigroup system at once. GroupCG and
+// GroupLDLT instead sweep over the groups in a Gauss-Seidel fashion, solving
+// the symmetric within-group system of each group with conjugate gradient
+// or with a sparse Cholesky factorization which is kept for the whole solve.
+// GroupMultigrid also sweeps over the groups, but preconditions the conjugate
+// gradient with a multigrid cycle, whose coarse grids are obtained by merging
+// the mesh cells of each tile, and then the tiles themselves. MatrixFree
+// solves the full multigroup system with Jacobi preconditioned BiCGSTAB, but
+// applies the loss and fission operators from their stencils and cross
+// sections, without assembling either matrix.
+enum class FDLinearSolver : std::uint8_t {
+  BiCGSTAB,
+  GroupCG,
+  GroupLDLT,
+  GroupMultigrid,
+  MatrixFree
+};
+
+}  // namespace scarabee
+
+#endif
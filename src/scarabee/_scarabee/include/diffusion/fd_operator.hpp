@@ -0,0 +1,242 @@
+#ifndef SCARABEE_FD_OPERATOR_H
+#define SCARABEE_FD_OPERATOR_H
+
+#include <diffusion/diffusion_data.hpp>
+#include <diffusion/diffusion_geometry.hpp>
+#include <utils/logging.hpp>
+#include <utils/memory_usage.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace scarabee {
+class FDOperator;
+}
+
+namespace Eigen {
+namespace internal {
+template <>
+struct traits<scarabee::FDOperator>
+    : public Eigen::internal::traits<Eigen::SparseMatrix<double>> {};
+}  // namespace internal
+}  // namespace Eigen
+
+namespace scarabee {
+
+// Matrix-free finite difference loss operator, which can be given to the
+// Eigen iterative solvers in place of the loss matrix of the
+// FDDiffusionDriver. Only the streaming stencil of each row is stored: a
+// diagonal and up to six neighbors within the group, whose mesh indices are
+// shared by all groups. The scattering and fission terms are applied from
+// the cross sections of the distinct materials, so that the multigroup
+// coupling costs no storage per row and no fission matrix is needed. The
+// products are computed in parallel over the meshes. When fixed_source is
+// set, the fission operator is subtracted from the loss operator.
+class FDOperator : public Eigen::EigenBase<FDOperator> {
+ public:
+  using Scalar = double;
+  using RealScalar = double;
+  using StorageIndex = int;
+  enum {
+    ColsAtCompileTime = Eigen::Dynamic,
+    MaxColsAtCompileTime = Eigen::Dynamic,
+    IsRowMajor = false
+  };
+
+  static constexpr std::size_t NNBRS = 6;
+  static constexpr std::size_t STENCIL = NNBRS + 1;
+
+  // Jacobi preconditioner, using the diagonal of the streaming and removal
+  // terms, which only depends on the stencil.
+  class Jacobi {
+   public:
+    Jacobi() = default;
+    template <typename MatType>
+    explicit Jacobi(const MatType& A) {
+      compute(A);
+    }
+
+    Eigen::Index rows() const { return inv_diag_.size(); }
+    Eigen::Index cols() const { return inv_diag_.size(); }
+
+    Jacobi& analyzePattern(const FDOperator&) { return *this; }
+    Jacobi& factorize(const FDOperator& A) {
+      inv_diag_ = A.diagonal().cwiseInverse();
+      return *this;
+    }
+    Jacobi& compute(const FDOperator& A) { return factorize(A); }
+
+    template <typename Rhs>
+    Eigen::VectorXd solve(const Eigen::MatrixBase<Rhs>& b) const {
+      return inv_diag_.cwiseProduct(b);
+    }
+
+    Eigen::ComputationInfo info() const { return Eigen::Success; }
+
+   private:
+    Eigen::VectorXd inv_diag_;
+  };
+
+  FDOperator() = default;
+
+  Eigen::Index rows() const { return static_cast<Eigen::Index>(ng_ * nm_); }
+  Eigen::Index cols() const { return rows(); }
+
+  bool empty() const { return nm_ == 0; }
+
+  bool fixed_source() const { return fixed_source_; }
+  void set_fixed_source(bool fixed_source) { fixed_source_ = fixed_source; }
+
+  // Builds the operator of geom. The streaming terms of group g in material
+  // tile m are given by fill(g, m, add), which must call add(column, value)
+  // for the columns of the row m + g * nmats, all in group g.
+  template <typename StreamingFill>
+  void build(const DiffusionGeometry& geom, const StreamingFill& fill);
+
+  // y = A x
+  template <typename Rhs>
+  Eigen::Product<FDOperator, Rhs, Eigen::AliasFreeProduct> operator*(
+      const Eigen::MatrixBase<Rhs>& x) const {
+    return Eigen::Product<FDOperator, Rhs, Eigen::AliasFreeProduct>(
+        *this, x.derived());
+  }
+
+  // y = A x, with the fission term subtracted when fixed_source is set
+  void loss(const Eigen::VectorXd& x, Eigen::VectorXd& y) const;
+
+  // y = F x, where F is the fission operator
+  void fission(const Eigen::VectorXd& x, Eigen::VectorXd& y) const;
+
+  Eigen::VectorXd diagonal() const;
+
+  std::size_t memory_bytes() const {
+    return array_bytes(nbrs_) + array_bytes(stencil_) + array_bytes(mats_) +
+           array_bytes(Es_) + array_bytes(chi_) + array_bytes(vEf_);
+  }
+
+ private:
+  std::size_t nm_{0};  // Number of material tiles
+  std::size_t ng_{0};  // Number of groups
+  bool fixed_source_{false};
+
+  // Neighbors of each tile. Missing neighbors are the tile itself, with a
+  // zero coefficient, so that no row needs a branch.
+  std::vector<std::uint32_t> nbrs_;
+  // Diagonal and neighbor coefficients, by group then tile
+  std::vector<double> stencil_;
+  // Distinct material of each tile, and their cross sections
+  std::vector<std::uint32_t> mats_;
+  std::vector<double> Es_;  // Es(gg, g) at [mat][g][gg], with a zero diagonal
+  std::vector<double> chi_;  // By material then group
+  std::vector<double> vEf_;  // By material then group
+};
+
+template <typename StreamingFill>
+void FDOperator::build(const DiffusionGeometry& geom,
+                       const StreamingFill& fill) {
+  nm_ = geom.nmats();
+  ng_ = geom.ngroups();
+
+  // Distinct materials
+  std::unordered_map<const DiffusionData*, std::uint32_t> indices;
+  mats_.resize(nm_);
+  Es_.clear();
+  chi_.clear();
+  vEf_.clear();
+  for (std::size_t m = 0; m < nm_; m++) {
+    const DiffusionData* xs = geom.mat(m).get();
+    const auto [it, inserted] =
+        indices.emplace(xs, static_cast<std::uint32_t>(indices.size()));
+    mats_[m] = it->second;
+    if (inserted == false) continue;
+
+    for (std::size_t g = 0; g < ng_; g++) {
+      for (std::size_t gg = 0; gg < ng_; gg++) {
+        Es_.push_back(gg != g ? xs->Es(gg, g) : 0.);
+      }
+    }
+    for (std::size_t g = 0; g < ng_; g++) {
+      chi_.push_back(xs->chi(g));
+      vEf_.push_back(xs->vEf(g));
+    }
+  }
+
+  nbrs_.resize(nm_ * NNBRS);
+  stencil_.assign(ng_ * nm_ * STENCIL, 0.);
+  bool too_many_nbrs = false;
+#pragma omp parallel for
+  for (int im = 0; im < static_cast<int>(nm_); im++) {
+    const std::size_t m = static_cast<std::size_t>(im);
+    std::uint32_t* nbrs = nbrs_.data() + m * NNBRS;
+    std::size_t nnbrs = 0;
+    for (std::size_t g = 0; g < ng_; g++) {
+      const std::size_t r = m + g * nm_;
+      double* coeffs = stencil_.data() + r * STENCIL;
+      fill(g, m, [&](std::size_t c, double v) {
+        if (c == r) {
+          coeffs[0] += v;
+          return;
+        }
+
+        const auto n = static_cast<std::uint32_t>(c - g * nm_);
+        std::size_t k = 0;
+        while (k < nnbrs && nbrs[k] != n) k++;
+        if (k == nnbrs) {
+          if (nnbrs == NNBRS) {
+#pragma omp atomic write
+            too_many_nbrs = true;
+            return;
+          }
+          nbrs[nnbrs++] = n;
+        }
+        coeffs[k + 1] += v;
+      });
+      coeffs[0] += geom.mat(m)->Er(g);
+    }
+    for (std::size_t k = nnbrs; k < NNBRS; k++) {
+      nbrs[k] = static_cast<std::uint32_t>(m);
+    }
+  }
+
+  if (too_many_nbrs) {
+    const std::string mssg =
+        "Finite difference stencil has more than six neighbors.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+}  // namespace scarabee
+
+namespace Eigen {
+namespace internal {
+
+template <typename Rhs>
+struct generic_product_impl<scarabee::FDOperator, Rhs, SparseShape, DenseShape,
+                            GemvProduct>
+    : generic_product_impl_base<
+          scarabee::FDOperator, Rhs,
+          generic_product_impl<scarabee::FDOperator, Rhs>> {
+  using Scalar = typename Product<scarabee::FDOperator, Rhs>::Scalar;
+
+  template <typename Dest>
+  static void scaleAndAddTo(Dest& dst, const scarabee::FDOperator& lhs,
+                            const Rhs& rhs, const Scalar& alpha) {
+    const Eigen::VectorXd x = rhs;
+    Eigen::VectorXd y(lhs.rows());
+    lhs.loss(x, y);
+    dst += alpha * y;
+  }
+};
+
+}  // namespace internal
+}  // namespace Eigen
+
+#endif
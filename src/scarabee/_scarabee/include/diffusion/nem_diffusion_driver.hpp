@@ -3,10 +3,15 @@
 
 #include <diffusion/diffusion_data.hpp>
 #include <diffusion/diffusion_geometry.hpp>
+#include <utils/memory_usage.hpp>
 #include <utils/serialization.hpp>
+#include <utils/solver_telemetry.hpp>
+#include <utils/sparse_pattern.hpp>
+#include <utils/threads.hpp>
 
 #include <Eigen/Dense>
 #include <Eigen/LU>
+#include <Eigen/Sparse>
 
 #include <cereal/cereal.hpp>
 #include <cereal/types/memory.hpp>
@@ -51,8 +56,61 @@ class NEMDiffusionDriver {
   double flux_tolerance() const { return flux_tol_; }
   void set_flux_tolerance(double ftol);
 
+  // Nonlinear CMFD acceleration on the node mesh. After each outer
+  // iteration, a coarse diffusion problem using coupling coefficients
+  // corrected by the NEM partial currents is solved, and its solution is used
+  // to rescale the node fluxes and currents.
+  bool cmfd() const { return cmfd_; }
+  void set_cmfd(bool user_pref) { cmfd_ = user_pref; }
+
+  // Red-black ordering of the node sweeps, where the nodes of each color are
+  // solved in parallel. Otherwise, the nodes are solved one after the other.
+  bool red_black_sweep() const { return red_black_sweep_; }
+  void set_red_black_sweep(bool user_pref) { red_black_sweep_ = user_pref; }
+
+  // Maximum number of inner iterations (node sweeps) per outer iteration
+  std::size_t inner_iterations() const { return inner_iterations_; }
+  void set_inner_iterations(std::size_t ninner);
+
+  // The inner iterations of an outer iteration stop early once the maximum
+  // relative change in the node average fluxes between two sweeps is below
+  // this tolerance. When zero, all inner iterations are always performed.
+  double inner_tolerance() const { return inner_tol_; }
+  void set_inner_tolerance(double itol);
+
+  // Wielandt shift of the outer iterations. When positive, the fission source
+  // estimated with keff + shift is moved to the left hand side, and is
+  // updated with the latest flux before each inner iteration, which reduces
+  // the dominance ratio of the outer iterations. Zero disables the shift.
+  double wielandt_shift() const { return wielandt_shift_; }
+  void set_wielandt_shift(double shift);
+
+  // When the driver has already been solved, the next solve starts from its
+  // flux, partial currents, and keff. This speeds up the repeated solves of
+  // a search, after the cross sections of the geometry have been changed.
+  bool warm_start() const { return warm_start_; }
+  void set_warm_start(bool user_pref) { warm_start_ = user_pref; }
+
   double keff() const { return keff_; }
 
+  // Phase times and convergence history of the last solve
+  const SolverTelemetry& telemetry() const { return telemetry_; }
+
+  // Bytes held by the arrays of the solver, by component. The storage of the
+  // factorizations and preconditioners is not included.
+  MemoryUsage memory_usage() const;
+
+  // Number of threads of the parallel regions of the solver. When 0, the
+  // solver uses one thread per pinned core, or the process wide default.
+  std::size_t num_threads() const { return threads_.num_threads; }
+  void set_num_threads(std::size_t n) { threads_.num_threads = n; }
+
+  // Cores to which the threads of the solver are pinned, none if empty
+  const std::vector<std::size_t>& cores() const { return threads_.cores; }
+  void set_cores(const std::vector<std::size_t>& cores) {
+    threads_.set_cores(cores);
+  }
+
   double flux(double x, double y, double z, std::size_t g) const;
   xt::xtensor<double, 4> flux(const xt::xtensor<double, 1>& x,
                               const xt::xtensor<double, 1>& y,
@@ -112,8 +170,11 @@ class NEMDiffusionDriver {
       j_in_out_;  // First index is group, second is node, third is in/out
 
   // Quantites used for calculation (not needed for reconstruction)
-  xt::xtensor<RMat, 2> Rmats_;  // First index is group, second is node
+  // Response matrices, where the first index is the group and the second is
+  // the node type. Nodes sharing cross sections and dimensions share a type.
+  xt::xtensor<RMat, 2> Rmats_;
   xt::xtensor<PMat, 2> Pmats_;
+  std::vector<std::size_t> node_types_;  // Type of each node
   xt::xtensor<MomentsVector, 2> Q_;  // Source
 
   // Neighbors for each node
@@ -121,8 +182,29 @@ class NEMDiffusionDriver {
   using NeighborInfo =
       std::pair<DiffusionGeometry::Tile, std::optional<std::size_t>>;
   xt::xtensor<NeighborInfo, 2> neighbors_;
+  // Face of the neighbor touching each face, as a CurrentIndx. It is the
+  // opposite face, except on the faces coupled by rotational symmetry.
+  xt::xtensor<std::size_t, 2> nb_faces_;
 
   xt::xtensor<xt::svector<std::size_t>, 1> geom_inds_;
+  std::array<std::vector<std::size_t>, 2> colors_;  // Nodes of each color
+
+  // Geometry of each node needed for the transverse leakage moments, which is
+  // computed once per solve instead of once per group in every sweep. The
+  // weights give the first and second moments of the leakage along an axis,
+  // from the leakages of the positive neighbor, negative neighbor, and node.
+  struct LeakageAxis {
+    std::size_t np{0}, nm{0};
+    bool interior{false};  // Both neighbors along the axis are nodes
+    bool rot_p{false}, rot_m{false};  // The x and y of a neighbor are swapped
+    double w1p{0.}, w1m{0.}, w1{0.};
+    double w2p{0.}, w2m{0.}, w2{0.};
+  };
+  struct NodeGeometry {
+    std::array<double, 3> invs_d{};  // Inverse widths along each axis
+    std::array<LeakageAxis, 3> axes;
+  };
+  std::vector<NodeGeometry> node_geoms_;
   std::vector<std::shared_ptr<DiffusionCrossSection>> mats_;
   xt::xtensor<double, 3> adf_;  // m, group, side
 
@@ -130,13 +212,37 @@ class NEMDiffusionDriver {
   double flux_tol_ = 1.E-5;
   double keff_tol_ = 1.E-5;
   bool solved_{false};
+  bool cmfd_{false};
+  bool red_black_sweep_{true};
+  std::size_t inner_iterations_{2};
+  double inner_tol_{0.};
+  double wielandt_shift_{0.};
+  bool warm_start_{true};
+  SolverTelemetry telemetry_;
+  ThreadSettings threads_;  // Not saved, as it depends on the machine
+
+  // Loss and fission matrices of the CMFD problem, on the node mesh
+  Eigen::SparseMatrix<double, Eigen::RowMajor> cmfd_M_;
+  Eigen::SparseMatrix<double, Eigen::RowMajor> cmfd_F_;
+  SparsePattern cmfd_M_pattern_;
+  SparsePattern cmfd_F_pattern_;
 
   //----------------------------------------------------------------------------
   // PRIVATE METHODS
   void fill_coupling_matrices();
   void fill_mats_adf();
-  void fill_source();
+  void fill_source(const xt::xtensor<double, 3>& fiss_flux, double invs_keff,
+                   double invs_kshift);
+  // Kernels for a number of groups known at compile time, used by
+  // fill_source and calc_keff for the common two and four group problems
+  template <std::size_t N>
+  void fill_source_groups(const xt::xtensor<double, 3>& fiss_flux,
+                          double invs_keff, double invs_kshift);
+  template <std::size_t N>
+  double calc_keff_groups(double keff, const xt::xtensor<double, 3>& old_flux,
+                          const xt::xtensor<double, 3>& new_flux) const;
   void fill_neighbors_and_geom_inds();
+  void fill_node_geometry();
   void update_Jin_from_Jout(std::size_t g, std::size_t m);
   MomentsVector calc_leakage_moments(std::size_t g, std::size_t m) const;
   double calc_keff(double keff, const xt::xtensor<double, 3>& old_flux,
@@ -147,6 +253,10 @@ class NEMDiffusionDriver {
                  const double invs_dy, const double invs_dz,
                  const DiffusionCrossSection& xs);
   void inner_iteration();
+  std::pair<double, double> cmfd_face_coeffs(std::size_t g, std::size_t m,
+                                             std::size_t n, CurrentIndx indx,
+                                             CurrentIndx n_indx) const;
+  std::size_t cmfd_update();
 
   inline double calc_net_current(const Current& Jin, const Current& Jout,
                                  CurrentIndx indx) const {
@@ -240,15 +350,29 @@ class NEMDiffusionDriver {
                                    Corner c) const;
   double avg_xy_corner_flux(std::size_t g, std::size_t m, Corner c) const;
 
+  // Reconstructs the flux of every group on the tensor product grid of the
+  // x, y, and z coordinates, calling add(g, m, i, j, k, flx) for each point
+  // inside a node. The points are binned by node, and the nodes are evaluated
+  // in parallel, so that each 1D basis function is computed only once per
+  // node and grid coordinate.
+  template <typename Add>
+  void eval_grid_flux(const xt::xtensor<double, 1>& x,
+                      const xt::xtensor<double, 1>& y,
+                      const xt::xtensor<double, 1>& z, const Add& add) const;
+
   friend class cereal::access;
   NEMDiffusionDriver() {}
   template <class Archive>
   void serialize(Archive& arc) {
     arc(CEREAL_NVP(geom_), CEREAL_NVP(NG_), CEREAL_NVP(NM_), CEREAL_NVP(flux_),
         CEREAL_NVP(j_in_out_), CEREAL_NVP(Rmats_), CEREAL_NVP(Pmats_),
-        CEREAL_NVP(Q_), CEREAL_NVP(neighbors_), CEREAL_NVP(geom_inds_),
-        CEREAL_NVP(mats_), CEREAL_NVP(adf_), CEREAL_NVP(keff_),
-        CEREAL_NVP(flux_tol_), CEREAL_NVP(keff_tol_), CEREAL_NVP(solved_),
+        CEREAL_NVP(node_types_), CEREAL_NVP(Q_), CEREAL_NVP(neighbors_),
+        CEREAL_NVP(nb_faces_), CEREAL_NVP(geom_inds_), CEREAL_NVP(mats_),
+        CEREAL_NVP(adf_), CEREAL_NVP(keff_), CEREAL_NVP(flux_tol_),
+        CEREAL_NVP(keff_tol_),
+        CEREAL_NVP(solved_), CEREAL_NVP(cmfd_), CEREAL_NVP(red_black_sweep_),
+        CEREAL_NVP(inner_iterations_), CEREAL_NVP(inner_tol_),
+        CEREAL_NVP(wielandt_shift_), CEREAL_NVP(warm_start_),
         CEREAL_NVP(recon_params));
   }
 };
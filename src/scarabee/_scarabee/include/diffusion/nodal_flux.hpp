@@ -0,0 +1,115 @@
+#ifndef SCARABEE_NODAL_FLUX_H
+#define SCARABEE_NODAL_FLUX_H
+
+#include <data/diffusion_cross_section.hpp>
+#include <diffusion/nem_diffusion_driver.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace scarabee {
+
+// Transverse integrated homogeneous flux of a single node, obtained with the
+// Nodal Expansion Method (NEM) from reference average fluxes and net surface
+// currents. It is used to find the homogeneous flux which defines the
+// discontinuity factors of generalized equivalence theory. The flux of each
+// group is expanded in the polynomials f0 to f4 of the NEMDiffusionDriver.
+class NodalFlux1D {
+ public:
+  NodalFlux1D(double x_min, double x_max, double keff,
+              const DiffusionCrossSection& xs,
+              const xt::xtensor<double, 1>& avg_flx,
+              const xt::xtensor<double, 1>& j_neg,
+              const xt::xtensor<double, 1>& j_pos);
+
+  double x_min() const { return x_min_; }
+  double x_max() const { return x_max_; }
+  std::size_t ngroups() const { return a_.shape()[0]; }
+
+  // Expansion coefficients, indexed by group then polynomial
+  const xt::xtensor<double, 2>& a() const { return a_; }
+
+  double operator()(double x, std::size_t g) const;
+  xt::xtensor<double, 1> operator()(const xt::xtensor<double, 1>& x,
+                                    std::size_t g) const;
+
+  double pos_surf_flux(std::size_t g) const;
+  xt::xtensor<double, 1> pos_surf_flux() const;
+
+  double neg_surf_flux(std::size_t g) const;
+  xt::xtensor<double, 1> neg_surf_flux() const;
+
+ private:
+  xt::xtensor<double, 2> a_;
+  double x_min_, x_max_;
+
+  void check_group(std::size_t g) const;
+};
+
+// Homogeneous flux of a single 2D node centered on the origin, reconstructed
+// with the ANOVA-HDMR decomposition of Bokov et al., in the same manner as
+// the NEMDiffusionDriver. The coefficients of the coupled x-y terms need
+// the average corner fluxes of the adjacent nodes, and are therefore zero
+// unless given with set_cross_terms (see
+// NEMDiffusionDriver::fit_node_recon_params_corners).
+class NodalFlux2D {
+ public:
+  NodalFlux2D(double dx, double dy, double keff,
+              const DiffusionCrossSection& xs,
+              const xt::xtensor<double, 1>& avg_flx,
+              const xt::xtensor<double, 1>& j_x_neg,
+              const xt::xtensor<double, 1>& j_x_pos,
+              const xt::xtensor<double, 1>& j_y_neg,
+              const xt::xtensor<double, 1>& j_y_pos);
+
+  double dx() const { return 1. / recon_params_.front().invs_dx; }
+  double dy() const { return 1. / recon_params_.front().invs_dy; }
+  double keff() const { return keff_; }
+  std::size_t ngroups() const { return recon_params_.size(); }
+
+  const NodalFlux1D& flux_x() const { return flux_x_; }
+  const NodalFlux1D& flux_y() const { return flux_y_; }
+
+  void set_cross_terms(std::size_t g, double cxy11, double cxy12,
+                       double cxy21, double cxy22);
+
+  // Each method returns the flux of all groups at a point, or for arrays of
+  // N points, an (N, ngroups) array, evaluated in parallel.
+  xt::xtensor<double, 1> operator()(double x, double y) const;
+  xt::xtensor<double, 2> operator()(const xt::xtensor<double, 1>& x,
+                                    const xt::xtensor<double, 1>& y) const;
+
+  xt::xtensor<double, 1> flux_xy_no_cross(double x, double y) const;
+  xt::xtensor<double, 2> flux_xy_no_cross(
+      const xt::xtensor<double, 1>& x, const xt::xtensor<double, 1>& y) const;
+
+  xt::xtensor<double, 1> fx(double x) const;
+  xt::xtensor<double, 2> fx(const xt::xtensor<double, 1>& x) const;
+
+  xt::xtensor<double, 1> fy(double y) const;
+  xt::xtensor<double, 2> fy(const xt::xtensor<double, 1>& y) const;
+
+  xt::xtensor<double, 1> fxy(double x, double y) const;
+  xt::xtensor<double, 2> fxy(const xt::xtensor<double, 1>& x,
+                             const xt::xtensor<double, 1>& y) const;
+
+ private:
+  // The z terms are all zero, as is the mid point of the node
+  std::vector<NEMDiffusionDriver::NodeFlux> recon_params_;
+  NodalFlux1D flux_x_;
+  NodalFlux1D flux_y_;
+  double keff_;
+
+  template <typename F>
+  xt::xtensor<double, 1> evaluate(double x, double y, F f) const;
+  template <typename F>
+  xt::xtensor<double, 2> evaluate(const xt::xtensor<double, 1>& x,
+                                  const xt::xtensor<double, 1>& y,
+                                  F f) const;
+};
+
+}  // namespace scarabee
+
+#endif
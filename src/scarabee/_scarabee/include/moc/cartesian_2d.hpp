@@ -17,7 +17,9 @@
 #include <cereal/types/vector.hpp>
 #include <cereal/types/map.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -95,27 +97,26 @@ class Cartesian2D {
 
   std::optional<TileIndex> get_tile_index(const Vector& r,
                                           const Direction& u) const {
-    for (std::size_t i = 0; i < nx(); i++) {
-      for (std::size_t j = 0; j < ny(); j++) {
-        // Get the surfaces that make up our tile
-        const auto& xl = x_bounds_[i];
-        const auto& xh = x_bounds_[i + 1];
-        const auto& yl = y_bounds_[j];
-        const auto& yh = y_bounds_[j + 1];
-
-        // Check if we are in the tile. If so, return index
-        if (xl->side(r, u) == Surface::Side::Positive &&
-            xh->side(r, u) == Surface::Side::Negative &&
-            yl->side(r, u) == Surface::Side::Positive &&
-            yh->side(r, u) == Surface::Side::Negative) {
-          return TileIndex{i, j};
-        }
-      }
-    }
-
-    // If we get here, we weren't in any tile.
-    // Return nullopt
-    return std::nullopt;
+    // The bounds are sorted, so r is on the positive side of all the bounds
+    // up to some index, and on the negative side of all others. This also
+    // holds when r is on a bound, as the side is then taken from u for all
+    // coincident bounds. We can therefore bisect the bounds in each
+    // direction.
+    auto first_negative = [&r, &u](const auto& bounds) {
+      const auto it = std::partition_point(
+          bounds.begin(), bounds.end(), [&r, &u](const auto& s) {
+            return s->side(r, u) == Surface::Side::Positive;
+          });
+      return static_cast<std::size_t>(it - bounds.begin());
+    };
+
+    const std::size_t i = first_negative(x_bounds_);
+    if (i == 0 || i > nx()) return std::nullopt;
+
+    const std::size_t j = first_negative(y_bounds_);
+    if (j == 0 || j > ny()) return std::nullopt;
+
+    return TileIndex{i - 1, j - 1};
   }
 
   Vector get_tile_center(const TileIndex& ti) const {
@@ -128,11 +129,20 @@ class Cartesian2D {
     return Vector(0.5 * (xl->x0() + xh->x0()), 0.5 * (yl->y0() + yh->y0()));
   }
 
+  // Widths of tile ti along x and y
+  std::pair<double, double> tile_dx_dy(const TileIndex& ti) const;
+
   const Tile& tile(const TileIndex& ti) const {
     check_tile_index(ti);
     return tiles_(ti.i, ti.j);
   }
 
+  // Offset added to the instance of an FSR of tile ti to make it unique
+  std::size_t fsr_offset(const TileIndex& ti, std::size_t fsr_id) const {
+    const std::size_t local = fsr_local_[fsr_id - fsr_id_min_];
+    return fsr_offsets_[(ti.i * ny_ + ti.j) * nfsr_ids_ + local];
+  }
+
   void set_tiles(const std::vector<TileFill>& fills);
 
   bool tiles_valid() const;
@@ -173,8 +183,7 @@ class Cartesian2D {
 
     // Get unique ID
     if (out.first.fsr) {
-      out.first.instance +=
-          fsr_offset_map_(ti->i, ti->j).find(out.first.fsr->id())->second;
+      out.first.instance += fsr_offset(*ti, out.first.fsr->id());
     }
 
     return out;
@@ -203,14 +212,21 @@ class Cartesian2D {
   std::vector<std::shared_ptr<Surface>> x_bounds_;
   std::vector<std::shared_ptr<Surface>> y_bounds_;
   xt::xtensor<Tile, 2> tiles_;
-  xt::xtensor<std::map<std::size_t, std::size_t>, 2> fsr_offset_map_;
   std::size_t nx_, ny_;
 
+  // The FSR ids of the geometry are given compact local ids by fsr_local_,
+  // indexed by id - fsr_id_min_. The offsets of the instances of each local
+  // FSR in each tile are in fsr_offsets_, indexed by tile and local id, so
+  // that an offset is found with two array loads.
+  std::size_t fsr_id_min_{0};
+  std::size_t nfsr_ids_{0};
+  std::vector<std::uint32_t> fsr_local_;
+  std::vector<std::size_t> fsr_offsets_;
+
   Cartesian2D() = default;
 
   void set_tile(const TileIndex& ti, const std::shared_ptr<Cartesian2D>& c2d);
   void set_tile(const TileIndex& ti, const std::shared_ptr<Cell>& cell);
-  std::pair<double, double> tile_dx_dy(const TileIndex& ti) const;
 
   void check_tile_index(const TileIndex& ti) const {
     if (ti.i >= nx_) {
@@ -233,7 +249,9 @@ class Cartesian2D {
   template <class Archive>
   void serialize(Archive& arc) {
     arc(CEREAL_NVP(x_bounds_), CEREAL_NVP(y_bounds_), CEREAL_NVP(tiles_),
-        CEREAL_NVP(fsr_offset_map_), CEREAL_NVP(nx_), CEREAL_NVP(ny_));
+        CEREAL_NVP(nx_), CEREAL_NVP(ny_), CEREAL_NVP(fsr_id_min_),
+        CEREAL_NVP(nfsr_ids_), CEREAL_NVP(fsr_local_),
+        CEREAL_NVP(fsr_offsets_));
   }
 };
 
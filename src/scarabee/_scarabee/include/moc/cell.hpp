@@ -15,7 +15,9 @@
 #include <cereal/types/memory.hpp>
 #include <cereal/types/vector.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <set>
@@ -49,6 +51,15 @@ class Cell {
       return {nullptr, 0};
     }
 
+    // Try the likely FSRs of the grid bin first
+    if (grid_n_ > 0) {
+      const std::size_t b = grid_bin(r);
+      for (std::size_t k = grid_offsets_[b]; k < grid_offsets_[b + 1]; k++) {
+        const auto& fsr = fsrs_[grid_fsrs_[k]];
+        if (fsr.inside(r, u)) return {&fsr, 0};
+      }
+    }
+
     for (const auto& fsr : fsrs_) {
       if (fsr.inside(r, u)) return {&fsr, 0};
     }
@@ -61,6 +72,11 @@ class Cell {
     return {&fsrs_.front(), 0};
   }
 
+  // Same as get_fsr, but the FSRs which share a surface with fsr, which is
+  // typically the FSR that was just left by a track, are tested first.
+  UniqueFSR next_fsr(const FlatSourceRegion& fsr, const Vector& r,
+                     const Direction& u) const;
+
   std::vector<UniqueFSR> get_all_fsr_in_cell(const Vector& r,
                                              const Direction& u) const;
 
@@ -81,15 +97,41 @@ class Cell {
   std::vector<FlatSourceRegion> fsrs_;
   std::shared_ptr<Surface> x_min_, y_min_, x_max_, y_max_;
 
+  // Acceleration structures for FSR lookups. The cell is divided in a
+  // uniform grid, and each bin has a list of candidate FSRs, most likely
+  // first. Each FSR also has the list of FSRs with which it shares a surface.
+  std::size_t grid_n_{0};  // Number of bins along x and y
+  std::vector<std::size_t> grid_offsets_;
+  std::vector<std::uint32_t> grid_fsrs_;
+  std::vector<std::size_t> neighbor_offsets_;
+  std::vector<std::uint32_t> neighbor_fsrs_;
+
   Cell(double dx, double dy);
   void check_surfaces() const;
 
+  // Must be called by derived classes, once all FSRs are built. Also
+  // compiles the shapes of the FSRs.
+  void build_fsr_index();
+
+  std::size_t grid_bin(const Vector& r) const {
+    const double n = static_cast<double>(grid_n_);
+    auto bin = [this, n](double x, double xmin, double d) {
+      const double b = std::floor((x - xmin) * n / d);
+      if (b <= 0.) return std::size_t{0};
+      return std::min(static_cast<std::size_t>(b), grid_n_ - 1);
+    };
+    return bin(r.y(), y_min_->y0(), dy()) * grid_n_ +
+           bin(r.x(), x_min_->x0(), dx());
+  }
+
   friend class cereal::access;
   Cell() {}
   template <class Archive>
   void serialize(Archive& arc) {
     arc(CEREAL_NVP(fsrs_), CEREAL_NVP(x_min_), CEREAL_NVP(y_min_),
-        CEREAL_NVP(x_max_), CEREAL_NVP(y_max_));
+        CEREAL_NVP(x_max_), CEREAL_NVP(y_max_), CEREAL_NVP(grid_n_),
+        CEREAL_NVP(grid_offsets_), CEREAL_NVP(grid_fsrs_),
+        CEREAL_NVP(neighbor_offsets_), CEREAL_NVP(neighbor_fsrs_));
   }
 };
 
@@ -5,8 +5,14 @@
 #include <moc/vector.hpp>
 #include <moc/direction.hpp>
 #include <moc/boundary_condition.hpp>
+#include <moc/cmfd_acceleration.hpp>
+#include <moc/cmfd_linear_solver.hpp>
 #include <data/diffusion_cross_section.hpp>
 #include <utils/simulation_mode.hpp>
+#include <utils/threads.hpp>
+#include <utils/solver_telemetry.hpp>
+#include <utils/memory_usage.hpp>
+#include <utils/sparse_pattern.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
 #include <Eigen/Sparse>
@@ -18,6 +24,7 @@
 #include <utils/serialization.hpp>
 
 #include <array>
+#include <cmath>
 #include <memory>
 #include <utility>
 #include <optional>
@@ -43,6 +50,18 @@ struct CMFDSurfaceCrossing {
   }
 };
 
+// CMFD mesh surfaces which receive the current of a CMFDSurfaceCrossing. These
+// are decoded once, when the MOC segments are packed, so that tallying a
+// current in the sweep is only a few indexed additions.
+struct CMFDSurfaceTally {
+  std::array<std::size_t, 4> surfaces{};
+  std::array<bool, 4> x_surface{};  // True for x surfaces, false for y
+  std::size_t nsurfs{0};
+  double weight{1.};  // Corner crossings split the current between surfaces
+
+  constexpr explicit operator bool() const noexcept { return nsurfs > 0; }
+};
+
 class CMFD {
  public:
   CMFD(const std::vector<double>& dx, const std::vector<double>& dy,
@@ -72,9 +91,10 @@ class CMFD {
   std::size_t tile_to_indx(const std::array<std::size_t, 2>& tile) const;
   std::size_t tile_to_indx(const std::size_t& i, const std::size_t& j) const;
 
-  std::array<std::size_t, 2> indx_to_tile(std::size_t cell_index);
+  std::array<std::size_t, 2> indx_to_tile(std::size_t cell_index) const;
 
   CMFDSurfaceCrossing get_surface(const Vector& r, const Direction& u) const;
+  CMFDSurfaceTally surface_tally(const CMFDSurfaceCrossing& surf) const;
 
   std::size_t get_x_neg_surf(const std::size_t i, const std::size_t j) const;
   std::size_t get_x_pos_surf(const std::size_t i, const std::size_t j) const;
@@ -83,7 +103,13 @@ class CMFD {
 
   void insert_fsr(const std::array<std::size_t, 2>& tile, std::size_t fsr);
   void insert_fsr(std::size_t tile_indx, std::size_t fsr);
+  void insert_fsrs(std::size_t tile_indx, const std::vector<std::size_t>& fsrs);
   void pack_fsr_lists();
+  // Renumbers the FSRs of the packed lists with fsr_map, dropping those
+  // mapped to a value of at least nfsrs, and reopens the lists so that more
+  // FSRs may be inserted before they are packed again
+  void remap_fsr_lists(const std::vector<std::size_t>& fsr_map,
+                       std::size_t nfsrs);
 
   const std::vector<std::size_t>& tile_fsr_list(std::size_t i,
                                                 std::size_t j) const;
@@ -92,20 +118,62 @@ class CMFD {
 
   const double& current(const std::size_t G, const std::size_t surface) const;
 
+  // Partial current crossing the surface in the positive (or negative) x or
+  // y direction. Only tallied when partial_current_cmfd is enabled.
+  double partial_current(const std::size_t G, const std::size_t surface,
+                         bool positive) const;
+
   void tally_current(double aflx, const Direction& u, std::size_t G,
                      const CMFDSurfaceCrossing& surf);
 
-  void zero_currents() {
-    surface_currents_.fill(0.);
-    surface_currents_normalized_ = false;
+  // Tallies into the current buffer of the tally slot of the calling
+  // thread, without any synchronization. The buffers are summed by
+  // reduce_currents.
+  void tally_current(double aflx, const Direction& u, std::size_t G,
+                     const CMFDSurfaceTally& surf) {
+    auto& currents = thread_currents_[tally_slot()];
+    aflx *= surf.weight;
+    for (std::size_t k = 0; k < surf.nsurfs; k++) {
+      const double u_perp = surf.x_surface[k] ? u.x() : u.y();
+      if (partial_current_cmfd_) {
+        currents(u_perp > 0. ? G : ng_ + G, surf.surfaces[k]) += aflx;
+      } else {
+        currents(G, surf.surfaces[k]) += std::copysign(aflx, u_perp);
+      }
+    }
+  }
+
+  // Tallies the contribution of an angular flux crossing the surfaces to
+  // the integral of the scalar flux over them, aflx / |u_perp|, into the
+  // buffer of the tally slot of the calling thread. Only used when
+  // surface_flux_tally is enabled.
+  void tally_surface_flux(double aflx, const Direction& u, std::size_t G,
+                          const CMFDSurfaceTally& surf) {
+    auto& sflux = thread_surface_flux_[tally_slot()];
+    aflx *= surf.weight;
+    for (std::size_t k = 0; k < surf.nsurfs; k++) {
+      const double u_perp = std::abs(surf.x_surface[k] ? u.x() : u.y());
+      if (u_perp > 0.) sflux(G, surf.surfaces[k]) += aflx / u_perp;
+    }
   }
 
+  void zero_currents();
+  void reduce_currents();
+
   enum class TileSurf : std::uint8_t { XN, XP, YN, YP };
 
   void solve(MOCDriver& moc, double keff, std::size_t moc_iteration);
 
   void homogenize_ext_src(const MOCDriver& moc);
 
+  // Converged coarse fluxes and keff of the previous solves, which the
+  // MOCDriver uses to extrapolate the starting guess of its next solve. The
+  // weights apply to the most recent solutions, from oldest to newest.
+  void save_solution(bool replace_last, std::size_t max_solutions);
+  void extrapolate_solution(const std::vector<double>& weights);
+  void clear_solution_history();
+  std::size_t solution_history_size() const { return history_keff_.size(); }
+
   // Setter/Getter functions
 
   double keff_tolerance() const { return keff_tol_; }
@@ -126,6 +194,34 @@ class CMFD {
   bool od_cmfd() const { return od_cmfd_; }
   void set_od_cmfd(bool user_pref);
 
+  // Partial-current CMFD (pCMFD), where the currents in each direction are
+  // tallied separately and each receives its own nonlinear coupling
+  // coefficient. The resulting loss matrix remains an M-matrix, so flux
+  // limiting is not applied in this mode.
+  bool partial_current_cmfd() const { return partial_current_cmfd_; }
+  void set_partial_current_cmfd(bool user_pref);
+
+  // Tally of the average scalar flux on every CMFD surface, accumulated by
+  // the MOC sweep from the angular fluxes crossing the surfaces, in the CMFD
+  // group structure. The surface fluxes of the last MOC sweep give the
+  // discontinuity factors without sampling the FSR fluxes after the solve.
+  bool surface_flux_tally() const { return surface_flux_tally_; }
+  void set_surface_flux_tally(bool user_pref) {
+    surface_flux_tally_ = user_pref;
+  }
+
+  // Average scalar flux on a surface, from the last MOC sweep
+  double surface_flux(std::size_t G, std::size_t surface) const;
+
+  // Average scalar flux along the whole line x = x_bounds[i], or
+  // y = y_bounds[j], where i is in [0, nx] and j is in [0, ny]
+  double x_line_flux(std::size_t i, std::size_t G) const;
+  double y_line_flux(std::size_t j, std::size_t G) const;
+
+  // Average scalar flux of the surfaces which meet at the mesh vertex
+  // (x_bounds[i], y_bounds[j]), as an estimate of the flux at the vertex.
+  double vertex_flux(std::size_t i, std::size_t j, std::size_t G) const;
+
   bool neutron_balance_check() const { return neutron_balance_check_; }
   void set_neutron_balance_check(bool user_pref) {
     neutron_balance_check_ = user_pref;
@@ -143,6 +239,87 @@ class CMFD {
 
   std::size_t moc_iteration() const { return moc_iteration_; }
 
+  CMFDLinearSolver linear_solver() const { return linear_solver_; }
+  void set_linear_solver(CMFDLinearSolver solver) { linear_solver_ = solver; }
+
+  // Relative residual tolerance of the iterative linear solvers. With the
+  // adaptive tolerance, each power iteration instead solves to a tolerance
+  // proportional to the keff and flux differences of the previous one, which
+  // is never tighter than linear_tolerance.
+  double linear_tolerance() const { return linear_tol_; }
+  void set_linear_tolerance(double tol);
+
+  bool adaptive_linear_tolerance() const { return adaptive_linear_tol_; }
+  void set_adaptive_linear_tolerance(bool user_pref) {
+    adaptive_linear_tol_ = user_pref;
+  }
+
+  // With a positive forcing factor, each CMFD solve is inexact: the keff and
+  // flux tolerances of the power iteration are loosened to the forcing
+  // factor times the largest relative change of the homogenized MOC flux
+  // since the previous CMFD solve, and the linear tolerance to 1% of that.
+  // The loosened tolerance is at most 1.E-3, only decreases during an MOC
+  // solve, and is never tighter than the fixed tolerances, so the final
+  // solution is unaffected. A forcing factor of 0 disables it.
+  double forcing_factor() const { return forcing_factor_; }
+  void set_forcing_factor(double eta);
+
+  // Loosened tolerance of the last CMFD solve, 0 without forcing
+  double forced_tolerance() const { return forced_tol_; }
+
+  // Largest number of unknowns for which Auto uses the SparseLU solver
+  std::size_t direct_solver_max_size() const { return direct_solver_max_size_; }
+  void set_direct_solver_max_size(std::size_t n) {
+    direct_solver_max_size_ = n;
+  }
+
+  // Total number of iterations of the linear solver in the last CMFD solve.
+  // Direct solves count zero iterations.
+  std::size_t linear_iterations() const { return linear_iterations_; }
+
+  CMFDAcceleration acceleration() const { return acceleration_; }
+  void set_acceleration(CMFDAcceleration acc) { acceleration_ = acc; }
+
+  // Difference between the shifted keff of the Wielandt acceleration and the
+  // current keff estimate
+  double wielandt_shift() const { return wielandt_shift_; }
+  void set_wielandt_shift(double shift);
+
+  // Convergence history of the power iterations of the last CMFD solve
+  const std::vector<double>& power_iteration_keffs() const {
+    return power_keffs_;
+  }
+  const std::vector<double>& power_iteration_residuals() const {
+    return power_residuals_;
+  }
+
+  // Dominance ratio estimated by the Chebyshev acceleration in the last CMFD
+  // solve, or 0 if it was not estimated.
+  double dominance_ratio() const { return dominance_ratio_; }
+
+  // Coarse level of a two-grid CMFD power iteration. Each coarse tile merges
+  // a block of CMFD tiles, with nx_tiles[I] tiles along x and ny_tiles[J]
+  // tiles along y, and each coarse group merges a range of CMFD groups.
+  // After every power iteration, the fine flux is rebalanced by the solution
+  // of the coarse eigenvalue problem, whose operators are the fine ones
+  // restricted with the current flux shape.
+  void set_coarse_mesh(
+      const std::vector<std::size_t>& nx_tiles,
+      const std::vector<std::size_t>& ny_tiles,
+      const std::vector<std::pair<std::size_t, std::size_t>>& groups);
+  void clear_coarse_mesh();
+  bool has_coarse_mesh() const { return coarse_size_ > 0; }
+  const std::vector<std::size_t>& coarse_nx_tiles() const {
+    return coarse_nx_tiles_;
+  }
+  const std::vector<std::size_t>& coarse_ny_tiles() const {
+    return coarse_ny_tiles_;
+  }
+  const std::vector<std::pair<std::size_t, std::size_t>>&
+  coarse_condensation_scheme() const {
+    return coarse_groups_;
+  }
+
   const double& flux(const std::size_t i, const std::size_t j,
                      const std::size_t g) const;
   double keff() const { return keff_; }
@@ -150,6 +327,15 @@ class CMFD {
   const double& solve_time() const { return solve_time_; }
   bool solved() const { return solved_; }
 
+  // Phase times and power iterations of the CMFD solves of the last MOC
+  // solve. The residual and keff of each solve are those of its last power
+  // iteration.
+  const SolverTelemetry& telemetry() const { return telemetry_; }
+
+  // Bytes held by the arrays of the CMFD, by component. The factorizations
+  // kept by the linear solvers are not included.
+  MemoryUsage memory_usage() const;
+
  private:
   std::vector<double> dx_, dy_;
   std::vector<XPlane> x_bounds_;
@@ -162,10 +348,28 @@ class CMFD {
   bool flux_limiting_ = true;
   bool larsen_correction_ = false;
   bool od_cmfd_ = true;
+  bool partial_current_cmfd_ = false;
   bool neutron_balance_check_ = false;
+  bool surface_flux_tally_ = false;
   double keff_tol_ = 1E-5;
   double flux_tol_ = 1E-5;
   double damping_ = 0.7;
+  CMFDLinearSolver linear_solver_{CMFDLinearSolver::BiCGSTAB};
+  double linear_tol_ = 1E-10;
+  bool adaptive_linear_tol_ = false;
+  double forcing_factor_ = 0.;
+  double forced_tol_ = 0.;
+  static constexpr double MAX_FORCED_TOL = 1.E-3;
+  static constexpr double FORCED_LINEAR_RATIO = 1.E-2;
+  // Homogenized MOC flux of the previous CMFD solve, for the forcing
+  xt::xtensor<double, 3> prev_moc_flux_;
+  std::size_t direct_solver_max_size_ = 20000;
+  std::size_t linear_iterations_ = 0;
+  CMFDAcceleration acceleration_{CMFDAcceleration::Unaccelerated};
+  double wielandt_shift_ = 0.05;
+  double dominance_ratio_ = 0.;
+  std::vector<double> power_keffs_;      // keff of each power iteration
+  std::vector<double> power_residuals_;  // Max flux difference of each
   std::size_t unbounded_cmfd_solves_ = 1;
   std::size_t cmfd_solves_ = 0;
   std::size_t skip_moc_iterations_ = 0;
@@ -173,10 +377,12 @@ class CMFD {
   double keff_ = 1.0;
   double solve_time_ = 0.0;
   bool solved_ = false;
+  SolverTelemetry telemetry_;
   SimulationMode mode_{SimulationMode::Keff};
 
-  // List of flat source region indices for each CMFD cell
-  std::vector<std::set<std::size_t>> temp_fsrs_;
+  // List of flat source region indices for each CMFD cell. While tracing,
+  // the FSRs are collected with duplicates, which pack_fsr_lists removes.
+  std::vector<std::vector<std::size_t>> temp_fsrs_;
   std::vector<std::vector<std::size_t>> fsrs_;
 
   // This contains the net current for every possible surface in every group.
@@ -184,9 +390,25 @@ class CMFD {
   // Surfaces are ordered as all x surfaces, then all y surfaces.
   // Number of surfaces is then ny_*x_bounds_.size() + nx_*y_bounds_.size().
   xt::xtensor<double, 2> surface_currents_;  // group, surface
+  // With pCMFD, the partial currents in the positive direction are stored for
+  // group G in row G, and those in the negative direction in row ng_ + G. The
+  // thread tallies then also have this layout.
+  xt::xtensor<double, 2> surface_partial_currents_;  // 2*group, surface
+  std::vector<xt::xtensor<double, 2>> thread_currents_;  // Thread tallies
   bool surface_currents_normalized_ = false;
-
-  xt::xtensor<std::shared_ptr<DiffusionCrossSection>, 2> xs_;
+  // Integral of the scalar flux over each surface, indexed as the currents
+  xt::xtensor<double, 2> surface_flux_;                     // group, surface
+  std::vector<xt::xtensor<double, 2>> thread_surface_flux_;  // Thread tallies
+
+  // Few-group diffusion cross sections of each tile, indexed by tile then
+  // group. The scattering matrix is indexed by tile, incoming group, then
+  // outgoing group.
+  xt::xtensor<double, 2> tile_D_;
+  xt::xtensor<double, 2> tile_Er_;
+  xt::xtensor<double, 2> tile_vEf_;
+  xt::xtensor<double, 2> tile_chi_;
+  xt::xtensor<double, 3> tile_Es_;
+  std::vector<xt::xtensor<double, 2>> homog_scratch_;  // Thread buffers
   xt::xtensor<double, 3> Et_;             // g, i, j
   xt::xtensor<double, 3> flux_;           // g, x, y
   xt::xtensor<double, 2> D_transp_corr_;  // g, surf
@@ -197,9 +419,33 @@ class CMFD {
 
   Eigen::SparseMatrix<double> M_;   // Loss Matrix
   Eigen::SparseMatrix<double> QM_;  // Source Matrix
+  SparsePattern M_pattern_;         // Slots of the entries of M_
+  SparsePattern QM_pattern_;        // Slots of the entries of QM_
+  Eigen::SparseMatrix<double> W_;   // Wielandt shifted loss matrix
+
+  // Linear solvers, which are kept between CMFD solves so that SparseLU only
+  // analyzes the sparsity pattern once.
+  using SpMat = Eigen::SparseMatrix<double>;
+  Eigen::BiCGSTAB<SpMat> bicgstab_;
+  Eigen::BiCGSTAB<SpMat, Eigen::IncompleteLUT<double>> ilut_bicgstab_;
+  Eigen::SparseLU<SpMat, Eigen::COLAMDOrdering<SpMat::StorageIndex>> lu_;
+  std::size_t lu_rows_ = 0;  // Size of the pattern analyzed by lu_
+  std::size_t lu_nnz_ = 0;   // Nonzeros of the pattern analyzed by lu_
+
+  // Coarse level of the two-grid power iteration
+  std::vector<std::size_t> coarse_nx_tiles_, coarse_ny_tiles_;
+  std::vector<std::pair<std::size_t, std::size_t>> coarse_groups_;
+  std::size_t coarse_size_ = 0;  // Number of coarse unknowns
+  std::vector<std::size_t> coarse_indx_;  // Coarse unknown of each unknown
+  SpMat coarse_R_;  // Volume weighted sum over the fine unknowns
+  Eigen::SparseLU<SpMat, Eigen::COLAMDOrdering<SpMat::StorageIndex>>
+      coarse_lu_;
 
   Eigen::VectorXd extern_src_;  // g*nx_*ny_
 
+  std::vector<Eigen::VectorXd> history_flux_;  // Previous flux_cmfd_
+  std::vector<double> history_keff_;           // Previous keff_
+
   void apply_larsen_correction(double& D, const double dx,
                                const MOCDriver& moc) const;
   void optimize_diffusion_coef(double& D, const double dx, const std::size_t i,
@@ -213,11 +459,20 @@ class CMFD {
   double get_cmfd_tile_width(std::size_t i, std::size_t j, TileSurf surf) const;
   double get_current(std::size_t i, std::size_t j, std::size_t g,
                      TileSurf surf) const;
+  std::size_t get_surf(std::size_t i, std::size_t j, TileSurf surf) const;
   void create_loss_matrix(const MOCDriver& moc);
   void create_source_matrix();
+  CMFDLinearSolver active_linear_solver() const;
+  void prepare_linear_solver(const Eigen::SparseMatrix<double>& A);
+  std::size_t solve_linear(const Eigen::VectorXd& b,
+                           const Eigen::VectorXd& guess, Eigen::VectorXd& x,
+                           double tol);
+  std::size_t coarse_correction(Eigen::VectorXd& flux, double& keff);
+  void update_forced_tolerance(std::size_t moc_iteration);
   void power_iteration(double keff);
   void fixed_source_solve();
   void update_moc_fluxes(MOCDriver& moc);
+  void add_sweep_currents(const xt::xtensor<double, 2>& currents);
   void normalize_currents();
   void compute_homogenized_xs_and_flux(const MOCDriver& moc);
 
@@ -245,14 +500,19 @@ class CMFD {
         CEREAL_NVP(group_condensation_), CEREAL_NVP(nx_), CEREAL_NVP(ny_),
         CEREAL_NVP(ng_), CEREAL_NVP(nx_surfs_), CEREAL_NVP(ny_surfs_),
         CEREAL_NVP(flux_limiting_), CEREAL_NVP(larsen_correction_),
-        CEREAL_NVP(od_cmfd_), CEREAL_NVP(neutron_balance_check_),
+        CEREAL_NVP(od_cmfd_), CEREAL_NVP(partial_current_cmfd_),
+        CEREAL_NVP(neutron_balance_check_),
         CEREAL_NVP(keff_tol_), CEREAL_NVP(flux_tol_), CEREAL_NVP(damping_),
         CEREAL_NVP(unbounded_cmfd_solves_), CEREAL_NVP(cmfd_solves_),
         CEREAL_NVP(skip_moc_iterations_), CEREAL_NVP(moc_iteration_),
         CEREAL_NVP(keff_), CEREAL_NVP(solve_time_), CEREAL_NVP(solved_),
         CEREAL_NVP(mode_), CEREAL_NVP(fsrs_), CEREAL_NVP(surface_currents_),
-        CEREAL_NVP(surface_currents_normalized_), CEREAL_NVP(xs_),
-        CEREAL_NVP(Et_), CEREAL_NVP(flux_), CEREAL_NVP(D_transp_corr_));
+        CEREAL_NVP(surface_partial_currents_),
+        CEREAL_NVP(surface_currents_normalized_), CEREAL_NVP(tile_D_),
+        CEREAL_NVP(tile_Er_), CEREAL_NVP(tile_vEf_), CEREAL_NVP(tile_chi_),
+        CEREAL_NVP(tile_Es_), CEREAL_NVP(Et_), CEREAL_NVP(flux_),
+        CEREAL_NVP(D_transp_corr_), CEREAL_NVP(surface_flux_tally_),
+        CEREAL_NVP(surface_flux_));
   }
 
   template <class Archive>
@@ -262,14 +522,19 @@ class CMFD {
         CEREAL_NVP(group_condensation_), CEREAL_NVP(nx_), CEREAL_NVP(ny_),
         CEREAL_NVP(ng_), CEREAL_NVP(nx_surfs_), CEREAL_NVP(ny_surfs_),
         CEREAL_NVP(flux_limiting_), CEREAL_NVP(larsen_correction_),
-        CEREAL_NVP(od_cmfd_), CEREAL_NVP(neutron_balance_check_),
+        CEREAL_NVP(od_cmfd_), CEREAL_NVP(partial_current_cmfd_),
+        CEREAL_NVP(neutron_balance_check_),
         CEREAL_NVP(keff_tol_), CEREAL_NVP(flux_tol_), CEREAL_NVP(damping_),
         CEREAL_NVP(unbounded_cmfd_solves_), CEREAL_NVP(cmfd_solves_),
         CEREAL_NVP(skip_moc_iterations_), CEREAL_NVP(moc_iteration_),
         CEREAL_NVP(keff_), CEREAL_NVP(solve_time_), CEREAL_NVP(solved_),
         CEREAL_NVP(mode_), CEREAL_NVP(fsrs_), CEREAL_NVP(surface_currents_),
-        CEREAL_NVP(surface_currents_normalized_), CEREAL_NVP(xs_),
-        CEREAL_NVP(Et_), CEREAL_NVP(flux_), CEREAL_NVP(D_transp_corr_));
+        CEREAL_NVP(surface_partial_currents_),
+        CEREAL_NVP(surface_currents_normalized_), CEREAL_NVP(tile_D_),
+        CEREAL_NVP(tile_Er_), CEREAL_NVP(tile_vEf_), CEREAL_NVP(tile_chi_),
+        CEREAL_NVP(tile_Es_), CEREAL_NVP(Et_), CEREAL_NVP(flux_),
+        CEREAL_NVP(D_transp_corr_), CEREAL_NVP(surface_flux_tally_),
+        CEREAL_NVP(surface_flux_));
 
     // Must instantiate Eigen bits
     // Set CMFD fluxes to 1
@@ -294,8 +559,8 @@ class CMFD {
       }
     }
 
-    // No need to treat M_ and QM_. These will be reallocated and filled when
-    // needed in a CMFD solve.
+    // No need to treat M_ and QM_. Their patterns are empty, so they will be
+    // allocated and filled when needed in a CMFD solve.
   }
 };
 
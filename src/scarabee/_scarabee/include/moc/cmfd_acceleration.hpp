@@ -0,0 +1,21 @@
+#ifndef CMFD_ACCELERATION_H
+#define CMFD_ACCELERATION_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Acceleration of the CMFD power iteration. Wielandt solves the shifted
+// eigenvalue problem, with a shifted keff slightly above the current keff
+// estimate, which reduces the dominance ratio of the iteration. Chebyshev
+// extrapolates the flux iterates with Chebyshev polynomials, once the
+// dominance ratio has been estimated from a few unaccelerated iterations.
+enum class CMFDAcceleration : std::uint8_t {
+  Unaccelerated,
+  Wielandt,
+  Chebyshev
+};
+
+}  // namespace scarabee
+
+#endif
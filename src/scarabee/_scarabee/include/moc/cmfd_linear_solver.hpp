@@ -0,0 +1,23 @@
+#ifndef CMFD_LINEAR_SOLVER_H
+#define CMFD_LINEAR_SOLVER_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Method used to solve the linear systems of the CMFD power iteration and
+// fixed source solves. BiCGSTAB uses the diagonal preconditioner, while
+// ILUTBiCGSTAB uses an incomplete LU factorization with thresholding.
+// SparseLU factorizes the matrix once per CMFD solve, and then solves each
+// power iteration directly. Auto picks SparseLU for small systems, and
+// ILUTBiCGSTAB otherwise.
+enum class CMFDLinearSolver : std::uint8_t {
+  BiCGSTAB,
+  ILUTBiCGSTAB,
+  SparseLU,
+  Auto
+};
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef DEVICE_SWEEP_H
+#define DEVICE_SWEEP_H
+
+#include <moc/segment_store.hpp>
+#include <moc/storage_precision.hpp>
+#include <moc/track.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace scarabee {
+
+// Isotropic transport sweep on an OpenMP offload device. The packed segments,
+// the total cross sections, and the boundary angular fluxes stay resident on
+// the device between sweeps, so that a sweep only sends the source and
+// returns the scalar flux tallies. As with the Tracks parallelism on the host,
+// all tracks read the boundary fluxes of the previous sweep. CMFD currents are
+// not tallied, and the exponentials use the rational approximation. When no
+// offload target was compiled, the sweep runs on the host threads.
+class DeviceSweep {
+ public:
+  static constexpr std::size_t MAX_POLAR = 16;
+
+  DeviceSweep() = default;
+  ~DeviceSweep();
+
+  DeviceSweep(const DeviceSweep&) = delete;
+  DeviceSweep& operator=(const DeviceSweep&) = delete;
+
+  bool resident() const { return resident_; }
+
+  // Copies the tracks, materials, and boundary angular fluxes to the device
+  void upload(const std::vector<std::vector<Track>>& tracks,
+              const SegmentStore& segs, const xt::xtensor<double, 2>& mat_Et,
+              std::span<const double> invs_sin, std::span<const double> wsin,
+              const xt::xtensor<StoredReal, 3>& track_flux,
+              std::size_t nfsrs);
+
+  // Sweeps all tracks in the groups [g_begin, g_end) with the source src,
+  // indexed by group then FSR, and adds the unnormalized scalar flux tallies
+  // to sflux.
+  void sweep(const xt::xtensor<double, 2>& src, xt::xtensor<double, 3>& sflux,
+             std::size_t g_begin, std::size_t g_end);
+
+  // Copies the boundary angular fluxes back to the host
+  void download(xt::xtensor<StoredReal, 3>& track_flux);
+
+  // Frees the device memory
+  void release();
+
+ private:
+  std::size_t ntracks_{0};
+  std::size_t nsegs_{0};
+  std::size_t nmats_{0};
+  std::size_t ngroups_{0};
+  std::size_t npol_{0};
+  std::size_t nfsrs_{0};
+  std::size_t nrows_{0};
+  bool resident_{false};
+
+  // Host mirrors of the device arrays
+  std::vector<std::uint64_t> seg_offsets_;  // First segment of each track
+  std::vector<std::uint32_t> fsr_;
+  std::vector<std::uint32_t> xs_;
+  std::vector<StoredReal> length_;
+  std::vector<double> tw_;              // 4 pi * weight * width of each track
+  std::vector<std::uint64_t> in_rows_;  // Incoming row, by track & direction
+  std::vector<std::uint64_t> out_rows_;  // Outgoing row, by track & direction
+  std::vector<std::uint8_t> vacuum_;     // Outgoing flux is lost if non-zero
+  std::vector<double> Et_;               // Indexed by material then group
+  std::vector<double> invs_Et_;
+  std::vector<double> invs_sin_;
+  std::vector<double> wsin_;
+  std::vector<StoredReal> psi_in_;   // Boundary fluxes read by the sweep
+  std::vector<StoredReal> psi_out_;  // Boundary fluxes written by the sweep
+  std::vector<double> src_;          // Indexed by group then FSR
+  std::vector<double> tally_;        // Indexed by group then FSR
+};
+
+}  // namespace scarabee
+
+#endif
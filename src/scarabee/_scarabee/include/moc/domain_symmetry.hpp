@@ -0,0 +1,18 @@
+#ifndef DOMAIN_SYMMETRY_H
+#define DOMAIN_SYMMETRY_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Symmetry of the problem which the MOCDriver may exploit. Full sweeps every
+// track. Diagonal is for problems which are symmetric under a reflection
+// about the diagonal through the (x_min, y_min) and (x_max, y_max) corners of
+// a square domain, such as the quarter of an octant symmetric assembly. Only
+// the tracks on one side of the diagonal direction are then swept, and the
+// tallies of the others are obtained from the mirrored regions.
+enum class DomainSymmetry : std::uint8_t { Full, Diagonal };
+
+}  // namespace scarabee
+
+#endif
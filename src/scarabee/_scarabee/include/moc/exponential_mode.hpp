@@ -0,0 +1,17 @@
+#ifndef EXPONENTIAL_MODE_H
+#define EXPONENTIAL_MODE_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Method used to evaluate 1 - exp(-tau) in the transport sweep. Rational uses
+// the rational approximation of mexp. Table uses a linearly interpolated
+// table with a user selected maximum error. Precomputed evaluates the
+// exponential of every segment, group, and polar angle once per solve, and
+// reuses the values for all source iterations.
+enum class ExponentialMode : std::uint8_t { Rational, Table, Precomputed };
+
+}  // namespace scarabee
+
+#endif
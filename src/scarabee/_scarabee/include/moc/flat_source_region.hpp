@@ -15,6 +15,10 @@
 #include <cereal/types/memory.hpp>
 #include <cereal/types/vector.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -39,9 +43,12 @@ struct RegionToken {
 
 class FlatSourceRegion {
  public:
-  FlatSourceRegion() : tokens_(), xs_(), volume_(), id_(id_counter++) {}
+  FlatSourceRegion()
+      : tokens_(), xs_(), volume_(), id_(id_counter++), shape_() {}
 
   bool inside(const Vector& r, const Direction& u) const {
+    if (shape_.compiled) return compiled_inside(r, u);
+
     for (const auto& t : tokens_) {
       if (t.inside(r, u) == false) return false;
     }
@@ -49,6 +56,8 @@ class FlatSourceRegion {
   }
 
   double distance(const Vector& r, const Direction& u) const {
+    if (shape_.compiled) return compiled_distance(r, u);
+
     double min_dist = INF;
     for (const auto& t : tokens_) {
       double token_dist = t.surface->distance(r, u);
@@ -70,17 +79,46 @@ class FlatSourceRegion {
   double& volume() { return volume_; }
   const double& volume() const { return volume_; }
 
+  // Copies the coefficients of the surfaces of the tokens into the compiled
+  // shape, which inside and distance then use instead of the tokens. Must
+  // be called again if the tokens are changed.
+  void compile();
+  bool compiled() const { return shape_.compiled; }
+
  private:
+  // Surfaces of the tokens grouped by type, so that a query does not
+  // dispatch on the type of each surface. X and y planes are stored as
+  // planes A*x + B*y = C, and all planes are evaluated by the same
+  // branch-light loop. Surfaces of other types, such as the corners of BWR
+  // boxes, are left to the tokens.
+  struct CompiledShape {
+    std::array<double, MAX_SURFS> A, B, C;
+    std::array<bool, MAX_SURFS> axis;  // X or y plane
+    std::array<bool, MAX_SURFS> plane_positive;
+    std::array<double, MAX_SURFS> x0, y0, rc;
+    std::array<bool, MAX_SURFS> cylinder_positive;
+    std::array<std::uint8_t, MAX_SURFS> other;  // Token indices
+    std::uint8_t nplanes{0};
+    std::uint8_t ncylinders{0};
+    std::uint8_t nother{0};
+    bool compiled{false};
+  };
+
   htl::static_vector<RegionToken, MAX_SURFS> tokens_;
   std::shared_ptr<CrossSection> xs_;
   double volume_;
   std::size_t id_;
+  CompiledShape shape_;
+
+  bool compiled_inside(const Vector& r, const Direction& u) const;
+  double compiled_distance(const Vector& r, const Direction& u) const;
 
   friend class cereal::access;
   template <class Archive>
   void serialize(Archive& arc) {
     arc(CEREAL_NVP(tokens_), CEREAL_NVP(xs_), CEREAL_NVP(volume_),
         CEREAL_NVP(id_));
+    if constexpr (Archive::is_loading::value) compile();
   }
 
   static std::size_t id_counter;
@@ -101,7 +139,15 @@ struct UniqueFSR {
   }
 
   bool operator==(const UniqueFSR& rhs) const {
-    return (this->fsr == rhs.fsr) && (this->instance && rhs.instance);
+    return (this->fsr == rhs.fsr) && (this->instance == rhs.instance);
+  }
+};
+
+struct UniqueFSRHash {
+  std::size_t operator()(const UniqueFSR& ufsr) const {
+    const std::size_t h = std::hash<const FlatSourceRegion*>()(ufsr.fsr);
+    return h ^ (std::hash<std::size_t>()(ufsr.instance) + 0x9e3779b97f4a7c15 +
+                (h << 6) + (h >> 2));
   }
 };
 
@@ -0,0 +1,40 @@
+#ifndef FLUX_LAYOUT_H
+#define FLUX_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace scarabee {
+
+// Memory layout of the scalar flux tallies and of the source read by the
+// isotropic MOC sweep, when the tracks are distributed over the threads.
+// GroupMajor stores all FSRs of a group together, as the flux of the
+// MOCDriver, which suits sweeps distributed over the groups. RegionMajor
+// stores all groups of an FSR together, so that the FSRs of a track stay in
+// cache while its groups are swept one after the other by the same thread.
+enum class FluxLayout : std::uint8_t { GroupMajor, RegionMajor };
+
+// Element for group g and region i of an array in layout L, which is
+// indexed by (group, region) for GroupMajor and (region, group) otherwise
+template <FluxLayout L, typename Array>
+decltype(auto) layout_at(Array& a, std::size_t g, std::size_t i) {
+  if constexpr (L == FluxLayout::GroupMajor) {
+    return a(g, i);
+  } else {
+    return a(i, g);
+  }
+}
+
+template <FluxLayout L, typename Array>
+decltype(auto) layout_at(Array& a, std::size_t g, std::size_t i,
+                         std::size_t lj) {
+  if constexpr (L == FluxLayout::GroupMajor) {
+    return a(g, i, lj);
+  } else {
+    return a(i, g, lj);
+  }
+}
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef FSR_ORDER_H
+#define FSR_ORDER_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Order of the FSR indices of the MOCDriver. Geometry numbers the FSRs by
+// id, then by instance, so that the instances of an FSR id are together, but
+// FSRs which are next to each other in space may be far apart. Hilbert
+// numbers the FSRs cell by cell, along a Hilbert curve through the centers
+// of the cells, so that the FSRs crossed one after the other by a track are
+// mostly close in the flux and source arrays.
+enum class FSROrder : std::uint8_t { Geometry, Hilbert };
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef GEOMETRY_RASTER_H
+#define GEOMETRY_RASTER_H
+
+#include <moc/cartesian_2d.hpp>
+#include <moc/flat_source_region.hpp>
+#include <moc/plot_color_by.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace scarabee {
+
+class MOCDriver;
+
+// Rectangular window of the geometry, drawn with nx by ny pixels. The first
+// row of pixels is at the top of the window.
+struct RasterView {
+  double x_min{0.};
+  double x_max{1.};
+  double y_min{0.};
+  double y_max{1.};
+  std::size_t nx{1};
+  std::size_t ny{1};
+
+  double dx() const { return (x_max - x_min) / static_cast<double>(nx); }
+  double dy() const { return (y_max - y_min) / static_cast<double>(ny); }
+};
+
+// FSR of each pixel of a view, row by row, and the pixels on which the
+// boundary between two FSRs is drawn
+struct GeometryRaster {
+  std::size_t nx{0};
+  std::size_t ny{0};
+  std::vector<UniqueFSR> fsrs;
+  std::vector<std::uint8_t> boundary;
+
+  const UniqueFSR& fsr(std::size_t j, std::size_t i) const {
+    return fsrs[j * nx + i];
+  }
+
+  bool on_boundary(std::size_t j, std::size_t i) const {
+    return boundary[j * nx + i] != 0;
+  }
+};
+
+// Rasterizes the geometry in the view. Tiles of rows are traced in
+// parallel, each row from one FSR boundary to the next, rather than by
+// locating the FSR of every pixel. When boundaries is true, tiles of
+// columns are then traced, so that the boundaries crossed along y are
+// marked as well.
+GeometryRaster rasterize_geometry(const Cartesian2D& geom,
+                                  const RasterView& view, bool boundaries);
+
+using RGB = std::array<std::uint8_t, 3>;
+
+// Colors of the cells and materials in images of the geometry. A color is
+// drawn at random the first time that a cell or material is looked up,
+// from a fixed seed, so that the same geometry is always given the same
+// colors. The tables are hashed, as a color is looked up for every run of
+// pixels.
+class PlotColors {
+ public:
+  // The FSR of ufsr must not be null
+  RGB get(const UniqueFSR& ufsr, PlotColorBy by);
+  void set(const UniqueFSR& ufsr, PlotColorBy by, const RGB& color);
+
+ private:
+  std::unordered_map<std::size_t, RGB> cell_;
+  std::unordered_map<UniqueFSR, RGB, UniqueFSRHash> unique_cell_;
+  std::unordered_map<const CrossSection*, RGB> material_;
+  std::unordered_map<std::string, RGB> material_name_;
+  std::minstd_rand rng_;
+
+  RGB random_color();
+};
+
+// Colors the pixels of a raster by the cells or materials of their FSRs,
+// with an array indexed by row, column, and RGB channel. The pixels outside
+// the geometry have the background color, and the boundaries are black
+// when outline is true.
+xt::xtensor<std::uint8_t, 3> color_raster(const GeometryRaster& raster,
+                                          PlotColors& colors, PlotColorBy by,
+                                          bool outline, const RGB& background);
+
+// Writes an RGB image, indexed by row, column, and channel, to a PNG file
+void write_png(const std::filesystem::path& fname,
+               const xt::xtensor<std::uint8_t, 3>& rgb);
+
+// Writes a PNG image of the whole geometry, with nx by ny pixels
+void render_geometry_png(const Cartesian2D& geom,
+                         const std::filesystem::path& fname, std::size_t nx,
+                         std::size_t ny, PlotColorBy by, bool outline);
+
+// Writes a PNG image of the scalar flux of group g of a solved MOCDriver,
+// with nx by ny pixels. The flux is mapped linearly from dark blue at its
+// minimum to yellow at its maximum.
+void render_flux_png(const MOCDriver& moc, const std::filesystem::path& fname,
+                     std::size_t nx, std::size_t ny, std::size_t g,
+                     bool outline);
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef MOC_2D1D_DRIVER_H
+#define MOC_2D1D_DRIVER_H
+
+#include <moc/moc_driver.hpp>
+#include <moc/cartesian_2d.hpp>
+#include <moc/boundary_condition.hpp>
+#include <moc/quadrature/polar_quadrature.hpp>
+#include <data/cross_section.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace scarabee {
+
+// Solves a 3D problem with the 2D/1D method. The problem is cut into axial
+// planes, each solved by its own MOCDriver, and into radial channels on a
+// Cartesian mesh, usually one per pin cell. In every outer iteration, the
+// planes are solved concurrently, and the radial leakage of each channel is
+// found from its neutron balance. A 1D diffusion problem along z is then
+// solved in each channel, with the radial leakage as a transverse leakage,
+// and its axial leakage is given back to the planes as a flat external
+// source. Planes with the same radial geometry share one track laydown.
+class MOC2D1DDriver {
+ public:
+  MOC2D1DDriver(const std::vector<std::shared_ptr<Cartesian2D>>& planes,
+                const std::vector<double>& dz, const std::vector<double>& dx,
+                const std::vector<double>& dy,
+                BoundaryCondition xmin = BoundaryCondition::Reflective,
+                BoundaryCondition xmax = BoundaryCondition::Reflective,
+                BoundaryCondition ymin = BoundaryCondition::Reflective,
+                BoundaryCondition ymax = BoundaryCondition::Reflective,
+                BoundaryCondition zmin = BoundaryCondition::Reflective,
+                BoundaryCondition zmax = BoundaryCondition::Reflective);
+
+  std::size_t nplanes() const { return planes_.size(); }
+  std::size_t nchannels() const { return dx_.size() * dy_.size(); }
+  std::size_t ngroups() const { return ngroups_; }
+
+  const std::vector<double>& dx() const { return dx_; }
+  const std::vector<double>& dy() const { return dy_; }
+  const std::vector<double>& dz() const { return dz_; }
+
+  // MOCDriver of plane p, counted from the bottom. Its solver settings may
+  // be changed, but it must not be given a CMFD.
+  const std::shared_ptr<MOCDriver>& plane(std::size_t p) const;
+  const std::vector<std::shared_ptr<MOCDriver>>& planes() const {
+    return planes_;
+  }
+
+  // FSRs of plane p in the channel c, with the channels numbered along x
+  // first. Only available once the tracks are generated.
+  const std::vector<std::size_t>& channel_fsrs(std::size_t p,
+                                               std::size_t c) const;
+
+  BoundaryCondition z_min_bc() const { return z_min_bc_; }
+  BoundaryCondition z_max_bc() const { return z_max_bc_; }
+
+  void generate_tracks(std::uint32_t n_angles, double d,
+                       PolarQuadrature polar_quad);
+  bool drawn() const { return channel_fsrs_.empty() == false; }
+
+  void solve();
+  bool solved() const { return solved_; }
+  double keff() const { return keff_; }
+
+  double keff_tolerance() const { return keff_tol_; }
+  void set_keff_tolerance(double ktol);
+
+  double flux_tolerance() const { return flux_tol_; }
+  void set_flux_tolerance(double ftol);
+
+  std::size_t max_iterations() const { return max_iters_; }
+  void set_max_iterations(std::size_t n);
+
+  // Number of 1D diffusion cells in each plane of the axial solves
+  std::size_t axial_subdivisions() const { return nsub_; }
+  void set_axial_subdivisions(std::size_t n);
+
+  // Average flux of the channel c in plane p
+  double channel_flux(std::size_t p, std::size_t c, std::size_t g) const;
+
+  // Net axial current through the bottom of plane p in the channel c, in
+  // the +z direction. The top of the last plane is surface p = nplanes.
+  double axial_current(std::size_t p, std::size_t c, std::size_t g) const;
+
+ private:
+  std::vector<std::shared_ptr<MOCDriver>> planes_;
+  std::vector<double> dz_;
+  std::vector<double> dx_;
+  std::vector<double> dy_;
+  // FSRs of each channel, indexed by plane then channel
+  std::vector<std::vector<std::vector<std::size_t>>> channel_fsrs_;
+  xt::xtensor<double, 3> channel_flux_;   // plane, channel, group
+  xt::xtensor<double, 3> radial_leak_;    // plane, channel, group
+  xt::xtensor<double, 3> axial_current_;  // surface, channel, group
+  xt::xtensor<double, 3> axial_flux_;     // channel, group, 1D cell
+  std::size_t ngroups_;
+  std::size_t nsub_{4};
+  std::size_t max_iters_{100};
+  double keff_{1.};
+  double keff_tol_{1.E-5};
+  double flux_tol_{1.E-4};
+  BoundaryCondition z_min_bc_;
+  BoundaryCondition z_max_bc_;
+  bool solved_{false};
+
+  void homogenize_channels(
+      std::vector<std::vector<std::shared_ptr<CrossSection>>>& xs);
+  // Solves the 1D diffusion problem of channel c with the fission source of
+  // the keff estimate, and stores its axial currents
+  void axial_solve(
+      std::size_t c,
+      const std::vector<std::vector<std::shared_ptr<CrossSection>>>& xs);
+  void set_axial_leakage();
+};
+
+}  // namespace scarabee
+
+#endif
@@ -6,10 +6,26 @@
 #include <moc/boundary_condition.hpp>
 #include <moc/flat_source_region.hpp>
 #include <moc/track.hpp>
+#include <moc/segment_store.hpp>
+#include <moc/track_chains.hpp>
+#include <moc/sweep_parallelism.hpp>
+#include <moc/exponential_mode.hpp>
+#include <moc/transport_solver.hpp>
+#include <moc/source_shape.hpp>
+#include <moc/domain_symmetry.hpp>
+#include <moc/fsr_order.hpp>
+#include <moc/tally_score.hpp>
+#include <moc/flux_layout.hpp>
+#include <moc/storage_precision.hpp>
+#include <moc/device_sweep.hpp>
 #include <moc/quadrature/polar_quadrature.hpp>
 #include <utils/simulation_mode.hpp>
 #include <utils/spherical_harmonics.hpp>
 #include <utils/serialization.hpp>
+#include <utils/exp_table.hpp>
+#include <utils/solver_telemetry.hpp>
+#include <utils/memory_usage.hpp>
+#include <utils/threads.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
 
@@ -17,8 +33,15 @@
 #include <cereal/types/vector.hpp>
 #include <cereal/types/memory.hpp>
 
+#include <array>
+#include <iosfwd>
+#include <limits>
 #include <map>
 #include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace scarabee {
@@ -64,9 +87,103 @@ class MOCDriver {
 
   double keff() const { return keff_; }
 
+  // Phase times, swept segments, convergence history, and array sizes of the
+  // last solve. The CMFD solves are recorded in the telemetry of the CMFD.
+  const SolverTelemetry& telemetry() const { return telemetry_; }
+
+  // Bytes currently held by the arrays of the solver, by component. The
+  // cross sections of the materials, and the CMFD, are counted as well. The
+  // components are logged after generate_tracks and solve.
+  MemoryUsage memory_usage() const;
+
+  // Number of threads of the parallel regions of the solver. When 0, the
+  // solver uses one thread per pinned core, or the process wide default.
+  std::size_t num_threads() const { return threads_.num_threads; }
+  void set_num_threads(std::size_t n) { threads_.num_threads = n; }
+
+  // Cores to which the threads of the solver are pinned, none if empty
+  const std::vector<std::size_t>& cores() const { return threads_.cores; }
+  void set_cores(const std::vector<std::size_t>& cores) {
+    threads_.set_cores(cores);
+  }
+
   SimulationMode& sim_mode() { return mode_; }
   const SimulationMode& sim_mode() const { return mode_; }
 
+  SweepParallelism& sweep_parallelism() { return sweep_par_; }
+  const SweepParallelism& sweep_parallelism() const { return sweep_par_; }
+
+  // Layout of the source and of the thread-private flux tallies of the
+  // isotropic sweep, when the tracks are distributed over the threads. The
+  // flux of the driver is always indexed by group, FSR, and harmonic.
+  FluxLayout& flux_layout() { return flux_layout_; }
+  const FluxLayout& flux_layout() const { return flux_layout_; }
+
+  TransportSolver& transport_solver() { return solver_; }
+  const TransportSolver& transport_solver() const { return solver_; }
+
+  // Shape of the source in each FSR. The linear source requires an
+  // isotropic problem solved with source iterations.
+  SourceShape& source_shape() { return source_shape_; }
+  const SourceShape& source_shape() const { return source_shape_; }
+
+  // Symmetry used to sweep only part of the tracks. The fluxes of all FSRs
+  // are still computed. Diagonal symmetry is checked against the geometry
+  // and the track laydown at the start of the solve, and is not available
+  // with CMFD or anisotropic scattering.
+  DomainSymmetry& symmetry() { return symmetry_; }
+  const DomainSymmetry& symmetry() const { return symmetry_; }
+
+  // Order of the FSR indices. Changing it permutes the flux and the external
+  // source, and requires the tracks to be generated again.
+  FSROrder fsr_order() const { return fsr_order_; }
+  void set_fsr_order(FSROrder order);
+
+  // With bundled sweeps, the tracks of each azimuthal angle are sorted by
+  // their position across the angle, and cut into bundles of neighboring
+  // parallel tracks. A bundle is swept by one thread, track by track in both
+  // directions, so that the FSRs it touches stay in the cache of the thread.
+  // Bundles never mix angles, and are swept in the order of the angles. It
+  // complements the Hilbert FSR order, and has no effect on chain sweeps.
+  bool bundled_sweep() const { return bundled_sweep_; }
+  void set_bundled_sweep(bool bs);
+
+  double krylov_tolerance() const { return krylov_tol_; }
+  void set_krylov_tolerance(double tol);
+
+  std::size_t krylov_restart() const { return krylov_restart_; }
+  void set_krylov_restart(std::size_t m);
+
+  std::size_t krylov_max_iterations() const { return krylov_max_iters_; }
+  void set_krylov_max_iterations(std::size_t n);
+
+  // Anderson mixing of the flux moments and keff between outer iterations.
+  // A depth of 0, with no damping, disables it.
+  std::size_t anderson_depth() const { return anderson_depth_; }
+  void set_anderson_depth(std::size_t m) { anderson_depth_ = m; }
+
+  double anderson_damping() const { return anderson_damping_; }
+  void set_anderson_damping(double wd);
+
+  // Sweeps isotropic source iterations without CMFD on the offload device.
+  // Only available when built with SCARABEE_USE_GPU.
+  bool device_sweep() const { return device_sweep_; }
+  void set_device_sweep(bool ds);
+
+  ExponentialMode& exponential_mode() { return exp_mode_; }
+  const ExponentialMode& exponential_mode() const { return exp_mode_; }
+
+  double exp_table_max_error() const { return exp_table_.max_error(); }
+  void set_exp_table_max_error(double err) { exp_table_ = ExpTable(err); }
+
+  double exp_max_memory() const { return exp_max_memory_; }
+  void set_exp_max_memory(double mem);
+
+  // Maximum memory of the angular source cache of the anisotropic sweep. The
+  // groups are swept in blocks which fit within it.
+  double angular_source_max_memory() const { return ang_src_max_memory_; }
+  void set_angular_source_max_memory(double mem);
+
   double keff_tolerance() const { return keff_tol_; }
   void set_keff_tolerance(double ktol);
 
@@ -79,12 +196,173 @@ class MOCDriver {
   bool check_fsr_areas() const { return check_fsr_areas_; }
   void set_check_fsr_areas(bool v) { check_fsr_areas_ = v; }
 
+  // When enabled, FSRs with distinct CrossSection objects whose values agree
+  // within xs_dedup_tolerance share one material in the solver tables. The
+  // materials are indexed again at the start of every solve.
+  bool deduplicate_xs() const { return dedup_xs_; }
+  void set_deduplicate_xs(bool v) { dedup_xs_ = v; }
+
+  double xs_dedup_tolerance() const { return xs_dedup_tol_; }
+  void set_xs_dedup_tolerance(double rtol);
+
+  // Number of distinct materials used by the solver
+  std::size_t num_materials() const { return xs_list_.size(); }
+
   void generate_tracks(std::uint32_t n_angles, double d,
                        PolarQuadrature polar_quad);
 
+  // Starts from a coarse laydown of 8 angles and a spacing of 0.2 cm, and
+  // halves the track spacing until the FSR area error is below area_tol.
+  // Then, for keff problems, the number of angles is doubled or the spacing
+  // halved, whichever changes keff the most, until neither changes keff by
+  // more than keff_tol. This solves the problem once per trial laydown. The
+  // chosen number of angles and track spacing are returned, and the tracks
+  // are left traced with them. A keff_tol of 0 only refines for the areas.
+  std::pair<std::uint32_t, double> generate_tracks_adaptive(
+      PolarQuadrature polar_quad, double area_tol, double keff_tol,
+      std::uint32_t max_angles = 128, double min_d = 0.005);
+
+  // Largest total absolute error of the FSR areas estimated by the tracks of
+  // one azimuthal angle, before renormalization, relative to the total area.
+  double fsr_area_error() const { return fsr_area_error_; }
+
+  // With modular ray tracing, the track spacing is chosen so that tracks
+  // cross all the tiles of the geometry in the same manner. Each distinct
+  // tile is then only traced once per local entry position and angle.
+  bool modular_ray_tracing() const { return modular_rt_; }
+  void set_modular_ray_tracing(bool mrt) { modular_rt_ = mrt; }
+
+  // With on-the-fly ray tracing, generate_tracks only keeps the end points
+  // of the tracks, and the length correction of each FSR and angle. Each
+  // thread traces the segments of a track again into a small buffer before
+  // sweeping it, so that the memory scales with the number of FSRs instead
+  // of the number of segments. With modular ray tracing, each thread keeps
+  // the tile templates, which makes the tracing much faster. The linear
+  // source, precomputed exponentials, diagonal symmetry, the device sweep,
+  // and track caches or sharing are not available with it.
+  bool on_the_fly_tracing() const { return otf_tracing_; }
+  void set_on_the_fly_tracing(bool otf) { otf_tracing_ = otf; }
+
+  // With compressed segments, generate_tracks stores the FSR index and the
+  // length of each segment in 4 bytes, and releases the segments of the
+  // tracks. Each thread decodes a track into a small buffer before sweeping
+  // it. The features which are not available with on-the-fly tracing are
+  // not available either, except for track caches and shared tracks.
+  bool compressed_segments() const { return compress_segments_; }
+  void set_compressed_segments(bool cs) { compress_segments_ = cs; }
+
+  // When set, generate_tracks looks for a previous track laydown of the same
+  // geometry in this file, and writes the laydown to it after tracing.
+  const std::string& track_cache_file() const { return track_cache_file_; }
+  void set_track_cache_file(const std::string& fname);
+
+  // When set, and no track cache file is given, each laydown is cached in
+  // its own file of this directory, named after the hash of the geometry.
+  // Many drivers, possibly in different processes, may share the directory.
+  const std::string& track_cache_dir() const { return track_cache_dir_; }
+  void set_track_cache_dir(const std::string& dname);
+
+  // When set, generate_tracks reuses the track laydown of any other driver
+  // sharing its tracks with the same geometry, number of angles, and track
+  // spacing, instead of tracing it again. Only the segments are shared; each
+  // driver keeps its own fluxes. A laydown lives as long as a driver uses it.
+  bool share_tracks() const { return share_tracks_; }
+  void set_share_tracks(bool share) { share_tracks_ = share; }
+
+  // Traces again only the tracks crossing the tiles of the geometry whose
+  // fill was changed with set_tiles since the tracks were traced, and keeps
+  // the segments of all other tracks, which are given the new FSR indices.
+  // The FSRs of the unchanged tiles keep their flux, and the new FSRs start
+  // from the average flux of the replaced ones, so that the next solve
+  // starts from the previous solution. Only the tiles of the root geometry
+  // are compared. It is not available with on-the-fly tracing or compressed
+  // segments. Returns the number of tracks which were traced again.
+  std::size_t retrace_changed_tiles();
+
+  // With Gauss-Seidel outer iterations, the isotropic solver sweeps the
+  // groups one at a time, from fast to thermal, computing the scattering
+  // source of each group with the fluxes already updated in the iteration.
+  // The groups with upscattering are swept thermal_iterations times.
+  bool gauss_seidel() const { return gauss_seidel_; }
+  void set_gauss_seidel(bool gs) { gauss_seidel_ = gs; }
+
+  std::size_t thermal_iterations() const { return thermal_iters_; }
+  void set_thermal_iterations(std::size_t n);
+
+  // With group masking, the isotropic source iterations stop sweeping a
+  // group once its flux changes by less than group_mask_ratio times the
+  // flux tolerance between iterations, for as long as its source stays
+  // within the same relative tolerance of the source of its last sweep.
+  // All groups are swept every group_mask_interval iterations, and once
+  // more after convergence. Masking is not used with CMFD or GMRES.
+  bool group_masking() const { return group_masking_; }
+  void set_group_masking(bool mask) { group_masking_ = mask; }
+
+  double group_mask_ratio() const { return group_mask_ratio_; }
+  void set_group_mask_ratio(double ratio);
+
+  std::size_t group_mask_interval() const { return group_mask_interval_; }
+  void set_group_mask_interval(std::size_t n);
+
+  // With the MPI group decomposition, every rank sweeps all tracks for its
+  // own block of groups, instead of a range of tracks for all groups. The
+  // scalar fluxes of the blocks are gathered after each sweep, and the
+  // boundary fluxes once the problem is solved. This scales better for
+  // problems with many groups, but is not available with GMRES, and
+  // Gauss-Seidel iterations only sweep one block at a time.
+  bool mpi_group_decomposition() const { return mpi_groups_; }
+  void set_mpi_group_decomposition(bool groups);
+
+  // When a condensation scheme is set, an isotropic solve which does not
+  // start from a previous solution first solves the problem in these coarse
+  // groups, on the same tracks. The cross sections of each material are
+  // condensed with its infinite medium spectrum, which then prolongates the
+  // coarse scalar flux back to the fine groups. The boundary angular fluxes
+  // are prolongated with the spectrum of the whole geometry. The fine solve
+  // starts from this flux and the coarse keff. An empty scheme disables it.
+  const std::vector<std::pair<std::size_t, std::size_t>>&
+  coarse_presolve_groups() const {
+    return presolve_groups_;
+  }
+  void set_coarse_presolve_groups(
+      const std::vector<std::pair<std::size_t, std::size_t>>& groups);
+
+  // The converged solutions of previous solves are kept to extrapolate the
+  // starting flux, boundary angular fluxes, and keff of the next solve, as a
+  // polynomial of the solution step (burnup, or any branch parameter) set
+  // before each solve. With an order of 0, the next solve simply starts from
+  // the previous solution.
+  std::size_t extrapolation_order() const { return extrap_order_; }
+  void set_extrapolation_order(std::size_t order);
+
+  double solution_step() const { return solution_step_; }
+  void set_solution_step(double step) { solution_step_ = step; }
+
+  std::size_t solution_history_size() const { return history_.size(); }
+
+  // When false, converged solutions are not added to the history, so that
+  // solves of perturbed states do not change the extrapolation of the others
+  bool record_solutions() const { return record_solutions_; }
+  void set_record_solutions(bool record) { record_solutions_ = record; }
+  void clear_solution_history();
+
+  // Starts the next solve from the given keff and scalar flux (group, FSR,
+  // spherical harmonic), such as a solution saved in a checkpoint, instead
+  // of a flat flux. Boundary angular fluxes start isotropic.
+  void set_initial_solution(double keff, const xt::xtensor<double, 3>& flux);
+
   void solve();
   bool solved() const { return solved_; }
 
+  // Solves a fixed-source problem without scattering in a single pass over
+  // the chains of tracks, instead of iterating on the boundary fluxes. The
+  // flux of each segment is the sum of the sources upstream along its chain,
+  // attenuated with Ki3, which integrates the polar angle exactly. Regions
+  // whose total cross section is at least black_xs absorb every neutron
+  // entering them. This is meant for Dancoff factor calculations, in which
+  // the fuel or the cladding is black.
+  void solve_chords(double black_xs = 1.E4);
+
   std::shared_ptr<CrossSection> homogenize() const;
   std::shared_ptr<CrossSection> homogenize(
       const std::vector<std::size_t>& regions) const;
@@ -93,6 +371,32 @@ class MOCDriver {
   xt::xtensor<double, 1> homogenize_flux_spectrum(
       const std::vector<std::size_t>& regions) const;
 
+  // Homogenizes each set of regions, in a single parallel pass over the
+  // regions of all sets. The spectra are indexed by set then group.
+  std::vector<std::shared_ptr<CrossSection>> homogenize_sets(
+      const std::vector<std::vector<std::size_t>>& region_sets) const;
+  xt::xtensor<double, 2> homogenize_flux_spectra(
+      const std::vector<std::vector<std::size_t>>& region_sets) const;
+
+  // Indices of the FSRs in each cell of a Cartesian mesh with the widths dx
+  // and dy, laid from the lower left corner of the geometry. The cells are
+  // numbered along x first. Each FSR is placed in the cell which holds most
+  // of its track length, so the mesh should follow the FSR boundaries.
+  std::vector<std::vector<std::size_t>> mesh_fsr_sets(
+      const std::vector<double>& dx, const std::vector<double>& dy) const;
+
+  // Tallies of a reaction rate integrated over each set of FSRs, in each
+  // group. All tallies are computed in parallel at the end of every solve,
+  // from the converged flux and the dense material tables, and are indexed
+  // by set then group. As they refer to FSR indices, the tallies are removed
+  // when the FSRs are numbered again. Returns the index of the new tally.
+  std::size_t add_tally(
+      const std::vector<std::vector<std::size_t>>& region_sets,
+      TallyScore score);
+  std::size_t num_tallies() const { return tallies_.size(); }
+  const xt::xtensor<double, 2>& tally(std::size_t t) const;
+  void clear_tallies() { tallies_.clear(); }
+
   void apply_criticality_spectrum(const xt::xtensor<double, 1>& flux);
 
   std::size_t size() const;
@@ -105,6 +409,16 @@ class MOCDriver {
               std::size_t lj = 0) const;
   double flux(std::size_t i, std::size_t g, std::size_t lj = 0) const;
 
+  // Direct access to the scalar flux (group, FSR, spherical harmonic) and to
+  // the external source (group, FSR). The arrays keep their storage between
+  // iterations, but are reallocated when the problem is re-initialized.
+  xt::xtensor<double, 3>& flux_array() { return flux_; }
+  const xt::xtensor<double, 3>& flux_array() const { return flux_; }
+  xt::xtensor<double, 2>& extern_src_array() { return extern_src_; }
+  const xt::xtensor<double, 2>& extern_src_array() const {
+    return extern_src_;
+  }
+
   std::vector<std::vector<Track>>& tracks() { return tracks_; }
 
   const std::vector<AngleInfo>& azimuthal_quadrature() const {
@@ -122,6 +436,10 @@ class MOCDriver {
 
   std::size_t get_fsr_indx(const UniqueFSR& fsr) const;
   std::size_t get_fsr_indx(std::size_t fsr_id, std::size_t instance) const;
+  // Indices of the given instance of each FSR ID of each set, in one call
+  std::vector<std::vector<std::size_t>> get_fsr_indxs(
+      const std::vector<std::vector<std::size_t>>& fsr_id_sets,
+      std::size_t instance) const;
 
   std::vector<std::size_t> get_all_fsr_in_cell(const Vector& r,
                                                const Direction& u) const;
@@ -129,11 +447,26 @@ class MOCDriver {
   std::vector<std::pair<std::size_t, double>> trace_fsr_segments(
       const Vector r_start, const Direction& u) const;
 
+  // Batched queries, evaluated in parallel. Positions are given as an (N, 2)
+  // array of x and y, and fluxes are indexed by point (or FSR) then group.
+  xt::xtensor<std::size_t, 1> get_fsr_indices(const xt::xtensor<double, 2>& r,
+                                              const Direction& u) const;
+  xt::xtensor<double, 2> fluxes(const xt::xtensor<double, 2>& r,
+                                const Direction& u, std::size_t lj = 0) const;
+  xt::xtensor<double, 2> fsr_fluxes(const xt::xtensor<std::size_t, 1>& fsrs,
+                                    std::size_t lj = 0) const;
+  std::vector<std::vector<std::pair<std::size_t, double>>> trace_fsr_segments(
+      const xt::xtensor<double, 2>& r_start, const Direction& u) const;
+
   void set_extern_src(const Vector& r, const Direction& u, std::size_t g,
                       double src);
   double extern_src(const Vector& r, const Direction& u, std::size_t g) const;
 
   void set_extern_src(std::size_t i, std::size_t g, double src);
+  void set_extern_src(const xt::xtensor<std::size_t, 1>& fsrs, std::size_t g,
+                      double src);
+  void set_extern_src(const xt::xtensor<std::size_t, 1>& fsrs, std::size_t g,
+                      const xt::xtensor<double, 1>& src);
   double extern_src(std::size_t i, std::size_t g) const;
 
   BoundaryCondition& x_min_bc() { return x_min_bc_; }
@@ -159,6 +492,8 @@ class MOCDriver {
  private:
   std::vector<AngleInfo> angle_info_;       // Information for all angles
   std::vector<std::vector<Track>> tracks_;  // All tracks, indexed by angle
+  SegmentStore seg_store_;                  // Packed segments, for sweep
+  TrackChains chains_;                      // Connected track sweeps
   std::shared_ptr<Cartesian2D> geometry_;   // Geometry for the problem
   std::shared_ptr<CMFD> cmfd_;              // CMFD for acceleration
   PolarQuadrature polar_quad_;              // Polar quadrature
@@ -167,7 +502,27 @@ class MOCDriver {
       flux_;  // Indexed by group, FSR, and spherical harmonic
   xt::xtensor<double, 2> extern_src_;  // Indexed by group then FSR
   std::vector<const FlatSourceRegion*> fsrs_;
-  std::map<std::size_t, std::size_t> fsr_offsets_;  // Indexed by id -> offset
+  std::size_t fsr_id_min_{0};             // Smallest FSR id of the geometry
+  std::vector<std::size_t> fsr_offsets_;  // Indexed by id - fsr_id_min_
+  // FSR index of each offset + instance, when the FSRs are not in geometry
+  // order
+  std::vector<std::size_t> fsr_renumber_;
+  std::vector<std::shared_ptr<CrossSection>> xs_list_;  // Unique FSR xs
+  std::vector<std::uint32_t> fsr_xs_indx_;  // Index in xs_list_ for each FSR
+  // Dense material data, indexed by xs_list_ index then group. This is filled
+  // at the start of each solve, as cross sections may change between solves.
+  xt::xtensor<double, 2> mat_Et_;       // Total xs used for the sweep
+  xt::xtensor<double, 2> mat_invs_Et_;  // Inverse of mat_Et_
+  xt::xtensor<double, 2> mat_vEf_;
+  xt::xtensor<double, 2> mat_chi_;
+  // Transposed scattering matrices without zeros, in compressed rows. Row
+  // m * ngroups_ + g holds the incoming groups which scatter into group g in
+  // material m, with one value per Legendre moment for anisotropic problems.
+  std::vector<std::size_t> mat_scat_offsets_;
+  std::vector<std::uint32_t> mat_scat_gin_;
+  std::vector<double> mat_scat_xs_;
+  std::vector<double> fission_src_;  // Fission source per FSR, without chi
+  std::size_t upscatter_group_{0};   // First group receiving upscattering
   std::size_t ngroups_;
   std::size_t nfsrs_;
   std::size_t n_pol_angles_;
@@ -175,17 +530,197 @@ class MOCDriver {
   double keff_tol_ = 1.E-5;
   double keff_ = 1.;
   bool check_fsr_areas_{false};
+  bool dedup_xs_{true};
+  double xs_dedup_tol_{0.};  // Exact duplicates only by default
   double fsr_area_tol_{0.05};  // Default to 5% tolerance
+  double fsr_area_error_{0.};
   BoundaryCondition x_min_bc_, x_max_bc_, y_min_bc_, y_max_bc_;
   std::size_t max_L_ = 0;     // max-legendre-order in scattering moments
   std::size_t N_lj_ = 1;      // total number of j (-l ro l)
   bool anisotropic_ = false;  // to account for anisotropic scattering
   SimulationMode mode_{SimulationMode::Keff};
+  SweepParallelism sweep_par_{SweepParallelism::Groups};
+  FluxLayout flux_layout_{FluxLayout::GroupMajor};
+  TransportSolver solver_{TransportSolver::SourceIteration};
+  SourceShape source_shape_{SourceShape::Flat};
+  DomainSymmetry symmetry_{DomainSymmetry::Full};
+  FSROrder fsr_order_{FSROrder::Geometry};
+  double krylov_tol_{1.E-6};
+  std::size_t krylov_restart_{20};
+  std::size_t krylov_max_iters_{200};
+  std::size_t anderson_depth_{0};
+  double anderson_damping_{1.};
+  bool device_sweep_{false};
+  DeviceSweep device_;  // Resident only during an isotropic solve
+  xt::xtensor<StoredReal, 3> track_flux_;     // Pool of incoming track fluxes
+  xt::xtensor<StoredReal, 3> boundary_flux_;  // Copy of the pool, for the
+                                          // track parallel sweep
+  std::vector<xt::xtensor<double, 3>> thread_sflux_;  // Thread scalar fluxes
+  xt::xtensor<double, 2> sweep_src_;  // Source, for RegionMajor sweeps
+  // Range of tracks swept by this MPI rank, and boundary flux rows which
+  // they write. A single rank sweeps all tracks.
+  std::size_t rank_tracks_begin_{0};
+  std::size_t rank_tracks_end_{0};
+  std::vector<char> rank_rows_;
+  // Tracks of this rank in the order of the bundled sweep, and first track
+  // of each bundle. Both are empty without bundled sweeps.
+  bool bundled_sweep_{false};
+  std::vector<std::size_t> bundle_tracks_;
+  std::vector<std::size_t> bundle_offsets_;
+  // Block of groups swept by this rank, and first group of each rank, with
+  // the group decomposition. Otherwise, the block holds all groups.
+  bool mpi_groups_{false};
+  std::size_t rank_groups_begin_{0};
+  std::size_t rank_groups_end_{std::numeric_limits<std::size_t>::max()};
+  std::vector<std::size_t> group_offsets_;
+  std::vector<StoredReal> exchange_buf_;
+  ExponentialMode exp_mode_{ExponentialMode::Rational};
+  ExpTable exp_table_;
+  double exp_max_memory_ = 2048.;  // Max MB for precomputed exponentials
+  std::vector<double> exp_store_;  // Indexed by group, segment, polar angle
+  // Anisotropic sweep tables. The harmonics are halved, and are indexed by
+  // azimuthal angle, moment, then polar angle. The angular source of a block
+  // of groups is indexed by group, azimuthal angle, FSR, then polar angle.
+  std::vector<double> aniso_ylj_;
+  std::vector<double> ang_src_;
+  double ang_src_max_memory_ = 2048.;  // Max MB for the angular source
+  std::string track_cache_file_;   // Empty when no cache is used
+  std::string track_cache_dir_;    // Empty when no cache is used
+  bool share_tracks_{false};
+  std::shared_ptr<const std::string> shared_tracks_;  // Laydown in use
+  // Work arrays of the outer iterations, kept between solves
+  xt::xtensor<double, 3> next_flux_;
+  xt::xtensor<double, 2> iso_src_;
+  xt::xtensor<double, 3> aniso_src_;
+  xt::xtensor<double, 2> stab_D_;  // Stabalization factors
+  // Linear source data. The centroids and the inverse of the spatial moment
+  // matrices (xx, xy, yy) of the FSRs are computed from the tracks, as are the
+  // segment midpoints, which are relative to the centroid of their FSR. The
+  // flux moments and source gradients are indexed by group, FSR, then x / y.
+  xt::xtensor<double, 2> fsr_centroids_;
+  xt::xtensor<double, 2> fsr_inv_moments_;
+  std::vector<StoredReal> seg_midpoints_;  // x and y of each segment
+  xt::xtensor<double, 3> flux_mom_;
+  xt::xtensor<double, 3> next_flux_mom_;
+  xt::xtensor<double, 3> src_grad_;
+  xt::xtensor<double, 3> ls_tally_;  // Scalar flux then moments tallies
+  std::vector<double> fission_src_mom_;  // x and y of each FSR, without chi
+  // Diagonal symmetry data, built at the first symmetric solve of a track
+  // laydown. The tracks which are swept are flagged by global index, and
+  // every FSR has its mirror FSR. The rows which are written by tracks which
+  // are not swept are copied from the rows of the mirrored tracks, as
+  // (destination, source) pairs.
+  std::vector<char> track_swept_;  // Empty when all tracks are swept
+  std::vector<std::size_t> fsr_mirror_;
+  std::vector<std::pair<std::size_t, std::size_t>> sym_row_copies_;
+  // Converged solutions of the previous solves, from oldest to newest
+  struct SolutionRecord {
+    double step;
+    double keff;
+    xt::xtensor<double, 3> flux;
+    xt::xtensor<StoredReal, 3> track_flux;
+  };
+  std::vector<SolutionRecord> history_;
+  std::size_t extrap_order_{0};
+  double solution_step_{0.};
+  bool record_solutions_{true};
+  bool modular_rt_{false};
+  bool otf_tracing_{false};
+  bool otf_laydown_{false};  // True when the tracks have no segments
+  bool compress_segments_{false};
+  xt::xtensor<double, 2> otf_renorm_;  // Angle, FSR length correction
+  std::vector<std::size_t> otf_track_nsegs_;  // Only used while tracing
+  bool gauss_seidel_{false};
+  std::size_t thermal_iters_{1};
+  bool group_masking_{false};
+  double group_mask_ratio_{0.1};
+  std::size_t group_mask_interval_{10};
+  std::vector<std::pair<std::size_t, std::size_t>> presolve_groups_;
+  bool tally_currents_{true};  // False for sweeps not tallied for CMFD
   bool solved_{false};
+  mutable SolverTelemetry telemetry_;  // Also updated by the const phases
+  // Fill of each tile of the root geometry when the tracks were traced,
+  // with the indices of its FSRs in an order which only depends on the fill,
+  // so that the FSRs of the unchanged tiles are matched after set_tiles.
+  // Tiles are indexed by i * ny + j. The fills are kept alive, so that a new
+  // fill may not take the address of a replaced one.
+  struct TracedTile {
+    std::shared_ptr<const void> fill;
+    std::vector<std::size_t> fsrs;
+  };
+  std::vector<TracedTile> traced_tiles_;
+  struct Tally {
+    std::vector<std::vector<std::size_t>> region_sets;
+    TallyScore score;
+    xt::xtensor<double, 2> result;  // Empty until the next solve
+  };
+  std::vector<Tally> tallies_;
+  ThreadSettings threads_;  // Not saved, as it depends on the machine
 
   void generate_azimuthal_quadrature(std::uint32_t n_angles, double d);
   void trace_tracks();
 
+  // Segments of a tile crossing, for modular ray tracing. The FSR instance
+  // is local to the tile, and the key is the content of the tile and the
+  // entry position relative to the tile center.
+  struct TileSegment {
+    const FlatSourceRegion* fsr;
+    std::size_t instance;
+    double length;
+  };
+  using TileKey = std::tuple<const void*, long long, long long>;
+  using TileTemplates = std::map<TileKey, std::vector<TileSegment>>;
+  static constexpr double TILE_TEMPLATE_TOL = 1.E-10;
+
+  // Segments of the last track traced on the fly by a thread
+  struct OTFBuffer {
+    std::size_t track{std::numeric_limits<std::size_t>::max()};
+    std::vector<Segment> segments;
+    SegmentStore store;
+    std::vector<TileTemplates> templates;  // For each azimuthal angle
+    std::vector<std::vector<std::size_t>> cmfd_tile_fsrs;
+  };
+  mutable std::vector<OTFBuffer> otf_buffers_;  // For each thread
+
+  // Segments of the global track tt, with tt set to the index of the track
+  // in the returned store. With on-the-fly tracing, the track is traced
+  // again into the buffer of the calling thread, and compressed segments
+  // are decoded into it.
+  const SegmentStore& track_segments(const Track& track,
+                                     std::size_t& tt) const;
+  // True when the segments can be read from seg_store_ by global index
+  bool direct_segments() const {
+    return otf_laydown_ == false && seg_store_.compressed() == false;
+  }
+  void otf_renormalization(const xt::xtensor<double, 2>& approx_vols);
+
+  // Traces the segments of a track from r_start to the geometry boundary and
+  // returns the exit position. Tile templates are used when provided.
+  Vector trace_segments(const Vector& r_start, const Direction& u,
+                        std::vector<Segment>& segments,
+                        std::vector<std::vector<std::size_t>>& cmfd_tile_fsrs,
+                        TileTemplates* templates) const;
+
+  std::uint64_t track_cache_hash(std::uint32_t n_angles, double d) const;
+  std::string track_cache_path(std::uint64_t hash) const;
+  void save_track_cache(const std::string& fname, std::uint64_t hash,
+                        std::uint32_t n_angles, double d) const;
+  bool load_track_cache(const std::string& fname, std::uint64_t hash,
+                        std::uint32_t n_angles, double d);
+
+  // Track laydowns in the format of the track cache file, which source
+  // names in the messages. The FSRs crossed by the tracks are only given to
+  // the CMFD when insert_cmfd_fsrs is true.
+  void write_track_laydown(std::ostream& out, std::uint64_t hash,
+                           std::uint32_t n_angles, double d) const;
+  bool read_track_laydown(const char* data, std::size_t size,
+                          std::uint64_t hash, std::uint32_t n_angles, double d,
+                          const std::string& source,
+                          bool insert_cmfd_fsrs = true);
+
+  // Reads a file in the format written by save_bin
+  void read_bin(const char* data, std::size_t size, const std::string& fname);
+
   void set_ref_vac_bcs_x_max();
   void set_ref_vac_bcs_x_min();
   void set_ref_vac_bcs_y_max();
@@ -195,23 +730,130 @@ class MOCDriver {
   void set_bcs();
 
   void allocate_fsr_data();
+  void renumber_fsrs();
+  // Fills xs_list_ and fsr_xs_indx_, returning true if any FSR changed index
+  bool index_cross_sections();
 
   void allocate_track_fluxes();
+  void save_solution();
+  void extrapolate_solution();
+
+  bool anderson_enabled() const {
+    return anderson_depth_ > 0 || anderson_damping_ < 1.;
+  }
+  void pack_anderson_iterate(std::vector<double>& x) const;
+  void unpack_anderson_iterate(const std::vector<double>& x);
+  void fill_material_tables();
+  void compute_tallies();
+  void fill_fission_source(const xt::xtensor<double, 3>& flux);
+  void fill_exponentials();
+  const double* segment_exponentials(std::size_t s, std::size_t g, double lEt,
+                                     std::array<double, 6>& buf) const;
   void segment_renormalization();
+  std::vector<TracedTile> traced_tile_fsrs() const;
+  // Calls f(s, i, w, l, u, r) for every segment s of FSR i, with the weight w
+  // and direction u of its track, its length l, and its midpoint r
+  template <typename F>
+  void for_each_segment_midpoint(const F& f) const;
 
   // isotropic
   void solve_isotropic();
-  void sweep(xt::xtensor<double, 3>& flux, const xt::xtensor<double, 2>& src);
+  // Infinite medium spectrum of each material, driven by the fission or
+  // external source spectrum of the whole geometry
+  std::vector<xt::xtensor<double, 1>> infinite_medium_spectra() const;
+  void coarse_presolve();
+  void sweep(xt::xtensor<double, 3>& flux, const xt::xtensor<double, 2>& src,
+             std::size_t g_begin, std::size_t g_end);
+  void sweep_isotropic(xt::xtensor<double, 3>& flux,
+                       const xt::xtensor<double, 2>& src, std::size_t g_begin,
+                       std::size_t g_end);
+  // The flux tally and the source are indexed according to L
+  template <FluxLayout L>
+  void sweep_track(Track& track, std::size_t tt, std::size_t g, bool forward,
+                   const StoredReal* in_flx, xt::xtensor<double, 3>& flux,
+                   const xt::xtensor<double, 2>& src);
+  void normalize_flux(xt::xtensor<double, 3>& flux,
+                      const xt::xtensor<double, 2>& src, std::size_t g_begin,
+                      std::size_t g_end) const;
   void fill_source(xt::xtensor<double, 2>& src,
-                   const xt::xtensor<double, 3>& flux) const;
+                   const xt::xtensor<double, 3>& flux, std::size_t g_begin,
+                   std::size_t g_end) const;
+
+  std::size_t swept_segments() const;
+  void record_memory() const;
+
+  // Diagonal symmetry
+  bool track_swept(std::size_t tt) const {
+    return track_swept_.empty() || track_swept_[tt] != 0;
+  }
+  void build_symmetry();
+  void apply_symmetry(xt::xtensor<double, 3>& flux, std::size_t g_begin,
+                      std::size_t g_end);
+
+  // linear source
+  void fill_linear_source_geometry();
+  void fill_fission_source_moments();
+  void fill_source_gradient(const xt::xtensor<double, 3>& flux_mom,
+                            std::size_t g_begin, std::size_t g_end);
+  void sweep_linear(xt::xtensor<double, 3>& flux,
+                    const xt::xtensor<double, 2>& src, std::size_t g_begin,
+                    std::size_t g_end);
+  void sweep_track_linear(Track& track, std::size_t tt, std::size_t g,
+                          bool forward, const StoredReal* in_flx,
+                          xt::xtensor<double, 3>& tally,
+                          const xt::xtensor<double, 2>& src);
 
   // anisotropic
   void solve_anisotropic();
   void sweep_anisotropic(xt::xtensor<double, 3>& flux,
                          const xt::xtensor<double, 3>& src);
+  void sweep_track_anisotropic(Track& track, std::size_t tt, std::size_t g,
+                               bool forward, const StoredReal* in_flx,
+                               xt::xtensor<double, 3>& flux,
+                               const double* ang_src);
+  void fill_anisotropic_tables();
+  void fill_angular_source(const xt::xtensor<double, 3>& src,
+                           std::size_t g_begin, std::size_t g_end);
   void fill_source_anisotropic(xt::xtensor<double, 3>& src,
                                const xt::xtensor<double, 3>& flux) const;
 
+  // Distributes the sweep of every track and of the groups in
+  // [g_begin, g_end) over the threads, according to sweep_par_. The sweeper is
+  // called with the track, its global index, the group, the direction, the
+  // incoming flux of the track in that direction, and the scalar flux to
+  // tally. With a RegionMajor layout, the tracks are always distributed over
+  // the threads, and the thread-private tallies given to the sweeper are
+  // indexed by FSR, group, and harmonic.
+  template <FluxLayout L = FluxLayout::GroupMajor, typename TrackSweeper>
+  void sweep_tracks(xt::xtensor<double, 3>& flux, const TrackSweeper& sweeper,
+                    std::size_t g_begin, std::size_t g_end);
+  template <FluxLayout L, typename TrackSweeper>
+  void sweep_tracks_parallel(xt::xtensor<double, 3>& flux,
+                             const TrackSweeper& sweeper, std::size_t g_begin,
+                             std::size_t g_end);
+  // True if the groups in [g_begin, g_end) are distributed over the threads
+  bool sweeps_by_group(std::size_t g_begin, std::size_t g_end) const {
+    return sweep_par_ == SweepParallelism::Groups && g_end - g_begin > 1;
+  }
+
+  // Splits the tracks or the groups between the MPI ranks, and sums or
+  // gathers the scalar fluxes and boundary fluxes of the groups in
+  // [g_begin, g_end) swept by all ranks.
+  void partition_tracks();
+  void build_sweep_bundles();
+  void exchange_sweep(xt::xtensor<double, 3>& flux, std::size_t g_begin,
+                      std::size_t g_end);
+  // Gives every rank the boundary fluxes of the groups of the other ranks
+  void gather_track_flux();
+
+  // Solves for the flux and the boundary angular fluxes with GMRES, for the
+  // current fission and external sources. The full sweep computes the source
+  // from its first flux, and sweeps from track_flux_, writing the new flux
+  // into its second argument. The flux is used as the initial guess, and is
+  // returned after one more sweep of the solution, which is tallied for CMFD.
+  template <typename FullSweep>
+  void solve_krylov(xt::xtensor<double, 3>& flux, const FullSweep& full_sweep);
+
   double calc_keff(const xt::xtensor<double, 3>& flux,
                    const xt::xtensor<double, 3>& old_flux) const;
 
@@ -228,6 +870,34 @@ class MOCDriver {
 
   friend class cereal::access;
 
+  // Everything but the tracks and the flux arrays, which save_bin writes in
+  // bulk after the archive
+  template <class Archive>
+  void save_state(Archive& arc) const {
+    arc(CEREAL_NVP(geometry_), CEREAL_NVP(cmfd_), CEREAL_NVP(polar_quad_),
+        CEREAL_NVP(sph_harm_), CEREAL_NVP(ngroups_), CEREAL_NVP(nfsrs_),
+        CEREAL_NVP(n_pol_angles_), CEREAL_NVP(flux_tol_), CEREAL_NVP(keff_tol_),
+        CEREAL_NVP(keff_), CEREAL_NVP(check_fsr_areas_),
+        CEREAL_NVP(fsr_area_tol_), CEREAL_NVP(x_min_bc_), CEREAL_NVP(x_max_bc_),
+        CEREAL_NVP(y_min_bc_), CEREAL_NVP(y_max_bc_), CEREAL_NVP(max_L_),
+        CEREAL_NVP(N_lj_), CEREAL_NVP(anisotropic_), CEREAL_NVP(mode_),
+        CEREAL_NVP(solved_), CEREAL_NVP(fsr_order_));
+  }
+
+  template <class Archive>
+  void load_state(Archive& arc) {
+    arc(CEREAL_NVP(geometry_), CEREAL_NVP(cmfd_), CEREAL_NVP(polar_quad_),
+        CEREAL_NVP(sph_harm_), CEREAL_NVP(ngroups_), CEREAL_NVP(nfsrs_),
+        CEREAL_NVP(n_pol_angles_), CEREAL_NVP(flux_tol_), CEREAL_NVP(keff_tol_),
+        CEREAL_NVP(keff_), CEREAL_NVP(check_fsr_areas_),
+        CEREAL_NVP(fsr_area_tol_), CEREAL_NVP(x_min_bc_), CEREAL_NVP(x_max_bc_),
+        CEREAL_NVP(y_min_bc_), CEREAL_NVP(y_max_bc_), CEREAL_NVP(max_L_),
+        CEREAL_NVP(N_lj_), CEREAL_NVP(anisotropic_), CEREAL_NVP(mode_),
+        CEREAL_NVP(solved_), CEREAL_NVP(fsr_order_));
+  }
+
+  // Single archive of the whole driver, used by files written before the
+  // bulk format of save_bin
   template <class Archive>
   void save(Archive& arc) const {
     arc(CEREAL_NVP(angle_info_), CEREAL_NVP(tracks_), CEREAL_NVP(geometry_),
@@ -238,7 +908,7 @@ class MOCDriver {
         CEREAL_NVP(fsr_area_tol_), CEREAL_NVP(x_min_bc_), CEREAL_NVP(x_max_bc_),
         CEREAL_NVP(y_min_bc_), CEREAL_NVP(y_max_bc_), CEREAL_NVP(max_L_),
         CEREAL_NVP(N_lj_), CEREAL_NVP(anisotropic_), CEREAL_NVP(mode_),
-        CEREAL_NVP(solved_));
+        CEREAL_NVP(solved_), CEREAL_NVP(track_flux_));
   }
 
   template <class Archive>
@@ -251,13 +921,23 @@ class MOCDriver {
         CEREAL_NVP(fsr_area_tol_), CEREAL_NVP(x_min_bc_), CEREAL_NVP(x_max_bc_),
         CEREAL_NVP(y_min_bc_), CEREAL_NVP(y_max_bc_), CEREAL_NVP(max_L_),
         CEREAL_NVP(N_lj_), CEREAL_NVP(anisotropic_), CEREAL_NVP(mode_),
-        CEREAL_NVP(solved_));
+        CEREAL_NVP(solved_), CEREAL_NVP(track_flux_));
     // Need to reset internal pointers
     this->allocate_fsr_data();
-    this->set_bcs();
+    chains_.build(tracks_);
+    seg_store_.pack(tracks_, fsr_xs_indx_, cmfd_.get());
+    partition_tracks();
+    traced_tiles_ = traced_tile_fsrs();
   }
 };
 
+// Solves all of the drivers with all threads, without oversubscribing them.
+// Drivers with at least 1 / max_threads() of the total work are solved one
+// after the other, each with all threads. All others are solved at the same
+// time, each by a single thread, with every thread taking the next driver as
+// soon as it is done, starting with the largest.
+void solve_all(const std::vector<std::shared_ptr<MOCDriver>>& drivers);
+
 }  // namespace scarabee
 
 #endif
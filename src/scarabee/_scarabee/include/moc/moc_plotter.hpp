@@ -2,11 +2,10 @@
 #define MOC_PLOTTER_H
 
 #include <moc/moc_driver.hpp>
+#include <moc/geometry_raster.hpp>
 
 #include <ImApp/imapp.hpp>
 
-#include <mutex>
-
 namespace scarabee {
 
 class MOCPlotter : public ImApp::Layer {
@@ -20,14 +19,10 @@ class MOCPlotter : public ImApp::Layer {
   void render_controls();
 
   ImApp::Pixel get_color(UniqueFSR ufsr);
-  ImApp::Pixel get_random_color();
-
-  Direction get_tracking_direction() const;
-  Vector get_start_position(uint64_t i) const;
-  Direction get_comp_tracking_direction() const;
-  Vector get_comp_start_position(uint64_t j) const;
+  void set_color(UniqueFSR ufsr, const ImApp::Pixel& color);
 
-  void render_image();
+  // Renders the image with pixels of stride by stride screen pixels
+  void render_image(std::uint32_t stride);
 
   enum ColorBy : int {
     Cell = 0,
@@ -36,15 +31,10 @@ class MOCPlotter : public ImApp::Layer {
     MaterialName = 3
   };
 
-  // Maps for colors from plotter.hpp
   const MOCDriver* moc_;
   const Cartesian2D* geom_;
-  std::map<std::size_t, ImApp::Pixel> cell_id_to_color;
-  std::map<UniqueFSR, ImApp::Pixel> unique_cell_to_color;
-  std::map<CrossSection*, ImApp::Pixel> material_id_to_color;
-  std::map<std::string, ImApp::Pixel> material_name_to_color;
+  PlotColors colors;
   ImApp::Image image;
-  std::mutex create_color_mutex;
   int adjust_w_or_h;
   double height, width;  // Width of image in physical space ([cm]).
   double ox, oy;         // Plot origin
@@ -57,6 +47,7 @@ class MOCPlotter : public ImApp::Layer {
   ImApp::Pixel background;
   ColorBy colorby;
   bool must_rerender;
+  bool must_refine;  // Only a coarse image was rendered
   bool outline_boundaries;
 };
 
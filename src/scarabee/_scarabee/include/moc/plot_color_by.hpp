@@ -0,0 +1,21 @@
+#ifndef PLOT_COLOR_BY_H
+#define PLOT_COLOR_BY_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Property which gives the color of the FSRs in images of the geometry.
+// Cell gives all instances of an FSR the same color, and UniqueCell gives
+// each instance its own. Material gives each cross section object its own
+// color, and MaterialName all cross sections with the same name.
+enum class PlotColorBy : std::uint8_t {
+  Cell,
+  UniqueCell,
+  Material,
+  MaterialName
+};
+
+}  // namespace scarabee
+
+#endif
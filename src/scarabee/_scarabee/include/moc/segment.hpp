@@ -38,6 +38,8 @@ class Segment {
 
   std::size_t fsr_indx() const { return fsr_indx_; }
 
+  void set_fsr_indx(std::size_t i) { fsr_indx_ = i; }
+
   CMFDSurfaceCrossing& entry_cmfd_surface() { return entry_cmfd_surface_; }
   const CMFDSurfaceCrossing& entry_cmfd_surface() const {
     return entry_cmfd_surface_;
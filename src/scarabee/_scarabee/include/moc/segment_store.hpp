@@ -0,0 +1,142 @@
+#ifndef SEGMENT_STORE_H
+#define SEGMENT_STORE_H
+
+#include <moc/cmfd.hpp>
+#include <moc/track.hpp>
+#include <moc/storage_precision.hpp>
+#include <utils/memory_usage.hpp>
+#include <utils/threads.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace scarabee {
+
+// Packed, structure-of-arrays copy of the segments of every track, which is
+// what the transport sweep iterates over. Tracks are stored contiguously, in
+// the same order as the angle / track vectors of the MOCDriver. Very few
+// segments touch a CMFD surface, so the crossings are kept in a sparse side
+// table which is sorted by segment index, with the CMFD surfaces to tally
+// already decoded.
+class SegmentStore {
+ public:
+  struct CMFDCrossings {
+    std::size_t segment;  // Global index of the segment in the store
+    CMFDSurfaceTally entry;
+    CMFDSurfaceTally exit;
+  };
+
+  SegmentStore() = default;
+
+  void pack(const std::vector<std::vector<Track>>& tracks,
+            const std::vector<std::uint32_t>& fsr_xs_indices,
+            const CMFD* cmfd);
+
+  // Only keeps the offsets of the tracks, given their number of segments in
+  // track order, for tracks which are traced again during each sweep
+  void pack_offsets(const std::vector<std::vector<Track>>& tracks,
+                    const std::vector<std::size_t>& track_nsegments);
+
+  // Packs the segments of a single track, which is then track 0
+  void pack_track(const std::vector<Segment>& segments,
+                  const std::vector<std::uint32_t>& fsr_xs_indices,
+                  const CMFD* cmfd);
+
+  void clear();
+
+  // Replaces the FSR, cross section, and length arrays by a compressed
+  // encoding. The FSR index of each segment is stored as a 16 bit difference
+  // with the previous segment of its track, with the rare larger differences
+  // kept in a side table, and its length as a 16 bit fraction of the longest
+  // segment of its track. A compressed store can no longer be read by
+  // segment, but each track is decoded with decode_track.
+  void compress();
+  bool compressed() const { return compressed_; }
+
+  // Decodes the segments of track tt into out, as its track 0. The cross
+  // section indices are those of the FSRs.
+  void decode_track(std::size_t tt,
+                    const std::vector<std::uint32_t>& fsr_xs_indices,
+                    SegmentStore& out) const;
+
+  // Replaces the cross section index of every segment by that of its FSR
+  void set_xs_indices(const std::vector<std::uint32_t>& fsr_xs_indices);
+
+  std::size_t ntracks() const {
+    return track_offsets_.empty() ? 0 : track_offsets_.size() - 1;
+  }
+  std::size_t nsegments() const {
+    return track_offsets_.empty() ? 0 : track_offsets_.back();
+  }
+  std::size_t ncrossings() const { return crossings_.size(); }
+
+  std::size_t memory_bytes() const {
+    return array_bytes(angle_offsets_) + array_bytes(track_offsets_) +
+           array_bytes(crossing_offsets_) + array_bytes(fsr_indx_) +
+           array_bytes(xs_indx_) + array_bytes(length_) +
+           array_bytes(crossings_) + array_bytes(fsr_delta_) +
+           array_bytes(length_code_) + array_bytes(track_first_fsr_) +
+           array_bytes(track_length_scale_) + array_bytes(escape_offsets_) +
+           array_bytes(fsr_escapes_);
+  }
+
+  // Global index of track t of azimuthal angle a
+  std::size_t track_index(std::size_t a, std::size_t t) const {
+    return angle_offsets_[a] + t;
+  }
+
+  // Azimuthal angle index of the global track tt
+  std::size_t angle_index(std::size_t tt) const {
+    const auto it =
+        std::upper_bound(angle_offsets_.begin(), angle_offsets_.end(), tt);
+    return static_cast<std::size_t>(it - angle_offsets_.begin()) - 1;
+  }
+
+  std::size_t segments_begin(std::size_t t) const { return track_offsets_[t]; }
+  std::size_t segments_end(std::size_t t) const {
+    return track_offsets_[t + 1];
+  }
+
+  std::size_t crossings_begin(std::size_t t) const {
+    return crossing_offsets_[t];
+  }
+  std::size_t crossings_end(std::size_t t) const {
+    return crossing_offsets_[t + 1];
+  }
+
+  std::uint32_t fsr_indx(std::size_t s) const { return fsr_indx_[s]; }
+  std::uint32_t xs_indx(std::size_t s) const { return xs_indx_[s]; }
+  double length(std::size_t s) const { return length_[s]; }
+
+  const CMFDCrossings& crossing(std::size_t c) const { return crossings_[c]; }
+
+ private:
+  std::vector<std::size_t> angle_offsets_;     // First track of each angle
+  std::vector<std::size_t> track_offsets_;     // First segment of each track
+  std::vector<std::size_t> crossing_offsets_;  // First crossing of each track
+  // Filled in parallel over the tracks, so that on NUMA systems the pages
+  // are spread over the nodes of the threads which sweep them
+  FirstTouchVector<std::uint32_t> fsr_indx_;
+  FirstTouchVector<std::uint32_t> xs_indx_;
+  FirstTouchVector<StoredReal> length_;
+  std::vector<CMFDCrossings> crossings_;
+
+  // Compressed encoding. A difference of ESCAPE_DELTA means that the next
+  // entry of the escape table of the track holds the difference.
+  static constexpr std::int16_t ESCAPE_DELTA =
+      std::numeric_limits<std::int16_t>::min();
+  static constexpr double MAX_LENGTH_CODE = 65535.;
+  bool compressed_{false};
+  FirstTouchVector<std::int16_t> fsr_delta_;
+  FirstTouchVector<std::uint16_t> length_code_;
+  std::vector<std::uint32_t> track_first_fsr_;
+  std::vector<double> track_length_scale_;  // Length of a length code step
+  std::vector<std::size_t> escape_offsets_;   // First escape of each track
+  std::vector<std::int32_t> fsr_escapes_;
+};
+
+}  // namespace scarabee
+
+#endif
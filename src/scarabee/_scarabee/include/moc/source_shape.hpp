@@ -0,0 +1,17 @@
+#ifndef SOURCE_SHAPE_H
+#define SOURCE_SHAPE_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Spatial shape of the source within each flat source region. Flat uses a
+// constant source. Linear adds the gradient of the source about the centroid
+// of the region, which is obtained from the spatial moments of the flux, so
+// that a much coarser mesh of regions reaches the same accuracy. The linear
+// source is only available for isotropic problems.
+enum class SourceShape : std::uint8_t { Flat, Linear };
+
+}  // namespace scarabee
+
+#endif
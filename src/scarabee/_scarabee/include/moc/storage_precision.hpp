@@ -0,0 +1,19 @@
+#ifndef STORAGE_PRECISION_H
+#define STORAGE_PRECISION_H
+
+namespace scarabee {
+
+// Floating point type used to store the boundary angular fluxes and the
+// packed segment lengths of the MOC sweep. Building with
+// SCARABEE_MIXED_PRECISION stores them in single precision, which halves the
+// memory and the memory traffic of the sweep. The attenuation, the scalar
+// flux tallies, and keff are always computed in double precision.
+#ifdef SCARABEE_MIXED_PRECISION
+using StoredReal = float;
+#else
+using StoredReal = double;
+#endif
+
+}  // namespace scarabee
+
+#endif
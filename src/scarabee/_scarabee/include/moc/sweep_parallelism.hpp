@@ -0,0 +1,19 @@
+#ifndef SWEEP_PARALLELISM_H
+#define SWEEP_PARALLELISM_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Dimension over which the transport sweep is distributed between threads.
+// Groups sweeps each group independently, and is best for many-group
+// problems. Tracks sweeps all groups of a track on one thread, accumulating
+// the scalar flux in thread-private buffers, and is best for few-group
+// problems or for nodes with more cores than groups. Chains is like Tracks,
+// but sweeps each chain of connected tracks from end to end, so that the
+// incoming flux of a track is the one computed in the same sweep.
+enum class SweepParallelism : std::uint8_t { Groups, Tracks, Chains };
+
+}  // namespace scarabee
+
+#endif
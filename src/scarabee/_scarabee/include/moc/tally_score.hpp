@@ -0,0 +1,15 @@
+#ifndef TALLY_SCORE_H
+#define TALLY_SCORE_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Reaction rate scored by a tally of the MOCDriver. Flux is the volume
+// integrated scalar flux, and the other scores are the volume integrated
+// flux times the absorption, fission, or nu-fission cross section.
+enum class TallyScore : std::uint8_t { Flux, Absorption, Fission, NuFission };
+
+}  // namespace scarabee
+
+#endif
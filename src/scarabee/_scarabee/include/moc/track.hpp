@@ -8,8 +8,6 @@
 #include <utils/constants.hpp>
 #include <utils/serialization.hpp>
 
-#include <xtensor/containers/xtensor.hpp>
-
 #include <cereal/cereal.hpp>
 #include <cereal/types/vector.hpp>
 
@@ -31,6 +29,11 @@ class Track {
   double width() const { return width_; }
   double phi() const { return phi_; }
   const std::vector<Segment>& segments() const { return segments_; }
+  // Releases the segments, once they are packed for the sweep
+  void clear_segments() { segments_ = std::vector<Segment>(); }
+  void set_segments(const std::vector<Segment>& segments) {
+    segments_ = segments;
+  }
   std::size_t phi_index_forward() const { return forward_phi_index_; }
   std::size_t phi_index_backward() const { return backward_phi_index_; }
 
@@ -39,7 +42,10 @@ class Track {
   const Direction& dir() const { return dir_; }
 
   std::size_t& entry_cmfd_cell() { return cmfd_entry_cell_; }
+  std::size_t entry_cmfd_cell() const { return cmfd_entry_cell_; }
+
   std::size_t& exit_cmfd_cell() { return cmfd_exit_cell_; }
+  std::size_t exit_cmfd_cell() const { return cmfd_exit_cell_; }
 
   BoundaryCondition& entry_bc() { return entry_bc_; }
   const BoundaryCondition& entry_bc() const { return entry_bc_; }
@@ -47,21 +53,24 @@ class Track {
   BoundaryCondition& exit_bc() { return exit_bc_; }
   const BoundaryCondition& exit_bc() const { return exit_bc_; }
 
-  xt::xtensor<double, 2>& entry_flux() { return entry_flux_; }
-  const xt::xtensor<double, 2>& entry_flux() const { return entry_flux_; }
+  // The incoming angular fluxes of all tracks are stored in one pool held by
+  // the MOCDriver, which is indexed on [row][group][polar angle]. Each track
+  // owns the two rows of its flux slot : the first is the flux entering the
+  // track in the forward direction, and the second is the flux entering the
+  // track in the backward direction (at the exit position).
+  std::size_t flux_slot() const { return flux_slot_; }
+  void set_flux_slot(std::size_t slot) { flux_slot_ = slot; }
 
-  xt::xtensor<double, 2>& exit_flux() { return exit_flux_; }
-  const xt::xtensor<double, 2>& exit_flux() const { return exit_flux_; }
+  std::size_t entry_flux() const { return 2 * flux_slot_; }
+  std::size_t exit_flux() const { return 2 * flux_slot_ + 1; }
 
-  xt::xtensor<double, 2>& entry_track_flux() { return *entry_track_flux_; }
-  void set_entry_track_flux(xt::xtensor<double, 2>* etf) {
-    entry_track_flux_ = etf;
-  }
+  // Rows of the pool which receive the outgoing angular flux of the track, in
+  // the backward (entry_track_flux) and forward (exit_track_flux) directions.
+  std::size_t entry_track_flux() const { return entry_track_flux_; }
+  void set_entry_track_flux(std::size_t etf) { entry_track_flux_ = etf; }
 
-  xt::xtensor<double, 2>& exit_track_flux() { return *exit_track_flux_; }
-  void set_exit_track_flux(xt::xtensor<double, 2>* etf) {
-    exit_track_flux_ = etf;
-  }
+  std::size_t exit_track_flux() const { return exit_track_flux_; }
+  void set_exit_track_flux(std::size_t etf) { exit_track_flux_ = etf; }
 
   // Indexing is only done in forward direction
   std::size_t size() const { return segments_.size(); }
@@ -96,14 +105,13 @@ class Track {
   const_reverse_iterator crend() const { return segments_.crend(); }
 
  private:
-  xt::xtensor<double, 2> entry_flux_;  // Indexed on group and polar angle
-  xt::xtensor<double, 2> exit_flux_;
   std::vector<Segment> segments_;
   Vector entry_;
   Vector exit_;
   Direction dir_;
-  xt::xtensor<double, 2>* entry_track_flux_;
-  xt::xtensor<double, 2>* exit_track_flux_;
+  std::size_t flux_slot_;
+  std::size_t entry_track_flux_;
+  std::size_t exit_track_flux_;
   double wgt_;    // Track weight
   double width_;  // Track width
   double phi_;    // Azimuthal angle of Track
@@ -119,8 +127,9 @@ class Track {
   friend class cereal::access;
   template <class Archive>
   void serialize(Archive& arc) {
-    arc(CEREAL_NVP(entry_flux_), CEREAL_NVP(exit_flux_), CEREAL_NVP(segments_),
-        CEREAL_NVP(entry_), CEREAL_NVP(exit_), CEREAL_NVP(dir_),
+    arc(CEREAL_NVP(segments_), CEREAL_NVP(entry_), CEREAL_NVP(exit_),
+        CEREAL_NVP(dir_), CEREAL_NVP(flux_slot_), CEREAL_NVP(entry_track_flux_),
+        CEREAL_NVP(exit_track_flux_),
         CEREAL_NVP(wgt_), CEREAL_NVP(width_), CEREAL_NVP(phi_),
         CEREAL_NVP(entry_bc_), CEREAL_NVP(exit_bc_),
         CEREAL_NVP(forward_phi_index_), CEREAL_NVP(backward_phi_index_),
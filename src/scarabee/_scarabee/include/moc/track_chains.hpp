@@ -0,0 +1,59 @@
+#ifndef TRACK_CHAINS_H
+#define TRACK_CHAINS_H
+
+#include <moc/track.hpp>
+#include <utils/memory_usage.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace scarabee {
+
+// Sequences of track sweeps which hand their outgoing angular flux to one
+// another. A link of a chain is one track swept in one direction, and is
+// identified by the row of the boundary flux pool holding its incoming flux.
+// The outgoing flux of each link is the incoming flux of the next one.
+// With reflective and periodic boundaries, the links form closed cycles.
+// Chains which are open start at a vacuum boundary, and end at one.
+class TrackChains {
+ public:
+  TrackChains() = default;
+
+  // Builds the chains from the connections of the tracks, which must already
+  // have their flux slots assigned.
+  void build(const std::vector<std::vector<Track>>& tracks);
+  void clear();
+
+  std::size_t nchains() const {
+    return chain_offsets_.empty() ? 0 : chain_offsets_.size() - 1;
+  }
+  std::size_t nlinks() const { return rows_.size(); }
+
+  std::size_t memory_bytes() const {
+    return array_bytes(chain_offsets_) + array_bytes(rows_) +
+           array_bytes(slot_tracks_) + array_bytes(open_);
+  }
+
+  std::size_t links_begin(std::size_t c) const { return chain_offsets_[c]; }
+  std::size_t links_end(std::size_t c) const { return chain_offsets_[c + 1]; }
+
+  // True if the first link of the chain enters through a vacuum boundary
+  bool open(std::size_t c) const { return open_[c] != 0; }
+
+  // Row of the boundary flux pool with the incoming flux of link k
+  std::size_t row(std::size_t k) const { return rows_[k]; }
+  // Global index of the track of link k
+  std::size_t track(std::size_t k) const { return slot_tracks_[rows_[k] / 2]; }
+  // True if the track of link k is swept in the forward direction
+  bool forward(std::size_t k) const { return rows_[k] % 2 == 0; }
+
+ private:
+  std::vector<std::size_t> chain_offsets_;  // First link of each chain
+  std::vector<std::size_t> rows_;           // Incoming flux row of each link
+  std::vector<std::size_t> slot_tracks_;    // Global track index of each slot
+  std::vector<char> open_;
+};
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef TRANSPORT_SOLVER_H
+#define TRANSPORT_SOLVER_H
+
+#include <cstdint>
+
+namespace scarabee {
+
+// Method used to converge the scattering source and the boundary angular
+// fluxes for a given fission source. SourceIteration performs one transport
+// sweep per outer iteration. GMRES solves for the flux and the boundary
+// angular fluxes with a restarted, matrix-free GMRES in each outer iteration,
+// where every application of the operator is one transport sweep. This is
+// much faster for highly scattering problems, such as water reflectors.
+enum class TransportSolver : std::uint8_t { SourceIteration, GMRES };
+
+}  // namespace scarabee
+
+#endif
@@ -1,88 +1,143 @@
-#ifndef REFLECTOR_SN_H
-#define REFLECTOR_SN_H
-
-#include <data/cross_section.hpp>
-
-#include <xtensor/containers/xtensor.hpp>
-
-#include <span>
-#include <memory>
-
-namespace scarabee {
-
-class ReflectorSN {
- public:
-  ReflectorSN(const std::vector<std::shared_ptr<CrossSection>>& xs,
-              const xt::xtensor<double, 1>& dx, std::uint32_t nangles,
-              bool anisotropic);
-
-  std::size_t nangles() const { return mu_.size(); }
-
-  void solve();
-  bool solved() const { return solved_; }
-
-  double keff() const { return keff_; }
-
-  double keff_tolerance() const { return keff_tol_; }
-  void set_keff_tolerance(double ktol);
-
-  double flux_tolerance() const { return flux_tol_; }
-  void set_flux_tolerance(double ftol);
-
-  std::size_t size() const { return xs_.size(); }
-  std::size_t nregions() const { return xs_.size(); }
-  std::size_t nsurfaces() const { return xs_.size() + 1; }
-  std::size_t ngroups() const { return ngroups_; }
-  std::size_t max_legendre_order() const { return max_L_; }
-  bool anisotropic() const { return anisotropic_; }
-
-  const std::shared_ptr<CrossSection> xs(std::size_t i) const;
-  double volume(std::size_t i) const;
-
-  double flux(std::size_t i, std::size_t g, std::size_t l = 0) const;
-  double current(std::size_t i, std::size_t g) const;
-
-  std::shared_ptr<CrossSection> homogenize(
-      const std::vector<std::size_t>& regions) const;
-  xt::xtensor<double, 1> homogenize_flux_spectrum(
-      const std::vector<std::size_t>& regions) const;
-
- private:
-  std::vector<std::shared_ptr<CrossSection>> xs_;
-  xt::xtensor<double, 1> dx_;
-  xt::xtensor<double, 3> flux_;  // group, spatial bin, legendre moment
-  xt::xtensor<double, 2> J_;     // group, surface
-  xt::xtensor<double, 2> Pnl_;   // direction index, legendre moment
-  double keff_{1.};
-  double keff_tol_{1.E-5};
-  double flux_tol_{1.E-5};
-  std::size_t ngroups_;
-  std::size_t max_L_ = 0;  // max-legendre-order in scattering moments
-  bool solved_{false};
-  bool anisotropic_{false};
-
-  void solve_iso();
-  void sweep_iso(xt::xtensor<double, 3>& flux,
-                 xt::xtensor<double, 2>& incident_angular_flux,
-                 const xt::xtensor<double, 3>& Q);
-  void fill_source_iso(xt::xtensor<double, 3>& Q,
-                       const xt::xtensor<double, 3>& flux) const;
-
-  void solve_aniso();
-  void sweep_aniso(xt::xtensor<double, 3>& flux,
-                   xt::xtensor<double, 2>& incident_angular_flux,
-                   const xt::xtensor<double, 3>& Q);
-  void fill_source_aniso(xt::xtensor<double, 3>& Q,
-                         const xt::xtensor<double, 3>& flux) const;
-
-  double calc_keff(const xt::xtensor<double, 3>& old_flux,
-                   const xt::xtensor<double, 3>& new_flux,
-                   const double keff) const;
-
-  std::span<const double> mu_;
-  std::span<const double> wgt_;
-};
-
-}  // namespace scarabee
-
-#endif
+#ifndef REFLECTOR_SN_H
+#define REFLECTOR_SN_H
+
+#include <data/cross_section.hpp>
+#include <utils/threads.hpp>
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include <span>
+#include <vector>
+#include <memory>
+
+namespace scarabee {
+
+class ReflectorSN {
+ public:
+  ReflectorSN(const std::vector<std::shared_ptr<CrossSection>>& xs,
+              const xt::xtensor<double, 1>& dx, std::uint32_t nangles,
+              bool anisotropic);
+
+  std::size_t nangles() const { return mu_.size(); }
+
+  void solve();
+  bool solved() const { return solved_; }
+
+  // Number of threads of the parallel regions of the solver. When 0, the
+  // solver uses one thread per pinned core, or the process wide default.
+  std::size_t num_threads() const { return threads_.num_threads; }
+  void set_num_threads(std::size_t n) { threads_.num_threads = n; }
+
+  // Cores to which the threads of the solver are pinned, none if empty
+  const std::vector<std::size_t>& cores() const { return threads_.cores; }
+  void set_cores(const std::vector<std::size_t>& cores) {
+    threads_.set_cores(cores);
+  }
+
+  double keff() const { return keff_; }
+
+  double keff_tolerance() const { return keff_tol_; }
+  void set_keff_tolerance(double ktol);
+
+  double flux_tolerance() const { return flux_tol_; }
+  void set_flux_tolerance(double ftol);
+
+  // If true, each sweep is followed by a diffusion synthetic acceleration
+  // of the scalar flux
+  bool dsa() const { return dsa_; }
+  void set_dsa(bool dsa) { dsa_ = dsa; }
+
+  // Starts the next solve from the flux and keff of another ReflectorSN with
+  // the same mesh, instead of a flat flux
+  void warm_start(const ReflectorSN& other);
+
+  // Solves the same mesh for several sets of cross sections, such as the
+  // branches of a reflector. After the first set, the branches are solved
+  // concurrently, each warm started from the closest branch already solved.
+  static std::vector<ReflectorSN> solve_branches(
+      const std::vector<std::vector<std::shared_ptr<CrossSection>>>& xs,
+      const xt::xtensor<double, 1>& dx, std::uint32_t nangles,
+      bool anisotropic, bool dsa = false);
+
+  std::size_t size() const { return xs_.size(); }
+  std::size_t nregions() const { return xs_.size(); }
+  std::size_t nsurfaces() const { return xs_.size() + 1; }
+  std::size_t ngroups() const { return ngroups_; }
+  std::size_t max_legendre_order() const { return max_L_; }
+  bool anisotropic() const { return anisotropic_; }
+
+  const std::shared_ptr<CrossSection> xs(std::size_t i) const;
+  double volume(std::size_t i) const;
+
+  double flux(std::size_t i, std::size_t g, std::size_t l = 0) const;
+  double current(std::size_t i, std::size_t g) const;
+
+  std::shared_ptr<CrossSection> homogenize(
+      const std::vector<std::size_t>& regions) const;
+  xt::xtensor<double, 1> homogenize_flux_spectrum(
+      const std::vector<std::size_t>& regions) const;
+
+ private:
+  std::vector<std::shared_ptr<CrossSection>> xs_;
+  xt::xtensor<double, 1> dx_;
+  xt::xtensor<double, 3> flux_;  // group, spatial bin, legendre moment
+  xt::xtensor<double, 2> J_;     // group, surface
+  xt::xtensor<double, 2> Pnl_;   // direction index, legendre moment
+  double keff_{1.};
+  double keff_tol_{1.E-5};
+  double flux_tol_{1.E-5};
+  std::size_t ngroups_;
+  std::size_t max_L_ = 0;  // max-legendre-order in scattering moments
+  bool solved_{false};
+  bool anisotropic_{false};
+  bool dsa_{false};
+  bool warm_start_{false};
+  ThreadSettings threads_;
+
+  // Factorized multigroup diffusion operator of the DSA, and the P0
+  // scattering matrix (g, g') of each cell. The factorization is held by a
+  // pointer since Eigen solvers cannot be copied.
+  std::shared_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> dsa_lu_;
+  std::vector<Eigen::MatrixXd> dsa_Es_;
+
+  void solve_iso();
+  void fill_source_iso(xt::xtensor<double, 3>& Q,
+                       const xt::xtensor<double, 3>& flux) const;
+
+  void solve_aniso();
+  void fill_source_aniso(xt::xtensor<double, 3>& Q,
+                         const xt::xtensor<double, 3>& flux) const;
+
+  void build_dsa(bool aniso);
+  void apply_dsa(xt::xtensor<double, 3>& next_flux,
+                 const xt::xtensor<double, 3>& flux) const;
+
+  double calc_keff(const xt::xtensor<double, 3>& old_flux,
+                   const xt::xtensor<double, 3>& new_flux,
+                   const double keff) const;
+
+  std::span<const double> mu_;
+  std::span<const double> wgt_;
+
+  // The sweep advances all ordinates of one direction together, in xsimd
+  // batches. Lane p holds |mu_p| and w_p of ordinates p and N - 1 - p, and
+  // Pnl_simd_ the Legendre functions of each direction and moment.
+  std::vector<double> abs_mu_simd_;
+  std::vector<double> wgt_simd_;
+  std::vector<double> Pnl_simd_;
+
+  void fill_simd_quadrature();
+  void fill_simd_legendre();
+
+  // Diamond difference sweep of all groups, with the source of each
+  // Legendre moment when ANISO is true
+  template <bool ANISO>
+  void sweep(xt::xtensor<double, 3>& flux, const xt::xtensor<double, 3>& Q);
+};
+
+}  // namespace scarabee
+
+#endif
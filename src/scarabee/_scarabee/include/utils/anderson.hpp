@@ -0,0 +1,34 @@
+#ifndef SCARABEE_ANDERSON_H
+#define SCARABEE_ANDERSON_H
+
+#include <cstddef>
+#include <vector>
+
+namespace scarabee {
+
+// Anderson mixing for a fixed point iteration x = G(x). Each call to mix
+// receives the current iterate x and G(x), and replaces x with the next
+// iterate, which combines the last depth residuals G(x) - x so as to minimize
+// their norm. With a depth of 0, this is a damped fixed point iteration.
+class AndersonMixer {
+ public:
+  AndersonMixer(std::size_t depth = 0, double damping = 1.);
+
+  std::size_t depth() const { return depth_; }
+  double damping() const { return damping_; }
+
+  void mix(std::vector<double>& x, const std::vector<double>& gx);
+  void reset();
+
+ private:
+  std::size_t depth_;
+  double damping_;
+  std::vector<double> x_prev_;
+  std::vector<double> f_prev_;
+  std::vector<std::vector<double>> dX_;  // Differences of the iterates
+  std::vector<std::vector<double>> dF_;  // Differences of the residuals
+};
+
+}  // namespace scarabee
+
+#endif
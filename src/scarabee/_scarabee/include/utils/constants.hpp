@@ -5,7 +5,9 @@
 #include <cmath>
 #include <limits>
 #include <map>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scarabee {
@@ -25,13 +27,20 @@ constexpr double CM2_PER_BARN{1.E-24};
 constexpr std::size_t MAX_SURFS{5};
 #define NDL_ENV_VAR "SCARABEE_ND_LIBRARY"
 
-extern const std::map<std::string, double> NATURAL_ABUNDANCES;
-extern const std::map<std::string, std::vector<std::string>> ELEMENT_ISOTOPES;
-extern const std::map<std::string, double> ISOTOPE_MASSES;
+// Natural abundance of a nuclide, such as "U235". Throws if the nuclide
+// does not occur naturally.
+double natural_abundance(std::string_view nuclide);
+
+// Atomic mass of a nuclide in amu. Throws if the mass is not tabulated.
+double isotope_mass(std::string_view nuclide);
+
+// Natural isotopes of the element with the given symbol, which are empty
+// if the element is not tabulated
+std::span<const std::string_view> element_isotopes(std::string_view symbol);
 
 struct ElementInfo {
-  std::string name;
-  std::string symbol;
+  std::string_view name;
+  std::string_view symbol;
 };
 
 extern const std::array<ElementInfo, 119> ELEMENTS;
@@ -9,6 +9,9 @@
 #include <cereal/cereal.hpp>
 #include <cereal/types/base_class.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace scarabee {
 
 class CriticalitySpectrum {
@@ -36,6 +39,26 @@ class CriticalitySpectrum {
 
   CriticalitySpectrum() : k_inf_(), B2_(), flux_(), current_(), diff_coeff_() {}
 
+  // Matrices and vectors reused by successive solves of the same number of
+  // groups, defined in criticality_spectrum.cpp
+  struct Workspace;
+
+  // Finds the critical buckling with a secant iteration on B2. The second
+  // point of the iteration is B2_guess when it is not zero.
+  void solve_critical(std::shared_ptr<CrossSection> xs, Workspace& ws, bool b1,
+                      double B2_guess);
+
+  // Computes the spectrum for a fixed buckling B
+  void solve_buckling(std::shared_ptr<CrossSection> xs, Workspace& ws, bool b1,
+                      double B);
+
+  // Solves the critical spectrum of every cross section. The list is split
+  // into one contiguous chunk per thread, and each solve warm starts from the
+  // buckling of the previous cross section in its chunk.
+  template <typename T>
+  static std::vector<T> solve_batch(
+      const std::vector<std::shared_ptr<CrossSection>>& xs);
+
   friend class cereal::access;
   template <class Archive>
   void serialize(Archive& arc) {
@@ -48,9 +71,16 @@ class P1CriticalitySpectrum : public CriticalitySpectrum {
  public:
   P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs);
   P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs, double B);
+  // Finds the critical buckling, starting from that of a similar spectrum
+  P1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
+                        const CriticalitySpectrum& guess);
+
+  static std::vector<P1CriticalitySpectrum> solve_batch(
+      const std::vector<std::shared_ptr<CrossSection>>& xs);
 
  private:
   friend class cereal::access;
+  friend class CriticalitySpectrum;
   P1CriticalitySpectrum() {}
   template <class Archive>
   void serialize(Archive& arc) {
@@ -62,9 +92,16 @@ class B1CriticalitySpectrum : public CriticalitySpectrum {
  public:
   B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs);
   B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs, double B);
+  // Finds the critical buckling, starting from that of a similar spectrum
+  B1CriticalitySpectrum(std::shared_ptr<CrossSection> xs,
+                        const CriticalitySpectrum& guess);
+
+  static std::vector<B1CriticalitySpectrum> solve_batch(
+      const std::vector<std::shared_ptr<CrossSection>>& xs);
 
  private:
   friend class cereal::access;
+  friend class CriticalitySpectrum;
   B1CriticalitySpectrum() {}
   template <class Archive>
   void serialize(Archive& arc) {
@@ -0,0 +1,36 @@
+#ifndef SCARABEE_EXP_TABLE_H
+#define SCARABEE_EXP_TABLE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace scarabee {
+
+// Linearly interpolated table of 1 - exp(-x), in the manner of OpenMOC. The
+// table spacing is chosen so that the interpolation error never exceeds the
+// requested maximum error. Beyond the end of the table, 1 is returned, which
+// is also within the maximum error.
+class ExpTable {
+ public:
+  ExpTable(double max_error = 1.E-6);
+
+  double max_error() const { return max_error_; }
+  double x_max() const { return x_max_; }
+  std::size_t size() const { return coeffs_.size() / 2; }
+
+  double operator()(double x) const {
+    if (x >= x_max_) return 1.;
+    const std::size_t i = 2 * static_cast<std::size_t>(x * invs_dx_);
+    return coeffs_[i] * x + coeffs_[i + 1];
+  }
+
+ private:
+  double max_error_;
+  double x_max_;
+  double invs_dx_;
+  std::vector<double> coeffs_;  // Slope and intercept for each interval
+};
+
+}  // namespace scarabee
+
+#endif
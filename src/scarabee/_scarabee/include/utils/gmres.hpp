@@ -0,0 +1,130 @@
+#ifndef SCARABEE_GMRES_H
+#define SCARABEE_GMRES_H
+
+#include <utils/threads.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace scarabee {
+
+struct GMRESResult {
+  std::size_t iterations;  // Number of Arnoldi iterations
+  double residual;         // Final residual norm, relative to the norm of b
+  bool converged;
+};
+
+namespace detail {
+
+inline double gmres_dot(const std::vector<double>& a,
+                        const std::vector<double>& b) {
+  return parallel_sum<1>(a.size(), [&](std::size_t i, auto& sum) {
+    sum[0] += a[i] * b[i];
+  })[0];
+}
+
+// y += alpha * x
+inline void gmres_axpy(double alpha, const std::vector<double>& x,
+                       std::vector<double>& y) {
+#pragma omp parallel for
+  for (long long i = 0; i < static_cast<long long>(x.size()); i++) {
+    y[static_cast<std::size_t>(i)] += alpha * x[static_cast<std::size_t>(i)];
+  }
+}
+
+}  // namespace detail
+
+// Solves A x = b with restarted GMRES, without storing A. The operator is
+// called as A(v, Av), and must write the product of A and v into Av, which
+// has the size of v. The initial value of x is used as the first guess.
+// Iterations stop once the residual norm is below tol times the norm of b, or
+// after max_iters applications of the operator.
+template <typename Operator>
+GMRESResult gmres(const Operator& A, const std::vector<double>& b,
+                  std::vector<double>& x, std::size_t restart, double tol,
+                  std::size_t max_iters) {
+  using detail::gmres_axpy;
+  using detail::gmres_dot;
+
+  const std::size_t n = b.size();
+  const double b_norm = std::sqrt(gmres_dot(b, b));
+  if (b_norm == 0.) {
+    x.assign(n, 0.);
+    return {0, 0., true};
+  }
+
+  // Residual of the current guess
+  std::vector<double> r(n);
+  auto residual = [&]() {
+    A(x, r);
+    for (std::size_t i = 0; i < n; i++) r[i] = b[i] - r[i];
+    return std::sqrt(gmres_dot(r, r));
+  };
+
+  std::vector<std::vector<double>> V(restart + 1, std::vector<double>(n));
+  std::vector<std::vector<double>> H(restart + 1,
+                                     std::vector<double>(restart, 0.));
+  std::vector<double> cs(restart), sn(restart), g(restart + 1), y(restart);
+  std::vector<double> w(n);
+
+  std::size_t iters = 0;
+  double beta = residual();
+  while (beta > tol * b_norm && iters < max_iters) {
+    for (std::size_t i = 0; i < n; i++) V[0][i] = r[i] / beta;
+    std::fill(g.begin(), g.end(), 0.);
+    g[0] = beta;
+
+    // Arnoldi process, with modified Gram-Schmidt
+    std::size_t k = 0;
+    while (k < restart && iters < max_iters) {
+      A(V[k], w);
+      iters++;
+
+      for (std::size_t i = 0; i <= k; i++) {
+        H[i][k] = gmres_dot(w, V[i]);
+        gmres_axpy(-H[i][k], V[i], w);
+      }
+      H[k + 1][k] = std::sqrt(gmres_dot(w, w));
+      if (H[k + 1][k] > 0.) {
+        for (std::size_t i = 0; i < n; i++) V[k + 1][i] = w[i] / H[k + 1][k];
+      }
+
+      // Apply the previous Givens rotations to the new column, and find the
+      // one which eliminates its subdiagonal entry.
+      for (std::size_t i = 0; i < k; i++) {
+        const double h = cs[i] * H[i][k] + sn[i] * H[i + 1][k];
+        H[i + 1][k] = -sn[i] * H[i][k] + cs[i] * H[i + 1][k];
+        H[i][k] = h;
+      }
+      const double d = std::hypot(H[k][k], H[k + 1][k]);
+      cs[k] = H[k][k] / d;
+      sn[k] = H[k + 1][k] / d;
+      H[k][k] = d;
+      H[k + 1][k] = 0.;
+      g[k + 1] = -sn[k] * g[k];
+      g[k] *= cs[k];
+      k++;
+
+      // Lucky breakdown, or converged
+      if (std::abs(g[k]) <= tol * b_norm) break;
+    }
+
+    // Update the solution with the least squares minimizer
+    for (std::size_t i = k; i-- > 0;) {
+      y[i] = g[i];
+      for (std::size_t j = i + 1; j < k; j++) y[i] -= H[i][j] * y[j];
+      y[i] /= H[i][i];
+    }
+    for (std::size_t i = 0; i < k; i++) gmres_axpy(y[i], V[i], x);
+
+    beta = residual();
+  }
+
+  return {iters, beta / b_norm, beta <= tol * b_norm};
+}
+
+}  // namespace scarabee
+
+#endif
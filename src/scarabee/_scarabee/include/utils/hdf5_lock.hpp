@@ -0,0 +1,17 @@
+#ifndef SCARABEE_HDF5_LOCK_H
+#define SCARABEE_HDF5_LOCK_H
+
+#include <mutex>
+
+namespace scarabee {
+
+// HDF5 is not thread safe, even across different files, so all accesses
+// to any file go through this lock
+inline std::mutex& hdf5_mutex() {
+  static std::mutex m;
+  return m;
+}
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef SCARABEE_KI3_TABLE_H
+#define SCARABEE_KI3_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace scarabee {
+
+// Method used to evaluate the Bickley function Ki3 in the collision
+// probability calculations. Series evaluates the Chebyshev series of Ki3,
+// and Table uses a linearly interpolated Ki3Table.
+enum class Ki3Mode : std::uint8_t { Series, Table };
+
+// Linearly interpolated table of the Bickley function Ki3(x). The table
+// spacing is chosen so that the interpolation error never exceeds the
+// requested maximum error. Beyond the end of the table, 0 is returned, which
+// is also within the maximum error.
+class Ki3Table {
+ public:
+  Ki3Table(double max_error = 1.E-7);
+
+  double max_error() const { return max_error_; }
+  double x_max() const { return x_max_; }
+  std::size_t size() const { return slope_.size(); }
+
+  double operator()(double x) const {
+    if (x >= x_max_) return 0.;
+    const std::size_t i = static_cast<std::size_t>(x * invs_dx_);
+    return slope_[i] * x + intercept_[i];
+  }
+
+  // Evaluates Ki3 at the n points of x, writing the values to out, with
+  // the widest SIMD instruction set supported by the CPU
+  void evaluate(const double* x, double* out, std::size_t n) const;
+
+ private:
+  double max_error_;
+  double x_max_;
+  double invs_dx_;
+  std::vector<double> slope_;
+  std::vector<double> intercept_;
+};
+
+}  // namespace scarabee
+
+#endif
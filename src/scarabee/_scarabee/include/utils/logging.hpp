@@ -4,13 +4,28 @@
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/base_sink.h>
 #include <spdlog/details/null_mutex.h>
+#include <spdlog/pattern_formatter.h>
 
+// The Python module prints the log messages through Python, so that they
+// appear in notebooks. The standalone C++ library prints them to stdout.
+#ifdef SCARABEE_PYTHON
 #include <pybind11/pybind11.h>
 namespace py = pybind11;
+#else
+#include <spdlog/sinks/stdout_sinks.h>
+#endif
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace scarabee {
 
@@ -20,6 +35,13 @@ void set_logging_level(LogLevel level);
 
 void set_output_file(const std::string& fname);
 
+// Switches the console output between the synchronous ConsoleSinkMT and the
+// AsyncPythonSink. Should not be called while a solver is logging.
+void set_async_logging(bool enabled);
+
+bool async_logging();
+
+#ifdef SCARABEE_PYTHON
 template <typename Mutex>
 class PythonSink : public spdlog::sinks::base_sink<Mutex> {
  public:
@@ -50,6 +72,70 @@ using PythonSinkMT = PythonSink<std::mutex>;
 // Single-Threaded Sink
 using PythonSinkST = PythonSink<spdlog::details::null_mutex>;
 
+// Sink of the console output
+using ConsoleSinkMT = PythonSinkMT;
+#else
+using ConsoleSinkMT = spdlog::sinks::stdout_sink_mt;
+#endif
+
+// Sink which never touches the GIL in the logging thread. Messages are
+// pushed into a bounded lock-free ring buffer, and a background thread
+// formats them and prints them to Python, or to stdout in the standalone
+// library, in batches. When the buffer is more
+// than three quarters full, debug and trace messages are dropped; more
+// important messages wait for space.
+class AsyncPythonSink : public spdlog::sinks::sink {
+ public:
+  AsyncPythonSink(std::size_t capacity = 8192,
+                  std::chrono::milliseconds interval =
+                      std::chrono::milliseconds(50));
+  ~AsyncPythonSink() override;
+
+  AsyncPythonSink(const AsyncPythonSink&) = delete;
+  AsyncPythonSink& operator=(const AsyncPythonSink&) = delete;
+
+  void log(const spdlog::details::log_msg& msg) override;
+  void flush() override;
+  void set_pattern(const std::string& pattern) override;
+  void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+  std::size_t dropped() const { return total_dropped_.load(); }
+
+ private:
+  struct Entry {
+    std::atomic<std::uint64_t> seq;
+    spdlog::log_clock::time_point time;
+    spdlog::level::level_enum level;
+    std::size_t thread_id;
+    std::string payload;
+  };
+
+  std::vector<Entry> ring_;
+  std::uint64_t mask_;
+  std::chrono::milliseconds interval_;
+  alignas(64) std::atomic<std::uint64_t> enqueue_pos_;
+  alignas(64) std::atomic<std::uint64_t> dequeue_pos_;
+  std::atomic<std::uint64_t> written_;
+  std::atomic<std::size_t> dropped_;
+  std::atomic<std::size_t> total_dropped_;
+
+  std::mutex formatter_mtx_;
+  std::unique_ptr<spdlog::formatter> formatter_;
+
+  std::mutex wake_mtx_;
+  std::condition_variable wake_cv_;
+  std::condition_variable written_cv_;
+  bool stop_;
+  bool flush_requested_;
+  std::thread worker_;
+
+  std::size_t size() const;
+  bool try_push(const spdlog::details::log_msg& msg);
+  void wake();
+  void run();
+  void drain();
+};
+
 }  // namespace scarabee
 
 #endif
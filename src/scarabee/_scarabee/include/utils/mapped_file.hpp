@@ -0,0 +1,33 @@
+#ifndef SCARABEE_MAPPED_FILE_H
+#define SCARABEE_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace scarabee {
+
+// Read-only view of the contents of a file. On POSIX systems the file is
+// memory mapped, so that only the pages which are accessed are read from the
+// disk. On other systems, the whole file is read into memory.
+class MappedFile {
+ public:
+  MappedFile(const std::string& fname);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+ private:
+  const char* data_{nullptr};
+  std::size_t size_{0};
+  bool mapped_{false};
+  std::vector<char> buffer_;  // Only used when the file is not mapped
+};
+
+}  // namespace scarabee
+
+#endif
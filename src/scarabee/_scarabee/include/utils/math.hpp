@@ -1,12 +1,19 @@
 #ifndef SCARABEE_MATH_H
 #define SCARABEE_MATH_H
 
+#include <array>
+#include <limits>
+#include <span>
+#include <vector>
+
 namespace scarabee {
 
 double exp(double x);
 
-// Evaluates 1 - exp(-x)
-inline double mexp(double x) {
+// Evaluates 1 - exp(-x). This is a template so that it may also be evaluated
+// on xsimd batches in the vectorized MOC sweep kernels.
+template <typename T>
+inline T mexp(const T& x) {
   // This function was taken from OpenMOC : expF1_fractional
   // Originally generated by Colin Josey with Remez's algorithm.
 
@@ -27,7 +34,7 @@ inline double mexp(double x) {
   constexpr double d5 = 1.0057980007137651 * 1E-3;
   constexpr double d6 = 1.9309063097411041 * 1E-4;
 
-  double num, den;
+  T num, den;
 
   den = d6 * x + d5;
   den = den * x + d4;
@@ -35,7 +42,7 @@ inline double mexp(double x) {
   den = den * x + d2;
   den = den * x + d1;
   den = den * x + d0;
-  den = 1.f / den;
+  den = T(1.) / den;
 
   num = p5 * x + p4;
   num = num * x + p3;
@@ -46,6 +53,19 @@ inline double mexp(double x) {
   return x * num * den;
 }
 
+// Exponential terms of the linear source MOC sweep, for a segment of optical
+// thickness tau, where F2 = 2 (tau - F1) - tau F1. The terms which vanish
+// with tau are evaluated from their series when tau is small, to avoid the
+// cancellation of the direct expressions.
+struct LinearSourceExp {
+  double F1;  // 1 - exp(-tau)
+  double E2;  // F2 / (2 tau^2)
+  double E3;  // F2 / (2 tau^3)
+  double G4;  // (tau^3 / 12 - (2 + tau) F2 / 4) / tau^4
+};
+
+LinearSourceExp linear_source_exp(double tau);
+
 double Ki3(double x);
 double Ki3_quad(double x);
 
@@ -57,12 +77,35 @@ double assoc_legendre(unsigned int order, int j, double x);
 // // phi: azimuthal angle and theta: polar angle
 double spherical_hamonics(unsigned int l, int j, double phi, double theta);
 
-inline double factorial(unsigned int N) {
-  double value = 1.;
-  for (unsigned int i = 1; i <= N; i++) {
-    value *= static_cast<double>(i);
+// Fills P with the Legendre polynomials P_0(x) to P_L(x), where P must have
+// L + 1 entries. All orders are found from one three term recurrence.
+void legendre_table(unsigned int L, double x, std::span<double> P);
+
+// Fills Y with the real spherical harmonics of all moments up to order L,
+// ordered by l then by j from -l to l, as spherical_hamonics. Y must have
+// (L + 1)^2 entries. The associated Legendre functions of all moments are
+// found from one recurrence, and the cosines and sines only once per j.
+void spherical_harmonics_table(unsigned int L, double phi, double theta,
+                               std::span<double> Y);
+
+// Weights of the values at the points x in the Lagrange polynomial through
+// them, evaluated at x0. The points must be distinct.
+std::vector<double> lagrange_weights(const std::vector<double>& x, double x0);
+
+// Factorials which are finite as a double, tabulated at compile time
+inline constexpr std::size_t MAX_FACTORIAL = 170;
+inline constexpr std::array<double, MAX_FACTORIAL + 1> FACTORIALS = [] {
+  std::array<double, MAX_FACTORIAL + 1> f{};
+  f[0] = 1.;
+  for (std::size_t i = 1; i <= MAX_FACTORIAL; i++) {
+    f[i] = f[i - 1] * static_cast<double>(i);
   }
-  return value;
+  return f;
+}();
+
+inline double factorial(unsigned int N) {
+  if (N > MAX_FACTORIAL) return std::numeric_limits<double>::infinity();
+  return FACTORIALS[N];
 }
 
 }  // namespace scarabee
@@ -0,0 +1,67 @@
+#ifndef SCARABEE_MEMORY_USAGE_H
+#define SCARABEE_MEMORY_USAGE_H
+
+#include <xtensor/containers/xtensor.hpp>
+
+#include <Eigen/Dense>
+#include <Eigen/SparseCore>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace scarabee {
+
+// Bytes held by the major arrays of an object, by component. Only the heap
+// storage of the arrays is counted, not the objects themselves, nor the
+// internal storage of factorizations and caches shared between objects.
+using MemoryUsage = std::map<std::string, std::size_t>;
+
+template <typename T, typename A>
+std::size_t array_bytes(const std::vector<T, A>& v) {
+  return v.capacity() * sizeof(T);
+}
+
+template <typename T>
+std::size_t array_bytes(const std::vector<std::vector<T>>& v) {
+  std::size_t bytes = v.capacity() * sizeof(std::vector<T>);
+  for (const auto& vi : v) bytes += array_bytes(vi);
+  return bytes;
+}
+
+template <typename T, std::size_t N>
+std::size_t array_bytes(const xt::xtensor<T, N>& a) {
+  return a.size() * sizeof(T);
+}
+
+template <typename T, std::size_t N>
+std::size_t array_bytes(const std::vector<xt::xtensor<T, N>>& v) {
+  std::size_t bytes = v.capacity() * sizeof(xt::xtensor<T, N>);
+  for (const auto& a : v) bytes += array_bytes(a);
+  return bytes;
+}
+
+template <typename T, int R, int C, int O, int MR, int MC>
+std::size_t array_bytes(const Eigen::Matrix<T, R, C, O, MR, MC>& a) {
+  return static_cast<std::size_t>(a.size()) * sizeof(T);
+}
+
+template <typename T, int O, typename I>
+std::size_t array_bytes(const Eigen::SparseMatrix<T, O, I>& A) {
+  return static_cast<std::size_t>(A.nonZeros()) * (sizeof(T) + sizeof(I)) +
+         static_cast<std::size_t>(A.outerSize() + 1) * sizeof(I);
+}
+
+inline std::size_t total_bytes(const MemoryUsage& usage) {
+  std::size_t total = 0;
+  for (const auto& [component, bytes] : usage) total += bytes;
+  return total;
+}
+
+// Logs the total and the breakdown of the memory usage of an object
+void log_memory_usage(const std::string& name, const MemoryUsage& usage);
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,133 @@
+#ifndef SCARABEE_MPI_H
+#define SCARABEE_MPI_H
+
+#ifdef SCARABEE_USE_MPI
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+namespace scarabee {
+
+#ifdef SCARABEE_USE_MPI
+namespace detail {
+
+// Initializes MPI on first use, unless the host program (e.g. mpi4py) has
+// already done so. MPI is then finalized when the program exits.
+inline void mpi_init() {
+  static const bool initialized = []() {
+    int init = 0;
+    MPI_Initialized(&init);
+    if (init == 0) {
+      int provided = 0;
+      MPI_Init_thread(nullptr, nullptr, MPI_THREAD_FUNNELED, &provided);
+      std::atexit([]() {
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if (finalized == 0) MPI_Finalize();
+      });
+    }
+    return true;
+  }();
+  (void)initialized;
+}
+
+template <typename T>
+void mpi_allreduce_sum(T* data, std::size_t n, MPI_Datatype type) {
+  mpi_init();
+  // Counts are ints in MPI, so large arrays are reduced in chunks
+  constexpr std::size_t CHUNK = std::size_t(1) << 30;
+  for (std::size_t i = 0; i < n; i += CHUNK) {
+    const int count = static_cast<int>(std::min(CHUNK, n - i));
+    MPI_Allreduce(MPI_IN_PLACE, data + i, count, type, MPI_SUM,
+                  MPI_COMM_WORLD);
+  }
+}
+
+template <typename T>
+void mpi_allgather_blocks(T* data, const std::vector<std::size_t>& offsets,
+                          MPI_Datatype type) {
+  mpi_init();
+  const std::size_t nranks = offsets.size() - 1;
+  if (offsets.back() <= static_cast<std::size_t>(INT_MAX)) {
+    std::vector<int> counts(nranks), displs(nranks);
+    for (std::size_t r = 0; r < nranks; r++) {
+      counts[r] = static_cast<int>(offsets[r + 1] - offsets[r]);
+      displs[r] = static_cast<int>(offsets[r]);
+    }
+    MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, data, counts.data(),
+                   displs.data(), type, MPI_COMM_WORLD);
+    return;
+  }
+
+  // Displacements are ints in MPI, so the blocks of large arrays are
+  // broadcast by their ranks in chunks instead
+  constexpr std::size_t CHUNK = std::size_t(1) << 30;
+  for (std::size_t r = 0; r < nranks; r++) {
+    for (std::size_t i = offsets[r]; i < offsets[r + 1]; i += CHUNK) {
+      const int count = static_cast<int>(std::min(CHUNK, offsets[r + 1] - i));
+      MPI_Bcast(data + i, count, type, static_cast<int>(r), MPI_COMM_WORLD);
+    }
+  }
+}
+
+}  // namespace detail
+#endif
+
+// Index of this process in MPI_COMM_WORLD
+inline std::size_t mpi_rank() {
+#ifdef SCARABEE_USE_MPI
+  detail::mpi_init();
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  return static_cast<std::size_t>(rank);
+#else
+  return 0;
+#endif
+}
+
+// Number of processes in MPI_COMM_WORLD
+inline std::size_t mpi_size() {
+#ifdef SCARABEE_USE_MPI
+  detail::mpi_init();
+  int size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  return static_cast<std::size_t>(size);
+#else
+  return 1;
+#endif
+}
+
+// Replaces the n values of data by their sum over all processes
+inline void mpi_allreduce_sum([[maybe_unused]] double* data,
+                              [[maybe_unused]] std::size_t n) {
+#ifdef SCARABEE_USE_MPI
+  detail::mpi_allreduce_sum(data, n, MPI_DOUBLE);
+#endif
+}
+
+inline void mpi_allreduce_sum([[maybe_unused]] float* data,
+                              [[maybe_unused]] std::size_t n) {
+#ifdef SCARABEE_USE_MPI
+  detail::mpi_allreduce_sum(data, n, MPI_FLOAT);
+#endif
+}
+
+// Process r holds the values of data in [offsets[r], offsets[r + 1]), and
+// gives them to all other processes. There is one more offset than there are
+// processes.
+inline void mpi_allgather_blocks(
+    [[maybe_unused]] double* data,
+    [[maybe_unused]] const std::vector<std::size_t>& offsets) {
+#ifdef SCARABEE_USE_MPI
+  detail::mpi_allgather_blocks(data, offsets, MPI_DOUBLE);
+#endif
+}
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef SCARABEE_MULTIGRID_H
+#define SCARABEE_MULTIGRID_H
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <Eigen/SparseLU>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace scarabee {
+
+// Multigrid V-cycle, which can be given as the preconditioner of the Eigen
+// ConjugateGradient and BiCGSTAB solvers. The coarse levels are defined by
+// the aggregates: for the unknowns of each level, the index of the unknown of
+// the next coarser level which contains it. The prolongation is the piecewise
+// constant interpolation over the aggregates, smoothed by one Jacobi step, and
+// the coarse matrices are formed by Galerkin projection. Weighted Jacobi is
+// used as the smoother, so that the cycle remains symmetric for symmetric
+// matrices, and the coarsest level is solved directly.
+class MultigridPreconditioner {
+ public:
+  using Matrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+  using Aggregates = std::vector<std::vector<std::size_t>>;
+
+  static constexpr double OMEGA = 2. / 3.;  // Jacobi weight
+  static constexpr std::size_t NU = 2;      // Pre- and post-smoothing sweeps
+
+  MultigridPreconditioner() = default;
+
+  void set_aggregates(std::shared_ptr<const Aggregates> aggregates) {
+    aggregates_ = std::move(aggregates);
+  }
+
+  // Number of levels, including the coarsest one
+  std::size_t nlevels() const { return levels_.size() + 1; }
+
+  Eigen::Index rows() const { return rows_; }
+  Eigen::Index cols() const { return rows_; }
+
+  template <typename MatType>
+  MultigridPreconditioner& analyzePattern(const MatType&) {
+    return *this;
+  }
+
+  template <typename MatType>
+  MultigridPreconditioner& factorize(const MatType& A) {
+    build(Matrix(A));
+    return *this;
+  }
+
+  template <typename MatType>
+  MultigridPreconditioner& compute(const MatType& A) {
+    return factorize(A);
+  }
+
+  // Applies one V-cycle to b, starting from a zero guess
+  template <typename Rhs>
+  Eigen::VectorXd solve(const Eigen::MatrixBase<Rhs>& b) const {
+    Eigen::VectorXd x;
+    cycle(0, b, x);
+    return x;
+  }
+
+  Eigen::ComputationInfo info() const { return info_; }
+
+ private:
+  struct Level {
+    Matrix A;
+    Eigen::VectorXd inv_diag;
+    Matrix P;  // Prolongation from the next coarser level
+    Matrix R;  // Restriction to the next coarser level
+  };
+
+  std::shared_ptr<const Aggregates> aggregates_;
+  std::vector<Level> levels_;
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> coarse_;
+  Eigen::Index rows_{0};
+  Eigen::ComputationInfo info_{Eigen::Success};
+
+  void build(Matrix A) {
+    levels_.clear();
+    rows_ = A.rows();
+    info_ = Eigen::Success;
+
+    const std::size_t nlevels = aggregates_ ? aggregates_->size() : 0;
+    for (std::size_t l = 0; l < nlevels; l++) {
+      const auto& agg = (*aggregates_)[l];
+      if (agg.size() != static_cast<std::size_t>(A.rows())) {
+        info_ = Eigen::InvalidInput;
+        return;
+      }
+      const std::size_t nc = *std::max_element(agg.begin(), agg.end()) + 1;
+
+      Level L;
+      L.inv_diag = A.diagonal().cwiseInverse();
+
+      // Tentative prolongation, which is constant over each aggregate
+      std::vector<Eigen::Triplet<double>> entries;
+      entries.reserve(agg.size());
+      for (std::size_t r = 0; r < agg.size(); r++) {
+        entries.emplace_back(static_cast<Eigen::Index>(r),
+                             static_cast<Eigen::Index>(agg[r]), 1.);
+      }
+      Matrix P0(A.rows(), static_cast<Eigen::Index>(nc));
+      P0.setFromTriplets(entries.begin(), entries.end());
+
+      const Matrix DA = L.inv_diag.asDiagonal() * A;
+      L.P = P0 - OMEGA * (DA * P0);
+      L.P.prune(0.);
+      L.R = L.P.transpose();
+
+      Matrix Ac = L.R * (A * L.P);
+      L.A = std::move(A);
+      levels_.push_back(std::move(L));
+      A = std::move(Ac);
+    }
+
+    const Eigen::SparseMatrix<double> Ac = A;
+    coarse_.compute(Ac);
+    if (coarse_.info() != Eigen::Success) info_ = Eigen::NumericalIssue;
+  }
+
+  template <typename Rhs>
+  void cycle(std::size_t l, const Eigen::MatrixBase<Rhs>& b,
+             Eigen::VectorXd& x) const {
+    if (l == levels_.size()) {
+      x = coarse_.solve(b);
+      return;
+    }
+
+    const Level& L = levels_[l];
+
+    // Pre-smoothing, where the first sweep starts from zero
+    x = OMEGA * L.inv_diag.cwiseProduct(b);
+    for (std::size_t s = 1; s < NU; s++) {
+      x += OMEGA * L.inv_diag.cwiseProduct(b - L.A * x);
+    }
+
+    // Coarse grid correction
+    const Eigen::VectorXd rc = L.R * (b - L.A * x);
+    Eigen::VectorXd xc;
+    cycle(l + 1, rc, xc);
+    x += L.P * xc;
+
+    // Post-smoothing
+    for (std::size_t s = 0; s < NU; s++) {
+      x += OMEGA * L.inv_diag.cwiseProduct(b - L.A * x);
+    }
+  }
+};
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef SCARABEE_PROFILER_H
+#define SCARABEE_PROFILER_H
+
+#include <string>
+
+namespace scarabee {
+
+// Hierarchical region profiler. Each thread keeps its own tree of the zones
+// it entered, with their number of calls and inclusive time, so that zones
+// may be entered from any thread without contention. The trees of all
+// threads are merged in the reports. The zones are only compiled when
+// SCARABEE_PROFILE is defined, and SCARABEE_PROFILE_ZONE expands to nothing
+// otherwise.
+class Profiler {
+ public:
+  static void enter(const char* name);
+  static void leave();
+
+  // Clears all zones. No zone may be active in any thread.
+  static void reset();
+
+  // When tracing, every exit from a zone is also recorded as an event, for
+  // write_chrome_trace. Disabled by default, as events use memory.
+  static bool tracing();
+  static void set_tracing(bool trace);
+
+  // Tree of the zones with their calls, total time, and share of the time
+  // of their parent, or the zones sorted by total time when flat.
+  static std::string report(bool flat = false);
+
+  // Writes the traced events in the Chrome trace event JSON format, which can
+  // be opened by chrome://tracing or Perfetto.
+  static void write_chrome_trace(const std::string& fname);
+
+  static constexpr bool enabled() {
+#ifdef SCARABEE_PROFILE
+    return true;
+#else
+    return false;
+#endif
+  }
+};
+
+// Profiles the zone from its construction to its destruction
+class ProfileZone {
+ public:
+  explicit ProfileZone(const char* name) { Profiler::enter(name); }
+  ~ProfileZone() { Profiler::leave(); }
+
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+}  // namespace scarabee
+
+#ifdef SCARABEE_PROFILE
+#define SCARABEE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SCARABEE_PROFILE_CONCAT(a, b) SCARABEE_PROFILE_CONCAT_IMPL(a, b)
+#define SCARABEE_PROFILE_ZONE(name)   \
+  const ::scarabee::ProfileZone       \
+  SCARABEE_PROFILE_CONCAT(scarabee_profile_zone_, __LINE__)(name)
+#else
+#define SCARABEE_PROFILE_ZONE(name)
+#endif
+
+#endif
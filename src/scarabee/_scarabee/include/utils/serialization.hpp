@@ -2,6 +2,7 @@
 #define SCARABEE_SERIALIZATION_H
 
 #include <cereal/cereal.hpp>
+#include <cereal/archives/portable_binary.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
 #include <xtensor/containers/xarray.hpp>
@@ -10,6 +11,9 @@
 
 #include <Eigen/Dense>
 
+#include <sstream>
+#include <string>
+
 namespace cereal {
 
 // xarray
@@ -187,4 +191,27 @@ void load(Archive& arc, htl::static_vector<T, C>& v) {
 
 }  // namespace cereal
 
+namespace scarabee {
+
+// Writes an object to an in-memory portable binary archive, with the same
+// format as the save methods use for files
+template <class T>
+std::string save_to_bytes(const T& obj) {
+  std::ostringstream buffer(std::ios_base::binary);
+  {
+    cereal::PortableBinaryOutputArchive arc(buffer);
+    arc(obj);
+  }
+  return std::move(buffer).str();
+}
+
+template <class T>
+void load_from_bytes(const std::string& data, T& obj) {
+  std::istringstream buffer(data, std::ios_base::binary);
+  cereal::PortableBinaryInputArchive arc(buffer);
+  arc(obj);
+}
+
+}  // namespace scarabee
+
 #endif
\ No newline at end of file
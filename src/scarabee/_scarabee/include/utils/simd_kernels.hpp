@@ -0,0 +1,95 @@
+#ifndef SCARABEE_SIMD_KERNELS_H
+#define SCARABEE_SIMD_KERNELS_H
+
+#include <xsimd/xsimd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace scarabee {
+
+// The hot SIMD kernels are compiled once for each instruction set of
+// simd_archs, each in its own translation unit with the matching compiler
+// flags, and the best one supported by the CPU is selected on the first
+// call. A generic x86-64 build therefore still uses AVX2 or AVX-512 when
+// they are available. Without SCARABEE_SIMD_DISPATCH, only the instruction
+// set of the build is used.
+#ifdef SCARABEE_SIMD_DISPATCH
+using simd_archs =
+    xsimd::arch_list<xsimd::avx512bw, xsimd::fma3<xsimd::avx2>,
+                     xsimd::default_arch>;
+#else
+using simd_archs = xsimd::arch_list<xsimd::default_arch>;
+#endif
+
+// Name of the instruction set used by the SIMD kernels on this CPU
+std::string simd_architecture();
+
+// Evaluates out[i] = 1 - exp(-x[i]) with the rational approximation of
+// mexp. The arrays may be the same.
+void mexp_array(const double* x, double* out, std::size_t n);
+
+// Evaluates the linearly interpolated Ki3 table with the given slopes and
+// intercepts at the n points of x, writing the values to out
+void ki3_table_evaluate(const double* slope, const double* intercept,
+                        double x_max, double invs_dx, const double* x,
+                        double* out, std::size_t n);
+
+// Attenuates the angular flux of npol polar angles across n consecutive
+// segments of a track, with optical thicknesses lEt and flat sources
+// Q_Et = Q / Et. When exp_m1 is not null, exp_m1 + k * exp_stride holds the
+// npol values of 1 - exp(-lEt / sin) of segment k, and they are not
+// evaluated. The weighted change of the angular flux across each segment is
+// written to delta.
+void attenuate_segments(std::size_t npol, const double* invs_sin,
+                        const double* wsin, double* angflux,
+                        const double* lEt, const double* Q_Et,
+                        const double* exp_m1, std::ptrdiff_t exp_stride,
+                        std::size_t n, double* delta);
+
+// Writes Q[i] = sum_k xs[k] flux[gin[k] * gstride + i * istride] for the
+// regions i in [i_begin, i_end), where k spans [offsets[m], offsets[m + 1])
+// and m = mat[i] * ngroups + g. This is the scattering source into group g,
+// from the compressed rows of the scattering matrix of each material.
+void scatter_source(std::size_t i_begin, std::size_t i_end, std::size_t g,
+                    std::size_t ngroups, const std::uint32_t* mat,
+                    const std::size_t* offsets, const double* xs,
+                    const std::uint32_t* gin, const double* flux,
+                    std::size_t gstride, std::size_t istride, double* Q);
+
+// Kernels dispatched by the functions above. Their call operators are only
+// defined in the translation units compiled for each architecture.
+struct MexpKernel {
+  template <class Arch>
+  void operator()(Arch, const double* x, double* out, std::size_t n) const;
+};
+
+struct Ki3TableKernel {
+  template <class Arch>
+  void operator()(Arch, const double* slope, const double* intercept,
+                  double x_max, double invs_dx, const double* x, double* out,
+                  std::size_t n) const;
+};
+
+struct AttenuateSegmentsKernel {
+  template <class Arch>
+  void operator()(Arch, std::size_t npol, const double* invs_sin,
+                  const double* wsin, double* angflux, const double* lEt,
+                  const double* Q_Et, const double* exp_m1,
+                  std::ptrdiff_t exp_stride, std::size_t n,
+                  double* delta) const;
+};
+
+struct ScatterSourceKernel {
+  template <class Arch>
+  void operator()(Arch, std::size_t i_begin, std::size_t i_end, std::size_t g,
+                  std::size_t ngroups, const std::uint32_t* mat,
+                  const std::size_t* offsets, const double* xs,
+                  const std::uint32_t* gin, const double* flux,
+                  std::size_t gstride, std::size_t istride, double* Q) const;
+};
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef SCARABEE_SIMD_KERNELS_IMPL_H
+#define SCARABEE_SIMD_KERNELS_IMPL_H
+
+// Definitions of the SIMD kernels. This is only included by the translation
+// units which instantiate them for one architecture, as they must be
+// compiled with the flags of that architecture. The helpers have internal
+// linkage, so that the linker never picks the copy compiled for a wider
+// instruction set than the CPU supports.
+
+#include <utils/simd_kernels.hpp>
+#include <utils/math.hpp>
+
+#include <xsimd/xsimd.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace scarabee {
+
+namespace {
+
+// Scalar mexp, evaluated in a batch of Arch. The scalar instantiation of
+// mexp is shared with the other translation units, and must not be compiled
+// with the flags of Arch.
+template <class Arch>
+double mexp_scalar(double x) {
+  return mexp(xsimd::batch<double, Arch>(x)).get(0);
+}
+
+template <std::size_t NP, class Arch>
+void attenuate_segments(const double* invs_sin, const double* wsin,
+                        double* angflux, const double* lEt,
+                        const double* Q_Et, const double* exp_m1,
+                        std::ptrdiff_t exp_stride, std::size_t n,
+                        double* delta) {
+  using batch = xsimd::batch<double, Arch>;
+  constexpr std::size_t W = batch::size;
+  constexpr std::size_t NB = (NP + W - 1) / W;
+  constexpr std::size_t NPAD = NB * W;
+
+  // Padding lanes have a weight and an inverse sine of zero, so their
+  // angular flux is never modified and never contributes to the tallies
+  auto load_padded = [](const double* v) {
+    std::array<double, NPAD> tmp{};
+    for (std::size_t p = 0; p < NP; p++) tmp[p] = v[p];
+    std::array<batch, NB> b;
+    for (std::size_t j = 0; j < NB; j++) {
+      b[j] = batch::load_unaligned(tmp.data() + j * W);
+    }
+    return b;
+  };
+
+  const std::array<batch, NB> binvs_sin = load_padded(invs_sin);
+  const std::array<batch, NB> bwsin = load_padded(wsin);
+  std::array<batch, NB> bflx = load_padded(angflux);
+
+  if (exp_m1 == nullptr) {
+    for (std::size_t k = 0; k < n; k++) {
+      const batch blEt(lEt[k]);
+      const batch bQ_Et(Q_Et[k]);
+      batch delta_sum(0.);
+      for (std::size_t j = 0; j < NB; j++) {
+        const batch e = mexp(blEt * binvs_sin[j]);
+        const batch delta_flx = (bflx[j] - bQ_Et) * e;
+        bflx[j] -= delta_flx;
+        delta_sum = xsimd::fma(bwsin[j], delta_flx, delta_sum);
+      }
+      delta[k] = xsimd::reduce_add(delta_sum);
+    }
+  } else {
+    for (std::size_t k = 0; k < n; k++) {
+      const std::array<batch, NB> be =
+          load_padded(exp_m1 + static_cast<std::ptrdiff_t>(k) * exp_stride);
+      const batch bQ_Et(Q_Et[k]);
+      batch delta_sum(0.);
+      for (std::size_t j = 0; j < NB; j++) {
+        const batch delta_flx = (bflx[j] - bQ_Et) * be[j];
+        bflx[j] -= delta_flx;
+        delta_sum = xsimd::fma(bwsin[j], delta_flx, delta_sum);
+      }
+      delta[k] = xsimd::reduce_add(delta_sum);
+    }
+  }
+
+  std::array<double, NPAD> tmp;
+  for (std::size_t j = 0; j < NB; j++) {
+    bflx[j].store_unaligned(tmp.data() + j * W);
+  }
+  for (std::size_t p = 0; p < NP; p++) angflux[p] = tmp[p];
+}
+
+// Generic version, for any number of polar angles
+template <class Arch>
+void attenuate_segments_scalar(std::size_t npol, const double* invs_sin,
+                               const double* wsin, double* angflux,
+                               const double* lEt, const double* Q_Et,
+                               const double* exp_m1, std::ptrdiff_t exp_stride,
+                               std::size_t n, double* delta) {
+  for (std::size_t k = 0; k < n; k++) {
+    const double* e =
+        exp_m1 ? exp_m1 + static_cast<std::ptrdiff_t>(k) * exp_stride
+               : nullptr;
+    double delta_sum = 0.;
+    for (std::size_t p = 0; p < npol; p++) {
+      const double exp_p = e ? e[p] : mexp_scalar<Arch>(lEt[k] * invs_sin[p]);
+      const double delta_flx = (angflux[p] - Q_Et[k]) * exp_p;
+      angflux[p] -= delta_flx;
+      delta_sum += wsin[p] * delta_flx;
+    }
+    delta[k] = delta_sum;
+  }
+}
+
+}  // namespace
+
+template <class Arch>
+void MexpKernel::operator()(Arch, const double* x, double* out,
+                            std::size_t n) const {
+  using batch = xsimd::batch<double, Arch>;
+  constexpr std::size_t W = batch::size;
+  const std::size_t nb = n - n % W;
+
+  for (std::size_t i = 0; i < nb; i += W) {
+    mexp(batch::load_unaligned(x + i)).store_unaligned(out + i);
+  }
+  for (std::size_t i = nb; i < n; i++) out[i] = mexp_scalar<Arch>(x[i]);
+}
+
+template <class Arch>
+void Ki3TableKernel::operator()(Arch, const double* slope,
+                                const double* intercept, double x_max,
+                                double invs_dx, const double* x, double* out,
+                                std::size_t n) const {
+  using batch = xsimd::batch<double, Arch>;
+  using int_batch = xsimd::batch<std::int64_t, Arch>;
+  constexpr std::size_t W = batch::size;
+  const std::size_t nb = n - n % W;
+
+  const batch bx_max(x_max);
+  const batch binvs_dx(invs_dx);
+  for (std::size_t i = 0; i < nb; i += W) {
+    const batch xi = batch::load_unaligned(x + i);
+    const batch xc = xsimd::min(xi, bx_max);
+    const int_batch indx = xsimd::to_int(xc * binvs_dx);
+    const batch a = batch::gather(slope, indx);
+    const batch b = batch::gather(intercept, indx);
+    xsimd::select(xi >= bx_max, batch(0.), xsimd::fma(a, xc, b))
+        .store_unaligned(out + i);
+  }
+
+  for (std::size_t i = nb; i < n; i++) {
+    if (x[i] >= x_max) {
+      out[i] = 0.;
+    } else {
+      const std::size_t j = static_cast<std::size_t>(x[i] * invs_dx);
+      out[i] = slope[j] * x[i] + intercept[j];
+    }
+  }
+}
+
+template <class Arch>
+void AttenuateSegmentsKernel::operator()(
+    Arch, std::size_t npol, const double* invs_sin, const double* wsin,
+    double* angflux, const double* lEt, const double* Q_Et,
+    const double* exp_m1, std::ptrdiff_t exp_stride, std::size_t n,
+    double* delta) const {
+  switch (npol) {
+    case 1:
+      attenuate_segments<1, Arch>(invs_sin, wsin, angflux, lEt, Q_Et, exp_m1,
+                                   exp_stride, n, delta);
+      break;
+    case 2:
+      attenuate_segments<2, Arch>(invs_sin, wsin, angflux, lEt, Q_Et, exp_m1,
+                                   exp_stride, n, delta);
+      break;
+    case 3:
+      attenuate_segments<3, Arch>(invs_sin, wsin, angflux, lEt, Q_Et, exp_m1,
+                                   exp_stride, n, delta);
+      break;
+    case 4:
+      attenuate_segments<4, Arch>(invs_sin, wsin, angflux, lEt, Q_Et, exp_m1,
+                                   exp_stride, n, delta);
+      break;
+    case 5:
+      attenuate_segments<5, Arch>(invs_sin, wsin, angflux, lEt, Q_Et, exp_m1,
+                                   exp_stride, n, delta);
+      break;
+    case 6:
+      attenuate_segments<6, Arch>(invs_sin, wsin, angflux, lEt, Q_Et, exp_m1,
+                                   exp_stride, n, delta);
+      break;
+    default:
+      attenuate_segments_scalar<Arch>(npol, invs_sin, wsin, angflux, lEt,
+                                      Q_Et, exp_m1, exp_stride, n, delta);
+      break;
+  }
+}
+
+template <class Arch>
+void ScatterSourceKernel::operator()(
+    Arch, std::size_t i_begin, std::size_t i_end, std::size_t g,
+    std::size_t ngroups, const std::uint32_t* mat, const std::size_t* offsets,
+    const double* xs, const std::uint32_t* gin, const double* flux,
+    std::size_t gstride, std::size_t istride, double* Q) const {
+  using batch = xsimd::batch<double, Arch>;
+  using int_batch = xsimd::batch<std::int64_t, Arch>;
+  constexpr std::size_t W = batch::size;
+
+  alignas(Arch::alignment()) std::array<std::int64_t, W> indx;
+  for (std::size_t i = i_begin; i < i_end; i++) {
+    const std::size_t mg = static_cast<std::size_t>(mat[i]) * ngroups + g;
+    const std::size_t k_begin = offsets[mg];
+    const std::size_t k_end = offsets[mg + 1];
+    const double* flux_i = flux + i * istride;
+
+    // The incident groups are gathered W at a time
+    batch sum(0.);
+    std::size_t k = k_begin;
+    for (; k + W <= k_end; k += W) {
+      for (std::size_t j = 0; j < W; j++) {
+        indx[j] = static_cast<std::int64_t>(gin[k + j] * gstride);
+      }
+      const int_batch bindx = int_batch::load_aligned(indx.data());
+      const batch f = batch::gather(flux_i, bindx);
+      sum = xsimd::fma(batch::load_unaligned(xs + k), f, sum);
+    }
+
+    double Qi = xsimd::reduce_add(sum);
+    for (; k < k_end; k++) Qi += xs[k] * flux_i[gin[k] * gstride];
+    Q[i] = Qi;
+  }
+}
+
+}  // namespace scarabee
+
+// Explicitly instantiates all the kernels for one architecture
+#define SCARABEE_INSTANTIATE_SIMD_KERNELS(ARCH)                              \
+  template void scarabee::MexpKernel::operator()<ARCH>(                      \
+      ARCH, const double*, double*, std::size_t) const;                      \
+  template void scarabee::Ki3TableKernel::operator()<ARCH>(                  \
+      ARCH, const double*, const double*, double, double, const double*,     \
+      double*, std::size_t) const;                                           \
+  template void scarabee::AttenuateSegmentsKernel::operator()<ARCH>(         \
+      ARCH, std::size_t, const double*, const double*, double*,              \
+      const double*, const double*, const double*, std::ptrdiff_t,           \
+      std::size_t, double*) const;                                           \
+  template void scarabee::ScatterSourceKernel::operator()<ARCH>(             \
+      ARCH, std::size_t, std::size_t, std::size_t, std::size_t,              \
+      const std::uint32_t*, const std::size_t*, const double*,               \
+      const std::uint32_t*, const double*, std::size_t, std::size_t,         \
+      double*) const;
+
+#endif
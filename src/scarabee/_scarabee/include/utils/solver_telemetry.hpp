@@ -0,0 +1,151 @@
+#ifndef SCARABEE_SOLVER_TELEMETRY_H
+#define SCARABEE_SOLVER_TELEMETRY_H
+
+#include <utils/timer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace scarabee {
+
+// Performance counters and convergence history of a solver. The solver clears
+// it at the start of each solve, and updates it as it iterates. Every method
+// locks the telemetry, so that it may be read from another thread while the
+// solve is running.
+class SolverTelemetry {
+ public:
+  SolverTelemetry() = default;
+
+  SolverTelemetry(const SolverTelemetry& other) { *this = other; }
+
+  SolverTelemetry& operator=(const SolverTelemetry& other) {
+    if (this == &other) return *this;
+    std::scoped_lock lock(mutex_, other.mutex_);
+    phase_times_ = other.phase_times_;
+    counters_ = other.counters_;
+    memory_ = other.memory_;
+    residuals_ = other.residuals_;
+    keffs_ = other.keffs_;
+    return *this;
+  }
+
+  void clear() {
+    std::scoped_lock lock(mutex_);
+    phase_times_.clear();
+    counters_.clear();
+    memory_.clear();
+    residuals_.clear();
+    keffs_.clear();
+  }
+
+  // Adds seconds to the wall time spent in a phase of the solve
+  void add_time(const std::string& phase, double seconds) {
+    std::scoped_lock lock(mutex_);
+    phase_times_[phase] += seconds;
+  }
+
+  void add_count(const std::string& counter, std::size_t n) {
+    std::scoped_lock lock(mutex_);
+    counters_[counter] += n;
+  }
+
+  // Records the end of an iteration, with its residual and keff
+  void add_iteration(double residual, double keff) {
+    std::scoped_lock lock(mutex_);
+    residuals_.push_back(residual);
+    keffs_.push_back(keff);
+  }
+
+  // Keeps the largest size in bytes which an array has had during the solve
+  void record_memory(const std::string& array, std::size_t bytes) {
+    std::scoped_lock lock(mutex_);
+    auto& peak = memory_[array];
+    peak = std::max(peak, bytes);
+  }
+
+  std::map<std::string, double> phase_times() const {
+    std::scoped_lock lock(mutex_);
+    return phase_times_;
+  }
+
+  double phase_time(const std::string& phase) const {
+    std::scoped_lock lock(mutex_);
+    const auto it = phase_times_.find(phase);
+    return it == phase_times_.end() ? 0. : it->second;
+  }
+
+  std::map<std::string, std::size_t> counters() const {
+    std::scoped_lock lock(mutex_);
+    return counters_;
+  }
+
+  std::size_t count(const std::string& counter) const {
+    std::scoped_lock lock(mutex_);
+    const auto it = counters_.find(counter);
+    return it == counters_.end() ? 0 : it->second;
+  }
+
+  std::map<std::string, std::size_t> memory() const {
+    std::scoped_lock lock(mutex_);
+    return memory_;
+  }
+
+  std::size_t iterations() const {
+    std::scoped_lock lock(mutex_);
+    return residuals_.size();
+  }
+
+  std::vector<double> residuals() const {
+    std::scoped_lock lock(mutex_);
+    return residuals_;
+  }
+
+  std::vector<double> keffs() const {
+    std::scoped_lock lock(mutex_);
+    return keffs_;
+  }
+
+  // Segments swept per second of the sweep phase. A segment is counted once
+  // per group and direction.
+  double segments_per_second() const {
+    const double t = phase_time("sweep");
+    return t > 0. ? static_cast<double>(count("segments")) / t : 0.;
+  }
+
+  // Adds the wall time of its scope to a phase
+  class ScopedPhase {
+   public:
+    ScopedPhase(SolverTelemetry& telemetry, const char* phase)
+        : telemetry_(telemetry), phase_(phase) {
+      timer_.start();
+    }
+    ~ScopedPhase() {
+      timer_.stop();
+      telemetry_.add_time(phase_, timer_.elapsed_time());
+    }
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+   private:
+    SolverTelemetry& telemetry_;
+    const char* phase_;
+    Timer timer_;
+  };
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::string, double> phase_times_;
+  std::map<std::string, std::size_t> counters_;
+  std::map<std::string, std::size_t> memory_;
+  std::vector<double> residuals_;
+  std::vector<double> keffs_;
+};
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef SCARABEE_SPARSE_PATTERN_H
+#define SCARABEE_SPARSE_PATTERN_H
+
+#include <utils/memory_usage.hpp>
+
+#include <Eigen/Sparse>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace scarabee {
+
+// Fixed sparsity pattern of a square sparse matrix which is assembled many
+// times with the same entries. Rows are filled by a function, called as
+// fill(r, add), which must call add(c, v) to add v to the entry in column c
+// of row r. The first assembly inserts the entries and records the position
+// of each call to add in the values array of the compressed matrix. Later
+// assemblies then only write the values, as long as fill makes the same
+// sequence of calls to add for every row. Row major matrices are built in
+// parallel as well, by filling their compressed storage directly.
+class SparsePattern {
+ public:
+  bool empty() const { return slots_.empty(); }
+
+  std::size_t memory_bytes() const {
+    return array_bytes(row_begin_) + array_bytes(slots_);
+  }
+
+  void clear() {
+    row_begin_.clear();
+    slots_.clear();
+    nnz_ = 0;
+  }
+
+  // Assembles the n x n matrix M. Once the pattern is known, the rows are
+  // filled in parallel, in tasks of rows_per_task consecutive rows which are
+  // each filled in order by a single thread.
+  template <typename Matrix, typename RowFill>
+  void assemble(Matrix& M, std::size_t n, std::size_t rows_per_task,
+                const RowFill& fill) {
+    if (row_begin_.size() != n + 1 ||
+        static_cast<std::size_t>(M.rows()) != n ||
+        static_cast<std::size_t>(M.nonZeros()) != nnz_ ||
+        M.isCompressed() == false) {
+      build(M, n, fill);
+      return;
+    }
+
+    double* values = M.valuePtr();
+    std::fill(values, values + M.nonZeros(), 0.);
+
+    rows_per_task = std::max<std::size_t>(rows_per_task, 1);
+    const std::size_t ntasks = (n + rows_per_task - 1) / rows_per_task;
+#pragma omp parallel for
+    for (int it = 0; it < static_cast<int>(ntasks); it++) {
+      const std::size_t r_begin = static_cast<std::size_t>(it) * rows_per_task;
+      const std::size_t r_end = std::min(r_begin + rows_per_task, n);
+      for (std::size_t r = r_begin; r < r_end; r++) {
+        std::size_t k = row_begin_[r];
+        fill(r, [&](std::size_t, double v) { values[slots_[k++]] += v; });
+      }
+    }
+  }
+
+ private:
+  std::vector<std::size_t> row_begin_;  // First slot of each row
+  std::vector<std::size_t> slots_;  // Position of each entry in the values
+  std::size_t nnz_{0};              // Number of nonzeros in the matrix
+
+  template <typename Matrix, typename RowFill>
+  void build(Matrix& M, std::size_t n, const RowFill& fill) {
+    if constexpr (static_cast<bool>(Matrix::IsRowMajor)) {
+      build_row_major(M, n, fill);
+    } else {
+      build_triplets(M, n, fill);
+    }
+  }
+
+  template <typename Matrix, typename RowFill>
+  void build_triplets(Matrix& M, std::size_t n, const RowFill& fill) {
+    using Index = typename Matrix::StorageIndex;
+
+    std::vector<Eigen::Triplet<double, Index>> entries;
+    row_begin_.assign(n + 1, 0);
+    for (std::size_t r = 0; r < n; r++) {
+      row_begin_[r] = entries.size();
+      fill(r, [&](std::size_t c, double v) {
+        entries.emplace_back(static_cast<Index>(r), static_cast<Index>(c), v);
+      });
+    }
+    row_begin_[n] = entries.size();
+
+    M.resize(static_cast<Index>(n), static_cast<Index>(n));
+    M.setFromTriplets(entries.begin(), entries.end());
+    M.makeCompressed();
+    nnz_ = static_cast<std::size_t>(M.nonZeros());
+
+    // Find the position of each entry in the compressed storage
+    const Index* outer = M.outerIndexPtr();
+    const Index* inner = M.innerIndexPtr();
+    slots_.resize(entries.size());
+    for (std::size_t k = 0; k < entries.size(); k++) {
+      const Index o =
+          Matrix::IsRowMajor ? entries[k].row() : entries[k].col();
+      const Index in =
+          Matrix::IsRowMajor ? entries[k].col() : entries[k].row();
+      const Index* pos = std::lower_bound(inner + outer[o],
+                                          inner + outer[o + 1], in);
+      slots_[k] = static_cast<std::size_t>(pos - inner);
+    }
+  }
+
+  // Counts the calls to add in each row, collects the entries of each row,
+  // and sorts and merges each row into the compressed storage. Every step
+  // is parallel over the rows except for the two prefix sums.
+  template <typename Matrix, typename RowFill>
+  void build_row_major(Matrix& M, std::size_t n, const RowFill& fill) {
+    using Index = typename Matrix::StorageIndex;
+
+    row_begin_.assign(n + 1, 0);
+#pragma omp parallel for schedule(static, 256)
+    for (int ir = 0; ir < static_cast<int>(n); ir++) {
+      const std::size_t r = static_cast<std::size_t>(ir);
+      std::size_t count = 0;
+      fill(r, [&](std::size_t, double) { count++; });
+      row_begin_[r + 1] = count;
+    }
+    for (std::size_t r = 0; r < n; r++) row_begin_[r + 1] += row_begin_[r];
+
+    const std::size_t nentries = row_begin_[n];
+    std::vector<Index> cols(nentries);
+    std::vector<Index> sorted(nentries);
+    std::vector<double> vals(nentries);
+    std::vector<Index> outer(n + 1, 0);
+#pragma omp parallel for schedule(static, 256)
+    for (int ir = 0; ir < static_cast<int>(n); ir++) {
+      const std::size_t r = static_cast<std::size_t>(ir);
+      std::size_t k = row_begin_[r];
+      fill(r, [&](std::size_t c, double v) {
+        cols[k] = static_cast<Index>(c);
+        vals[k] = v;
+        k++;
+      });
+
+      // Distinct columns of the row, in order
+      const auto s_begin = sorted.begin() + row_begin_[r];
+      const auto s_end = sorted.begin() + row_begin_[r + 1];
+      std::copy(cols.begin() + row_begin_[r], cols.begin() + row_begin_[r + 1],
+                s_begin);
+      std::sort(s_begin, s_end);
+      outer[r + 1] = static_cast<Index>(std::unique(s_begin, s_end) - s_begin);
+    }
+    for (std::size_t r = 0; r < n; r++) outer[r + 1] += outer[r];
+
+    nnz_ = static_cast<std::size_t>(outer[n]);
+    std::vector<Index> inner(nnz_);
+    std::vector<double> values(nnz_, 0.);
+    slots_.resize(nentries);
+#pragma omp parallel for schedule(static, 256)
+    for (int ir = 0; ir < static_cast<int>(n); ir++) {
+      const std::size_t r = static_cast<std::size_t>(ir);
+      const auto s_begin = sorted.begin() + row_begin_[r];
+      Index* const row_begin = inner.data() + outer[r];
+      Index* const row_end = inner.data() + outer[r + 1];
+      std::copy(s_begin, s_begin + (row_end - row_begin), row_begin);
+
+      for (std::size_t k = row_begin_[r]; k < row_begin_[r + 1]; k++) {
+        const Index* pos = std::lower_bound(row_begin, row_end, cols[k]);
+        slots_[k] = static_cast<std::size_t>(pos - inner.data());
+        values[slots_[k]] += vals[k];
+      }
+    }
+
+    M = Eigen::Map<const Matrix>(static_cast<Index>(n),
+                                 static_cast<Index>(n),
+                                 static_cast<Index>(nnz_), outer.data(),
+                                 inner.data(), values.data());
+    M.makeCompressed();
+  }
+};
+
+}  // namespace scarabee
+
+#endif
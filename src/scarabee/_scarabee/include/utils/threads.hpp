@@ -0,0 +1,242 @@
+#ifndef SCARABEE_THREADS_H
+#define SCARABEE_THREADS_H
+
+#ifdef SCARABEE_USE_OMP
+#include <omp.h>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace scarabee {
+
+// Maximum number of threads which may be used in a parallel region
+inline std::size_t max_threads() {
+#ifdef SCARABEE_USE_OMP
+  return static_cast<std::size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+// Index of the calling thread in the current parallel region
+inline std::size_t thread_index() {
+#ifdef SCARABEE_USE_OMP
+  return static_cast<std::size_t>(omp_get_thread_num());
+#else
+  return 0;
+#endif
+}
+
+// Number of threads of the parallel regions which the calling thread starts
+// from now on. Within parallel_for_each_index, this only applies to the
+// regions started from the indices handled by the calling thread.
+inline void set_num_threads(std::size_t n) {
+#ifdef SCARABEE_USE_OMP
+  omp_set_num_threads(static_cast<int>(n));
+#else
+  static_cast<void>(n);
+#endif
+}
+
+// Number of processors available to the process
+inline std::size_t hardware_threads() {
+#ifdef SCARABEE_USE_OMP
+  return static_cast<std::size_t>(omp_get_num_procs());
+#else
+  return 1;
+#endif
+}
+
+// Process wide number of threads of the solvers which do not set their own,
+// from any Python or C++ thread. When 0, which is the default, the OpenMP
+// defaults of the calling thread are used.
+std::size_t default_threads();
+void set_default_threads(std::size_t n);
+
+// Process wide switch for reproducible reductions, off by default. When it
+// is on, the parallel sums of the solvers are split into nblocks blocks,
+// independent of the number of threads, which are each summed in order
+// before the block sums are added in order. The keff and fluxes are then
+// bitwise identical for any number of threads. The track sweeps keep one
+// flux tally per block, and use at most nblocks threads.
+bool reproducible_reductions();
+std::size_t reduction_blocks();
+void set_reproducible_reductions(bool enabled, std::size_t nblocks = 32);
+
+namespace detail {
+inline constexpr std::size_t NO_REDUCTION_BLOCK = static_cast<std::size_t>(-1);
+inline thread_local std::size_t reduction_block = NO_REDUCTION_BLOCK;
+}  // namespace detail
+
+// Index of the tally buffer which the calling thread adds to. This is the
+// block it works on while it holds a ReductionBlock, and its thread index
+// otherwise.
+inline std::size_t tally_slot() {
+  return detail::reduction_block == detail::NO_REDUCTION_BLOCK
+             ? thread_index()
+             : detail::reduction_block;
+}
+
+// Number of tally buffers which are needed for all the tally slots
+inline std::size_t tally_slots() {
+  if (reproducible_reductions() == false) return max_threads();
+  return reduction_blocks() > max_threads() ? reduction_blocks()
+                                            : max_threads();
+}
+
+// Makes the calling thread tally into the buffer of block b while it is
+// alive
+class ReductionBlock {
+ public:
+  explicit ReductionBlock(std::size_t b) : prev_(detail::reduction_block) {
+    detail::reduction_block = b;
+  }
+  ~ReductionBlock() { detail::reduction_block = prev_; }
+
+  ReductionBlock(const ReductionBlock&) = delete;
+  ReductionBlock& operator=(const ReductionBlock&) = delete;
+
+ private:
+  std::size_t prev_;
+};
+
+// Splits the processors available to the process into n disjoint sets of
+// consecutive cores, which can be given to solvers run concurrently.
+std::vector<std::vector<std::size_t>> core_sets(std::size_t n);
+
+// Threads used by a solver. When num_threads is 0, the solver uses one
+// thread per pinned core, or the process wide default when it is not
+// pinned. The threads are pinned to the cores round robin, which is only
+// supported on Linux.
+struct ThreadSettings {
+  std::size_t num_threads{0};
+  std::vector<std::size_t> cores;
+
+  // Throws if a core is not available to the process
+  void set_cores(const std::vector<std::size_t>& new_cores);
+};
+
+// Applies the ThreadSettings of a solver to the parallel regions started by
+// the calling thread while it is alive, and then restores the previous
+// number of threads and affinities. Within a parallel region, the settings
+// of the enclosing region are kept.
+class ThreadScope {
+ public:
+  explicit ThreadScope(const ThreadSettings& settings);
+  ~ThreadScope();
+
+  ThreadScope(const ThreadScope&) = delete;
+  ThreadScope& operator=(const ThreadScope&) = delete;
+
+ private:
+  std::size_t prev_threads_{0};
+  std::size_t team_{0};
+  std::vector<std::vector<unsigned char>> saved_masks_;
+};
+
+// Fills the n values of data in parallel with a static schedule, so that on
+// NUMA systems each page of a newly allocated array is placed on the node
+// of the thread which then works on it most.
+template <typename T>
+void parallel_fill(T* data, std::size_t n, const T& value) {
+#pragma omp parallel for schedule(static)
+  for (long long i = 0; i < static_cast<long long>(n); i++) {
+    data[i] = value;
+  }
+}
+
+// Allocator which leaves trivial types uninitialized on resize, so that the
+// pages of an array are first touched by the threads which fill it.
+template <typename T>
+struct FirstTouchAllocator : std::allocator<T> {
+  using std::allocator<T>::allocator;
+
+  template <typename U>
+  struct rebind {
+    using other = FirstTouchAllocator<U>;
+  };
+
+  template <typename U, typename... Args>
+  void construct(U* p, Args&&... args) {
+    if constexpr (sizeof...(Args) == 0) {
+      ::new (static_cast<void*>(p)) U;
+    } else {
+      ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+  }
+};
+
+template <typename T>
+using FirstTouchVector = std::vector<T, FirstTouchAllocator<T>>;
+
+// Calls f(i) for all i in [0, n) in parallel, with one index per thread at
+// a time. Exceptions cannot leave a parallel region, so the first one is
+// kept and rethrown once all indices are done.
+template <typename F>
+void parallel_for_each_index(std::size_t n, F f) {
+  std::exception_ptr err = nullptr;
+
+#pragma omp parallel for schedule(dynamic)
+  for (int ii = 0; ii < static_cast<int>(n); ii++) {
+    try {
+      f(static_cast<std::size_t>(ii));
+    } catch (...) {
+#pragma omp critical
+      if (err == nullptr) err = std::current_exception();
+    }
+  }
+
+  if (err) std::rethrow_exception(err);
+}
+
+// Returns the N sums of f(i, sums) for all i in [0, n), where f adds the
+// terms of index i to sums. With reproducible reductions, the result does
+// not depend on the number of threads.
+template <std::size_t N, typename F>
+std::array<double, N> parallel_sum(std::size_t n, F f) {
+  std::array<double, N> sums{};
+
+  if (reproducible_reductions()) {
+    const std::size_t nblocks = reduction_blocks();
+    std::vector<std::array<double, N>> block_sums(nblocks);
+#pragma omp parallel for schedule(static)
+    for (int ib = 0; ib < static_cast<int>(nblocks); ib++) {
+      const std::size_t b = static_cast<std::size_t>(ib);
+      auto& bsums = block_sums[b];
+      bsums.fill(0.);
+      for (std::size_t i = b * n / nblocks; i < (b + 1) * n / nblocks; i++) {
+        f(i, bsums);
+      }
+    }
+
+    for (const auto& bsums : block_sums) {
+      for (std::size_t k = 0; k < N; k++) sums[k] += bsums[k];
+    }
+    return sums;
+  }
+
+#pragma omp parallel
+  {
+    std::array<double, N> thrd_sums{};
+
+#pragma omp for
+    for (long long ii = 0; ii < static_cast<long long>(n); ii++) {
+      f(static_cast<std::size_t>(ii), thrd_sums);
+    }
+
+#pragma omp critical
+    for (std::size_t k = 0; k < N; k++) sums[k] += thrd_sums[k];
+  }
+
+  return sums;
+}
+
+}  // namespace scarabee
+
+#endif
@@ -0,0 +1,59 @@
+#include <utils/ki3_table.hpp>
+#include <utils/math.hpp>
+#include <utils/simd_kernels.hpp>
+#include <utils/constants.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <cmath>
+
+namespace scarabee {
+
+Ki3Table::Ki3Table(double max_error)
+    : max_error_(max_error), x_max_(), invs_dx_(), slope_(), intercept_() {
+  if (max_error_ <= 0. || max_error_ >= 0.1) {
+    const auto mssg = "Ki3 table maximum error must be in (0, 0.1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Past x_max, Ki3(x) is within max_error of 0. Ki3 is decreasing, so x_max
+  // is found by bisection over the range of the series, which is 0 past 15.
+  double a = 0.;
+  double b = 15.;
+  while (b - a > 1.E-3) {
+    const double c = 0.5 * (a + b);
+    if (Ki3(c) > max_error_) {
+      a = c;
+    } else {
+      b = c;
+    }
+  }
+  x_max_ = b;
+
+  // The error of linear interpolation is bounded by dx^2 max|f''| / 8, with
+  // f''(x) = Ki1(x) <= Ki1(0) = pi / 2.
+  const double dx_max = std::sqrt(16. * max_error_ / PI);
+  const std::size_t n = static_cast<std::size_t>(std::ceil(x_max_ / dx_max));
+  const double dx = x_max_ / static_cast<double>(n);
+  invs_dx_ = 1. / dx;
+
+  // One extra interval guards against round off in the index for x ~ x_max
+  slope_.resize(n + 1);
+  intercept_.resize(n + 1);
+  for (std::size_t i = 0; i <= n; i++) {
+    const double x0 = static_cast<double>(i) * dx;
+    const double x1 = x0 + dx;
+    const double f0 = Ki3(x0);
+    const double f1 = Ki3(x1);
+    slope_[i] = (f1 - f0) * invs_dx_;
+    intercept_[i] = f0 - slope_[i] * x0;
+  }
+}
+
+void Ki3Table::evaluate(const double* x, double* out, std::size_t n) const {
+  ki3_table_evaluate(slope_.data(), intercept_.data(), x_max_, invs_dx_, x,
+                     out, n);
+}
+
+}  // namespace scarabee
@@ -2,23 +2,24 @@
 
 #include <spdlog/sinks/basic_file_sink.h>
 
-#include <pybind11/pybind11.h>
-namespace py = pybind11;
-
+#include <cstdio>
 #include <memory>
+#include <string>
 
 namespace scarabee {
 
+static const std::string python_sink_pattern = "[%^%l%$] %v";
+
 struct _private_logger_init {
   _private_logger_init() {
     // First, we need to remove the default sink that goes to stdout
     spdlog::default_logger()->sinks().clear();
 
     // Create a new custom sink
-    auto python_sink = std::make_shared<PythonSinkMT>();
+    auto python_sink = std::make_shared<ConsoleSinkMT>();
 
     // Set the patern for logging output
-    python_sink->set_pattern("[%^%l%$] %v");
+    python_sink->set_pattern(python_sink_pattern);
 
     // Save the sink to the logger
     spdlog::default_logger()->sinks().push_back(python_sink);
@@ -35,4 +36,264 @@ void set_output_file(const std::string& fname) {
   spdlog::default_logger()->sinks().push_back(file_sink);
 }
 
+void set_async_logging(bool enabled) {
+  for (auto& sink : spdlog::default_logger()->sinks()) {
+    if (enabled && std::dynamic_pointer_cast<ConsoleSinkMT>(sink)) {
+      auto async_sink = std::make_shared<AsyncPythonSink>();
+      async_sink->set_pattern(python_sink_pattern);
+      async_sink->set_level(sink->level());
+      sink = async_sink;
+    } else if (enabled == false &&
+               std::dynamic_pointer_cast<AsyncPythonSink>(sink)) {
+      // Replacing the sink destroys it, which prints all queued messages
+      auto python_sink = std::make_shared<ConsoleSinkMT>();
+      python_sink->set_pattern(python_sink_pattern);
+      python_sink->set_level(sink->level());
+      sink = python_sink;
+    }
+  }
+}
+
+bool async_logging() {
+  for (const auto& sink : spdlog::default_logger()->sinks()) {
+    if (std::dynamic_pointer_cast<AsyncPythonSink>(sink)) return true;
+  }
+  return false;
+}
+
+//==============================================================================
+// AsyncPythonSink
+
+// Releases the GIL for the lifetime of the object, if the calling thread
+// holds it. Used wherever we wait on the worker, which needs the GIL to print.
+// Without Python, there is no GIL to release.
+#ifdef SCARABEE_PYTHON
+class GILReleaseIfHeld {
+ public:
+  GILReleaseIfHeld() {
+    if (Py_IsInitialized() && PyGILState_Check())
+      release_ = std::make_unique<py::gil_scoped_release>();
+  }
+
+ private:
+  std::unique_ptr<py::gil_scoped_release> release_;
+};
+#else
+class GILReleaseIfHeld {
+ public:
+  GILReleaseIfHeld() {}
+};
+#endif
+
+AsyncPythonSink::AsyncPythonSink(std::size_t capacity,
+                                 std::chrono::milliseconds interval)
+    : ring_(),
+      mask_(0),
+      interval_(interval),
+      enqueue_pos_(0),
+      dequeue_pos_(0),
+      written_(0),
+      dropped_(0),
+      total_dropped_(0),
+      formatter_mtx_(),
+      formatter_(std::make_unique<spdlog::pattern_formatter>()),
+      wake_mtx_(),
+      wake_cv_(),
+      written_cv_(),
+      stop_(false),
+      flush_requested_(false),
+      worker_() {
+  // Round the capacity up to a power of two so positions map to slots
+  // with a mask.
+  std::size_t cap = 2;
+  while (cap < capacity) cap *= 2;
+  mask_ = cap - 1;
+
+  ring_ = std::vector<Entry>(cap);
+  for (std::size_t i = 0; i < cap; i++) ring_[i].seq.store(i);
+
+  worker_ = std::thread(&AsyncPythonSink::run, this);
+}
+
+AsyncPythonSink::~AsyncPythonSink() {
+  GILReleaseIfHeld release;
+
+  {
+    std::lock_guard<std::mutex> lk(wake_mtx_);
+    stop_ = true;
+  }
+  wake_cv_.notify_one();
+
+  if (worker_.joinable()) worker_.join();
+}
+
+std::size_t AsyncPythonSink::size() const {
+  const std::uint64_t enq = enqueue_pos_.load(std::memory_order_relaxed);
+  const std::uint64_t deq = dequeue_pos_.load(std::memory_order_relaxed);
+  return enq > deq ? static_cast<std::size_t>(enq - deq) : 0;
+}
+
+bool AsyncPythonSink::try_push(const spdlog::details::log_msg& msg) {
+  // Bounded multi-producer queue: each slot carries a sequence number which
+  // tells producers whether it is free for the position they claim.
+  std::uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  Entry* e = nullptr;
+  while (true) {
+    e = &ring_[pos & mask_];
+    const std::uint64_t seq = e->seq.load(std::memory_order_acquire);
+    const std::int64_t diff =
+        static_cast<std::int64_t>(seq) - static_cast<std::int64_t>(pos);
+
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed))
+        break;
+    } else if (diff < 0) {
+      return false;
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  e->time = msg.time;
+  e->level = msg.level;
+  e->thread_id = msg.thread_id;
+  e->payload.assign(msg.payload.data(), msg.payload.size());
+  e->seq.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+void AsyncPythonSink::wake() {
+  // Producers do not take the mutex, so a wake-up can be missed. The worker
+  // also wakes every interval_, which bounds the resulting delay.
+  wake_cv_.notify_one();
+}
+
+void AsyncPythonSink::log(const spdlog::details::log_msg& msg) {
+  if (should_log(msg.level) == false) return;
+
+  const std::size_t capacity = mask_ + 1;
+  const bool low_priority = msg.level <= spdlog::level::debug;
+
+  if (low_priority && size() >= 3 * capacity / 4) {
+    dropped_++;
+    total_dropped_++;
+    return;
+  }
+
+  if (try_push(msg) == false) {
+    if (low_priority) {
+      dropped_++;
+      total_dropped_++;
+      return;
+    }
+
+    // The worker may need the GIL to make space
+    GILReleaseIfHeld release;
+    do {
+      wake();
+      std::this_thread::yield();
+    } while (try_push(msg) == false);
+  }
+
+  if (msg.level >= spdlog::level::err || size() >= capacity / 2) wake();
+}
+
+void AsyncPythonSink::flush() {
+  const std::uint64_t target = enqueue_pos_.load();
+
+  GILReleaseIfHeld release;
+
+  std::unique_lock<std::mutex> lk(wake_mtx_);
+  while (written_.load() < target && stop_ == false) {
+    flush_requested_ = true;
+    wake_cv_.notify_one();
+    written_cv_.wait_for(lk, interval_);
+  }
+}
+
+void AsyncPythonSink::set_pattern(const std::string& pattern) {
+  std::lock_guard<std::mutex> lk(formatter_mtx_);
+  formatter_ = std::make_unique<spdlog::pattern_formatter>(pattern);
+}
+
+void AsyncPythonSink::set_formatter(
+    std::unique_ptr<spdlog::formatter> formatter) {
+  std::lock_guard<std::mutex> lk(formatter_mtx_);
+  formatter_ = std::move(formatter);
+}
+
+void AsyncPythonSink::run() {
+  const std::size_t capacity = mask_ + 1;
+
+  std::unique_lock<std::mutex> lk(wake_mtx_);
+  while (true) {
+    wake_cv_.wait_for(lk, interval_, [this, capacity] {
+      return stop_ || flush_requested_ || size() >= capacity / 2;
+    });
+    const bool stop = stop_;
+    flush_requested_ = false;
+
+    lk.unlock();
+    drain();
+    lk.lock();
+
+    written_cv_.notify_all();
+    if (stop && size() == 0) break;
+  }
+}
+
+void AsyncPythonSink::drain() {
+  std::string batch;
+
+  {
+    std::lock_guard<std::mutex> lk(formatter_mtx_);
+
+    // Only this thread consumes, so the dequeue position needs no CAS
+    std::uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Entry& e = ring_[pos & mask_];
+      const std::uint64_t seq = e.seq.load(std::memory_order_acquire);
+      if (seq != pos + 1) break;
+
+      spdlog::details::log_msg msg(e.time, spdlog::source_loc{}, "", e.level,
+                                   e.payload);
+      msg.thread_id = e.thread_id;
+      spdlog::memory_buf_t formatted;
+      formatter_->format(msg, formatted);
+      batch.append(formatted.data(), formatted.size());
+
+      e.seq.store(pos + mask_ + 1, std::memory_order_release);
+      pos++;
+      dequeue_pos_.store(pos, std::memory_order_relaxed);
+    }
+
+    const std::size_t dropped = dropped_.exchange(0);
+    if (dropped > 0) {
+      const std::string mssg =
+          std::to_string(dropped) +
+          " debug messages dropped by the asynchronous logger.";
+      spdlog::details::log_msg msg(spdlog::source_loc{}, "",
+                                   spdlog::level::warn, mssg);
+      spdlog::memory_buf_t formatted;
+      formatter_->format(msg, formatted);
+      batch.append(formatted.data(), formatted.size());
+    }
+  }
+
+#ifdef SCARABEE_PYTHON
+  if (batch.empty() == false && Py_IsInitialized()) {
+    py::gil_scoped_acquire gil;
+    py::print(batch, py::arg("end") = "", py::arg("flush") = true);
+  }
+#else
+  if (batch.empty() == false) {
+    std::fwrite(batch.data(), 1, batch.size(), stdout);
+    std::fflush(stdout);
+  }
+#endif
+
+  written_.store(dequeue_pos_.load());
+}
+
 }  // namespace scarabee
@@ -0,0 +1,56 @@
+#include <utils/mapped_file.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace scarabee {
+
+MappedFile::MappedFile(const std::string& fname) {
+  if (std::filesystem::exists(fname) == false) {
+    const auto mssg = "The file \"" + fname + "\" does not exist.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  size_ = static_cast<std::size_t>(std::filesystem::file_size(fname));
+  if (size_ == 0) return;
+
+#if !defined(_WIN32)
+  const int fd = ::open(fname.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    void* ptr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (ptr != MAP_FAILED) {
+      data_ = static_cast<const char*>(ptr);
+      mapped_ = true;
+      return;
+    }
+  }
+#endif
+
+  // Could not map the file, so we read it instead
+  buffer_.resize(size_);
+  std::ifstream file(fname, std::ios_base::binary);
+  if (!file.read(buffer_.data(), static_cast<std::streamsize>(size_))) {
+    const auto mssg = "Could not read the file \"" + fname + "\".";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+  data_ = buffer_.data();
+}
+
+MappedFile::~MappedFile() {
+#if !defined(_WIN32)
+  if (mapped_) ::munmap(const_cast<char*>(data_), size_);
+#endif
+}
+
+}  // namespace scarabee
@@ -1,13 +1,23 @@
 #include <data/material.hpp>
+#include <data/cross_section_accumulator.hpp>
 #include <data/nd_library.hpp>
 #include <utils/constants.hpp>
 #include <utils/logging.hpp>
 #include <utils/nuclide_names.hpp>
+#include <utils/profiler.hpp>
 #include <utils/scarabee_exception.hpp>
+#include <utils/threads.hpp>
+
+#include <Eigen/Dense>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <map>
+#include <numeric>
+#include <optional>
 #include <sstream>
+#include <unordered_map>
 
 namespace scarabee {
 
@@ -23,18 +33,18 @@ void MaterialComposition::add_element(const std::string& name, double frac) {
   }
 
   // First, try to get list of natural isotopes
-  if (ELEMENT_ISOTOPES.find(name) == ELEMENT_ISOTOPES.end()) {
+  const auto isotopes = element_isotopes(name);
+  if (isotopes.empty()) {
     std::stringstream mssg;
     mssg << "Could not find element by name of \"" << name << "\".";
     spdlog::error(mssg.str());
     throw ScarabeeException(mssg.str());
   }
-  const auto& isotopes = ELEMENT_ISOTOPES.at(name);
 
   if (fractions == Fraction::Atoms) {
     // Just add all isotopes if we are using atom fractions
     for (const auto& iso : isotopes) {
-      this->add_nuclide(iso, NATURAL_ABUNDANCES.at(iso) * frac);
+      this->add_nuclide(std::string(iso), natural_abundance(iso) * frac);
     }
   } else {
     // Must convert to weight fractions
@@ -42,15 +52,15 @@ void MaterialComposition::add_element(const std::string& name, double frac) {
     // First, get atomic mass of element
     double elem_atomic_mass = 0.;
     for (const auto& iso : isotopes) {
-      elem_atomic_mass += ISOTOPE_MASSES.at(iso) * NATURAL_ABUNDANCES.at(iso);
+      elem_atomic_mass += isotope_mass(iso) * natural_abundance(iso);
     }
 
     // We can now get a mass abundance for each isotopes
     std::vector<double> mass_abundances(isotopes.size(), 0.);
     for (std::size_t i = 0; i < isotopes.size(); i++) {
       const auto& iso = isotopes[i];
-      mass_abundances[i] = NATURAL_ABUNDANCES.at(iso) * ISOTOPE_MASSES.at(iso) /
-                           elem_atomic_mass;
+      mass_abundances[i] =
+          natural_abundance(iso) * isotope_mass(iso) / elem_atomic_mass;
     }
 
     // Normalize the abundances
@@ -62,7 +72,7 @@ void MaterialComposition::add_element(const std::string& name, double frac) {
     // Add all isotopes
     for (std::size_t i = 0; i < isotopes.size(); i++) {
       const auto& iso = isotopes[i];
-      this->add_nuclide(iso, frac * mass_abundances[i]);
+      this->add_nuclide(std::string(iso), frac * mass_abundances[i]);
     }
   }
 }
@@ -106,7 +116,7 @@ void MaterialComposition::add_leu(double enrichment, double frac) {
   } else {
     // Must convert mass to number abundances
     for (std::size_t i = 0; i < 4; i++) {
-      abundances[i] /= ISOTOPE_MASSES.at(isotopes[i]);
+      abundances[i] /= isotope_mass(isotopes[i]);
     }
 
     const double sum_abundances =
@@ -175,6 +185,11 @@ Material::Material(const MaterialComposition& comp, double temp,
     throw ScarabeeException(mssg);
   }
 
+  // Resolve the nuclides in the library once, so that later lookups are only
+  // array accesses
+  nuclide_ids_ = this->nuclide_ids(*ndl);
+  ndl_uid_ = ndl->uid();
+
   // First, we get our density, assuming that it can be computed from the sum
   // of the fractions in the composition
   double frac_sum = 0.;
@@ -193,8 +208,9 @@ Material::Material(const MaterialComposition& comp, double temp,
 
   // Convert to Atoms fractions if necessary
   if (composition_.fractions == Fraction::Weight) {
-    for (auto& c : composition_.nuclides) {
-      const auto& nuc = ndl->get_nuclide(c.name);
+    for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+      auto& c = composition_.nuclides[i];
+      const auto& nuc = ndl->get_nuclide(nuclide_ids_[i]);
       c.fraction = c.fraction * average_molar_mass_ / (nuc.awr * N_MASS_AMU);
     }
   }
@@ -207,8 +223,9 @@ Material::Material(const MaterialComposition& comp, double temp,
   }
 
   // Check fissile and resonant, also get potential_xs
-  for (const auto& c : composition_.nuclides) {
-    const auto& nuc = ndl->get_nuclide(c.name);
+  for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+    const auto& c = composition_.nuclides[i];
+    const auto& nuc = ndl->get_nuclide(nuclide_ids_[i]);
     potential_xs_ += atoms_per_bcm_ * c.fraction * nuc.potential_xs;
 
     if (nuc.fissile) fissile_ = true;
@@ -253,6 +270,11 @@ Material::Material(const MaterialComposition& comp, double temp, double density,
     throw ScarabeeException(mssg);
   }
 
+  // Resolve the nuclides in the library once, so that later lookups are only
+  // array accesses
+  nuclide_ids_ = this->nuclide_ids(*ndl);
+  ndl_uid_ = ndl->uid();
+
   // First, we get our provided density
   if (du == DensityUnits::sum) {
     double frac_sum = 0.;
@@ -275,8 +297,9 @@ Material::Material(const MaterialComposition& comp, double temp, double density,
 
   // Convert to Atoms fractions if necessary
   if (composition_.fractions == Fraction::Weight) {
-    for (auto& c : composition_.nuclides) {
-      const auto& nuc = ndl->get_nuclide(c.name);
+    for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+      auto& c = composition_.nuclides[i];
+      const auto& nuc = ndl->get_nuclide(nuclide_ids_[i]);
       c.fraction = c.fraction * average_molar_mass_ / (nuc.awr * N_MASS_AMU);
     }
   }
@@ -289,8 +312,9 @@ Material::Material(const MaterialComposition& comp, double temp, double density,
   }
 
   // Check fissile and resonant, also get potential_xs
-  for (const auto& c : composition_.nuclides) {
-    const auto& nuc = ndl->get_nuclide(c.name);
+  for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+    const auto& c = composition_.nuclides[i];
+    const auto& nuc = ndl->get_nuclide(nuclide_ids_[i]);
     potential_xs_ += atoms_per_bcm_ * c.fraction * nuc.potential_xs;
 
     if (nuc.fissile) fissile_ = true;
@@ -306,6 +330,7 @@ void Material::set_temperature(double T) {
   }
 
   temperature_ = T;
+  version_++;
 }
 
 double Material::fissionable_grams_per_cm3() const {
@@ -332,7 +357,7 @@ double Material::fissionable_grams_per_cm3() const {
     }
 
     if (Z >= 90) {
-      const double AM = ISOTOPE_MASSES.at(comp.name);
+      const double AM = isotope_mass(comp.name);
       fiss_density += comp.fraction * AM;
     }
   }
@@ -366,8 +391,10 @@ bool Material::has_component(const std::string& name) const {
 double Material::calc_avg_molar_mass(const NDLibrary& ndl) const {
   double avg_mm = 0.;
 
-  for (const auto& comp : composition_.nuclides) {
-    const auto& nuc = ndl.get_nuclide(comp.name);
+  const auto ids = this->nuclide_ids(ndl);
+  for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+    const auto& comp = composition_.nuclides[i];
+    const auto& nuc = ndl.get_nuclide(ids[i]);
     if (composition_.fractions == Fraction::Atoms) {
       avg_mm += comp.fraction * nuc.awr * N_MASS_AMU;
     } else {
@@ -468,17 +495,17 @@ std::shared_ptr<CrossSection> Material::dilution_xs(
   this->initialize_inf_dil_xs(ndl, *max_l);
 
   // Go over all resonant groups
+  const auto ids = this->nuclide_ids(*ndl);
   for (std::size_t g = ndl->first_resonant_group();
        g <= ndl->last_resonant_group(); g++) {
     // Go over all RESONANT nuclides
     for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
-      const std::string& namei = composition_.nuclides[i].name;
-      const auto& nuc = ndl->get_nuclide(namei);
+      const auto& nuc = ndl->get_nuclide(ids[i]);
       if (nuc.resonant == false) continue;
 
       // Do XS interpolation
       const auto res_data_i =
-          ndl->dilution_xs(namei, g, temperature(), dils[i], *max_l);
+          ndl->dilution_xs(ids[i], g, temperature(), dils[i], *max_l);
 
       // Assign new values
       assign_resonant_xs(i, g, res_data_i);
@@ -514,21 +541,21 @@ std::shared_ptr<CrossSection> Material::ring_carlvik_xs(
   this->initialize_inf_dil_xs(ndl, *max_l);
 
   // Go over all resonant groups
+  const auto ids = this->nuclide_ids(*ndl);
   for (std::size_t g = ndl->first_resonant_group();
        g <= ndl->last_resonant_group(); g++) {
-    const double mat_pot_xs = this->lambda_pot_xs(ndl, g);
+    const double mat_pot_xs = this->lambda_pot_xs(*ndl, ids, g);
 
     // Go over all RESONANT nuclides
     for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
-      const std::string& namei = composition_.nuclides[i].name;
-      const auto& nuc = ndl->get_nuclide(namei);
+      const auto& nuc = ndl->get_nuclide(ids[i]);
       if (nuc.resonant == false) continue;
 
       const double Ni = atoms_per_bcm_ * composition_.nuclides[i].fraction;
 
       // Do XS interpolation
       const auto res_data_i =
-          ndl->ring_two_term_xs(namei, g, temperature(), a1, a2, b1, b2,
+          ndl->ring_two_term_xs(ids[i], g, temperature(), a1, a2, b1, b2,
                                 mat_pot_xs, Ni, Rfuel, Rin, Rout, *max_l);
 
       // Assign new values
@@ -546,14 +573,14 @@ std::shared_ptr<CrossSection> Material::two_term_xs(
   this->initialize_inf_dil_xs(ndl, max_l);
 
   // Go over all resonant groups
+  const auto ids = this->nuclide_ids(*ndl);
   for (std::size_t g = ndl->first_resonant_group();
        g <= ndl->last_resonant_group(); g++) {
-    const double mat_pot_xs = this->lambda_pot_xs(ndl, g);
+    const double mat_pot_xs = this->lambda_pot_xs(*ndl, ids, g);
 
     // Go over all RESONANT nuclides
     for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
-      const std::string& namei = composition_.nuclides[i].name;
-      const auto& nuc = ndl->get_nuclide(namei);
+      const auto& nuc = ndl->get_nuclide(ids[i]);
       if (nuc.resonant == false) continue;
 
       const double Ni = atoms_per_bcm_ * composition_.nuclides[i].fraction;
@@ -562,8 +589,8 @@ std::shared_ptr<CrossSection> Material::two_term_xs(
       const double bg_xs_2 = (mat_pot_xs - macro_pot_xs + a2 * Ee) / Ni;
 
       // Do XS interpolation
-      const auto res_data_i = ndl->two_term_xs(namei, g, temperature(), b1, b2,
-                                               bg_xs_1, bg_xs_2, max_l);
+      const auto res_data_i = ndl->two_term_xs(ids[i], g, temperature(), b1,
+                                               b2, bg_xs_1, bg_xs_2, max_l);
 
       // Assign new values
       assign_resonant_xs(i, g, res_data_i);
@@ -578,9 +605,10 @@ double Material::compute_fission_power_density(
     const std::shared_ptr<const NDLibrary> ndl) const {
   double pd = 0.;
 
+  const auto ids = this->nuclide_ids(*ndl);
   for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
     const auto& comp = composition_.nuclides[i];
-    const auto& nuc = ndl->get_nuclide(comp.name);
+    const auto& nuc = ndl->get_nuclide(ids[i]);
 
     if (nuc.fissile == false) continue;
 
@@ -607,131 +635,148 @@ double Material::compute_fission_power_density(
   return pd;
 }
 
-std::vector<DepletionReactionRates> Material::compute_depletion_reaction_rates(
-    std::span<const double> flux,
-    const std::shared_ptr<const NDLibrary> ndl) const {
-  if (this->has_depletion_micro_xs_data() == false) {
-    const auto mssg =
-        "No depletion cross section information is loaded in the material.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
+namespace {
+// Order of the reactions in the packed depletion xs
+enum DepletionReaction : std::size_t { NGamma, N2N, N3N, NP, NAlpha, NFission };
+
+const std::array<const char*, 6> DEPLETION_REACTION_NAMES{
+    "(n,gamma)", "(n,2n)", "(n,3n)", "(n,p)", "(n,alpha)", "(n,fission)"};
+
+const std::optional<XS1D>& depletion_reaction(const MicroDepletionXS& xs,
+                                              std::size_t r) {
+  switch (r) {
+    case NGamma:
+      return xs.n_gamma;
+    case N2N:
+      return xs.n_2n;
+    case N3N:
+      return xs.n_3n;
+    case NP:
+      return xs.n_p;
+    case NAlpha:
+      return xs.n_alpha;
+    default:
+      return xs.n_fission;
   }
+}
+}  // namespace
 
-  // Initialize vector to hold all nuclide reaction rates.
-  std::vector<DepletionReactionRates> dep_rrs;
-  dep_rrs.reserve(composition_.nuclides.size());
-
-  // Loop over all nuclides
-  for (std::size_t ni = 0; ni < composition_.nuclides.size(); ni++) {
-    // Add new reaction rate to the end
-    dep_rrs.emplace_back();
+Material::PackedDepletionXS Material::pack_depletion_xs(
+    const std::vector<MicroDepletionXS>& dep_xs) {
+  constexpr std::size_t NR = PackedDepletionXS::NREACTIONS;
+  const std::size_t nnuc = dep_xs.size();
 
-    // Save nuclide name and number density
-    dep_rrs.back().nuclide = composition_.nuclides[ni].name;
-    dep_rrs.back().number_density =
-        composition_.nuclides[ni].fraction * atoms_per_bcm_;
-
-    // Get the depletion xs object
-    const auto& nucxs = micro_dep_xs_data_[ni];
-
-    if (nucxs.n_gamma) {
-      const auto& xs = nucxs.n_gamma.value();
-      if (xs.ngroups() > flux.size()) {
-        const auto mssg =
-            "The number of (n,gamma) xs values exceeds the flux size.";
-        spdlog::error(mssg);
-        throw ScarabeeException(mssg);
-      }
+  PackedDepletionXS packed;
+  packed.has_fission.assign(nnuc, 0);
 
-      double& rr = dep_rrs.back().n_gamma;
-      for (std::size_t g = 0; g < xs.ngroups(); g++)
-        rr += xs.xs_fast(g) * flux[g];
-      rr *= CM2_PER_BARN;
+  std::size_t NG = 0;
+  for (std::size_t i = 0; i < nnuc; i++) {
+    for (std::size_t r = 0; r < NR; r++) {
+      const auto& xs = depletion_reaction(dep_xs[i], r);
+      if (xs) packed.ngroups[r] = std::max(packed.ngroups[r], xs->ngroups());
     }
+    packed.has_fission[i] = dep_xs[i].n_fission.has_value();
+  }
+  for (const auto ng : packed.ngroups) NG = std::max(NG, ng);
 
-    if (nucxs.n_2n) {
-      const auto& xs = nucxs.n_2n.value();
-      if (xs.ngroups() > flux.size()) {
-        const auto mssg =
-            "The number of (n,2n) xs values exceeds the flux size.";
-        spdlog::error(mssg);
-        throw ScarabeeException(mssg);
-      }
+  packed.xs = xt::xtensor<double, 2>::from_shape({NR * nnuc, NG});
+  packed.xs.fill(0.);
+  for (std::size_t r = 0; r < NR; r++) {
+    for (std::size_t i = 0; i < nnuc; i++) {
+      const auto& xs = depletion_reaction(dep_xs[i], r);
+      if (xs.has_value() == false) continue;
 
-      double& rr = dep_rrs.back().n_2n;
-      for (std::size_t g = 0; g < xs.ngroups(); g++)
-        rr += xs.xs_fast(g) * flux[g];
-      rr *= CM2_PER_BARN;
+      for (std::size_t g = 0; g < xs->ngroups(); g++) {
+        packed.xs(r * nnuc + i, g) = xs->xs_fast(g);
+      }
     }
+  }
 
-    if (nucxs.n_3n) {
-      const auto& xs = nucxs.n_3n.value();
-      if (xs.ngroups() > flux.size()) {
-        const auto mssg =
-            "The number of (n,3n) xs values exceeds the flux size.";
-        spdlog::error(mssg);
-        throw ScarabeeException(mssg);
-      }
+  return packed;
+}
 
-      double& rr = dep_rrs.back().n_3n;
-      for (std::size_t g = 0; g < xs.ngroups(); g++)
-        rr += xs.xs_fast(g) * flux[g];
-      rr *= CM2_PER_BARN;
-    }
+std::vector<DepletionReactionRates> Material::compute_depletion_reaction_rates(
+    std::span<const double> flux,
+    const std::shared_ptr<const NDLibrary> ndl) const {
+  std::vector<DepletionReactionRates> dep_rrs;
+  this->compute_depletion_reaction_rates(flux, *ndl, dep_rrs);
+  return dep_rrs;
+}
 
-    if (nucxs.n_p) {
-      const auto& xs = nucxs.n_p.value();
-      if (xs.ngroups() > flux.size()) {
-        const auto mssg =
-            "The number of (n,p) xs values exceeds the flux size.";
-        spdlog::error(mssg);
-        throw ScarabeeException(mssg);
-      }
+void Material::compute_depletion_reaction_rates(
+    std::span<const double> flux, const NDLibrary& ndl,
+    std::vector<DepletionReactionRates>& dep_rrs) const {
+  if (this->has_depletion_micro_xs_data() == false) {
+    const auto mssg =
+        "No depletion cross section information is loaded in the material.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
 
-      double& rr = dep_rrs.back().n_p;
-      for (std::size_t g = 0; g < xs.ngroups(); g++)
-        rr += xs.xs_fast(g) * flux[g];
-      rr *= CM2_PER_BARN;
-    }
+  constexpr std::size_t NR = PackedDepletionXS::NREACTIONS;
+  const std::size_t nnuc = composition_.nuclides.size();
 
-    if (nucxs.n_alpha) {
-      const auto& xs = nucxs.n_alpha.value();
-      if (xs.ngroups() > flux.size()) {
-        const auto mssg =
-            "The number of (n,alpha) xs values exceeds the flux size.";
-        spdlog::error(mssg);
-        throw ScarabeeException(mssg);
-      }
+  // The packed xs are only missing if the material was deserialized
+  std::optional<PackedDepletionXS> repacked;
+  if (packed_dep_xs_.xs.shape()[0] != NR * nnuc) {
+    repacked = pack_depletion_xs(micro_dep_xs_data_);
+  }
+  const PackedDepletionXS& packed = repacked ? *repacked : packed_dep_xs_;
 
-      double& rr = dep_rrs.back().n_alpha;
-      for (std::size_t g = 0; g < xs.ngroups(); g++)
-        rr += xs.xs_fast(g) * flux[g];
-      rr *= CM2_PER_BARN;
+  for (std::size_t r = 0; r < NR; r++) {
+    if (packed.ngroups[r] > flux.size()) {
+      const auto mssg = std::string("The number of ") +
+                        DEPLETION_REACTION_NAMES[r] +
+                        " xs values exceeds the flux size.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
     }
+  }
 
-    if (nucxs.n_fission) {
-      const auto& xs = nucxs.n_fission.value();
-      if (xs.ngroups() > flux.size()) {
-        const auto mssg =
-            "The number of (n,fission) xs values exceeds the flux size.";
-        spdlog::error(mssg);
-        throw ScarabeeException(mssg);
-      }
+  // All reaction rates with one product. The fission rates are also weighted
+  // by the midpoint energy of each group, for the average fission energy.
+  using RowMatrix =
+      Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const Eigen::Index NG = static_cast<Eigen::Index>(packed.xs.shape()[1]);
+  const Eigen::Index Nnuc = static_cast<Eigen::Index>(nnuc);
+  Eigen::Map<const RowMatrix> X(packed.xs.data(),
+                                static_cast<Eigen::Index>(NR) * Nnuc, NG);
+  Eigen::Map<const Eigen::VectorXd> flx(flux.data(), NG);
+  const Eigen::VectorXd rr = X * flx;
+
+  Eigen::VectorXd E_flx(NG);
+  for (Eigen::Index g = 0; g < NG; g++) {
+    const std::size_t gg = static_cast<std::size_t>(g);
+    E_flx(g) = std::sqrt(ndl.group_bounds()[gg] * ndl.group_bounds()[gg + 1]) *
+               flux[gg];
+  }
+  const Eigen::VectorXd Err =
+      X.middleRows(static_cast<Eigen::Index>(NFission) * Nnuc, Nnuc) * E_flx;
 
-      double& rr = dep_rrs.back().n_fission;
-      double Err = 0.;
-      for (std::size_t g = 0; g < xs.ngroups(); g++) {
-        const double Ef_flx_g = xs.xs_fast(g) * flux[g];
-        rr += Ef_flx_g;
-        Err += std::sqrt(ndl->group_bounds()[g] * ndl->group_bounds()[g + 1]) *
-               Ef_flx_g;
-      }
-      dep_rrs.back().average_fission_energy = Err / rr;
-      rr *= CM2_PER_BARN;
+  dep_rrs.resize(nnuc);
+  for (std::size_t i = 0; i < nnuc; i++) {
+    auto& out = dep_rrs[i];
+    auto rate = [&rr, nnuc, i](std::size_t r) {
+      return rr(static_cast<Eigen::Index>(r * nnuc + i));
+    };
+
+    // Save nuclide name and number density
+    out.nuclide = composition_.nuclides[i].name;
+    out.number_density = composition_.nuclides[i].fraction * atoms_per_bcm_;
+
+    out.n_gamma = rate(NGamma) * CM2_PER_BARN;
+    out.n_2n = rate(N2N) * CM2_PER_BARN;
+    out.n_3n = rate(N3N) * CM2_PER_BARN;
+    out.n_p = rate(NP) * CM2_PER_BARN;
+    out.n_alpha = rate(NAlpha) * CM2_PER_BARN;
+
+    out.n_fission = rate(NFission) * CM2_PER_BARN;
+    out.average_fission_energy = 0.;
+    if (packed.has_fission[i]) {
+      out.average_fission_energy =
+          Err(static_cast<Eigen::Index>(i)) / rate(NFission);
     }
   }
-
-  return dep_rrs;
 }
 
 void Material::assign_resonant_xs(const std::size_t i, const std::size_t g,
@@ -741,9 +786,11 @@ void Material::assign_resonant_xs(const std::size_t i, const std::size_t g,
   if (res_data.Ef != 0.) {
     micro_nuc_xs_data_[i].Ef.set_value(g, res_data.Ef);
     micro_dep_xs_data_[i].n_fission->set_value(g, res_data.Ef);
+    packed_dep_xs_.xs(NFission * size() + i, g) = res_data.Ef;
   }
   if (res_data.n_gamma) {
     micro_dep_xs_data_[i].n_gamma->set_value(g, res_data.n_gamma.value());
+    packed_dep_xs_.xs(NGamma * size() + i, g) = res_data.n_gamma.value();
   }
   for (std::size_t l = 0; l < res_data.Es.shape()[0]; l++) {
     for (std::size_t gg = 0; gg < res_data.Es.shape()[1]; gg++) {
@@ -756,51 +803,55 @@ void Material::assign_resonant_xs(const std::size_t i, const std::size_t g,
 }
 
 void Material::load_nuclides(std::shared_ptr<NDLibrary> ndl) const {
-  for (const auto& nuc : composition_.nuclides) {
-    auto& nuc_handle = ndl->get_nuclide(nuc.name);
-    nuc_handle.load_xs_from_hdf5(*ndl, max_l_);
+  for (const auto id : this->nuclide_ids(*ndl)) {
+    ndl->get_nuclide(id).load_xs_from_hdf5(*ndl, max_l_);
   }
 }
 
-std::shared_ptr<CrossSection> Material::create_xs_from_micro_data() {
-  std::shared_ptr<CrossSection> xsout{nullptr};
+std::vector<std::size_t> Material::nuclide_ids(const NDLibrary& ndl) const {
+  if (ndl.uid() == ndl_uid_ && nuclide_ids_.size() == composition_.nuclides.size()) {
+    return nuclide_ids_;
+  }
 
-  for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
-    std::shared_ptr<CrossSection> xsi{nullptr};
+  std::vector<std::size_t> ids;
+  ids.reserve(composition_.nuclides.size());
+  for (const auto& c : composition_.nuclides) {
+    ids.push_back(ndl.nuclide_id(c.name));
+  }
+  return ids;
+}
 
-    const double Ni = atoms_per_bcm_ * composition_.nuclides[i].fraction;
+std::shared_ptr<CrossSection> Material::create_xs_from_micro_data() {
+  SCARABEE_PROFILE_ZONE("Material::create_xs_from_micro_data");
 
-    xsi = std::make_shared<CrossSection>(
-        micro_nuc_xs_data_[i].Et, micro_nuc_xs_data_[i].Dtr,
-        micro_nuc_xs_data_[i].Ea, micro_nuc_xs_data_[i].Es,
-        micro_nuc_xs_data_[i].Ef,
-        micro_nuc_xs_data_[i].nu * micro_nuc_xs_data_[i].Ef,
-        micro_nuc_xs_data_[i].chi);
-    (*xsi) *= Ni;
+  // The scattering bands of all nuclides are merged before adding any of
+  // them, so that the packed matrix is only allocated once
+  CrossSectionAccumulator xs(micro_nuc_xs_data_.front().Es.ngroups());
+  for (const auto& micro_xs : micro_nuc_xs_data_) xs.reserve(micro_xs.Es);
 
-    if (xsout) {
-      (*xsout) += (*xsi);
-    } else {
-      xsout = xsi;
-    }
+  for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+    const double Ni = atoms_per_bcm_ * composition_.nuclides[i].fraction;
+    xs.add(Ni, micro_nuc_xs_data_[i]);
   }
 
-  xsout->set_name(this->name_);
-  return xsout;
+  return xs.cross_section(this->name_);
 }
 
-double Material::lambda_pot_xs(std::shared_ptr<NDLibrary> ndl, std::size_t g) {
+double Material::lambda_pot_xs(const NDLibrary& ndl,
+                               const std::vector<std::size_t>& ids,
+                               std::size_t g) const {
   double lmbd_pot_xs = 0.;
 
-  if (g >= ndl->ngroups()) {
+  if (g >= ndl.ngroups()) {
     std::stringstream mssg;
     mssg << "Group index " << g << " is out of range.";
     spdlog::error(mssg.str());
     throw ScarabeeException(mssg.str());
   }
 
-  for (const auto& c : composition_.nuclides) {
-    const auto& nuc = ndl->get_nuclide(c.name);
+  for (std::size_t i = 0; i < composition_.nuclides.size(); i++) {
+    const auto& c = composition_.nuclides[i];
+    const auto& nuc = ndl.get_nuclide(ids[i]);
     lmbd_pot_xs +=
         atoms_per_bcm_ * c.fraction * nuc.ir_lambda[g] * nuc.potential_xs;
   }
@@ -816,6 +867,7 @@ void Material::clear_transport_micro_xs_data() {
 void Material::clear_depletion_micro_xs_data() {
   micro_dep_xs_data_.clear();
   micro_dep_xs_data_.shrink_to_fit();
+  packed_dep_xs_ = PackedDepletionXS();
 }
 
 void Material::clear_all_micro_xs_data() {
@@ -829,18 +881,94 @@ void Material::initialize_inf_dil_xs(std::shared_ptr<NDLibrary> ndl,
   micro_nuc_xs_data_.reserve(composition_.nuclides.size());
   micro_dep_xs_data_.reserve(composition_.nuclides.size());
 
-  for (const auto& nuc : composition_.nuclides) {
-    auto tmp = ndl->infinite_dilution_xs(nuc.name, temperature_, max_l);
+  for (const auto id : this->nuclide_ids(*ndl)) {
+    auto tmp = ndl->infinite_dilution_xs(id, temperature_, max_l);
     micro_nuc_xs_data_.push_back(tmp.first);
     micro_dep_xs_data_.push_back(tmp.second);
   }
+
+  packed_dep_xs_ = pack_depletion_xs(micro_dep_xs_data_);
+}
+
+std::vector<std::shared_ptr<CrossSection>> self_shield_materials(
+    const std::vector<SelfShieldingRequest>& requests,
+    std::shared_ptr<NDLibrary> ndl) {
+  SCARABEE_PROFILE_ZONE("self_shield_materials");
+
+  if (ndl == nullptr) {
+    auto mssg = "NDLibrary is None.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Group requests by material, keeping their order within a group
+  std::vector<std::vector<std::size_t>> groups;
+  std::unordered_map<const Material*, std::size_t> group_of_material;
+  for (std::size_t r = 0; r < requests.size(); r++) {
+    const auto& req = requests[r];
+    if (req.material == nullptr) {
+      std::stringstream mssg;
+      mssg << "The material of self-shielding request " << r << " is None.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+
+    auto [it, inserted] =
+        group_of_material.try_emplace(req.material.get(), groups.size());
+    if (inserted) {
+      groups.emplace_back();
+      // Reading the nuclides now keeps the HDF5 file out of the parallel
+      // region, where it could only be accessed by one thread at a time.
+      req.material->load_nuclides(ndl);
+    }
+    groups[it->second].push_back(r);
+  }
+
+  std::vector<std::shared_ptr<CrossSection>> xs(requests.size(), nullptr);
+  parallel_for_each_index(groups.size(), [&](std::size_t grp) {
+    for (const std::size_t r : groups[grp]) {
+      const auto& req = requests[r];
+      auto& mat = *req.material;
+
+      switch (req.method) {
+        case SelfShieldingMethod::Dilution:
+          xs[r] = mat.dilution_xs(req.dils, ndl, req.max_l);
+          break;
+
+        case SelfShieldingMethod::Roman:
+          xs[r] = mat.roman_xs(req.C, req.Ee, ndl, req.max_l);
+          break;
+
+        case SelfShieldingMethod::Carlvik:
+          xs[r] = mat.carlvik_xs(req.C, req.Ee, ndl, req.max_l);
+          break;
+
+        case SelfShieldingMethod::RingCarlvik:
+          xs[r] = mat.ring_carlvik_xs(req.C, req.Rfuel, req.Rin, req.Rout, ndl,
+                                      req.max_l);
+          break;
+      }
+    }
+  });
+
+  return xs;
 }
 
 std::shared_ptr<Material> mix_materials(
     const std::vector<std::shared_ptr<Material>>& mats,
     std::vector<double> fracs, MixingFraction f,
     std::shared_ptr<NDLibrary> ndl) {
+  xt::xtensor<double, 2> batch_fracs({1, fracs.size()});
+  std::copy(fracs.begin(), fracs.end(), batch_fracs.begin());
+  return mix_materials_batch(mats, batch_fracs, f, ndl).front();
+}
+
+std::vector<std::shared_ptr<Material>> mix_materials_batch(
+    const std::vector<std::shared_ptr<Material>>& mats,
+    const xt::xtensor<double, 2>& fracs, MixingFraction f,
+    std::shared_ptr<NDLibrary> ndl) {
   /* This method was directly taken from OpenMC's Python API. */
+  SCARABEE_PROFILE_ZONE("mix_materials_batch");
 
   // Make sure all fractions are positive
   for (const auto& v : fracs) {
@@ -860,13 +988,13 @@ std::shared_ptr<Material> mix_materials(
     }
   }
 
-  if (fracs.size() != mats.size()) {
+  if (fracs.shape()[1] != mats.size()) {
     auto mssg = "Materials and fractions lists must have same length.";
     spdlog::error(mssg);
     throw ScarabeeException(mssg);
   }
 
-  if (fracs.size() == 0) {
+  if (mats.size() == 0) {
     auto mssg = "Materials and fractions lists must have a length > 0.";
     spdlog::error(mssg);
     throw ScarabeeException(mssg);
@@ -878,62 +1006,42 @@ std::shared_ptr<Material> mix_materials(
     throw ScarabeeException(mssg);
   }
 
-  // First, we normalize the fractions
-  double norm = std::accumulate(fracs.begin(), fracs.end(), 0.);
-  if (norm == 0.) {
-    auto mssg = "Sum of material fractions must be > 0.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
-  for (auto& v : fracs) v /= norm;
-
-  std::vector<double> wgts(mats.size(), 0.);
-
-  for (std::size_t m = 0; m < mats.size(); m++) {
-    if (f == MixingFraction::Atoms) {
-      wgts[m] =
-          fracs[m] * mats[m]->average_molar_mass() / mats[m]->grams_per_cm3();
-    } else if (f == MixingFraction::Weight) {
-      wgts[m] = fracs[m] / mats[m]->grams_per_cm3();
-    } else {
-      // Volume
-      wgts[m] = fracs[m];
+  // The nuclides of all materials are merged once, by their ID in the
+  // library, and sorted by name. Each material then only adds its atom
+  // densities to a buffer indexed by merged nuclide, which is reused for
+  // all mixtures.
+  std::unordered_map<std::size_t, std::string> merged_names;
+  for (const auto& mat : mats) {
+    for (const auto& nuc : mat->composition().nuclides) {
+      merged_names.emplace(ndl->nuclide_id(nuc.name), nuc.name);
     }
   }
 
-  // Normalize weights
-  norm = std::accumulate(wgts.begin(), wgts.end(), 0.);
-  for (auto& v : wgts) v /= norm;
-
-  // Compute average temperature
-  double avg_T = 0.;
-  for (std::size_t m = 0; m < mats.size(); m++) {
-    avg_T += wgts[m] * mats[m]->temperature();
+  std::vector<std::string> names;
+  names.reserve(merged_names.size());
+  for (const auto& id_name : merged_names) names.push_back(id_name.second);
+  std::sort(names.begin(), names.end());
+
+  std::unordered_map<std::size_t, std::size_t> merged_indx;
+  std::vector<double> grams_per_atom(names.size());
+  for (std::size_t n = 0; n < names.size(); n++) {
+    merged_indx[ndl->nuclide_id(names[n])] = n;
+    const std::string simp_name = nuclide_name_to_internal_name(names[n]);
+    grams_per_atom[n] = isotope_mass(simp_name) / (N_AVAGADRO * 1.E24);
   }
 
-  std::map<std::string, double> atoms_per_cc;
-  std::map<std::string, double> mass_per_cc;
+  // Merged index and atom density of each nuclide of each material
+  std::vector<std::vector<std::pair<std::size_t, double>>> densities(
+      mats.size());
   for (std::size_t m = 0; m < mats.size(); m++) {
-    const auto& mat = mats[m];
-    const double wgt = wgts[m];
-
-    for (std::size_t n = 0; n < mat->composition().nuclides.size(); n++) {
-      const auto& nuc_info = mat->composition().nuclides[n];
-      const std::string nuc_name = nuc_info.name;
-      const std::string simp_name = nuclide_name_to_internal_name(nuc_name);
-      const double atms_per_bcm = mat->atom_density(nuc_name);
-      const double atms_per_cc = wgt * 1.E24 * atms_per_bcm;
-      atoms_per_cc[nuc_name] += atms_per_cc;
-      mass_per_cc[nuc_name] +=
-          atms_per_cc * ISOTOPE_MASSES.at(simp_name) / (N_AVAGADRO * 1.E24);
+    const auto& mat = *mats[m];
+    densities[m].reserve(mat.size());
+    for (const auto& nuc : mat.composition().nuclides) {
+      densities[m].emplace_back(merged_indx[ndl->nuclide_id(nuc.name)],
+                                mat.atom_density(nuc.name));
     }
   }
 
-  double tot_atoms_per_cc = 0.;
-  for (const auto& nuc : atoms_per_cc) tot_atoms_per_cc += nuc.second;
-  double density = 0.;
-  for (const auto& nuc : mass_per_cc) density += nuc.second;
-
   // Create material name
   std::string new_name("");
   for (std::size_t m = 0; m < mats.size(); m++) {
@@ -944,15 +1052,80 @@ std::shared_ptr<Material> mix_materials(
     }
   }
 
-  // Make new material
-  MaterialComposition new_mat_comp(Fraction::Atoms, new_name);
-  for (const auto& name_N_pair : atoms_per_cc) {
-    new_mat_comp.add_nuclide(name_N_pair.first,
-                             name_N_pair.second / tot_atoms_per_cc);
+  const std::size_t NM = fracs.shape()[0];
+  std::vector<std::shared_ptr<Material>> out;
+  out.reserve(NM);
+  std::vector<double> wgts(mats.size(), 0.);
+  std::vector<double> atoms_per_cc(names.size(), 0.);
+  for (std::size_t x = 0; x < NM; x++) {
+    // First, we normalize the fractions
+    double norm = 0.;
+    for (std::size_t m = 0; m < mats.size(); m++) norm += fracs(x, m);
+    if (norm == 0.) {
+      auto mssg = "Sum of material fractions must be > 0.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    for (std::size_t m = 0; m < mats.size(); m++) {
+      const double frac = fracs(x, m) / norm;
+      if (f == MixingFraction::Atoms) {
+        wgts[m] =
+            frac * mats[m]->average_molar_mass() / mats[m]->grams_per_cm3();
+      } else if (f == MixingFraction::Weight) {
+        wgts[m] = frac / mats[m]->grams_per_cm3();
+      } else {
+        // Volume
+        wgts[m] = frac;
+      }
+    }
+
+    // Normalize weights
+    norm = std::accumulate(wgts.begin(), wgts.end(), 0.);
+    for (auto& v : wgts) v /= norm;
+
+    // Compute average temperature
+    double avg_T = 0.;
+    for (std::size_t m = 0; m < mats.size(); m++) {
+      avg_T += wgts[m] * mats[m]->temperature();
+    }
+
+    std::fill(atoms_per_cc.begin(), atoms_per_cc.end(), 0.);
+    for (std::size_t m = 0; m < mats.size(); m++) {
+      for (const auto& [n, atms_per_bcm] : densities[m]) {
+        atoms_per_cc[n] += wgts[m] * 1.E24 * atms_per_bcm;
+      }
+    }
+
+    double tot_atoms_per_cc = 0.;
+    double density = 0.;
+    for (std::size_t n = 0; n < names.size(); n++) {
+      tot_atoms_per_cc += atoms_per_cc[n];
+      density += atoms_per_cc[n] * grams_per_atom[n];
+    }
+
+    // Make new material. Nuclides missing from all materials with a nonzero
+    // fraction are left out.
+    MaterialComposition new_mat_comp(Fraction::Atoms, new_name);
+    new_mat_comp.nuclides.reserve(names.size());
+    for (std::size_t n = 0; n < names.size(); n++) {
+      if (atoms_per_cc[n] == 0.) continue;
+      new_mat_comp.add_nuclide(names[n], atoms_per_cc[n] / tot_atoms_per_cc);
+    }
+
+    out.push_back(std::make_shared<Material>(new_mat_comp, avg_T, density,
+                                             DensityUnits::g_cm3, ndl));
   }
 
-  return std::make_shared<Material>(new_mat_comp, avg_T, density,
-                                    DensityUnits::g_cm3, ndl);
+  return out;
+}
+
+std::string Material::to_bytes() const { return save_to_bytes(*this); }
+
+std::shared_ptr<Material> Material::from_bytes(const std::string& data) {
+  std::shared_ptr<Material> out(new Material());
+  load_from_bytes(data, *out);
+  return out;
 }
 
 }  // namespace scarabee
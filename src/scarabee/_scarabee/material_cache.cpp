@@ -0,0 +1,184 @@
+#include <data/material_cache.hpp>
+#include <data/nd_library.hpp>
+#include <data/water.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+namespace scarabee {
+
+MaterialCache::MaterialCache(std::size_t capacity, double tolerance)
+    : capacity_(0), tol_(0.) {
+  this->set_capacity(capacity);
+  this->set_tolerance(tolerance);
+}
+
+std::shared_ptr<Material> MaterialCache::borated_water(
+    double boron_ppm, double temperature, double pressure,
+    std::shared_ptr<NDLibrary> ndl) {
+  if (ndl == nullptr) {
+    auto mssg = "Provided NDLibrary is nullptr.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  Key key{0, ndl->uid(), {}, {}, {}};
+  const std::array<double, 3> params{boron_ppm, temperature, pressure};
+  this->quantize(key, params);
+
+  auto mat = this->find(key);
+  if (mat) return mat;
+
+  mat = scarabee::borated_water(boron_ppm, temperature, pressure, ndl);
+  this->insert(std::move(key), mat, {});
+  return mat;
+}
+
+std::shared_ptr<Material> MaterialCache::mix_materials(
+    const std::vector<std::shared_ptr<Material>>& mats,
+    const std::vector<double>& fracs, MixingFraction f,
+    std::shared_ptr<NDLibrary> ndl) {
+  // Invalid arguments are left for mix_materials to report, without being
+  // cached
+  double norm = 0.;
+  for (const auto v : fracs) norm += v;
+  bool valid = ndl != nullptr && fracs.size() == mats.size() && norm > 0.;
+  for (const auto& m : mats) valid = valid && m != nullptr;
+  if (valid == false) return scarabee::mix_materials(mats, fracs, f, ndl);
+
+  Key key{1, ndl->uid(), {}, {}, {}};
+  key.mats.reserve(mats.size());
+  key.versions.reserve(mats.size() + 1);
+  key.versions.push_back(static_cast<std::uint64_t>(f));
+  for (const auto& m : mats) {
+    key.mats.push_back(m.get());
+    key.versions.push_back(m->version());
+  }
+
+  // Fractions are compared once normalized
+  std::vector<double> norm_fracs(fracs);
+  for (auto& v : norm_fracs) v /= norm;
+  this->quantize(key, norm_fracs);
+
+  auto mat = this->find(key);
+  if (mat) return mat;
+
+  mat = scarabee::mix_materials(mats, fracs, f, ndl);
+  this->insert(std::move(key), mat, mats);
+  return mat;
+}
+
+void MaterialCache::set_capacity(std::size_t capacity) {
+  if (capacity == 0) {
+    auto mssg = "Material cache capacity must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::lock_guard<std::mutex> lock(mtx_);
+  capacity_ = capacity;
+  this->evict();
+}
+
+void MaterialCache::set_tolerance(double tol) {
+  if (tol < 0. || tol >= 1.) {
+    auto mssg = "Material cache tolerance must be in [0, 1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Keys quantized with the old tolerance are no longer comparable
+  tol_ = tol;
+  this->clear();
+}
+
+std::size_t MaterialCache::size() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return entries_.size();
+}
+
+std::size_t MaterialCache::hits() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return hits_;
+}
+
+void MaterialCache::clear() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  map_.clear();
+  entries_.clear();
+  hits_ = 0;
+}
+
+std::size_t MaterialCache::KeyHash::operator()(const Key& key) const {
+  std::size_t h = std::hash<std::uint64_t>{}(key.ndl_uid);
+  const auto combine = [&h](std::size_t v) {
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+  };
+  combine(key.kind);
+  for (const auto m : key.mats) combine(std::hash<const Material*>{}(m));
+  for (const auto v : key.versions) combine(std::hash<std::uint64_t>{}(v));
+  for (const auto p : key.params) combine(std::hash<std::int64_t>{}(p));
+  return h;
+}
+
+void MaterialCache::quantize(Key& key, std::span<const double> params) const {
+  key.params.reserve(params.size());
+
+  // Same rounding as the cross section cache of NDLibrary, to bins of
+  // logarithmic width, with zero and infinite values given their own keys
+  const double log_width = std::log1p(tol_);
+  for (const double x : params) {
+    std::int64_t q;
+    if (tol_ == 0.) {
+      std::memcpy(&q, &x, sizeof(q));
+    } else if (x == 0.) {
+      q = 2;
+    } else if (std::isfinite(x) == false) {
+      q = x > 0. ? 3 : 6;
+    } else {
+      q = 4 * std::llround(std::log(std::abs(x)) / log_width);
+      if (x < 0.) q++;
+    }
+    key.params.push_back(q);
+  }
+}
+
+std::shared_ptr<Material> MaterialCache::find(const Key& key) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto it = map_.find(key);
+  if (it == map_.end()) return nullptr;
+
+  entries_.splice(entries_.begin(), entries_, it->second);
+  hits_++;
+  return it->second->material;
+}
+
+void MaterialCache::insert(Key&& key, std::shared_ptr<Material> material,
+                           std::vector<std::shared_ptr<Material>> components) {
+  std::lock_guard<std::mutex> lock(mtx_);
+
+  // Another thread may have made the same material in the meantime
+  auto it = map_.find(key);
+  if (it != map_.end()) {
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+
+  entries_.push_front(Entry{key, std::move(material), std::move(components)});
+  map_.emplace(std::move(key), entries_.begin());
+  this->evict();
+}
+
+void MaterialCache::evict() {
+  while (entries_.size() > capacity_) {
+    map_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace scarabee
@@ -3,7 +3,9 @@
 #include <utils/constants.hpp>
 #include <utils/gauss_kronrod.hpp>
 #include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 
@@ -14,6 +16,42 @@ double exp(double x) {
   return std::exp(x);
 }
 
+LinearSourceExp linear_source_exp(double tau) {
+  LinearSourceExp e;
+  e.F1 = -std::expm1(-tau);
+
+  if (tau < 0.25) {
+    // F2 / tau^3 is the sum of c_m tau^(m-3) for m >= 3, with
+    // c_m = (-1)^(m+1) (m - 2) / m!, from which the series of G4 follows.
+    double inv_fact = 1. / 6.;
+    double sign = 1.;
+    double c_prev = 0.;
+    double tpow = 1.;
+    double tpow_prev = 0.;
+    e.E3 = 0.;
+    e.G4 = 0.;
+    for (int m = 3; m < 18; m++) {
+      const double c = sign * static_cast<double>(m - 2) * inv_fact;
+      e.E3 += c * tpow;
+      if (m >= 5) e.G4 += (-0.5 * c - 0.25 * c_prev) * tpow_prev;
+      c_prev = c;
+      tpow_prev = tpow;
+      tpow *= tau;
+      sign = -sign;
+      inv_fact /= static_cast<double>(m + 1);
+    }
+    e.E3 *= 0.5;
+  } else {
+    const double F2 = 2. * (tau - e.F1) - tau * e.F1;
+    const double tau2 = tau * tau;
+    e.E3 = 0.5 * F2 / (tau2 * tau);
+    e.G4 = (tau2 * tau / 12. - 0.25 * (2. + tau) * F2) / (tau2 * tau2);
+  }
+  e.E2 = tau * e.E3;
+
+  return e;
+}
+
 double Ki3(double x) {
   if (x < 1.) {
     constexpr double a{0x0p+0};  // a = 0.000000
@@ -243,16 +281,33 @@ double derivative_legendre(unsigned int order, unsigned int n, double x) {
 }
 
 double assoc_legendre(unsigned int order, int j, double x) {
-  unsigned int abs_j = std::abs(j);
-  const double associated_l = derivative_legendre(order, abs_j, x);
-  double factor = std::pow(-1., abs_j) *
-                  std::pow(1. - x * x, static_cast<double>(abs_j) / 2);
+  const unsigned int abs_j = static_cast<unsigned int>(std::abs(j));
+  if (abs_j > order) return 0.;
+
+  // Upward recurrence in l from P_|j|^|j|, which includes the Condon-Shortley
+  // phase, in place of the derivatives of P_l
+  const double s = std::sqrt(std::max(0., 1. - x * x));
+  double p_mm = 1.;
+  for (unsigned int m = 1; m <= abs_j; m++) {
+    p_mm *= -static_cast<double>(2 * m - 1) * s;
+  }
 
+  double p_lm2 = 0.;
+  double p_lm1 = p_mm;
+  for (unsigned int l = abs_j + 1; l <= order; l++) {
+    const double p_l = (static_cast<double>(2 * l - 1) * x * p_lm1 -
+                        static_cast<double>(l + abs_j - 1) * p_lm2) /
+                       static_cast<double>(l - abs_j);
+    p_lm2 = p_lm1;
+    p_lm1 = p_l;
+  }
+
+  double factor = 1.;
   if (j < 0) {
-    factor *=
-        std::pow(-1., j) * factorial(order - abs_j) / factorial(order + abs_j);
+    factor = std::pow(-1., j) * factorial(order - abs_j) /
+             factorial(order + abs_j);
   }
-  return factor * associated_l;
+  return factor * p_lm1;
 }
 
 double spherical_hamonics(unsigned int l, int j, double phi, double theta) {
@@ -282,4 +337,76 @@ double spherical_hamonics(unsigned int l, int j, double phi, double theta) {
   return 0.;
 }
 
+void legendre_table(unsigned int L, double x, std::span<double> P) {
+  P[0] = 1.;
+  if (L == 0) return;
+  P[1] = x;
+  for (unsigned int l = 2; l <= L; l++) {
+    const double dl = static_cast<double>(l);
+    P[l] = ((2. * dl - 1.) * x * P[l - 1] - (dl - 1.) * P[l - 2]) / dl;
+  }
+}
+
+void spherical_harmonics_table(unsigned int L, double phi, double theta,
+                               std::span<double> Y) {
+  const double u = std::cos(theta);
+  const double s = std::sqrt(std::max(0., 1. - u * u));
+
+  // Associated Legendre functions P_l^m(u) for 0 <= m <= l, at l(l+1)/2 + m
+  std::vector<double> P((L + 1) * (L + 2) / 2, 0.);
+  auto indx = [](unsigned int l, unsigned int m) {
+    return static_cast<std::size_t>(l) * (l + 1) / 2 + m;
+  };
+  for (unsigned int m = 0; m <= L; m++) {
+    const double dm = static_cast<double>(m);
+    const double p_mm =
+        m == 0 ? 1. : -(2. * dm - 1.) * s * P[indx(m - 1, m - 1)];
+    P[indx(m, m)] = p_mm;
+    if (m + 1 <= L) P[indx(m + 1, m)] = (2. * dm + 1.) * u * p_mm;
+    for (unsigned int l = m + 2; l <= L; l++) {
+      P[indx(l, m)] = (static_cast<double>(2 * l - 1) * u * P[indx(l - 1, m)] -
+                       static_cast<double>(l + m - 1) * P[indx(l - 2, m)]) /
+                      static_cast<double>(l - m);
+    }
+  }
+
+  std::vector<double> cos_m(L + 1), sin_m(L + 1);
+  for (unsigned int m = 0; m <= L; m++) {
+    cos_m[m] = std::cos(static_cast<double>(m) * phi);
+    sin_m[m] = std::sin(static_cast<double>(m) * phi);
+  }
+
+  for (unsigned int l = 0; l <= L; l++) {
+    const double dl = static_cast<double>(l);
+    const std::size_t l0 = static_cast<std::size_t>(l) * (l + 1);
+    Y[l0] = std::sqrt((2. * dl + 1.) / (4. * PI)) * P[indx(l, 0)];
+    for (unsigned int m = 1; m <= l; m++) {
+      const double norm = std::sqrt((2. * dl + 1.) * factorial(l - m) /
+                                    (2. * PI * factorial(l + m)));
+      const double Plm = norm * P[indx(l, m)];
+      Y[l0 + m] = Plm * cos_m[m];
+      Y[l0 - m] = Plm * sin_m[m];
+    }
+  }
+}
+
+std::vector<double> lagrange_weights(const std::vector<double>& x,
+                                     double x0) {
+  std::vector<double> w(x.size(), 1.);
+  for (std::size_t k = 0; k < x.size(); k++) {
+    for (std::size_t j = 0; j < x.size(); j++) {
+      if (j == k) continue;
+
+      if (x[k] == x[j]) {
+        const auto mssg = "Interpolation points must be distinct.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+
+      w[k] *= (x0 - x[j]) / (x[k] - x[j]);
+    }
+  }
+  return w;
+}
+
 }  // namespace scarabee
@@ -0,0 +1,20 @@
+#include <utils/memory_usage.hpp>
+#include <utils/logging.hpp>
+
+#include <string>
+
+namespace scarabee {
+
+void log_memory_usage(const std::string& name, const MemoryUsage& usage) {
+  constexpr double MB = 1024. * 1024.;
+
+  spdlog::info("{} memory usage: {:.1f} MB", name,
+               static_cast<double>(total_bytes(usage)) / MB);
+  for (const auto& [component, bytes] : usage) {
+    if (bytes == 0) continue;
+    spdlog::info("     {:<16} {:.1f} MB", component + ":",
+                 static_cast<double>(bytes) / MB);
+  }
+}
+
+}  // namespace scarabee
@@ -0,0 +1,494 @@
+#include <moc/moc_2d1d_driver.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/threads.hpp>
+#include <utils/timer.hpp>
+#include <utils/profiler.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+
+namespace scarabee {
+
+MOC2D1DDriver::MOC2D1DDriver(
+    const std::vector<std::shared_ptr<Cartesian2D>>& planes,
+    const std::vector<double>& dz, const std::vector<double>& dx,
+    const std::vector<double>& dy, BoundaryCondition xmin,
+    BoundaryCondition xmax, BoundaryCondition ymin, BoundaryCondition ymax,
+    BoundaryCondition zmin, BoundaryCondition zmax)
+    : planes_(),
+      dz_(dz),
+      dx_(dx),
+      dy_(dy),
+      channel_fsrs_(),
+      channel_flux_(),
+      radial_leak_(),
+      axial_current_(),
+      axial_flux_(),
+      ngroups_(0),
+      z_min_bc_(zmin),
+      z_max_bc_(zmax) {
+  if (planes.empty()) {
+    const auto mssg = "A 2D/1D problem must have at least one plane.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (dz_.size() != planes.size()) {
+    const auto mssg = "The number of plane heights and of planes disagree.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (const double h : dz_) {
+    if (h <= 0.) {
+      const auto mssg = "Plane heights must be > 0.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  if (zmin == BoundaryCondition::Periodic ||
+      zmax == BoundaryCondition::Periodic) {
+    const auto mssg =
+        "The z boundaries of a 2D/1D problem must be reflective or vacuum.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (dx_.empty() || dy_.empty()) {
+    const auto mssg = "The channel mesh must have at least one cell.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (const auto& geom : planes) {
+    if (geom == nullptr) {
+      const auto mssg = "The geometry of a plane is None.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  // All planes must cover the same area, which the channel mesh fills
+  const auto& ref = *planes.front();
+  const double width = ref.x_max() - ref.x_min();
+  const double height = ref.y_max() - ref.y_min();
+  for (const auto& geom : planes) {
+    if (std::abs(geom->x_min() - ref.x_min()) > 1.E-10 * width ||
+        std::abs(geom->x_max() - ref.x_max()) > 1.E-10 * width ||
+        std::abs(geom->y_min() - ref.y_min()) > 1.E-10 * height ||
+        std::abs(geom->y_max() - ref.y_max()) > 1.E-10 * height) {
+      const auto mssg = "All planes must have the same radial extent.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  const double mesh_width = std::accumulate(dx_.begin(), dx_.end(), 0.);
+  const double mesh_height = std::accumulate(dy_.begin(), dy_.end(), 0.);
+  if (std::abs(mesh_width - width) > 1.E-8 * width ||
+      std::abs(mesh_height - height) > 1.E-8 * height) {
+    const auto mssg = "The channel mesh must cover the planes exactly.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  planes_.reserve(planes.size());
+  for (const auto& geom : planes) {
+    planes_.push_back(
+        std::make_shared<MOCDriver>(geom, xmin, xmax, ymin, ymax));
+    planes_.back()->set_share_tracks(true);
+  }
+
+  ngroups_ = planes_.front()->ngroups();
+  for (const auto& plane : planes_) {
+    if (plane->ngroups() != ngroups_) {
+      const auto mssg = "All planes must have the same number of groups.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+}
+
+const std::shared_ptr<MOCDriver>& MOC2D1DDriver::plane(std::size_t p) const {
+  if (p >= planes_.size()) {
+    std::stringstream mssg;
+    mssg << "Plane index " << p << " is out of range.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  return planes_[p];
+}
+
+const std::vector<std::size_t>& MOC2D1DDriver::channel_fsrs(
+    std::size_t p, std::size_t c) const {
+  if (this->drawn() == false) {
+    const auto mssg = "The channels are only known once tracks are generated.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (p >= planes_.size() || c >= this->nchannels()) {
+    const auto mssg = "Plane or channel index is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  return channel_fsrs_[p][c];
+}
+
+void MOC2D1DDriver::set_keff_tolerance(double ktol) {
+  if (ktol <= 0. || ktol >= 0.1) {
+    const auto mssg = "keff tolerance must be in the interval (0., 0.1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  keff_tol_ = ktol;
+}
+
+void MOC2D1DDriver::set_flux_tolerance(double ftol) {
+  if (ftol <= 0. || ftol >= 0.1) {
+    const auto mssg = "Flux tolerance must be in the interval (0., 0.1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  flux_tol_ = ftol;
+}
+
+void MOC2D1DDriver::set_max_iterations(std::size_t n) {
+  if (n == 0) {
+    const auto mssg = "Maximum number of iterations must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  max_iters_ = n;
+}
+
+void MOC2D1DDriver::set_axial_subdivisions(std::size_t n) {
+  if (n == 0) {
+    const auto mssg = "Number of axial subdivisions must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  nsub_ = n;
+  axial_flux_.resize({0, 0, 0});
+}
+
+double MOC2D1DDriver::channel_flux(std::size_t p, std::size_t c,
+                                   std::size_t g) const {
+  if (solved_ == false) {
+    const auto mssg = "Cannot get the flux. 2D/1D problem has not been solved.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (p >= this->nplanes() || c >= this->nchannels() || g >= ngroups_) {
+    const auto mssg = "Plane, channel, or group index is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  return channel_flux_(p, c, g);
+}
+
+double MOC2D1DDriver::axial_current(std::size_t p, std::size_t c,
+                                    std::size_t g) const {
+  if (solved_ == false) {
+    const auto mssg =
+        "Cannot get the current. 2D/1D problem has not been solved.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (p > this->nplanes() || c >= this->nchannels() || g >= ngroups_) {
+    const auto mssg = "Surface, channel, or group index is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  return axial_current_(p, c, g);
+}
+
+void MOC2D1DDriver::generate_tracks(std::uint32_t n_angles, double d,
+                                    PolarQuadrature polar_quad) {
+  // The first plane of each radial geometry traces the tracks, which the
+  // others then reuse
+  for (auto& plane : planes_) plane->generate_tracks(n_angles, d, polar_quad);
+
+  channel_fsrs_.clear();
+  for (std::size_t p = 0; p < planes_.size(); p++) {
+    channel_fsrs_.push_back(planes_[p]->mesh_fsr_sets(dx_, dy_));
+    for (std::size_t c = 0; c < this->nchannels(); c++) {
+      if (channel_fsrs_[p][c].empty()) {
+        channel_fsrs_.clear();
+        std::stringstream mssg;
+        mssg << "Channel " << c << " of plane " << p << " contains no FSRs.";
+        spdlog::error(mssg.str());
+        throw ScarabeeException(mssg.str());
+      }
+    }
+  }
+
+  solved_ = false;
+}
+
+void MOC2D1DDriver::solve() {
+  SCARABEE_PROFILE_ZONE("MOC2D1DDriver::solve");
+  Timer sim_timer;
+  sim_timer.start();
+
+  if (this->drawn() == false) {
+    const auto mssg =
+        "Cannot solve 2D/1D problem. Tracks have not been generated.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (auto& plane : planes_) {
+    // The CMFD of a plane would not see the axial leakage
+    if (plane->cmfd()) {
+      const auto mssg = "The planes of a 2D/1D problem cannot have a CMFD.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+    plane->sim_mode() = SimulationMode::Keff;
+  }
+
+  const std::size_t NP = this->nplanes();
+  const std::size_t NC = this->nchannels();
+  const std::size_t NG = ngroups_;
+  if (solved_ == false) {
+    channel_flux_ = xt::zeros<double>({NP, NC, NG});
+    radial_leak_ = xt::zeros<double>({NP, NC, NG});
+    axial_current_ = xt::zeros<double>({NP + 1, NC, NG});
+    axial_flux_.resize({0, 0, 0});
+    for (auto& plane : planes_) plane->extern_src_array().fill(0.);
+    keff_ = 1.;
+  }
+
+  spdlog::info("Solving 2D/1D problem with {} planes and {} channels.", NP,
+               NC);
+  std::vector<std::vector<std::shared_ptr<CrossSection>>> xs(NP);
+  double rel_diff_keff = 100.;
+  double max_flx_diff = 100.;
+  std::size_t iteration = 0;
+  Timer iteration_timer;
+  while ((rel_diff_keff > keff_tol_ || max_flx_diff > flux_tol_) &&
+         iteration < max_iters_) {
+    iteration_timer.reset();
+    iteration_timer.start();
+    iteration++;
+
+    solve_all(planes_);
+
+    const xt::xtensor<double, 3> old_flux = channel_flux_;
+    const double prev_keff = keff_;
+    homogenize_channels(xs);
+
+    // The 1D solves start from the flux of the planes
+    const std::size_t NK = NP * nsub_;
+    if (axial_flux_.shape()[0] != NC || axial_flux_.shape()[2] != NK) {
+      axial_flux_.resize({NC, NG, NK});
+      for (std::size_t c = 0; c < NC; c++) {
+        for (std::size_t g = 0; g < NG; g++) {
+          for (std::size_t k = 0; k < NK; k++) {
+            axial_flux_(c, g, k) = channel_flux_(k / nsub_, c, g);
+          }
+        }
+      }
+    }
+    parallel_for_each_index(NC, [&](std::size_t c) { axial_solve(c, xs); });
+    set_axial_leakage();
+
+    rel_diff_keff = std::abs(keff_ - prev_keff) / keff_;
+    max_flx_diff = 0.;
+    for (std::size_t j = 0; j < channel_flux_.size(); j++) {
+      const double f = channel_flux_.flat(j);
+      if (f > 0.) {
+        max_flx_diff =
+            std::max(max_flx_diff, std::abs(f - old_flux.flat(j)) / f);
+      }
+    }
+
+    iteration_timer.stop();
+    spdlog::info("-------------------------------------");
+    spdlog::info("2D/1D iteration {:>4d}    keff: {:.5f}", iteration, keff_);
+    spdlog::info("     keff difference:     {:.5E}", rel_diff_keff);
+    spdlog::info("     max flux difference: {:.5E}", max_flx_diff);
+    spdlog::info("     iteration time: {:.5E} s",
+                 iteration_timer.elapsed_time());
+  }
+
+  if (rel_diff_keff > keff_tol_ || max_flx_diff > flux_tol_) {
+    spdlog::warn("The 2D/1D iterations did not converge in {} iterations.",
+                 max_iters_);
+  }
+
+  solved_ = true;
+
+  sim_timer.stop();
+  spdlog::info("");
+  spdlog::info("Simulation Time: {:.5E} s", sim_timer.elapsed_time());
+}
+
+void MOC2D1DDriver::homogenize_channels(
+    std::vector<std::vector<std::shared_ptr<CrossSection>>>& xs) {
+  const std::size_t NC = this->nchannels();
+  const std::size_t NG = ngroups_;
+
+  // The planes have converged to their own keff. The keff of the whole
+  // problem balances the total production with the total fission source.
+  double production = 0.;
+  double source = 0.;
+  for (std::size_t p = 0; p < planes_.size(); p++) {
+    const MOCDriver& moc = *planes_[p];
+    xs[p] = moc.homogenize_sets(channel_fsrs_[p]);
+    const auto spectra = moc.homogenize_flux_spectra(channel_fsrs_[p]);
+    const double kp = moc.keff();
+
+    for (std::size_t c = 0; c < NC; c++) {
+      const CrossSection& mat = *xs[p][c];
+      double area = 0.;
+      for (const auto i : channel_fsrs_[p][c]) area += moc.volume(i);
+
+      double fiss = 0.;
+      for (std::size_t g = 0; g < NG; g++) {
+        channel_flux_(p, c, g) = spectra(c, g);
+        fiss += mat.vEf(g) * spectra(c, g);
+      }
+
+      // The radial leakage is what remains of the balance of the channel,
+      // with the axial leakage given to the plane
+      for (std::size_t g = 0; g < NG; g++) {
+        double scat = 0.;
+        for (std::size_t gg = 0; gg < NG; gg++) {
+          scat += mat.Es_tr(gg, g) * spectra(c, gg);
+        }
+        const double axial_leak =
+            (axial_current_(p + 1, c, g) - axial_current_(p, c, g)) / dz_[p];
+        radial_leak_(p, c, g) = mat.chi(g) * fiss / kp + scat -
+                                mat.Etr(g) * spectra(c, g) - axial_leak;
+      }
+
+      const double P = area * dz_[p] * fiss;
+      production += P;
+      source += P / kp;
+    }
+  }
+
+  if (production > 0.) keff_ = production / source;
+}
+
+void MOC2D1DDriver::axial_solve(
+    std::size_t c,
+    const std::vector<std::vector<std::shared_ptr<CrossSection>>>& xs) {
+  const std::size_t NP = this->nplanes();
+  const std::size_t NG = ngroups_;
+  const std::size_t NK = NP * nsub_;
+
+  // Width, diffusion coefficient, and fission source of each cell. The
+  // fission source is that of the planes, with the keff of the problem.
+  std::vector<double> h(NK), fiss(NP, 0.);
+  for (std::size_t p = 0; p < NP; p++) {
+    const CrossSection& mat = *xs[p][c];
+    for (std::size_t g = 0; g < NG; g++) {
+      fiss[p] += mat.vEf(g) * channel_flux_(p, c, g);
+    }
+    fiss[p] /= keff_;
+    for (std::size_t s = 0; s < nsub_; s++) {
+      h[p * nsub_ + s] = dz_[p] / static_cast<double>(nsub_);
+    }
+  }
+
+  std::vector<double> D(NK), Dt(NK + 1), a(NK), b(NK), u(NK), rhs(NK), phi(NK);
+  auto boundary_coupling = [](BoundaryCondition bc, double Dk, double hk) {
+    // Marshak vacuum condition, with no incoming partial current
+    if (bc == BoundaryCondition::Vacuum) return 2. * Dk / (hk + 4. * Dk);
+    return 0.;
+  };
+
+  // Gauss-Seidel iterations over the groups, which only need to be repeated
+  // when there is upscattering
+  for (std::size_t it = 0; it < 100; it++) {
+    double max_diff = 0.;
+    for (std::size_t g = 0; g < NG; g++) {
+      for (std::size_t k = 0; k < NK; k++) {
+        D[k] = 1. / (3. * xs[k / nsub_][c]->Etr(g));
+      }
+      Dt[0] = boundary_coupling(z_min_bc_, D[0], h[0]);
+      Dt[NK] = boundary_coupling(z_max_bc_, D[NK - 1], h[NK - 1]);
+      for (std::size_t k = 0; k + 1 < NK; k++) {
+        Dt[k + 1] =
+            2. * D[k] * D[k + 1] / (D[k] * h[k + 1] + D[k + 1] * h[k]);
+      }
+
+      for (std::size_t k = 0; k < NK; k++) {
+        const std::size_t p = k / nsub_;
+        const CrossSection& mat = *xs[p][c];
+        double src = mat.chi(g) * fiss[p] - radial_leak_(p, c, g);
+        for (std::size_t gg = 0; gg < NG; gg++) {
+          if (gg != g) src += mat.Es_tr(gg, g) * axial_flux_(c, gg, k);
+        }
+        const double Er = mat.Etr(g) - mat.Es_tr(g, g);
+
+        a[k] = -Dt[k];
+        u[k] = -Dt[k + 1];
+        b[k] = Er * h[k] + Dt[k] + Dt[k + 1];
+        rhs[k] = src * h[k];
+      }
+
+      // Tridiagonal solve, by forward elimination and back substitution
+      for (std::size_t k = 1; k < NK; k++) {
+        const double m = a[k] / b[k - 1];
+        b[k] -= m * u[k - 1];
+        rhs[k] -= m * rhs[k - 1];
+      }
+      phi[NK - 1] = rhs[NK - 1] / b[NK - 1];
+      for (std::size_t k = NK - 1; k-- > 0;) {
+        phi[k] = (rhs[k] - u[k] * phi[k + 1]) / b[k];
+      }
+
+      for (std::size_t k = 0; k < NK; k++) {
+        if (phi[k] != 0.) {
+          max_diff = std::max(
+              max_diff, std::abs(phi[k] - axial_flux_(c, g, k)) /
+                            std::abs(phi[k]));
+        }
+        axial_flux_(c, g, k) = phi[k];
+      }
+
+      // Net currents through the plane boundaries
+      axial_current_(0, c, g) = -Dt[0] * phi[0];
+      axial_current_(NP, c, g) = Dt[NK] * phi[NK - 1];
+      for (std::size_t p = 1; p < NP; p++) {
+        const std::size_t k = p * nsub_;
+        axial_current_(p, c, g) = -Dt[k] * (phi[k] - phi[k - 1]);
+      }
+    }
+
+    if (max_diff < 1.E-8) break;
+  }
+}
+
+void MOC2D1DDriver::set_axial_leakage() {
+  for (std::size_t p = 0; p < planes_.size(); p++) {
+    auto& extern_src = planes_[p]->extern_src_array();
+    for (std::size_t c = 0; c < this->nchannels(); c++) {
+      for (std::size_t g = 0; g < ngroups_; g++) {
+        const double axial_leak =
+            (axial_current_(p + 1, c, g) - axial_current_(p, c, g)) / dz_[p];
+        for (const auto i : channel_fsrs_[p][c]) extern_src(g, i) = -axial_leak;
+      }
+    }
+  }
+}
+
+}  // namespace scarabee
@@ -1,23 +1,170 @@
 #include <moc/moc_driver.hpp>
+#include <data/condensation_scheme.hpp>
 #include <utils/constants.hpp>
 #include <utils/scarabee_exception.hpp>
 #include <utils/logging.hpp>
 #include <utils/timer.hpp>
+#include <utils/threads.hpp>
 #include <utils/math.hpp>
+#include <utils/mapped_file.hpp>
+#include <utils/gmres.hpp>
+#include <utils/anderson.hpp>
+#include <utils/mpi.hpp>
+#include <utils/profiler.hpp>
+#include <utils/simd_kernels.hpp>
+#include <utils/ki3_table.hpp>
 
 #include <xtensor/core/xmath.hpp>
+#include <xtensor/core/xnoalias.hpp>
 #include <xtensor/views/xview.hpp>
 
 #include <cereal/archives/portable_binary.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
 #include <vector>
-#include <set>
 
 namespace scarabee {
 
+namespace {
+
+// Offset of the FSR ids which are not in the geometry
+constexpr std::size_t NO_FSR_OFFSET = std::numeric_limits<std::size_t>::max();
+
+// Maximum number of times a chord solve follows a closed chain around its
+// cycle, when the cycle is too thin for Ki3 to vanish sooner
+constexpr std::size_t MAX_CHORD_CYCLES = 100;
+
+// Number of segments after which a bundle of the bundled sweep is closed.
+// With a few groups and polar angles, the FSR data touched by a bundle then
+// fits in the L2 cache of a core.
+constexpr std::size_t BUNDLE_SEGMENTS = 4096;
+
+// Ki3 table of the chord solves, built on first use
+const Ki3Table& chord_ki3_table() {
+  static const Ki3Table table;
+  return table;
+}
+
+// Appends the center of every cell of geom, whose origin is at origin
+void append_cell_centers(const Cartesian2D& geom, const Vector& origin,
+                         std::vector<Vector>& centers) {
+  for (std::size_t i = 0; i < geom.nx(); i++) {
+    for (std::size_t j = 0; j < geom.ny(); j++) {
+      const Cartesian2D::TileIndex ti{i, j};
+      const auto& tile = geom.tile(ti);
+      const Vector center = origin + geom.get_tile_center(ti);
+      if (tile.c2d) {
+        append_cell_centers(*tile.c2d, center, centers);
+      } else if (tile.cell) {
+        centers.push_back(center);
+      }
+    }
+  }
+}
+
+// Object filling a tile, which is compared to find the changed tiles
+std::shared_ptr<const void> tile_fill(const Cartesian2D::Tile& tile) {
+  if (tile.c2d) return tile.c2d;
+  return tile.cell;
+}
+
+// True when the chord from r0 to r1 crosses the box (x_min, x_max, y_min,
+// y_max), by clipping the chord to the box
+bool chord_crosses_box(const Vector& r0, const Vector& r1,
+                       const std::array<double, 4>& box) {
+  const double dx = r1.x() - r0.x();
+  const double dy = r1.y() - r0.y();
+  double t0 = 0.;
+  double t1 = 1.;
+
+  // Keeps the part of the chord where p * t <= q
+  auto clip = [&](double p, double q) {
+    if (p == 0.) return q >= 0.;
+    const double t = q / p;
+    if (p < 0.) {
+      t0 = std::max(t0, t);
+    } else {
+      t1 = std::min(t1, t);
+    }
+    return t0 <= t1;
+  };
+
+  return clip(-dx, r0.x() - box[0]) && clip(dx, box[1] - r0.x()) &&
+         clip(-dy, r0.y() - box[2]) && clip(dy, box[3] - r0.y());
+}
+
+// Number of points along each side of the grid of the Hilbert curve
+constexpr double HILBERT_GRID = 65536.;
+
+// Distance along the Hilbert curve of the point (x, y) of the grid
+std::uint64_t hilbert_index(std::uint32_t x, std::uint32_t y) {
+  constexpr std::uint32_t n = 65536;
+  std::uint64_t d = 0;
+  for (std::uint32_t s = n / 2; s > 0; s /= 2) {
+    const std::uint32_t rx = (x & s) > 0 ? 1 : 0;
+    const std::uint32_t ry = (y & s) > 0 ? 1 : 0;
+    d += std::uint64_t{s} * s * ((3 * rx) ^ ry);
+
+    // Rotate the quadrant, so that the curve is continuous
+    if (ry == 0) {
+      if (rx == 1) {
+        x = n - 1 - x;
+        y = n - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+// Track laydowns shared between drivers, by hash. Only weak references are
+// kept, so that a laydown is freed with the last driver using it.
+std::mutex shared_tracks_mtx;
+std::map<std::uint64_t, std::weak_ptr<const std::string>> shared_tracks_map;
+
+std::shared_ptr<const std::string> find_shared_tracks(std::uint64_t hash) {
+  std::lock_guard<std::mutex> lock(shared_tracks_mtx);
+  const auto it = shared_tracks_map.find(hash);
+  if (it == shared_tracks_map.end()) return nullptr;
+  return it->second.lock();
+}
+
+// Returns the laydown already shared under the hash if there is one, as
+// when two drivers traced the same tracks at once.
+std::shared_ptr<const std::string> insert_shared_tracks(
+    std::uint64_t hash, std::shared_ptr<const std::string> laydown) {
+  std::lock_guard<std::mutex> lock(shared_tracks_mtx);
+  auto& entry = shared_tracks_map[hash];
+  if (auto current = entry.lock()) return current;
+  entry = laydown;
+
+  for (auto it = shared_tracks_map.begin(); it != shared_tracks_map.end();) {
+    if (it->second.expired()) {
+      it = shared_tracks_map.erase(it);
+    } else {
+      it++;
+    }
+  }
+
+  return laydown;
+}
+
+}  // namespace
+
 MOCDriver::MOCDriver(std::shared_ptr<Cartesian2D> geometry,
                      BoundaryCondition xmin, BoundaryCondition xmax,
                      BoundaryCondition ymin, BoundaryCondition ymax,
@@ -68,7 +215,7 @@ MOCDriver::MOCDriver(std::shared_ptr<Cartesian2D> geometry,
 
   // Allocate arrays and assign indices
   flux_.resize({ngroups_, nfsrs_, N_lj_});
-  flux_.fill(0.);
+  parallel_fill(flux_.data(), flux_.size(), 0.);
   extern_src_.resize({ngroups_, nfsrs_});
   extern_src_.fill(0.);
 }
@@ -107,10 +254,182 @@ void MOCDriver::set_keff_tolerance(double ktol) {
   keff_tol_ = ktol;
 }
 
+void MOCDriver::set_thermal_iterations(std::size_t n) {
+  if (n == 0) {
+    const auto mssg = "Number of thermal iterations must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  thermal_iters_ = n;
+}
+
+void MOCDriver::set_group_mask_ratio(double ratio) {
+  if (ratio <= 0. || ratio > 1.) {
+    const auto mssg = "Group mask ratio must be in the interval (0, 1].";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  group_mask_ratio_ = ratio;
+}
+
+void MOCDriver::set_group_mask_interval(std::size_t n) {
+  if (n == 0) {
+    const auto mssg = "Group mask interval must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  group_mask_interval_ = n;
+}
+
+void MOCDriver::set_mpi_group_decomposition(bool groups) {
+  mpi_groups_ = groups;
+  if (drawn()) partition_tracks();
+}
+
+void MOCDriver::set_bundled_sweep(bool bs) {
+  bundled_sweep_ = bs;
+  if (drawn()) build_sweep_bundles();
+}
+
+void MOCDriver::set_coarse_presolve_groups(
+    const std::vector<std::pair<std::size_t, std::size_t>>& groups) {
+  // The scheme is checked against the fine groups
+  if (groups.empty() == false) CondensationScheme(groups, ngroups_);
+  presolve_groups_ = groups;
+}
+
+void MOCDriver::set_krylov_tolerance(double tol) {
+  if (tol <= 0. || tol >= 1.) {
+    const auto mssg = "Krylov tolerance must be in the interval (0., 1.).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  krylov_tol_ = tol;
+}
+
+void MOCDriver::set_krylov_restart(std::size_t m) {
+  if (m == 0) {
+    const auto mssg = "Krylov restart length must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  krylov_restart_ = m;
+}
+
+void MOCDriver::set_krylov_max_iterations(std::size_t n) {
+  if (n == 0) {
+    const auto mssg = "Maximum number of Krylov iterations must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  krylov_max_iters_ = n;
+}
+
+void MOCDriver::set_anderson_damping(double wd) {
+  if (wd <= 0. || wd > 1.) {
+    const auto mssg = "Anderson damping must be in the interval (0., 1.].";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  anderson_damping_ = wd;
+}
+
+void MOCDriver::set_device_sweep(bool ds) {
+#if !defined(SCARABEE_USE_GPU)
+  if (ds) {
+    const auto mssg =
+        "Scarabee was not built with SCARABEE_USE_GPU, so the device sweep is "
+        "not available.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+#endif
+
+  device_sweep_ = ds;
+}
+
+void MOCDriver::pack_anderson_iterate(std::vector<double>& x) const {
+  const bool with_keff = mode_ == SimulationMode::Keff;
+  x.resize(flux_.size() + (with_keff ? 1 : 0));
+  std::copy(flux_.begin(), flux_.end(), x.begin());
+  if (with_keff) x.back() = keff_;
+}
+
+void MOCDriver::unpack_anderson_iterate(const std::vector<double>& x) {
+  std::copy(x.begin(), x.begin() + flux_.size(), flux_.begin());
+  if (mode_ == SimulationMode::Keff) keff_ = x.back();
+
+  // The mixed scalar flux could be negative
+  for (std::size_t g = 0; g < ngroups_; g++) {
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      if (flux_(g, i, 0) < 0.) flux_(g, i, 0) = 0.;
+    }
+  }
+}
+
+void MOCDriver::set_extrapolation_order(std::size_t order) {
+  if (order > 2) {
+    const auto mssg = "Extrapolation order must be 0, 1, or 2.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  extrap_order_ = order;
+  if (extrap_order_ == 0) this->clear_solution_history();
+}
+
+void MOCDriver::clear_solution_history() {
+  history_.clear();
+  if (cmfd_) cmfd_->clear_solution_history();
+}
+
+void MOCDriver::set_initial_solution(double keff,
+                                     const xt::xtensor<double, 3>& flux) {
+  if (this->drawn() == false) {
+    const auto mssg =
+        "Cannot set initial solution. Geometry has not been traced.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (keff <= 0.) {
+    const auto mssg = "Initial keff must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t nlj = anisotropic_ ? N_lj_ : 1;
+  if (flux.shape()[0] != ngroups_ || flux.shape()[1] != nfsrs_ ||
+      flux.shape()[2] != nlj) {
+    const auto mssg = "Shape of initial flux does not agree with the problem.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  double avg_flux = 0.;
+  for (std::size_t g = 0; g < ngroups_; g++) {
+    for (std::size_t i = 0; i < nfsrs_; i++) avg_flux += flux(g, i, 0);
+  }
+  avg_flux /= static_cast<double>(ngroups_ * nfsrs_);
+
+  flux_ = flux;
+  track_flux_.fill(static_cast<StoredReal>(avg_flux / (4. * PI)));
+  keff_ = keff;
+  solved_ = true;
+}
+
 void MOCDriver::set_cmfd(std::shared_ptr<CMFD> cmfd) {
   if ((this->drawn())) {
     angle_info_.clear();
     tracks_.clear();
+    seg_store_.clear();
     spdlog::warn(
         "CMFD was set after track tracing. Must call generate_tracks again !");
   }
@@ -128,6 +447,26 @@ void MOCDriver::set_cmfd(std::shared_ptr<CMFD> cmfd) {
   cmfd_ = cmfd;
 }
 
+void MOCDriver::set_exp_max_memory(double mem) {
+  if (mem <= 0.) {
+    const auto mssg = "Memory for precomputed exponentials must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  exp_max_memory_ = mem;
+}
+
+void MOCDriver::set_angular_source_max_memory(double mem) {
+  if (mem <= 0.) {
+    const auto mssg = "Memory for the angular source must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  ang_src_max_memory_ = mem;
+}
+
 void MOCDriver::set_fsr_area_tolerance(double atol) {
   if (atol <= 0.) {
     const auto mssg =
@@ -146,8 +485,22 @@ void MOCDriver::set_fsr_area_tolerance(double atol) {
   fsr_area_tol_ = atol;
 }
 
+void MOCDriver::set_xs_dedup_tolerance(double rtol) {
+  if (rtol < 0. || rtol >= 1.) {
+    const auto mssg =
+        "Tolerance for cross section deduplication must be in the interval "
+        "[0., 1.).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  xs_dedup_tol_ = rtol;
+}
+
 void MOCDriver::generate_tracks(std::uint32_t n_angles, double d,
                                 PolarQuadrature polar_quad) {
+  ThreadScope thread_scope(threads_);
+
   // Timer for method
   Timer draw_timer;
   draw_timer.start();
@@ -186,9 +539,51 @@ void MOCDriver::generate_tracks(std::uint32_t n_angles, double d,
   angle_info_.clear();
   tracks_.clear();
 
-  generate_azimuthal_quadrature(n_angles, d);
-  trace_tracks();
-  segment_renormalization();
+  // Reuse a previous track laydown of the same geometry when possible
+  const bool use_cache =
+      track_cache_file_.empty() == false || track_cache_dir_.empty() == false;
+  const std::uint64_t cache_hash =
+      use_cache || share_tracks_ ? track_cache_hash(n_angles, d) : 0;
+  const std::string cache_fname = use_cache ? track_cache_path(cache_hash) : "";
+  shared_tracks_.reset();
+  otf_laydown_ = false;
+  otf_renorm_ = xt::xtensor<double, 2>();
+  otf_buffers_.clear();
+  if (otf_tracing_ && (use_cache || share_tracks_)) {
+    const auto mssg =
+        "Track caches and shared tracks are not available with on-the-fly "
+        "tracing.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+  bool loaded = false;
+  if (share_tracks_) {
+    auto laydown = find_shared_tracks(cache_hash);
+    if (laydown && read_track_laydown(laydown->data(), laydown->size(),
+                                      cache_hash, n_angles, d,
+                                      "Shared track laydown")) {
+      spdlog::info("Reused shared tracks");
+      shared_tracks_ = laydown;
+      loaded = true;
+    }
+  }
+  if (loaded == false && use_cache &&
+      load_track_cache(cache_fname, cache_hash, n_angles, d)) {
+    spdlog::info("Loaded tracks from \"{}\"", cache_fname);
+    loaded = true;
+  }
+  if (loaded == false) {
+    generate_azimuthal_quadrature(n_angles, d);
+    trace_tracks();
+    if (use_cache) save_track_cache(cache_fname, cache_hash, n_angles, d);
+  }
+  if (share_tracks_ && shared_tracks_ == nullptr) {
+    std::ostringstream out(std::ios_base::binary);
+    write_track_laydown(out, cache_hash, n_angles, d);
+    shared_tracks_ = insert_shared_tracks(
+        cache_hash, std::make_shared<const std::string>(std::move(out).str()));
+  }
+  if (otf_laydown_ == false) segment_renormalization();
 
   if ((x_min_bc_ == BoundaryCondition::Periodic &&
        x_max_bc_ != BoundaryCondition::Periodic) ||
@@ -208,19 +603,150 @@ void MOCDriver::generate_tracks(std::uint32_t n_angles, double d,
     throw ScarabeeException(mssg);
   }
 
+  // Give every track a provisional flux slot, in track order, so that the
+  // connections can be set. The slots are reordered once all are known.
+  std::size_t slot = 0;
+  for (auto& tracks : tracks_) {
+    for (auto& track : tracks) track.set_flux_slot(slot++);
+  }
+
   spdlog::info("Determining track connections");
   set_bcs();
 
   allocate_track_fluxes();
+  chains_.build(tracks_);
+  if (otf_laydown_) {
+    seg_store_.pack_offsets(tracks_, otf_track_nsegs_);
+    otf_track_nsegs_ = std::vector<std::size_t>();
+  } else {
+    seg_store_.pack(tracks_, fsr_xs_indx_, cmfd_.get());
+  }
+  if (compress_segments_ && otf_laydown_ == false) {
+    seg_store_.compress();
+    for (auto& tracks : tracks_) {
+      for (auto& track : tracks) track.clear_segments();
+    }
+  }
+  if (direct_segments() == false) otf_buffers_.resize(max_threads());
+  partition_tracks();
+  traced_tiles_ = traced_tile_fsrs();
+
+  // The symmetry maps are rebuilt for the new tracks at the next solve
+  track_swept_.clear();
+  fsr_mirror_.clear();
+  sym_row_copies_.clear();
 
   draw_timer.stop();
   spdlog::info("Time spent drawing tracks: {:.5} s.",
                draw_timer.elapsed_time());
+  log_memory_usage("MOCDriver", memory_usage());
+}
+
+std::pair<std::uint32_t, double> MOCDriver::generate_tracks_adaptive(
+    PolarQuadrature polar_quad, double area_tol, double keff_tol,
+    std::uint32_t max_angles, double min_d) {
+  if (area_tol <= 0.) {
+    const auto mssg = "FSR area tolerance must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (keff_tol < 0.) {
+    const auto mssg = "keff tolerance must be >= 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (max_angles < 8) {
+    const auto mssg = "Maximum number of angles must be at least 8.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (min_d <= 0.) {
+    const auto mssg = "Minimum track spacing must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::uint32_t n_angles = 8;
+  double d = std::max(0.2, min_d);
+
+  // The track spacing is first refined for the FSR areas
+  generate_tracks(n_angles, d, polar_quad);
+  while (fsr_area_error_ > area_tol && 0.5 * d >= min_d) {
+    d *= 0.5;
+    generate_tracks(n_angles, d, polar_quad);
+  }
+  if (fsr_area_error_ > area_tol) {
+    spdlog::warn("FSR area error of {:.3E} is above tolerance at the minimum "
+                 "track spacing.",
+                 fsr_area_error_);
+  }
+
+  // Then, the refinement which changes keff the most is kept, until keff is
+  // converged in both the angles and the spacing
+  double dk = 0.;
+  if (keff_tol > 0. && mode_ == SimulationMode::Keff) {
+    // The trial solutions are not kept for the extrapolation
+    const auto history = history_;
+
+    solve();
+    double keff = keff_;
+    while (true) {
+      const bool refine_angles = 2 * n_angles <= max_angles;
+      const bool refine_spacing = 0.5 * d >= min_d;
+      if (refine_angles == false && refine_spacing == false) {
+        spdlog::warn("keff change is above tolerance at the finest tracks.");
+        break;
+      }
+
+      double keff_angles = keff;
+      if (refine_angles) {
+        generate_tracks(2 * n_angles, d, polar_quad);
+        solve();
+        keff_angles = keff_;
+      }
+
+      double keff_spacing = keff;
+      if (refine_spacing) {
+        generate_tracks(n_angles, 0.5 * d, polar_quad);
+        solve();
+        keff_spacing = keff_;
+      }
+
+      const double dk_angles = std::abs(keff_angles - keff);
+      const double dk_spacing = std::abs(keff_spacing - keff);
+      dk = std::max(dk_angles, dk_spacing);
+      if (dk <= keff_tol) break;
+
+      if (dk_angles >= dk_spacing) {
+        n_angles *= 2;
+        keff = keff_angles;
+      } else {
+        d *= 0.5;
+        keff = keff_spacing;
+      }
+    }
+
+    history_ = history;
+    generate_tracks(n_angles, d, polar_quad);
+  }
+
+  spdlog::info("Adaptive tracks: {} angles, track spacing {:.4E} cm.",
+               n_angles, d);
+  spdlog::info("FSR area error: {:.3E}, keff change: {:.1f} pcm.",
+               fsr_area_error_, 1.E5 * dk);
+
+  return {n_angles, d};
 }
 
 void MOCDriver::solve() {
+  SCARABEE_PROFILE_ZONE("MOCDriver::solve");
+  ThreadScope thread_scope(threads_);
   Timer sim_timer;
   sim_timer.start();
+  telemetry_.clear();
 
   // Make sure the geometry has been drawn
   if (angle_info_.empty()) {
@@ -229,6 +755,59 @@ void MOCDriver::solve() {
     throw ScarabeeException(mssg);
   }
 
+  if (source_shape_ == SourceShape::Linear) {
+    if (anisotropic_) {
+      const auto mssg =
+          "The linear source is not available for anisotropic problems.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (solver_ != TransportSolver::SourceIteration) {
+      const auto mssg = "The linear source requires source iterations.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  if (mpi_groups_ && mpi_size() > 1 && solver_ == TransportSolver::GMRES) {
+    const auto mssg =
+        "GMRES is not available with the MPI group decomposition.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (direct_segments() == false &&
+      (source_shape_ == SourceShape::Linear ||
+       symmetry_ == DomainSymmetry::Diagonal)) {
+    const auto mssg =
+        "The linear source and diagonal symmetry are not available with "
+        "on-the-fly tracing or compressed segments.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (symmetry_ == DomainSymmetry::Diagonal) {
+    if (anisotropic_) {
+      const auto mssg =
+          "Diagonal symmetry is not available for anisotropic problems.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (cmfd_) {
+      const auto mssg = "Diagonal symmetry is not available with CMFD.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (track_swept_.empty()) build_symmetry();
+  } else {
+    track_swept_.clear();
+    fsr_mirror_.clear();
+    sym_row_copies_.clear();
+  }
+
   if (mode_ == SimulationMode::Keff) {
     spdlog::info("Solving for keff.");
     spdlog::info("keff tolerance: {:.5E}", keff_tol_);
@@ -258,12 +837,53 @@ void MOCDriver::solve() {
       throw ScarabeeException(mssg);
     }
 
+    // Only the tallies are mirrored, so the source must be symmetric too
+    if (track_swept_.empty() == false) {
+      for (std::size_t g = 0; g < ngroups_; g++) {
+        for (std::size_t i = 0; i < nfsrs_; i++) {
+          const double q = extern_src_(g, i);
+          const double mq = extern_src_(g, fsr_mirror_[i]);
+          if (std::abs(q - mq) > 1.E-10 * std::max(q, mq)) {
+            const auto mssg =
+                "The external source is not symmetric about the diagonal.";
+            spdlog::error(mssg);
+            throw ScarabeeException(mssg);
+          }
+        }
+      }
+    }
+
     // Homogenize external source for CMFD
     if (cmfd_) {
       cmfd_->homogenize_ext_src(*this);
     }
   }
 
+  // Cross sections may have changed since the last solve, so that FSRs
+  // which had the same material no longer do, or the other way around
+  if (index_cross_sections()) seg_store_.set_xs_indices(fsr_xs_indx_);
+  if (direct_segments() == false) {
+    // The decoded tracks hold the cross section indices, and the number of
+    // threads may have changed since the tracing
+    otf_buffers_.clear();
+    otf_buffers_.resize(max_threads());
+  }
+  spdlog::info("Number of unique materials: {}", xs_list_.size());
+  fill_material_tables();
+  fill_exponentials();
+  if (source_shape_ == SourceShape::Linear) fill_linear_source_geometry();
+  extrapolate_solution();
+
+  if (presolve_groups_.empty() == false && solved_ == false) {
+    if (anisotropic_) {
+      spdlog::warn(
+          "The coarse-group pre-solve is only available for isotropic "
+          "problems.");
+    } else {
+      coarse_presolve();
+    }
+  }
+
   if (anisotropic_ == false) {
     // isotropic
     solve_isotropic();
@@ -272,29 +892,186 @@ void MOCDriver::solve() {
     solve_anisotropic();
   }
 
+  if (mpi_groups_ && mpi_size() > 1) gather_track_flux();
+
   solved_ = true;
+  save_solution();
+  compute_tallies();
 
   sim_timer.stop();
+  telemetry_.add_time("solve", sim_timer.elapsed_time());
+  record_memory();
   spdlog::info("");
   spdlog::info("Simulation Time: {:.5E} s", sim_timer.elapsed_time());
+  log_memory_usage("MOCDriver", memory_usage());
 }
 
-// solve for the isotropic
-void MOCDriver::solve_isotropic() {
-  if (solved_ == false) {
-    flux_.resize({ngroups_, nfsrs_, 1});
-    flux_.fill(0.);
+void MOCDriver::solve_chords(double black_xs) {
+  SCARABEE_PROFILE_ZONE("MOCDriver::solve_chords");
+  ThreadScope thread_scope(threads_);
+  Timer sim_timer;
+  sim_timer.start();
+  telemetry_.clear();
+
+  if (angle_info_.empty()) {
+    const auto mssg = "Cannot solve MOC problem. Geometry has not been traced.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
   }
-  xt::xtensor<double, 2> src;
-  src.resize({ngroups_, nfsrs_});
-  src.fill(0.);
 
-  // Initialize stabalization matrix (see [1])
-  xt::xtensor<double, 2> D;
-  D.resize({ngroups_, nfsrs_});
+  if (mode_ != SimulationMode::FixedSource || anisotropic_) {
+    const auto mssg =
+        "Chord solves are only available for isotropic fixed-source "
+        "problems.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (black_xs <= 0.) {
+    const auto mssg = "Black cross section must be > 0.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (index_cross_sections()) seg_store_.set_xs_indices(fsr_xs_indx_);
+  if (direct_segments() == false) {
+    otf_buffers_.clear();
+    otf_buffers_.resize(max_threads());
+  }
+  fill_material_tables();
+
+  for (const auto& xs : xs_list_) {
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      if (xs->Es_tr(g) > 0.) {
+        const auto mssg = "Chord solves require cross sections without "
+                          "scattering.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+    }
+  }
+
+  // The polar integral of the attenuation along a chord of optical length
+  // x is Ki3(x), normalized by Ki3(0) so that the flux has the scale of the
+  // polar quadrature of the tracks
+  const Ki3Table& ki3 = chord_ki3_table();
+  const double invs_ki3_0 = 1. / ki3(0.);
+  const double x_max = ki3.x_max();
+  auto K = [&](double x) { return ki3(x) * invs_ki3_0; };
+  double S = 0.;
+  for (const double w : polar_quad_.wsin()) S += w;
+
+  auto get_track = [this](std::size_t tt) -> Track& {
+    const std::size_t a = seg_store_.angle_index(tt);
+    return tracks_[a][tt - seg_store_.track_index(a, 0)];
+  };
+
+  std::vector<xt::xtensor<double, 2>> tallies(max_threads());
+  for (auto& tally : tallies) tally = xt::zeros<double>({ngroups_, nfsrs_});
+
+#pragma omp parallel for schedule(dynamic)
+  for (int ic = 0; ic < static_cast<int>(chains_.nchains()); ic++) {
+    const std::size_t c = static_cast<std::size_t>(ic);
+    auto& tally = tallies[thread_index()];
+
+    // Segments of the chain, in the direction of travel
+    thread_local std::vector<std::uint32_t> fsr, mat;
+    thread_local std::vector<double> len, tw, tau, Q;
+    thread_local std::vector<char> black;
+    fsr.clear();
+    mat.clear();
+    len.clear();
+    tw.clear();
+    for (std::size_t l = chains_.links_begin(c); l < chains_.links_end(c);
+         l++) {
+      std::size_t tt = chains_.track(l);
+      const Track& track = get_track(tt);
+      const double w = 4. * PI * track.wgt() * track.width();
+      const SegmentStore& segs = track_segments(track, tt);
+      const std::size_t s_begin = segs.segments_begin(tt);
+      const std::size_t s_end = segs.segments_end(tt);
+      for (std::size_t k = 0; k < s_end - s_begin; k++) {
+        const std::size_t s = chains_.forward(l) ? s_begin + k : s_end - 1 - k;
+        fsr.push_back(segs.fsr_indx(s));
+        mat.push_back(fsr_xs_indx_[segs.fsr_indx(s)]);
+        len.push_back(segs.length(s));
+        tw.push_back(w);
+      }
+    }
+    const std::size_t n = fsr.size();
+    const bool open = chains_.open(c);
+
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      tau.resize(n);
+      Q.resize(n);
+      black.resize(n);
+      for (std::size_t k = 0; k < n; k++) {
+        tau[k] = len[k] * mat_Et_(mat[k], g);
+        Q[k] = extern_src_(g, fsr[k]) * mat_invs_Et_(mat[k], g);
+        black[k] = mat_Et_(mat[k], g) >= black_xs;
+      }
+
+      for (std::size_t j = 0; j < n; j++) {
+        // Sources upstream of segment j, up to the last black segment, the
+        // vacuum boundary which starts an open chain, or the optical
+        // distance beyond which Ki3 vanishes. Closed chains are followed
+        // around their cycle.
+        double in = 0.;
+        double a = 0.;
+        std::size_t k = j;
+        for (std::size_t steps = 0; a < x_max; steps++) {
+          if (k == 0) {
+            if (open) break;
+            k = n;
+          }
+          k--;
+          in += Q[k] * (K(a) - K(a + tau[k]) - K(a + tau[j]) +
+                        K(a + tau[k] + tau[j]));
+          a += tau[k];
+          if (black[k] || steps + 1 >= MAX_CHORD_CYCLES * n) break;
+        }
+
+        const double delta = S * (in - Q[j] * (1. - K(tau[j])));
+        tally(g, fsr[j]) += tw[j] * delta;
+      }
+    }
+  }
+
+  flux_ = xt::zeros<double>({ngroups_, nfsrs_, N_lj_});
+  for (std::size_t g = 0; g < ngroups_; g++) {
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      double sflux = 0.;
+      for (const auto& tally : tallies) sflux += tally(g, i);
+      const std::size_t m = fsr_xs_indx_[i];
+      const double invs_Et = mat_invs_Et_(m, g);
+      flux_(g, i, 0) = sflux * invs_Et / fsrs_[i]->volume() +
+                       4. * PI * extern_src_(g, i) * invs_Et;
+    }
+  }
+  solved_ = true;
+  compute_tallies();
+
+  sim_timer.stop();
+  telemetry_.add_time("solve", sim_timer.elapsed_time());
+  spdlog::info("Chord solve time: {:.5E} s", sim_timer.elapsed_time());
+}
+
+// solve for the isotropic
+void MOCDriver::solve_isotropic() {
+  if (solved_ == false) {
+    flux_.resize({ngroups_, nfsrs_, 1});
+    parallel_fill(flux_.data(), flux_.size(), 0.);
+  }
+  auto& src = iso_src_;
+  src.resize({ngroups_, nfsrs_});
+  parallel_fill(src.data(), src.size(), 0.);
+
+  // Initialize stabalization matrix (see [1])
+  auto& D = stab_D_;
+  D.resize({ngroups_, nfsrs_});
   D.fill(0.);
   for (std::size_t i = 0; i < nfsrs_; i++) {
-    const auto xs = this->xs(i);
+    const auto& xs = xs_list_[fsr_xs_indx_[i]];
     for (std::size_t g = 0; g < ngroups_; g++) {
       const double Estr_g_g = xs->Es_tr(g, g);
       if (Estr_g_g < 0.) {
@@ -312,18 +1089,42 @@ void MOCDriver::solve_isotropic() {
     }
 
     // Initialize angular flux
-    for (auto& tracks : tracks_) {
-      for (auto& track : tracks) {
-        track.entry_flux().fill(1. / (4. * PI));
-        track.exit_flux().fill(1. / (4. * PI));
-      }
-    }
+    track_flux_.fill(1. / (4. * PI));
 
     keff_ = 1.;
   }
-  auto next_flux = flux_;
+  auto& next_flux = next_flux_;
+  next_flux = flux_;
   double prev_keff = keff_;
 
+  // The flux moments start from a flat flux, unless a previous linear source
+  // solution is available.
+  const bool linear = source_shape_ == SourceShape::Linear;
+  if (linear) {
+    if (solved_ == false || flux_mom_.size() != ngroups_ * nfsrs_ * 2) {
+      flux_mom_.resize({ngroups_, nfsrs_, 2});
+      flux_mom_.fill(0.);
+    }
+    next_flux_mom_ = flux_mom_;
+    src_grad_.resize({ngroups_, nfsrs_, 2});
+    src_grad_.fill(0.);
+  }
+
+  // Keep the tracks and boundary fluxes on the device for the whole solve
+  device_.release();
+  if (device_sweep_) {
+    if (cmfd_ || solver_ != TransportSolver::SourceIteration ||
+        mpi_size() > 1 || linear || direct_segments() == false) {
+      spdlog::warn(
+          "The device sweep only supports flat source iterations without "
+          "CMFD, on a single rank, with stored segments. Sweeping on the "
+          "host.");
+    } else {
+      device_.upload(tracks_, seg_store_, mat_Et_, polar_quad_.invs_sin(),
+                     polar_quad_.wsin(), track_flux_, nfsrs_);
+    }
+  }
+
   double rel_diff_keff = 100.;
   if (mode_ == SimulationMode::FixedSource) {
     keff_ = 1.;
@@ -333,37 +1134,155 @@ void MOCDriver::solve_isotropic() {
   double max_flx_diff = 100;
   std::size_t iteration = 0;
   Timer iteration_timer;
-  while (rel_diff_keff > keff_tol_ || max_flx_diff > flux_tol_) {
+  AndersonMixer anderson(anderson_depth_, anderson_damping_);
+  std::vector<double> anderson_x, anderson_gx;
+
+  // The CMFD currents need every group to be swept, and the Krylov solver
+  // needs the full transport operator
+  const bool masking = group_masking_ && cmfd_ == nullptr &&
+                       solver_ != TransportSolver::GMRES;
+  if (group_masking_ && masking == false) {
+    spdlog::warn("Group masking is not used with CMFD or GMRES.");
+  }
+  const double mask_tol = group_mask_ratio_ * flux_tol_;
+  std::vector<char> group_converged(ngroups_, 0);
+  xt::xtensor<double, 2> swept_src;  // Source of the last sweep of a group
+  if (masking) swept_src = xt::zeros<double>({ngroups_, nfsrs_});
+  std::size_t nskipped = 0;
+  bool final_sweep = false;  // Converged, but some groups were skipped
+
+  while (rel_diff_keff > keff_tol_ || max_flx_diff > flux_tol_ ||
+         final_sweep) {
     iteration_timer.reset();
     iteration_timer.start();
     iteration++;
+    if (anderson_enabled()) pack_anderson_iterate(anderson_x);
+    const bool full_sweep = masking == false || final_sweep ||
+                            iteration % group_mask_interval_ == 0;
+    nskipped = 0;
+
+    // The fission source only changes once per outer iteration
+    fill_fission_source(flux_);
+    if (linear) fill_fission_source_moments();
+    if (cmfd_) cmfd_->zero_currents();
 
-    fill_source(src, flux_);
-    src += extern_src_;
-
-    // Check for negative source values at beginning of simulation
+    // Sweeps the groups in [g_begin, g_end), with the scattering source
+    // computed from scat_flux, and its gradient from scat_mom for the linear
+    // source.
     bool set_neg_src_to_zero = false;
-    if (iteration <= 20) {
-      for (std::size_t i = 0; i < src.size(); i++) {
-        if (src.flat(i) < 0.) {
-          src.flat(i) = 0.;
-          set_neg_src_to_zero = true;
+    auto sweep_groups = [&](const xt::xtensor<double, 3>& scat_flux,
+                            const xt::xtensor<double, 3>& scat_mom,
+                            std::size_t g_begin, std::size_t g_end) {
+      fill_source(src, scat_flux, g_begin, g_end);
+      if (linear) fill_source_gradient(scat_mom, g_begin, g_end);
+
+      for (std::size_t g = g_begin; g < g_end; g++) {
+        for (std::size_t i = 0; i < nfsrs_; i++) {
+          src(g, i) += extern_src_(g, i);
+
+          // Check for negative source values at beginning of simulation
+          if (iteration <= 20 && src(g, i) < 0.) {
+            src(g, i) = 0.;
+            set_neg_src_to_zero = true;
+          }
         }
       }
-    }
 
-    next_flux.fill(0.);
-    if (cmfd_) cmfd_->zero_currents();
-    sweep(next_flux, src);
+      // A converged group keeps its flux while its source stays close to
+      // the source of its last sweep
+      auto skip_group = [&](std::size_t g) {
+        if (full_sweep || group_converged[g] == 0) return false;
+        for (std::size_t i = 0; i < nfsrs_; i++) {
+          if (std::abs(src(g, i) - swept_src(g, i)) >
+              mask_tol * std::abs(src(g, i))) {
+            return false;
+          }
+        }
+        return true;
+      };
+      std::vector<char> swept(g_end - g_begin, 1);
+      if (masking) {
+        for (std::size_t g = g_begin; g < g_end; g++) {
+          swept[g - g_begin] = skip_group(g) ? 0 : 1;
+        }
+      }
 
-    // Apply stabalization (see [1])
-    for (std::size_t g = 0; g < ngroups_; g++) {
-      for (std::size_t i = 0; i < nfsrs_; i++) {
-        if (D(g, i) != 0.) {
-          next_flux(g, i, 0) += flux_(g, i, 0) * D(g, i);
-          next_flux(g, i, 0) /= (1. + D(g, i));
+      // The swept groups are swept in contiguous runs
+      std::size_t g_run = g_begin;
+      while (g_run < g_end) {
+        if (swept[g_run - g_begin] == 0) {
+          for (std::size_t i = 0; i < nfsrs_; i++) {
+            next_flux(g_run, i, 0) = flux_(g_run, i, 0);
+            if (linear) {
+              next_flux_mom_(g_run, i, 0) = flux_mom_(g_run, i, 0);
+              next_flux_mom_(g_run, i, 1) = flux_mom_(g_run, i, 1);
+            }
+          }
+          nskipped++;
+          g_run++;
+          continue;
+        }
+
+        std::size_t g_run_end = g_run + 1;
+        while (g_run_end < g_end && swept[g_run_end - g_begin]) g_run_end++;
+
+        for (std::size_t g = g_run; g < g_run_end; g++) {
+          for (std::size_t i = 0; i < nfsrs_; i++) {
+            next_flux(g, i, 0) = 0.;
+            if (masking) swept_src(g, i) = src(g, i);
+          }
+        }
+
+        sweep(next_flux, src, g_run, g_run_end);
+
+        // Apply stabalization (see [1])
+        for (std::size_t g = g_run; g < g_run_end; g++) {
+          for (std::size_t i = 0; i < nfsrs_; i++) {
+            if (D(g, i) != 0.) {
+              next_flux(g, i, 0) += flux_(g, i, 0) * D(g, i);
+              next_flux(g, i, 0) /= (1. + D(g, i));
+              if (linear) {
+                for (std::size_t k = 0; k < 2; k++) {
+                  next_flux_mom_(g, i, k) += flux_mom_(g, i, k) * D(g, i);
+                  next_flux_mom_(g, i, k) /= (1. + D(g, i));
+                }
+              }
+            }
+          }
+        }
+
+        g_run = g_run_end;
+      }
+    };
+
+    if (solver_ == TransportSolver::GMRES) {
+      auto full_sweep = [&](const xt::xtensor<double, 3>& in_flux,
+                            xt::xtensor<double, 3>& out_flux) {
+        fill_source(src, in_flux, 0, ngroups_);
+        src += extern_src_;
+        out_flux.fill(0.);
+        sweep(out_flux, src, 0, ngroups_);
+      };
+      next_flux = flux_;
+      solve_krylov(next_flux, full_sweep);
+    } else if (gauss_seidel_ == false) {
+      sweep_groups(flux_, flux_mom_, 0, ngroups_);
+    } else {
+      // Groups before the upscatter block only scatter down, so one sweep of
+      // each, in order, uses fully updated scattering sources. Only the
+      // last sweep of the upscatter block is tallied for CMFD.
+      next_flux = flux_;
+      if (linear) next_flux_mom_ = flux_mom_;
+      for (std::size_t g = 0; g < upscatter_group_; g++) {
+        sweep_groups(next_flux, next_flux_mom_, g, g + 1);
+      }
+      for (std::size_t it = 0; it < thermal_iters_; it++) {
+        tally_currents_ = it + 1 == thermal_iters_;
+        for (std::size_t g = upscatter_group_; g < ngroups_; g++) {
+          sweep_groups(next_flux, next_flux_mom_, g, g + 1);
         }
       }
+      tally_currents_ = true;
     }
 
     // If MOC iterations in CMFD are skipped compute Keff
@@ -378,6 +1297,20 @@ void MOCDriver::solve_isotropic() {
     // Get difference
     max_flx_diff = xt::amax(xt::abs(next_flux - flux_) / next_flux)();
 
+    // Groups are converged when their own flux difference is below the mask
+    // tolerance
+    if (masking) {
+      for (std::size_t g = 0; g < ngroups_; g++) {
+        double diff = 0.;
+        for (std::size_t i = 0; i < nfsrs_; i++) {
+          const double d = std::abs(next_flux(g, i, 0) - flux_(g, i, 0)) /
+                           next_flux(g, i, 0);
+          if ((d <= diff) == false) diff = d;  // Keeps NaN
+        }
+        group_converged[g] = diff < mask_tol ? 1 : 0;
+      }
+    }
+
     // Make sure that the flux is positive everywhere !
     bool set_neg_flux_to_zero = false;
     for (std::size_t i = 0; i < next_flux.size(); i++) {
@@ -387,19 +1320,45 @@ void MOCDriver::solve_isotropic() {
       }
     }
 
-    flux_ = next_flux;
+    xt::noalias(flux_) = next_flux;
+    if (linear) xt::noalias(flux_mom_) = next_flux_mom_;
 
     // Apply CMFD
     if (cmfd_) {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "cmfd");
       cmfd_->solve(*this, prev_keff, iteration);
       if (cmfd_->solved() && mode_ == SimulationMode::Keff) {
         prev_keff = keff_;
         keff_ = cmfd_->keff();
         rel_diff_keff = std::abs(keff_ - prev_keff) / keff_;
       }
+
+      // The flux moments are scaled like the flux they belong to
+      if (linear && cmfd_->solved()) {
+        for (std::size_t g = 0; g < ngroups_; g++) {
+          for (std::size_t i = 0; i < nfsrs_; i++) {
+            if (next_flux(g, i, 0) <= 0.) continue;
+            const double ratio = flux_(g, i, 0) / next_flux(g, i, 0);
+            flux_mom_(g, i, 0) *= ratio;
+            flux_mom_(g, i, 1) *= ratio;
+          }
+        }
+      }
+    }
+
+    // Mix the result of the whole outer iteration, CMFD included
+    if (anderson_enabled()) {
+      pack_anderson_iterate(anderson_gx);
+      anderson.mix(anderson_x, anderson_gx);
+      unpack_anderson_iterate(anderson_x);
     }
 
+    // The last iteration must sweep every group
+    final_sweep = nskipped > 0 && rel_diff_keff <= keff_tol_ &&
+                  max_flx_diff <= flux_tol_;
+
     iteration_timer.stop();
+    telemetry_.add_iteration(max_flx_diff, keff_);
     spdlog::info("-------------------------------------");
     if (mode_ == SimulationMode::Keff) {
       spdlog::info("Iteration {:>4d}          keff: {:.5f}", iteration, keff_);
@@ -408,6 +1367,9 @@ void MOCDriver::solve_isotropic() {
       spdlog::info("Iteration {:>4d}", iteration);
     }
     spdlog::info("     max flux difference: {:.5E}", max_flx_diff);
+    if (masking) {
+      spdlog::info("     group sweeps skipped: {}", nskipped);
+    }
     spdlog::info("     iteration time: {:.5E} s",
                  iteration_timer.elapsed_time());
     if (cmfd_ && cmfd_->solved()) {
@@ -421,18 +1383,224 @@ void MOCDriver::solve_isotropic() {
       spdlog::info("Negative flux values set to zero");
     }
   }
+
+  if (device_.resident()) {
+    device_.download(track_flux_);
+    device_.release();
+  }
+}
+
+std::vector<xt::xtensor<double, 1>> MOCDriver::infinite_medium_spectra()
+    const {
+  // Source spectrum of the whole geometry, which is flat when there is none
+  xt::xtensor<double, 1> s = xt::zeros<double>({ngroups_});
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    const double Vi = fsrs_[i]->volume();
+    const std::size_t m = fsr_xs_indx_[i];
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      s(g) += Vi * (mode_ == SimulationMode::Keff ? mat_chi_(m, g)
+                                                  : extern_src_(g, i));
+    }
+  }
+  if (xt::sum(s)() <= 0.) s.fill(1.);
+
+  const std::size_t nmats = xs_list_.size();
+  std::vector<xt::xtensor<double, 1>> spectra(nmats, s);
+
+#pragma omp parallel for
+  for (int mm = 0; mm < static_cast<int>(nmats); mm++) {
+    const std::size_t m = static_cast<std::size_t>(mm);
+    auto& phi = spectra[m];
+
+    // Gauss-Seidel iterations over the groups, taking the scattering into
+    // each group from the latest fluxes of the other groups. Without
+    // absorption the spectrum never converges, but its shape is still good.
+    for (std::size_t it = 0; it < 100; it++) {
+      double max_diff = 0.;
+      for (std::size_t g = 0; g < ngroups_; g++) {
+        const std::size_t mg = m * ngroups_ + g;
+        double q = s(g);
+        double Es_gg = 0.;
+        for (std::size_t k = mat_scat_offsets_[mg];
+             k < mat_scat_offsets_[mg + 1]; k++) {
+          const std::size_t gg = mat_scat_gin_[k];
+          if (gg == g) {
+            Es_gg += mat_scat_xs_[k];
+          } else {
+            q += mat_scat_xs_[k] * phi(gg);
+          }
+        }
+
+        const double Er = mat_Et_(m, g) - Es_gg;
+        const double phi_g = Er > 0. ? q / Er : q;
+        if (phi_g > 0.) {
+          max_diff = std::max(max_diff, std::abs(phi_g - phi(g)) / phi_g);
+        }
+        phi(g) = phi_g;
+      }
+      if (max_diff < 1.E-8) break;
+    }
+
+    // No group may be empty, as the spectrum weights the condensation
+    const double phi_max = xt::amax(phi)();
+    if (phi_max > 0.) {
+      for (auto& p : phi) p = std::max(p, 1.E-12 * phi_max);
+    } else {
+      phi.fill(1.);
+    }
+  }
+
+  return spectra;
+}
+
+void MOCDriver::coarse_presolve() {
+  SCARABEE_PROFILE_ZONE("MOCDriver::coarse_presolve");
+  const CondensationScheme scheme(presolve_groups_, ngroups_);
+  const std::size_t NG = scheme.ncondensed_groups();
+  spdlog::info("Coarse-group pre-solve in {} groups.", NG);
+
+  const auto spectra = infinite_medium_spectra();
+  auto coarse_xs = condense_cross_sections(xs_list_, spectra, presolve_groups_);
+
+  // Fraction of each macro group held by each of its fine groups
+  auto fractions = [&](const xt::xtensor<double, 1>& phi) {
+    xt::xtensor<double, 1> sum = xt::zeros<double>({NG});
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      sum(scheme.macro_group(g)) += phi(g);
+    }
+    xt::xtensor<double, 1> frac = xt::zeros<double>({ngroups_});
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      const std::size_t G = scheme.macro_group(g);
+      const auto& [g_min, g_max] = scheme.groups()[G];
+      frac(g) = sum(G) > 0. ? phi(g) / sum(G)
+                            : 1. / static_cast<double>(g_max - g_min + 1);
+    }
+    return frac;
+  };
+  std::vector<xt::xtensor<double, 1>> mat_frac;
+  mat_frac.reserve(spectra.size());
+  for (const auto& phi : spectra) mat_frac.push_back(fractions(phi));
+
+  // The fine problem is put back once the coarse one is solved. CMFD, the
+  // device sweep, and the MPI group decomposition are not used, as they were
+  // set up for the fine groups.
+  const std::size_t fine_ngroups = ngroups_;
+  const auto fine_xs = xs_list_;
+  const xt::xtensor<double, 2> fine_extern_src = extern_src_;
+  const auto fine_cmfd = cmfd_;
+  const bool fine_device_sweep = device_sweep_;
+  const bool fine_mpi_groups = mpi_groups_;
+  const std::size_t nrows = track_flux_.shape()[0];
+  const std::size_t npol = track_flux_.shape()[2];
+  auto restore = [&]() {
+    ngroups_ = fine_ngroups;
+    xs_list_ = fine_xs;
+    extern_src_ = fine_extern_src;
+    cmfd_ = fine_cmfd;
+    device_sweep_ = fine_device_sweep;
+    mpi_groups_ = fine_mpi_groups;
+    if (mpi_groups_) partition_tracks();
+    fill_material_tables();
+    fill_exponentials();
+  };
+
+  xt::xtensor<double, 2> coarse_src = xt::zeros<double>({NG, nfsrs_});
+  for (std::size_t g = 0; g < ngroups_; g++) {
+    const std::size_t G = scheme.macro_group(g);
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      coarse_src(G, i) += extern_src_(g, i);
+    }
+  }
+
+  ngroups_ = NG;
+  xs_list_ = std::move(coarse_xs);
+  extern_src_ = std::move(coarse_src);
+  cmfd_ = nullptr;
+  device_sweep_ = false;
+  if (mpi_groups_) {
+    mpi_groups_ = false;
+    partition_tracks();
+  }
+  track_flux_ = xt::xtensor<StoredReal, 3>::from_shape({nrows, NG, npol});
+  try {
+    fill_material_tables();
+    fill_exponentials();
+    solve_isotropic();
+  } catch (...) {
+    restore();
+    track_flux_ =
+        xt::xtensor<StoredReal, 3>::from_shape({nrows, fine_ngroups, npol});
+    track_flux_.fill(StoredReal(0.));
+    throw;
+  }
+
+  const xt::xtensor<double, 3> coarse_flux = std::move(flux_);
+  const xt::xtensor<StoredReal, 3> coarse_track_flux = std::move(track_flux_);
+  const bool linear = source_shape_ == SourceShape::Linear;
+  xt::xtensor<double, 3> coarse_mom;
+  if (linear) coarse_mom = std::move(flux_mom_);
+  const double coarse_keff = keff_;
+  restore();
+
+  // Prolongate the scalar flux with the spectrum of the material of each FSR
+  flux_ = xt::xtensor<double, 3>::from_shape({ngroups_, nfsrs_, 1});
+  if (linear) flux_mom_.resize({ngroups_, nfsrs_, 2});
+#pragma omp parallel for
+  for (int ii = 0; ii < static_cast<int>(nfsrs_); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    const auto& frac = mat_frac[fsr_xs_indx_[i]];
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      const std::size_t G = scheme.macro_group(g);
+      flux_(g, i, 0) = frac(g) * coarse_flux(G, i, 0);
+      if (linear) {
+        flux_mom_(g, i, 0) = frac(g) * coarse_mom(G, i, 0);
+        flux_mom_(g, i, 1) = frac(g) * coarse_mom(G, i, 1);
+      }
+    }
+  }
+
+  // Prolongate the boundary angular fluxes with the spectrum of the whole
+  // geometry, as a track crosses many materials
+  xt::xtensor<double, 1> phi = xt::zeros<double>({ngroups_});
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    const double Vi = fsrs_[i]->volume();
+    for (std::size_t g = 0; g < ngroups_; g++) phi(g) += Vi * flux_(g, i, 0);
+  }
+  const auto frac = fractions(phi);
+  track_flux_ =
+      xt::xtensor<StoredReal, 3>::from_shape({nrows, ngroups_, npol});
+#pragma omp parallel for
+  for (int rr = 0; rr < static_cast<int>(nrows); rr++) {
+    const std::size_t r = static_cast<std::size_t>(rr);
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      const std::size_t G = scheme.macro_group(g);
+      for (std::size_t p = 0; p < npol; p++) {
+        track_flux_(r, g, p) = static_cast<StoredReal>(
+            frac(g) * static_cast<double>(coarse_track_flux(r, G, p)));
+      }
+    }
+  }
+
+  keff_ = coarse_keff;
+  solved_ = true;
 }
 
 // solve for anisotropic
 void MOCDriver::solve_anisotropic() {
+  if (device_sweep_) {
+    spdlog::warn(
+        "The device sweep does not support anisotropic scattering. Sweeping "
+        "on the host.");
+  }
+
   if (solved_ == false) {
     N_lj_ = (max_L_ + 1) * (max_L_ + 1);
     flux_.resize({ngroups_, nfsrs_, N_lj_});
-    flux_.fill(0.);
+    parallel_fill(flux_.data(), flux_.size(), 0.);
   }
-  xt::xtensor<double, 3> src;
+  auto& src = aniso_src_;
   src.resize({ngroups_, nfsrs_, N_lj_});
-  src.fill(0.);
+  parallel_fill(src.data(), src.size(), 0.);
 
   // get the polar angles and azimuthal angle
   // to pre-caluculate the spherical harmonics
@@ -446,6 +1614,7 @@ void MOCDriver::solve_anisotropic() {
   }
 
   sph_harm_ = SphericalHarmonics(max_L_, azimuthal_angles, polar_angles);
+  fill_anisotropic_tables();
 
   // Initialize flux and keff
   if (solved_ == false) {
@@ -456,17 +1625,13 @@ void MOCDriver::solve_anisotropic() {
     }
 
     // Initialize angular flux
-    for (auto& tracks : tracks_) {
-      for (auto& track : tracks) {
-        track.entry_flux().fill(1. / std::sqrt(4. * PI));
-        track.exit_flux().fill(1. / std::sqrt(4. * PI));
-      }
-    }
+    track_flux_.fill(1. / std::sqrt(4. * PI));
 
     keff_ = 1.;
   }
 
-  auto next_flux = flux_;
+  auto& next_flux = next_flux_;
+  next_flux = flux_;
   double prev_keff = keff_;
 
   double rel_diff_keff = 100.;
@@ -479,30 +1644,48 @@ void MOCDriver::solve_anisotropic() {
   double max_flx_diff = 100;
   std::size_t iteration = 0;
   Timer iteration_timer;
+  AndersonMixer anderson(anderson_depth_, anderson_damping_);
+  std::vector<double> anderson_x, anderson_gx;
   while (rel_diff_keff > keff_tol_ || max_flx_diff > flux_tol_) {
     iteration_timer.reset();
     iteration_timer.start();
     iteration++;
+    if (anderson_enabled()) pack_anderson_iterate(anderson_x);
 
-    fill_source_anisotropic(src, flux_);
-    xt::view(src, xt::all(), xt::all(), 0) += extern_src_;
+    fill_fission_source(flux_);
+    if (cmfd_) cmfd_->zero_currents();
 
-    // Check for negative zero moment source values at beginning of simulation
     bool set_neg_src_to_zero = false;
-    if (iteration <= 20) {
-      for (std::size_t g = 0; g < ngroups_; g++) {
-        for (std::size_t i = 0; i < nfsrs_; i++) {
-          if (src(g, i, 0) < 0.) {
-            src(g, i, 0) = 0;
-            set_neg_src_to_zero = true;
+    if (solver_ == TransportSolver::GMRES) {
+      auto full_sweep = [&](const xt::xtensor<double, 3>& in_flux,
+                            xt::xtensor<double, 3>& out_flux) {
+        fill_source_anisotropic(src, in_flux);
+        xt::view(src, xt::all(), xt::all(), 0) += extern_src_;
+        out_flux.fill(0.);
+        sweep_anisotropic(out_flux, src);
+      };
+      next_flux = flux_;
+      solve_krylov(next_flux, full_sweep);
+    } else {
+      fill_source_anisotropic(src, flux_);
+      xt::view(src, xt::all(), xt::all(), 0) += extern_src_;
+
+      // Check for negative zero moment source values at beginning of
+      // simulation
+      if (iteration <= 20) {
+        for (std::size_t g = 0; g < ngroups_; g++) {
+          for (std::size_t i = 0; i < nfsrs_; i++) {
+            if (src(g, i, 0) < 0.) {
+              src(g, i, 0) = 0;
+              set_neg_src_to_zero = true;
+            }
           }
         }
       }
-    }
 
-    next_flux.fill(0.);
-    if (cmfd_) cmfd_->zero_currents();
-    sweep_anisotropic(next_flux, src);
+      next_flux.fill(0.);
+      sweep_anisotropic(next_flux, src);
+    }
 
     // If MOC iterations are skipped compute Keff
     // the normal way
@@ -529,10 +1712,11 @@ void MOCDriver::solve_anisotropic() {
       }
     }
 
-    flux_ = next_flux;
+    xt::noalias(flux_) = next_flux;
 
     // Apply CMFD
     if (cmfd_) {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "cmfd");
       cmfd_->solve(*this, prev_keff, iteration);
       if (cmfd_->solved() && mode_ == SimulationMode::Keff) {
         prev_keff = keff_;
@@ -541,7 +1725,15 @@ void MOCDriver::solve_anisotropic() {
       }
     }
 
+    // Mix the result of the whole outer iteration, CMFD included
+    if (anderson_enabled()) {
+      pack_anderson_iterate(anderson_gx);
+      anderson.mix(anderson_x, anderson_gx);
+      unpack_anderson_iterate(anderson_x);
+    }
+
     iteration_timer.stop();
+    telemetry_.add_iteration(max_flx_diff, keff_);
     spdlog::info("-------------------------------------");
     if (mode_ == SimulationMode::Keff) {
       spdlog::info("Iteration {:>4d}          keff: {:.5f}", iteration, keff_);
@@ -565,422 +1757,1293 @@ void MOCDriver::solve_anisotropic() {
   }
 }
 
-void MOCDriver::sweep(xt::xtensor<double, 3>& sflux,
-                      const xt::xtensor<double, 2>& src) {
-#pragma omp parallel for
-  for (int ig = 0; ig < static_cast<int>(ngroups_); ig++) {
-    std::size_t g = static_cast<std::size_t>(ig);
-
-    // Get the group for CMFD
-    std::size_t G = g;
-    if (cmfd_) G = cmfd_->moc_to_cmfd_group(g);
-
-    for (auto& tracks : tracks_) {
-      for (std::size_t t = 0; t < tracks.size(); t++) {
-        auto& track = tracks[t];
-        const double tw = 4. * PI * track.wgt() *
-                          track.width();  // Azimuthal weight * track width
-
-        // Get the azimuthal angle (phi) and its cosine for CMFD current
-        const Direction u_forw = track.dir();
-        const Direction u_back = -u_forw;
-
-        // Load the angular flux for forward direction
-        htl::static_vector<double, 6> angflux;
-        for (std::size_t p = 0; p < n_pol_angles_; p++)
-          angflux.push_back(track.entry_flux()(g, p));
-
-        // Accumulate entry angular flux into CMFD current
-        if (cmfd_ && track.begin()->entry_cmfd_surface() &&
-            cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-          const auto surf_indx = track.begin()->entry_cmfd_surface();
-          double cmfd_flx = 0.;
-          for (std::size_t p = 0; p < n_pol_angles_; p++) {
-            cmfd_flx += tw * polar_quad_.wsin()[p] * angflux[p];
-          }
-          cmfd_->tally_current(cmfd_flx, u_forw, G, surf_indx);
-        }
+template <typename FullSweep>
+void MOCDriver::solve_krylov(xt::xtensor<double, 3>& flux,
+                             const FullSweep& full_sweep) {
+  // The unknowns are the flux moments, followed by the boundary angular fluxes
+  const std::size_t nflux = flux.size();
+  const std::size_t n = nflux + track_flux_.size();
+  xt::xtensor<double, 3> in_flux(flux.shape());
+  xt::xtensor<double, 3> out_flux(flux.shape());
+
+  // One sweep is an affine function of the unknowns, F(x) = K x + c, and the
+  // solution is the fixed point x = F(x), or (I - K) x = c.
+  auto F = [&](const std::vector<double>& x, std::vector<double>& Fx) {
+    std::copy(x.begin(), x.begin() + nflux, in_flux.begin());
+    std::copy(x.begin() + nflux, x.end(), track_flux_.begin());
+    full_sweep(in_flux, out_flux);
+    std::copy(out_flux.begin(), out_flux.end(), Fx.begin());
+    std::copy(track_flux_.begin(), track_flux_.end(), Fx.begin() + nflux);
+  };
+
+  std::vector<double> x(n, 0.);
+  std::vector<double> c(n);
+  tally_currents_ = false;
+  F(x, c);
+
+  auto A = [&](const std::vector<double>& v, std::vector<double>& Av) {
+    F(v, Av);
+    for (std::size_t i = 0; i < n; i++) Av[i] = v[i] - Av[i] + c[i];
+  };
+
+  std::copy(flux.begin(), flux.end(), x.begin());
+  std::copy(track_flux_.begin(), track_flux_.end(), x.begin() + nflux);
+  const auto res =
+      gmres(A, c, x, krylov_restart_, krylov_tol_, krylov_max_iters_);
+  tally_currents_ = true;
+
+  spdlog::info("     GMRES iterations: {:>4d}, residual: {:.5E}",
+               res.iterations, res.residual);
+  if (res.converged == false) {
+    spdlog::warn("GMRES did not converge in {} iterations.", res.iterations);
+  }
 
-        // Follow track in forward direction
-        for (auto& seg : track) {
-          const auto cmfd_surf = seg.exit_cmfd_surface();
-          const std::size_t i = seg.fsr_indx();
-          const double l = seg.length();
-          const double Et = seg.xs()->Etr(g);
-          const double lEt = l * Et;
-          const double Q = src(g, i);
-          double delta_sum = 0.;
-          double cmfd_flx = 0.;
-          for (std::size_t p = 0; p < n_pol_angles_; p++) {
-            double exp_m1 = mexp(lEt * polar_quad_.invs_sin()[p]);
-            const double delta_flx = (angflux[p] - (Q / Et)) * exp_m1;
-            angflux[p] -= delta_flx;
-            delta_sum += polar_quad_.wsin()[p] * delta_flx;
-            if (cmfd_surf) cmfd_flx += tw * polar_quad_.wsin()[p] * angflux[p];
-          }  // For all polar angles
-
-          if (cmfd_surf &&
-              cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-            cmfd_->tally_current(cmfd_flx, u_forw, G, cmfd_surf);
-          }
+  // A last sweep of the solution gives the CMFD currents
+  std::copy(x.begin(), x.begin() + nflux, in_flux.begin());
+  std::copy(x.begin() + nflux, x.end(), track_flux_.begin());
+  full_sweep(in_flux, flux);
+}
 
-          sflux(g, i, 0) += tw * delta_sum;
-        }  // For all segments along forward direction of track
+template <FluxLayout L, typename TrackSweeper>
+void MOCDriver::sweep_tracks(xt::xtensor<double, 3>& sflux,
+                             const TrackSweeper& sweeper, std::size_t g_begin,
+                             std::size_t g_end) {
+  // With the group decomposition, this rank only sweeps its own block of
+  // groups, and the other blocks are gathered from their ranks
+  const std::size_t g_first = std::clamp(rank_groups_begin_, g_begin, g_end);
+  const std::size_t g_last = std::clamp(rank_groups_end_, g_first, g_end);
+
+  // A single group has nothing to distribute over the groups, so the tracks
+  // are distributed instead.
+  if (L == FluxLayout::GroupMajor && sweeps_by_group(g_first, g_last)) {
+    auto sweep_group = [&](std::size_t g) {
+      if (bundle_tracks_.empty() == false) {
+        for (const std::size_t tt : bundle_tracks_) {
+          if (track_swept(tt) == false) continue;
+          const std::size_t a = seg_store_.angle_index(tt);
+          auto& track = tracks_[a][tt - seg_store_.track_index(a, 0)];
+          sweeper(track, tt, g, true, &track_flux_(track.entry_flux(), g, 0),
+                  sflux);
+          sweeper(track, tt, g, false, &track_flux_(track.exit_flux(), g, 0),
+                  sflux);
+        }  // For all tracks, bundle by bundle
+        return;
+      }
 
-        // Set incoming flux for next track
-        if (track.exit_bc() == BoundaryCondition::Vacuum) {
-          xt::view(track.exit_track_flux(), g, xt::all()).fill(0.);
-        } else {
-          for (std::size_t p = 0; p < n_pol_angles_; p++) {
-            track.exit_track_flux()(g, p) = angflux[p];
-          }
+      for (std::size_t a = 0; a < tracks_.size(); a++) {
+        auto& tracks = tracks_[a];
+        for (std::size_t t = 0; t < tracks.size(); t++) {
+          auto& track = tracks[t];
+          const std::size_t tt = seg_store_.track_index(a, t);
+          if (tt < rank_tracks_begin_ || tt >= rank_tracks_end_) continue;
+          if (track_swept(tt) == false) continue;
+          sweeper(track, tt, g, true, &track_flux_(track.entry_flux(), g, 0),
+                  sflux);
+          sweeper(track, tt, g, false, &track_flux_(track.exit_flux(), g, 0),
+                  sflux);
+        }  // For all tracks
+      }  // For all azimuthal angles
+    };
+
+    if (reproducible_reductions()) {
+      // Each group is tallied by a single thread, but the groups which
+      // share a CMFD group add to the same current buffers. Blocks of
+      // consecutive groups are therefore swept in order, each into the
+      // current buffers of its block.
+      const std::size_t ng = g_last - g_first;
+      const std::size_t nblocks = std::min(reduction_blocks(), ng);
+#pragma omp parallel for schedule(dynamic)
+      for (int ib = 0; ib < static_cast<int>(nblocks); ib++) {
+        const std::size_t b = static_cast<std::size_t>(ib);
+        ReductionBlock block(b);
+        for (std::size_t g = g_first + b * ng / nblocks;
+             g < g_first + (b + 1) * ng / nblocks; g++) {
+          sweep_group(g);
         }
+      }
+    } else {
+#pragma omp parallel for
+      for (int ig = static_cast<int>(g_first); ig < static_cast<int>(g_last);
+           ig++) {
+        sweep_group(static_cast<std::size_t>(ig));
+      }  // For all groups
+    }
+  } else if (g_first < g_last) {
+    sweep_tracks_parallel<L>(sflux, sweeper, g_first, g_last);
+  }
 
-        // Follow track in backwards direction
-        // First, load the backwards angular flux
-        for (std::size_t p = 0; p < n_pol_angles_; p++)
-          angflux[p] = track.exit_flux()(g, p);
-
-        // Accumulate entry angular flux into CMFD current for backwards
-        // direction
-        if (cmfd_ && track.rbegin()->exit_cmfd_surface() &&
-            cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-          auto surf_indx = track.rbegin()->exit_cmfd_surface();
-          double cmfd_flx = 0.;
-          for (std::size_t p = 0; p < n_pol_angles_; p++) {
-            cmfd_flx += tw * polar_quad_.wsin()[p] * angflux[p];
-          }
-          cmfd_->tally_current(cmfd_flx, u_back, G, surf_indx);
-        }
+  // Add the tracks or gather the groups swept by the other ranks
+  if (mpi_size() > 1) exchange_sweep(sflux, g_begin, g_end);
 
-        // Iterate over segments in backwards direction
-        for (auto seg_it = track.rbegin(); seg_it != track.rend(); seg_it++) {
-          auto& seg = *seg_it;
-          const auto cmfd_surf = seg.entry_cmfd_surface();
-          const std::size_t i = seg.fsr_indx();
-          const double l = seg.length();
-          const double Et = seg.xs()->Etr(g);
-          const double lEt = l * Et;
-          const double Q = src(g, i);
-          double delta_sum = 0.;
-          double cmfd_flx = 0.;
-          for (std::size_t p = 0; p < n_pol_angles_; p++) {
-            double exp_m1 = mexp(lEt * polar_quad_.invs_sin()[p]);
-            const double delta_flx = (angflux[p] - (Q / Et)) * exp_m1;
-            angflux[p] -= delta_flx;
-            delta_sum += polar_quad_.wsin()[p] * delta_flx;
-            if (cmfd_surf) cmfd_flx += tw * polar_quad_.wsin()[p] * angflux[p];
-          }  // For all polar angles
-          if (cmfd_surf &&
-              cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-            cmfd_->tally_current(cmfd_flx, u_back, G, cmfd_surf);
-          }
+  // Add the tallies of the tracks which were skipped by symmetry
+  if (track_swept_.empty() == false) apply_symmetry(sflux, g_begin, g_end);
 
-          sflux(g, i, 0) += tw * delta_sum;
-        }  // For all segments along forward direction of track
+  // Merge the thread-private CMFD currents
+  if (cmfd_) cmfd_->reduce_currents();
+}
 
-        // Set incoming flux for next track
-        if (track.entry_bc() == BoundaryCondition::Vacuum) {
-          xt::view(track.entry_track_flux(), g, xt::all()).fill(0.);
-        } else {
-          for (std::size_t p = 0; p < n_pol_angles_; p++) {
-            track.entry_track_flux()(g, p) = angflux[p];
+template <FluxLayout L, typename TrackSweeper>
+void MOCDriver::sweep_tracks_parallel(xt::xtensor<double, 3>& sflux,
+                                      const TrackSweeper& sweeper,
+                                      std::size_t g_begin, std::size_t g_end) {
+  // Chains cross the track ranges of the ranks, so they are only used on a
+  // single rank. They also link the tracks which are skipped by symmetry.
+  const bool by_chains = sweep_par_ == SweepParallelism::Chains &&
+                         mpi_size() == 1 && track_swept_.empty();
+
+  // Tracks write their outgoing flux directly into the incoming flux of the
+  // next track. When sweeping by track, we therefore first copy all incoming
+  // fluxes, so that every track reads the values of the previous sweep,
+  // regardless of the order in which the threads sweep the tracks. Chains
+  // need no copy, as a link only reads the flux written by the previous
+  // link of the same chain. Open chains start from a vacuum boundary, and
+  // read a zero flux instead of a row which is written by another chain.
+  if (by_chains == false) {
+    if (boundary_flux_.shape() != track_flux_.shape()) {
+      boundary_flux_.resize(track_flux_.shape());
+      parallel_fill(boundary_flux_.data(), boundary_flux_.size(),
+                    StoredReal(0.));
+    }
+    xt::view(boundary_flux_, xt::all(), xt::range(g_begin, g_end), xt::all()) =
+        xt::view(track_flux_, xt::all(), xt::range(g_begin, g_end), xt::all());
+  }
+  const std::vector<StoredReal> zero_flux(n_pol_angles_, 0.);
+
+  auto get_track = [this](std::size_t tt) -> Track& {
+    const std::size_t a = seg_store_.angle_index(tt);
+    return tracks_[a][tt - seg_store_.track_index(a, 0)];
+  };
+
+  // Sweeps a track with the incoming fluxes of the previous sweep
+  auto sweep_copied = [&](std::size_t tt, xt::xtensor<double, 3>& tflux) {
+    if (track_swept(tt) == false) return;
+    auto& track = get_track(tt);
+    for (std::size_t g = g_begin; g < g_end; g++) {
+      sweeper(track, tt, g, true, &boundary_flux_(track.entry_flux(), g, 0),
+              tflux);
+      sweeper(track, tt, g, false, &boundary_flux_(track.exit_flux(), g, 0),
+              tflux);
+    }
+  };
+
+  // Sweeps chain k, bundle k, or the k-th track of the rank, into tflux
+  const bool by_bundles = by_chains == false && bundle_tracks_.empty() == false;
+  auto sweep_item = [&](std::size_t k, xt::xtensor<double, 3>& tflux) {
+    if (by_chains) {
+      const std::size_t c = k;
+      for (std::size_t g = g_begin; g < g_end; g++) {
+        for (std::size_t l = chains_.links_begin(c); l < chains_.links_end(c);
+             l++) {
+          const std::size_t tt = chains_.track(l);
+          const StoredReal* in_flx = &track_flux_(chains_.row(l), g, 0);
+          if (l == chains_.links_begin(c) && chains_.open(c)) {
+            in_flx = zero_flux.data();
           }
-        }
-      }  // For all tracks
-    }  // For all azimuthal angles
+          sweeper(get_track(tt), tt, g, chains_.forward(l), in_flx, tflux);
+        }  // For all links of the chain
+      }  // For all groups
+    } else if (by_bundles) {
+      for (std::size_t b = bundle_offsets_[k]; b < bundle_offsets_[k + 1];
+           b++) {
+        sweep_copied(bundle_tracks_[b], tflux);
+      }
+    } else {
+      sweep_copied(rank_tracks_begin_ + k, tflux);
+    }
+  };
+  std::size_t nitems = rank_tracks_end_ - rank_tracks_begin_;
+  if (by_chains) {
+    nitems = chains_.nchains();
+  } else if (by_bundles) {
+    nitems = bundle_offsets_.size() - 1;
+  }
 
-    for (std::size_t i = 0; i < nfsrs_; i++) {
-      const auto& mat = *fsrs_[i]->xs();
-      const double Vi = fsrs_[i]->volume();
-      const double Et = mat.Etr(g);
-      sflux(g, i, 0) *= 1. / (Vi * Et);
-      sflux(g, i, 0) += 4. * PI * src(g, i) / Et;
+  auto zero_buffer = [&](xt::xtensor<double, 3>& tflux) {
+    if constexpr (L == FluxLayout::GroupMajor) {
+      if (tflux.shape() != sflux.shape()) tflux.resize(sflux.shape());
+      xt::view(tflux, xt::range(g_begin, g_end), xt::all(), xt::all())
+          .fill(0.);
+    } else {
+      const std::array<std::size_t, 3> shape{sflux.shape()[1],
+                                             sflux.shape()[0],
+                                             sflux.shape()[2]};
+      if (tflux.shape() != shape) tflux.resize(shape);
+      xt::view(tflux, xt::all(), xt::range(g_begin, g_end), xt::all())
+          .fill(0.);
     }
-  }  // For all groups
-}
+  };
+
+  // The runtime may give us fewer threads than the maximum, so we keep track
+  // of which buffers were used
+  const bool reproducible = reproducible_reductions();
+  thread_sflux_.resize(reproducible ? reduction_blocks() : max_threads());
+  std::vector<char> thread_used(thread_sflux_.size(), 0);
+  if (reproducible) {
+    // Each block of consecutive chains or tracks is swept in order into its
+    // own buffer, whichever thread sweeps it, so that the tallies do not
+    // depend on the number of threads
+    const std::size_t nblocks = thread_sflux_.size();
+#pragma omp parallel for schedule(dynamic)
+    for (int ib = 0; ib < static_cast<int>(nblocks); ib++) {
+      const std::size_t b = static_cast<std::size_t>(ib);
+      ReductionBlock block(b);
+      thread_used[b] = 1;
+      auto& tflux = thread_sflux_[b];
+      zero_buffer(tflux);
+      for (std::size_t k = b * nitems / nblocks;
+           k < (b + 1) * nitems / nblocks; k++) {
+        sweep_item(k, tflux);
+      }
+    }
+  } else {
+    // Each thread zeros its own buffer
+#pragma omp parallel
+    {
+      const std::size_t thrd = thread_index();
+      thread_used[thrd] = 1;
+      auto& tflux = thread_sflux_[thrd];
+      zero_buffer(tflux);
+
+#pragma omp for schedule(dynamic)
+      for (int ik = 0; ik < static_cast<int>(nitems); ik++) {
+        sweep_item(static_cast<std::size_t>(ik), tflux);
+      }
+    }
+  }
 
-// anisotropic sweep
-void MOCDriver::sweep_anisotropic(xt::xtensor<double, 3>& sflux,
-                                  const xt::xtensor<double, 3>& src) {
+  // Reduce the thread-private scalar fluxes
 #pragma omp parallel for
-  for (int ig = 0; ig < static_cast<int>(ngroups_); ig++) {
-    std::size_t g = static_cast<std::size_t>(ig);
-
-    // Get the group for CMFD
-    std::size_t G = g;
-    if (cmfd_) G = cmfd_->moc_to_cmfd_group(g);
-
-    for (auto& tracks : tracks_) {
-      for (std::size_t t = 0; t < tracks.size(); t++) {
-        auto& track = tracks[t];
-        htl::static_vector<double, 12> angflux;
-        for (std::size_t pp = 0; pp < n_pol_angles_; pp++)
-          angflux.push_back(track.entry_flux()(g, pp));
-        const double tw = 4. * PI * track.wgt() *
-                          track.width();  // Azimuthal weight * track width
-
-        // Get the azimuthal angle (phi) and its cosine for CMFD current
-        const Direction u_forw = track.dir();
-        const Direction u_back = -u_forw;
-
-        // Accumulate entry angular flux into CMFD current
-        if (cmfd_ && track.begin()->entry_cmfd_surface() &&
-            cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-          const auto surf_indx = track.begin()->entry_cmfd_surface();
-          double cmfd_flx = 0.;
-          std::size_t p = 0;
-          for (std::size_t pp = 0; pp < n_pol_angles_; pp++) {
-            if (pp < n_pol_angles_ / 2) {
-              p = pp;
-            } else {
-              p = pp - n_pol_angles_ / 2;
-            }
-            cmfd_flx += polar_quad_.wsin()[p] * angflux[pp];
-          }
-          cmfd_->tally_current(INVS_4SQRTPI * tw * cmfd_flx, u_forw, G,
-                               surf_indx);
+  for (int ig = static_cast<int>(g_begin); ig < static_cast<int>(g_end);
+       ig++) {
+    const std::size_t g = static_cast<std::size_t>(ig);
+    for (std::size_t thrd = 0; thrd < thread_sflux_.size(); thrd++) {
+      if (thread_used[thrd] == 0) continue;
+      const auto& tflux = thread_sflux_[thrd];
+      for (std::size_t i = 0; i < nfsrs_; i++) {
+        for (std::size_t lj = 0; lj < sflux.shape()[2]; lj++) {
+          sflux(g, i, lj) += layout_at<L>(tflux, g, i, lj);
         }
+      }
+    }
+  }
+}
 
-        // Follow track in forward direction
-        for (auto& seg : track) {
-          const auto cmfd_surf = seg.exit_cmfd_surface();
-          const std::size_t i = seg.fsr_indx();
-          const double l = seg.length();
-          const double Et = seg.xs()->Et(g);
-          const double lEt = l * Et;
-          const std::size_t phi_forward_index = track.phi_index_forward();
-          double cmfd_flx = 0.;
-          // loop over all polar angles
-          std::size_t p = 0;  // index for polar angle
-          for (std::size_t pp = 0; pp < n_pol_angles_; pp++) {
-            if (pp < n_pol_angles_ / 2) {
-              p = pp;
-            } else {
-              p = pp - n_pol_angles_ / 2;
-            }
-
-            double Q = 0.;
-            std::span<const double> Y_ljs =
-                sph_harm_.spherical_harmonics(phi_forward_index, pp);
-            for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
-              Q += src(g, i, it_lj) * Y_ljs[it_lj];
-            }
+template <FluxLayout L>
+void MOCDriver::sweep_track(Track& track, std::size_t tt, std::size_t g,
+                            bool forward, const StoredReal* in_flx,
+                            xt::xtensor<double, 3>& sflux,
+                            const xt::xtensor<double, 2>& src) {
+  // Get the group for CMFD
+  std::size_t G = g;
+  if (cmfd_) G = cmfd_->moc_to_cmfd_group(g);
+  const bool tally_cmfd =
+      cmfd_ && tally_currents_ &&
+      cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations();
+
+  const double tw = 4. * PI * track.wgt() *
+                    track.width();  // Azimuthal weight * track width
+
+  // Get the azimuthal angle (phi) and its cosine for CMFD current
+  const Direction u_forw = track.dir();
+  const Direction u_back = -u_forw;
+
+  // Range of packed segments and CMFD crossings for this track, which is
+  // traced again when the segments are not stored
+  const SegmentStore& segs = track_segments(track, tt);
+  const std::size_t s_begin = segs.segments_begin(tt);
+  const std::size_t s_end = segs.segments_end(tt);
+  const std::size_t c_begin = segs.crossings_begin(tt);
+  const std::size_t c_end = segs.crossings_end(tt);
+  const std::size_t nsegs = s_end - s_begin;
+
+  const auto& invs_sin = polar_quad_.invs_sin();
+  const auto& wsin = polar_quad_.wsin();
+  const std::size_t npol = invs_sin.size();
+
+  // Work arrays of each thread, with the segments in the order of the sweep
+  thread_local std::vector<double> angflux;
+  thread_local std::vector<double> lEt;
+  thread_local std::vector<double> Q_Et;
+  thread_local std::vector<double> exp_buf;
+  thread_local std::vector<double> delta;
+  angflux.resize(npol);
+  lEt.resize(nsegs);
+  Q_Et.resize(nsegs);
+  delta.resize(nsegs);
+  auto segment = [&](std::size_t k) {
+    return forward ? s_begin + k : s_end - 1 - k;
+  };
+
+  // Load the incoming angular flux
+  for (std::size_t p = 0; p < npol; p++) angflux[p] = in_flx[p];
+
+  for (std::size_t k = 0; k < nsegs; k++) {
+    const std::size_t s = segment(k);
+    const std::size_t i = segs.fsr_indx(s);
+    const std::size_t m = segs.xs_indx(s);
+    lEt[k] = segs.length(s) * mat_Et_(m, g);
+    Q_Et[k] = layout_at<L>(src, g, i) * mat_invs_Et_(m, g);
+  }
 
-            const double exp_m1 = mexp(lEt * polar_quad_.invs_sin()[p]);
-            const double delta_flx = (angflux[pp] - (Q / Et)) * exp_m1;
-            angflux[pp] -= delta_flx;
-            const double delta_sum = polar_quad_.wsin()[p] * delta_flx;
+  // The kernel evaluates the rational exponential itself, unless the
+  // exponentials are precomputed or tabulated
+  const double* exp_m1 = nullptr;
+  std::ptrdiff_t exp_stride = static_cast<std::ptrdiff_t>(npol);
+  if (exp_store_.empty() == false && nsegs > 0) {
+    exp_m1 = &exp_store_[(g * segs.nsegments() + segment(0)) * npol];
+    if (forward == false) exp_stride = -exp_stride;
+  } else if (exp_mode_ == ExponentialMode::Table) {
+    exp_buf.resize(nsegs * npol);
+    for (std::size_t k = 0; k < nsegs; k++) {
+      for (std::size_t p = 0; p < npol; p++) {
+        exp_buf[k * npol + p] = exp_table_(lEt[k] * invs_sin[p]);
+      }
+    }
+    exp_m1 = exp_buf.data();
+  }
 
-            for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
-              sflux(g, i, it_lj) += tw *
-                                    (delta_sum + l * Q * polar_quad_.wgt()[p]) *
-                                    Y_ljs[it_lj] * 0.5;
-            }
+  // Attenuates the segments k_begin to k_end of the sweep, and returns the
+  // weighted sum of the angular flux at the end, for the CMFD currents
+  std::size_t k_done = 0;
+  auto attenuate = [&](std::size_t k_end) {
+    const double* e =
+        exp_m1 ? exp_m1 + static_cast<std::ptrdiff_t>(k_done) * exp_stride
+               : nullptr;
+    attenuate_segments(npol, invs_sin.data(), wsin.data(), angflux.data(),
+                       lEt.data() + k_done, Q_Et.data() + k_done, e,
+                       exp_stride, k_end - k_done, delta.data() + k_done);
+    k_done = k_end;
+
+    double cur = 0.;
+    for (std::size_t p = 0; p < npol; p++) cur += wsin[p] * angflux[p];
+    return cur;
+  };
+
+  // Tallies the current of the angular flux at a CMFD surface, and its
+  // contribution to the surface flux when requested
+  const bool tally_sflux = tally_cmfd && cmfd_->surface_flux_tally();
+  auto tally_surface = [&](double cur, const Direction& u,
+                           const CMFDSurfaceTally& surf) {
+    cmfd_->tally_current(tw * cur, u, G, surf);
+    if (tally_sflux) {
+      double flx = 0.;
+      for (std::size_t p = 0; p < npol; p++) {
+        flx += wsin[p] * invs_sin[p] * angflux[p];
+      }
+      cmfd_->tally_surface_flux(tw * flx, u, G, surf);
+    }
+  };
+
+  // The segments are attenuated in runs, between the CMFD surfaces where
+  // the current is tallied
+  if (tally_cmfd && forward) {
+    // Accumulate entry angular flux into CMFD current
+    if (c_begin < c_end && segs.crossing(c_begin).segment == s_begin &&
+        segs.crossing(c_begin).entry) {
+      const auto& surf_indx = segs.crossing(c_begin).entry;
+      tally_surface(attenuate(0), u_forw, surf_indx);
+    }
 
-            if (cmfd_surf) cmfd_flx += polar_quad_.wsin()[p] * angflux[pp];
+    for (std::size_t c = c_begin; c < c_end; c++) {
+      const auto& exit_surf = segs.crossing(c).exit;
+      if (!exit_surf) continue;
+      const std::size_t k_end = segs.crossing(c).segment - s_begin + 1;
+      tally_surface(attenuate(k_end), u_forw, exit_surf);
+    }
+  } else if (tally_cmfd) {
+    // Accumulate entry angular flux into CMFD current for backwards direction
+    if (c_end > c_begin &&
+        segs.crossing(c_end - 1).segment + 1 == s_end &&
+        segs.crossing(c_end - 1).exit) {
+      const auto& surf_indx = segs.crossing(c_end - 1).exit;
+      tally_surface(attenuate(0), u_back, surf_indx);
+    }
 
-          }  // For all polar angles
+    for (std::size_t c = c_end; c-- > c_begin;) {
+      const auto& entry_surf = segs.crossing(c).entry;
+      if (!entry_surf) continue;
+      const std::size_t k_end = s_end - segs.crossing(c).segment;
+      tally_surface(attenuate(k_end), u_back, entry_surf);
+    }
+  }
+  attenuate(nsegs);
 
-          if (cmfd_surf &&
-              cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-            cmfd_->tally_current(INVS_4SQRTPI * tw * cmfd_flx, u_forw, G,
-                                 cmfd_surf);
-          }
-        }  // For all segments along forward direction of track
+  for (std::size_t k = 0; k < nsegs; k++) {
+    layout_at<L>(sflux, g, segs.fsr_indx(segment(k)), 0) +=
+        tw * delta[k];
+  }
 
-        // Set incoming flux for next track
-        if (track.exit_bc() == BoundaryCondition::Vacuum) {
-          xt::view(track.exit_track_flux(), g, xt::all()).fill(0.);
-        } else {
-          for (std::size_t pp = 0; pp < n_pol_angles_; pp++) {
-            track.exit_track_flux()(g, pp) = angflux[pp];
-          }
-        }
+  // Set incoming flux for next track
+  const bool vacuum = forward ? track.exit_bc() == BoundaryCondition::Vacuum
+                              : track.entry_bc() == BoundaryCondition::Vacuum;
+  StoredReal* out_flx = &track_flux_(
+      forward ? track.exit_track_flux() : track.entry_track_flux(), g, 0);
+  for (std::size_t p = 0; p < npol; p++) {
+    out_flx[p] = vacuum ? StoredReal(0.) : static_cast<StoredReal>(angflux[p]);
+  }
+}
 
-        // Follow track in backwards direction
-        for (std::size_t pp = 0; pp < n_pol_angles_; pp++)
-          angflux[pp] = track.exit_flux()(g, pp);
-
-        // Accumulate entry angular flux into CMFD current for backwards
-        // direction
-        if (cmfd_ && track.rbegin()->exit_cmfd_surface() &&
-            cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-          auto surf_indx = track.rbegin()->exit_cmfd_surface();
-          double cmfd_flx = 0.;
-          std::size_t p = 0;
-          for (std::size_t pp = 0; pp < n_pol_angles_; pp++) {
-            if (pp < n_pol_angles_ / 2) {
-              p = pp;
-            } else {
-              p = pp - n_pol_angles_ / 2;
-            }
-            cmfd_flx += polar_quad_.wsin()[p] * angflux[pp];
-          }
-          cmfd_->tally_current(INVS_4SQRTPI * tw * cmfd_flx, u_back, G,
-                               surf_indx);
-        }
+void MOCDriver::partition_tracks() {
+  const std::size_t nranks = mpi_size();
+  const std::size_t rank = mpi_rank();
+
+  // With the group decomposition, each rank sweeps all tracks for a
+  // contiguous block of groups. All groups have the same number of segments.
+  group_offsets_.clear();
+  rank_groups_begin_ = 0;
+  rank_groups_end_ = std::numeric_limits<std::size_t>::max();
+  if (mpi_groups_) {
+    for (std::size_t r = 0; r <= nranks; r++) {
+      group_offsets_.push_back(ngroups_ * r / nranks);
+    }
+    rank_groups_begin_ = group_offsets_[rank];
+    rank_groups_end_ = group_offsets_[rank + 1];
+    rank_tracks_begin_ = 0;
+    rank_tracks_end_ = seg_store_.ntracks();
+    rank_rows_.assign(track_flux_.shape()[0], 1);
+
+    if (nranks > 1) {
+      spdlog::info("Rank {} sweeps groups {} to {}.", rank,
+                   rank_groups_begin_, rank_groups_end_);
+    }
+    build_sweep_bundles();
+    return;
+  }
 
-        for (auto seg_it = track.rbegin(); seg_it != track.rend(); seg_it++) {
-          auto& seg = *seg_it;
-          const auto cmfd_surf = seg.entry_cmfd_surface();
-          const std::size_t i = seg.fsr_indx();
-          const double l = seg.length();
-          const double Et = seg.xs()->Et(g);
-          const double lEt = l * Et;
-          const std::size_t phi_backward_index = track.phi_index_backward();
-          double cmfd_flx = 0.;
-          // loop over all polar angles
-          std::size_t p = 0;
-          for (std::size_t pp = 0; pp < n_pol_angles_; pp++) {
-            if (pp < n_pol_angles_ / 2) {
-              p = pp;
-            } else {
-              p = pp - n_pol_angles_ / 2;
-            }
+  // Each rank sweeps a contiguous range of tracks, holding about the same
+  // number of segments.
+  const std::size_t ntracks = seg_store_.ntracks();
+  const std::size_t nsegs = seg_store_.nsegments();
+  auto first_track = [&](std::size_t r) {
+    if (r == nranks) return ntracks;
+    const std::size_t target = nsegs * r / nranks;
+    std::size_t tt = 0;
+    while (tt < ntracks && seg_store_.segments_begin(tt) < target) tt++;
+    return tt;
+  };
+  rank_tracks_begin_ = first_track(rank);
+  rank_tracks_end_ = first_track(rank + 1);
+
+  // Boundary flux rows written by the tracks of this rank
+  rank_rows_.assign(track_flux_.shape()[0], 0);
+  for (std::size_t a = 0; a < tracks_.size(); a++) {
+    for (std::size_t t = 0; t < tracks_[a].size(); t++) {
+      const std::size_t tt = seg_store_.track_index(a, t);
+      if (tt < rank_tracks_begin_ || tt >= rank_tracks_end_) continue;
+      rank_rows_[tracks_[a][t].exit_track_flux()] = 1;
+      rank_rows_[tracks_[a][t].entry_track_flux()] = 1;
+    }
+  }
 
-            // source term evaluation for given azimuthal and polar angle
-            double Q = 0.;
-            std::span<const double> Y_ljs =
-                sph_harm_.spherical_harmonics(phi_backward_index, pp);
-            for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
-              Q += src(g, i, it_lj) * Y_ljs[it_lj];
-            }
+  if (nranks > 1) {
+    spdlog::info("Rank {} sweeps tracks {} to {}.", rank, rank_tracks_begin_,
+                 rank_tracks_end_);
+  }
+  build_sweep_bundles();
+}
 
-            const double exp_m1 = mexp(lEt * polar_quad_.invs_sin()[p]);
-            const double delta_flx = (angflux[pp] - (Q / Et)) * exp_m1;
-            angflux[pp] -= delta_flx;
-            const double delta_sum = polar_quad_.wsin()[p] * delta_flx;
+void MOCDriver::build_sweep_bundles() {
+  bundle_tracks_.clear();
+  bundle_offsets_.clear();
+  if (bundled_sweep_ == false) return;
+
+  bundle_offsets_.push_back(0);
+  std::vector<std::pair<double, std::size_t>> order;
+  for (std::size_t a = 0; a < tracks_.size(); a++) {
+    // Parallel tracks are sorted by their signed distance to the origin,
+    // so that consecutive tracks are neighbors, whichever boundary they
+    // start from
+    order.clear();
+    for (std::size_t t = 0; t < tracks_[a].size(); t++) {
+      const std::size_t tt = seg_store_.track_index(a, t);
+      if (tt < rank_tracks_begin_ || tt >= rank_tracks_end_) continue;
+      const auto& track = tracks_[a][t];
+      const double phi = track.phi();
+      const double p = track.entry_pos().y() * std::cos(phi) -
+                       track.entry_pos().x() * std::sin(phi);
+      order.emplace_back(p, tt);
+    }
+    std::sort(order.begin(), order.end());
+
+    std::size_t nsegs = 0;
+    for (const auto& pt : order) {
+      const std::size_t tt = pt.second;
+      bundle_tracks_.push_back(tt);
+      nsegs += seg_store_.segments_end(tt) - seg_store_.segments_begin(tt);
+      if (nsegs >= BUNDLE_SEGMENTS) {
+        bundle_offsets_.push_back(bundle_tracks_.size());
+        nsegs = 0;
+      }
+    }
+    if (bundle_offsets_.back() != bundle_tracks_.size()) {
+      bundle_offsets_.push_back(bundle_tracks_.size());
+    }
+  }
+}
 
-            for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
-              sflux(g, i, it_lj) += tw *
-                                    (delta_sum + l * Q * polar_quad_.wgt()[p]) *
-                                    Y_ljs[it_lj] * 0.5;
-            }
+std::size_t MOCDriver::swept_segments() const {
+  std::size_t nsegs = 0;
+  for (std::size_t tt = rank_tracks_begin_; tt < rank_tracks_end_; tt++) {
+    if (track_swept(tt) == false) continue;
+    nsegs += seg_store_.segments_end(tt) - seg_store_.segments_begin(tt);
+  }
+  return nsegs;
+}
 
-            if (cmfd_surf) cmfd_flx += polar_quad_.wsin()[p] * angflux[pp];
+void MOCDriver::record_memory() const {
+  for (const auto& [component, bytes] : memory_usage()) {
+    telemetry_.record_memory(component, bytes);
+  }
+}
 
-          }  // For all polar angles
+MemoryUsage MOCDriver::memory_usage() const {
+  MemoryUsage usage;
 
-          if (cmfd_surf &&
-              cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations()) {
-            cmfd_->tally_current(INVS_4SQRTPI * tw * cmfd_flx, u_back, G,
-                                 cmfd_surf);
-          }
-        }  // For all segments along forward direction of track
+  std::size_t track_bytes = array_bytes(tracks_) + array_bytes(angle_info_);
+  for (const auto& tracks : tracks_) {
+    for (const auto& track : tracks) {
+      track_bytes += array_bytes(track.segments());
+    }
+  }
+  usage["tracks"] = track_bytes;
+  std::size_t otf_bytes = array_bytes(otf_renorm_);
+  for (const auto& buf : otf_buffers_) {
+    otf_bytes += array_bytes(buf.segments) + buf.store.memory_bytes();
+  }
+  usage["segments"] = seg_store_.memory_bytes() + chains_.memory_bytes() +
+                      array_bytes(seg_midpoints_) + array_bytes(track_swept_) +
+                      array_bytes(bundle_tracks_) +
+                      array_bytes(bundle_offsets_) + otf_bytes;
+
+  std::size_t angular_flux =
+      array_bytes(track_flux_) + array_bytes(boundary_flux_) +
+      array_bytes(exchange_buf_) + array_bytes(rank_rows_);
+  std::size_t scalar_flux = array_bytes(flux_) + array_bytes(next_flux_) +
+                            array_bytes(thread_sflux_);
+  for (const auto& rec : history_) {
+    angular_flux += array_bytes(rec.track_flux);
+    scalar_flux += array_bytes(rec.flux);
+  }
+  usage["angular_flux"] = angular_flux;
+  usage["scalar_flux"] = scalar_flux;
+
+  usage["source"] = array_bytes(extern_src_) + array_bytes(iso_src_) +
+                    array_bytes(sweep_src_) + array_bytes(aniso_src_) +
+                    array_bytes(fission_src_) + array_bytes(ang_src_) +
+                    array_bytes(aniso_ylj_) + array_bytes(stab_D_);
+  usage["linear_source"] =
+      array_bytes(fsr_centroids_) + array_bytes(fsr_inv_moments_) +
+      array_bytes(flux_mom_) + array_bytes(next_flux_mom_) +
+      array_bytes(src_grad_) + array_bytes(ls_tally_) +
+      array_bytes(fission_src_mom_);
+  usage["exponentials"] =
+      array_bytes(exp_store_) + 2 * exp_table_.size() * sizeof(double);
+
+  std::size_t xs_bytes = array_bytes(fsr_xs_indx_) + array_bytes(mat_Et_) +
+                         array_bytes(mat_invs_Et_) + array_bytes(mat_vEf_) +
+                         array_bytes(mat_chi_) + array_bytes(mat_scat_xs_) +
+                         array_bytes(mat_scat_offsets_) +
+                         array_bytes(mat_scat_gin_);
+  for (const auto& xs : xs_list_) xs_bytes += total_bytes(xs->memory_usage());
+  usage["xs"] = xs_bytes;
+
+  usage["fsrs"] = array_bytes(fsrs_) + array_bytes(fsr_mirror_) +
+                  array_bytes(sym_row_copies_) +
+                  array_bytes(fsr_offsets_);
+
+  if (cmfd_) usage["cmfd"] = total_bytes(cmfd_->memory_usage());
+
+  return usage;
+}
 
-        // Set incoming flux for next track
-        if (track.entry_bc() == BoundaryCondition::Vacuum) {
-          xt::view(track.entry_track_flux(), g, xt::all()).fill(0.);
-        } else {
-          for (std::size_t pp = 0; pp < n_pol_angles_; pp++) {
-            track.entry_track_flux()(g, pp) = angflux[pp];
-          }
+void MOCDriver::exchange_sweep(xt::xtensor<double, 3>& sflux,
+                               std::size_t g_begin, std::size_t g_end) {
+  // The scalar fluxes of the swept groups are contiguous
+  const std::size_t ngr = g_end - g_begin;
+  const std::size_t group_size = sflux.shape()[1] * sflux.shape()[2];
+
+  if (mpi_groups_) {
+    // Each rank holds the complete tallies of its own groups, and the
+    // boundary fluxes of a group are only read by the rank which sweeps it
+    std::vector<std::size_t> offsets(group_offsets_.size());
+    for (std::size_t r = 0; r < offsets.size(); r++) {
+      offsets[r] =
+          (std::clamp(group_offsets_[r], g_begin, g_end) - g_begin) *
+          group_size;
+    }
+    mpi_allgather_blocks(&sflux(g_begin, 0, 0), offsets);
+    return;
+  }
+
+  mpi_allreduce_sum(&sflux(g_begin, 0, 0), ngr * group_size);
+
+  // Every boundary flux row is written by a single rank, and the other ranks
+  // add zeros to it.
+  const std::size_t nrows = track_flux_.shape()[0];
+  const std::size_t np = track_flux_.shape()[2];
+  exchange_buf_.resize(nrows * ngr * np);
+  for (std::size_t r = 0; r < nrows; r++) {
+    for (std::size_t g = g_begin; g < g_end; g++) {
+      StoredReal* buf = &exchange_buf_[(r * ngr + g - g_begin) * np];
+      for (std::size_t p = 0; p < np; p++) {
+        buf[p] = rank_rows_[r] ? track_flux_(r, g, p) : StoredReal(0.);
+      }
+    }
+  }
+  mpi_allreduce_sum(exchange_buf_.data(), exchange_buf_.size());
+  for (std::size_t r = 0; r < nrows; r++) {
+    for (std::size_t g = g_begin; g < g_end; g++) {
+      const StoredReal* buf = &exchange_buf_[(r * ngr + g - g_begin) * np];
+      for (std::size_t p = 0; p < np; p++) track_flux_(r, g, p) = buf[p];
+    }
+  }
+}
+
+void MOCDriver::gather_track_flux() {
+  // The boundary fluxes of the groups of other ranks are stale, and are
+  // replaced by a sum in which only the owner of each group adds its value
+  const std::size_t nrows = track_flux_.shape()[0];
+  const std::size_t ng = track_flux_.shape()[1];
+  const std::size_t np = track_flux_.shape()[2];
+  exchange_buf_.resize(nrows * ng * np);
+  for (std::size_t r = 0; r < nrows; r++) {
+    for (std::size_t g = 0; g < ng; g++) {
+      const bool own = g >= rank_groups_begin_ && g < rank_groups_end_;
+      StoredReal* buf = &exchange_buf_[(r * ng + g) * np];
+      for (std::size_t p = 0; p < np; p++) {
+        buf[p] = own ? track_flux_(r, g, p) : StoredReal(0.);
+      }
+    }
+  }
+  mpi_allreduce_sum(exchange_buf_.data(), exchange_buf_.size());
+  std::copy(exchange_buf_.begin(), exchange_buf_.end(), track_flux_.begin());
+}
+
+void MOCDriver::build_symmetry() {
+  // The reflection about the diagonal swaps x and y relative to the
+  // (x_min, y_min) corner. It maps the x boundaries onto the y boundaries.
+  const double x0 = geometry_->x_min();
+  const double y0 = geometry_->y_min();
+  const double Dx = geometry_->x_max() - x0;
+  const double Dy = geometry_->y_max() - y0;
+  const double pos_tol = 1.E-8 * std::max(Dx, Dy);
+  if (std::abs(Dx - Dy) > pos_tol) {
+    const auto mssg = "Diagonal symmetry requires a square geometry.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (x_min_bc_ != y_min_bc_ || x_max_bc_ != y_max_bc_) {
+    const auto mssg =
+        "Diagonal symmetry requires the same boundary conditions on the x and "
+        "y boundaries.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // An angle of pi / 4 would be its own mirror, which is avoided when the
+  // number of angles is a multiple of 8.
+  const std::size_t NA = angle_info_.size();
+  if (NA % 4 != 0) {
+    const auto mssg =
+        "Diagonal symmetry requires a number of angles which is a multiple of "
+        "8.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const auto not_symmetric = [](const std::string& what) {
+    const auto mssg = "The " + what + " is not symmetric about the diagonal.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  };
+
+  auto mirror = [x0, y0](const Vector& r) {
+    return Vector(x0 + r.y() - y0, y0 + r.x() - x0);
+  };
+  auto close = [pos_tol](const Vector& r1, const Vector& r2) {
+    return (r1 - r2).norm() <= pos_tol;
+  };
+
+  // Angle a is mirrored by the angle of pi / 2 - phi when phi < pi / 2, whose
+  // forward direction is the mirror of the forward direction of a. Otherwise,
+  // it is mirrored by the angle of 3 pi / 2 - phi, whose backward direction
+  // is the mirror of the forward direction of a.
+  auto mirror_angle = [NA](std::size_t a) {
+    return a < NA / 2 ? NA / 2 - 1 - a : 3 * NA / 2 - 1 - a;
+  };
+
+  const std::size_t ntracks = seg_store_.ntracks();
+  std::vector<std::size_t> track_mirror(ntracks);
+  std::vector<char> swept(ntracks, 0);
+  for (std::size_t a = 0; a < NA; a++) {
+    const std::size_t ma = mirror_angle(a);
+    const auto& ai = angle_info_[a];
+    const auto& mi = angle_info_[ma];
+    const bool reversed = a >= NA / 2;
+    const double phi_sum = reversed ? 3. * PI_2 : PI_2;
+    if (std::abs(ai.phi + mi.phi - phi_sum) > 1.E-10 || ai.nx != mi.ny ||
+        ai.ny != mi.nx || std::abs(ai.wgt - mi.wgt) > 1.E-10 * ai.wgt ||
+        tracks_[a].size() != tracks_[ma].size()) {
+      not_symmetric("azimuthal quadrature");
+    }
+
+    // Only the angles below pi / 4, and between pi / 2 and 3 pi / 4, are
+    // swept. Their mirrors are the other angles.
+    const bool swept_angle = a < NA / 4 || (a >= NA / 2 && a < 3 * NA / 4);
+
+    for (std::size_t t = 0; t < tracks_[a].size(); t++) {
+      const Track& track = tracks_[a][t];
+      const Vector entry = mirror(track.entry_pos());
+      const Vector exit = mirror(track.exit_pos());
+
+      std::size_t mt = 0;
+      for (; mt < tracks_[ma].size(); mt++) {
+        const Track& mtrack = tracks_[ma][mt];
+        if (reversed == false && close(entry, mtrack.entry_pos()) &&
+            close(exit, mtrack.exit_pos())) {
+          break;
+        }
+        if (reversed && close(entry, mtrack.exit_pos()) &&
+            close(exit, mtrack.entry_pos())) {
+          break;
         }
-      }  // For all tracks
-    }  // For all azimuthal angles
+      }
+      if (mt == tracks_[ma].size()) not_symmetric("track laydown");
 
-    for (std::size_t i = 0; i < nfsrs_; i++) {
-      const auto& mat = *fsrs_[i]->xs();
-      const double Vi = fsrs_[i]->volume();
-      const double Et = mat.Et(g);
-      for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
-        sflux(g, i, it_lj) *= 1. / (Vi * Et);
+      const std::size_t tt = seg_store_.track_index(a, t);
+      track_mirror[tt] = seg_store_.track_index(ma, mt);
+      swept[tt] = swept_angle ? 1 : 0;
+    }
+  }
+
+  // The mirrored tracks cross the mirrored FSRs, in the same order when the
+  // orientation is kept, and in the reverse order otherwise.
+  constexpr std::size_t NO_MIRROR = static_cast<std::size_t>(-1);
+  std::vector<std::size_t> fsr_mirror(nfsrs_, NO_MIRROR);
+  for (std::size_t tt = 0; tt < ntracks; tt++) {
+    const std::size_t mtt = track_mirror[tt];
+    const bool reversed = seg_store_.angle_index(tt) >= NA / 2;
+    const std::size_t s_begin = seg_store_.segments_begin(tt);
+    const std::size_t s_end = seg_store_.segments_end(tt);
+    const std::size_t ms_begin = seg_store_.segments_begin(mtt);
+    const std::size_t ms_end = seg_store_.segments_end(mtt);
+    if (s_end - s_begin != ms_end - ms_begin) not_symmetric("geometry");
+
+    for (std::size_t k = 0; k < s_end - s_begin; k++) {
+      const std::size_t s = s_begin + k;
+      const std::size_t ms = reversed ? ms_end - 1 - k : ms_begin + k;
+      const std::size_t i = seg_store_.fsr_indx(s);
+      const std::size_t mi = seg_store_.fsr_indx(ms);
+      const double l = seg_store_.length(s);
+      if (std::abs(l - seg_store_.length(ms)) > 1.E-5 * l + pos_tol ||
+          (fsr_mirror[i] != NO_MIRROR && fsr_mirror[i] != mi)) {
+        not_symmetric("geometry");
       }
+      fsr_mirror[i] = mi;
+    }
+  }
+
+  // FSRs which no track crosses are left as their own mirror
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    if (fsr_mirror[i] == NO_MIRROR) fsr_mirror[i] = i;
+  }
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    const std::size_t mi = fsr_mirror[i];
+    const double Vi = fsrs_[i]->volume();
+    if (fsr_mirror[mi] != i ||
+        std::abs(Vi - fsrs_[mi]->volume()) > 1.E-6 * Vi) {
+      not_symmetric("geometry");
+    }
+  }
+
+  // Rows of the pool which are written by each track
+  constexpr std::size_t NO_WRITER = static_cast<std::size_t>(-1);
+  std::vector<std::size_t> row_writer(track_flux_.shape()[0], NO_WRITER);
+  for (std::size_t a = 0; a < NA; a++) {
+    for (std::size_t t = 0; t < tracks_[a].size(); t++) {
+      const Track& track = tracks_[a][t];
+      const std::size_t tt = seg_store_.track_index(a, t);
+      row_writer[track.exit_track_flux()] = tt;
+      row_writer[track.entry_track_flux()] = tt;
+    }
+  }
+
+  auto get_track = [this](std::size_t tt) -> const Track& {
+    const std::size_t a = seg_store_.angle_index(tt);
+    return tracks_[a][tt - seg_store_.track_index(a, 0)];
+  };
+
+  // A swept track which reads a row written by a track which is not swept
+  // reads the row of its mirror in the same direction instead, which is
+  // written by the mirror of that track.
+  std::vector<std::pair<std::size_t, std::size_t>> row_copies;
+  for (std::size_t tt = 0; tt < ntracks; tt++) {
+    if (swept[tt] == 0) continue;
+    const Track& track = get_track(tt);
+    const Track& mtrack = get_track(track_mirror[tt]);
+    const bool reversed = seg_store_.angle_index(tt) >= NA / 2;
+
+    const std::size_t fwd_row = track.entry_flux();
+    const std::size_t bwd_row = track.exit_flux();
+    const std::size_t mfwd_row =
+        reversed ? mtrack.exit_flux() : mtrack.entry_flux();
+    const std::size_t mbwd_row =
+        reversed ? mtrack.entry_flux() : mtrack.exit_flux();
+    if (row_writer[fwd_row] != NO_WRITER && swept[row_writer[fwd_row]] == 0) {
+      row_copies.push_back({fwd_row, mfwd_row});
+    }
+    if (row_writer[bwd_row] != NO_WRITER && swept[row_writer[bwd_row]] == 0) {
+      row_copies.push_back({bwd_row, mbwd_row});
     }
-  }  // For all groups
+  }
+
+  track_swept_ = std::move(swept);
+  fsr_mirror_ = std::move(fsr_mirror);
+  sym_row_copies_ = std::move(row_copies);
+
+  spdlog::info("Diagonal symmetry: sweeping {} of {} tracks.",
+               std::count(track_swept_.begin(), track_swept_.end(), 1),
+               ntracks);
 }
 
-double MOCDriver::calc_keff(const xt::xtensor<double, 3>& flux,
-                            const xt::xtensor<double, 3>& old_flux) const {
-  double num = 0.;
-  double denom = 0.;
+void MOCDriver::apply_symmetry(xt::xtensor<double, 3>& sflux,
+                               std::size_t g_begin, std::size_t g_end) {
+  // The tally of a track which is not swept in FSR i is the tally of its
+  // mirror in the mirror of i. The reflection swaps the x and y moments of
+  // the linear source tallies.
+  const bool moments = sflux.shape()[2] == 3;
+#pragma omp parallel for
+  for (int ig = static_cast<int>(g_begin); ig < static_cast<int>(g_end);
+       ig++) {
+    const std::size_t g = static_cast<std::size_t>(ig);
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      const std::size_t mi = fsr_mirror_[i];
+      if (mi < i) continue;
+
+      const double flx = sflux(g, i, 0) + sflux(g, mi, 0);
+      sflux(g, i, 0) = flx;
+      sflux(g, mi, 0) = flx;
+
+      if (moments) {
+        const double mx = sflux(g, i, 1) + sflux(g, mi, 2);
+        const double my = sflux(g, i, 2) + sflux(g, mi, 1);
+        sflux(g, i, 1) = mx;
+        sflux(g, i, 2) = my;
+        sflux(g, mi, 1) = my;
+        sflux(g, mi, 2) = mx;
+      }
+    }
+  }
 
-#pragma omp parallel
-  {
-    double num_thrd = 0.;
-    double denom_thrd = 0.;
+  const std::size_t np = track_flux_.shape()[2];
+#pragma omp parallel for
+  for (int ic = 0; ic < static_cast<int>(sym_row_copies_.size()); ic++) {
+    const auto& [dst, src] = sym_row_copies_[static_cast<std::size_t>(ic)];
+    for (std::size_t g = g_begin; g < g_end; g++) {
+      for (std::size_t p = 0; p < np; p++) {
+        track_flux_(dst, g, p) = track_flux_(src, g, p);
+      }
+    }
+  }
+}
 
-#pragma omp for
-    for (int ii = 0; ii < static_cast<int>(fsrs_.size()); ii++) {
+void MOCDriver::sweep_isotropic(xt::xtensor<double, 3>& sflux,
+                                const xt::xtensor<double, 2>& src,
+                                std::size_t g_begin, std::size_t g_end) {
+  if (flux_layout_ == FluxLayout::GroupMajor ||
+      sweeps_by_group(g_begin, g_end)) {
+    auto sweeper = [&](Track& track, std::size_t tt, std::size_t g,
+                       bool forward, const StoredReal* in_flx,
+                       xt::xtensor<double, 3>& flx) {
+      sweep_track<FluxLayout::GroupMajor>(track, tt, g, forward, in_flx, flx,
+                                          src);
+    };
+    sweep_tracks(sflux, sweeper, g_begin, g_end);
+  } else {
+    // The source is transposed once, so that every thread reads all groups
+    // of the FSRs of its tracks from the same cache lines
+    const std::array<std::size_t, 2> src_shape{nfsrs_, ngroups_};
+    if (sweep_src_.shape() != src_shape) sweep_src_.resize(src_shape);
+#pragma omp parallel for
+    for (int ii = 0; ii < static_cast<int>(nfsrs_); ii++) {
       const std::size_t i = static_cast<std::size_t>(ii);
-      const double Vr = fsrs_[i]->volume();
-      const auto& mat = *fsrs_[i]->xs();
-      for (std::uint32_t g = 0; g < ngroups_; g++) {
-        const double VvEf = Vr * mat.vEf(g);
-        const double flx = flux(g, i, 0);
-        const double oflx = old_flux(g, i, 0);
+      for (std::size_t g = g_begin; g < g_end; g++) {
+        sweep_src_(i, g) = src(g, i);
+      }
+    }
+
+    auto sweeper = [&](Track& track, std::size_t tt, std::size_t g,
+                       bool forward, const StoredReal* in_flx,
+                       xt::xtensor<double, 3>& flx) {
+      sweep_track<FluxLayout::RegionMajor>(track, tt, g, forward, in_flx, flx,
+                                           sweep_src_);
+    };
+    sweep_tracks<FluxLayout::RegionMajor>(sflux, sweeper, g_begin, g_end);
+  }
+  normalize_flux(sflux, src, g_begin, g_end);
+}
 
-        num_thrd += VvEf * flx;
-        denom_thrd += VvEf * oflx;
+void MOCDriver::normalize_flux(xt::xtensor<double, 3>& sflux,
+                               const xt::xtensor<double, 2>& src,
+                               std::size_t g_begin, std::size_t g_end) const {
+#pragma omp parallel for
+  for (int ig = static_cast<int>(g_begin); ig < static_cast<int>(g_end);
+       ig++) {
+    const std::size_t g = static_cast<std::size_t>(ig);
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      const double Vi = fsrs_[i]->volume();
+      const double invs_Et = mat_invs_Et_(fsr_xs_indx_[i], g);
+      sflux(g, i, 0) *= invs_Et / Vi;
+      sflux(g, i, 0) += 4. * PI * src(g, i) * invs_Et;
+    }
+  }
+}
+
+void MOCDriver::sweep(xt::xtensor<double, 3>& sflux,
+                      const xt::xtensor<double, 2>& src, std::size_t g_begin,
+                      std::size_t g_end) {
+  SCARABEE_PROFILE_ZONE("MOCDriver::sweep");
+  SolverTelemetry::ScopedPhase phase(telemetry_, "sweep");
+  const std::size_t nsegs =
+      device_.resident() ? seg_store_.nsegments() : swept_segments();
+  telemetry_.add_count("segments", 2 * nsegs * (g_end - g_begin));
+
+  if (device_.resident()) {
+    device_.sweep(src, sflux, g_begin, g_end);
+    normalize_flux(sflux, src, g_begin, g_end);
+    return;
+  }
+
+  if (source_shape_ == SourceShape::Linear) {
+    sweep_linear(sflux, src, g_begin, g_end);
+    return;
+  }
+
+  sweep_isotropic(sflux, src, g_begin, g_end);
+}
+
+// anisotropic sweep
+void MOCDriver::sweep_track_anisotropic(Track& track, std::size_t tt,
+                                        std::size_t g, bool forward,
+                                        const StoredReal* in_flx,
+                                        xt::xtensor<double, 3>& sflux,
+                                        const double* ang_src) {
+  const auto wsin = polar_quad_.wsin();
+  const auto wgt = polar_quad_.wgt();
+  const std::size_t NP = n_pol_angles_;
+
+  // Get the group for CMFD
+  std::size_t G = g;
+  if (cmfd_) G = cmfd_->moc_to_cmfd_group(g);
+  const bool tally_cmfd =
+      cmfd_ && tally_currents_ &&
+      cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations();
+
+  htl::static_vector<double, 12> angflux;
+  htl::static_vector<double, 12> ang_tally(NP, 0.);
+  for (std::size_t pp = 0; pp < NP; pp++) angflux.push_back(in_flx[pp]);
+  std::array<double, 6> exp_buf;
+  const double tw = 4. * PI * track.wgt() *
+                    track.width();  // Azimuthal weight * track width
+
+  // Get the azimuthal angle (phi) and its cosine for CMFD current
+  const Direction u = forward ? track.dir() : -track.dir();
+  const std::size_t phi =
+      forward ? track.phi_index_forward() : track.phi_index_backward();
+
+  // Angular source of every FSR, and halved harmonics, in this direction
+  const double* dir_src = ang_src + phi * nfsrs_ * NP;
+  const double* Y = &aniso_ylj_[phi * N_lj_ * NP];
+
+  // Range of packed segments and CMFD crossings for this track, which is
+  // traced again when the segments are not stored
+  const SegmentStore& segs = track_segments(track, tt);
+  const std::size_t s_begin = segs.segments_begin(tt);
+  const std::size_t s_end = segs.segments_end(tt);
+  const std::size_t c_begin = segs.crossings_begin(tt);
+  const std::size_t c_end = segs.crossings_end(tt);
+
+  // The polar index of the quadrature is the same in both hemispheres
+  auto polar = [NP](std::size_t pp) { return pp < NP / 2 ? pp : pp - NP / 2; };
+
+  // Tallies the current of the angular flux at a CMFD surface, and its
+  // contribution to the surface flux when requested
+  const bool tally_sflux = tally_cmfd && cmfd_->surface_flux_tally();
+  auto tally_surface = [&](const CMFDSurfaceTally& surf) {
+    double cmfd_flx = 0.;
+    for (std::size_t pp = 0; pp < NP; pp++) {
+      cmfd_flx += wsin[polar(pp)] * angflux[pp];
+    }
+    cmfd_->tally_current(INVS_4SQRTPI * tw * cmfd_flx, u, G, surf);
+
+    if (tally_sflux) {
+      double surf_flx = 0.;
+      for (std::size_t pp = 0; pp < NP; pp++) {
+        surf_flx += wgt[polar(pp)] * angflux[pp];
+      }
+      cmfd_->tally_surface_flux(INVS_4SQRTPI * tw * surf_flx, u, G, surf);
+    }
+  };
+
+  auto attenuate = [&](std::size_t s) {
+    const std::size_t i = segs.fsr_indx(s);
+    const double l = segs.length(s);
+    const std::size_t m = segs.xs_indx(s);
+    const double lEt = l * mat_Et_(m, g);
+    const double invs_Et = mat_invs_Et_(m, g);
+    const double* exp_m1 = segment_exponentials(s, g, lEt, exp_buf);
+    const double* Q = dir_src + i * NP;
+
+    for (std::size_t pp = 0; pp < NP; pp++) {
+      const std::size_t p = polar(pp);
+      const double delta_flx = (angflux[pp] - Q[pp] * invs_Et) * exp_m1[p];
+      angflux[pp] -= delta_flx;
+      ang_tally[pp] = tw * (wsin[p] * delta_flx + l * Q[pp] * wgt[p]);
+    }  // For all polar angles
+
+    // Contract the polar tallies with the harmonics of each moment
+    for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
+      const double* Ylj = Y + it_lj * NP;
+      double mom = 0.;
+      for (std::size_t pp = 0; pp < NP; pp++) mom += ang_tally[pp] * Ylj[pp];
+      sflux(g, i, it_lj) += mom;
+    }
+  };
+
+  if (forward) {
+    // Accumulate entry angular flux into CMFD current
+    std::size_t c = c_begin;
+    if (tally_cmfd && c < c_end && segs.crossing(c).segment == s_begin &&
+        segs.crossing(c).entry) {
+      const auto& surf_indx = segs.crossing(c).entry;
+      tally_surface(surf_indx);
+    }
+
+    // Follow track in forward direction
+    for (std::size_t s = s_begin; s < s_end; s++) {
+      const CMFDSurfaceTally* cmfd_surf = nullptr;
+      if (c < c_end && segs.crossing(c).segment == s) {
+        const auto& exit_surf = segs.crossing(c).exit;
+        if (exit_surf) cmfd_surf = &exit_surf;
+        c++;
+      }
+
+      attenuate(s);
+
+      if (cmfd_surf && tally_cmfd) {
+        tally_surface(*cmfd_surf);
       }
+    }  // For all segments along forward direction of track
+  } else {
+    // Accumulate entry angular flux into CMFD current for backwards direction
+    std::size_t c = c_end;
+    if (tally_cmfd && c > c_begin &&
+        segs.crossing(c - 1).segment + 1 == s_end &&
+        segs.crossing(c - 1).exit) {
+      const auto& surf_indx = segs.crossing(c - 1).exit;
+      tally_surface(surf_indx);
     }
 
-#pragma omp atomic
-    num += num_thrd;
+    for (std::size_t s = s_end; s-- > s_begin;) {
+      const CMFDSurfaceTally* cmfd_surf = nullptr;
+      if (c > c_begin && segs.crossing(c - 1).segment == s) {
+        const auto& entry_surf = segs.crossing(c - 1).entry;
+        if (entry_surf) cmfd_surf = &entry_surf;
+        c--;
+      }
 
-#pragma omp atomic
-    denom += denom_thrd;
+      attenuate(s);
+
+      if (cmfd_surf && tally_cmfd) {
+        tally_surface(*cmfd_surf);
+      }
+    }  // For all segments along backward direction of track
   }
 
-  return keff_ * num / denom;
+  // Set incoming flux for next track
+  const std::size_t out_row =
+      forward ? track.exit_track_flux() : track.entry_track_flux();
+  const BoundaryCondition out_bc = forward ? track.exit_bc() : track.entry_bc();
+  for (std::size_t pp = 0; pp < NP; pp++) {
+    track_flux_(out_row, g, pp) = out_bc == BoundaryCondition::Vacuum
+                                      ? StoredReal(0.)
+                                      : static_cast<StoredReal>(angflux[pp]);
+  }
 }
 
-void MOCDriver::fill_source(xt::xtensor<double, 2>& src,
-                            const xt::xtensor<double, 3>& flux) const {
-  const double inv_k = 1. / keff_;
-  const double isotropic = 1. / (4. * PI);
+void MOCDriver::fill_anisotropic_tables() {
+  const std::size_t NP = n_pol_angles_;
+  const std::size_t nphi = 2 * angle_info_.size();
+  aniso_ylj_.resize(nphi * N_lj_ * NP);
+  for (std::size_t phi = 0; phi < nphi; phi++) {
+    for (std::size_t pp = 0; pp < NP; pp++) {
+      const auto Y_ljs = sph_harm_.spherical_harmonics(phi, pp);
+      for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
+        aniso_ylj_[(phi * N_lj_ + it_lj) * NP + pp] = 0.5 * Y_ljs[it_lj];
+      }
+    }
+  }
+}
+
+void MOCDriver::fill_angular_source(const xt::xtensor<double, 3>& src,
+                                    std::size_t g_begin, std::size_t g_end) {
+  const std::size_t NP = n_pol_angles_;
+  const std::size_t nphi = 2 * angle_info_.size();
+  ang_src_.resize((g_end - g_begin) * nphi * nfsrs_ * NP);
+
+  // The source of a direction is the sum of the source moments, weighted by
+  // the harmonics of the direction. The halved harmonics are doubled back.
+#pragma omp parallel for
+  for (int ii = 0; ii < static_cast<int>(nfsrs_); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    for (std::size_t g = g_begin; g < g_end; g++) {
+      const double* src_lj = &src(g, i, 0);
+      for (std::size_t phi = 0; phi < nphi; phi++) {
+        double* Q = &ang_src_[(((g - g_begin) * nphi + phi) * nfsrs_ + i) * NP];
+        const double* Y = &aniso_ylj_[phi * N_lj_ * NP];
+        for (std::size_t pp = 0; pp < NP; pp++) Q[pp] = 0.;
+        for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
+          const double s2 = 2. * src_lj[it_lj];
+          for (std::size_t pp = 0; pp < NP; pp++) {
+            Q[pp] += s2 * Y[it_lj * NP + pp];
+          }
+        }
+      }
+    }
+  }
+}
+
+void MOCDriver::sweep_anisotropic(xt::xtensor<double, 3>& sflux,
+                                  const xt::xtensor<double, 3>& src) {
+  SCARABEE_PROFILE_ZONE("MOCDriver::sweep_anisotropic");
+  SolverTelemetry::ScopedPhase phase(telemetry_, "sweep");
+  telemetry_.add_count("segments", 2 * swept_segments() * ngroups_);
+
+  // The groups are swept in blocks, whose angular sources fit in the memory
+  // allowed for them.
+  const std::size_t nphi = 2 * angle_info_.size();
+  const double group_mem = static_cast<double>(nphi * nfsrs_ * n_pol_angles_) *
+                           static_cast<double>(sizeof(double)) /
+                           (1024. * 1024.);
+  const std::size_t block = std::clamp<std::size_t>(
+      static_cast<std::size_t>(ang_src_max_memory_ / group_mem), 1, ngroups_);
+
+  for (std::size_t g_begin = 0; g_begin < ngroups_; g_begin += block) {
+    const std::size_t g_end = std::min(g_begin + block, ngroups_);
+    fill_angular_source(src, g_begin, g_end);
+
+    auto sweeper = [&](Track& track, std::size_t tt, std::size_t g,
+                       bool forward, const StoredReal* in_flx,
+                       xt::xtensor<double, 3>& flx) {
+      const double* ang_src =
+          &ang_src_[(g - g_begin) * nphi * nfsrs_ * n_pol_angles_];
+      sweep_track_anisotropic(track, tt, g, forward, in_flx, flx, ang_src);
+    };
+    sweep_tracks(sflux, sweeper, g_begin, g_end);
+  }
 
 #pragma omp parallel for
   for (int ig = 0; ig < static_cast<int>(ngroups_); ig++) {
     const std::size_t g = static_cast<std::size_t>(ig);
-    for (std::size_t i = 0; i < fsrs_.size(); i++) {
-      const auto& mat = *fsrs_[i]->xs();
-      const double chi_g = mat.chi(g);
-      double Qout = 0.;
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      const double Vi = fsrs_[i]->volume();
+      const double invs_Et = mat_invs_Et_(fsr_xs_indx_[i], g);
+      for (std::size_t it_lj = 0; it_lj < N_lj_; it_lj++) {
+        sflux(g, i, it_lj) *= invs_Et / Vi;
+      }
+    }
+  }
+}
 
-      for (std::uint32_t gg = 0; gg < ngroups_; gg++) {
-        // Sccatter source
-        const double flux_gg_i = flux(gg, i, 0);
-        const double Es_gg_to_g = mat.Es_tr(gg, g);
-        Qout += Es_gg_to_g * flux_gg_i;
+double MOCDriver::calc_keff(const xt::xtensor<double, 3>& flux,
+                            const xt::xtensor<double, 3>& old_flux) const {
+  SolverTelemetry::ScopedPhase phase(telemetry_, "keff");
+
+  const auto sums =
+      parallel_sum<2>(fsrs_.size(), [&](std::size_t i, auto& partial) {
+        const double Vr = fsrs_[i]->volume();
+        const std::size_t m = fsr_xs_indx_[i];
+        for (std::uint32_t g = 0; g < ngroups_; g++) {
+          const double VvEf = Vr * mat_vEf_(m, g);
+          partial[0] += VvEf * flux(g, i, 0);
+          partial[1] += VvEf * old_flux(g, i, 0);
+        }
+      });
+  const double num = sums[0];
+  const double denom = sums[1];
 
-        // Fission source
-        const double vEf_gg = mat.vEf(gg);
-        Qout += inv_k * chi_g * vEf_gg * flux_gg_i;
-      }
+  return keff_ * num / denom;
+}
+
+void MOCDriver::fill_source(xt::xtensor<double, 2>& src,
+                            const xt::xtensor<double, 3>& flux,
+                            std::size_t g_begin, std::size_t g_end) const {
+  SCARABEE_PROFILE_ZONE("MOCDriver::fill_source");
+  SolverTelemetry::ScopedPhase phase(telemetry_, "fill_source");
+  const double isotropic = 1. / (4. * PI);
+
+  const std::size_t NL = flux.shape()[2];
+
+  // Sccatter source, only from the groups which scatter into g, followed by
+  // the fission source, for the FSRs i_begin to i_end
+  auto fill = [&](std::size_t g, std::size_t i_begin, std::size_t i_end) {
+    scatter_source(i_begin, i_end, g, ngroups_, fsr_xs_indx_.data(),
+                   mat_scat_offsets_.data(), mat_scat_xs_.data(),
+                   mat_scat_gin_.data(), flux.data(), nfsrs_ * NL, NL,
+                   &src(g, 0));
 
+    for (std::size_t i = i_begin; i < i_end; i++) {
+      const double Qout =
+          src(g, i) + mat_chi_(fsr_xs_indx_[i], g) * fission_src_[i];
       src(g, i) = isotropic * Qout;
     }
+  };
+
+  // A single group is distributed over chunks of FSRs instead of the groups
+  if (g_end - g_begin == 1) {
+    constexpr std::size_t chunk = 256;
+    const std::size_t nchunks = (nfsrs_ + chunk - 1) / chunk;
+#pragma omp parallel for
+    for (int ic = 0; ic < static_cast<int>(nchunks); ic++) {
+      const std::size_t i_begin = static_cast<std::size_t>(ic) * chunk;
+      fill(g_begin, i_begin, std::min(i_begin + chunk, nfsrs_));
+    }
+    return;
+  }
+
+#pragma omp parallel for
+  for (int ig = static_cast<int>(g_begin); ig < static_cast<int>(g_end);
+       ig++) {
+    fill(static_cast<std::size_t>(ig), 0, nfsrs_);
   }
 }
 
 void MOCDriver::fill_source_anisotropic(
     xt::xtensor<double, 3>& src, const xt::xtensor<double, 3>& flux) const {
-  const double inv_k = 1. / keff_;
+  SCARABEE_PROFILE_ZONE("MOCDriver::fill_source_anisotropic");
+  SolverTelemetry::ScopedPhase phase(telemetry_, "fill_source");
+  const std::size_t NL = max_L_ + 1;
 
 #pragma omp parallel for
   for (int ig = 0; ig < static_cast<int>(ngroups_); ig++) {
     const std::size_t g = static_cast<std::size_t>(ig);
     for (std::size_t i = 0; i < fsrs_.size(); i++) {
-      const auto& mat = *fsrs_[i]->xs();
-      const double chi_g = mat.chi(g);
+      const std::size_t m = fsr_xs_indx_[i];
+      const std::size_t mg = m * ngroups_ + g;
+      const std::size_t k_begin = mat_scat_offsets_[mg];
+      const std::size_t k_end = mat_scat_offsets_[mg + 1];
 
       std::size_t it_lj = 0;
       for (std::size_t l = 0; l <= max_L_; l++) {
         for (int j = -static_cast<int>(l); j <= static_cast<int>(l); j++) {
+          // Fission source
           double Qout = 0.;
-          for (std::uint32_t gg = 0; gg < ngroups_; gg++) {
-            // Sccatter source
-            const double flux_gg_i = flux(gg, i, it_lj);
-            const double Es_gg_to_g = mat.Es(l, gg, g);
-            Qout += Es_gg_to_g * flux_gg_i;
-
-            // Fission source
-            if (l == 0) {
-              const double vEf_gg = mat.vEf(gg);
-              Qout += inv_k * chi_g * vEf_gg * flux_gg_i;
-            }
+          if (l == 0) Qout = mat_chi_(m, g) * fission_src_[i];
+
+          // Sccatter source, only from the groups which scatter into g
+          for (std::size_t k = k_begin; k < k_end; k++) {
+            Qout += mat_scat_xs_[k * NL + l] * flux(mat_scat_gin_[k], i, it_lj);
           }
 
           src(g, i, it_lj) = Qout;
@@ -992,6 +3055,383 @@ void MOCDriver::fill_source_anisotropic(
   }  // all groups
 }
 
+template <typename F>
+void MOCDriver::for_each_segment_midpoint(const F& f) const {
+  // The renormalized segment lengths are scaled back to the length of the
+  // track, so that the midpoints lie within the track.
+  for (std::size_t a = 0; a < tracks_.size(); a++) {
+    for (std::size_t t = 0; t < tracks_[a].size(); t++) {
+      const Track& track = tracks_[a][t];
+      std::size_t tt = seg_store_.track_index(a, t);
+      const SegmentStore& segs = track_segments(track, tt);
+      const std::size_t s_begin = segs.segments_begin(tt);
+      const std::size_t s_end = segs.segments_end(tt);
+      const double w = track.wgt() * track.width();
+      const Direction u = track.dir();
+
+      double seg_len = 0.;
+      for (std::size_t s = s_begin; s < s_end; s++) {
+        seg_len += segs.length(s);
+      }
+      if (seg_len <= 0.) continue;
+      const double scale =
+          (track.exit_pos() - track.entry_pos()).norm() / seg_len;
+
+      double pos = 0.;
+      for (std::size_t s = s_begin; s < s_end; s++) {
+        const double l = segs.length(s);
+        const Vector r = track.entry_pos() + u * (scale * (pos + 0.5 * l));
+        f(s, segs.fsr_indx(s), w, l, u, r);
+        pos += l;
+      }
+    }
+  }
+}
+
+std::vector<std::vector<std::size_t>> MOCDriver::mesh_fsr_sets(
+    const std::vector<double>& dx, const std::vector<double>& dy) const {
+  if (this->drawn() == false) {
+    const auto mssg = "Cannot find the FSRs of a mesh before tracing tracks.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Bounds of the mesh, from the lower left corner of the geometry
+  auto bounds = [](const std::vector<double>& widths, double min) {
+    std::vector<double> b{min};
+    for (const double w : widths) {
+      if (w <= 0.) {
+        const auto mssg = "Mesh widths must be > 0.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+      b.push_back(b.back() + w);
+    }
+    return b;
+  };
+  const auto x_bounds = bounds(dx, this->x_min());
+  const auto y_bounds = bounds(dy, this->y_min());
+  auto find_bin = [](const std::vector<double>& b, double v) -> std::size_t {
+    const auto it = std::upper_bound(b.begin(), b.end(), v);
+    if (it == b.begin() || it == b.end()) return b.size();
+    return static_cast<std::size_t>(it - b.begin()) - 1;
+  };
+
+  // Track length of each FSR in each cell it crosses
+  const std::size_t nx = dx.size();
+  std::vector<std::map<std::size_t, double>> fsr_cells(nfsrs_);
+  for_each_segment_midpoint([&](std::size_t, std::size_t i, double w,
+                                double l, const Direction&, const Vector& r) {
+    const std::size_t ix = find_bin(x_bounds, r.x());
+    const std::size_t iy = find_bin(y_bounds, r.y());
+    if (ix >= dx.size() || iy >= dy.size()) return;
+    fsr_cells[i][iy * nx + ix] += w * l;
+  });
+
+  std::vector<std::vector<std::size_t>> sets(nx * dy.size());
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    if (fsr_cells[i].empty()) continue;
+    const auto best = std::max_element(
+        fsr_cells[i].begin(), fsr_cells[i].end(),
+        [](const auto& a, const auto& b) { return a.second < b.second; });
+    sets[best->first].push_back(i);
+  }
+
+  return sets;
+}
+
+void MOCDriver::fill_linear_source_geometry() {
+  // The centroids are the track estimates, so that the weighted midpoint
+  // offsets of every FSR sum to zero, as the normalization of the flux
+  // assumes.
+  std::vector<double> wsum(nfsrs_, 0.);
+  fsr_centroids_.resize({nfsrs_, 2});
+  fsr_centroids_.fill(0.);
+  for_each_segment_midpoint([&](std::size_t, std::size_t i, double w,
+                                double l, const Direction&, const Vector& r) {
+    wsum[i] += w * l;
+    fsr_centroids_(i, 0) += w * l * r.x();
+    fsr_centroids_(i, 1) += w * l * r.y();
+  });
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    if (wsum[i] > 0.) {
+      fsr_centroids_(i, 0) /= wsum[i];
+      fsr_centroids_(i, 1) /= wsum[i];
+    }
+  }
+
+  // Midpoints relative to the centroids, and spatial moment matrices. A
+  // segment contributes the moment of its midpoint, and l^2 / 12 along its
+  // direction.
+  seg_midpoints_.resize(2 * seg_store_.nsegments());
+  xt::xtensor<double, 2> mom = xt::zeros<double>({nfsrs_, std::size_t(3)});
+  for_each_segment_midpoint([&](std::size_t s, std::size_t i, double w,
+                                double l, const Direction& u,
+                                const Vector& r) {
+    const double dx = r.x() - fsr_centroids_(i, 0);
+    const double dy = r.y() - fsr_centroids_(i, 1);
+    seg_midpoints_[2 * s] = static_cast<StoredReal>(dx);
+    seg_midpoints_[2 * s + 1] = static_cast<StoredReal>(dy);
+    const double l2_12 = l * l / 12.;
+    mom(i, 0) += w * l * (dx * dx + l2_12 * u.x() * u.x());
+    mom(i, 1) += w * l * (dx * dy + l2_12 * u.x() * u.y());
+    mom(i, 2) += w * l * (dy * dy + l2_12 * u.y() * u.y());
+  });
+
+  // FSRs which are too small or too thin for a gradient keep a flat source
+  fsr_inv_moments_.resize({nfsrs_, 3});
+  fsr_inv_moments_.fill(0.);
+  for (std::size_t i = 0; i < nfsrs_; i++) {
+    if (wsum[i] <= 0.) continue;
+    const double xx = mom(i, 0) / wsum[i];
+    const double xy = mom(i, 1) / wsum[i];
+    const double yy = mom(i, 2) / wsum[i];
+    const double det = xx * yy - xy * xy;
+    if (det <= 1.E-10 * (xx + yy) * (xx + yy)) continue;
+    fsr_inv_moments_(i, 0) = yy / det;
+    fsr_inv_moments_(i, 1) = -xy / det;
+    fsr_inv_moments_(i, 2) = xx / det;
+  }
+}
+
+void MOCDriver::fill_fission_source_moments() {
+  SolverTelemetry::ScopedPhase phase(telemetry_, "fill_source");
+  const double inv_k = 1. / keff_;
+  fission_src_mom_.resize(2 * nfsrs_);
+
+#pragma omp parallel for
+  for (int ii = 0; ii < static_cast<int>(nfsrs_); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    const std::size_t m = fsr_xs_indx_[i];
+    double rate_x = 0.;
+    double rate_y = 0.;
+    for (std::size_t gg = 0; gg < ngroups_; gg++) {
+      rate_x += mat_vEf_(m, gg) * flux_mom_(gg, i, 0);
+      rate_y += mat_vEf_(m, gg) * flux_mom_(gg, i, 1);
+    }
+    fission_src_mom_[2 * i] = inv_k * rate_x;
+    fission_src_mom_[2 * i + 1] = inv_k * rate_y;
+  }
+}
+
+void MOCDriver::fill_source_gradient(const xt::xtensor<double, 3>& flux_mom,
+                                     std::size_t g_begin, std::size_t g_end) {
+  SolverTelemetry::ScopedPhase phase(telemetry_, "fill_source");
+  const double isotropic = 1. / (4. * PI);
+
+  // The source moments are obtained like the source, from the flux moments,
+  // and the gradient is the product of the inverse moment matrix with them.
+  auto fill = [&](std::size_t g, std::size_t i) {
+    const std::size_t m = fsr_xs_indx_[i];
+    double Qx = mat_chi_(m, g) * fission_src_mom_[2 * i];
+    double Qy = mat_chi_(m, g) * fission_src_mom_[2 * i + 1];
+
+    const std::size_t mg = m * ngroups_ + g;
+    for (std::size_t k = mat_scat_offsets_[mg]; k < mat_scat_offsets_[mg + 1];
+         k++) {
+      Qx += mat_scat_xs_[k] * flux_mom(mat_scat_gin_[k], i, 0);
+      Qy += mat_scat_xs_[k] * flux_mom(mat_scat_gin_[k], i, 1);
+    }
+    Qx *= isotropic;
+    Qy *= isotropic;
+
+    src_grad_(g, i, 0) =
+        fsr_inv_moments_(i, 0) * Qx + fsr_inv_moments_(i, 1) * Qy;
+    src_grad_(g, i, 1) =
+        fsr_inv_moments_(i, 1) * Qx + fsr_inv_moments_(i, 2) * Qy;
+  };
+
+#pragma omp parallel for
+  for (int ii = 0; ii < static_cast<int>(nfsrs_); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    for (std::size_t g = g_begin; g < g_end; g++) fill(g, i);
+  }
+}
+
+void MOCDriver::sweep_track_linear(Track& track, std::size_t tt,
+                                   std::size_t g, bool forward,
+                                   const StoredReal* in_flx,
+                                   xt::xtensor<double, 3>& tally,
+                                   const xt::xtensor<double, 2>& src) {
+  const auto invs_sin = polar_quad_.invs_sin();
+  const auto wsin = polar_quad_.wsin();
+
+  // Get the group for CMFD
+  std::size_t G = g;
+  if (cmfd_) G = cmfd_->moc_to_cmfd_group(g);
+  const bool tally_cmfd =
+      cmfd_ && tally_currents_ &&
+      cmfd_->moc_iteration() >= cmfd_->skip_moc_iterations();
+
+  std::array<double, 6> angflux;
+  for (std::size_t p = 0; p < n_pol_angles_; p++) angflux[p] = in_flx[p];
+
+  const double tw = 4. * PI * track.wgt() *
+                    track.width();  // Azimuthal weight * track width
+  const Direction u = forward ? track.dir() : -track.dir();
+
+  // Tallies the current of the angular flux at a CMFD surface, and its
+  // contribution to the surface flux when requested
+  const bool tally_sflux = tally_cmfd && cmfd_->surface_flux_tally();
+  auto tally_surface = [&](const CMFDSurfaceTally& surf) {
+    double cur = 0.;
+    for (std::size_t p = 0; p < n_pol_angles_; p++)
+      cur += wsin[p] * angflux[p];
+    cmfd_->tally_current(tw * cur, u, G, surf);
+
+    if (tally_sflux) {
+      double flx = 0.;
+      for (std::size_t p = 0; p < n_pol_angles_; p++)
+        flx += wsin[p] * invs_sin[p] * angflux[p];
+      cmfd_->tally_surface_flux(tw * flx, u, G, surf);
+    }
+  };
+
+  // Range of packed segments and CMFD crossings for this track
+  const std::size_t s_begin = seg_store_.segments_begin(tt);
+  const std::size_t s_end = seg_store_.segments_end(tt);
+  const std::size_t c_begin = seg_store_.crossings_begin(tt);
+  const std::size_t c_end = seg_store_.crossings_end(tt);
+
+  // Along a segment s of 3D length L, the source is Q0 + Q1 (s - L/2), where
+  // Q0 is the source at the segment midpoint, and Q1 the derivative of the
+  // source along the direction of flight. The scalar flux is tallied from
+  // the change in angular flux, as for the flat source, and the flux moments
+  // from the integral of the angular flux and of its first moment along the
+  // segment.
+  auto attenuate = [&](std::size_t s) {
+    const std::size_t i = seg_store_.fsr_indx(s);
+    const std::size_t m = seg_store_.xs_indx(s);
+    const double l = seg_store_.length(s);
+    const double Et = mat_Et_(m, g);
+    const double invs_Et = mat_invs_Et_(m, g);
+    const double dx = seg_midpoints_[2 * s];
+    const double dy = seg_midpoints_[2 * s + 1];
+    const double qx = src_grad_(g, i, 0);
+    const double qy = src_grad_(g, i, 1);
+    const double Q0 = src(g, i) + qx * dx + qy * dy;
+    const double qu = qx * u.x() + qy * u.y();
+
+    double delta_sum = 0.;
+    double mom_x = 0.;
+    double mom_y = 0.;
+    for (std::size_t p = 0; p < n_pol_angles_; p++) {
+      const double L = l * invs_sin[p];
+      const double sin_p = 1. / invs_sin[p];
+      const double Q1 = qu * sin_p;
+      const auto e = linear_source_exp(L * Et);
+      const double L2 = L * L;
+
+      const double delta_flx =
+          (angflux[p] - Q0 * invs_Et) * e.F1 - Q1 * L2 * e.E2;
+      const double int_flx = (Q0 * L + delta_flx) * invs_Et;
+      const double int_mom =
+          L2 * (-angflux[p] * e.E2 + Q0 * L * e.E3 + Q1 * L2 * e.G4);
+      angflux[p] -= delta_flx;
+
+      delta_sum += wsin[p] * delta_flx;
+      mom_x += wsin[p] * (dx * int_flx + u.x() * sin_p * int_mom);
+      mom_y += wsin[p] * (dy * int_flx + u.y() * sin_p * int_mom);
+    }
+
+    tally(g, i, 0) += tw * delta_sum;
+    tally(g, i, 1) += tw * mom_x;
+    tally(g, i, 2) += tw * mom_y;
+  };
+
+  if (forward) {
+    // Accumulate entry angular flux into CMFD current
+    std::size_t c = c_begin;
+    if (tally_cmfd && c < c_end && seg_store_.crossing(c).segment == s_begin &&
+        seg_store_.crossing(c).entry) {
+      const auto& surf_indx = seg_store_.crossing(c).entry;
+      tally_surface(surf_indx);
+    }
+
+    // Follow track in forward direction
+    for (std::size_t s = s_begin; s < s_end; s++) {
+      const CMFDSurfaceTally* cmfd_surf = nullptr;
+      if (c < c_end && seg_store_.crossing(c).segment == s) {
+        const auto& exit_surf = seg_store_.crossing(c).exit;
+        if (exit_surf) cmfd_surf = &exit_surf;
+        c++;
+      }
+
+      attenuate(s);
+
+      if (cmfd_surf && tally_cmfd) {
+        tally_surface(*cmfd_surf);
+      }
+    }  // For all segments along forward direction of track
+  } else {
+    // Accumulate entry angular flux into CMFD current for backwards direction
+    std::size_t c = c_end;
+    if (tally_cmfd && c > c_begin &&
+        seg_store_.crossing(c - 1).segment + 1 == s_end &&
+        seg_store_.crossing(c - 1).exit) {
+      const auto& surf_indx = seg_store_.crossing(c - 1).exit;
+      tally_surface(surf_indx);
+    }
+
+    // Iterate over segments in backwards direction
+    for (std::size_t s = s_end; s-- > s_begin;) {
+      const CMFDSurfaceTally* cmfd_surf = nullptr;
+      if (c > c_begin && seg_store_.crossing(c - 1).segment == s) {
+        const auto& entry_surf = seg_store_.crossing(c - 1).entry;
+        if (entry_surf) cmfd_surf = &entry_surf;
+        c--;
+      }
+
+      attenuate(s);
+
+      if (cmfd_surf && tally_cmfd) {
+        tally_surface(*cmfd_surf);
+      }
+    }  // For all segments along backward direction of track
+  }
+
+  // Set incoming flux for next track
+  const std::size_t out_row =
+      forward ? track.exit_track_flux() : track.entry_track_flux();
+  const BoundaryCondition out_bc = forward ? track.exit_bc() : track.entry_bc();
+  for (std::size_t p = 0; p < n_pol_angles_; p++) {
+    track_flux_(out_row, g, p) =
+        out_bc == BoundaryCondition::Vacuum
+            ? StoredReal(0.)
+            : static_cast<StoredReal>(angflux[p]);
+  }
+}
+
+void MOCDriver::sweep_linear(xt::xtensor<double, 3>& sflux,
+                             const xt::xtensor<double, 2>& src,
+                             std::size_t g_begin, std::size_t g_end) {
+  if (ls_tally_.shape()[0] != ngroups_ || ls_tally_.shape()[1] != nfsrs_) {
+    ls_tally_.resize({ngroups_, nfsrs_, 3});
+  }
+  xt::view(ls_tally_, xt::range(g_begin, g_end), xt::all(), xt::all())
+      .fill(0.);
+
+  auto sweeper = [&](Track& track, std::size_t tt, std::size_t g,
+                     bool forward, const StoredReal* in_flx,
+                     xt::xtensor<double, 3>& tally) {
+    sweep_track_linear(track, tt, g, forward, in_flx, tally, src);
+  };
+  sweep_tracks(ls_tally_, sweeper, g_begin, g_end);
+
+#pragma omp parallel for
+  for (int ig = static_cast<int>(g_begin); ig < static_cast<int>(g_end);
+       ig++) {
+    const std::size_t g = static_cast<std::size_t>(ig);
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      const double invs_Vi = 1. / fsrs_[i]->volume();
+      sflux(g, i, 0) += ls_tally_(g, i, 0);
+      next_flux_mom_(g, i, 0) = ls_tally_(g, i, 1) * invs_Vi;
+      next_flux_mom_(g, i, 1) = ls_tally_(g, i, 2) * invs_Vi;
+    }
+  }
+  normalize_flux(sflux, src, g_begin, g_end);
+}
+
 void MOCDriver::generate_azimuthal_quadrature(std::uint32_t n_angles,
                                               double d) {
   spdlog::info("Creating quadrature");
@@ -1017,6 +3457,16 @@ void MOCDriver::generate_azimuthal_quadrature(std::uint32_t n_angles,
     double nx = std::floor((Dy / d) * std::abs(std::sin(phi_i))) + 1.;
     double ny = std::floor((Dx / d) * std::abs(std::cos(phi_i))) + 1.;
 
+    // For modular ray tracing, the tracks must cross every tile in the same
+    // manner. We therefore have a whole number of tracks per tile along each
+    // boundary, which only reduces the track spacing.
+    if (modular_rt_) {
+      const double Nx = static_cast<double>(geometry_->nx());
+      const double Ny = static_cast<double>(geometry_->ny());
+      nx = std::ceil(nx / Nx) * Nx;
+      ny = std::ceil(ny / Ny) * Ny;
+    }
+
     // Calculate information for a given angle, except the weight.
     // Weight is calculated once all angles are known.
     angle_info_[i].phi = std::atan((Dy * nx) / (Dx * ny));
@@ -1055,6 +3505,7 @@ void MOCDriver::generate_azimuthal_quadrature(std::uint32_t n_angles,
 }
 
 void MOCDriver::trace_tracks() {
+  SCARABEE_PROFILE_ZONE("MOCDriver::trace_tracks");
   spdlog::info("Tracing tracks");
 
   std::uint32_t n_track_angles_ =
@@ -1062,191 +3513,162 @@ void MOCDriver::trace_tracks() {
   const double Dx = geometry_->x_max() - geometry_->x_min();
   const double Dy = geometry_->y_max() - geometry_->y_min();
 
+  // The number and the lengths of the tracks vary a lot between angles, so
+  // the individual tracks of all angles are distributed over the threads.
   tracks_.resize(n_track_angles_);
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> work;
+  for (std::uint32_t i = 0; i < n_track_angles_; i++) {
+    const auto& ai = angle_info_[i];
+    tracks_[i].resize(ai.nx + ai.ny);
+    for (std::uint32_t t = 0; t < (ai.nx + ai.ny); t++) work.emplace_back(i, t);
+  }
+
+  // Start position of track t of an angle
+  auto track_start = [&](const AngleInfo& ai, std::uint32_t t) {
+    // spacing between starts in x
+    const double dx = Dx / static_cast<double>(ai.nx);
+    // spacing between starts in y
+    const double dy = Dy / static_cast<double>(ai.ny);
+
+    // Depending on angle, we either start on the -x bound, or the +x bound
+    if (ai.phi < 0.5 * PI) {
+      // Start on -x boundary in upper left corner and move down, then across
+      // the -y boundary.
+      if (t < ai.ny) {
+        return Vector(geometry_->x_min(),
+                      dy * (static_cast<double>(ai.ny - 1 - t) + 0.5) +
+                          geometry_->y_min());
+      }
+      return Vector(dx * (static_cast<double>(t - ai.ny) + 0.5) +
+                        geometry_->x_min(),
+                    geometry_->y_min());
+    }
+
+    // Start on -y boundary in lower left corner and move across, then up the
+    // +x boundary.
+    if (t < ai.nx) {
+      return Vector(dx * (static_cast<double>(t) + 0.5) + geometry_->x_min(),
+                    geometry_->y_min());
+    }
+    return Vector(geometry_->x_max(),
+                  dy * (static_cast<double>(t - ai.nx) + 0.5) +
+                      geometry_->y_min());
+  };
+
+  // FSRs found in each CMFD cell by each thread, with duplicates
+  const std::size_t ncmfd_tiles = cmfd_ ? cmfd_->nx() * cmfd_->ny() : 0;
+  std::vector<std::vector<std::vector<std::size_t>>> thread_cmfd_tile_fsrs(
+      max_threads());
+  bool lost_cmfd_cell = false;
+
+  // With on-the-fly tracing, the tracks keep no segments. Only the number
+  // of segments of each track, in track order, and the approximate FSR
+  // volumes of each angle are kept.
+  const bool otf = otf_tracing_;
+  const std::vector<Segment> no_segments;
+  xt::xtensor<double, 2> approx_vols;
+  std::vector<std::size_t> angle_first_track(n_track_angles_, 0);
+  if (otf) {
+    approx_vols = xt::zeros<double>({std::size_t{n_track_angles_}, nfsrs_});
+    for (std::uint32_t i = 1; i < n_track_angles_; i++) {
+      angle_first_track[i] = angle_first_track[i - 1] + tracks_[i - 1].size();
+    }
+    otf_track_nsegs_.assign(work.size(), 0);
+  }
 
 #pragma omp parallel
   {
-    std::vector<std::set<std::size_t>> thread_cmfd_tile_fsrs;
-    if (cmfd_) thread_cmfd_tile_fsrs.resize(cmfd_->nx() * cmfd_->ny());
+    auto& cmfd_tile_fsrs = thread_cmfd_tile_fsrs[thread_index()];
+    cmfd_tile_fsrs.resize(ncmfd_tiles);
 
-#pragma omp for
-    for (int ii = 0; ii < static_cast<int>(n_track_angles_); ii++) {
-      const std::size_t i = static_cast<std::size_t>(ii);
+    // Segments of the tiles which were already crossed with each angle
+    std::vector<TileTemplates> templates(modular_rt_ ? n_track_angles_ : 0);
 
+    // Traces track t of angle i into segments
+    std::vector<Segment> segments;
+    auto trace_track = [&](std::uint32_t i, std::uint32_t t) {
       const auto& ai = angle_info_[i];
 
-      // Allocate space for tracks associated with this angle
-      tracks_[i].reserve(ai.nx + ai.ny);
-
       // Get direction for the track
       Direction u(ai.phi);
 
-      // spacing between starts in x
-      const double dx = Dx / static_cast<double>(ai.nx);
-      // spacing between starts in y
-      const double dy = Dy / static_cast<double>(ai.ny);
-
-      // Depending on angle, we either start on the -x bound, or the +x bound
-      if (ai.phi < 0.5 * PI) {
-        // Start on -x boundary in upper left corner and move down
-        double x = geometry_->x_min();
-        double y =
-            dy * (static_cast<double>(ai.ny - 1) + 0.5) + geometry_->y_min();
-        for (std::uint32_t t = 0; t < (ai.nx + ai.ny); t++) {
-          if (t == ai.ny) {
-            // Next, we move across the -y boundary
-            y = geometry_->y_min();
-            x = 0.5 * dx + geometry_->x_min();
-          }
-
-          Vector r_start(x, y);
-          Vector r_end = r_start;
-          std::vector<Segment> segments;
-          std::pair<UniqueFSR, Vector> fsr_r =
-              geometry_->get_fsr_r_local(r_end, u);
-          auto ti = geometry_->get_tile_index(r_end, u);
-          while (fsr_r.first.fsr && ti) {
-            const double d = fsr_r.first.fsr->distance(fsr_r.second, u);
-            segments.emplace_back(fsr_r.first.fsr, d,
-                                  this->get_fsr_indx(fsr_r.first));
-
-            if (cmfd_) {
-              auto& seg = segments.back();
-              seg.entry_cmfd_surface() = cmfd_->get_surface(r_end, u);
-              thread_cmfd_tile_fsrs[seg.entry_cmfd_surface().cell_index].insert(
-                  seg.fsr_indx());
-            }
-
-            r_end = r_end + d * u;
-
-            if (cmfd_) {
-              segments.back().exit_cmfd_surface() =
-                  cmfd_->get_surface(r_end, -u);
-            }
-
-            ti = geometry_->get_tile_index(r_end, u);
-            if (ti) fsr_r = geometry_->get_fsr_r_local(r_end, u);
-          }
-
-          tracks_[i].emplace_back(r_start, r_end, u, ai.phi, ai.wgt, ai.d,
-                                  segments, ai.forward_index,
-                                  ai.backward_index);
-
-          if (cmfd_) {
-            // Assign CMFD cells to exit/entry of tracks for angular flux
-            // updating later
-            auto& moc_track = tracks_[i].back();
-            auto entry_cell =
-                cmfd_->get_tile(moc_track.entry_pos(), moc_track.dir());
-            auto exit_cell =
-                cmfd_->get_tile(moc_track.exit_pos(), -moc_track.dir());
-            if (entry_cell.has_value() == false ||
-                exit_cell.has_value() == false) {
-              const auto mssg =
-                  "Could not find entry/exit CMFD cells for track during "
-                  "tracing";
-              spdlog::error(mssg);
-              throw ScarabeeException(mssg);
-            }
-
-            moc_track.entry_cmfd_cell() = cmfd_->tile_to_indx(*entry_cell);
-            moc_track.exit_cmfd_cell() = cmfd_->tile_to_indx(*exit_cell);
-          }
-
-          if (t < ai.ny) {
-            y -= dy;
-          } else {
-            x += dx;
-          }
-        }
-      } else {
-        // Start on -y boundary in lower left corner and move across and up
-        double x = 0.5 * dx + geometry_->x_min();
-        double y = geometry_->y_min();
-        for (std::uint32_t t = 0; t < (ai.nx + ai.ny); t++) {
-          if (t == ai.nx) {
-            // Next, we move across the -y boundary
-            x = geometry_->x_max();
-            y = 0.5 * dy + geometry_->y_min();
-          }
-
-          Vector r_start(x, y);
-          Vector r_end = r_start;
-          std::vector<Segment> segments;
-          std::pair<UniqueFSR, Vector> fsr_r =
-              geometry_->get_fsr_r_local(r_end, u);
-          auto ti = geometry_->get_tile_index(r_end, u);
-          while (fsr_r.first.fsr && ti) {
-            const double d = fsr_r.first.fsr->distance(fsr_r.second, u);
-            segments.emplace_back(fsr_r.first.fsr, d,
-                                  this->get_fsr_indx(fsr_r.first));
-
-            if (cmfd_) {
-              auto& seg = segments.back();
-              seg.entry_cmfd_surface() = cmfd_->get_surface(r_end, u);
-              thread_cmfd_tile_fsrs[seg.entry_cmfd_surface().cell_index].insert(
-                  seg.fsr_indx());
-            }
-
-            r_end = r_end + d * u;
-
-            if (cmfd_) {
-              segments.back().exit_cmfd_surface() =
-                  cmfd_->get_surface(r_end, -u);
-            }
-
-            ti = geometry_->get_tile_index(r_end, u);
-            if (ti) fsr_r = geometry_->get_fsr_r_local(r_end, u);
-          }
+      const Vector r_start = track_start(ai, t);
+      segments.clear();
+      const Vector r_end =
+          trace_segments(r_start, u, segments, cmfd_tile_fsrs,
+                         modular_rt_ ? &templates[i] : nullptr);
 
-          tracks_[i].emplace_back(r_start, r_end, u, ai.phi, ai.wgt, ai.d,
-                                  segments, ai.forward_index,
-                                  ai.backward_index);
-
-          if (cmfd_) {
-            // Assign CMFD cells to exit/entry of tracks for angular flux
-            // updating later
-            auto& moc_track = tracks_[i].back();
-            auto entry_cell =
-                cmfd_->get_tile(moc_track.entry_pos(), moc_track.dir());
-            auto exit_cell =
-                cmfd_->get_tile(moc_track.exit_pos(), -moc_track.dir());
-            if (entry_cell.has_value() == false ||
-                exit_cell.has_value() == false) {
-              const auto mssg =
-                  "Could not find entry/exit CMFD cells for track during "
-                  "tracing";
-              spdlog::error(mssg);
-              throw ScarabeeException(mssg);
-            }
+      auto& moc_track = tracks_[i][t];
+      moc_track =
+          Track(r_start, r_end, u, ai.phi, ai.wgt, ai.d,
+                otf ? no_segments : segments, ai.forward_index,
+                ai.backward_index);
 
-            moc_track.entry_cmfd_cell() = cmfd_->tile_to_indx(*entry_cell);
-            moc_track.exit_cmfd_cell() = cmfd_->tile_to_indx(*exit_cell);
-          }
-
-          if (t < ai.nx) {
-            x += dx;
-          } else {
-            y += dy;
-          }
+      if (cmfd_) {
+        // Assign CMFD cells to exit/entry of tracks for angular flux
+        // updating later
+        auto entry_cell =
+            cmfd_->get_tile(moc_track.entry_pos(), moc_track.dir());
+        auto exit_cell =
+            cmfd_->get_tile(moc_track.exit_pos(), -moc_track.dir());
+        if (entry_cell.has_value() == false ||
+            exit_cell.has_value() == false) {
+          // Exceptions may not leave the parallel region
+#pragma omp atomic write
+          lost_cmfd_cell = true;
+        } else {
+          moc_track.entry_cmfd_cell() = cmfd_->tile_to_indx(*entry_cell);
+          moc_track.exit_cmfd_cell() = cmfd_->tile_to_indx(*exit_cell);
         }
       }
-    }
-
-#pragma omp critical
-    {
-      if (cmfd_) {
-        for (std::size_t ti = 0; ti < thread_cmfd_tile_fsrs.size(); ti++) {
-          for (const auto& fsr : thread_cmfd_tile_fsrs[ti]) {
-            cmfd_->insert_fsr(ti, fsr);
+    };
+
+    if (otf) {
+      // Each angle is traced by a single thread, which sums its volumes in
+      // the order of the tracks, as in segment_renormalization
+#pragma omp for schedule(dynamic)
+      for (int ii = 0; ii < static_cast<int>(n_track_angles_); ii++) {
+        const std::uint32_t i = static_cast<std::uint32_t>(ii);
+        const double d = angle_info_[i].d;
+        for (std::uint32_t t = 0; t < tracks_[i].size(); t++) {
+          trace_track(i, t);
+          for (const auto& seg : segments) {
+            approx_vols(i, seg.fsr_indx()) += seg.length() * d;
           }
+          otf_track_nsegs_[angle_first_track[i] + t] = segments.size();
         }
       }
+    } else {
+#pragma omp for schedule(dynamic)
+      for (int iw = 0; iw < static_cast<int>(work.size()); iw++) {
+        const auto [i, t] = work[static_cast<std::size_t>(iw)];
+        trace_track(i, t);
+      }
     }
-
   }  // Parallel section
 
-  if (cmfd_) cmfd_->pack_fsr_lists();
+  if (lost_cmfd_cell) {
+    const auto mssg =
+        "Could not find entry/exit CMFD cells for track during tracing";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (otf) otf_renormalization(approx_vols);
+
+  if (cmfd_) {
+    // Each CMFD cell is merged by a single thread, and is then sorted and
+    // made unique by pack_fsr_lists.
+#pragma omp parallel for schedule(dynamic)
+    for (int iti = 0; iti < static_cast<int>(ncmfd_tiles); iti++) {
+      const std::size_t ti = static_cast<std::size_t>(iti);
+      for (const auto& cmfd_tile_fsrs : thread_cmfd_tile_fsrs) {
+        if (cmfd_tile_fsrs.empty()) continue;
+        cmfd_->insert_fsrs(ti, cmfd_tile_fsrs[ti]);
+      }
+    }
+    cmfd_->pack_fsr_lists();
+  }
 }
 
 std::vector<std::pair<std::size_t, double>> MOCDriver::trace_fsr_segments(
@@ -1267,6 +3689,122 @@ std::vector<std::pair<std::size_t, double>> MOCDriver::trace_fsr_segments(
   return out;
 }
 
+std::vector<std::vector<std::pair<std::size_t, double>>>
+MOCDriver::trace_fsr_segments(const xt::xtensor<double, 2>& r_start,
+                              const Direction& u) const {
+  if (r_start.shape()[1] != 2) {
+    const auto mssg = "Positions must be given as an (N, 2) array.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t N = r_start.shape()[0];
+  std::vector<std::vector<std::pair<std::size_t, double>>> out(N);
+#pragma omp parallel for schedule(dynamic)
+  for (int in = 0; in < static_cast<int>(N); in++) {
+    const std::size_t n = static_cast<std::size_t>(in);
+    out[n] = this->trace_fsr_segments(Vector(r_start(n, 0), r_start(n, 1)), u);
+  }
+
+  return out;
+}
+
+Vector MOCDriver::trace_segments(
+    const Vector& r_start, const Direction& u, std::vector<Segment>& segments,
+    std::vector<std::vector<std::size_t>>& cmfd_tile_fsrs,
+    TileTemplates* templates) const {
+  Vector r_end = r_start;
+
+  auto add_segment = [&](const FlatSourceRegion* fsr, std::size_t instance,
+                         double d) {
+    segments.emplace_back(fsr, d, this->get_fsr_indx(fsr->id(), instance));
+
+    if (cmfd_) {
+      auto& seg = segments.back();
+      seg.entry_cmfd_surface() = cmfd_->get_surface(r_end, u);
+      // Consecutive segments are often in the same FSR
+      auto& tile_fsrs = cmfd_tile_fsrs[seg.entry_cmfd_surface().cell_index];
+      if (tile_fsrs.empty() || tile_fsrs.back() != seg.fsr_indx()) {
+        tile_fsrs.push_back(seg.fsr_indx());
+      }
+    }
+
+    r_end = r_end + d * u;
+
+    if (cmfd_) {
+      segments.back().exit_cmfd_surface() = cmfd_->get_surface(r_end, -u);
+    }
+  };
+
+  auto ti = geometry_->get_tile_index(r_end, u);
+  while (ti) {
+    const Cartesian2D::TileIndex tile_indx = *ti;
+    const auto& tile = geometry_->tile(tile_indx);
+    const Vector tile_center = geometry_->get_tile_center(tile_indx);
+
+    // Identical tiles crossed at the same local position have identical
+    // segments, up to the offset of the FSR instances.
+    TileKey key{nullptr, 0, 0};
+    if (templates) {
+      const Vector r_local = r_end - tile_center;
+      key = {tile.c2d ? static_cast<const void*>(tile.c2d.get())
+                      : static_cast<const void*>(tile.cell.get()),
+             std::llround(r_local.x() / TILE_TEMPLATE_TOL),
+             std::llround(r_local.y() / TILE_TEMPLATE_TOL)};
+
+      const auto it = templates->find(key);
+      if (it != templates->end()) {
+        for (const auto& ts : it->second) {
+          const std::size_t offset =
+              geometry_->fsr_offset(tile_indx, ts.fsr->id());
+          add_segment(ts.fsr, ts.instance + offset, ts.length);
+        }
+        ti = geometry_->get_tile_index(r_end, u);
+        continue;
+      }
+    }
+
+    // Trace the segments of the tile
+    std::vector<TileSegment> tile_segments;
+    auto fsr_r = geometry_->get_fsr_r_local(r_end, u);
+    while (fsr_r.first.fsr && ti && ti->i == tile_indx.i &&
+           ti->j == tile_indx.j) {
+      const auto& fsr = fsr_r.first;
+      const double d = fsr.fsr->distance(fsr_r.second, u);
+      if (templates) {
+        const std::size_t offset =
+            geometry_->fsr_offset(tile_indx, fsr.fsr->id());
+        tile_segments.push_back({fsr.fsr, fsr.instance - offset, d});
+      }
+      add_segment(fsr.fsr, fsr.instance, d);
+
+      ti = geometry_->get_tile_index(r_end, u);
+      if (ti && tile.cell && ti->i == tile_indx.i && ti->j == tile_indx.j) {
+        // Still in the same cell, so we start from the neighbors of the FSR
+        const Vector r_local = r_end - tile_center;
+        UniqueFSR next = tile.cell->next_fsr(*fsr.fsr, r_local, u);
+        if (next.fsr) {
+          next.instance += geometry_->fsr_offset(tile_indx, next.fsr->id());
+        }
+        fsr_r = {next, r_local};
+      } else if (ti) {
+        fsr_r = geometry_->get_fsr_r_local(r_end, u);
+      }
+    }
+
+    // When no FSR is found, we are lost in the geometry and the track ends.
+    // The template is only kept if the whole tile was crossed.
+    const bool lost = ti && fsr_r.first.fsr == nullptr;
+    const bool same_tile = ti && ti->i == tile_indx.i && ti->j == tile_indx.j;
+    if (templates && tile_segments.empty() == false && !(lost && same_tile)) {
+      templates->emplace(key, std::move(tile_segments));
+    }
+    if (lost) break;
+  }
+
+  return r_end;
+}
+
 void MOCDriver::set_periodic_bcs_x() {
   // We are setting the boundarys a x_min and x_max, so we need to do all
   // the y tracks that start and end on those sides.
@@ -1276,16 +3814,16 @@ void MOCDriver::set_periodic_bcs_x() {
 
     if (ai.phi < PI_2) {
       for (std::size_t j = 0; j < ai.ny; j++) {
-        tracks[ai.nx + j].set_exit_track_flux(&tracks[j].entry_flux());
-        tracks[j].set_entry_track_flux(&tracks[ai.nx + j].exit_flux());
+        tracks[ai.nx + j].set_exit_track_flux(tracks[j].entry_flux());
+        tracks[j].set_entry_track_flux(tracks[ai.nx + j].exit_flux());
 
         tracks[ai.nx + j].exit_bc() = BoundaryCondition::Periodic;
         tracks[j].entry_bc() = BoundaryCondition::Periodic;
       }
     } else {
       for (std::size_t j = 0; j < ai.ny; j++) {
-        tracks[j].set_exit_track_flux(&tracks[ai.nx + j].entry_flux());
-        tracks[ai.nx + j].set_entry_track_flux(&tracks[j].exit_flux());
+        tracks[j].set_exit_track_flux(tracks[ai.nx + j].entry_flux());
+        tracks[ai.nx + j].set_entry_track_flux(tracks[j].exit_flux());
 
         tracks[j].exit_bc() = BoundaryCondition::Periodic;
         tracks[ai.nx + j].entry_bc() = BoundaryCondition::Periodic;
@@ -1303,16 +3841,16 @@ void MOCDriver::set_periodic_bcs_y() {
 
     if (ai.phi < PI_2) {
       for (std::size_t i = 0; i < ai.nx; i++) {
-        tracks[i].set_exit_track_flux(&tracks[ai.ny + i].entry_flux());
-        tracks[ai.ny + i].set_entry_track_flux(&tracks[i].exit_flux());
+        tracks[i].set_exit_track_flux(tracks[ai.ny + i].entry_flux());
+        tracks[ai.ny + i].set_entry_track_flux(tracks[i].exit_flux());
 
         tracks[i].exit_bc() = BoundaryCondition::Periodic;
         tracks[ai.ny + i].entry_bc() = BoundaryCondition::Periodic;
       }
     } else {
       for (std::size_t i = 0; i < ai.nx; i++) {
-        tracks[i].set_entry_track_flux(&tracks[ai.ny + i].exit_flux());
-        tracks[ai.ny + i].set_exit_track_flux(&tracks[i].entry_flux());
+        tracks[i].set_entry_track_flux(tracks[ai.ny + i].exit_flux());
+        tracks[ai.ny + i].set_exit_track_flux(tracks[i].entry_flux());
 
         tracks[i].entry_bc() = BoundaryCondition::Periodic;
         tracks[ai.ny + i].exit_bc() = BoundaryCondition::Periodic;
@@ -1330,8 +3868,8 @@ void MOCDriver::set_ref_vac_bcs_y_max() {
 
     // Go through intersections on top side
     for (std::uint32_t i = 0; i < ai.nx; i++) {
-      tracks.at(i).set_exit_track_flux(&comp_tracks.at(ai.ny + i).exit_flux());
-      comp_tracks.at(ai.ny + i).set_exit_track_flux(&tracks.at(i).exit_flux());
+      tracks.at(i).set_exit_track_flux(comp_tracks.at(ai.ny + i).exit_flux());
+      comp_tracks.at(ai.ny + i).set_exit_track_flux(tracks.at(i).exit_flux());
 
       tracks.at(i).exit_bc() = this->y_max_bc_;
       comp_tracks.at(ai.ny + i).exit_bc() = this->y_max_bc_;
@@ -1349,9 +3887,9 @@ void MOCDriver::set_ref_vac_bcs_y_min() {
     // Go through intersections on bottom side
     for (std::uint32_t i = 0; i < ai.nx; i++) {
       tracks.at(ai.ny + i).set_entry_track_flux(
-          &comp_tracks.at(i).entry_flux());
+          comp_tracks.at(i).entry_flux());
       comp_tracks.at(i).set_entry_track_flux(
-          &tracks.at(ai.ny + i).entry_flux());
+          tracks.at(ai.ny + i).entry_flux());
 
       tracks.at(ai.ny + i).entry_bc() = this->y_min_bc_;
       comp_tracks.at(i).entry_bc() = this->y_min_bc_;
@@ -1370,9 +3908,9 @@ void MOCDriver::set_ref_vac_bcs_x_max() {
     // Go down right side
     for (std::uint32_t i = 0; i < ai.ny; i++) {
       tracks.at(ai.nx + i).set_exit_track_flux(
-          &comp_tracks.at(nt - 1 - i).entry_flux());
+          comp_tracks.at(nt - 1 - i).entry_flux());
       comp_tracks.at(nt - 1 - i)
-          .set_entry_track_flux(&tracks.at(ai.nx + i).exit_flux());
+          .set_entry_track_flux(tracks.at(ai.nx + i).exit_flux());
 
       tracks.at(ai.nx + i).exit_bc() = this->x_max_bc_;
       comp_tracks.at(nt - 1 - i).entry_bc() = this->x_max_bc_;
@@ -1391,39 +3929,290 @@ void MOCDriver::set_ref_vac_bcs_x_min() {
     // Go down left/right sides
     for (std::uint32_t i = 0; i < ai.ny; i++) {
       tracks.at(i).set_entry_track_flux(
-          &comp_tracks.at(ai.ny - 1 - i).exit_flux());
+          comp_tracks.at(ai.ny - 1 - i).exit_flux());
       comp_tracks.at(ai.ny - 1 - i)
-          .set_exit_track_flux(&tracks.at(i).entry_flux());
+          .set_exit_track_flux(tracks.at(i).entry_flux());
+
+      tracks.at(i).entry_bc() = this->x_min_bc_;
+      comp_tracks.at(ai.ny - 1 - i).exit_bc() = this->x_min_bc_;
+    }
+  }
+}
+
+void MOCDriver::set_bcs() {
+  if (x_min_bc_ == BoundaryCondition::Periodic) {
+    set_periodic_bcs_x();
+  } else {
+    set_ref_vac_bcs_x_max();
+    set_ref_vac_bcs_x_min();
+  }
+
+  if (y_min_bc_ == BoundaryCondition::Periodic) {
+    set_periodic_bcs_y();
+  } else {
+    set_ref_vac_bcs_y_max();
+    set_ref_vac_bcs_y_min();
+  }
+}
+
+void MOCDriver::allocate_track_fluxes() {
+  // List of the tracks, indexed by their provisional flux slot
+  std::vector<Track*> slot_tracks;
+  for (auto& tracks : tracks_) {
+    for (auto& track : tracks) slot_tracks.push_back(&track);
+  }
+  const std::size_t ntracks = slot_tracks.size();
+
+  // Follow the track connections in the forward direction, so that a track
+  // and the track which receives its outgoing flux get neighbouring slots.
+  std::vector<std::size_t> new_slot(ntracks, ntracks);
+  std::size_t next_slot = 0;
+  for (std::size_t start = 0; start < ntracks; start++) {
+    std::size_t t = start;
+    while (new_slot[t] == ntracks) {
+      new_slot[t] = next_slot++;
+      const Track& track = *slot_tracks[t];
+      if (track.exit_bc() == BoundaryCondition::Vacuum) break;
+      t = track.exit_track_flux() / 2;
+    }
+  }
+
+  const auto remap = [&new_slot](std::size_t row) {
+    return 2 * new_slot[row / 2] + row % 2;
+  };
+  for (std::size_t t = 0; t < ntracks; t++) {
+    Track& track = *slot_tracks[t];
+    track.set_flux_slot(new_slot[t]);
+    track.set_entry_track_flux(remap(track.entry_track_flux()));
+    track.set_exit_track_flux(remap(track.exit_track_flux()));
+  }
+
+  track_flux_ = xt::xtensor<StoredReal, 3>::from_shape(
+      {2 * ntracks, ngroups_, n_pol_angles_});
+  parallel_fill(track_flux_.data(), track_flux_.size(), StoredReal(0.));
+}
+
+void MOCDriver::save_solution() {
+  if (extrap_order_ == 0 || record_solutions_ == false) return;
+
+  // A solve at the same step replaces the previous solution of that step
+  const bool replace_last =
+      history_.empty() == false && history_.back().step == solution_step_;
+  if (replace_last) history_.pop_back();
+
+  history_.push_back({solution_step_, keff_, flux_, track_flux_});
+  if (history_.size() > extrap_order_ + 1) history_.erase(history_.begin());
+
+  if (cmfd_) cmfd_->save_solution(replace_last, extrap_order_ + 1);
+}
+
+void MOCDriver::extrapolate_solution() {
+  if (solved_ == false || history_.size() < 2) return;
+  if (history_.back().step == solution_step_) return;
+
+  // The history is of no use if the problem has changed shape
+  const auto& last = history_.back();
+  if (last.flux.shape() != flux_.shape() ||
+      last.track_flux.shape() != track_flux_.shape()) {
+    this->clear_solution_history();
+    return;
+  }
+
+  const std::size_t n = std::min(history_.size(), extrap_order_ + 1);
+  const std::size_t first = history_.size() - n;
+  std::vector<double> steps;
+  for (std::size_t k = first; k < history_.size(); k++) {
+    steps.push_back(history_[k].step);
+  }
+  const auto w = lagrange_weights(steps, solution_step_);
+  spdlog::info("Extrapolating initial guess from {} previous solutions.", n);
+
+  flux_.fill(0.);
+  track_flux_.fill(0.);
+  double keff = 0.;
+  for (std::size_t k = 0; k < n; k++) {
+    const auto& rec = history_[first + k];
+    flux_ += w[k] * rec.flux;
+    track_flux_ += w[k] * rec.track_flux;
+    keff += w[k] * rec.keff;
+  }
+
+  // Negative scalar or angular fluxes would be unphysical, so we keep the
+  // last solution there. Higher flux moments may be negative.
+  for (std::size_t g = 0; g < ngroups_; g++) {
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      if (flux_(g, i, 0) < 0.) {
+        xt::view(flux_, g, i, xt::all()) = xt::view(last.flux, g, i, xt::all());
+      }
+    }
+  }
+  for (std::size_t j = 0; j < track_flux_.size(); j++) {
+    if (track_flux_.flat(j) < 0.) track_flux_.flat(j) = last.track_flux.flat(j);
+  }
+  keff_ = keff > 0. ? keff : last.keff;
+
+  if (cmfd_) cmfd_->extrapolate_solution(w);
+}
+
+void MOCDriver::fill_material_tables() {
+  const std::size_t nmats = xs_list_.size();
+  mat_Et_.resize({nmats, ngroups_});
+  mat_invs_Et_.resize({nmats, ngroups_});
+  mat_vEf_.resize({nmats, ngroups_});
+  mat_chi_.resize({nmats, ngroups_});
+
+  for (std::size_t m = 0; m < nmats; m++) {
+    const auto& mat = *xs_list_[m];
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      // The isotropic sweep uses the transport corrected total xs, while the
+      // anisotropic sweep uses the true total xs.
+      const double Et = anisotropic_ ? mat.Et(g) : mat.Etr(g);
+      mat_Et_(m, g) = Et;
+      mat_invs_Et_(m, g) = 1. / Et;
+      mat_vEf_(m, g) = mat.vEf(g);
+      mat_chi_(m, g) = mat.chi(g);
+    }
+  }
+
+  // Scattering matrices, transposed so that the entries are grouped by
+  // outgoing group, and without the zeros. The anisotropic source has a
+  // value for each Legendre moment, and keeps an incoming group if any of
+  // its moments is non-zero. Values are read from the stored bands of the
+  // packed matrix, so incoming groups whose band misses the outgoing group
+  // are skipped without a lookup. The anisotropic sweep uses the true
+  // scattering matrix, which has the transport correction on the diagonal.
+  const std::size_t NL = anisotropic_ ? max_L_ + 1 : 1;
+  auto scatter_xs = [this](const CrossSection& mat, std::size_t l,
+                           std::size_t gin, std::size_t gout) {
+    const XS2D& Es = mat.Es_XS2D();
+    if (l > Es.max_legendre_order()) return 0.;
+
+    double xs = 0.;
+    if (gout >= Es.band_min(gin) && gout <= Es.band_max(gin)) {
+      xs = Es.band(l, gin)[gout - Es.band_min(gin)];
+    }
+    if (anisotropic_ && l == 0 && gin == gout) xs += mat.Dtr(gin);
+    return xs;
+  };
+  auto in_band = [this](const CrossSection& mat, std::size_t gin,
+                        std::size_t gout) {
+    const XS2D& Es = mat.Es_XS2D();
+    if (anisotropic_ && gin == gout) return true;
+    return gout >= Es.band_min(gin) && gout <= Es.band_max(gin);
+  };
+  mat_scat_offsets_.assign(1, 0);
+  mat_scat_gin_.clear();
+  mat_scat_xs_.clear();
+  upscatter_group_ = ngroups_;
+  for (std::size_t m = 0; m < nmats; m++) {
+    const auto& mat = *xs_list_[m];
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      for (std::size_t gg = 0; gg < ngroups_; gg++) {
+        if (in_band(mat, gg, g) == false) continue;
+
+        bool nonzero = false;
+        for (std::size_t l = 0; l < NL; l++) {
+          if (scatter_xs(mat, l, gg, g) != 0.) nonzero = true;
+        }
+        if (nonzero == false) continue;
+        if (gg > g) upscatter_group_ = std::min(upscatter_group_, g);
+
+        mat_scat_gin_.push_back(static_cast<std::uint32_t>(gg));
+        for (std::size_t l = 0; l < NL; l++) {
+          mat_scat_xs_.push_back(scatter_xs(mat, l, gg, g));
+        }
+      }
+      mat_scat_offsets_.push_back(mat_scat_gin_.size());
+    }
+  }
+}
+
+void MOCDriver::fill_fission_source(const xt::xtensor<double, 3>& flux) {
+  SCARABEE_PROFILE_ZONE("MOCDriver::fill_fission_source");
+  SolverTelemetry::ScopedPhase phase(telemetry_, "fill_source");
+  const double inv_k = 1. / keff_;
+  fission_src_.resize(nfsrs_);
 
-      tracks.at(i).entry_bc() = this->x_min_bc_;
-      comp_tracks.at(ai.ny - 1 - i).exit_bc() = this->x_min_bc_;
+#pragma omp parallel for
+  for (int ii = 0; ii < static_cast<int>(nfsrs_); ii++) {
+    const std::size_t i = static_cast<std::size_t>(ii);
+    const std::size_t m = fsr_xs_indx_[i];
+    double rate = 0.;
+    for (std::size_t gg = 0; gg < ngroups_; gg++) {
+      rate += mat_vEf_(m, gg) * flux(gg, i, 0);
     }
+    fission_src_[i] = inv_k * rate;
   }
 }
 
-void MOCDriver::set_bcs() {
-  if (x_min_bc_ == BoundaryCondition::Periodic) {
-    set_periodic_bcs_x();
-  } else {
-    set_ref_vac_bcs_x_max();
-    set_ref_vac_bcs_x_min();
+void MOCDriver::fill_exponentials() {
+  exp_store_.clear();
+  if (exp_mode_ != ExponentialMode::Precomputed) {
+    exp_store_.shrink_to_fit();
+    return;
   }
 
-  if (y_min_bc_ == BoundaryCondition::Periodic) {
-    set_periodic_bcs_y();
-  } else {
-    set_ref_vac_bcs_y_max();
-    set_ref_vac_bcs_y_min();
+  if (direct_segments() == false) {
+    spdlog::warn(
+        "Precomputed exponentials are not available with on-the-fly "
+        "tracing or compressed segments. The rational approximation will be "
+        "used instead.");
+    exp_store_.shrink_to_fit();
+    return;
   }
-}
 
-void MOCDriver::allocate_track_fluxes() {
-  for (auto& tracks : tracks_) {
-    for (auto& track : tracks) {
-      track.entry_flux() = xt::zeros<double>({ngroups_, n_pol_angles_});
-      track.exit_flux() = xt::zeros<double>({ngroups_, n_pol_angles_});
+  const auto invs_sin = polar_quad_.invs_sin();
+  const std::size_t npol = invs_sin.size();
+  const std::size_t nsegs = seg_store_.nsegments();
+  const double mem = static_cast<double>(ngroups_ * nsegs * npol) *
+                     static_cast<double>(sizeof(double)) / (1024. * 1024.);
+  if (mem > exp_max_memory_) {
+    spdlog::warn(
+        "Precomputed exponentials require {:.1f} MB, which exceeds the limit "
+        "of {:.1f} MB. The rational approximation will be used instead.",
+        mem, exp_max_memory_);
+    exp_store_.shrink_to_fit();
+    return;
+  }
+
+  spdlog::info("Precomputing exponentials ({:.1f} MB)", mem);
+  exp_store_.resize(ngroups_ * nsegs * npol);
+
+#pragma omp parallel for
+  for (int ig = 0; ig < static_cast<int>(ngroups_); ig++) {
+    const std::size_t g = static_cast<std::size_t>(ig);
+    double* exp_m1 = &exp_store_[g * nsegs * npol];
+    for (std::size_t s = 0; s < nsegs; s++) {
+      const double lEt =
+          seg_store_.length(s) * mat_Et_(seg_store_.xs_indx(s), g);
+      for (std::size_t p = 0; p < npol; p++) {
+        exp_m1[s * npol + p] = lEt * invs_sin[p];
+      }
     }
+
+    // The whole group is evaluated at once, in SIMD
+    mexp_array(exp_m1, exp_m1, nsegs * npol);
+  }
+}
+
+const double* MOCDriver::segment_exponentials(
+    std::size_t s, std::size_t g, double lEt,
+    std::array<double, 6>& buf) const {
+  const auto invs_sin = polar_quad_.invs_sin();
+  const std::size_t npol = invs_sin.size();
+
+  if (exp_store_.empty() == false) {
+    return &exp_store_[(g * seg_store_.nsegments() + s) * npol];
+  }
+
+  if (exp_mode_ == ExponentialMode::Table) {
+    for (std::size_t p = 0; p < npol; p++)
+      buf[p] = exp_table_(lEt * invs_sin[p]);
+  } else {
+    for (std::size_t p = 0; p < npol; p++) buf[p] = mexp(lEt * invs_sin[p]);
   }
+
+  return buf.data();
 }
 
 void MOCDriver::allocate_fsr_data() {
@@ -1434,6 +4223,7 @@ void MOCDriver::allocate_fsr_data() {
     spdlog::error(mssg);
     throw ScarabeeException(mssg);
   }
+  fsrs_.clear();
   fsrs_.reserve(nfsrs_);
 
   // Get all FSRs IDs, and pointers to them
@@ -1443,26 +4233,144 @@ void MOCDriver::allocate_fsr_data() {
 
   // We now create offsets for each FSR ID, so that we can get a linear index
   // in the global FSR array, based on the ID and the unique instance number.
-  for (auto id : fsr_ids) fsr_offsets_[id] = 0;
-  auto id_it_prev = fsr_offsets_.begin();
-  for (auto id_it = ++fsr_offsets_.begin(); id_it != fsr_offsets_.end();
-       id_it++) {
-    const std::size_t id_prev = id_it_prev->first;
-    const std::size_t ninst_prev = geometry_->get_num_fsr_instances(id_prev);
-    fsr_offsets_[id_it->first] = fsr_offsets_[id_prev] + ninst_prev;
-    id_it_prev++;
+  // The offsets are held in a dense array over the range of the IDs, where
+  // the IDs which are not in the geometry have no offset.
+  fsr_id_min_ = *fsr_ids.begin();
+  fsr_offsets_.assign(*fsr_ids.rbegin() - fsr_id_min_ + 1, NO_FSR_OFFSET);
+  for (const auto id : fsr_ids) {
+    fsr_offsets_[id - fsr_id_min_] = fsrs_.size();
+
+    // Save the pointers of all instances
+    const std::size_t ninst = geometry_->get_num_fsr_instances(id);
+    for (std::size_t i = 0; i < ninst; i++) fsrs_.push_back(fsr_ptrs[id]);
+  }
+
+  this->renumber_fsrs();
+  this->index_cross_sections();
+}
+
+void MOCDriver::renumber_fsrs() {
+  fsr_renumber_.clear();
+  if (fsr_order_ == FSROrder::Geometry) return;
+
+  // All FSRs of a cell are given consecutive indices, and the cells are
+  // taken along a Hilbert curve through their centers
+  std::vector<Vector> centers;
+  append_cell_centers(*geometry_, Vector(0., 0.), centers);
 
-    // Save ninst_prev points
-    for (std::size_t i = 0; i < ninst_prev; i++) {
-      fsrs_.push_back(fsr_ptrs[id_prev]);
+  const double Dx = geometry_->x_max() - geometry_->x_min();
+  const double Dy = geometry_->y_max() - geometry_->y_min();
+  auto grid_coord = [](double x, double x_min, double D) {
+    const double c = std::floor((x - x_min) / D * HILBERT_GRID);
+    return static_cast<std::uint32_t>(std::clamp(c, 0., HILBERT_GRID - 1.));
+  };
+  std::vector<std::pair<std::uint64_t, std::size_t>> keys(centers.size());
+  for (std::size_t c = 0; c < centers.size(); c++) {
+    const auto x = grid_coord(centers[c].x(), geometry_->x_min(), Dx);
+    const auto y = grid_coord(centers[c].y(), geometry_->y_min(), Dy);
+    keys[c] = {hilbert_index(x, y), c};
+  }
+  std::sort(keys.begin(), keys.end());
+
+  fsr_renumber_.assign(nfsrs_, nfsrs_);
+  std::size_t next = 0;
+  const Direction u(1., 0.);
+  for (const auto& key : keys) {
+    const Vector& r = centers[key.second];
+    for (const auto& fsr : geometry_->get_all_fsr_in_cell(r, u)) {
+      const std::size_t i =
+          fsr_offsets_[fsr.fsr->id() - fsr_id_min_] + fsr.instance;
+      if (fsr_renumber_[i] == nfsrs_) fsr_renumber_[i] = next++;
     }
   }
-  // Save pointers for last FSR
-  const std::size_t id_prev = id_it_prev->first;
-  const std::size_t ninst_prev = geometry_->get_num_fsr_instances(id_prev);
-  for (std::size_t i = 0; i < ninst_prev; i++) {
-    fsrs_.push_back(fsr_ptrs[id_prev]);
+
+  if (next != nfsrs_) {
+    fsr_renumber_.clear();
+    const auto mssg = "Could not find the cells of all FSRs to renumber them.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::vector<const FlatSourceRegion*> fsrs(nfsrs_);
+  for (std::size_t i = 0; i < nfsrs_; i++) fsrs[fsr_renumber_[i]] = fsrs_[i];
+  fsrs_ = std::move(fsrs);
+}
+
+void MOCDriver::set_fsr_order(FSROrder order) {
+  if (order == fsr_order_) return;
+
+  if (this->drawn()) {
+    angle_info_.clear();
+    tracks_.clear();
+    seg_store_.clear();
+    spdlog::warn(
+        "FSR order was set after track tracing. Must call generate_tracks "
+        "again !");
+  }
+
+  // Current index of each FSR, in geometry order
+  std::vector<std::size_t> prev_indx = fsr_renumber_;
+  if (prev_indx.empty()) {
+    prev_indx.resize(nfsrs_);
+    std::iota(prev_indx.begin(), prev_indx.end(), std::size_t{0});
+  }
+
+  fsr_order_ = order;
+  this->allocate_fsr_data();
+  if (tallies_.empty() == false) {
+    spdlog::warn("The tallies were removed, as the FSRs were numbered again.");
+    tallies_.clear();
+  }
+
+  // The flux and the external source follow their FSR
+  auto permute = [&](auto& arr) {
+    auto prev = arr;
+    for (std::size_t k = 0; k < nfsrs_; k++) {
+      const std::size_t i = fsr_renumber_.empty() ? k : fsr_renumber_[k];
+      xt::view(arr, xt::all(), i) = xt::view(prev, xt::all(), prev_indx[k]);
+    }
+  };
+  permute(flux_);
+  permute(extern_src_);
+  solved_ = false;
+}
+
+bool MOCDriver::index_cross_sections() {
+  // Index the unique cross sections, so that the packed segments can refer
+  // to their material without going through a shared_ptr. Distinct objects
+  // with the same values are found through their content hash.
+  const std::vector<std::uint32_t> prev_indx = std::move(fsr_xs_indx_);
+  xs_list_.clear();
+  fsr_xs_indx_.clear();
+  fsr_xs_indx_.reserve(nfsrs_);
+  std::map<const CrossSection*, std::uint32_t> xs_indices;
+  std::unordered_multimap<std::size_t, std::uint32_t> xs_hashes;
+  for (const auto* fsr : fsrs_) {
+    auto xs_it = xs_indices.find(fsr->xs().get());
+    if (xs_it == xs_indices.end()) {
+      auto indx = static_cast<std::uint32_t>(xs_list_.size());
+      bool found = false;
+
+      if (dedup_xs_) {
+        const std::size_t h = fsr->xs()->content_hash(xs_dedup_tol_);
+        const auto range = xs_hashes.equal_range(h);
+        for (auto it = range.first; it != range.second; it++) {
+          if (xs_list_[it->second]->approx_equal(*fsr->xs(), xs_dedup_tol_)) {
+            indx = it->second;
+            found = true;
+            break;
+          }
+        }
+        if (found == false) xs_hashes.emplace(h, indx);
+      }
+
+      if (found == false) xs_list_.push_back(fsr->xs());
+      xs_it = xs_indices.emplace(fsr->xs().get(), indx).first;
+    }
+    fsr_xs_indx_.push_back(xs_it->second);
   }
+
+  return fsr_xs_indx_ != prev_indx;
 }
 
 void MOCDriver::segment_renormalization() {
@@ -1477,51 +4385,390 @@ void MOCDriver::segment_renormalization() {
   // could be done for all angles together. A great explanation of this is
   // found in the MPACT theory manual ORNL/SPR-2021/2330 end of 5.4.
 
-  // This holds the approximations for the FSR areas
-  std::vector<double> approx_vols(nfsrs_, 0.);
+  // The angles are independent, so they are renormalized in parallel. The
+  // approximate volumes of each angle are summed by a single thread in the
+  // order of the tracks, which makes the lengths independent of the number
+  // of threads. The errors and warnings are reduced in the order of the
+  // angles afterwards.
+  const std::size_t nangles = angle_info_.size();
+  std::vector<double> angle_errors(nangles, 0.);
+  std::vector<std::vector<std::pair<std::size_t, double>>> angle_warnings(
+      nangles);
 
-  // Go through all angles
-  for (std::size_t a = 0; a < angle_info_.size(); a++) {
-    const double d = angle_info_[a].d;  // Track width
-    auto& tracks = tracks_[a];          // Vector of tracks
+#pragma omp parallel
+  {
+    // This holds the approximations for the FSR areas
+    std::vector<double> approx_vols(nfsrs_, 0.);
+
+#pragma omp for schedule(dynamic)
+    for (int ia = 0; ia < static_cast<int>(nangles); ia++) {
+      const std::size_t a = static_cast<std::size_t>(ia);
+      const double d = angle_info_[a].d;  // Track width
+      auto& tracks = tracks_[a];          // Vector of tracks
 
-    // Zero approximate volumes
-    for (auto& av : approx_vols) av = 0.;
+      // Zero approximate volumes
+      for (auto& av : approx_vols) av = 0.;
 
-    // Iterate through tracks and segments, adding contributions to volumes
-    for (auto& track : tracks) {
-      for (auto& seg : track) {
-        const std::size_t i = seg.fsr_indx();
-        approx_vols[i] += seg.length() * d;
+      // Iterate through tracks and segments, adding contributions to volumes
+      for (auto& track : tracks) {
+        for (auto& seg : track) {
+          const std::size_t i = seg.fsr_indx();
+          approx_vols[i] += seg.length() * d;
+        }
       }
-    }
 
-    if (check_fsr_areas_) {
-      // Here, we do a sanity check, to make sure the approximate FSR volumes
-      // are relatively close to the true volumes. If they are not, this is
-      // could mean that the track spacing is too wide to adequately capture the
-      // FSR, or it could mean that the "true" volume of the FSR is incorrect.
-      // Both are problems.
+      double abs_err = 0.;
+      double tot_vol = 0.;
       for (std::size_t i = 0; i < approx_vols.size(); i++) {
-        const double rel_diff = std::abs((approx_vols[i] - fsrs_[i]->volume()) /
-                                         fsrs_[i]->volume());
-        if (std::abs(rel_diff) > fsr_area_tol_) {
-          spdlog::warn(
-              "For FSR {:} azimuthal angle {:}, the true and approximate FSR "
-              "areas differ by {:.3f}%.",
-              i, a, rel_diff * 100.);
+        abs_err += std::abs(approx_vols[i] - fsrs_[i]->volume());
+        tot_vol += fsrs_[i]->volume();
+      }
+      if (tot_vol > 0.) angle_errors[a] = abs_err / tot_vol;
+
+      if (check_fsr_areas_) {
+        // Here, we do a sanity check, to make sure the approximate FSR
+        // volumes are relatively close to the true volumes. If they are not,
+        // this is could mean that the track spacing is too wide to
+        // adequately capture the FSR, or it could mean that the "true"
+        // volume of the FSR is incorrect. Both are problems.
+        for (std::size_t i = 0; i < approx_vols.size(); i++) {
+          const double rel_diff = std::abs(
+              (approx_vols[i] - fsrs_[i]->volume()) / fsrs_[i]->volume());
+          if (std::abs(rel_diff) > fsr_area_tol_) {
+            angle_warnings[a].emplace_back(i, rel_diff);
+          }
+        }
+      }
+
+      // Now we apply the corrections to the segment lengths
+      for (auto& track : tracks) {
+        for (auto& seg : track) {
+          const std::size_t i = seg.fsr_indx();
+          seg.set_length(seg.length() * seg.volume() / approx_vols[i]);
+        }
+      }
+    }
+  }
+
+  fsr_area_error_ = 0.;
+  for (std::size_t a = 0; a < nangles; a++) {
+    fsr_area_error_ = std::max(fsr_area_error_, angle_errors[a]);
+    for (const auto& [i, rel_diff] : angle_warnings[a]) {
+      spdlog::warn(
+          "For FSR {:} azimuthal angle {:}, the true and approximate FSR "
+          "areas differ by {:.3f}%.",
+          i, a, rel_diff * 100.);
+    }
+  }
+}
+
+void MOCDriver::otf_renormalization(const xt::xtensor<double, 2>& approx_vols) {
+  spdlog::info("Computing segment length corrections");
+
+  // Same corrections as segment_renormalization, which are applied to the
+  // segments each time a track is traced again
+  const std::size_t nangles = angle_info_.size();
+  otf_renorm_ = xt::ones<double>({nangles, nfsrs_});
+  fsr_area_error_ = 0.;
+  for (std::size_t a = 0; a < nangles; a++) {
+    double abs_err = 0.;
+    double tot_vol = 0.;
+    for (std::size_t i = 0; i < nfsrs_; i++) {
+      const double vol = fsrs_[i]->volume();
+      abs_err += std::abs(approx_vols(a, i) - vol);
+      tot_vol += vol;
+
+      const double rel_diff = std::abs((approx_vols(a, i) - vol) / vol);
+      if (check_fsr_areas_ && rel_diff > fsr_area_tol_) {
+        spdlog::warn(
+            "For FSR {:} azimuthal angle {:}, the true and approximate FSR "
+            "areas differ by {:.3f}%.",
+            i, a, rel_diff * 100.);
+      }
+
+      if (approx_vols(a, i) > 0.) otf_renorm_(a, i) = vol / approx_vols(a, i);
+    }
+    if (tot_vol > 0.) {
+      fsr_area_error_ = std::max(fsr_area_error_, abs_err / tot_vol);
+    }
+  }
+
+  otf_laydown_ = true;
+}
+
+std::vector<MOCDriver::TracedTile> MOCDriver::traced_tile_fsrs() const {
+  // The FSR ids of each distinct fill, with their number of instances in
+  // the fill, are only found once
+  std::map<const void*, std::vector<std::pair<std::size_t, std::size_t>>>
+      fill_ids;
+
+  std::vector<TracedTile> out;
+  out.reserve(geometry_->nx() * geometry_->ny());
+  for (std::size_t i = 0; i < geometry_->nx(); i++) {
+    for (std::size_t j = 0; j < geometry_->ny(); j++) {
+      const Cartesian2D::TileIndex ti{i, j};
+      const auto& tile = geometry_->tile(ti);
+      auto& traced = out.emplace_back();
+      traced.fill = tile_fill(tile);
+
+      auto it = fill_ids.find(traced.fill.get());
+      if (it == fill_ids.end()) {
+        std::set<std::size_t> ids;
+        if (tile.c2d) {
+          ids = tile.c2d->get_all_fsr_ids();
+        } else if (tile.cell) {
+          ids = tile.cell->get_all_fsr_ids();
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t>> id_instances;
+        for (const auto id : ids) {
+          id_instances.emplace_back(id, tile.get_num_fsr_instances(id));
+        }
+        it = fill_ids.emplace(traced.fill.get(), std::move(id_instances)).first;
+      }
+
+      for (const auto& [id, ninst] : it->second) {
+        const std::size_t offset = geometry_->fsr_offset(ti, id);
+        for (std::size_t k = 0; k < ninst; k++) {
+          traced.fsrs.push_back(this->get_fsr_indx(id, offset + k));
         }
       }
     }
+  }
+
+  return out;
+}
+
+std::size_t MOCDriver::retrace_changed_tiles() {
+  SCARABEE_PROFILE_ZONE("MOCDriver::retrace_changed_tiles");
+  ThreadScope thread_scope(threads_);
+
+  if (this->drawn() == false) {
+    const auto mssg =
+        "Cannot trace tracks again. Geometry has not been traced.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (direct_segments() == false) {
+    const auto mssg =
+        "Changed tiles can not be traced again with on-the-fly tracing or "
+        "compressed segments. Must call generate_tracks again.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t ny = geometry_->ny();
+  const std::size_t ntiles = geometry_->nx() * ny;
+  if (traced_tiles_.size() != ntiles) {
+    const auto mssg =
+        "The tiles of the traced geometry are unknown. Must call "
+        "generate_tracks again.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  Timer draw_timer;
+  draw_timer.start();
+
+  // Bounds of the tiles whose fill changed. They are slightly enlarged, so
+  // that the tracks running along their sides are traced again too.
+  constexpr double BOX_TOL = 1.E-8;
+  std::vector<char> changed(ntiles, 0);
+  std::vector<std::array<double, 4>> boxes;
+  for (std::size_t i = 0; i < geometry_->nx(); i++) {
+    for (std::size_t j = 0; j < ny; j++) {
+      const Cartesian2D::TileIndex ti{i, j};
+      const auto fill = tile_fill(geometry_->tile(ti));
+      if (fill == traced_tiles_[i * ny + j].fill) continue;
+
+      changed[i * ny + j] = 1;
+      const Vector c = geometry_->get_tile_center(ti);
+      const auto [dx, dy] = geometry_->tile_dx_dy(ti);
+      boxes.push_back({c.x() - 0.5 * dx - BOX_TOL, c.x() + 0.5 * dx + BOX_TOL,
+                       c.y() - 0.5 * dy - BOX_TOL, c.y() + 0.5 * dy + BOX_TOL});
+    }
+  }
+  if (boxes.empty()) return 0;
+  spdlog::info("Tracing tracks again for {} changed tiles", boxes.size());
+
+  // The FSR data of the new geometry is allocated, and the FSRs of the
+  // unchanged tiles are matched by their place in the tile. The old FSRs
+  // stay alive with the replaced fills until the end.
+  const std::size_t old_nfsrs = nfsrs_;
+  const std::vector<TracedTile> old_tiles = std::move(traced_tiles_);
+  const std::vector<const FlatSourceRegion*> old_fsrs = fsrs_;
+  this->allocate_fsr_data();
+  traced_tiles_ = traced_tile_fsrs();
+  if (tallies_.empty() == false) {
+    spdlog::warn("The tallies were removed, as the FSRs were numbered again.");
+    tallies_.clear();
+  }
+
+  std::vector<std::size_t> fsr_map(old_nfsrs, nfsrs_);
+  std::vector<char> mapped(nfsrs_, 0);
+  for (std::size_t t = 0; t < ntiles; t++) {
+    if (changed[t]) continue;
+    const auto& old_tile_fsrs = old_tiles[t].fsrs;
+    const auto& tile_fsrs = traced_tiles_[t].fsrs;
+    for (std::size_t n = 0; n < tile_fsrs.size(); n++) {
+      fsr_map[old_tile_fsrs[n]] = tile_fsrs[n];
+      mapped[tile_fsrs[n]] = 1;
+    }
+  }
+
+  // The tracks crossing a changed tile are traced again, as are those with
+  // an FSR which was not matched. All others are given the new FSR indices.
+  std::size_t ntracks = 0;
+  std::vector<std::pair<std::size_t, std::size_t>> work;
+  for (std::size_t a = 0; a < tracks_.size(); a++) {
+    for (std::size_t t = 0; t < tracks_[a].size(); t++) {
+      auto& track = tracks_[a][t];
+      ntracks++;
+
+      bool retrace = std::any_of(boxes.begin(), boxes.end(), [&](auto& box) {
+        return chord_crosses_box(track.entry_pos(), track.exit_pos(), box);
+      });
+      if (retrace == false) {
+        retrace = std::any_of(track.begin(), track.end(), [&](auto& seg) {
+          return fsr_map[seg.fsr_indx()] >= nfsrs_;
+        });
+      }
+
+      if (retrace) {
+        work.emplace_back(a, t);
+      } else {
+        for (auto& seg : track) seg.set_fsr_indx(fsr_map[seg.fsr_indx()]);
+      }
+    }
+  }
+
+  // The unchanged FSRs keep their flux and external source. The new FSRs
+  // start from the volume averaged flux of the replaced FSRs.
+  const std::size_t NL = flux_.shape()[2];
+  xt::xtensor<double, 2> avg_flux = xt::zeros<double>({ngroups_, NL});
+  double avg_vol = 0.;
+  for (std::size_t i = 0; i < old_nfsrs; i++) {
+    if (fsr_map[i] < nfsrs_) continue;
+    const double V = old_fsrs[i]->volume();
+    avg_vol += V;
+    avg_flux += V * xt::view(flux_, xt::all(), i, xt::all());
+  }
+  if (avg_vol > 0.) avg_flux /= avg_vol;
+
+  const xt::xtensor<double, 3> old_flux = std::move(flux_);
+  const xt::xtensor<double, 2> old_extern_src = std::move(extern_src_);
+  flux_ = xt::zeros<double>({ngroups_, nfsrs_, NL});
+  extern_src_ = xt::zeros<double>({ngroups_, nfsrs_});
+  for (std::size_t i = 0; i < old_nfsrs; i++) {
+    const std::size_t k = fsr_map[i];
+    if (k >= nfsrs_) continue;
+    xt::view(flux_, xt::all(), k, xt::all()) =
+        xt::view(old_flux, xt::all(), i, xt::all());
+    xt::view(extern_src_, xt::all(), k) =
+        xt::view(old_extern_src, xt::all(), i);
+  }
+  for (std::size_t k = 0; k < nfsrs_; k++) {
+    if (mapped[k] == 0) xt::view(flux_, xt::all(), k, xt::all()) = avg_flux;
+  }
+
+  // FSRs found in each CMFD cell by each thread, with duplicates
+  const std::size_t ncmfd_tiles = cmfd_ ? cmfd_->nx() * cmfd_->ny() : 0;
+  std::vector<std::vector<std::vector<std::size_t>>> thread_cmfd_tile_fsrs(
+      max_threads());
+
+#pragma omp parallel
+  {
+    auto& cmfd_tile_fsrs = thread_cmfd_tile_fsrs[thread_index()];
+    cmfd_tile_fsrs.resize(ncmfd_tiles);
+    std::vector<TileTemplates> templates(modular_rt_ ? tracks_.size() : 0);
+    std::vector<Segment> segments;
+
+    // The end points of the tracks do not change with the tiles
+#pragma omp for schedule(dynamic)
+    for (int iw = 0; iw < static_cast<int>(work.size()); iw++) {
+      const auto [a, t] = work[static_cast<std::size_t>(iw)];
+      auto& track = tracks_[a][t];
+      segments.clear();
+      trace_segments(track.entry_pos(), track.dir(), segments, cmfd_tile_fsrs,
+                     modular_rt_ ? &templates[a] : nullptr);
+      track.set_segments(segments);
+    }
+  }  // Parallel section
 
-    // Now we apply the corrections to the segment lengths
-    for (auto& track : tracks) {
-      for (auto& seg : track) {
-        const std::size_t i = seg.fsr_indx();
-        seg.set_length(seg.length() * seg.volume() / approx_vols[i]);
+  if (cmfd_) {
+    // The CMFD cells keep the FSRs of the unchanged tiles, and are given the
+    // FSRs crossed by the tracks which were traced again
+    cmfd_->remap_fsr_lists(fsr_map, nfsrs_);
+#pragma omp parallel for schedule(dynamic)
+    for (int iti = 0; iti < static_cast<int>(ncmfd_tiles); iti++) {
+      const std::size_t ti = static_cast<std::size_t>(iti);
+      for (const auto& cmfd_tile_fsrs : thread_cmfd_tile_fsrs) {
+        if (cmfd_tile_fsrs.empty()) continue;
+        cmfd_->insert_fsrs(ti, cmfd_tile_fsrs[ti]);
       }
     }
+    cmfd_->pack_fsr_lists();
+  }
+
+  // The kept segments were already renormalized, so the lengths in the FSRs
+  // which only they cross are left unchanged
+  segment_renormalization();
+  seg_store_.pack(tracks_, fsr_xs_indx_, cmfd_.get());
+  partition_tracks();
+
+  // The tracks no longer match a shared laydown, and the symmetry maps and
+  // the solutions of the previous geometry no longer apply
+  shared_tracks_.reset();
+  track_swept_.clear();
+  fsr_mirror_.clear();
+  sym_row_copies_.clear();
+  this->clear_solution_history();
+
+  draw_timer.stop();
+  spdlog::info("Traced {} of {} tracks again", work.size(), ntracks);
+  spdlog::info("Time spent tracing tracks again: {:.5} s.",
+               draw_timer.elapsed_time());
+
+  return work.size();
+}
+
+const SegmentStore& MOCDriver::track_segments(const Track& track,
+                                              std::size_t& tt) const {
+  if (direct_segments()) return seg_store_;
+
+  // The last track of the thread is kept, as it is usually swept in both
+  // directions, and often for several groups, one after the other
+  auto& buf = otf_buffers_[thread_index()];
+  const std::size_t track_tt = tt;
+  tt = 0;
+  if (buf.track == track_tt) return buf.store;
+
+  if (otf_laydown_ == false) {
+    seg_store_.decode_track(track_tt, fsr_xs_indx_, buf.store);
+    buf.track = track_tt;
+    return buf.store;
+  }
+
+  const std::size_t a = seg_store_.angle_index(track_tt);
+  if (modular_rt_ && buf.templates.size() != tracks_.size()) {
+    buf.templates.resize(tracks_.size());
+  }
+  if (cmfd_) buf.cmfd_tile_fsrs.resize(cmfd_->nx() * cmfd_->ny());
+
+  buf.segments.clear();
+  trace_segments(track.entry_pos(), track.dir(), buf.segments,
+                 buf.cmfd_tile_fsrs, modular_rt_ ? &buf.templates[a] : nullptr);
+
+  // The FSRs of the CMFD cells are only needed when tracing the laydown
+  for (auto& seg : buf.segments) {
+    if (cmfd_) buf.cmfd_tile_fsrs[seg.entry_cmfd_surface().cell_index].clear();
+    seg.set_length(seg.length() * otf_renorm_(a, seg.fsr_indx()));
   }
+
+  buf.store.pack_track(buf.segments, fsr_xs_indx_, cmfd_.get());
+  buf.track = track_tt;
+  return buf.store;
 }
 
 double MOCDriver::flux(const Vector& r, const Direction& u, std::size_t g,
@@ -1655,13 +4902,113 @@ std::size_t MOCDriver::get_fsr_indx(const UniqueFSR& fsr) const {
 
 std::size_t MOCDriver::get_fsr_indx(std::size_t fsr_id,
                                     std::size_t instance) const {
-  const std::size_t i = fsr_offsets_.at(fsr_id) + instance;
+  if (fsr_id < fsr_id_min_ || fsr_id - fsr_id_min_ >= fsr_offsets_.size() ||
+      fsr_offsets_[fsr_id - fsr_id_min_] == NO_FSR_OFFSET) {
+    const auto mssg = "Unknown FSR id " + std::to_string(fsr_id) + ".";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t i = fsr_offsets_[fsr_id - fsr_id_min_] + instance;
   if (i >= nfsrs_) {
     const auto mssg = "FSR index out of range.";
     spdlog::error(mssg);
     throw ScarabeeException(mssg);
   }
-  return i;
+  return fsr_renumber_.empty() ? i : fsr_renumber_[i];
+}
+
+std::vector<std::vector<std::size_t>> MOCDriver::get_fsr_indxs(
+    const std::vector<std::vector<std::size_t>>& fsr_id_sets,
+    std::size_t instance) const {
+  std::vector<std::vector<std::size_t>> indxs(fsr_id_sets.size());
+  for (std::size_t s = 0; s < fsr_id_sets.size(); s++) {
+    indxs[s].reserve(fsr_id_sets[s].size());
+    for (const auto id : fsr_id_sets[s]) {
+      indxs[s].push_back(this->get_fsr_indx(id, instance));
+    }
+  }
+  return indxs;
+}
+
+xt::xtensor<std::size_t, 1> MOCDriver::get_fsr_indices(
+    const xt::xtensor<double, 2>& r, const Direction& u) const {
+  if (r.shape()[1] != 2) {
+    const auto mssg = "Positions must be given as an (N, 2) array.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Exceptions may not leave the parallel region, so the first point which
+  // is not in an FSR is reported afterwards.
+  const std::size_t N = r.shape()[0];
+  xt::xtensor<std::size_t, 1> indices = xt::zeros<std::size_t>({N});
+  std::size_t lost = N;
+#pragma omp parallel for
+  for (int in = 0; in < static_cast<int>(N); in++) {
+    const std::size_t n = static_cast<std::size_t>(in);
+    bool found = false;
+    try {
+      const auto fsr = geometry_->get_fsr(Vector(r(n, 0), r(n, 1)), u);
+      if (fsr.fsr) {
+        indices(n) = this->get_fsr_indx(fsr);
+        found = true;
+      }
+    } catch (const std::exception&) {
+    }
+
+    if (found == false) {
+#pragma omp critical
+      lost = std::min(lost, n);
+    }
+  }
+
+  if (lost < N) {
+    std::stringstream mssg;
+    mssg << "Could not find flat source region at r = "
+         << Vector(r(lost, 0), r(lost, 1)) << " u = " << u << ".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  return indices;
+}
+
+xt::xtensor<double, 2> MOCDriver::fluxes(const xt::xtensor<double, 2>& r,
+                                         const Direction& u,
+                                         std::size_t lj) const {
+  return this->fsr_fluxes(this->get_fsr_indices(r, u), lj);
+}
+
+xt::xtensor<double, 2> MOCDriver::fsr_fluxes(
+    const xt::xtensor<std::size_t, 1>& fsrs, std::size_t lj) const {
+  if (lj >= N_lj_) {
+    std::stringstream mssg;
+    mssg << "Spherical harmonic index lj = " << lj << " is out of range.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  for (const auto i : fsrs) {
+    if (i >= this->size()) {
+      std::stringstream mssg;
+      mssg << "FSR index i=" << i << " is out of range.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+  }
+
+  const std::size_t N = fsrs.size();
+  xt::xtensor<double, 2> out = xt::zeros<double>({N, ngroups_});
+#pragma omp parallel for
+  for (int in = 0; in < static_cast<int>(N); in++) {
+    const std::size_t n = static_cast<std::size_t>(in);
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      out(n, g) = flux_(g, fsrs(n), lj);
+    }
+  }
+
+  return out;
 }
 
 std::vector<std::size_t> MOCDriver::get_all_fsr_in_cell(
@@ -1717,12 +5064,62 @@ double MOCDriver::extern_src(const Vector& r, const Direction& u,
     throw ScarabeeException(mssg);
   }
 
-  return extern_src_(g, i);
+  return extern_src_(g, i);
+}
+
+void MOCDriver::set_extern_src(std::size_t i, std::size_t g, double src) {
+  if (i >= nfsrs_) {
+    const auto mssg = "Source region index out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (g >= this->ngroups()) {
+    const auto mssg = "Group index out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (src < 0.) {
+    const auto mssg = "Cannot assign negative external source.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  extern_src_(g, i) = src;
+}
+
+void MOCDriver::set_extern_src(const xt::xtensor<std::size_t, 1>& fsrs,
+                               std::size_t g, double src) {
+  if (g >= this->ngroups()) {
+    const auto mssg = "Group index out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (src < 0.) {
+    const auto mssg = "Cannot assign negative external source.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  for (const auto i : fsrs) {
+    if (i >= nfsrs_) {
+      const auto mssg = "Source region index out of range.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  for (const auto i : fsrs) extern_src_(g, i) = src;
 }
 
-void MOCDriver::set_extern_src(std::size_t i, std::size_t g, double src) {
-  if (i >= nfsrs_) {
-    const auto mssg = "Source region index out of range.";
+void MOCDriver::set_extern_src(const xt::xtensor<std::size_t, 1>& fsrs,
+                               std::size_t g,
+                               const xt::xtensor<double, 1>& src) {
+  if (src.size() != fsrs.size()) {
+    const auto mssg =
+        "Number of sources does not match the number of source regions.";
     spdlog::error(mssg);
     throw ScarabeeException(mssg);
   }
@@ -1733,13 +5130,23 @@ void MOCDriver::set_extern_src(std::size_t i, std::size_t g, double src) {
     throw ScarabeeException(mssg);
   }
 
-  if (src < 0.) {
-    const auto mssg = "Cannot assign negative external source.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
+  for (std::size_t j = 0; j < fsrs.size(); j++) {
+    if (fsrs(j) >= nfsrs_) {
+      const auto mssg = "Source region index out of range.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (src(j) < 0.) {
+      const auto mssg = "Cannot assign negative external source.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
   }
 
-  extern_src_(g, i) = src;
+  for (std::size_t j = 0; j < fsrs.size(); j++) {
+    extern_src_(g, fsrs(j)) = src(j);
+  }
 }
 
 double MOCDriver::extern_src(std::size_t i, std::size_t g) const {
@@ -1770,77 +5177,125 @@ std::shared_ptr<CrossSection> MOCDriver::homogenize() const {
 
 std::shared_ptr<CrossSection> MOCDriver::homogenize(
     const std::vector<std::size_t>& regions) const {
-  // Make sure we were actually provided with regions
-  if (regions.empty()) {
-    const auto mssg = "No regions were provided for homogenization.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
+  return this->homogenize_sets({regions}).front();
+}
 
-  // Check all regions are valid
-  if (regions.size() > this->nregions()) {
-    const auto mssg =
-        "The number of provided regions is greater than the number of regions.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
+xt::xtensor<double, 1> MOCDriver::homogenize_flux_spectrum() const {
+  const std::size_t NR = this->nfsr();
+  std::vector<std::size_t> regions(NR, 0);
+  for (std::size_t i = 0; i < NR; i++) {
+    regions[i] = i;
   }
 
-  for (const auto m : regions) {
-    if (m >= this->nfsr()) {
-      const auto mssg = "Invalid region index in homogenization list.";
+  return this->homogenize_flux_spectrum(regions);
+}
+
+xt::xtensor<double, 1> MOCDriver::homogenize_flux_spectrum(
+    const std::vector<std::size_t>& regions) const {
+  const auto spectra = this->homogenize_flux_spectra({regions});
+  return xt::view(spectra, 0, xt::all());
+}
+
+std::vector<std::shared_ptr<CrossSection>> MOCDriver::homogenize_sets(
+    const std::vector<std::vector<std::size_t>>& region_sets) const {
+  for (const auto& regions : region_sets) {
+    if (regions.empty()) {
+      const auto mssg = "No regions were provided for homogenization.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (regions.size() > this->nregions()) {
+      const auto mssg =
+          "The number of provided regions is greater than the number of "
+          "regions.";
       spdlog::error(mssg);
       throw ScarabeeException(mssg);
     }
+
+    for (const auto m : regions) {
+      if (m >= this->nfsr()) {
+        const auto mssg = "Invalid region index in homogenization list.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+    }
   }
 
-  // We now begin homogenization
-  const std::size_t NR = regions.size();
+  const std::size_t NS = region_sets.size();
   const std::size_t NG = this->ngroups();
 
-  std::size_t max_l = 0;
-  for (const auto m : regions) {
-    const auto m_max_l = this->xs(m)->max_legendre_order();
-    if (m_max_l > max_l) {
-      max_l = m_max_l;
-    }
-  }
-
-  xt::xtensor<double, 1> Et = xt::zeros<double>({NG});
-  xt::xtensor<double, 1> Dtr = xt::zeros<double>({NG});
-  xt::xtensor<double, 1> Ea = xt::zeros<double>({NG});
-  xt::xtensor<double, 3> Es = xt::zeros<double>({max_l + 1, NG, NG});
-  xt::xtensor<double, 1> Ef = xt::zeros<double>({NG});
-  xt::xtensor<double, 1> vEf = xt::zeros<double>({NG});
-  xt::xtensor<double, 1> chi = xt::zeros<double>({NG});
-
-  // We need to calculate the total fission production in each volume for
-  // generating the homogenized fission spectrum.
-  std::vector<double> fiss_prod(NR, 0.);
-  std::size_t j = 0;
-  for (const auto i : regions) {
-    const auto& mat = this->xs(i);
-    const double V = this->volume(i);
-    for (std::size_t g = 0; g < NG; g++) {
-      fiss_prod[j] += mat->vEf(g) * this->flux(i, g) * V;
+  // Reaction rates of each set, accumulated in one pass over its regions
+  struct SetRates {
+    std::size_t max_l{0};
+    xt::xtensor<double, 1> fluxV, Dtr, Ea, Ef, vEf, chi;
+    xt::xtensor<double, 3> Es;
+    double fiss_prod{0.};
+    std::size_t zero_group{0};  // Group with no flux, or NG
+  };
+  std::vector<SetRates> rates(NS);
+
+#pragma omp parallel for schedule(dynamic)
+  for (int is = 0; is < static_cast<int>(NS); is++) {
+    const auto& regions = region_sets[static_cast<std::size_t>(is)];
+    auto& rr = rates[static_cast<std::size_t>(is)];
+
+    for (const auto i : regions) {
+      rr.max_l = std::max(rr.max_l, this->xs(i)->max_legendre_order());
     }
-    j++;
-  }
-  const double sum_fiss_prod =
-      std::accumulate(fiss_prod.begin(), fiss_prod.end(), 0.);
-  const double invs_sum_fiss_prod =
-      sum_fiss_prod > 0. ? 1. / sum_fiss_prod : 1.;
+    rr.fluxV = xt::zeros<double>({NG});
+    rr.Dtr = xt::zeros<double>({NG});
+    rr.Ea = xt::zeros<double>({NG});
+    rr.Ef = xt::zeros<double>({NG});
+    rr.vEf = xt::zeros<double>({NG});
+    rr.chi = xt::zeros<double>({NG});
+    rr.Es = xt::zeros<double>({rr.max_l + 1, NG, NG});
 
-  for (std::size_t g = 0; g < NG; g++) {
-    // Get the sum of flux*volume for this group
-    double sum_fluxV = 0.;
     for (const auto i : regions) {
-      sum_fluxV += this->flux(i, g) * this->volume(i);
+      const auto& mat = this->xs(i);
+      const double V = fsrs_[i]->volume();
+      const std::size_t mat_max_l = mat->max_legendre_order();
+
+      double fiss_prod = 0.;
+      for (std::size_t g = 0; g < NG; g++) {
+        const double flxV = flux_(g, i, 0) * V;
+        rr.fluxV(g) += flxV;
+        rr.Dtr(g) += flxV * mat->Dtr(g);
+        rr.Ea(g) += flxV * mat->Ea(g);
+        rr.Ef(g) += flxV * mat->Ef(g);
+        rr.vEf(g) += flxV * mat->vEf(g);
+        fiss_prod += flxV * mat->vEf(g);
+
+        for (std::size_t l = 0; l <= mat_max_l; l++) {
+          for (std::size_t gg = 0; gg < NG; gg++) {
+            rr.Es(l, g, gg) += flxV * mat->Es(l, g, gg);
+          }
+        }
+      }
+
+      rr.fiss_prod += fiss_prod;
+      for (std::size_t g = 0; g < NG; g++) rr.chi(g) += fiss_prod * mat->chi(g);
+    }
+
+    rr.zero_group = NG;
+    for (std::size_t g = 0; g < NG; g++) {
+      if (rr.fluxV(g) == 0.) {
+        rr.zero_group = g;
+        break;
+      }
     }
+  }
 
-    if (sum_fluxV == 0.) {
+  // The cross sections are built, and errors reported, outside of the
+  // parallel region.
+  std::vector<std::shared_ptr<CrossSection>> out;
+  out.reserve(NS);
+  for (auto& rr : rates) {
+    if (rr.zero_group < NG) {
       std::stringstream mssg;
       mssg << "Cannot homogenize cross sections. ";
-      mssg << "Sum of FSR flux*volume in group " << g << " is zero. ";
+      mssg << "Sum of FSR flux*volume in group " << rr.zero_group
+           << " is zero. ";
       mssg << "If you see this error while using CMFD, try skipping several "
               "MOC iterations before applying CMFD.";
       const auto err_str = mssg.str();
@@ -1848,90 +5303,143 @@ std::shared_ptr<CrossSection> MOCDriver::homogenize(
       throw ScarabeeException(err_str);
     }
 
-    const double invs_sum_fluxV = 1. / sum_fluxV;
+    const double invs_fiss_prod = rr.fiss_prod > 0. ? 1. / rr.fiss_prod : 1.;
+    xt::xtensor<double, 1> Et = xt::zeros<double>({NG});
+    for (std::size_t g = 0; g < NG; g++) {
+      const double invs_fluxV = 1. / rr.fluxV(g);
+      rr.Dtr(g) *= invs_fluxV;
+      rr.Ea(g) *= invs_fluxV;
+      rr.Ef(g) *= invs_fluxV;
+      rr.vEf(g) *= invs_fluxV;
+      rr.chi(g) *= invs_fiss_prod;
+      xt::view(rr.Es, xt::all(), g, xt::all()) *= invs_fluxV;
+
+      // Reconstruct total xs from absorption and scattering
+      Et(g) = rr.Ea(g) + xt::sum(xt::view(rr.Es, 0, g, xt::all()))();
+    }
 
-    j = 0;
-    for (const auto i : regions) {
-      const auto& mat = this->xs(i);
-      const double V = volume(i);
-      const double flx = flux(i, g);
-      const double coeff = invs_sum_fluxV * flx * V;
-      Dtr(g) += coeff * mat->Dtr(g);
-      Ea(g) += coeff * mat->Ea(g);
-      Ef(g) += coeff * mat->Ef(g);
-      vEf(g) += coeff * mat->vEf(g);
-
-      chi(g) += invs_sum_fiss_prod * fiss_prod[j] * mat->chi(g);
-
-      for (std::size_t l = 0; l <= max_l; l++) {
-        for (std::size_t gg = 0; gg < NG; gg++) {
-          Es(l, g, gg) += coeff * mat->Es(l, g, gg);
-        }
-      }
+    out.push_back(std::make_shared<CrossSection>(Et, rr.Dtr, rr.Ea, rr.Es,
+                                                 rr.Ef, rr.vEf, rr.chi));
+  }
+
+  return out;
+}
+
+xt::xtensor<double, 2> MOCDriver::homogenize_flux_spectra(
+    const std::vector<std::vector<std::size_t>>& region_sets) const {
+  for (const auto& regions : region_sets) {
+    if (regions.empty()) {
+      const auto mssg =
+          "No regions were provided for homogenization of flux spectrum.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+
+    if (regions.size() > this->nfsr()) {
+      const auto mssg =
+          "The number of provided regions is greater than the number of "
+          "regions.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
 
-      j++;
+    for (const auto m : regions) {
+      if (m >= this->nfsr()) {
+        const auto mssg = "Invalid region index in homogenization list.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
     }
+  }
 
-    // Reconstruct total xs from absorption and scattering
-    Et(g) = Ea(g) + xt::sum(xt::view(Es, 0, g, xt::all()))();
+  const std::size_t NS = region_sets.size();
+  const std::size_t NG = this->ngroups();
+  xt::xtensor<double, 2> spectra = xt::zeros<double>({NS, NG});
+
+#pragma omp parallel for schedule(dynamic)
+  for (int is = 0; is < static_cast<int>(NS); is++) {
+    const std::size_t s = static_cast<std::size_t>(is);
+    double sum_V = 0.;
+    for (const auto i : region_sets[s]) {
+      const double V = fsrs_[i]->volume();
+      sum_V += V;
+      for (std::size_t g = 0; g < NG; g++) spectra(s, g) += V * flux_(g, i, 0);
+    }
+    xt::view(spectra, s, xt::all()) /= sum_V;
   }
 
-  return std::make_shared<CrossSection>(Et, Dtr, Ea, Es, Ef, vEf, chi);
+  return spectra;
 }
 
-xt::xtensor<double, 1> MOCDriver::homogenize_flux_spectrum() const {
-  const std::size_t NR = this->nfsr();
-  std::vector<std::size_t> regions(NR, 0);
-  for (std::size_t i = 0; i < NR; i++) {
-    regions[i] = i;
+std::size_t MOCDriver::add_tally(
+    const std::vector<std::vector<std::size_t>>& region_sets,
+    TallyScore score) {
+  for (const auto& regions : region_sets) {
+    for (const auto i : regions) {
+      if (i >= nfsrs_) {
+        const auto mssg = "Invalid region index in tally.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+    }
   }
 
-  return this->homogenize_flux_spectrum(regions);
+  tallies_.push_back({region_sets, score, xt::xtensor<double, 2>()});
+  return tallies_.size() - 1;
 }
 
-xt::xtensor<double, 1> MOCDriver::homogenize_flux_spectrum(
-    const std::vector<std::size_t>& regions) const {
-  // Make sure we were actually provided with regions
-  if (regions.empty()) {
-    const auto mssg =
-        "No regions were provided for homogenization of flux spectrum.";
+const xt::xtensor<double, 2>& MOCDriver::tally(std::size_t t) const {
+  if (t >= tallies_.size()) {
+    const auto mssg = "Tally index out of range.";
     spdlog::error(mssg);
     throw ScarabeeException(mssg);
   }
 
-  // Check all regions are valid
-  if (regions.size() > this->nfsr()) {
-    const auto mssg =
-        "The number of provided regions is greater than the number of regions.";
-    spdlog::error(mssg);
-    throw ScarabeeException(mssg);
-  }
+  return tallies_[t].result;
+}
 
-  for (const auto m : regions) {
-    if (m >= this->nregions()) {
-      const auto mssg = "Invalid region index in homogenization list.";
-      spdlog::error(mssg);
-      throw ScarabeeException(mssg);
+void MOCDriver::compute_tallies() {
+  if (tallies_.empty()) return;
+  SCARABEE_PROFILE_ZONE("MOCDriver::compute_tallies");
+
+  // Cross section of each score, by material then group
+  const std::size_t nmats = xs_list_.size();
+  std::array<xt::xtensor<double, 2>, 4> score_xs;
+  for (auto& xs : score_xs) xs = xt::ones<double>({nmats, ngroups_});
+  for (std::size_t m = 0; m < nmats; m++) {
+    for (std::size_t g = 0; g < ngroups_; g++) {
+      score_xs[static_cast<std::size_t>(TallyScore::Absorption)](m, g) =
+          xs_list_[m]->Ea(g);
+      score_xs[static_cast<std::size_t>(TallyScore::Fission)](m, g) =
+          xs_list_[m]->Ef(g);
+      score_xs[static_cast<std::size_t>(TallyScore::NuFission)](m, g) =
+          mat_vEf_(m, g);
     }
   }
 
-  const std::size_t NG = this->ngroups();
-
-  // First, calculate the sum of the volumes
-  double sum_V = 0.;
-  for (const auto i : regions) {
-    sum_V += this->volume(i);
+  // The sets of all tallies are computed in a single parallel pass
+  std::vector<std::pair<std::size_t, std::size_t>> work;
+  for (std::size_t t = 0; t < tallies_.size(); t++) {
+    auto& tally = tallies_[t];
+    tally.result = xt::zeros<double>({tally.region_sets.size(), ngroups_});
+    for (std::size_t s = 0; s < tally.region_sets.size(); s++) {
+      work.emplace_back(t, s);
+    }
   }
-  const double invs_sum_V = 1. / sum_V;
 
-  xt::xtensor<double, 1> spectrum = xt::zeros<double>({NG});
-  for (std::size_t g = 0; g < NG; g++) {
-    for (const auto i : regions) {
-      spectrum(g) += invs_sum_V * this->volume(i) * this->flux(i, g);
+#pragma omp parallel for schedule(dynamic)
+  for (int iw = 0; iw < static_cast<int>(work.size()); iw++) {
+    const auto [t, s] = work[static_cast<std::size_t>(iw)];
+    auto& tally = tallies_[t];
+    const auto& xs = score_xs[static_cast<std::size_t>(tally.score)];
+    for (const auto i : tally.region_sets[s]) {
+      const double V = fsrs_[i]->volume();
+      const std::size_t m = fsr_xs_indx_[i];
+      for (std::size_t g = 0; g < ngroups_; g++) {
+        tally.result(s, g) += V * xs(m, g) * flux_(g, i, 0);
+      }
     }
   }
-
-  return spectrum;
 }
 
 void MOCDriver::apply_criticality_spectrum(const xt::xtensor<double, 1>& flux) {
@@ -1963,26 +5471,458 @@ void MOCDriver::apply_criticality_spectrum(const xt::xtensor<double, 1>& flux) {
   }
 
   // Apply correciton to boundary angular fluxes
-  for (auto& angle : tracks_) {
-    for (auto& track : angle) {
-      for (std::size_t g = 0; g < this->ngroups(); g++) {
-        xt::view(track.entry_flux(), g, xt::all()) *= group_mult(g);
-        xt::view(track.exit_flux(), g, xt::all()) *= group_mult(g);
+  for (std::size_t r = 0; r < track_flux_.shape()[0]; r++) {
+    for (std::size_t g = 0; g < this->ngroups(); g++) {
+      xt::view(track_flux_, r, g, xt::all()) *= group_mult(g);
+    }
+  }
+}
+
+namespace {
+
+// Records of the track cache file. All records have a size which is a
+// multiple of 8 bytes, so that the arrays which follow the header are
+// aligned in the mapped file.
+constexpr std::uint64_t TRACK_CACHE_MAGIC = 0x4B4341525445434DULL;
+constexpr std::uint32_t TRACK_CACHE_VERSION = 1;
+
+struct TrackCacheHeader {
+  std::uint64_t magic;
+  std::uint32_t version;
+  std::uint32_t n_angles;  // Requested number of azimuthal angles
+  std::uint64_t hash;
+  double d;  // Requested track spacing
+  std::uint64_t nfsrs;
+  std::uint64_t n_track_angles;
+  std::uint64_t ntracks;
+  std::uint64_t nsegments;
+  std::uint64_t has_cmfd;
+};
+
+struct TrackCacheAngle {
+  double phi;
+  double d;
+  double wgt;
+  std::uint32_t nx;
+  std::uint32_t ny;
+  std::uint64_t forward_index;
+  std::uint64_t backward_index;
+};
+
+struct TrackCacheTrack {
+  double entry_x, entry_y;
+  double exit_x, exit_y;
+  std::uint64_t nsegments;
+  std::uint64_t cmfd_entry_cell;
+  std::uint64_t cmfd_exit_cell;
+};
+
+struct TrackCacheSegment {
+  double length;
+  std::uint64_t fsr_indx;
+};
+
+// Only written when a CMFD mesh is used, two for each segment
+struct TrackCacheCrossing {
+  std::uint64_t cell_index;
+  std::uint32_t is_valid;
+  std::uint32_t crossing;
+};
+
+template <typename T>
+void write_record(std::ostream& file, const T& rec) {
+  file.write(reinterpret_cast<const char*>(&rec), sizeof(T));
+}
+
+template <typename T>
+T read_record(const char*& ptr) {
+  T rec;
+  std::memcpy(&rec, ptr, sizeof(T));
+  ptr += sizeof(T);
+  return rec;
+}
+
+// Header of the files written by MOCDriver::save_bin. It is followed by the
+// cereal archive of the driver state, padded to a multiple of 8 bytes, the
+// track laydown in the format of the track cache file, and the raw flux,
+// external source, and track flux arrays. Cross sections are only stored in
+// the geometry, as segments refer to their FSR by index.
+constexpr std::uint64_t DRIVER_FILE_MAGIC = 0x4E49424444434F4DULL;
+constexpr std::uint32_t DRIVER_FILE_VERSION = 3;
+
+struct DriverFileHeader {
+  std::uint64_t magic;
+  std::uint32_t version;
+  std::uint32_t stored_real_size;  // Bytes per value of the track fluxes
+  std::uint64_t n_track_angles;
+  std::uint64_t state_size;
+  std::uint64_t laydown_size;
+  std::uint64_t flux_shape[3];
+  std::uint64_t extern_src_shape[2];
+  std::uint64_t track_flux_shape[3];
+};
+
+std::size_t padded_size(std::size_t n) { return (n + 7) / 8 * 8; }
+
+template <typename T>
+void write_array(std::ostream& file, const T& arr) {
+  file.write(reinterpret_cast<const char*>(arr.data()),
+             static_cast<std::streamsize>(arr.size() *
+                                          sizeof(typename T::value_type)));
+}
+
+template <typename T, std::size_t N>
+void read_array(const char*& ptr, const std::uint64_t (&shape)[N],
+                xt::xtensor<T, N>& arr) {
+  std::array<std::size_t, N> shp;
+  for (std::size_t i = 0; i < N; i++) shp[i] = shape[i];
+  arr = xt::xtensor<T, N>::from_shape(shp);
+  std::memcpy(arr.data(), ptr, arr.size() * sizeof(T));
+  ptr += arr.size() * sizeof(T);
+}
+
+}  // namespace
+
+void MOCDriver::set_track_cache_file(const std::string& fname) {
+  track_cache_file_ = fname;
+}
+
+void MOCDriver::set_track_cache_dir(const std::string& dname) {
+  track_cache_dir_ = dname;
+}
+
+std::string MOCDriver::track_cache_path(std::uint64_t hash) const {
+  if (track_cache_file_.empty() == false) return track_cache_file_;
+
+  std::ostringstream fname;
+  fname << std::hex << std::setw(16) << std::setfill('0') << hash
+        << ".tracks";
+  return (std::filesystem::path(track_cache_dir_) / fname.str()).string();
+}
+
+std::uint64_t MOCDriver::track_cache_hash(std::uint32_t n_angles,
+                                          double d) const {
+  // 64 bit FNV-1a hash of everything which determines the track laydown
+  std::uint64_t hash = 14695981039346656037ULL;
+  auto add = [&hash](const auto& val) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&val);
+    for (std::size_t b = 0; b < sizeof(val); b++) {
+      hash ^= bytes[b];
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  add(TRACK_CACHE_VERSION);
+  add(n_angles);
+  add(d);
+  add(geometry_->x_min());
+  add(geometry_->x_max());
+  add(geometry_->y_min());
+  add(geometry_->y_max());
+  add(geometry_->nx());
+  add(geometry_->ny());
+  add(modular_rt_);
+  add(nfsrs_);
+  for (const auto* fsr : fsrs_) add(fsr->volume());
+
+  // The FSR volumes do not tell where the FSRs are, so we also sample which
+  // FSR is found on a regular grid of points. This is independent of the
+  // materials, which may change between two drivers using the same laydown.
+  constexpr std::size_t NPROBE = 64;
+  const double Dx = geometry_->x_max() - geometry_->x_min();
+  const double Dy = geometry_->y_max() - geometry_->y_min();
+  const Direction u(1., 0.);
+  for (std::size_t j = 0; j < NPROBE; j++) {
+    const double y = geometry_->y_min() + Dy * (j + 0.5) / NPROBE;
+    for (std::size_t i = 0; i < NPROBE; i++) {
+      const double x = geometry_->x_min() + Dx * (i + 0.5) / NPROBE;
+      const auto fsr_r = geometry_->get_fsr_r_local(Vector(x, y), u);
+      add(fsr_r.first.fsr ? this->get_fsr_indx(fsr_r.first) : nfsrs_);
+    }
+  }
+
+  // Tracing also records the CMFD surfaces which are crossed
+  add(cmfd_ != nullptr);
+  if (cmfd_) {
+    for (const double dx : cmfd_->dx()) add(dx);
+    for (const double dy : cmfd_->dy()) add(dy);
+  }
+
+  return hash;
+}
+
+void MOCDriver::save_track_cache(const std::string& fname, std::uint64_t hash,
+                                 std::uint32_t n_angles, double d) const {
+  std::error_code ec;
+  const auto dir = std::filesystem::path(fname).parent_path();
+  if (dir.empty() == false) std::filesystem::create_directories(dir, ec);
+
+  // Written under a unique temporary name and then renamed, so that another
+  // process never maps a partially written file of a shared cache directory
+  std::ostringstream tmp_fname;
+  tmp_fname << fname << "." << std::hex << std::random_device()() << ".tmp";
+  {
+    std::ofstream file(tmp_fname.str(),
+                       std::ios_base::binary | std::ios_base::trunc);
+    write_track_laydown(file, hash, n_angles, d);
+    file.close();
+    if (file.fail()) {
+      spdlog::warn("Could not write the track cache file \"{}\".", fname);
+      std::filesystem::remove(tmp_fname.str(), ec);
+      return;
+    }
+  }
+
+  std::filesystem::rename(tmp_fname.str(), fname, ec);
+  if (ec) {
+    spdlog::warn("Could not write the track cache file \"{}\".", fname);
+    std::filesystem::remove(tmp_fname.str(), ec);
+  }
+}
+
+void MOCDriver::write_track_laydown(std::ostream& file, std::uint64_t hash,
+                                    std::uint32_t n_angles, double d) const {
+  TrackCacheHeader header{};
+  header.magic = TRACK_CACHE_MAGIC;
+  header.version = TRACK_CACHE_VERSION;
+  header.n_angles = n_angles;
+  header.hash = hash;
+  header.d = d;
+  header.nfsrs = nfsrs_;
+  header.n_track_angles = angle_info_.size();
+  header.has_cmfd = cmfd_ ? 1 : 0;
+  for (const auto& tracks : tracks_) {
+    header.ntracks += tracks.size();
+    for (const auto& track : tracks) header.nsegments += track.size();
+  }
+
+  write_record(file, header);
+
+  for (const auto& ai : angle_info_) {
+    write_record(file, TrackCacheAngle{ai.phi, ai.d, ai.wgt, ai.nx, ai.ny,
+                                       ai.forward_index, ai.backward_index});
+  }
+
+  for (const auto& tracks : tracks_) {
+    for (const auto& track : tracks) {
+      write_record(file, TrackCacheTrack{
+                             track.entry_pos().x(), track.entry_pos().y(),
+                             track.exit_pos().x(), track.exit_pos().y(),
+                             track.size(), cmfd_ ? track.entry_cmfd_cell() : 0,
+                             cmfd_ ? track.exit_cmfd_cell() : 0});
+    }
+  }
+
+  for (const auto& tracks : tracks_) {
+    for (const auto& track : tracks) {
+      for (const auto& seg : track) {
+        write_record(file, TrackCacheSegment{seg.length(), seg.fsr_indx()});
+      }
+    }
+  }
+
+  if (cmfd_) {
+    auto crossing = [](const CMFDSurfaceCrossing& c) {
+      return TrackCacheCrossing{c.cell_index, c.is_valid ? 1u : 0u,
+                                static_cast<std::uint32_t>(c.crossing)};
+    };
+    for (const auto& tracks : tracks_) {
+      for (const auto& track : tracks) {
+        for (const auto& seg : track) {
+          write_record(file, crossing(seg.entry_cmfd_surface()));
+          write_record(file, crossing(seg.exit_cmfd_surface()));
+        }
+      }
+    }
+  }
+}
+
+bool MOCDriver::load_track_cache(const std::string& fname, std::uint64_t hash,
+                                 std::uint32_t n_angles, double d) {
+  if (std::filesystem::exists(fname) == false) return false;
+
+  MappedFile file(fname);
+  return read_track_laydown(file.data(), file.size(), hash, n_angles, d,
+                            "Track cache file \"" + fname + "\"");
+}
+
+bool MOCDriver::read_track_laydown(const char* data, std::size_t size,
+                                   std::uint64_t hash, std::uint32_t n_angles,
+                                   double d, const std::string& source,
+                                   bool insert_cmfd_fsrs) {
+  if (size < sizeof(TrackCacheHeader)) return false;
+
+  const char* ptr = data;
+  const auto header = read_record<TrackCacheHeader>(ptr);
+  if (header.magic != TRACK_CACHE_MAGIC ||
+      header.version != TRACK_CACHE_VERSION || header.hash != hash ||
+      header.n_angles != n_angles || header.d != d || header.nfsrs != nfsrs_ ||
+      header.has_cmfd != (cmfd_ ? 1 : 0)) {
+    spdlog::info("{} does not match the geometry.", source);
+    return false;
+  }
+
+  const std::size_t expected_size =
+      sizeof(TrackCacheHeader) +
+      header.n_track_angles * sizeof(TrackCacheAngle) +
+      header.ntracks * sizeof(TrackCacheTrack) +
+      header.nsegments * sizeof(TrackCacheSegment) +
+      header.has_cmfd * 2 * header.nsegments * sizeof(TrackCacheCrossing);
+  if (size != expected_size) {
+    spdlog::warn("{} is corrupted.", source);
+    return false;
+  }
+
+  std::vector<AngleInfo> angle_info;
+  angle_info.reserve(header.n_track_angles);
+  std::size_t ntracks = 0;
+  for (std::size_t a = 0; a < header.n_track_angles; a++) {
+    const auto rec = read_record<TrackCacheAngle>(ptr);
+    angle_info.push_back({rec.phi, rec.d, rec.wgt, rec.nx, rec.ny,
+                          rec.forward_index, rec.backward_index});
+    ntracks += rec.nx + rec.ny;
+  }
+  if (ntracks != header.ntracks) {
+    spdlog::warn("{} is corrupted.", source);
+    return false;
+  }
+
+  // The segments and crossings are stored after all the tracks
+  const char* seg_ptr = ptr + header.ntracks * sizeof(TrackCacheTrack);
+  const char* cross_ptr =
+      seg_ptr + header.nsegments * sizeof(TrackCacheSegment);
+  std::size_t nsegs = 0;
+
+  std::vector<std::vector<Track>> tracks(angle_info.size());
+  for (std::size_t a = 0; a < angle_info.size(); a++) {
+    const auto& ai = angle_info[a];
+    const Direction u(ai.phi);
+    tracks[a].reserve(ai.nx + ai.ny);
+
+    for (std::size_t t = 0; t < ai.nx + ai.ny; t++) {
+      const auto trec = read_record<TrackCacheTrack>(ptr);
+      nsegs += trec.nsegments;
+      if (nsegs > header.nsegments) {
+        spdlog::warn("{} is corrupted.", source);
+        return false;
+      }
+
+      std::vector<Segment> segments;
+      segments.reserve(trec.nsegments);
+      for (std::size_t s = 0; s < trec.nsegments; s++) {
+        const auto srec = read_record<TrackCacheSegment>(seg_ptr);
+        if (srec.fsr_indx >= nfsrs_) {
+          spdlog::warn("{} is corrupted.", source);
+          return false;
+        }
+        segments.emplace_back(fsrs_[srec.fsr_indx], srec.length,
+                              srec.fsr_indx);
+
+        if (cmfd_) {
+          auto crossing = [](const TrackCacheCrossing& c) {
+            CMFDSurfaceCrossing out;
+            out.cell_index = c.cell_index;
+            out.is_valid = c.is_valid != 0;
+            out.crossing = static_cast<CMFDSurfaceCrossing::Type>(c.crossing);
+            return out;
+          };
+          auto& seg = segments.back();
+          seg.entry_cmfd_surface() =
+              crossing(read_record<TrackCacheCrossing>(cross_ptr));
+          seg.exit_cmfd_surface() =
+              crossing(read_record<TrackCacheCrossing>(cross_ptr));
+        }
+      }
+
+      tracks[a].emplace_back(Vector(trec.entry_x, trec.entry_y),
+                             Vector(trec.exit_x, trec.exit_y), u, ai.phi,
+                             ai.wgt, ai.d, segments, ai.forward_index,
+                             ai.backward_index);
+      tracks[a].back().entry_cmfd_cell() = trec.cmfd_entry_cell;
+      tracks[a].back().exit_cmfd_cell() = trec.cmfd_exit_cell;
+    }
+  }
+
+  // Tracing fills the FSRs of each CMFD cell, which we must do here instead
+  if (cmfd_ && insert_cmfd_fsrs) {
+    for (const auto& angle_tracks : tracks) {
+      for (const auto& track : angle_tracks) {
+        for (const auto& seg : track) {
+          cmfd_->insert_fsr(seg.entry_cmfd_surface().cell_index,
+                            seg.fsr_indx());
+        }
       }
     }
   }
+
+  angle_info_ = std::move(angle_info);
+  tracks_ = std::move(tracks);
+  return true;
 }
 
 void MOCDriver::save_bin(const std::string& fname) const {
+  if (direct_segments() == false) {
+    const auto mssg =
+        "Cannot save a MOCDriver traced on the fly or with compressed "
+        "segments.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
   if (std::filesystem::exists(fname)) {
     std::filesystem::remove(fname);
   }
 
-  std::ofstream file(fname, std::ios_base::binary);
+  std::ostringstream state(std::ios_base::binary);
+  {
+    cereal::PortableBinaryOutputArchive arc(state);
+    this->save_state(arc);
+  }
+  const std::string state_data = std::move(state).str();
 
-  cereal::PortableBinaryOutputArchive arc(file);
+  // The geometry is stored in the same file, so the laydown needs no hash
+  const std::uint32_t n_track_angles =
+      static_cast<std::uint32_t>(angle_info_.size());
+  std::ostringstream laydown(std::ios_base::binary);
+  write_track_laydown(laydown, 0, n_track_angles, 0.);
+  const std::string laydown_data = std::move(laydown).str();
+
+  DriverFileHeader header{};
+  header.magic = DRIVER_FILE_MAGIC;
+  header.version = DRIVER_FILE_VERSION;
+  header.stored_real_size = sizeof(StoredReal);
+  header.n_track_angles = n_track_angles;
+  header.state_size = state_data.size();
+  header.laydown_size = laydown_data.size();
+  for (std::size_t i = 0; i < 3; i++) {
+    header.flux_shape[i] = flux_.shape()[i];
+    header.track_flux_shape[i] = track_flux_.shape()[i];
+  }
+  for (std::size_t i = 0; i < 2; i++) {
+    header.extern_src_shape[i] = extern_src_.shape()[i];
+  }
 
-  arc(*this);
+  std::ofstream file(fname, std::ios_base::binary);
+  write_record(file, header);
+  file.write(state_data.data(),
+             static_cast<std::streamsize>(state_data.size()));
+  const std::array<char, 8> zeros{};
+  file.write(zeros.data(), static_cast<std::streamsize>(
+                               padded_size(state_data.size()) -
+                               state_data.size()));
+  file.write(laydown_data.data(),
+             static_cast<std::streamsize>(laydown_data.size()));
+  write_array(file, flux_);
+  write_array(file, extern_src_);
+  write_array(file, track_flux_);
+  file.close();
+
+  if (file.fail()) {
+    std::stringstream mssg;
+    mssg << "Could not write MOCDriver to \"" << fname << "\".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
 }
 
 std::shared_ptr<MOCDriver> MOCDriver::load_bin(const std::string& fname) {
@@ -1995,6 +5935,19 @@ std::shared_ptr<MOCDriver> MOCDriver::load_bin(const std::string& fname) {
 
   std::shared_ptr<MOCDriver> out(new MOCDriver());
 
+  {
+    MappedFile file(fname);
+    std::uint64_t magic = 0;
+    if (file.size() >= sizeof(magic)) {
+      std::memcpy(&magic, file.data(), sizeof(magic));
+    }
+    if (magic == DRIVER_FILE_MAGIC) {
+      out->read_bin(file.data(), file.size(), fname);
+      return out;
+    }
+  }
+
+  // Files written before the bulk format hold a single archive
   std::ifstream file(fname, std::ios_base::binary);
 
   cereal::PortableBinaryInputArchive arc(file);
@@ -2004,6 +5957,123 @@ std::shared_ptr<MOCDriver> MOCDriver::load_bin(const std::string& fname) {
   return out;
 }
 
+void MOCDriver::read_bin(const char* data, std::size_t size,
+                         const std::string& fname) {
+  const auto fail = [&fname](const std::string& reason) {
+    std::stringstream mssg;
+    mssg << "The file \"" << fname << "\" " << reason << ".";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  };
+
+  if (size < sizeof(DriverFileHeader)) fail("is corrupted");
+
+  const char* ptr = data;
+  const auto header = read_record<DriverFileHeader>(ptr);
+  if (header.version != DRIVER_FILE_VERSION) {
+    fail("was written by an incompatible version of Scarabee");
+  }
+  if (header.stored_real_size != sizeof(StoredReal)) {
+    fail("stores the track fluxes with a different precision");
+  }
+
+  const std::size_t nflux =
+      header.flux_shape[0] * header.flux_shape[1] * header.flux_shape[2];
+  const std::size_t nsrc =
+      header.extern_src_shape[0] * header.extern_src_shape[1];
+  const std::size_t ntrack_flux = header.track_flux_shape[0] *
+                                  header.track_flux_shape[1] *
+                                  header.track_flux_shape[2];
+  const std::size_t expected_size =
+      sizeof(DriverFileHeader) + padded_size(header.state_size) +
+      header.laydown_size + (nflux + nsrc) * sizeof(double) +
+      ntrack_flux * sizeof(StoredReal);
+  if (size != expected_size) fail("is corrupted");
+
+  {
+    std::istringstream state(std::string(ptr, header.state_size),
+                             std::ios_base::binary);
+    cereal::PortableBinaryInputArchive arc(state);
+    this->load_state(arc);
+  }
+  ptr += padded_size(header.state_size);
+  this->allocate_fsr_data();
+
+  // The FSR lists of the CMFD were stored with it
+  if (read_track_laydown(ptr, header.laydown_size, 0,
+                         static_cast<std::uint32_t>(header.n_track_angles),
+                         0., "File \"" + fname + "\"", false) == false) {
+    fail("is corrupted");
+  }
+  ptr += header.laydown_size;
+
+  // The segment lengths were stored after renormalization, so the tracks
+  // are only connected again, as in generate_tracks
+  if (tracks_.empty() == false) {
+    std::size_t slot = 0;
+    for (auto& tracks : tracks_) {
+      for (auto& track : tracks) track.set_flux_slot(slot++);
+    }
+    set_bcs();
+    allocate_track_fluxes();
+    chains_.build(tracks_);
+    seg_store_.pack(tracks_, fsr_xs_indx_, cmfd_.get());
+    partition_tracks();
+    traced_tiles_ = traced_tile_fsrs();
+  }
+
+  read_array(ptr, header.flux_shape, flux_);
+  read_array(ptr, header.extern_src_shape, extern_src_);
+
+  if (tracks_.empty() == false &&
+      header.track_flux_shape[0] != track_flux_.shape()[0]) {
+    fail("is corrupted");
+  }
+  read_array(ptr, header.track_flux_shape, track_flux_);
+}
+
+void solve_all(const std::vector<std::shared_ptr<MOCDriver>>& drivers) {
+  SCARABEE_PROFILE_ZONE("solve_all");
+
+  for (const auto& d : drivers) {
+    if (d == nullptr) {
+      const auto mssg = "MOCDriver is None.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+  // The work of a solve is estimated from the number of unknowns
+  std::vector<double> cost(drivers.size(), 0.);
+  double total_cost = 0.;
+  for (std::size_t i = 0; i < drivers.size(); i++) {
+    cost[i] = static_cast<double>(drivers[i]->nfsr() * drivers[i]->ngroups());
+    total_cost += cost[i];
+  }
+
+  const std::size_t nthreads = max_threads();
+  const double large_cost = total_cost / static_cast<double>(nthreads);
+  std::vector<std::size_t> large, small;
+  for (std::size_t i = 0; i < drivers.size(); i++) {
+    if (nthreads == 1 || cost[i] >= large_cost) {
+      large.push_back(i);
+    } else {
+      small.push_back(i);
+    }
+  }
+
+  for (const std::size_t i : large) drivers[i]->solve();
+
+  std::stable_sort(small.begin(), small.end(),
+                   [&cost](std::size_t i, std::size_t j) {
+                     return cost[i] > cost[j];
+                   });
+  parallel_for_each_index(small.size(), [&](std::size_t k) {
+    set_num_threads(1);
+    drivers[small[k]]->solve();
+  });
+}
+
 }  // namespace scarabee
 
 // REFERENCES
@@ -3,19 +3,16 @@
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 
+#include <algorithm>
 #include <sstream>
-#include <random>
 
 namespace scarabee {
 
 MOCPlotter::MOCPlotter(const MOCDriver* moc)
     : moc_(moc),
       geom_(nullptr),
-      cell_id_to_color(),
-      material_id_to_color(),
-      material_name_to_color(),
+      colors(),
       image(500, 500),
-      create_color_mutex(),
       height(10.),
       width(10.),
       ox(0.),
@@ -27,6 +24,7 @@ MOCPlotter::MOCPlotter(const MOCDriver* moc)
       background(),
       colorby(ColorBy::MaterialName),
       must_rerender(true),
+      must_refine(false),
       outline_boundaries(true) {
   if (moc_ == nullptr) {
     std::stringstream mssg;
@@ -54,6 +52,9 @@ void MOCPlotter::render_viewport() {
   ImGui::SetNextWindowSize({500, 500}, ImGuiCond_Once);
   ImGui::Begin("Viewport");
 
+  // Dragging or zooming the view, during which only coarse images are drawn
+  bool interacting = false;
+
   // First, get the window size. If the size doesn't match the current
   // image size, we must set must_rerender to true.
   ImVec2 size = ImGui::GetContentRegionAvail();
@@ -76,6 +77,7 @@ void MOCPlotter::render_viewport() {
       ox -= dist_per_pixel * mouse_drag[0];
       oy += dist_per_pixel * mouse_drag[1];
       must_rerender = true;
+      interacting = true;
     }
   }
 
@@ -91,11 +93,16 @@ void MOCPlotter::render_viewport() {
     height = static_cast<double>(image.height()) * dist_per_pixel;
 
     must_rerender = true;
+    interacting = true;
   }
 
-  // If we window must be rerendered, we do that now
-  if (must_rerender) {
-    this->render_image();
+  // If we window must be rerendered, we do that now. While the view is
+  // moving, a coarse image is drawn, which is refined in the first frame
+  // after the view stops.
+  if (must_rerender || must_refine) {
+    constexpr std::uint32_t COARSE_STRIDE = 4;
+    this->render_image(interacting ? COARSE_STRIDE : 1);
+    must_refine = interacting;
     must_rerender = false;
 
     // Now we need to send the image to the GPU.
@@ -172,12 +179,7 @@ void MOCPlotter::render_viewport() {
       color.g() = static_cast<uint8_t>(fcolor.y * 255.f);
       color.b() = static_cast<uint8_t>(fcolor.z * 255.f);
 
-      if (colorby == ColorBy::Material)
-        material_id_to_color[mxs] = color;
-      else if (colorby == ColorBy::MaterialName)
-        material_name_to_color[mxs->name()] = color;
-      else
-        cell_id_to_color[mufsr.fsr->id()] = color;
+      set_color(mufsr, color);
 
       must_rerender = true;
     }
@@ -271,7 +273,7 @@ void MOCPlotter::render_controls() {
       color.g() = static_cast<uint8_t>(fcolor.y * 255.f);
       color.b() = static_cast<uint8_t>(fcolor.z * 255.f);
 
-      cell_id_to_color[mufsr.fsr->id()] = color;
+      set_color(mufsr, color);
 
       must_rerender = true;
     }
@@ -282,7 +284,7 @@ void MOCPlotter::render_controls() {
       color.g() = static_cast<uint8_t>(fcolor.y * 255.f);
       color.b() = static_cast<uint8_t>(fcolor.z * 255.f);
 
-      unique_cell_to_color[mufsr] = color;
+      set_color(mufsr, color);
 
       must_rerender = true;
     }
@@ -298,7 +300,7 @@ void MOCPlotter::render_controls() {
       color.g() = static_cast<uint8_t>(fcolor.y * 255.f);
       color.b() = static_cast<uint8_t>(fcolor.z * 255.f);
 
-      material_id_to_color[mxs] = color;
+      set_color(mufsr, color);
 
       must_rerender = true;
     }
@@ -309,7 +311,7 @@ void MOCPlotter::render_controls() {
       color.g() = static_cast<uint8_t>(fcolor.y * 255.f);
       color.b() = static_cast<uint8_t>(fcolor.z * 255.f);
 
-      material_name_to_color[mxs->name()] = color;
+      set_color(mufsr, color);
 
       must_rerender = true;
     }
@@ -344,271 +346,49 @@ void MOCPlotter::render_controls() {
   ImGui::End();
 }
 
-void MOCPlotter::render_image() {
-  {
-    // Get the tracking direction
-    const Direction u = this->get_tracking_direction();
-
-// Go through each pixel
-#ifdef ABEILLE_USE_OMP
-#pragma omp parallel for schedule(dynamic)
-#endif
-    for (uint32_t j = 0; j < image.height(); j++) {
-      Vector strt = get_start_position(j);
-
-      auto ufsr_r = geom_->get_fsr_r_local(strt, u);
-      ImApp::Pixel pixel_color = this->get_color(ufsr_r.first);
-
-      uint32_t i = 0;
-      while (i < image.width()) {
-        // Get the boundary distance
-        double bound_distance = INF;
-        if (ufsr_r.first.fsr) {
-          bound_distance = ufsr_r.first.fsr->distance(ufsr_r.second, u);
-        } else {
-          bound_distance = geom_->distance(ufsr_r.second, u);
-        }
-
-        // Get the number of pixels till the boundary
-        const double pixels_to_bound = bound_distance / dist_per_pixel;
-        uint32_t npixels = static_cast<uint32_t>(std::round(pixels_to_bound));
-        if (npixels > (image.width() - i) || bound_distance == INF) {
-          npixels = image.width() - i;
-        }
-        const double npixels_dist =
-            static_cast<double>(npixels) * dist_per_pixel;
-
-        // Set all pixels
-        for (uint32_t p = 0; p < npixels; p++) {
-          if (i >= image.width()) break;
-          if (outline_boundaries && npixels > 0 &&
-              (p == npixels - 1 || i == image.width() - 1)) {
-            image.at(j, i) = ImApp::Pixel(0, 0, 0);
-          } else {
-            image.at(j, i) = pixel_color;
-          }
-          i++;
-        }
-        if (i >= image.width()) break;
-
-        // Cross boundary, update cell, and get new pixel
-        if (pixels_to_bound - static_cast<double>(npixels) < 0.5) {
-          strt = strt + (npixels_dist + dist_per_pixel) * u;
-        } else {
-          strt = strt + npixels_dist * u;
-        }
-        ufsr_r = geom_->get_fsr_r_local(strt, u);
-        pixel_color = this->get_color(ufsr_r.first);
-        if (pixels_to_bound - static_cast<double>(npixels) < 0.5) {
-          if (i >= image.width()) break;
-          image.at(j, i) = pixel_color;
-          i++;
-        }
-      }  // while i < plot_width_
-    }  // For j which is parallel
-  }
-
-  if (outline_boundaries) {
-    // Get the tracking direction
-    const Direction u = this->get_comp_tracking_direction();
-
-    // Go through each pixel
-#ifdef ABEILLE_USE_OMP
-#pragma omp parallel for schedule(dynamic)
-#endif
-    for (uint32_t i = 0; i < image.width(); i++) {
-      Vector strt = get_comp_start_position(i);
-
-      auto ufsr_r = geom_->get_fsr_r_local(strt, u);
-
-      uint32_t j = 0;
-      while (j < image.height()) {
-        // Get the boundary distance
-        double bound_distance = INF;
-        if (ufsr_r.first.fsr) {
-          bound_distance = ufsr_r.first.fsr->distance(ufsr_r.second, u);
-        } else {
-          bound_distance = geom_->distance(ufsr_r.second, u);
-        }
-
-        // Get the number of pixels till the boundary
-        const double pixels_to_bound = bound_distance / dist_per_pixel;
-        uint32_t npixels = static_cast<uint32_t>(std::round(pixels_to_bound));
-        if (npixels > (image.height() - j) || bound_distance == INF) {
-          npixels = image.height() - j;
-        }
-        const double npixels_dist =
-            static_cast<double>(npixels) * dist_per_pixel;
-
-        // Set all pixels
-        for (uint32_t p = 0; p < npixels; p++) {
-          if (j >= image.height()) break;
-          if (npixels > 0 && (p == npixels - 1 || j == image.height() - 1)) {
-            image.at(j, i) = ImApp::Pixel(0, 0, 0);
-          }
-          j++;
-        }
-        if (j >= image.height()) break;
-
-        // Cross boundary, update cell, and get new pixel
-        if (pixels_to_bound - static_cast<double>(npixels) < 0.5) {
-          strt = strt + (npixels_dist + dist_per_pixel) * u;
-        } else {
-          strt = strt + npixels_dist * u;
-        }
-        ufsr_r = geom_->get_fsr_r_local(strt, u);
-        if (pixels_to_bound - static_cast<double>(npixels) < 0.5) {
-          if (j >= image.height()) break;
-          j++;
-        }
-      }  // while j < image.height
-    }  // For i which is parallel
-  }
-}
-
-ImApp::Pixel MOCPlotter::get_random_color() {
-  static std::minstd_rand rng_engn;
-  static std::uniform_real_distribution unit_dist(0., 1.);
-
-  uint8_t r = static_cast<uint8_t>(255.0 * unit_dist(rng_engn));
-  uint8_t g = static_cast<uint8_t>(255.0 * unit_dist(rng_engn));
-  uint8_t b = static_cast<uint8_t>(255.0 * unit_dist(rng_engn));
-
-  return ImApp::Pixel(r, g, b);
-}
-
-ImApp::Pixel MOCPlotter::get_color(UniqueFSR ufsr) {
-  ImApp::Pixel pixel_color = background;
-  // If pointer isn't nullpntr, get pixel
-  if (ufsr.fsr != nullptr) {
-    if (colorby == ColorBy::Cell) {
-      // Do same check twice with mutex to make thread safe
-      auto it = cell_id_to_color.find(ufsr.fsr->id());
-      if (it == cell_id_to_color.end()) {
-        // Check if cell id is in id_to_pixel
-        create_color_mutex.lock();
-        if (cell_id_to_color.find(ufsr.fsr->id()) == cell_id_to_color.end()) {
-          // Get new random color for id
-          pixel_color = get_random_color();
-          cell_id_to_color[ufsr.fsr->id()] = pixel_color;
-        }
-        create_color_mutex.unlock();
-      } else {
-        pixel_color = it->second;
-      }
-    } else if (colorby == ColorBy::UniqueCell) {
-      // Do same check twice with mutex to make thread safe
-      auto it = unique_cell_to_color.find(ufsr);
-      if (it == unique_cell_to_color.end()) {
-        // Check if cell id is in id_to_pixel
-        create_color_mutex.lock();
-        if (unique_cell_to_color.find(ufsr) == unique_cell_to_color.end()) {
-          // Get new random color for id
-          pixel_color = get_random_color();
-          unique_cell_to_color[ufsr] = pixel_color;
-        }
-        create_color_mutex.unlock();
-      } else {
-        pixel_color = it->second;
-      }
-    } else if (colorby == ColorBy::Material) {
-      // Color by material
-      CrossSection* xs = ufsr.fsr->xs().get();
-      // Do same check twice with mutex to make thread safe
-      auto it = material_id_to_color.find(xs);
-      if (it == material_id_to_color.end()) {
-        // Check if cell id is in id_to_pixel
-        create_color_mutex.lock();
-        if (material_id_to_color.find(xs) == material_id_to_color.end()) {
-          // Get new random color for id
-          pixel_color = get_random_color();
-          material_id_to_color[xs] = pixel_color;
-        }
-        create_color_mutex.unlock();
-      } else {
-        pixel_color = it->second;
-      }
-    } else {
-      // Color by material name
-      CrossSection* xs = ufsr.fsr->xs().get();
-      // Do same check twice with mutex to make thread safe
-      auto it = material_name_to_color.find(xs->name());
-      if (it == material_name_to_color.end()) {
-        // Check if cell id is in id_to_pixel
-        create_color_mutex.lock();
-        if (material_name_to_color.find(xs->name()) ==
-            material_name_to_color.end()) {
-          // Get new random color for id
-          pixel_color = get_random_color();
-          material_name_to_color[xs->name()] = pixel_color;
-        }
-        create_color_mutex.unlock();
-      } else {
-        pixel_color = it->second;
-      }
+void MOCPlotter::render_image(std::uint32_t stride) {
+  // The view is rasterized with one pixel for each stride by stride block
+  // of screen pixels
+  RasterView view;
+  view.x_min = ox - 0.5 * width;
+  view.x_max = ox + 0.5 * width;
+  view.y_min = oy - 0.5 * height;
+  view.y_max = oy + 0.5 * height;
+  view.nx = std::max<std::size_t>(image.width() / stride, 1);
+  view.ny = std::max<std::size_t>(image.height() / stride, 1);
+  const auto raster = rasterize_geometry(*geom_, view, outline_boundaries);
+
+  const RGB bg{background.r(), background.g(), background.b()};
+  const auto rgb = color_raster(raster, colors,
+                                static_cast<PlotColorBy>(colorby),
+                                outline_boundaries, bg);
+
+#pragma omp parallel for
+  for (int jj = 0; jj < static_cast<int>(image.height()); jj++) {
+    const std::uint32_t j = static_cast<std::uint32_t>(jj);
+    const std::size_t rj = std::min<std::size_t>(
+        static_cast<std::size_t>(j) * view.ny / image.height(), view.ny - 1);
+    for (std::uint32_t i = 0; i < image.width(); i++) {
+      const std::size_t ri = std::min<std::size_t>(
+          static_cast<std::size_t>(i) * view.nx / image.width(), view.nx - 1);
+      image.at(j, i) =
+          ImApp::Pixel(rgb(rj, ri, 0), rgb(rj, ri, 1), rgb(rj, ri, 2));
     }
   }
-  return pixel_color;
-}
-
-Direction MOCPlotter::get_tracking_direction() const {
-  return Direction(1., 0.);
-}
-
-Direction MOCPlotter::get_comp_tracking_direction() const {
-  return Direction(0., -1.);
 }
 
-Vector MOCPlotter::get_start_position(uint64_t j) const {
-  // Make sure indicies are valid. j goes down so is height, i goes
-  // across so is width
-  if (j >= image.height()) {
-    std::stringstream mssg;
-    mssg << "Trying to deffine invalid pixel for plot.";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
-  }
-
-  // x is i going across, j is y going up
-  // First get height and width of a pixel
-  const double dy = height / static_cast<double>(image.height());
-
-  // Get upper corner off plot
-  const double x_low = ox - (0.5 * width);
-  const double y_high = oy + (0.5 * height);
-
-  // Get coordinate of pixel
-  const double x = x_low;
-  const double y = y_high - (static_cast<double>(j) + 0.5) * dy;
+ImApp::Pixel MOCPlotter::get_color(UniqueFSR ufsr) {
+  if (ufsr.fsr == nullptr) return background;
 
-  // Return coordinate
-  return {x, y};
+  const RGB color = colors.get(ufsr, static_cast<PlotColorBy>(colorby));
+  return ImApp::Pixel(color[0], color[1], color[2]);
 }
 
-Vector MOCPlotter::get_comp_start_position(uint64_t i) const {
-  // Make sure indicies are valid. i goes across so is width, j goes
-  // down so is height
-  if (i >= image.width()) {
-    std::stringstream mssg;
-    mssg << "Trying to deffine invalid pixel for plot.";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
-  }
-
-  // x is i going across, j is y going down
-  // First get height and width of a pixel
-  const double dx = width / static_cast<double>(image.width());
-
-  // Get upper corner off plot
-  const double x_low = ox - (0.5 * width);
-  const double y_high = oy + (0.5 * height);
-
-  // Get coordinate of pixel
-  const double x = (static_cast<double>(i) + 0.5) * dx + x_low;
-  const double y = y_high;
+void MOCPlotter::set_color(UniqueFSR ufsr, const ImApp::Pixel& color) {
+  if (ufsr.fsr == nullptr) return;
 
-  // Return coordinate
-  return {x, y};
+  colors.set(ufsr, static_cast<PlotColorBy>(colorby),
+             {color.r(), color.g(), color.b()});
 }
 
 }  // namespace scarabee
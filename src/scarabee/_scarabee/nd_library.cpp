@@ -2,208 +2,248 @@
 #include <utils/constants.hpp>
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
+#include <utils/profiler.hpp>
+#include <utils/mapped_file.hpp>
+#include <utils/hdf5_lock.hpp>
 
 #include <xtensor/containers/xtensor.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <sstream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace scarabee {
 
-void NuclideHandle::load_xs_from_hdf5(const NDLibrary& ndl, std::size_t max_l) {
-  if (this->loaded()) return;
-
-  // Get the HDF5 Group for the nuclide
-  auto grp = ndl.h5()->getGroup(this->name);
+namespace {
+// Nuclide data which has already been read, by file and nuclide name. It
+// only lives as long as one NuclideHandle still has it loaded.
+std::map<std::pair<std::string, std::string>,
+         std::weak_ptr<const NuclideHandle>>&
+nuclide_cache() {
+  static std::map<std::pair<std::string, std::string>,
+                  std::weak_ptr<const NuclideHandle>>
+      cache;
+  return cache;
+}
 
-  // Load in all of the infinite dilution data
-  this->load_inf_data(ndl, grp, max_l);
+std::uint64_t next_library_uid() {
+  static std::atomic<std::uint64_t> uid{1};
+  return uid++;
+}
 
-  // Load dilution dependent data if necessary
-  if (this->resonant) {
-    this->load_res_data(grp, max_l);
-  }
+// Makes a read only array of the data, keeping owner alive while the array
+// is in use
+template <typename T, std::size_t N>
+std::shared_ptr<const NDArray<T, N>> make_array(
+    std::shared_ptr<const void> owner, const T* data,
+    const std::array<std::size_t, N>& shape) {
+  struct Holder {
+    std::shared_ptr<const void> owner;
+    NDArray<T, N> array;
+  };
+
+  std::size_t size = 1;
+  for (const auto s : shape) size *= s;
+
+  auto holder = std::make_shared<Holder>(
+      Holder{std::move(owner),
+             xt::adapt(const_cast<T*>(data), size, xt::no_ownership(), shape)});
+  return std::shared_ptr<const NDArray<T, N>>(holder, &holder->array);
 }
 
-void NuclideHandle::load_inf_data(const NDLibrary& ndl, const H5::Group& grp,
-                                  std::size_t max_l) {
-  // First we read in the packing of the scattering matrices. This is needed
-  // to get the length of the scattering arrays
-  packing = std::make_shared<xt::xtensor<std::uint32_t, 2>>();
-  packing->resize({ndl.ngroups(), static_cast<std::size_t>(3)});
-  grp.getDataSet("matrix-compression").read_raw<std::uint32_t>(packing->data());
-  const std::size_t len_scat_data = (*packing)(ndl.ngroups() - 1, 0) +
-                                    (*packing)(ndl.ngroups() - 1, 2) + 1 -
-                                    (*packing)(ndl.ngroups() - 1, 1);
+template <typename T, std::size_t N>
+std::shared_ptr<const NDArray<T, N>> read_array(
+    const H5::DataSet& ds, const std::array<std::size_t, N>& shape) {
+  std::size_t size = 1;
+  for (const auto s : shape) size *= s;
 
-  //==========================================================================
-  // Create and allocate arrays for infinite dilution cross sections
-  inf_absorption = std::make_shared<xt::xtensor<double, 2>>();
-  inf_absorption->resize({temperatures.size(), ndl.ngroups()});
+  auto buffer = std::make_shared<std::vector<T>>(size);
+  ds.read_raw<T>(buffer->data());
+  return make_array<T, N>(buffer, buffer->data(), shape);
+}
+}  // namespace
 
-  inf_transport_correction = std::make_shared<xt::xtensor<double, 2>>();
-  inf_transport_correction->resize({temperatures.size(), ndl.ngroups()});
+void NuclideHandle::load_xs_from_hdf5(const NDLibrary& ndl, std::size_t max_l) {
+  if (this->loaded()) return;
 
-  inf_scatter = std::make_shared<xt::xtensor<double, 2>>();
-  inf_scatter->resize({temperatures.size(), len_scat_data});
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
 
-  if (grp.exist("inf-p1-scatter") && max_l >= 1) {
-    inf_p1_scatter = std::make_shared<xt::xtensor<double, 2>>();
-    inf_p1_scatter->resize({temperatures.size(), len_scat_data});
-  }
-  if (grp.exist("inf-p2-scatter") && max_l >= 2) {
-    inf_p2_scatter = std::make_shared<xt::xtensor<double, 2>>();
-    inf_p2_scatter->resize({temperatures.size(), len_scat_data});
-  }
-  if (grp.exist("inf-p3-scatter") && max_l >= 3) {
-    inf_p3_scatter = std::make_shared<xt::xtensor<double, 2>>();
-    inf_p3_scatter->resize({temperatures.size(), len_scat_data});
-  }
+  // Another thread could have loaded the data while we waited for the lock
+  if (this->loaded()) return;
 
-  if (grp.exist("inf-(n,gamma)")) {
-    const auto dims = grp.getDataSet("inf-(n,gamma)").getDimensions();
-    inf_n_gamma = std::make_shared<xt::xtensor<double, 2>>();
-    inf_n_gamma->resize({temperatures.size(), dims[1]});
-  }
+  const auto key = std::make_pair(ndl.file_name(), this->name);
+  auto& cache = nuclide_cache();
+  auto cached = cache.find(key);
+  std::shared_ptr<const NuclideHandle> data =
+      cached != cache.end() ? cached->second.lock() : nullptr;
+
+  if (data) {
+    // Share the data already read by another NDLibrary
+    this->packing = data->packing;
+    this->chi = data->chi;
+    this->nu = data->nu;
+    this->inf_absorption = data->inf_absorption;
+    this->inf_transport_correction = data->inf_transport_correction;
+    this->inf_scatter = data->inf_scatter;
+    this->inf_p1_scatter = data->inf_p1_scatter;
+    this->inf_p2_scatter = data->inf_p2_scatter;
+    this->inf_p3_scatter = data->inf_p3_scatter;
+    this->inf_fission = data->inf_fission;
+    this->inf_n_gamma = data->inf_n_gamma;
+    this->inf_n_2n = data->inf_n_2n;
+    this->inf_n_3n = data->inf_n_3n;
+    this->inf_n_a = data->inf_n_a;
+    this->inf_n_p = data->inf_n_p;
+    this->res_absorption = data->res_absorption;
+    this->res_transport_correction = data->res_transport_correction;
+    this->res_scatter = data->res_scatter;
+    this->res_p1_scatter = data->res_p1_scatter;
+    this->res_p2_scatter = data->res_p2_scatter;
+    this->res_p3_scatter = data->res_p3_scatter;
+    this->res_fission = data->res_fission;
+    this->res_n_gamma = data->res_n_gamma;
+  } else {
+    // Get the HDF5 Group for the nuclide
+    auto grp = ndl.h5()->getGroup(this->name);
 
-  if (grp.exist("inf-(n,2n)")) {
-    const auto dims = grp.getDataSet("inf-(n,2n)").getDimensions();
-    inf_n_2n = std::make_shared<xt::xtensor<double, 2>>();
-    inf_n_2n->resize({temperatures.size(), dims[1]});
-  }
+    // Load in all of the infinite dilution data
+    this->load_inf_data(ndl, grp, max_l);
 
-  if (grp.exist("inf-(n,3n)")) {
-    const auto dims = grp.getDataSet("inf-(n,3n)").getDimensions();
-    inf_n_3n = std::make_shared<xt::xtensor<double, 2>>();
-    inf_n_3n->resize({temperatures.size(), dims[1]});
-  }
+    // Load dilution dependent data if necessary
+    if (this->resonant) {
+      this->load_res_data(grp, max_l);
+    }
 
-  if (grp.exist("inf-(n,a)")) {
-    const auto dims = grp.getDataSet("inf-(n,a)").getDimensions();
-    inf_n_a = std::make_shared<xt::xtensor<double, 2>>();
-    inf_n_a->resize({temperatures.size(), dims[1]});
+    this->shared_data = nullptr;
+    data = std::make_shared<const NuclideHandle>(*this);
+    cache[key] = data;
   }
 
-  if (grp.exist("inf-(n,p)")) {
-    const auto dims = grp.getDataSet("inf-(n,p)").getDimensions();
-    inf_n_p = std::make_shared<xt::xtensor<double, 2>>();
-    inf_n_p->resize({temperatures.size(), dims[1]});
-  }
+  this->shared_data = data;
+  this->loaded_flag.set(true);
+}
 
-  if (this->fissile) {
-    inf_fission = std::make_shared<xt::xtensor<double, 2>>();
-    inf_fission->resize({temperatures.size(), ndl.ngroups()});
-    nu = std::make_shared<xt::xtensor<double, 1>>();
-    nu->resize({ndl.ngroups()});
-    chi = std::make_shared<xt::xtensor<double, 1>>();
-    chi->resize({ndl.ngroups()});
-  }
+void NuclideHandle::load_inf_data(const NDLibrary& ndl, const H5::Group& grp,
+                                  std::size_t max_l) {
+  const std::size_t NG = ndl.ngroups();
+  const std::size_t NT = temperatures.size();
+
+  // First we read in the packing of the scattering matrices. This is needed
+  // to get the length of the scattering arrays
+  packing = read_array<std::uint32_t, 2>(grp.getDataSet("matrix-compression"),
+                                         {NG, static_cast<std::size_t>(3)});
+  const std::size_t len_scat_data =
+      (*packing)(NG - 1, 0) + (*packing)(NG - 1, 2) + 1 - (*packing)(NG - 1, 1);
 
   //==========================================================================
-  // Read in data
-  grp.getDataSet("inf-absorption").read_raw<double>(inf_absorption->data());
-  grp.getDataSet("inf-transport-correction")
-      .read_raw<double>(inf_transport_correction->data());
-  grp.getDataSet("inf-scatter").read_raw<double>(inf_scatter->data());
+  // Read infinite dilution cross sections
+  inf_absorption =
+      read_array<NDReal, 2>(grp.getDataSet("inf-absorption"), {NT, NG});
+  inf_transport_correction = read_array<NDReal, 2>(
+      grp.getDataSet("inf-transport-correction"), {NT, NG});
+  inf_scatter = read_array<NDReal, 2>(grp.getDataSet("inf-scatter"),
+                                      {NT, len_scat_data});
+
   if (grp.exist("inf-p1-scatter") && max_l >= 1) {
-    grp.getDataSet("inf-p1-scatter").read_raw<double>(inf_p1_scatter->data());
+    inf_p1_scatter = read_array<NDReal, 2>(grp.getDataSet("inf-p1-scatter"),
+                                           {NT, len_scat_data});
   }
   if (grp.exist("inf-p2-scatter") && max_l >= 2) {
-    grp.getDataSet("inf-p2-scatter").read_raw<double>(inf_p2_scatter->data());
+    inf_p2_scatter = read_array<NDReal, 2>(grp.getDataSet("inf-p2-scatter"),
+                                           {NT, len_scat_data});
   }
   if (grp.exist("inf-p3-scatter") && max_l >= 3) {
-    grp.getDataSet("inf-p3-scatter").read_raw<double>(inf_p3_scatter->data());
+    inf_p3_scatter = read_array<NDReal, 2>(grp.getDataSet("inf-p3-scatter"),
+                                           {NT, len_scat_data});
   }
+
   if (this->fissile) {
-    grp.getDataSet("inf-fission").read_raw<double>(inf_fission->data());
-    grp.getDataSet("nu").read_raw<double>(nu->data());
-    grp.getDataSet("chi").read_raw<double>(chi->data());
-  }
-  if (grp.exist("inf-(n,gamma)")) {
-    grp.getDataSet("inf-(n,gamma)").read_raw<double>(inf_n_gamma->data());
-  }
-  if (grp.exist("inf-(n,2n)")) {
-    grp.getDataSet("inf-(n,2n)").read_raw<double>(inf_n_2n->data());
-  }
-  if (grp.exist("inf-(n,3n)")) {
-    grp.getDataSet("inf-(n,3n)").read_raw<double>(inf_n_3n->data());
-  }
-  if (grp.exist("inf-(n,a)")) {
-    grp.getDataSet("inf-(n,a)").read_raw<double>(inf_n_a->data());
-  }
-  if (grp.exist("inf-(n,p)")) {
-    grp.getDataSet("inf-(n,p)").read_raw<double>(inf_n_p->data());
-  }
+    inf_fission =
+        read_array<NDReal, 2>(grp.getDataSet("inf-fission"), {NT, NG});
+    nu = read_array<NDReal, 1>(grp.getDataSet("nu"), {NG});
+    chi = read_array<NDReal, 1>(grp.getDataSet("chi"), {NG});
+  }
+
+  // Reaction rates for depletion, which do not all have the same number of
+  // groups
+  auto read_reaction = [&grp, NT](const std::string& mt) {
+    std::shared_ptr<const NDArray<NDReal, 2>> out{nullptr};
+    if (grp.exist(mt)) {
+      const auto ds = grp.getDataSet(mt);
+      out = read_array<NDReal, 2>(ds, {NT, ds.getDimensions()[1]});
+    }
+    return out;
+  };
+  inf_n_gamma = read_reaction("inf-(n,gamma)");
+  inf_n_2n = read_reaction("inf-(n,2n)");
+  inf_n_3n = read_reaction("inf-(n,3n)");
+  inf_n_a = read_reaction("inf-(n,a)");
+  inf_n_p = read_reaction("inf-(n,p)");
 }
 
 void NuclideHandle::load_res_data(const H5::Group& grp, std::size_t max_l) {
-  //==========================================================================
-  // Create and allocate arrays
   // Start by getting the dimensions. dims[0] should be number of temps
   // dims[1] should be number of dilutions
   // dims[2] should be number of resonant groups
   auto dims = grp.getDataSet("res-absorption").getDimensions();
-  res_absorption = std::make_shared<xt::xtensor<double, 3>>();
-  res_absorption->resize({dims[0], dims[1], dims[2]});
+  const std::array<std::size_t, 3> shp{dims[0], dims[1], dims[2]};
 
-  res_transport_correction = std::make_shared<xt::xtensor<double, 3>>();
-  res_transport_correction->resize({dims[0], dims[1], dims[2]});
+  res_absorption = read_array<NDReal, 3>(grp.getDataSet("res-absorption"), shp);
+  res_transport_correction =
+      read_array<NDReal, 3>(grp.getDataSet("res-transport-correction"), shp);
 
   if (this->fissile) {
-    res_fission = std::make_shared<xt::xtensor<double, 3>>();
-    res_fission->resize({dims[0], dims[1], dims[2]});
+    res_fission = read_array<NDReal, 3>(grp.getDataSet("res-fission"), shp);
   }
 
-  res_scatter = std::make_shared<xt::xtensor<double, 3>>();
   // Get new dimensions as scatter matrices are compressed with odd shape
   dims = grp.getDataSet("res-scatter").getDimensions();
-  res_scatter->resize({dims[0], dims[1], dims[2]});
+  const std::array<std::size_t, 3> scat_shp{dims[0], dims[1], dims[2]};
+  res_scatter = read_array<NDReal, 3>(grp.getDataSet("res-scatter"), scat_shp);
 
   if (grp.exist("res-p1-scatter") && max_l >= 1) {
-    res_p1_scatter = std::make_shared<xt::xtensor<double, 3>>();
-    res_p1_scatter->resize({dims[0], dims[1], dims[2]});
+    res_p1_scatter =
+        read_array<NDReal, 3>(grp.getDataSet("res-p1-scatter"), scat_shp);
   }
   if (grp.exist("res-p2-scatter") && max_l >= 2) {
-    res_p2_scatter = std::make_shared<xt::xtensor<double, 3>>();
-    res_p2_scatter->resize({dims[0], dims[1], dims[2]});
+    res_p2_scatter =
+        read_array<NDReal, 3>(grp.getDataSet("res-p2-scatter"), scat_shp);
   }
   if (grp.exist("res-p3-scatter") && max_l >= 3) {
-    res_p3_scatter = std::make_shared<xt::xtensor<double, 3>>();
-    res_p3_scatter->resize({dims[0], dims[1], dims[2]});
+    res_p3_scatter =
+        read_array<NDReal, 3>(grp.getDataSet("res-p3-scatter"), scat_shp);
   }
 
   if (grp.exist("res-(n,gamma)")) {
-    const auto dims = grp.getDataSet("res-(n,gamma)").getDimensions();
-    res_n_gamma = std::make_shared<xt::xtensor<double, 3>>();
-    res_n_gamma->resize({dims[0], dims[1], dims[2]});
-  }
-
-  //==========================================================================
-  // Read in data
-  grp.getDataSet("res-absorption").read_raw<double>(res_absorption->data());
-  grp.getDataSet("res-transport-correction")
-      .read_raw<double>(res_transport_correction->data());
-  grp.getDataSet("res-scatter").read_raw<double>(res_scatter->data());
-  if (grp.exist("res-p1-scatter") && max_l >= 1) {
-    grp.getDataSet("res-p1-scatter").read_raw<double>(res_p1_scatter->data());
-  }
-  if (grp.exist("res-p2-scatter") && max_l >= 2) {
-    grp.getDataSet("res-p2-scatter").read_raw<double>(res_p2_scatter->data());
-  }
-  if (grp.exist("res-p3-scatter") && max_l >= 3) {
-    grp.getDataSet("res-p3-scatter").read_raw<double>(res_p3_scatter->data());
-  }
-  if (this->fissile) {
-    grp.getDataSet("res-fission").read_raw<double>(res_fission->data());
-  }
-  if (grp.exist("res-(n,gamma)")) {
-    grp.getDataSet("res-(n,gamma)").read_raw<double>(res_n_gamma->data());
+    const auto ds = grp.getDataSet("res-(n,gamma)");
+    const auto ng_dims = ds.getDimensions();
+    res_n_gamma =
+        read_array<NDReal, 3>(ds, {ng_dims[0], ng_dims[1], ng_dims[2]});
   }
 }
 
 void NuclideHandle::unload() {
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+
+  loaded_flag.set(false);
+  shared_data = nullptr;
+
   packing = nullptr;
 
   chi = nullptr;
@@ -234,12 +274,15 @@ void NuclideHandle::unload() {
 
 NDLibrary::NDLibrary()
     : nuclide_handles_(),
+      nuclide_ids_(),
       group_bounds_(),
       condensation_scheme_(std::nullopt),
       cmfd_condensation_scheme_(std::nullopt),
       library_(),
       group_structure_(),
       ngroups_(0),
+      fname_(),
+      uid_(next_library_uid()),
       h5_(nullptr),
       depletion_chain_(nullptr) {
   // Get the environment variable
@@ -262,6 +305,8 @@ NDLibrary::NDLibrary()
   }
 
   // Open the HDF5 file
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  fname_ = std::filesystem::canonical(fname).string();
   h5_ = std::make_shared<H5::File>(fname, H5::File::ReadOnly);
 
   this->init();
@@ -269,12 +314,15 @@ NDLibrary::NDLibrary()
 
 NDLibrary::NDLibrary(const std::string& fname)
     : nuclide_handles_(),
+      nuclide_ids_(),
       group_bounds_(),
       condensation_scheme_(std::nullopt),
       cmfd_condensation_scheme_(std::nullopt),
       library_(),
       group_structure_(),
       ngroups_(0),
+      fname_(),
+      uid_(next_library_uid()),
       h5_(nullptr),
       depletion_chain_(nullptr) {
   // Make sure HDF5 file exists
@@ -286,6 +334,8 @@ NDLibrary::NDLibrary(const std::string& fname)
   }
 
   // Open the HDF5 file
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  fname_ = std::filesystem::canonical(fname).string();
   h5_ = std::make_shared<H5::File>(fname, H5::File::ReadOnly);
 
   this->init();
@@ -389,8 +439,9 @@ void NDLibrary::init() {
 
     auto grp = h5_->getGroup(nuc);
 
-    nuclide_handles_.emplace(std::make_pair(nuc, NuclideHandle()));
-    auto& handle = nuclide_handles_.at(nuc);
+    nuclide_ids_.emplace(nuc, nuclide_handles_.size());
+    nuclide_handles_.emplace_back();
+    auto& handle = nuclide_handles_.back();
     handle.name = nuc;
 
     // Read nuclide info
@@ -436,39 +487,389 @@ void NDLibrary::init() {
   }
 }
 
-const NuclideHandle& NDLibrary::get_nuclide(const std::string& name) const {
-  if (name == "depletion-chain" ||
-      nuclide_handles_.find(name) == nuclide_handles_.end()) {
+std::size_t NDLibrary::nuclide_id(const std::string& name) const {
+  const auto it = nuclide_ids_.find(name);
+  if (it == nuclide_ids_.end()) {
     std::stringstream mssg;
     mssg << "Could not find nuclide by name of \"" << name << "\".";
     spdlog::error(mssg.str());
     throw ScarabeeException(mssg.str());
   }
 
-  return nuclide_handles_.at(name);
+  return it->second;
+}
+
+const NuclideHandle& NDLibrary::get_nuclide(const std::string& name) const {
+  return nuclide_handles_[this->nuclide_id(name)];
 }
 
 NuclideHandle& NDLibrary::get_nuclide(const std::string& name) {
-  if (name == "depletion-chain" ||
-      nuclide_handles_.find(name) == nuclide_handles_.end()) {
-    std::stringstream mssg;
-    mssg << "Could not find nuclide by name of \"" << name << "\".";
-    spdlog::error(mssg.str());
-    throw ScarabeeException(mssg.str());
+  return nuclide_handles_[this->nuclide_id(name)];
+}
+
+namespace {
+
+// Records of the binary library file. The header is followed by one
+// NDBinaryNuclide for each nuclide, and then by the arrays. Each array
+// starts on a multiple of ND_BINARY_ALIGNMENT bytes.
+constexpr std::uint64_t ND_BINARY_MAGIC = 0x5952415242494C4EULL;
+constexpr std::uint32_t ND_BINARY_VERSION = 2;
+constexpr std::size_t ND_BINARY_ALIGNMENT = 64;
+constexpr std::size_t ND_BINARY_NAME_LENGTH = 64;
+
+// All arrays of a NuclideHandle, in the order they are stored
+constexpr std::array<std::shared_ptr<const NDArray<NDReal, 1>> NuclideHandle::*,
+                     2>
+    ND_BINARY_1D{&NuclideHandle::chi, &NuclideHandle::nu};
+constexpr std::array<std::shared_ptr<const NDArray<NDReal, 2>> NuclideHandle::*,
+                     12>
+    ND_BINARY_2D{&NuclideHandle::inf_absorption,
+                 &NuclideHandle::inf_transport_correction,
+                 &NuclideHandle::inf_scatter,
+                 &NuclideHandle::inf_p1_scatter,
+                 &NuclideHandle::inf_p2_scatter,
+                 &NuclideHandle::inf_p3_scatter,
+                 &NuclideHandle::inf_fission,
+                 &NuclideHandle::inf_n_gamma,
+                 &NuclideHandle::inf_n_2n,
+                 &NuclideHandle::inf_n_3n,
+                 &NuclideHandle::inf_n_a,
+                 &NuclideHandle::inf_n_p};
+constexpr std::array<std::shared_ptr<const NDArray<NDReal, 3>> NuclideHandle::*,
+                     8>
+    ND_BINARY_3D{&NuclideHandle::res_absorption,
+                 &NuclideHandle::res_transport_correction,
+                 &NuclideHandle::res_scatter,
+                 &NuclideHandle::res_p1_scatter,
+                 &NuclideHandle::res_p2_scatter,
+                 &NuclideHandle::res_p3_scatter,
+                 &NuclideHandle::res_fission,
+                 &NuclideHandle::res_n_gamma};
+constexpr std::size_t ND_BINARY_NARRAYS =
+    1 + ND_BINARY_1D.size() + ND_BINARY_2D.size() + ND_BINARY_3D.size();
+
+// The size of the stored floating point values must match the NDReal of
+// the build mapping the file.
+struct NDBinaryHeader {
+  std::uint64_t magic;
+  std::uint32_t version;
+  std::uint32_t narrays;
+  std::uint64_t ngroups;
+  std::uint64_t nnuclides;
+  std::uint32_t real_size;
+  std::uint32_t reserved;
+};
+
+// An offset of zero means the nuclide does not have the array
+struct NDBinaryArray {
+  std::uint64_t offset;
+  std::uint64_t shape[3];
+};
+
+struct NDBinaryNuclide {
+  char name[ND_BINARY_NAME_LENGTH];
+  NDBinaryArray arrays[ND_BINARY_NARRAYS];
+};
+
+template <typename T, std::size_t N>
+NDBinaryArray write_binary_array(
+    std::ofstream& file, const std::shared_ptr<const NDArray<T, N>>& arr) {
+  NDBinaryArray rec{};
+  if (arr == nullptr) return rec;
+
+  const std::size_t pos = static_cast<std::size_t>(file.tellp());
+  const std::size_t pad =
+      (ND_BINARY_ALIGNMENT - pos % ND_BINARY_ALIGNMENT) % ND_BINARY_ALIGNMENT;
+  const std::array<char, ND_BINARY_ALIGNMENT> zeros{};
+  file.write(zeros.data(), static_cast<std::streamsize>(pad));
+
+  rec.offset = pos + pad;
+  for (std::size_t i = 0; i < N; i++) rec.shape[i] = arr->shape()[i];
+  file.write(reinterpret_cast<const char*>(arr->data()),
+             static_cast<std::streamsize>(arr->size() * sizeof(T)));
+  return rec;
+}
+
+template <typename T, std::size_t N>
+std::shared_ptr<const NDArray<T, N>> map_binary_array(
+    const std::shared_ptr<const MappedFile>& file, const NDBinaryArray& rec,
+    const std::string& fname) {
+  if (rec.offset == 0) return nullptr;
+
+  std::array<std::size_t, N> shape;
+  std::size_t size = 1;
+  for (std::size_t i = 0; i < N; i++) {
+    shape[i] = static_cast<std::size_t>(rec.shape[i]);
+    size *= shape[i];
+  }
+
+  if (rec.offset % ND_BINARY_ALIGNMENT != 0 || rec.offset > file->size() ||
+      size > (file->size() - rec.offset) / sizeof(T)) {
+    const auto mssg = "The binary library \"" + fname + "\" is corrupted.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  return make_array<T, N>(file,
+                          reinterpret_cast<const T*>(file->data() + rec.offset),
+                          shape);
+}
+
+}  // namespace
+
+void NDLibrary::save_binary(const std::string& fname) const {
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+
+  std::ofstream file(fname, std::ios_base::binary);
+  if (!file) {
+    const auto mssg = "Could not open the file \"" + fname + "\".";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  NDBinaryHeader header{};
+  header.magic = ND_BINARY_MAGIC;
+  header.version = ND_BINARY_VERSION;
+  header.narrays = ND_BINARY_NARRAYS;
+  header.ngroups = ngroups_;
+  header.nnuclides = nuclide_handles_.size();
+  header.real_size = sizeof(NDReal);
+
+  // The index is written once all the arrays have been placed
+  std::vector<NDBinaryNuclide> index(nuclide_handles_.size(),
+                                     NDBinaryNuclide{});
+  file.write(reinterpret_cast<const char*>(&header), sizeof(NDBinaryHeader));
+  file.write(reinterpret_cast<const char*>(index.data()),
+             static_cast<std::streamsize>(index.size() *
+                                          sizeof(NDBinaryNuclide)));
+
+  std::size_t n = 0;
+  for (const auto& handle : nuclide_handles_) {
+    const std::string& name = handle.name;
+    if (name.size() >= ND_BINARY_NAME_LENGTH) {
+      std::stringstream mssg;
+      mssg << "Nuclide name \"" << name
+           << "\" is too long for the binary library.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+
+    // Read all Legendre moments, whatever is currently loaded
+    NuclideHandle nuc = handle;
+    const auto grp = h5_->getGroup(name);
+    nuc.load_inf_data(*this, grp, 3);
+    if (nuc.resonant) nuc.load_res_data(grp, 3);
+
+    auto& rec = index[n++];
+    std::memcpy(rec.name, name.data(), name.size());
+    std::size_t a = 0;
+    rec.arrays[a++] = write_binary_array(file, nuc.packing);
+    for (const auto arr : ND_BINARY_1D)
+      rec.arrays[a++] = write_binary_array(file, nuc.*arr);
+    for (const auto arr : ND_BINARY_2D)
+      rec.arrays[a++] = write_binary_array(file, nuc.*arr);
+    for (const auto arr : ND_BINARY_3D)
+      rec.arrays[a++] = write_binary_array(file, nuc.*arr);
+  }
+
+  file.seekp(sizeof(NDBinaryHeader));
+  file.write(reinterpret_cast<const char*>(index.data()),
+             static_cast<std::streamsize>(index.size() *
+                                          sizeof(NDBinaryNuclide)));
+
+  if (!file) {
+    const auto mssg = "Could not write the binary library \"" + fname + "\".";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+void NDLibrary::map_binary(const std::string& fname) {
+  this->wait_prefetch();
+
+  auto file = std::make_shared<const MappedFile>(fname);
+
+  NDBinaryHeader header{};
+  if (file->size() >= sizeof(NDBinaryHeader)) {
+    std::memcpy(&header, file->data(), sizeof(NDBinaryHeader));
+  }
+  if (header.magic != ND_BINARY_MAGIC || header.version != ND_BINARY_VERSION ||
+      header.narrays != ND_BINARY_NARRAYS || header.ngroups != ngroups_ ||
+      header.nnuclides != nuclide_handles_.size() ||
+      header.real_size != sizeof(NDReal) ||
+      file->size() < sizeof(NDBinaryHeader) +
+                         header.nnuclides * sizeof(NDBinaryNuclide)) {
+    const auto mssg = "The file \"" + fname +
+                      "\" is not a binary library for this nuclear data "
+                      "library.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
   }
 
-  return nuclide_handles_.at(name);
+  // All views are made before any handle is modified, so that a corrupted
+  // file leaves the library unchanged
+  std::vector<std::pair<NuclideHandle*, NuclideHandle>> mapped;
+  mapped.reserve(header.nnuclides);
+  const char* ptr = file->data() + sizeof(NDBinaryHeader);
+  for (std::size_t n = 0; n < header.nnuclides; n++) {
+    NDBinaryNuclide rec;
+    std::memcpy(&rec, ptr, sizeof(NDBinaryNuclide));
+    ptr += sizeof(NDBinaryNuclide);
+
+    const std::string name(
+        rec.name, std::find(rec.name, rec.name + ND_BINARY_NAME_LENGTH, '\0'));
+    auto& handle = this->get_nuclide(name);
+    NuclideHandle nuc;
+    std::size_t a = 0;
+    nuc.packing =
+        map_binary_array<std::uint32_t, 2>(file, rec.arrays[a++], fname);
+    for (const auto arr : ND_BINARY_1D)
+      nuc.*arr = map_binary_array<NDReal, 1>(file, rec.arrays[a++], fname);
+    for (const auto arr : ND_BINARY_2D)
+      nuc.*arr = map_binary_array<NDReal, 2>(file, rec.arrays[a++], fname);
+    for (const auto arr : ND_BINARY_3D)
+      nuc.*arr = map_binary_array<NDReal, 3>(file, rec.arrays[a++], fname);
+    mapped.emplace_back(&handle, std::move(nuc));
+  }
+
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  for (auto& [handle, nuc] : mapped) {
+    handle->packing = nuc.packing;
+    for (const auto arr : ND_BINARY_1D) (*handle).*arr = nuc.*arr;
+    for (const auto arr : ND_BINARY_2D) (*handle).*arr = nuc.*arr;
+    for (const auto arr : ND_BINARY_3D) (*handle).*arr = nuc.*arr;
+    handle->shared_data = nullptr;
+    handle->loaded_flag.set(true);
+  }
+}
+
+NDLibrary::~NDLibrary() {
+  // Prefetches still reading the file must finish first, and their errors
+  // are dropped
+  for (auto& f : prefetches_) {
+    if (f.valid()) f.wait();
+  }
+
+  // The file must also be closed under the HDF5 lock
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  h5_ = nullptr;
+}
+
+void NDLibrary::load_nuclides(const std::vector<std::string>& names,
+                              std::size_t max_l) {
+  for (const auto& name : names) {
+    this->get_nuclide(name).load_xs_from_hdf5(*this, max_l);
+  }
+}
+
+void NDLibrary::prefetch(const std::vector<std::string>& names,
+                         std::size_t max_l) {
+  std::vector<std::size_t> ids;
+  ids.reserve(names.size());
+  for (const auto& name : names) ids.push_back(this->nuclide_id(name));
+
+  auto f = std::async(std::launch::async,
+                      [this, ids = std::move(ids), max_l]() {
+                        for (const auto id : ids) {
+                          nuclide_handles_[id].load_xs_from_hdf5(*this, max_l);
+                        }
+                      });
+
+  std::lock_guard<std::mutex> lock(prefetch_mtx_);
+  prefetches_.push_back(std::move(f));
+}
+
+void NDLibrary::wait_prefetch() {
+  std::vector<std::future<void>> prefetches;
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mtx_);
+    std::swap(prefetches, prefetches_);
+  }
+
+  // All prefetches are waited for before the first error is raised
+  std::exception_ptr error;
+  for (auto& f : prefetches) {
+    try {
+      f.get();
+    } catch (...) {
+      if (error == nullptr) error = std::current_exception();
+    }
+  }
+
+  if (error) {
+    try {
+      std::rethrow_exception(error);
+    } catch (const std::exception& e) {
+      spdlog::error(e.what());
+      throw;
+    }
+  }
+}
+
+bool NDLibrary::prefetching() const {
+  std::lock_guard<std::mutex> lock(prefetch_mtx_);
+  for (const auto& f : prefetches_) {
+    if (f.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void NDLibrary::unload() {
+  this->wait_prefetch();
+
   for (auto& nuc_handle : nuclide_handles_) {
-    nuc_handle.second.unload();
+    nuc_handle.unload();
   }
 }
 
+namespace {
+
+template <typename T, std::size_t N>
+std::size_t nd_bytes(const std::shared_ptr<const NDArray<T, N>>& a) {
+  return a ? a->size() * sizeof(T) : 0;
+}
+
+}  // namespace
+
+MemoryUsage NDLibrary::memory_usage() const {
+  MemoryUsage usage;
+  usage["infinite_dilution"] = 0;
+  usage["resonance"] = 0;
+  usage["other"] = 0;
+  for (const auto& nuc : nuclide_handles_) {
+    if (nuc.loaded() == false) continue;
+
+    usage["infinite_dilution"] +=
+        nd_bytes(nuc.inf_absorption) + nd_bytes(nuc.inf_transport_correction) +
+        nd_bytes(nuc.inf_scatter) + nd_bytes(nuc.inf_p1_scatter) +
+        nd_bytes(nuc.inf_p2_scatter) + nd_bytes(nuc.inf_p3_scatter) +
+        nd_bytes(nuc.inf_fission) + nd_bytes(nuc.inf_n_gamma) +
+        nd_bytes(nuc.inf_n_2n) + nd_bytes(nuc.inf_n_3n) +
+        nd_bytes(nuc.inf_n_a) + nd_bytes(nuc.inf_n_p);
+
+    usage["resonance"] +=
+        nd_bytes(nuc.res_absorption) + nd_bytes(nuc.res_transport_correction) +
+        nd_bytes(nuc.res_scatter) + nd_bytes(nuc.res_p1_scatter) +
+        nd_bytes(nuc.res_p2_scatter) + nd_bytes(nuc.res_p3_scatter) +
+        nd_bytes(nuc.res_fission) + nd_bytes(nuc.res_n_gamma);
+
+    usage["other"] +=
+        nd_bytes(nuc.packing) + nd_bytes(nuc.chi) + nd_bytes(nuc.nu);
+  }
+  return usage;
+}
+
 std::pair<MicroNuclideXS, MicroDepletionXS> NDLibrary::infinite_dilution_xs(
     const std::string& name, const double temp, std::size_t max_l) {
-  auto& nuc = this->get_nuclide(name);
+  return this->infinite_dilution_xs(this->nuclide_id(name), temp, max_l);
+}
+
+std::pair<MicroNuclideXS, MicroDepletionXS> NDLibrary::infinite_dilution_xs(
+    std::size_t id, const double temp, std::size_t max_l) {
+  SCARABEE_PROFILE_ZONE("NDLibrary::infinite_dilution_xs");
+  auto& nuc = this->get_nuclide(id);
 
   // Get temperature interpolation factors
   std::size_t it = 0;  // temperature index
@@ -523,7 +924,7 @@ std::pair<MicroNuclideXS, MicroDepletionXS> NDLibrary::infinite_dilution_xs(
     this->interp_temp(temp_EsPl, *nuc.inf_p3_scatter, it, f_temp);
     xt::view(Es, 3, xt::all()) = temp_EsPl;
   }
-  XS2D Es_xs2d(Es, *nuc.packing);
+  XS2D Es_xs2d(Es, xt::xtensor<std::uint32_t, 2>(*nuc.packing));
 
   //--------------------------------------------------------
   // Do fission interpolation
@@ -596,7 +997,15 @@ std::pair<MicroNuclideXS, MicroDepletionXS> NDLibrary::infinite_dilution_xs(
 ResonantOneGroupXS NDLibrary::dilution_xs(const std::string& name,
                                           std::size_t g, const double temp,
                                           const double dil, std::size_t max_l) {
-  auto& nuc = this->get_nuclide(name);
+  return this->dilution_xs(this->nuclide_id(name), g, temp, dil, max_l);
+}
+
+ResonantOneGroupXS NDLibrary::dilution_xs(std::size_t id, std::size_t g,
+                                          const double temp, const double dil,
+                                          std::size_t max_l) {
+  SCARABEE_PROFILE_ZONE("NDLibrary::dilution_xs");
+  auto& nuc = this->get_nuclide(id);
+  const std::string& name = nuc.name;
 
   // Make sure nuclide is resonant
   if (nuc.resonant == false) {
@@ -711,7 +1120,34 @@ ResonantOneGroupXS NDLibrary::two_term_xs(const std::string& name,
                                           const double bg_xs_1,
                                           const double bg_xs_2,
                                           std::size_t max_l) {
-  auto& nuc = this->get_nuclide(name);
+  return this->two_term_xs(this->nuclide_id(name), g, temp, b1, b2, bg_xs_1,
+                           bg_xs_2, max_l);
+}
+
+ResonantOneGroupXS NDLibrary::two_term_xs(std::size_t id, std::size_t g,
+                                          const double temp, const double b1,
+                                          const double b2, const double bg_xs_1,
+                                          const double bg_xs_2,
+                                          std::size_t max_l) {
+  if (xs_cache_ == false) {
+    return interp_two_term_xs(id, g, temp, b1, b2, bg_xs_1, bg_xs_2, max_l);
+  }
+
+  auto key = xs_cache_key(id, g, max_l, {temp, b1, b2, bg_xs_1, bg_xs_2});
+  if (auto xs = find_cached_xs(key)) return std::move(*xs);
+
+  auto out = interp_two_term_xs(id, g, temp, b1, b2, bg_xs_1, bg_xs_2, max_l);
+  cache_xs(std::move(key), out);
+  return out;
+}
+
+ResonantOneGroupXS NDLibrary::interp_two_term_xs(
+    std::size_t id, std::size_t g, const double temp, const double b1,
+    const double b2, const double bg_xs_1, const double bg_xs_2,
+    std::size_t max_l) {
+  SCARABEE_PROFILE_ZONE("NDLibrary::two_term_xs");
+  auto& nuc = this->get_nuclide(id);
+  const std::string& name = nuc.name;
 
   // Make sure nuclide is resonant
   if (nuc.resonant == false) {
@@ -734,8 +1170,8 @@ ResonantOneGroupXS NDLibrary::two_term_xs(const std::string& name,
   // addition to the calculation of the flux based on the pot_xs and sig_a.
 
   // Get the two cross section sets
-  const auto xs_1 = dilution_xs(name, g, temp, bg_xs_1, max_l);
-  const auto xs_2 = dilution_xs(name, g, temp, bg_xs_2, max_l);
+  const auto xs_1 = dilution_xs(id, g, temp, bg_xs_1, max_l);
+  const auto xs_2 = dilution_xs(id, g, temp, bg_xs_2, max_l);
   const double ir_lambda = nuc.ir_lambda[g];
   const double lmbd_pot_xs = ir_lambda * nuc.potential_xs;
   const double lmbd_Es1 =
@@ -777,6 +1213,36 @@ ResonantOneGroupXS NDLibrary::ring_two_term_xs(
     const double a2, const double b1, const double b2, const double mat_pot_xs,
     const double N, const double Rfuel, const double Rin, const double Rout,
     std::size_t max_l) {
+  return this->ring_two_term_xs(this->nuclide_id(name), g, temp, a1, a2, b1,
+                                b2, mat_pot_xs, N, Rfuel, Rin, Rout, max_l);
+}
+
+ResonantOneGroupXS NDLibrary::ring_two_term_xs(
+    std::size_t id, std::size_t g, const double temp, const double a1,
+    const double a2, const double b1, const double b2, const double mat_pot_xs,
+    const double N, const double Rfuel, const double Rin, const double Rout,
+    std::size_t max_l) {
+  if (xs_cache_ == false) {
+    return interp_ring_two_term_xs(id, g, temp, a1, a2, b1, b2, mat_pot_xs, N,
+                                   Rfuel, Rin, Rout, max_l);
+  }
+
+  auto key = xs_cache_key(
+      id, g, max_l, {temp, a1, a2, b1, b2, mat_pot_xs, N, Rfuel, Rin, Rout});
+  if (auto xs = find_cached_xs(key)) return std::move(*xs);
+
+  auto out = interp_ring_two_term_xs(id, g, temp, a1, a2, b1, b2, mat_pot_xs,
+                                     N, Rfuel, Rin, Rout, max_l);
+  cache_xs(std::move(key), out);
+  return out;
+}
+
+ResonantOneGroupXS NDLibrary::interp_ring_two_term_xs(
+    std::size_t id, std::size_t g, const double temp, const double a1,
+    const double a2, const double b1, const double b2, const double mat_pot_xs,
+    const double N, const double Rfuel, const double Rin, const double Rout,
+    std::size_t max_l) {
+  SCARABEE_PROFILE_ZONE("NDLibrary::ring_two_term_xs");
   if (Rin >= Rout) {
     auto mssg = "Rin must be < Rout.";
     spdlog::error(mssg);
@@ -789,7 +1255,7 @@ ResonantOneGroupXS NDLibrary::ring_two_term_xs(
     throw ScarabeeException(mssg);
   }
 
-  const auto& nuclide = get_nuclide(name);
+  const auto& nuclide = get_nuclide(id);
   const double ir_lambda = nuclide.ir_lambda[g];
   const double lmbd_pot_xs = ir_lambda * nuclide.potential_xs;
   const double macro_lmbd_pot_xs = N * lmbd_pot_xs;
@@ -817,8 +1283,8 @@ ResonantOneGroupXS NDLibrary::ring_two_term_xs(
         l_m > 0. ? (mat_pot_xs - macro_lmbd_pot_xs + a2 / l_m) / N : 1.E10;
 
     // Get the two cross section sets
-    const auto xs_1 = dilution_xs(name, g, temp, bg_xs_1, max_l);
-    const auto xs_2 = dilution_xs(name, g, temp, bg_xs_2, max_l);
+    const auto xs_1 = dilution_xs(id, g, temp, bg_xs_1, max_l);
+    const auto xs_2 = dilution_xs(id, g, temp, bg_xs_2, max_l);
     const double lmbd_Es1 =
         ir_lambda * xt::sum(xt::view(xs_1.Es, 0, xt::all()))();
     const double lmbd_Es2 =
@@ -869,28 +1335,260 @@ ResonantOneGroupXS NDLibrary::ring_two_term_xs(
   return out;
 }
 
+void NDLibrary::set_xs_cache(bool cache) {
+  xs_cache_ = cache;
+  if (xs_cache_ == false) clear_xs_cache();
+}
+
+void NDLibrary::set_xs_cache_tolerance(double tol) {
+  if (tol < 0. || tol >= 1.) {
+    auto mssg = "Cross section cache tolerance must be in [0, 1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Keys quantized with the old tolerance are no longer comparable
+  xs_cache_tol_ = tol;
+  clear_xs_cache();
+}
+
+void NDLibrary::clear_xs_cache() {
+  std::lock_guard<std::mutex> lock(xs_cache_mtx_);
+  xs_cache_map_.clear();
+  xs_cache_hits_ = 0;
+}
+
+std::size_t NDLibrary::xs_cache_size() const {
+  std::lock_guard<std::mutex> lock(xs_cache_mtx_);
+  return xs_cache_map_.size();
+}
+
+std::size_t NDLibrary::xs_cache_hits() const {
+  std::lock_guard<std::mutex> lock(xs_cache_mtx_);
+  return xs_cache_hits_;
+}
+
+std::size_t NDLibrary::XSCacheKeyHash::operator()(
+    const XSCacheKey& key) const {
+  std::size_t h = std::hash<std::size_t>{}(key.id);
+  const auto combine = [&h](std::size_t v) {
+    h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+  };
+  combine(key.g);
+  combine(key.max_l);
+  for (const auto p : key.params) combine(std::hash<std::int64_t>{}(p));
+  return h;
+}
+
+NDLibrary::XSCacheKey NDLibrary::xs_cache_key(
+    std::size_t id, std::size_t g, std::size_t max_l,
+    std::initializer_list<double> params) const {
+  XSCacheKey key{id, g, max_l, {}};
+  key.params.reserve(params.size());
+
+  // Each parameter is rounded to a bin of logarithmic width, so that values
+  // in one bin differ by at most the relative tolerance. Values straddling
+  // a bin edge only miss the cache. The sign is kept in the lowest bit, and
+  // zero and infinite values get their own keys, which are never bins.
+  const double log_width = std::log1p(xs_cache_tol_);
+  for (const double x : params) {
+    std::int64_t q;
+    if (xs_cache_tol_ == 0.) {
+      std::memcpy(&q, &x, sizeof(q));
+    } else if (x == 0.) {
+      q = 2;
+    } else if (std::isfinite(x) == false) {
+      q = x > 0. ? 3 : 6;
+    } else {
+      q = 4 * std::llround(std::log(std::abs(x)) / log_width);
+      if (x < 0.) q++;
+    }
+    key.params.push_back(q);
+  }
+
+  return key;
+}
+
+std::optional<ResonantOneGroupXS> NDLibrary::find_cached_xs(
+    const XSCacheKey& key) {
+  std::lock_guard<std::mutex> lock(xs_cache_mtx_);
+  const auto it = xs_cache_map_.find(key);
+  if (it == xs_cache_map_.end()) return std::nullopt;
+  xs_cache_hits_++;
+  return it->second;
+}
+
+void NDLibrary::cache_xs(XSCacheKey&& key, const ResonantOneGroupXS& xs) {
+  std::lock_guard<std::mutex> lock(xs_cache_mtx_);
+  xs_cache_map_.emplace(std::move(key), xs);
+}
+
+void NDLibrary::dilution_xs_batch(std::span<const DilutionQuery> queries,
+                                  xt::xtensor<double, 2>& out) {
+  SCARABEE_PROFILE_ZONE("NDLibrary::dilution_xs_batch");
+  const std::size_t nq = queries.size();
+
+  if (out.shape()[0] != 5 || out.shape()[1] != nq) {
+    std::stringstream mssg;
+    mssg << "The output of dilution_xs_batch must have a shape of (5, " << nq
+         << ").";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  if (nq == 0) return;
+
+  // For each query, the flat (temperature, dilution) indices of the four
+  // tabulated points surrounding it, and their bilinear weights. Setting
+  // these up first leaves the evaluation loops below free of branches, so
+  // that they may be vectorized.
+  std::vector<std::array<std::size_t, 4>> corners(nq);
+  std::vector<std::array<double, 4>> weights(nq);
+
+  double* Dtr = &out(0, 0);
+  double* Ea = &out(1, 0);
+  double* Ef = &out(2, 0);
+  double* n_gamma = &out(3, 0);
+  double* Es = &out(4, 0);
+
+  std::size_t q = 0;
+  while (q < nq) {
+    const std::size_t nuc_id = queries[q].nuclide;
+    std::size_t q_end = q + 1;
+    while (q_end < nq && queries[q_end].nuclide == nuc_id) q_end++;
+
+    if (nuc_id >= nuclide_handles_.size()) {
+      std::stringstream mssg;
+      mssg << "Invalid nuclide ID " << nuc_id << ".";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+
+    auto& nuc = this->get_nuclide(nuc_id);
+
+    // Make sure nuclide is resonant
+    if (nuc.resonant == false) {
+      std::stringstream mssg;
+      mssg << "Nuclide " << nuc.name
+           << " is not resonant. Cannot obtain dilution cross section.";
+      spdlog::error(mssg.str());
+      throw ScarabeeException(mssg.str());
+    }
+
+    if (nuc.loaded() == false) {
+      nuc.load_xs_from_hdf5(*this, 1);
+    }
+
+    const std::size_t ntemps = nuc.temperatures.size();
+    const std::size_t ndils = nuc.dilutions.size();
+
+    // Queries of one nuclide usually share their temperature, in which case
+    // its bracket is only searched for once
+    double last_temp = -1.;
+    std::size_t it = 0;
+    double f_temp = 0.;
+    for (std::size_t k = q; k < q_end; k++) {
+      const auto& qk = queries[k];
+
+      if (qk.group < first_resonant_group_ || last_resonant_group_ < qk.group) {
+        std::stringstream mssg;
+        mssg << "Group index " << qk.group
+             << " is not in the resonant region of the library.";
+        spdlog::error(mssg.str());
+        throw ScarabeeException(mssg.str());
+      }
+
+      if (k == q || qk.temperature != last_temp) {
+        get_temp_interp_params(qk.temperature, nuc, it, f_temp);
+        last_temp = qk.temperature;
+      }
+
+      std::size_t id = 0;
+      double f_dil = 0.;
+      get_dil_interp_params(qk.dilution, nuc, id, f_dil);
+
+      const std::size_t it1 = std::min(it + 1, ntemps - 1);
+      const std::size_t id1 = std::min(id + 1, ndils - 1);
+      corners[k] = {it * ndils + id, it * ndils + id1, it1 * ndils + id,
+                    it1 * ndils + id1};
+      weights[k] = {(1. - f_temp) * (1. - f_dil), (1. - f_temp) * f_dil,
+                    f_temp * (1. - f_dil), f_temp * f_dil};
+    }
+
+    // All single valued tables share the (temperature, dilution, group)
+    // layout of the absorption table
+    const std::size_t nres = nuc.res_absorption->shape()[2];
+    const auto interp = [&](const NDArray<NDReal, 3>* table, double* E) {
+      if (table == nullptr) {
+        std::fill(E + q, E + q_end, 0.);
+        return;
+      }
+
+      const NDReal* T = table->data();
+      for (std::size_t k = q; k < q_end; k++) {
+        const std::size_t g_res = queries[k].group - first_resonant_group_;
+        const auto& c = corners[k];
+        const auto& w = weights[k];
+        E[k] = w[0] * T[c[0] * nres + g_res] + w[1] * T[c[1] * nres + g_res] +
+               w[2] * T[c[2] * nres + g_res] + w[3] * T[c[3] * nres + g_res];
+      }
+    };
+
+    interp(nuc.res_transport_correction.get(), Dtr);
+    interp(nuc.res_absorption.get(), Ea);
+    interp(nuc.res_fission.get(), Ef);
+    interp(nuc.res_n_gamma.get(), n_gamma);
+
+    // The P0 scattering is summed over the packed outgoing groups, which are
+    // contiguous for each corner
+    const auto& packing = *nuc.packing;
+    const std::size_t nscat = nuc.res_scatter->shape()[2];
+    const NDReal* S = nuc.res_scatter->data();
+    for (std::size_t k = q; k < q_end; k++) {
+      const std::size_t g = queries[k].group;
+      const std::size_t res_start =
+          packing(g, 0) - packing(first_resonant_group_, 0);
+      const std::size_t scat_len = 1 + packing(g, 2) - packing(g, 1);
+      const auto& c = corners[k];
+      const auto& w = weights[k];
+      const NDReal* S0 = S + c[0] * nscat + res_start;
+      const NDReal* S1 = S + c[1] * nscat + res_start;
+      const NDReal* S2 = S + c[2] * nscat + res_start;
+      const NDReal* S3 = S + c[3] * nscat + res_start;
+
+      double sum = 0.;
+      for (std::size_t j = 0; j < scat_len; j++) {
+        sum += w[0] * S0[j] + w[1] * S1[j] + w[2] * S2[j] + w[3] * S3[j];
+      }
+      Es[k] = sum;
+    }
+
+    q = q_end;
+  }
+}
+
 void NDLibrary::get_temp_interp_params(double temp, const NuclideHandle& nuc,
                                        std::size_t& i, double& f) const {
-  if (temp <= nuc.temperatures.front()) {
+  const auto& T = nuc.temperatures;
+  if (temp <= T.front() || T.size() == 1) {
     i = 0;
     f = 0.;
     return;
-  } else if (temp >= nuc.temperatures.back()) {
-    i = nuc.temperatures.size() - 2;
+  } else if (temp >= T.back()) {
+    i = T.size() - 2;
     f = 1.;
     return;
   }
 
-  for (i = 0; i < nuc.temperatures.size() - 1; i++) {
-    double T_i = nuc.temperatures[i];
-    double T_i1 = nuc.temperatures[i + 1];
+  // T.front() < temp < T.back(), so the first tabulated temperature above
+  // temp is never the first or past the last.
+  i = static_cast<std::size_t>(std::upper_bound(T.begin(), T.end(), temp) -
+                               T.begin()) -
+      1;
+  const double T_i = T[i];
+  const double T_i1 = T[i + 1];
+  f = (std::sqrt(temp) - std::sqrt(T_i)) / (std::sqrt(T_i1) - std::sqrt(T_i));
 
-    if (temp >= T_i && temp <= T_i1) {
-      f = (std::sqrt(temp) - std::sqrt(T_i)) /
-          (std::sqrt(T_i1) - std::sqrt(T_i));
-      break;
-    }
-  }
   if (f < 0.)
     f = 0.;
   else if (f > 1.)
@@ -899,25 +1597,24 @@ void NDLibrary::get_temp_interp_params(double temp, const NuclideHandle& nuc,
 
 void NDLibrary::get_dil_interp_params(double dil, const NuclideHandle& nuc,
                                       std::size_t& i, double& f) const {
-  if (dil <= nuc.dilutions.front()) {
+  const auto& D = nuc.dilutions;
+  if (dil <= D.front() || D.size() == 1) {
     i = 0;
     f = 0.;
     return;
-  } else if (dil >= nuc.dilutions.back()) {
-    i = nuc.dilutions.size() - 2;
+  } else if (dil >= D.back()) {
+    i = D.size() - 2;
     f = 1.;
     return;
   }
 
-  for (i = 0; i < nuc.dilutions.size() - 1; i++) {
-    double d_i = nuc.dilutions[i];
-    double d_i1 = nuc.dilutions[i + 1];
+  i = static_cast<std::size_t>(std::upper_bound(D.begin(), D.end(), dil) -
+                               D.begin()) -
+      1;
+  const double d_i = D[i];
+  const double d_i1 = D[i + 1];
+  f = (dil - d_i) / (d_i1 - d_i);
 
-    if (dil >= d_i && dil <= d_i1) {
-      f = (dil - d_i) / (d_i1 - d_i);
-      break;
-    }
-  }
   if (f < 0.)
     f = 0.;
   else if (f > 1.)
@@ -925,7 +1622,7 @@ void NDLibrary::get_dil_interp_params(double dil, const NuclideHandle& nuc,
 }
 
 void NDLibrary::interp_temp(xt::xtensor<double, 1>& E,
-                            const xt::xtensor<double, 2>& nE, std::size_t it,
+                            const NDArray<NDReal, 2>& nE, std::size_t it,
                             double f_temp) const {
   if (f_temp > 0.) {
     E = (1. - f_temp) * xt::view(nE, it, xt::all()) +
@@ -935,7 +1632,7 @@ void NDLibrary::interp_temp(xt::xtensor<double, 1>& E,
   }
 }
 
-double NDLibrary::interp_temp_dil(const xt::xtensor<double, 3>& nE,
+double NDLibrary::interp_temp_dil(const NDArray<NDReal, 3>& nE,
                                   std::size_t g, std::size_t it, double f_temp,
                                   std::size_t id, double f_dil) const {
   double E = 0.;
@@ -3,17 +3,43 @@
 #include <utils/scarabee_exception.hpp>
 #include <utils/timer.hpp>
 #include <utils/constants.hpp>
+#include <utils/profiler.hpp>
+
+#include <Eigen/IterativeLinearSolvers>
 
 #include <cereal/archives/portable_binary.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdarg>
 #include <fstream>
+#include <map>
 #include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace scarabee {
 
+namespace {
+
+// For each node index along one axis, the indices of the grid coordinates
+// which lie in that node
+template <typename ToIndx>
+std::vector<std::vector<std::size_t>> bin_grid_coords(
+    const xt::xtensor<double, 1>& coords, std::size_t nnodes,
+    const ToIndx& to_indx) {
+  std::vector<std::vector<std::size_t>> bins(nnodes);
+  for (std::size_t p = 0; p < coords.size(); p++) {
+    const auto oi = to_indx(coords[p]);
+    if (oi.has_value()) bins[oi.value()].push_back(p);
+  }
+  return bins;
+}
+
+}  // namespace
+
 NEMDiffusionDriver::NEMDiffusionDriver(std::shared_ptr<DiffusionGeometry> geom)
     : geom_(geom), NG_(geom_->ngroups()), NM_(geom_->nmats()) {
   if (geom_ == nullptr) {
@@ -61,9 +87,49 @@ void NEMDiffusionDriver::set_keff_tolerance(double ktol) {
   keff_tol_ = ktol;
 }
 
+void NEMDiffusionDriver::set_inner_iterations(std::size_t ninner) {
+  if (ninner == 0) {
+    auto mssg = "Number of inner iterations must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  inner_iterations_ = ninner;
+}
+
+void NEMDiffusionDriver::set_inner_tolerance(double itol) {
+  if (itol < 0. || itol >= 0.1) {
+    auto mssg = "Tolerance for inner iterations must be in the interval [0., "
+                "0.1).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  inner_tol_ = itol;
+}
+
+void NEMDiffusionDriver::set_wielandt_shift(double shift) {
+  if (shift < 0.) {
+    auto mssg = "Wielandt shift must be positive or zero.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  wielandt_shift_ = shift;
+}
+
 double NEMDiffusionDriver::calc_keff(
     double keff, const xt::xtensor<double, 3>& old_flux,
     const xt::xtensor<double, 3>& new_flux) const {
+  switch (NG_) {
+    case 2:
+      return calc_keff_groups<2>(keff, old_flux, new_flux);
+    case 4:
+      return calc_keff_groups<4>(keff, old_flux, new_flux);
+    default:
+      break;
+  }
+
   double num = 0.;
   double denom = 0.;
 
@@ -85,6 +151,34 @@ double NEMDiffusionDriver::calc_keff(
   return keff * num / denom;
 }
 
+template <std::size_t N>
+double NEMDiffusionDriver::calc_keff_groups(
+    double keff, const xt::xtensor<double, 3>& old_flux,
+    const xt::xtensor<double, 3>& new_flux) const {
+  using Groups = Eigen::Matrix<double, N, 1>;
+
+  double num = 0.;
+  double denom = 0.;
+
+  for (std::size_t m = 0; m < NM_; m++) {
+    const auto geom_indx = geom_inds_[m];
+    const double Vr = geom_->dx(geom_indx[0]) * geom_->dy(geom_indx[1]) *
+                      geom_->dz(geom_indx[2]);
+    const auto& mat = *mats_[m];
+    Groups vEf, nflx, oflx;
+    for (std::size_t g = 0; g < N; g++) {
+      vEf(g) = mat.vEf(g);
+      nflx(g) = new_flux(g, m, MomentIndx::AVG);
+      oflx(g) = old_flux(g, m, MomentIndx::AVG);
+    }
+
+    num += Vr * vEf.dot(nflx);
+    denom += Vr * vEf.dot(oflx);
+  }
+
+  return keff * num / denom;
+}
+
 double NEMDiffusionDriver::calc_flux_error(
     const xt::xtensor<double, 3>& old_flux,
     const xt::xtensor<double, 3>& new_flux) const {
@@ -105,7 +199,31 @@ double NEMDiffusionDriver::calc_flux_error(
 void NEMDiffusionDriver::fill_coupling_matrices() {
   spdlog::info("Loading coupling matrices");
 
+  // Nodes with the same cross sections and dimensions have the same response
+  // matrices, which are then only computed once for each node type.
+  using NodeKey =
+      std::tuple<const DiffusionCrossSection*, double, double, double>;
+  std::map<NodeKey, std::size_t> types;
+  std::vector<std::size_t> type_nodes;  // First node of each type
+  node_types_.resize(NM_);
   for (std::size_t m = 0; m < NM_; m++) {
+    const auto& geom_indx = geom_inds_(m);
+    const NodeKey key{mats_[m].get(), geom_->dx(geom_indx[0]),
+                      geom_->dy(geom_indx[1]), geom_->dz(geom_indx[2])};
+    const auto [it, inserted] = types.emplace(key, types.size());
+    node_types_[m] = it->second;
+    if (inserted) type_nodes.push_back(m);
+  }
+  const std::size_t NT = type_nodes.size();
+  spdlog::info("Number of node types: {}", NT);
+
+  Rmats_.resize({NG_, NT});
+  Pmats_.resize({NG_, NT});
+
+#pragma omp parallel for
+  for (int it = 0; it < static_cast<int>(NT); it++) {
+    const std::size_t t = static_cast<std::size_t>(it);
+    const std::size_t m = type_nodes[t];
     const auto geom_indx = geom_inds_(m);
     const double del_x = geom_->dx(geom_indx[0]);
     const double del_y = geom_->dy(geom_indx[1]);
@@ -181,14 +299,16 @@ void NEMDiffusionDriver::fill_coupling_matrices() {
           {cz, 0., 0., cz1, 0., 0., cz2}, {cz, 0., 0., -cz1, 0., 0., cz2}};
 
       auto Ainvs = A.inverse();
-      Rmats_(g, m) = Ainvs * B;
-      Pmats_(g, m) = Ainvs * C;
+      Rmats_(g, t) = Ainvs * B;
+      Pmats_(g, t) = Ainvs * C;
     }
   }
 }
 
 void NEMDiffusionDriver::fill_mats_adf() {
-  // Save all material cross sections
+  // Save all material cross sections, which may have been replaced in the
+  // geometry since the last solve
+  mats_.clear();
   mats_.reserve(NM_);
   for (std::size_t m = 0; m < NM_; m++) {
     const auto geom_indx = geom_inds_[m];
@@ -210,7 +330,22 @@ void NEMDiffusionDriver::fill_mats_adf() {
   }
 }
 
-void NEMDiffusionDriver::fill_source() {
+void NEMDiffusionDriver::fill_source(const xt::xtensor<double, 3>& fiss_flux,
+                                     double invs_keff, double invs_kshift) {
+  // The fission source of fiss_flux is scaled by invs_keff, while the
+  // scattering source, and the shifted fission source scaled by invs_kshift,
+  // use the latest flux.
+  switch (NG_) {
+    case 2:
+      fill_source_groups<2>(fiss_flux, invs_keff, invs_kshift);
+      return;
+    case 4:
+      fill_source_groups<4>(fiss_flux, invs_keff, invs_kshift);
+      return;
+    default:
+      break;
+  }
+
   for (std::size_t m = 0; m < NM_; m++) {
     const auto& mat = mats_[m];
     for (std::size_t g = 0; g < NG_; g++) {
@@ -218,51 +353,67 @@ void NEMDiffusionDriver::fill_source() {
       Q.fill(0.);
 
       const double chi_g = mat->chi(g);
-      const double invs_keff = 1. / keff_;
 
       for (std::size_t gg = 0; gg < NG_; gg++) {
-        const double vEf_gg = mat->vEf(gg);
-        const double Es_gg_g = mat->Es(gg, g);
-        const double flx_avg = flux_(gg, m, MomentIndx::AVG);
-        const double flx_x1 = flux_(gg, m, MomentIndx::X1);
-        const double flx_x2 = flux_(gg, m, MomentIndx::X2);
-        const double flx_y1 = flux_(gg, m, MomentIndx::Y1);
-        const double flx_y2 = flux_(gg, m, MomentIndx::Y2);
-        const double flx_z1 = flux_(gg, m, MomentIndx::Z1);
-        const double flx_z2 = flux_(gg, m, MomentIndx::Z2);
-
-        Q(MomentIndx::AVG) += invs_keff * chi_g * vEf_gg * flx_avg;
-        if (gg != g) Q(MomentIndx::AVG) += Es_gg_g * flx_avg;
-
-        Q(MomentIndx::X1) += invs_keff * chi_g * vEf_gg * flx_x1;
-        if (gg != g) Q(MomentIndx::X1) += Es_gg_g * flx_x1;
-
-        Q(MomentIndx::X2) += invs_keff * chi_g * vEf_gg * flx_x2;
-        if (gg != g) Q(MomentIndx::X2) += Es_gg_g * flx_x2;
+        const double chi_vEf = chi_g * mat->vEf(gg);
+        const double Es_gg_g = gg != g ? mat->Es(gg, g) : 0.;
 
-        Q(MomentIndx::Y1) += invs_keff * chi_g * vEf_gg * flx_y1;
-        if (gg != g) Q(MomentIndx::Y1) += Es_gg_g * flx_y1;
-
-        Q(MomentIndx::Y2) += invs_keff * chi_g * vEf_gg * flx_y2;
-        if (gg != g) Q(MomentIndx::Y2) += Es_gg_g * flx_y2;
+        for (std::size_t mom = 0; mom < 7; mom++) {
+          const double flx = flux_(gg, m, mom);
+          Q(mom) += invs_keff * chi_vEf * fiss_flux(gg, m, mom) +
+                    (invs_kshift * chi_vEf + Es_gg_g) * flx;
+        }
+      }
+    }
+  }
+}
 
-        Q(MomentIndx::Z1) += invs_keff * chi_g * vEf_gg * flx_z1;
-        if (gg != g) Q(MomentIndx::Z1) += Es_gg_g * flx_z1;
+template <std::size_t N>
+void NEMDiffusionDriver::fill_source_groups(
+    const xt::xtensor<double, 3>& fiss_flux, double invs_keff,
+    double invs_kshift) {
+  // With a fixed number of groups, the moments of all groups of a node fit
+  // in registers, and the group coupling is a small dense product
+  using Moments = Eigen::Matrix<double, N, 7, Eigen::RowMajor>;
+  using Groups = Eigen::Matrix<double, N, 1>;
+  using Scatter = Eigen::Matrix<double, N, N>;
 
-        Q(MomentIndx::Z2) += invs_keff * chi_g * vEf_gg * flx_z2;
-        if (gg != g) Q(MomentIndx::Z2) += Es_gg_g * flx_z2;
+  for (std::size_t m = 0; m < NM_; m++) {
+    const auto& mat = *mats_[m];
+    Moments flx, fiss;
+    Groups chi, vEf;
+    Scatter S;  // S(g, gg) is the scattering from gg to g, out of group
+    for (std::size_t g = 0; g < N; g++) {
+      for (std::size_t mom = 0; mom < 7; mom++) {
+        flx(g, mom) = flux_(g, m, mom);
+        fiss(g, mom) = fiss_flux(g, m, mom);
+      }
+      chi(g) = mat.chi(g);
+      vEf(g) = mat.vEf(g);
+      for (std::size_t gg = 0; gg < N; gg++) {
+        S(g, gg) = gg != g ? mat.Es(gg, g) : 0.;
       }
     }
+
+    const Moments Q =
+        chi * (invs_keff * vEf.transpose() * fiss +
+               invs_kshift * vEf.transpose() * flx) +
+        S * flx;
+    for (std::size_t g = 0; g < N; g++) Q_(g, m) = Q.row(g).transpose();
   }
 }
 
 void NEMDiffusionDriver::fill_neighbors_and_geom_inds() {
   neighbors_.resize({NM_, 6});
+  nb_faces_.resize({NM_, 6});
   geom_inds_.resize({NM_});
 
   // Go through all mats
+  for (auto& nodes : colors_) nodes.clear();
   for (std::size_t m = 0; m < NM_; m++) {
     geom_inds_(m) = geom_->geom_indx(m);
+    const auto& indx = geom_inds_(m);
+    colors_[(indx[0] + indx[1] + indx[2]) % 2].push_back(m);
 
     neighbors_(m, 0) = geom_->neighbor(m, DiffusionGeometry::Neighbor::XP);
     neighbors_(m, 1) = geom_->neighbor(m, DiffusionGeometry::Neighbor::XN);
@@ -270,158 +421,93 @@ void NEMDiffusionDriver::fill_neighbors_and_geom_inds() {
     neighbors_(m, 3) = geom_->neighbor(m, DiffusionGeometry::Neighbor::YN);
     neighbors_(m, 4) = geom_->neighbor(m, DiffusionGeometry::Neighbor::ZP);
     neighbors_(m, 5) = geom_->neighbor(m, DiffusionGeometry::Neighbor::ZN);
+    // The geometry orders the faces as XN, XP, ..., the opposite of the
+    // current indices
+    for (std::size_t f = 0; f < 6; f++) {
+      const auto n = static_cast<DiffusionGeometry::Neighbor>(f ^ 1);
+      nb_faces_(m, f) = static_cast<std::size_t>(geom_->face(m, n).nb_face) ^ 1;
+    }
   }
 }
 
-void NEMDiffusionDriver::update_Jin_from_Jout(std::size_t g, std::size_t m) {
-  // Get neighbor info
-  const auto& n_xp = neighbors_(m, 0);
-  const auto& n_xm = neighbors_(m, 1);
-  const auto& n_yp = neighbors_(m, 2);
-  const auto& n_ym = neighbors_(m, 3);
-  const auto& n_zp = neighbors_(m, 4);
-  const auto& n_zm = neighbors_(m, 5);
-
-  // UPDATE INCOMING CURRENTS IN NEIGHBORING NODES / B.C.
-  // x+ surface
-  if (n_xp.second) {
-    const double a =
-        0.5 * (1. - (adf_(n_xp.second.value(), g, DiffusionData::ADF::XN) /
-                     adf_(m, g, DiffusionData::ADF::XP)));
-
-    j_in_out_(g, n_xp.second.value(), 0)(CurrentIndx::XM) =
-        (1. / (1. - a)) *
-        (j_in_out_(g, m, 1)(CurrentIndx::XP) +
-         a * j_in_out_(g, n_xp.second.value(), 1)(CurrentIndx::XM));
-  } else {
-    const double albedo = n_xp.first.albedo.value();
-    j_in_out_(g, m, 0)(CurrentIndx::XP) =
-        albedo * j_in_out_(g, m, 1)(CurrentIndx::XP);
-  }
-
-  // x- surface
-  if (n_xm.second) {
-    const double a =
-        0.5 * (1. - (adf_(n_xm.second.value(), g, DiffusionData::ADF::XP) /
-                     adf_(m, g, DiffusionData::ADF::XN)));
-
-    j_in_out_(g, n_xm.second.value(), 0)(CurrentIndx::XP) =
-        (1. / (1. - a)) *
-        (j_in_out_(g, m, 1)(CurrentIndx::XM) +
-         a * j_in_out_(g, n_xm.second.value(), 1)(CurrentIndx::XP));
-  } else {
-    const double albedo = n_xm.first.albedo.value();
-    j_in_out_(g, m, 0)(CurrentIndx::XM) =
-        albedo * j_in_out_(g, m, 1)(CurrentIndx::XM);
-  }
-
-  // y+ surface
-  if (n_yp.second) {
-    const double a =
-        0.5 * (1. - (adf_(n_yp.second.value(), g, DiffusionData::ADF::YN) /
-                     adf_(m, g, DiffusionData::ADF::YP)));
-
-    j_in_out_(g, n_yp.second.value(), 0)(CurrentIndx::YM) =
-        (1. / (1. - a)) *
-        (j_in_out_(g, m, 1)(CurrentIndx::YP) +
-         a * j_in_out_(g, n_yp.second.value(), 1)(CurrentIndx::YM));
-  } else {
-    const double albedo = n_yp.first.albedo.value();
-    j_in_out_(g, m, 0)(CurrentIndx::YP) =
-        albedo * j_in_out_(g, m, 1)(CurrentIndx::YP);
-  }
-
-  // y- surface
-  if (n_ym.second) {
-    const double a =
-        0.5 * (1. - (adf_(n_ym.second.value(), g, DiffusionData::ADF::YP) /
-                     adf_(m, g, DiffusionData::ADF::YN)));
-
-    j_in_out_(g, n_ym.second.value(), 0)(CurrentIndx::YP) =
-        (1. / (1. - a)) *
-        (j_in_out_(g, m, 1)(CurrentIndx::YM) +
-         a * j_in_out_(g, n_ym.second.value(), 1)(CurrentIndx::YP));
-  } else {
-    const double albedo = n_ym.first.albedo.value();
-    j_in_out_(g, m, 0)(CurrentIndx::YM) =
-        albedo * j_in_out_(g, m, 1)(CurrentIndx::YM);
-  }
-
-  // z+ surface
-  if (n_zp.second) {
-    const double a =
-        0.5 * (1. - (adf_(n_zp.second.value(), g, DiffusionData::ADF::ZN) /
-                     adf_(m, g, DiffusionData::ADF::ZP)));
+void NEMDiffusionDriver::fill_node_geometry() {
+  constexpr double invs_12 = 1. / 12.;
+  constexpr double invs_20 = 1. / 20.;
 
-    j_in_out_(g, n_zp.second.value(), 0)(CurrentIndx::ZM) =
-        (1. / (1. - a)) *
-        (j_in_out_(g, m, 1)(CurrentIndx::ZP) +
-         a * j_in_out_(g, n_zp.second.value(), 1)(CurrentIndx::ZM));
-  } else {
-    const double albedo = n_zp.first.albedo.value();
-    j_in_out_(g, m, 0)(CurrentIndx::ZP) =
-        albedo * j_in_out_(g, m, 1)(CurrentIndx::ZP);
+  node_geoms_.resize(NM_);
+  for (std::size_t m = 0; m < NM_; m++) {
+    const auto& indx = geom_inds_(m);
+    NodeGeometry& geo = node_geoms_[m];
+    const std::array<double, 3> d{geom_->dx(indx[0]), geom_->dy(indx[1]),
+                                  geom_->dz(indx[2])};
+    for (std::size_t a = 0; a < 3; a++) geo.invs_d[a] = 1. / d[a];
+
+    for (std::size_t a = 0; a < 3; a++) {
+      LeakageAxis& ax = geo.axes[a];
+      const auto& n_p = neighbors_(m, 2 * a);
+      const auto& n_m = neighbors_(m, 2 * a + 1);
+      ax.interior = n_p.second.has_value() && n_m.second.has_value();
+      if (ax.interior == false) continue;
+
+      ax.np = n_p.second.value();
+      ax.nm = n_m.second.value();
+
+      // Widths of the neighbors, relative to that of the node. Across a face
+      // coupled by rotational symmetry, the x and y axes of the neighbor are
+      // the y and x axes of the node.
+      const std::size_t f_p = nb_faces_(m, 2 * a);
+      const std::size_t f_m = nb_faces_(m, 2 * a + 1);
+      ax.rot_p = f_p / 2 != a;
+      ax.rot_m = f_m / 2 != a;
+      const double d_p = geom_->width(
+          ax.np, static_cast<DiffusionGeometry::Neighbor>(f_p ^ 1));
+      const double d_m = geom_->width(
+          ax.nm, static_cast<DiffusionGeometry::Neighbor>(f_m ^ 1));
+      const double eta_p = d_p * geo.invs_d[a];
+      const double eta_m = d_m * geo.invs_d[a];
+      const double p1m = eta_m + 1.;
+      const double p2m = 2. * eta_m + 1.;
+      const double p1p = eta_p + 1.;
+      const double p2p = 2. * eta_p + 1.;
+      const double invs_denom = 1. / (p1p * p1m * (eta_p + eta_m + 1.));
+
+      ax.w1p = invs_12 * p1m * p2m * invs_denom;
+      ax.w1m = -invs_12 * p1p * p2p * invs_denom;
+      ax.w1 = invs_12 * (p1p * p2p - p1m * p2m) * invs_denom;
+      ax.w2p = invs_20 * p1m * invs_denom;
+      ax.w2m = invs_20 * p1p * invs_denom;
+      ax.w2 = -invs_20 * (eta_p + eta_m + 2.) * invs_denom;
+    }
   }
+}
 
-  // z- surface
-  if (n_zm.second) {
-    const double a =
-        0.5 * (1. - (adf_(n_zm.second.value(), g, DiffusionData::ADF::ZP) /
-                     adf_(m, g, DiffusionData::ADF::ZN)));
-
-    j_in_out_(g, n_zm.second.value(), 0)(CurrentIndx::ZP) =
-        (1. / (1. - a)) *
-        (j_in_out_(g, m, 1)(CurrentIndx::ZM) +
-         a * j_in_out_(g, n_zm.second.value(), 1)(CurrentIndx::ZP));
-  } else {
-    const double albedo = n_zm.first.albedo.value();
-    j_in_out_(g, m, 0)(CurrentIndx::ZM) =
-        albedo * j_in_out_(g, m, 1)(CurrentIndx::ZM);
+void NEMDiffusionDriver::update_Jin_from_Jout(std::size_t g, std::size_t m) {
+  // UPDATE INCOMING CURRENTS IN NEIGHBORING NODES / B.C.
+  // The side of the ADF of a face is that of the current index, flipped.
+  for (std::size_t f = 0; f < 6; f++) {
+    const auto& nb = neighbors_(m, f);
+
+    if (nb.second) {
+      const std::size_t n = nb.second.value();
+      const std::size_t nf = nb_faces_(m, f);
+      const double a = 0.5 * (1. - (adf_(n, g, nf ^ 1) / adf_(m, g, f ^ 1)));
+
+      j_in_out_(g, n, 0)(nf) =
+          (1. / (1. - a)) *
+          (j_in_out_(g, m, 1)(f) + a * j_in_out_(g, n, 1)(nf));
+    } else {
+      const double albedo = nb.first.albedo.value();
+      j_in_out_(g, m, 0)(f) = albedo * j_in_out_(g, m, 1)(f);
+    }
   }
 }
 
 NEMDiffusionDriver::MomentsVector NEMDiffusionDriver::calc_leakage_moments(
     std::size_t g, std::size_t m) const {
-  const auto& Jin = j_in_out_(g, m, 0);
-  const auto& Jout = j_in_out_(g, m, 1);
-
-  // Get the currents along each axis at the positive and negative bounds
-  const double Jxp = calc_net_current(Jin, Jout, CurrentIndx::XP);
-  const double Jxm = calc_net_current(Jin, Jout, CurrentIndx::XM);
-  const double Jyp = calc_net_current(Jin, Jout, CurrentIndx::YP);
-  const double Jym = calc_net_current(Jin, Jout, CurrentIndx::YM);
-  const double Jzp = calc_net_current(Jin, Jout, CurrentIndx::ZP);
-  const double Jzm = calc_net_current(Jin, Jout, CurrentIndx::ZM);
-
-  // Compute average transverse leakages in each direction
-  const double Lx = Jxp - Jxm;
-  const double Ly = Jyp - Jym;
-  const double Lz = Jzp - Jzm;
-
-  // Get neighbor info
-  const auto& n_xp = neighbors_(m, 0);
-  const auto& n_xm = neighbors_(m, 1);
-  const auto& n_yp = neighbors_(m, 2);
-  const auto& n_ym = neighbors_(m, 3);
-  const auto& n_zp = neighbors_(m, 4);
-  const auto& n_zm = neighbors_(m, 5);
-
-  // Obtain geometry spacings for node
-  const auto geom_indxs = geom_inds_(m);
-  const double dx = geom_->dx(geom_indxs[0]);
-  const double dy = geom_->dy(geom_indxs[1]);
-  const double dz = geom_->dz(geom_indxs[2]);
-  const double invs_dx = 1. / dx;
-  const double invs_dy = 1. / dy;
-  const double invs_dz = 1. / dz;
-
-  constexpr double invs_12 = 1. / 12.;
-  constexpr double invs_20 = 1. / 20.;
-
-  // This returns the average transverse leakage moments for a given node
-  auto comp_avg_trans_lks = [this](std::size_t g, std::size_t m) {
-    const auto& Jin = j_in_out_(g, m, 0);
-    const auto& Jout = j_in_out_(g, m, 1);
+  // This returns the average transverse leakages for a given node
+  auto comp_avg_trans_lks = [this, g](std::size_t n) {
+    const auto& Jin = j_in_out_(g, n, 0);
+    const auto& Jout = j_in_out_(g, n, 1);
 
     const double Jxp = calc_net_current(Jin, Jout, CurrentIndx::XP);
     const double Jxm = calc_net_current(Jin, Jout, CurrentIndx::XM);
@@ -430,142 +516,37 @@ NEMDiffusionDriver::MomentsVector NEMDiffusionDriver::calc_leakage_moments(
     const double Jzp = calc_net_current(Jin, Jout, CurrentIndx::ZP);
     const double Jzm = calc_net_current(Jin, Jout, CurrentIndx::ZM);
 
-    const double Lx = Jxp - Jxm;
-    const double Ly = Jyp - Jym;
-    const double Lz = Jzp - Jzm;
-
-    return std::array<double, 3>{Lx, Ly, Lz};
+    return std::array<double, 3>{Jxp - Jxm, Jyp - Jym, Jzp - Jzm};
   };
 
+  const NodeGeometry& geo = node_geoms_[m];
+  const std::array<double, 3> Lc = comp_avg_trans_lks(m);
+
   // Compute net moments
   MomentsVector L;
   L.fill(0.);
 
-  std::array<double, 3> tmp;
-  // x-axis
-  if (n_xp.second && n_xm.second) {
-    const double dx_xp = geom_->dx(geom_indxs[0] + 1);
-    const double dx_xm = geom_->dx(geom_indxs[0] - 1);
-    const double eta_xp = dx_xp * invs_dx;
-    const double eta_xm = dx_xm * invs_dx;
-    const double p1xm = eta_xm + 1.;
-    const double p2xm = 2. * eta_xm + 1.;
-    const double p1xp = eta_xp + 1.;
-    const double p2xp = 2. * eta_xp + 1.;
-    const double invs_denom = 1. / (p1xp * p1xm * (eta_xp + eta_xm + 1.));
-
-    tmp = comp_avg_trans_lks(g, n_xp.second.value());
-    const double Ly_xp = n_xp.second ? tmp[1] : 0.;
-    const double Lz_xp = n_xp.second ? tmp[2] : 0.;
-
-    tmp = comp_avg_trans_lks(g, n_xm.second.value());
-    const double Ly_xm = n_xm.second ? tmp[1] : 0.;
-    const double Lz_xm = n_xm.second ? tmp[2] : 0.;
-
-    const double rho1yx = (p1xm * p2xm * Ly_xp - p1xp * p2xp * Ly_xm +
-                           (p1xp * p2xp - p1xm * p2xm) * Ly) *
-                          invs_denom;
-    const double rho2yx =
-        (p1xm * Ly_xp + p1xp * Ly_xm - (eta_xp + eta_xm + 2.) * Ly) *
-        invs_denom;
-    const double rho1zx = (p1xm * p2xm * Lz_xp - p1xp * p2xp * Lz_xm +
-                           (p1xp * p2xp - p1xm * p2xm) * Lz) *
-                          invs_denom;
-    const double rho2zx =
-        (p1xm * Lz_xp + p1xp * Lz_xm - (eta_xp + eta_xm + 2.) * Lz) *
-        invs_denom;
-
-    const double Lyx1 = invs_12 * rho1yx;
-    const double Lyx2 = invs_20 * rho2yx;
-    const double Lzx1 = invs_12 * rho1zx;
-    const double Lzx2 = invs_20 * rho2zx;
-
-    L(MomentIndx::X1) = invs_dy * Lyx1 + invs_dz * Lzx1;
-    L(MomentIndx::X2) = invs_dy * Lyx2 + invs_dz * Lzx2;
-  }
-
-  // y-axis
-  if (n_yp.second && n_ym.second) {
-    const double dy_yp = geom_->dy(geom_indxs[1] + 1);
-    const double dy_ym = geom_->dy(geom_indxs[1] - 1);
-    const double eta_yp = dy_yp * invs_dy;
-    const double eta_ym = dy_ym * invs_dy;
-    const double p1ym = eta_ym + 1.;
-    const double p2ym = 2. * eta_ym + 1.;
-    const double p1yp = eta_yp + 1.;
-    const double p2yp = 2. * eta_yp + 1.;
-    const double invs_denom = 1. / (p1yp * p1ym * (eta_yp + eta_ym + 1.));
-
-    tmp = comp_avg_trans_lks(g, n_yp.second.value());
-    const double Lx_yp = n_yp.second ? tmp[0] : 0.;
-    const double Lz_yp = n_yp.second ? tmp[2] : 0.;
-
-    tmp = comp_avg_trans_lks(g, n_ym.second.value());
-    const double Lx_ym = n_ym.second ? tmp[0] : 0.;
-    const double Lz_ym = n_ym.second ? tmp[2] : 0.;
-
-    const double rho1xy = (p1ym * p2ym * Lx_yp - p1yp * p2yp * Lx_ym +
-                           (p1yp * p2yp - p1ym * p2ym) * Lx) *
-                          invs_denom;
-    const double rho2xy =
-        (p1ym * Lx_yp + p1yp * Lx_ym - (eta_yp + eta_ym + 2.) * Lx) *
-        invs_denom;
-    const double rho1zy = (p1ym * p2ym * Lz_yp - p1yp * p2yp * Lz_ym +
-                           (p1yp * p2yp - p1ym * p2ym) * Lz) *
-                          invs_denom;
-    const double rho2zy =
-        (p1ym * Lz_yp + p1yp * Lz_ym - (eta_yp + eta_ym + 2.) * Lz) *
-        invs_denom;
-
-    const double Lxy1 = invs_12 * rho1xy;
-    const double Lxy2 = invs_20 * rho2xy;
-    const double Lzy1 = invs_12 * rho1zy;
-    const double Lzy2 = invs_20 * rho2zy;
-
-    L(MomentIndx::Y1) = invs_dx * Lxy1 + invs_dz * Lzy1;
-    L(MomentIndx::Y2) = invs_dx * Lxy2 + invs_dz * Lzy2;
-  }
-
-  // z-axis
-  if (n_zp.second && n_zm.second) {
-    const double dz_zp = geom_->dz(geom_indxs[2] + 1);
-    const double dz_zm = geom_->dz(geom_indxs[2] - 1);
-    const double eta_zp = dz_zp * invs_dz;
-    const double eta_zm = dz_zm * invs_dz;
-    const double p1zm = eta_zm + 1.;
-    const double p2zm = 2. * eta_zm + 1.;
-    const double p1zp = eta_zp + 1.;
-    const double p2zp = 2. * eta_zp + 1.;
-    const double invs_denom = 1. / (p1zp * p1zm * (eta_zp + eta_zm + 1.));
-
-    tmp = comp_avg_trans_lks(g, n_zp.second.value());
-    const double Lx_zp = n_zp.second ? tmp[0] : 0.;
-    const double Ly_zp = n_zp.second ? tmp[1] : 0.;
-
-    tmp = comp_avg_trans_lks(g, n_zm.second.value());
-    const double Lx_zm = n_zm.second ? tmp[0] : 0.;
-    const double Ly_zm = n_zm.second ? tmp[1] : 0.;
-
-    const double rho1xz = (p1zm * p2zm * Lx_zp - p1zp * p2zp * Lx_zm +
-                           (p1zp * p2zp - p1zm * p2zm) * Lx) *
-                          invs_denom;
-    const double rho2xz =
-        (p1zm * Lx_zp + p1zp * Lx_zm - (eta_zp + eta_zm + 2.) * Lx) *
-        invs_denom;
-    const double rho1yz = (p1zm * p2zm * Ly_zp - p1zp * p2zp * Ly_zm +
-                           (p1zp * p2zp - p1zm * p2zm) * Ly) *
-                          invs_denom;
-    const double rho2yz =
-        (p1zm * Ly_zp + p1zp * Ly_zm - (eta_zp + eta_zm + 2.) * Ly) *
-        invs_denom;
-
-    const double Lxz1 = invs_12 * rho1xz;
-    const double Lxz2 = invs_20 * rho2xz;
-    const double Lyz1 = invs_12 * rho1yz;
-    const double Lyz2 = invs_20 * rho2yz;
-
-    L(MomentIndx::Z1) = invs_dx * Lxz1 + invs_dy * Lyz1;
-    L(MomentIndx::Z2) = invs_dx * Lxz2 + invs_dy * Lyz2;
+  // The leakages along the two other axes are fit with a quadratic over the
+  // node and its two neighbors along each axis
+  for (std::size_t a = 0; a < 3; a++) {
+    const LeakageAxis& ax = geo.axes[a];
+    if (ax.interior == false) continue;
+
+    std::array<double, 3> Lp = comp_avg_trans_lks(ax.np);
+    std::array<double, 3> Lm = comp_avg_trans_lks(ax.nm);
+    if (ax.rot_p) std::swap(Lp[0], Lp[1]);
+    if (ax.rot_m) std::swap(Lm[0], Lm[1]);
+
+    double L1 = 0.;
+    double L2 = 0.;
+    for (std::size_t t = 0; t < 3; t++) {
+      if (t == a) continue;
+      L1 += geo.invs_d[t] * (ax.w1p * Lp[t] + ax.w1m * Lm[t] + ax.w1 * Lc[t]);
+      L2 += geo.invs_d[t] * (ax.w2p * Lp[t] + ax.w2m * Lm[t] + ax.w2 * Lc[t]);
+    }
+
+    L(MomentIndx::X1 + a) = L1;
+    L(MomentIndx::X2 + a) = L2;
   }
 
   // Return the transverse leakage moments vector
@@ -579,8 +560,8 @@ void NEMDiffusionDriver::calc_node(const std::size_t g, const std::size_t m,
   //----------------------------------------------------------------------------
   // OBTAIN NECESSARY ARRAYS AND DATA
   const auto& Q = Q_(g, m);
-  const auto& R = Rmats_(g, m);
-  const auto& P = Pmats_(g, m);
+  const auto& R = Rmats_(g, node_types_[m]);
+  const auto& P = Pmats_(g, node_types_[m]);
   auto& Jin = j_in_out_(g, m, 0);  // Not const as we update this here
   auto& Jout = j_in_out_(g, m, 1);
   const double D = xs.D(g);    // Diffusion coefficient
@@ -680,60 +661,281 @@ void NEMDiffusionDriver::calc_node(const std::size_t g, const std::size_t m,
        3. * invs_dz * invs_dz * D * az2) *
       invs_Er;
   flux_(g, m, MomentIndx::Z2) = flx_z2;
-
-  //----------------------------------------------------------------------------
-  // UPDATE INCOMING CURRENTS IN NEIGHBORING NODES / B.C.
-  update_Jin_from_Jout(g, m);
 }
 
 void NEMDiffusionDriver::inner_iteration() {
-  // Iterate through all nodes
-  for (std::size_t m = 0; m < NM_; m++) {
-    const auto geom_indx = geom_inds_(m);
-    const double dx = geom_->dx(geom_indx[0]);
-    const double dy = geom_->dy(geom_indx[1]);
-    const double dz = geom_->dz(geom_indx[2]);
+  SCARABEE_PROFILE_ZONE("NEMDiffusionDriver::inner_iteration");
+  // Rotational symmetry couples nodes of the same color, (0, j) and (j, 0)
+  const bool red_black =
+      red_black_sweep_ &&
+      geom_->symmetry() != DiffusionSymmetry::QuarterRotational;
+
+  const auto solve_node = [this, red_black](std::size_t m) {
+    const auto& invs_d = node_geoms_[m].invs_d;
+    const auto& xs = *mats_[m];
+
+    for (std::size_t g = 0; g < NG_; g++) {
+      calc_node(g, m, invs_d[0], invs_d[1], invs_d[2], xs);
+      if (red_black == false) update_Jin_from_Jout(g, m);
+    }
+  };
+
+  if (red_black == false) {
+    // Iterate through all nodes
+    for (std::size_t m = 0; m < NM_; m++) solve_node(m);
+    return;
+  }
+
+  // All neighbors of a node have the other color. The nodes of one color are
+  // solved together from the currents of the other color, and only then are
+  // their outgoing currents passed to the neighbors, as solving a node also
+  // reads the incoming currents of its neighbors.
+  for (const auto& nodes : colors_) {
+#pragma omp parallel for
+    for (int in = 0; in < static_cast<int>(nodes.size()); in++) {
+      solve_node(nodes[static_cast<std::size_t>(in)]);
+    }
+
+#pragma omp parallel for
+    for (int in = 0; in < static_cast<int>(nodes.size()); in++) {
+      const std::size_t m = nodes[static_cast<std::size_t>(in)];
+      for (std::size_t g = 0; g < NG_; g++) update_Jin_from_Jout(g, m);
+    }
+  }
+}
+
+std::pair<double, double> NEMDiffusionDriver::cmfd_face_coeffs(
+    std::size_t g, std::size_t m, std::size_t n, CurrentIndx indx,
+    CurrentIndx n_indx) const {
+  // The face is the indx face of node m, and the n_indx face of node n. The
+  // partial currents of node m are used, so that both nodes see the same net
+  // current through the face.
+  const auto width = [this](std::size_t node, CurrentIndx i) {
+    return geom_->width(node, static_cast<DiffusionGeometry::Neighbor>(
+                                  static_cast<std::size_t>(i) ^ 1));
+  };
+  const double width_m = width(m, indx);
+  const double width_n = width(n, n_indx);
+
+  const double D_L = mats_[m]->D(g);
+  const double D_R = mats_[n]->D(g);
+  const double D =
+      2. * D_L * D_R / (D_L * width_n + D_R * width_m);  // D tilde
+  const double flx_L = flux_(g, m, MomentIndx::AVG);
+  const double flx_R = flux_(g, n, MomentIndx::AVG);
+  const double J_p = j_in_out_(g, m, 1)(indx);  // Toward the positive side
+  const double J_m = j_in_out_(g, m, 0)(indx);  // Toward the negative side
+
+  // The partial currents are written as
+  // J+ = -(D/2)(flx_R - flx_L) + D+ flx_L and
+  // J- = (D/2)(flx_R - flx_L) + D- flx_R, so that the net current is
+  // J = (D + D+) flx_L - (D + D-) flx_R.
+  const double D_p = (J_p + 0.5 * D * (flx_R - flx_L)) / flx_L;
+  const double D_m = (J_m - 0.5 * D * (flx_R - flx_L)) / flx_R;
+  return {D + D_p, D + D_m};
+}
+
+std::size_t NEMDiffusionDriver::cmfd_update() {
+  SCARABEE_PROFILE_ZONE("NEMDiffusionDriver::cmfd_update");
+  const std::size_t N = NG_ * NM_;
+
+  const auto invs_width = [this](std::size_t m, std::size_t d) {
+    const auto& indxs = geom_inds_(m);
+    if (d == 0) return 1. / geom_->dx(indxs[0]);
+    if (d == 1) return 1. / geom_->dy(indxs[1]);
+    return 1. / geom_->dz(indxs[2]);
+  };
+
+  // Fills row m + g * NM_ of the loss matrix
+  const auto fill_loss_row = [&](std::size_t r, const auto& add) {
+    const std::size_t m = r % NM_;
+    const std::size_t g = r / NM_;
+    const auto& xs = *mats_[m];
+    double diag = xs.Er(g);
+
+    for (std::size_t f = 0; f < 6; f++) {
+      const auto indx = static_cast<CurrentIndx>(f);
+      const double invs_h = invs_width(m, f / 2);
+      const auto& nb = neighbors_(m, f);
+
+      if (nb.second.has_value() == false) {
+        // Outgoing net current through a boundary, relative to the flux
+        const double J =
+            j_in_out_(g, m, 1)(indx) - j_in_out_(g, m, 0)(indx);
+        diag += invs_h * J / flux_(g, m, MomentIndx::AVG);
+        continue;
+      }
+
+      // The partial currents of the node on the negative side of the face
+      // are used. On the faces coupled by rotational symmetry, both nodes are
+      // on the positive side, and those of the node with the lowest index
+      // are used.
+      const std::size_t n = nb.second.value();
+      const std::size_t nf = nb_faces_(m, f);
+      const auto n_indx = static_cast<CurrentIndx>(nf);
+      if (f % 2 == 0 || (nf % 2 == 1 && m <= n)) {
+        const auto [a, b] = cmfd_face_coeffs(g, m, n, indx, n_indx);
+        diag += invs_h * a;
+        add(n + g * NM_, -invs_h * b);
+      } else {
+        const auto [a, b] = cmfd_face_coeffs(g, n, m, n_indx, indx);
+        diag += invs_h * b;
+        add(n + g * NM_, -invs_h * a);
+      }
+    }
+
+    add(r, diag);
+
+    for (std::size_t gg = 0; gg < NG_; gg++) {
+      if (gg != g) add(m + gg * NM_, -xs.Es(gg, g));
+    }
+  };
+
+  // Fills row m + g * NM_ of the fission matrix
+  const auto fill_fission_row = [&](std::size_t r, const auto& add) {
+    const std::size_t m = r % NM_;
+    const std::size_t g = r / NM_;
     const auto& xs = *mats_[m];
-    const double invs_dx = 1. / dx;
-    const double invs_dy = 1. / dy;
-    const double invs_dz = 1. / dz;
+    const double chi_g = xs.chi(g);
+
+    for (std::size_t gg = 0; gg < NG_; gg++) {
+      add(m + gg * NM_, chi_g * xs.vEf(gg));
+    }
+  };
+
+  cmfd_M_pattern_.assemble(cmfd_M_, N, NM_, fill_loss_row);
+  cmfd_F_pattern_.assemble(cmfd_F_, N, NM_, fill_fission_row);
+
+  // Node average fluxes of NEM, and the weights for the fission rate
+  Eigen::VectorXd nem_flux(N);
+  Eigen::VectorXd VvEf(N);
+  for (std::size_t m = 0; m < NM_; m++) {
+    const auto& indxs = geom_inds_(m);
+    const double Vr = geom_->dx(indxs[0]) * geom_->dy(indxs[1]) *
+                      geom_->dz(indxs[2]);
+    for (std::size_t g = 0; g < NG_; g++) {
+      nem_flux(m + g * NM_) = flux_(g, m, MomentIndx::AVG);
+      VvEf(m + g * NM_) = Vr * mats_[m]->vEf(g);
+    }
+  }
+
+  Eigen::BiCGSTAB<Eigen::SparseMatrix<double, Eigen::RowMajor>> solver;
+  solver.compute(cmfd_M_);
+  solver.setTolerance(1.E-8);
+  if (solver.info() != Eigen::Success) {
+    auto mssg = "Could not initialize the CMFD solver.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // Power iteration on the node mesh, converged beyond the NEM tolerances
+  constexpr std::size_t MAX_CMFD_ITERS = 500;
+  Eigen::VectorXd flux = nem_flux;
+  Eigen::VectorXd new_flux(N);
+  double keff = keff_;
+  std::size_t iteration = 0;
+  while (iteration < MAX_CMFD_ITERS) {
+    iteration++;
+    const Eigen::VectorXd Q = (1. / keff) * (cmfd_F_ * flux);
+    new_flux = solver.solveWithGuess(Q, flux);
+
+    const double prev_keff = keff;
+    keff = prev_keff * VvEf.dot(new_flux) / VvEf.dot(flux);
+    new_flux *= prev_keff / keff;
+
+    double flux_diff = 0.;
+    for (std::size_t i = 0; i < N; i++) {
+      const double diff = std::abs(new_flux(i) - flux(i)) / new_flux(i);
+      if (diff > flux_diff) flux_diff = diff;
+    }
+    flux = new_flux;
+
+    const double keff_diff = std::abs(keff - prev_keff) / keff;
+    if (keff_diff < 0.1 * keff_tol_ && flux_diff < 0.1 * flux_tol_) break;
+  }
+
+  // Keep the fission rate of the NEM solution
+  flux *= VvEf.dot(nem_flux) / VvEf.dot(flux);
 
+  // The node fluxes and outgoing currents are scaled by the flux ratio of
+  // their node, and the incoming currents by that of the node they come from
+  xt::xtensor<double, 2> ratios = xt::ones<double>({NG_, NM_});
+  for (std::size_t m = 0; m < NM_; m++) {
     for (std::size_t g = 0; g < NG_; g++) {
-      calc_node(g, m, invs_dx, invs_dy, invs_dz, xs);
+      const double nflx = nem_flux(m + g * NM_);
+      const double cflx = flux(m + g * NM_);
+      if (nflx > 0. && cflx > 0.) ratios(g, m) = cflx / nflx;
+    }
+  }
+
+#pragma omp parallel for
+  for (int im = 0; im < static_cast<int>(NM_); im++) {
+    const std::size_t m = static_cast<std::size_t>(im);
+    for (std::size_t g = 0; g < NG_; g++) {
+      const double ratio = ratios(g, m);
+      for (std::size_t mom = 0; mom < flux_.shape()[2]; mom++) {
+        flux_(g, m, mom) *= ratio;
+      }
+      j_in_out_(g, m, 1) *= ratio;
+
+      for (std::size_t f = 0; f < 6; f++) {
+        const auto& nb = neighbors_(m, f);
+        j_in_out_(g, m, 0)(f) *=
+            nb.second.has_value() ? ratios(g, nb.second.value()) : ratio;
+      }
     }
   }
+
+  keff_ = keff;
+  return iteration;
 }
 
 void NEMDiffusionDriver::solve() {
+  SCARABEE_PROFILE_ZONE("NEMDiffusionDriver::solve");
+  ThreadScope thread_scope(threads_);
   Timer sim_timer;
   sim_timer.start();
+  telemetry_.clear();
 
   spdlog::info("Solving for keff.");
   spdlog::info("keff tolerance: {:.5E}", keff_tol_);
   spdlog::info("Flux tolerance: {:.5E}", flux_tol_);
 
+  // The previous solution is the initial guess of a warm start
+  const std::array<std::size_t, 3> flux_shape{NG_, NM_, 7};
+  const std::array<std::size_t, 3> j_shape{NG_, NM_, 2};
+  const bool warm = warm_start_ && solved_ && flux_.shape() == flux_shape &&
+                    j_in_out_.shape() == j_shape;
+  if (warm) spdlog::info("Starting from the previous solution.");
+
   // Allocate all arrays
   flux_.resize({NG_, NM_, 7});
-  xt::xtensor<double, 3> old_flux = flux_;
   j_in_out_.resize({NG_, NM_, 2});
-  Rmats_.resize({NG_, NM_});
-  Pmats_.resize({NG_, NM_});
   Q_.resize({NG_, NM_});
 
   // Load the flux and current values with an initial guess
-  flux_.fill(1.);
-  old_flux.fill(1.);
-  for (std::size_t g = 0; g < NG_; g++) {
-    for (std::size_t m = 0; m < NM_; m++) {
-      j_in_out_(g, m, 0).fill(1.);
-      j_in_out_(g, m, 1).fill(1.);
+  if (warm == false) {
+    keff_ = 1.;
+    flux_.fill(1.);
+    for (std::size_t g = 0; g < NG_; g++) {
+      for (std::size_t m = 0; m < NM_; m++) {
+        j_in_out_(g, m, 0).fill(1.);
+        j_in_out_(g, m, 1).fill(1.);
+      }
     }
   }
+  xt::xtensor<double, 3> old_flux = flux_;
+  xt::xtensor<double, 2> inner_flux;
+  inner_flux.resize({NG_, NM_});
 
   // Fill the coupling matrices
-  fill_neighbors_and_geom_inds();
-  fill_mats_adf();
-  fill_coupling_matrices();
+  {
+    SolverTelemetry::ScopedPhase phase(telemetry_, "coupling_matrices");
+    fill_neighbors_and_geom_inds();
+    fill_node_geometry();
+    fill_mats_adf();
+    fill_coupling_matrices();
+  }
 
   // Begin power iteration
   double keff_diff = 100.;
@@ -745,24 +947,88 @@ void NEMDiffusionDriver::solve() {
     iteration_timer.start();
     iteration++;
 
-    // Copy current flux into old flux
-    old_flux = flux_;
+    // With a Wielandt shift, the fission source at keff + shift is moved
+    // to the left hand side
+    const bool shifted = wielandt_shift_ > 0.;
+    const double invs_kshift = shifted ? 1. / (keff_ + wielandt_shift_) : 0.;
+    const double invs_keff = 1. / keff_ - invs_kshift;
 
     // Calculating the source
-    fill_source();
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "fill_source");
+      fill_source(flux_, invs_keff, invs_kshift);
+    }
 
-    // Perform 2 inner iterations per outer generation
-    inner_iteration();
-    inner_iteration();
+    // The current flux becomes the old flux. Every moment of flux_ is
+    // rewritten by the first sweep, so the buffers are swapped, not copied.
+    std::swap(old_flux, flux_);
+
+    // Perform inner iterations until the node fluxes stop changing
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "inner_iteration");
+      std::size_t ninner = 0;
+      while (ninner < inner_iterations_) {
+        if (ninner > 0) {
+          if (inner_tol_ > 0.) {
+            for (std::size_t g = 0; g < NG_; g++) {
+              for (std::size_t m = 0; m < NM_; m++) {
+                inner_flux(g, m) = flux_(g, m, MomentIndx::AVG);
+              }
+            }
+          }
+
+          // The shifted fission and the scattering sources are updated
+          if (shifted) fill_source(old_flux, invs_keff, invs_kshift);
+        }
+
+        inner_iteration();
+        ninner++;
+
+        if (inner_tol_ > 0. && ninner < inner_iterations_) {
+          double inner_diff = 0.;
+          for (std::size_t g = 0; g < NG_; g++) {
+            for (std::size_t m = 0; m < NM_; m++) {
+              const double flx = flux_(g, m, MomentIndx::AVG);
+              const double prev = ninner == 1
+                                      ? old_flux(g, m, MomentIndx::AVG)
+                                      : inner_flux(g, m);
+              inner_diff = std::max(inner_diff, std::abs((flx - prev) / flx));
+            }
+          }
+          if (inner_diff < inner_tol_) break;
+        }
+      }
+      telemetry_.add_count("inner_iterations", ninner);
+    }
 
     // Compute new keff
     double prev_keff = keff_;
-    keff_ = calc_keff(prev_keff, old_flux, flux_);
+    {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "keff");
+      if (shifted) {
+        // The shifted eigenvalue is estimated from the fission source ratio,
+        // and the flux is normalized to keep the fission source constant.
+        const double ratio = calc_keff(1., old_flux, flux_);
+        keff_ = 1. / (invs_kshift + invs_keff / ratio);
+        const double scale = 1. / ratio;
+        flux_ *= scale;
+        j_in_out_ *= scale;
+      } else {
+        keff_ = calc_keff(prev_keff, old_flux, flux_);
+      }
+    }
+
+    // Rebalance the node fluxes and currents with CMFD
+    if (cmfd_) {
+      SolverTelemetry::ScopedPhase phase(telemetry_, "cmfd");
+      telemetry_.add_count("cmfd_iterations", cmfd_update());
+    }
     keff_diff = std::abs(keff_ - prev_keff) / keff_;
 
     // Find the max flux error
     // flux_diff = xt::amax(xt::abs(flux_ - old_flux) / flux_)();
     flux_diff = calc_flux_error(old_flux, flux_);
+    telemetry_.add_iteration(flux_diff, keff_);
 
     // Write information
     spdlog::info("-------------------------------------");
@@ -782,6 +1048,7 @@ void NEMDiffusionDriver::solve() {
   // Deallocate arrays that are not needed for reconstruction
   Rmats_.resize({0, 0});
   Pmats_.resize({0, 0});
+  node_types_.clear();
   Q_.resize({0, 0});
 
   // Before reconstruction, we want to compute the average power in each node,
@@ -810,7 +1077,127 @@ void NEMDiffusionDriver::solve() {
     }
   }
   fitting_timer.stop();
+  telemetry_.add_time("fitting", fitting_timer.elapsed_time());
+  telemetry_.add_time(
+      "solve", sim_timer.elapsed_time() + fitting_timer.elapsed_time());
   spdlog::info("Fitting Time: {:.5E} s", fitting_timer.elapsed_time());
+
+  log_memory_usage("NEMDiffusionDriver", memory_usage());
+}
+
+MemoryUsage NEMDiffusionDriver::memory_usage() const {
+  MemoryUsage usage;
+  usage["flux"] = array_bytes(flux_) + array_bytes(j_in_out_) + array_bytes(Q_);
+  usage["response_matrices"] = array_bytes(Rmats_) + array_bytes(Pmats_);
+  usage["reconstruction"] = array_bytes(recon_params);
+  usage["geometry"] = array_bytes(neighbors_) + array_bytes(nb_faces_) +
+                      array_bytes(node_types_) + array_bytes(node_geoms_) +
+                      array_bytes(colors_[0]) + array_bytes(colors_[1]) +
+                      array_bytes(adf_);
+  usage["cmfd"] = array_bytes(cmfd_M_) + array_bytes(cmfd_F_) +
+                  cmfd_M_pattern_.memory_bytes() +
+                  cmfd_F_pattern_.memory_bytes();
+  return usage;
+}
+
+template <typename Add>
+void NEMDiffusionDriver::eval_grid_flux(const xt::xtensor<double, 1>& x,
+                                        const xt::xtensor<double, 1>& y,
+                                        const xt::xtensor<double, 1>& z,
+                                        const Add& add) const {
+  if (geom_->symmetry() != DiffusionSymmetry::Full) {
+    // The folded points of a symmetric core do not form a tensor product
+    // grid in the solved quadrant, so each point is located on its own.
+#pragma omp parallel for
+    for (int ii = 0; ii < static_cast<int>(x.size()); ii++) {
+      const std::size_t i = static_cast<std::size_t>(ii);
+      for (std::size_t j = 0; j < y.size(); j++) {
+        const auto [xf, yf] = geom_->fold_xy(x[i], y[j]);
+        const auto oi = geom_->x_to_i(xf);
+        const auto oj = geom_->y_to_j(yf);
+        if (oi.has_value() == false || oj.has_value() == false) continue;
+
+        for (std::size_t k = 0; k < z.size(); k++) {
+          const auto ok = geom_->z_to_k(z[k]);
+          if (ok.has_value() == false) continue;
+          const auto om =
+              geom_->geom_to_mat_indx({oi.value(), oj.value(), ok.value()});
+          if (om.has_value() == false) continue;
+          const std::size_t m = om.value();
+
+          for (std::size_t g = 0; g < NG_; g++) {
+            add(g, m, i, j, k, recon_params(g, m)(xf, yf, z[k]));
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  const std::size_t nx = geom_->nx();
+  const std::size_t ny = geom_->ny();
+  const std::size_t nz = geom_->nz();
+  const auto x_bins = bin_grid_coords(
+      x, nx, [this](double v) { return geom_->x_to_i(v); });
+  const auto y_bins = bin_grid_coords(
+      y, ny, [this](double v) { return geom_->y_to_j(v); });
+  const auto z_bins = bin_grid_coords(
+      z, nz, [this](double v) { return geom_->z_to_k(v); });
+
+#pragma omp parallel for schedule(dynamic)
+  for (int nn = 0; nn < static_cast<int>(nx * ny * nz); nn++) {
+    const std::size_t n = static_cast<std::size_t>(nn);
+    const std::size_t gi = n / (ny * nz);
+    const std::size_t gj = (n / nz) % ny;
+    const std::size_t gk = n % nz;
+    const auto& xb = x_bins[gi];
+    const auto& yb = y_bins[gj];
+    const auto& zb = z_bins[gk];
+    if (xb.empty() || yb.empty() || zb.empty()) continue;
+
+    const auto om = geom_->geom_to_mat_indx({gi, gj, gk});
+    if (om.has_value() == false) continue;
+    const std::size_t m = om.value();
+
+    // 1D basis functions at the grid coordinates inside the node
+    std::vector<double> fx(xb.size()), p1x(xb.size()), p2x(xb.size());
+    std::vector<double> fy(yb.size()), p1y(yb.size()), p2y(yb.size());
+    std::vector<double> fz(zb.size());
+    for (std::size_t g = 0; g < NG_; g++) {
+      const NodeFlux& nf = recon_params(g, m);
+
+      for (std::size_t a = 0; a < xb.size(); a++) {
+        const double xx = x[xb[a]] - nf.xm;
+        const double xi = 2. * xx * nf.invs_dx;
+        fx[a] = nf.fx(xx);
+        p1x[a] = nf.p1(xi);
+        p2x[a] = nf.p2(xi);
+      }
+      for (std::size_t b = 0; b < yb.size(); b++) {
+        const double yy = y[yb[b]] - nf.ym;
+        const double xi = 2. * yy * nf.invs_dy;
+        fy[b] = nf.fy(yy);
+        p1y[b] = nf.p1(xi);
+        p2y[b] = nf.p2(xi);
+      }
+      for (std::size_t c = 0; c < zb.size(); c++) {
+        fz[c] = nf.fz(z[zb[c]] - nf.zm);
+      }
+
+      for (std::size_t a = 0; a < xb.size(); a++) {
+        for (std::size_t b = 0; b < yb.size(); b++) {
+          const double fxy = nf.phi_0 + fx[a] + fy[b] +
+                             nf.cxy11 * p1x[a] * p1y[b] +
+                             nf.cxy12 * p1x[a] * p2y[b] +
+                             nf.cxy21 * p2x[a] * p1y[b] +
+                             nf.cxy22 * p2x[a] * p2y[b];
+          for (std::size_t c = 0; c < zb.size(); c++) {
+            add(g, m, xb[a], yb[b], zb[c], fxy + fz[c]);
+          }
+        }
+      }
+    }
+  }
 }
 
 double NEMDiffusionDriver::flux(double x, double y, double z,
@@ -830,6 +1217,9 @@ double NEMDiffusionDriver::flux(double x, double y, double z,
     throw ScarabeeException(mssg.str());
   }
 
+  // Points of a symmetric core are mapped into the solved quadrant
+  std::tie(x, y) = geom_->fold_xy(x, y);
+
   // Get geometry index
   const auto oi = geom_->x_to_i(x);
   const auto oj = geom_->y_to_j(y);
@@ -881,35 +1271,11 @@ xt::xtensor<double, 4> NEMDiffusionDriver::flux(
   flux_out.resize({ngroups(), x.size(), y.size(), z.size()});
   flux_out.fill(0.);
 
-  for (std::size_t g = 0; g < ngroups(); g++) {
-#pragma omp parallel for
-    for (int ii = 0; ii < static_cast<int>(x.size()); ii++) {
-      std::size_t i = static_cast<std::size_t>(ii);
-      for (std::size_t j = 0; j < y.size(); j++) {
-        for (std::size_t k = 0; k < z.size(); k++) {
-          // Get geometry index
-          const auto oi = geom_->x_to_i(x[i]);
-          const auto oj = geom_->y_to_j(y[j]);
-          const auto ok = geom_->z_to_k(z[k]);
-          if (oi.has_value() == false || oj.has_value() == false ||
-              ok.has_value() == false) {
-            continue;
-          }
-          const std::size_t gi = oi.value();
-          const std::size_t gj = oj.value();
-          const std::size_t gk = ok.value();
-          const xt::svector<std::size_t> geom_inds{gi, gj, gk};
-
-          // Get material index
-          const auto om = geom_->geom_to_mat_indx(geom_inds);
-          if (om.has_value() == false) continue;
-          const std::size_t m = om.value();
-
-          flux_out(g, i, j, k) = recon_params(g, m)(x[i], y[j], z[k]);
-        }
-      }
-    }
-  }
+  eval_grid_flux(x, y, z,
+                 [&flux_out](std::size_t g, std::size_t, std::size_t i,
+                             std::size_t j, std::size_t k, double flx) {
+                   flux_out(g, i, j, k) = flx;
+                 });
 
   return flux_out;
 }
@@ -922,8 +1288,9 @@ xt::xtensor<double, 4> NEMDiffusionDriver::avg_flux() const {
     throw ScarabeeException(mssg);
   }
 
-  const std::size_t nx = geom_->nx();
-  const std::size_t ny = geom_->ny();
+  // A symmetric core is unfolded from the solved quadrant
+  const std::size_t nx = geom_->unfolded_nx();
+  const std::size_t ny = geom_->unfolded_ny();
   const std::size_t nz = geom_->nz();
 
   xt::xtensor<double, 4> flux_out;
@@ -933,7 +1300,8 @@ xt::xtensor<double, 4> NEMDiffusionDriver::avg_flux() const {
     for (std::size_t i = 0; i < nx; i++) {
       for (std::size_t j = 0; j < ny; j++) {
         for (std::size_t k = 0; k < nz; k++) {
-          const auto om = geom_->geom_to_mat_indx({i, j, k});
+          const auto [fi, fj] = geom_->fold_ij(i, j);
+          const auto om = geom_->geom_to_mat_indx({fi, fj, k});
 
           if (om.has_value() == false)
             flux_out(g, i, j, k) = 0.;
@@ -955,6 +1323,9 @@ double NEMDiffusionDriver::power(double x, double y, double z) const {
     throw ScarabeeException(mssg);
   }
 
+  // Points of a symmetric core are mapped into the solved quadrant
+  std::tie(x, y) = geom_->fold_xy(x, y);
+
   // Get geometry index
   const auto oi = geom_->x_to_i(x);
   const auto oj = geom_->y_to_j(y);
@@ -1014,39 +1385,13 @@ xt::xtensor<double, 3> NEMDiffusionDriver::power(
   pwr_out.resize({x.size(), y.size(), z.size()});
   pwr_out.fill(0.);
 
-#pragma omp parallel for
-  for (int ii = 0; ii < static_cast<int>(x.size()); ii++) {
-    std::size_t i = static_cast<std::size_t>(ii);
-    for (std::size_t j = 0; j < y.size(); j++) {
-      for (std::size_t k = 0; k < z.size(); k++) {
-        // Get geometry index
-        const auto oi = geom_->x_to_i(x[i]);
-        const auto oj = geom_->y_to_j(y[j]);
-        const auto ok = geom_->z_to_k(z[k]);
-        if (oi.has_value() == false || oj.has_value() == false ||
-            ok.has_value() == false) {
-          continue;
-        }
-        const std::size_t gi = oi.value();
-        const std::size_t gj = oj.value();
-        const std::size_t gk = ok.value();
-        const xt::svector<std::size_t> geom_inds{gi, gj, gk};
-
-        // Get material index
-        const auto om = geom_->geom_to_mat_indx(geom_inds);
-        if (om.has_value() == false) {
-          continue;
-        }
-        const std::size_t m = om.value();
-
-        const auto& xs = *mats_[m];
-
-        for (std::size_t g = 0; g < NG_; g++) {
-          pwr_out(i, j, k) += recon_params(g, m)(x[i], y[j], z[k]) * xs.Ef(g);
-        }
-      }
-    }
-  }
+  // Each point belongs to a single node, whose groups are all evaluated by
+  // the same thread
+  eval_grid_flux(x, y, z,
+                 [this, &pwr_out](std::size_t g, std::size_t m, std::size_t i,
+                                  std::size_t j, std::size_t k, double flx) {
+                   pwr_out(i, j, k) += flx * mats_[m]->Ef(g);
+                 });
 
   return pwr_out;
 }
@@ -1090,42 +1435,39 @@ NEMDiffusionDriver::pin_power(const xt::xtensor<double, 1>& z) const {
   const std::size_t y_shp = y_oshp.value();
 
   // First, we need to create a mesh for the x and y points
-  xt::xtensor<double, 1> x =
-      xt::zeros<double>({x_shp * geom_->tile_dx().size() + 1});
+  // (for the whole core, when only a quadrant was solved)
+  const std::vector<double> tile_dx = geom_->unfolded_tile_dx();
+  const std::vector<double> tile_dy = geom_->unfolded_tile_dy();
+  xt::xtensor<double, 1> x = xt::zeros<double>({x_shp * tile_dx.size() + 1});
   std::size_t i = 1;
-  for (std::size_t xt = 0; xt < geom_->tile_dx().size(); xt++) {
-    const double tile_pitch = geom_->tile_dx()[xt] / static_cast<double>(x_shp);
+  for (std::size_t xt = 0; xt < tile_dx.size(); xt++) {
+    const double tile_pitch = tile_dx[xt] / static_cast<double>(x_shp);
     for (std::size_t p = 0; p < x_shp; p++) {
       x[i] = x[i - 1] + tile_pitch;
       i++;
     }
   }
 
-  xt::xtensor<double, 1> y =
-      xt::zeros<double>({y_shp * geom_->tile_dy().size() + 1});
+  xt::xtensor<double, 1> y = xt::zeros<double>({y_shp * tile_dy.size() + 1});
   i = 1;
-  for (std::size_t yt = 0; yt < geom_->tile_dy().size(); yt++) {
-    const double tile_pitch = geom_->tile_dy()[yt] / static_cast<double>(y_shp);
+  for (std::size_t yt = 0; yt < tile_dy.size(); yt++) {
+    const double tile_pitch = tile_dy[yt] / static_cast<double>(y_shp);
     for (std::size_t p = 0; p < y_shp; p++) {
       y[i] = y[i - 1] + tile_pitch;
       i++;
     }
   }
 
-  // We now load the powers
-  xt::xtensor<double, 3> pwr_out =
-      xt::zeros<double>({x.size() - 1, y.size() - 1, z.size()});
-  for (std::size_t i = 0; i < x.size() - 1; i++) {
-    const double xx = 0.5 * (x[i + 1] + x[i]);
-    for (std::size_t j = 0; j < y.size() - 1; j++) {
-      const double yy = 0.5 * (y[j + 1] + y[j]);
-      for (std::size_t k = 0; k < z.size(); k++) {
-        const double zz = z[k];
+  // We now load the powers, evaluated at the pin centers
+  xt::xtensor<double, 1> xc = xt::zeros<double>({x.size() - 1});
+  for (std::size_t i = 0; i < xc.size(); i++) xc[i] = 0.5 * (x[i + 1] + x[i]);
+  xt::xtensor<double, 1> yc = xt::zeros<double>({y.size() - 1});
+  for (std::size_t j = 0; j < yc.size(); j++) yc[j] = 0.5 * (y[j + 1] + y[j]);
 
-        pwr_out(i, j, k) = power(xx, yy, zz) * geom_->form_factor(xx, yy, zz);
-      }
-    }
-  }
+  // The form factors of all pins are gathered once, and then multiply the
+  // homogeneous power element by element
+  xt::xtensor<double, 3> pwr_out = power(xc, yc, z);
+  pwr_out *= geom_->form_factor_grid(x_shp, y_shp, z);
 
   return {pwr_out, x, y};
 }
@@ -1138,8 +1480,9 @@ xt::xtensor<double, 3> NEMDiffusionDriver::avg_power() const {
     throw ScarabeeException(mssg);
   }
 
-  const std::size_t nx = geom_->nx();
-  const std::size_t ny = geom_->ny();
+  // A symmetric core is unfolded from the solved quadrant
+  const std::size_t nx = geom_->unfolded_nx();
+  const std::size_t ny = geom_->unfolded_ny();
   const std::size_t nz = geom_->nz();
 
   xt::xtensor<double, 3> pwr_out;
@@ -1149,7 +1492,8 @@ xt::xtensor<double, 3> NEMDiffusionDriver::avg_power() const {
   for (std::size_t i = 0; i < nx; i++) {
     for (std::size_t j = 0; j < ny; j++) {
       for (std::size_t k = 0; k < nz; k++) {
-        const auto om = geom_->geom_to_mat_indx({i, j, k});
+        const auto [fi, fj] = geom_->fold_ij(i, j);
+        const auto om = geom_->geom_to_mat_indx({fi, fj, k});
 
         if (om.has_value() == false) {
           continue;
@@ -0,0 +1,354 @@
+#include <diffusion/nodal_flux.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <Eigen/Dense>
+#include <Eigen/LU>
+
+#include <cmath>
+#include <string>
+
+namespace scarabee {
+
+namespace {
+void check_group_array(const xt::xtensor<double, 1>& arr, std::size_t ngroups,
+                       const std::string& name) {
+  if (arr.size() != ngroups) {
+    const auto mssg = "The length of " + name +
+                      " does not agree with number of groups in xs.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+// Terms of the reconstructed flux of one group. The node is centered on the
+// origin and has no z terms.
+using NodeFlux = NEMDiffusionDriver::NodeFlux;
+
+double eval_total(const NodeFlux& nf, double x, double y) {
+  return nf(x, y, 0.);
+}
+
+double eval_no_cross(const NodeFlux& nf, double x, double y) {
+  return nf.flux_xy_no_cross(x, y);
+}
+
+double eval_fx(const NodeFlux& nf, double x, double /*y*/) { return nf.fx(x); }
+
+double eval_fy(const NodeFlux& nf, double /*x*/, double y) { return nf.fy(y); }
+
+double eval_fxy(const NodeFlux& nf, double x, double y) {
+  return nf.fxy(x, y);
+}
+}  // namespace
+
+NodalFlux1D::NodalFlux1D(double x_min, double x_max, double keff,
+                         const DiffusionCrossSection& xs,
+                         const xt::xtensor<double, 1>& avg_flx,
+                         const xt::xtensor<double, 1>& j_neg,
+                         const xt::xtensor<double, 1>& j_pos)
+    : a_(), x_min_(x_min), x_max_(x_max) {
+  if (x_min_ >= x_max_) {
+    const auto mssg = "The value of x_min must be < x_max.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  if (keff <= 0. || keff >= 2.) {
+    const auto mssg = "The value of keff must be in the interval (0, 2).";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t NG = xs.ngroups();
+  check_group_array(avg_flx, NG, "avg_flx");
+  check_group_array(j_neg, NG, "j_neg");
+  check_group_array(j_pos, NG, "j_pos");
+
+  // Perform the static nodal calculation for all groups
+  const std::size_t Na = NG * 4;  // Number of a coefficients to solve for
+  const double invs_dx = 1. / (x_max_ - x_min_);
+  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(Na, Na);
+  Eigen::VectorXd b = Eigen::VectorXd::Zero(Na);
+
+  std::size_t j = 0;  // Matrix row
+  for (std::size_t g = 0; g < NG; g++) {
+    const double Dg = xs.D(g);
+    const double Dg_dx = Dg * invs_dx;
+    // Use this for Et instead of 1/(3D), as that gave bad results.
+    const double Et = xs.Ea(g) + xs.Es(g);
+    const double chi_g_keff = xs.chi(g) / keff;
+    const double Erf_g = Et - xs.Es(g, g) - chi_g_keff * xs.vEf(g);
+
+    // Each group has 4 equations. See reference [1].
+
+    // Eq 2.54
+    A(j, g * 4 + 2) -= 0.5 * Dg_dx * invs_dx;
+    A(j, g * 4 + 0) += Erf_g / 12.;
+    A(j, g * 4 + 2) -= 0.1 * (Erf_g / 12.);
+    for (std::size_t gg = 0; gg < NG; gg++) {
+      if (gg == g) continue;
+      A(j, gg * 4 + 0) -= xs.Es(gg, g) / 12.;
+      A(j, gg * 4 + 2) += 0.1 * (xs.Es(gg, g) / 12.);
+      A(j, gg * 4 + 0) -= chi_g_keff * (xs.vEf(gg) / 12.);
+      A(j, gg * 4 + 2) += 0.1 * chi_g_keff * (xs.vEf(gg) / 12.);
+    }
+    j++;
+
+    // Eq 2.55
+    A(j, g * 4 + 3) -= 0.2 * Dg_dx * invs_dx;
+    A(j, g * 4 + 1) += Erf_g / 20.;
+    A(j, g * 4 + 3) -= Erf_g / (20. * 35.);
+    for (std::size_t gg = 0; gg < NG; gg++) {
+      if (gg == g) continue;
+      A(j, gg * 4 + 1) -= xs.Es(gg, g) / 20.;
+      A(j, gg * 4 + 3) += xs.Es(gg, g) / (20. * 35.);
+      A(j, gg * 4 + 1) -= chi_g_keff * (xs.vEf(gg) / 20.);
+      A(j, gg * 4 + 3) += chi_g_keff * (xs.vEf(gg) / (20. * 35.));
+    }
+    j++;
+
+    // Eq 2.57 and 2.58 have an error in [1]. They are both missing a factor
+    // of 3 on the a2 term. The correct form can be found from Lawrence in [2].
+    // Eq 2.57
+    A(j, g * 4 + 0) -= Dg_dx;
+    A(j, g * 4 + 1) += 3. * Dg_dx;
+    A(j, g * 4 + 2) -= 0.5 * Dg_dx;
+    A(j, g * 4 + 3) += 0.2 * Dg_dx;
+    b(j) = j_neg(g);
+    j++;
+
+    // Eq 2.58
+    A(j, g * 4 + 0) -= Dg_dx;
+    A(j, g * 4 + 1) -= 3. * Dg_dx;
+    A(j, g * 4 + 2) -= 0.5 * Dg_dx;
+    A(j, g * 4 + 3) -= 0.2 * Dg_dx;
+    b(j) = j_pos(g);
+    j++;
+  }
+
+  const Eigen::VectorXd a_tmp = A.partialPivLu().solve(b);
+  a_ = xt::zeros<double>({NG, std::size_t(5)});
+  for (std::size_t g = 0; g < NG; g++) {
+    a_(g, 0) = avg_flx(g);
+    for (std::size_t i = 0; i < 4; i++) a_(g, i + 1) = a_tmp(g * 4 + i);
+  }
+}
+
+void NodalFlux1D::check_group(std::size_t g) const {
+  if (g >= this->ngroups()) {
+    const auto mssg = "Group index g is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+
+double NodalFlux1D::operator()(double x, std::size_t g) const {
+  check_group(g);
+
+  // Points outside of the node are permitted, to evaluate the expansion
+  const double u = ((x - x_min_) / (x_max_ - x_min_)) - 0.5;
+  return a_(g, 0) * f0(u) + a_(g, 1) * f1(u) + a_(g, 2) * f2(u) +
+         a_(g, 3) * f3(u) + a_(g, 4) * f4(u);
+}
+
+xt::xtensor<double, 1> NodalFlux1D::operator()(const xt::xtensor<double, 1>& x,
+                                               std::size_t g) const {
+  check_group(g);
+
+  xt::xtensor<double, 1> flx = xt::zeros<double>({x.size()});
+  for (std::size_t i = 0; i < x.size(); i++) flx(i) = (*this)(x(i), g);
+  return flx;
+}
+
+double NodalFlux1D::pos_surf_flux(std::size_t g) const {
+  check_group(g);
+  return a_(g, 0) + 0.5 * a_(g, 1) + 0.5 * a_(g, 2);
+}
+
+xt::xtensor<double, 1> NodalFlux1D::pos_surf_flux() const {
+  xt::xtensor<double, 1> flx = xt::zeros<double>({this->ngroups()});
+  for (std::size_t g = 0; g < flx.size(); g++) flx(g) = pos_surf_flux(g);
+  return flx;
+}
+
+double NodalFlux1D::neg_surf_flux(std::size_t g) const {
+  check_group(g);
+  return a_(g, 0) - 0.5 * a_(g, 1) + 0.5 * a_(g, 2);
+}
+
+xt::xtensor<double, 1> NodalFlux1D::neg_surf_flux() const {
+  xt::xtensor<double, 1> flx = xt::zeros<double>({this->ngroups()});
+  for (std::size_t g = 0; g < flx.size(); g++) flx(g) = neg_surf_flux(g);
+  return flx;
+}
+
+NodalFlux2D::NodalFlux2D(double dx, double dy, double keff,
+                         const DiffusionCrossSection& xs,
+                         const xt::xtensor<double, 1>& avg_flx,
+                         const xt::xtensor<double, 1>& j_x_neg,
+                         const xt::xtensor<double, 1>& j_x_pos,
+                         const xt::xtensor<double, 1>& j_y_neg,
+                         const xt::xtensor<double, 1>& j_y_pos)
+    : recon_params_(xs.ngroups()),
+      flux_x_(-0.5 * dx, 0.5 * dx, keff, xs, avg_flx, j_x_neg, j_x_pos),
+      flux_y_(-0.5 * dy, 0.5 * dy, keff, xs, avg_flx, j_y_neg, j_y_pos),
+      keff_(keff) {
+  auto sinhc = [](double x) { return std::sinh(x) / x; };
+
+  // Solves for the coefficients of fx or fy, in the same manner as
+  // NEMDiffusionDriver::fit_node_recon_params
+  auto fit = [&sinhc](double zeta, double flx_p, double flx_m, double flx_avg,
+                      double Jp, double Jm, double d, double D) {
+    Eigen::Matrix<double, 4, 4> M{{0., 0., 1., 1.},
+                                  {0., 0., -1., 1.},
+                                  {0., 0., 1., 3.},
+                                  {0., 0., 1., -3.}};
+    M(0, 0) = std::cosh(zeta) - sinhc(zeta);
+    M(0, 1) = std::sinh(zeta);
+    M(1, 0) = M(0, 0);
+    M(1, 1) = -M(0, 1);
+    M(2, 0) = zeta * std::sinh(zeta);
+    M(2, 1) = zeta * std::cosh(zeta);
+    M(3, 0) = -M(2, 0);
+    M(3, 1) = M(2, 1);
+    Eigen::Matrix<double, 4, 1> b;
+    b(0) = flx_p - flx_avg;
+    b(1) = flx_m - flx_avg;
+    b(2) = -0.5 * Jp * d / D;
+    b(3) = -0.5 * Jm * d / D;
+    const Eigen::Matrix<double, 4, 1> fu_coeffs = M.inverse() * b;
+    return fu_coeffs;
+  };
+
+  for (std::size_t g = 0; g < recon_params_.size(); g++) {
+    auto& nf = recon_params_[g];
+    const double D = xs.D(g);
+    nf.phi_0 = avg_flx(g);
+    nf.eps = std::sqrt(xs.Er(g) / D);
+    nf.invs_dx = 1. / dx;
+    nf.invs_dy = 1. / dy;
+
+    // Determine fx coefficients
+    nf.zeta_x = 0.5 * nf.eps * dx;
+    auto c = fit(nf.zeta_x, flux_x_.pos_surf_flux(g), flux_x_.neg_surf_flux(g),
+                 nf.phi_0, j_x_pos(g), j_x_neg(g), dx, D);
+    nf.ax1 = c(0);
+    nf.ax2 = c(1);
+    nf.bx1 = c(2);
+    nf.bx2 = c(3);
+    nf.ax0 = -nf.ax1 * sinhc(nf.zeta_x);
+
+    // Determine fy coefficients
+    nf.zeta_y = 0.5 * nf.eps * dy;
+    c = fit(nf.zeta_y, flux_y_.pos_surf_flux(g), flux_y_.neg_surf_flux(g),
+            nf.phi_0, j_y_pos(g), j_y_neg(g), dy, D);
+    nf.ay1 = c(0);
+    nf.ay2 = c(1);
+    nf.by1 = c(2);
+    nf.by2 = c(3);
+    nf.ay0 = -nf.ay1 * sinhc(nf.zeta_y);
+  }
+}
+
+void NodalFlux2D::set_cross_terms(std::size_t g, double cxy11, double cxy12,
+                                  double cxy21, double cxy22) {
+  if (g >= this->ngroups()) {
+    const auto mssg = "Group index g is out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  auto& nf = recon_params_[g];
+  nf.cxy11 = cxy11;
+  nf.cxy12 = cxy12;
+  nf.cxy21 = cxy21;
+  nf.cxy22 = cxy22;
+}
+
+template <typename F>
+xt::xtensor<double, 1> NodalFlux2D::evaluate(double x, double y, F f) const {
+  xt::xtensor<double, 1> flx = xt::zeros<double>({this->ngroups()});
+  for (std::size_t g = 0; g < flx.size(); g++) {
+    flx(g) = f(recon_params_[g], x, y);
+  }
+  return flx;
+}
+
+template <typename F>
+xt::xtensor<double, 2> NodalFlux2D::evaluate(const xt::xtensor<double, 1>& x,
+                                             const xt::xtensor<double, 1>& y,
+                                             F f) const {
+  if (x.size() != y.size()) {
+    const auto mssg = "The arrays x and y must have the same length.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const std::size_t N = x.size();
+  const std::size_t NG = this->ngroups();
+  xt::xtensor<double, 2> flx = xt::zeros<double>({N, NG});
+#pragma omp parallel for
+  for (int in = 0; in < static_cast<int>(N); in++) {
+    const std::size_t n = static_cast<std::size_t>(in);
+    for (std::size_t g = 0; g < NG; g++) {
+      flx(n, g) = f(recon_params_[g], x(n), y(n));
+    }
+  }
+  return flx;
+}
+
+xt::xtensor<double, 1> NodalFlux2D::operator()(double x, double y) const {
+  return evaluate(x, y, eval_total);
+}
+
+xt::xtensor<double, 2> NodalFlux2D::operator()(
+    const xt::xtensor<double, 1>& x, const xt::xtensor<double, 1>& y) const {
+  return evaluate(x, y, eval_total);
+}
+
+xt::xtensor<double, 1> NodalFlux2D::flux_xy_no_cross(double x, double y) const {
+  return evaluate(x, y, eval_no_cross);
+}
+
+xt::xtensor<double, 2> NodalFlux2D::flux_xy_no_cross(
+    const xt::xtensor<double, 1>& x, const xt::xtensor<double, 1>& y) const {
+  return evaluate(x, y, eval_no_cross);
+}
+
+xt::xtensor<double, 1> NodalFlux2D::fx(double x) const {
+  return evaluate(x, 0., eval_fx);
+}
+
+xt::xtensor<double, 2> NodalFlux2D::fx(const xt::xtensor<double, 1>& x) const {
+  return evaluate(x, x, eval_fx);
+}
+
+xt::xtensor<double, 1> NodalFlux2D::fy(double y) const {
+  return evaluate(0., y, eval_fy);
+}
+
+xt::xtensor<double, 2> NodalFlux2D::fy(const xt::xtensor<double, 1>& y) const {
+  return evaluate(y, y, eval_fy);
+}
+
+xt::xtensor<double, 1> NodalFlux2D::fxy(double x, double y) const {
+  return evaluate(x, y, eval_fxy);
+}
+
+xt::xtensor<double, 2> NodalFlux2D::fxy(const xt::xtensor<double, 1>& x,
+                                        const xt::xtensor<double, 1>& y) const {
+  return evaluate(x, y, eval_fxy);
+}
+
+}  // namespace scarabee
+
+// REFERENCES
+//
+// [1] S. Machach, “Étude des techniques d’équivalence nodale appliquées aux
+//     modèles de réflecteurs dans les réacteurs à eau pressurisée,”
+//     Polytechnique Montréal, 2022.
+//
+// [2] R. D. Lawrence, “Progress in nodal methods for the solution of the
+//     neutron diffusion and transport equations,” Prog. Nucl. Energ., vol. 17,
+//     no. 3, pp. 271–301, 1986, doi: 10.1016/0149-1970(86)90034-x.
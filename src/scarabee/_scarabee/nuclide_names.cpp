@@ -93,7 +93,8 @@ std::uint32_t nuclide_name_to_za(const std::string& name) {
 
     if (first_letter == Elem.symbol[0]) {
       // First letters match ! What about second ?
-      if ((second_is_letter && second_letter == Elem.symbol[1]) ||
+      if ((second_is_letter && Elem.symbol.size() > 1 &&
+           second_letter == Elem.symbol[1]) ||
           (second_is_letter == false)) {
         found_element = true;
         break;
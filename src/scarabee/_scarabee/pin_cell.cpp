@@ -20,6 +20,7 @@ PinCell::PinCell(const std::vector<double>& mat_rads,
       nd_(),
       pin_type_(pin_type) {
   this->build();
+  this->build_fsr_index();
 }
 
 void PinCell::build() {
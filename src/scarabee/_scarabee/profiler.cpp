@@ -0,0 +1,269 @@
+#include <utils/profiler.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace scarabee {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct ZoneNode {
+  const char* name;
+  std::size_t parent;
+  std::vector<std::size_t> children;
+  std::uint64_t calls{0};
+  double time{0.};  // Inclusive time in seconds
+};
+
+struct TraceEvent {
+  const char* name;
+  double start;  // Microseconds since the profiler epoch
+  double duration;
+};
+
+// The zones of one thread. Node 0 is the root, which is not a zone. The mutex
+// is only contended while a report is written.
+struct ThreadZones {
+  std::size_t tid;
+  std::mutex mutex;
+  std::vector<ZoneNode> nodes{ZoneNode{"", 0, {}, 0, 0.}};
+  std::vector<std::pair<std::size_t, Clock::time_point>> stack;
+  std::vector<TraceEvent> events;
+};
+
+struct ProfilerRegistry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadZones>> threads;
+  Clock::time_point epoch{Clock::now()};
+  std::atomic<bool> tracing{false};
+};
+
+ProfilerRegistry& registry() {
+  static ProfilerRegistry reg;
+  return reg;
+}
+
+// The zones of a thread are kept by the registry after the thread ends, so
+// that they appear in the reports.
+ThreadZones& thread_zones() {
+  thread_local ThreadZones* zones = []() {
+    auto& reg = registry();
+    std::scoped_lock lock(reg.mutex);
+    reg.threads.push_back(std::make_unique<ThreadZones>());
+    reg.threads.back()->tid = reg.threads.size() - 1;
+    return reg.threads.back().get();
+  }();
+  return *zones;
+}
+
+// Zones of all threads, merged by their path from the root
+struct MergedZone {
+  std::uint64_t calls{0};
+  double time{0.};
+  std::map<std::string, MergedZone> children;
+};
+
+void merge(const ThreadZones& zones, std::size_t n, MergedZone& merged) {
+  const auto& node = zones.nodes[n];
+  merged.calls += node.calls;
+  merged.time += node.time;
+  for (const std::size_t c : node.children) {
+    merge(zones, c, merged.children[zones.nodes[c].name]);
+  }
+}
+
+void write_tree(std::ostringstream& out, const std::string& name,
+                const MergedZone& zone, double parent_time,
+                std::size_t depth) {
+  const double percent = parent_time > 0. ? 100. * zone.time / parent_time : 0.;
+  out << fmt::format("{:<48} {:>12} {:>14.6f} {:>7.2f}%\n",
+                     std::string(2 * depth, ' ') + name, zone.calls, zone.time,
+                     percent);
+
+  // Children are listed from the most expensive
+  std::vector<std::pair<std::string, const MergedZone*>> children;
+  for (const auto& [cname, child] : zone.children) {
+    children.push_back({cname, &child});
+  }
+  std::sort(children.begin(), children.end(), [](const auto& a, const auto& b) {
+    return a.second->time > b.second->time;
+  });
+  for (const auto& [cname, child] : children) {
+    write_tree(out, cname, *child, zone.time, depth + 1);
+  }
+}
+
+void flatten(const MergedZone& zone, const std::string& name,
+             std::map<std::string, std::pair<std::uint64_t, double>>& flat,
+             std::vector<std::string>& path) {
+  // Recursive zones only count the outermost call in their time
+  const bool nested = std::find(path.begin(), path.end(), name) != path.end();
+  auto& entry = flat[name];
+  entry.first += zone.calls;
+  if (nested == false) entry.second += zone.time;
+
+  path.push_back(name);
+  for (const auto& [cname, child] : zone.children) {
+    flatten(child, cname, flat, path);
+  }
+  path.pop_back();
+}
+
+}  // namespace
+
+void Profiler::enter(const char* name) {
+  auto& zones = thread_zones();
+  std::scoped_lock lock(zones.mutex);
+  const std::size_t parent = zones.stack.empty() ? 0 : zones.stack.back().first;
+
+  // A zone is identified by its name and parent. The names are usually
+  // literals, so the pointers are compared first.
+  std::size_t n = 0;
+  for (const std::size_t c : zones.nodes[parent].children) {
+    const char* cname = zones.nodes[c].name;
+    if (cname == name || std::strcmp(cname, name) == 0) {
+      n = c;
+      break;
+    }
+  }
+  if (n == 0) {
+    n = zones.nodes.size();
+    zones.nodes.push_back(ZoneNode{name, parent, {}, 0, 0.});
+    zones.nodes[parent].children.push_back(n);
+  }
+
+  zones.stack.push_back({n, Clock::now()});
+}
+
+void Profiler::leave() {
+  const auto stop = Clock::now();
+  auto& zones = thread_zones();
+  std::scoped_lock lock(zones.mutex);
+  if (zones.stack.empty()) return;
+
+  const auto [n, start] = zones.stack.back();
+  zones.stack.pop_back();
+  auto& node = zones.nodes[n];
+  node.calls++;
+  node.time += std::chrono::duration<double>(stop - start).count();
+
+  if (registry().tracing) {
+    using us = std::chrono::duration<double, std::micro>;
+    zones.events.push_back({node.name, us(start - registry().epoch).count(),
+                            us(stop - start).count()});
+  }
+}
+
+void Profiler::reset() {
+  auto& reg = registry();
+  std::scoped_lock lock(reg.mutex);
+  for (auto& zones : reg.threads) {
+    std::scoped_lock zlock(zones->mutex);
+    zones->nodes.resize(1);
+    zones->nodes[0].children.clear();
+    zones->stack.clear();
+    zones->events.clear();
+  }
+  reg.epoch = Clock::now();
+}
+
+bool Profiler::tracing() { return registry().tracing; }
+
+void Profiler::set_tracing(bool trace) { registry().tracing = trace; }
+
+std::string Profiler::report(bool flat) {
+  MergedZone root;
+  {
+    auto& reg = registry();
+    std::scoped_lock lock(reg.mutex);
+    for (const auto& zones : reg.threads) {
+      std::scoped_lock zlock(zones->mutex);
+      merge(*zones, 0, root);
+    }
+  }
+
+  std::ostringstream out;
+  if (enabled() == false) {
+    out << "Scarabee was compiled without SCARABEE_PROFILE.\n";
+    return out.str();
+  }
+
+  // Times are summed over the threads which entered a zone
+  if (flat) {
+    std::map<std::string, std::pair<std::uint64_t, double>> zones;
+    std::vector<std::string> path;
+    for (const auto& [name, zone] : root.children) {
+      flatten(zone, name, zones, path);
+    }
+    std::vector<std::pair<std::string, std::pair<std::uint64_t, double>>>
+        sorted(zones.begin(), zones.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+      return a.second.second > b.second.second;
+    });
+
+    out << fmt::format("{:<48} {:>12} {:>14}\n", "Zone", "Calls", "Time (s)");
+    for (const auto& [name, entry] : sorted) {
+      out << fmt::format("{:<48} {:>12} {:>14.6f}\n", name, entry.first,
+                         entry.second);
+    }
+  } else {
+    double total = 0.;
+    for (const auto& [name, zone] : root.children) total += zone.time;
+    out << fmt::format("{:<48} {:>12} {:>14} {:>8}\n", "Zone", "Calls",
+                       "Time (s)", "Parent");
+    std::vector<std::pair<std::string, const MergedZone*>> zones;
+    for (const auto& [name, zone] : root.children) {
+      zones.push_back({name, &zone});
+    }
+    std::sort(zones.begin(), zones.end(), [](const auto& a, const auto& b) {
+      return a.second->time > b.second->time;
+    });
+    for (const auto& [name, zone] : zones) {
+      write_tree(out, name, *zone, total, 0);
+    }
+  }
+
+  return out.str();
+}
+
+void Profiler::write_chrome_trace(const std::string& fname) {
+  std::ofstream file(fname);
+  if (!file.good()) {
+    const auto mssg = "Could not open the file \"" + fname + "\".";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  file << "{\"traceEvents\":[\n";
+  bool first = true;
+  auto& reg = registry();
+  std::scoped_lock lock(reg.mutex);
+  for (const auto& zones : reg.threads) {
+    std::scoped_lock zlock(zones->mutex);
+    for (const auto& event : zones->events) {
+      if (first == false) file << ",\n";
+      first = false;
+      file << fmt::format(
+          "{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+          "\"pid\":0,\"tid\":{}}}",
+          event.name, event.start, event.duration, zones->tid);
+    }
+  }
+  file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+}  // namespace scarabee
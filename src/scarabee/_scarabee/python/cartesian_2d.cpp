@@ -2,7 +2,9 @@
 #include <pybind11/stl.h>
 
 #include <moc/cartesian_2d.hpp>
+#include <moc/geometry_raster.hpp>
 
+#include <string>
 #include <memory>
 
 namespace py = pybind11;
@@ -112,5 +114,32 @@ void init_Cartesian2D(py::module& m) {
            "----------\n"
            "fills : list of Cartesian2D or Cell\n"
            "        Fills for all tiles.",
-           py::arg("fills"));
+           py::arg("fills"))
+
+      .def(
+          "render_png",
+          [](const Cartesian2D& geom, const std::string& fname,
+             std::size_t nx, std::size_t ny, PlotColorBy color_by,
+             bool outline_boundaries) {
+            render_geometry_png(geom, fname, nx, ny, color_by,
+                                outline_boundaries);
+          },
+          "Writes a PNG image of the geometry, without opening a window. The "
+          "rows of pixels are traced in parallel.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "fname : str\n"
+          "    Name of the PNG file.\n"
+          "nx : int\n"
+          "    Number of pixels along x.\n"
+          "ny : int\n"
+          "    Number of pixels along y.\n"
+          "color_by : PlotColorBy\n"
+          "    Property which gives the colors of the regions. Default is "
+          "PlotColorBy.MaterialName.\n"
+          "outline_boundaries : bool\n"
+          "    If the boundaries of the regions are drawn. Default is True.",
+          py::arg("fname"), py::arg("nx"), py::arg("ny"),
+          py::arg("color_by") = PlotColorBy::MaterialName,
+          py::arg("outline_boundaries") = true);
 }
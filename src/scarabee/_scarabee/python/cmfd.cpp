@@ -57,6 +57,23 @@ void init_CMFD(py::module& m) {
       .def_property_readonly("dy", &CMFD::dy,
                              "List of tile widths along the y axis.")
 
+      .def_property_readonly(
+          "telemetry", &CMFD::telemetry,
+          py::return_value_policy::reference_internal,
+          ":py:class:`SolverTelemetry` of the CMFD solves of the last MOC "
+          "solve, with the time of the homogenization, assembly, "
+          "linear_solve, and update_moc_flux phases, and the number of power "
+          "and linear solver iterations.")
+
+      .def("memory_usage", &CMFD::memory_usage,
+           "Number of bytes currently held by the arrays of the CMFD, for "
+           "each of the fsrs, currents, xs, flux, and matrices components. "
+           "The storage of the factorizations is not included.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
       .def_property_readonly("condensation_scheme", &CMFD::condensation_scheme,
                              "Condensation scheme to go from the MOC group "
                              "structure to the CMFD group structure.")
@@ -87,11 +104,137 @@ void init_CMFD(py::module& m) {
           "the diffusion coeffients. Mutally exclusive with the "
           "larsen_correction flag.")
 
+      .def_property(
+          "partial_current_cmfd", &CMFD::partial_current_cmfd,
+          &CMFD::set_partial_current_cmfd,
+          "Flag indicating use of partial-current CMFD (pCMFD), where the "
+          "currents in each direction are tallied separately and given their "
+          "own nonlinear coupling coefficients. This keeps the loss matrix "
+          "diagonally dominant, so flux limiting is not applied. Works with "
+          "the larsen_correction and od_cmfd flags.")
+
+      .def_property(
+          "surface_flux_tally", &CMFD::surface_flux_tally,
+          &CMFD::set_surface_flux_tally,
+          "Flag indicating that the average scalar flux on each CMFD surface "
+          "is tallied during the MOC sweeps, along with the currents. The "
+          "surface fluxes can be used to compute discontinuity factors. "
+          "Default is False.")
+
       .def_property(
           "damping", &CMFD::damping, &CMFD::set_damping,
           "The damping factor used for under-relaxing the nonlinear diffusion "
           "coefficient between iterations.")
 
+      .def_property("linear_solver", &CMFD::linear_solver,
+                    &CMFD::set_linear_solver,
+                    ":py:class:`CMFDLinearSolver` used for the linear systems "
+                    "of the power iteration and fixed source solves.")
+
+      .def_property("linear_tolerance", &CMFD::linear_tolerance,
+                    &CMFD::set_linear_tolerance,
+                    "Relative residual tolerance of the iterative linear "
+                    "solvers. Default is 1.E-10.")
+
+      .def_property(
+          "adaptive_linear_tolerance", &CMFD::adaptive_linear_tolerance,
+          &CMFD::set_adaptive_linear_tolerance,
+          "If True, each power iteration solves its linear system to a "
+          "tolerance of 1 percent of the largest keff or flux difference of "
+          "the previous power iteration, bounded by 1.E-4 and "
+          "linear_tolerance. Default is False.")
+
+      .def_property(
+          "forcing_factor", &CMFD::forcing_factor, &CMFD::set_forcing_factor,
+          "Forcing factor of inexact CMFD solves. When positive, the keff and "
+          "flux tolerances of each power iteration are loosened to the "
+          "forcing factor times the largest relative change of the "
+          "homogenized MOC flux since the previous CMFD solve, and the "
+          "linear tolerance to 1 percent of that. The loosened tolerance is "
+          "at most 1.E-3, only decreases during an MOC solve, and is never "
+          "tighter than keff_tolerance, flux_tolerance, and "
+          "linear_tolerance. Default is 0, which disables it.")
+
+      .def_property_readonly(
+          "forced_tolerance", &CMFD::forced_tolerance,
+          "Loosened tolerance of the last CMFD solve, or 0 without forcing.")
+
+      .def_property("direct_solver_max_size", &CMFD::direct_solver_max_size,
+                    &CMFD::set_direct_solver_max_size,
+                    "Largest number of unknowns for which the Auto linear "
+                    "solver uses SparseLU. Default is 20000.")
+
+      .def_property_readonly(
+          "linear_iterations", &CMFD::linear_iterations,
+          "Total number of iterations of the linear solver in the last CMFD "
+          "solve. Direct solves count zero iterations.")
+
+      .def_property("acceleration", &CMFD::acceleration,
+                    &CMFD::set_acceleration,
+                    ":py:class:`CMFDAcceleration` of the power iteration. "
+                    "Default is Unaccelerated.")
+
+      .def_property(
+          "wielandt_shift", &CMFD::wielandt_shift, &CMFD::set_wielandt_shift,
+          "Difference between the shifted keff of the Wielandt acceleration "
+          "and the current keff estimate. Smaller shifts converge in fewer "
+          "iterations, but make the linear systems harder to solve. Default "
+          "is 0.05.")
+
+      .def_property_readonly("power_iteration_keffs",
+                             &CMFD::power_iteration_keffs,
+                             "Estimate of keff after each power iteration of "
+                             "the last CMFD solve.")
+
+      .def_property_readonly(
+          "power_iteration_residuals", &CMFD::power_iteration_residuals,
+          "Maximum relative flux difference of each power iteration of the "
+          "last CMFD solve.")
+
+      .def_property_readonly(
+          "dominance_ratio", &CMFD::dominance_ratio,
+          "Dominance ratio estimated by the Chebyshev acceleration in the "
+          "last CMFD solve. Is 0 if it was not estimated.")
+
+      .def("set_coarse_mesh", &CMFD::set_coarse_mesh,
+           "Adds a coarse level to the CMFD power iteration, which makes it a "
+           "two-grid iteration. Each coarse tile merges a block of CMFD tiles, "
+           "and each coarse group merges a range of CMFD groups. After every "
+           "power iteration, the CMFD flux is rebalanced by the solution of "
+           "the coarse eigenvalue problem, whose operators are the CMFD ones "
+           "restricted with the current flux shape. This keeps fine CMFD "
+           "meshes affordable on large problems. Cannot be combined with "
+           "Chebyshev acceleration.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "nx_tiles : list of int\n"
+           "    Number of CMFD tiles along x in each coarse tile column.\n"
+           "ny_tiles : list of int\n"
+           "    Number of CMFD tiles along y in each coarse tile row.\n"
+           "groups : list of 2D tuples of ints\n"
+           "    The scheme for condensing the CMFD groups into coarse "
+           "groups.\n",
+           py::arg("nx_tiles"), py::arg("ny_tiles"), py::arg("groups"))
+
+      .def("clear_coarse_mesh", &CMFD::clear_coarse_mesh,
+           "Removes the coarse level of the CMFD power iteration.")
+
+      .def_property_readonly("has_coarse_mesh", &CMFD::has_coarse_mesh,
+                             "True if the power iteration has a coarse level.")
+
+      .def_property_readonly("coarse_nx_tiles", &CMFD::coarse_nx_tiles,
+                             "Number of CMFD tiles along x in each coarse "
+                             "tile column.")
+
+      .def_property_readonly("coarse_ny_tiles", &CMFD::coarse_ny_tiles,
+                             "Number of CMFD tiles along y in each coarse "
+                             "tile row.")
+
+      .def_property_readonly("coarse_condensation_scheme",
+                             &CMFD::coarse_condensation_scheme,
+                             "Condensation scheme from the CMFD groups to the "
+                             "coarse groups.")
+
       .def_property("skip_moc_iterations", &CMFD::skip_moc_iterations,
                     &CMFD::set_skip_moc_iterations,
                     "Number of MOC iterations to skip before applying CMFD.")
@@ -207,7 +350,9 @@ void init_CMFD(py::module& m) {
            "    FSRs int the tile.\n",
            py::arg("i"), py::arg("j"))
 
-      .def("tally_current", &CMFD::tally_current,
+      .def("tally_current",
+           py::overload_cast<double, const Direction&, std::size_t,
+                             const CMFDSurfaceCrossing&>(&CMFD::tally_current),
            "Tallies the current onto the appropriate CMFD surface(s).\n\n"
            "Parameters\n"
            "----------\n"
@@ -235,6 +380,88 @@ void init_CMFD(py::module& m) {
            "    Tallied current in CMFD group g on surface surf.\n",
            py::arg("g"), py::arg("surf"))
 
+      .def("partial_current", &CMFD::partial_current,
+           "Returns the partial current on a CMFD cell boundary. Only "
+           "available when partial_current_cmfd is True.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "g: int\n"
+           "    CMFD energy group.\n"
+           "surf: int\n"
+           "    CMFD surface index.\n"
+           "positive: bool\n"
+           "    If True, the current in the positive x or y direction is "
+           "returned. Otherwise, the current in the negative direction.\n\n"
+           "Returns\n"
+           "-------\n"
+           "float\n"
+           "    Tallied partial current in CMFD group g on surface surf.\n",
+           py::arg("g"), py::arg("surf"), py::arg("positive"))
+
+      .def("surface_flux", &CMFD::surface_flux,
+           "Returns the average scalar flux on a CMFD cell boundary, tallied "
+           "during the last MOC sweep. Only available when "
+           "surface_flux_tally is True.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "g: int\n"
+           "    CMFD energy group.\n"
+           "surf: int\n"
+           "    CMFD surface index.\n\n"
+           "Returns\n"
+           "-------\n"
+           "float\n"
+           "    Average scalar flux in CMFD group g on surface surf.\n",
+           py::arg("g"), py::arg("surf"))
+
+      .def("x_line_flux", &CMFD::x_line_flux,
+           "Returns the average scalar flux along the line x = x_bounds[i], "
+           "over all y. Only available when surface_flux_tally is True.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "i: int\n"
+           "    Index of the x bound, from 0 to nx.\n"
+           "g: int\n"
+           "    CMFD energy group.\n\n"
+           "Returns\n"
+           "-------\n"
+           "float\n"
+           "    Average scalar flux on the line.\n",
+           py::arg("i"), py::arg("g"))
+
+      .def("y_line_flux", &CMFD::y_line_flux,
+           "Returns the average scalar flux along the line y = y_bounds[j], "
+           "over all x. Only available when surface_flux_tally is True.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "j: int\n"
+           "    Index of the y bound, from 0 to ny.\n"
+           "g: int\n"
+           "    CMFD energy group.\n\n"
+           "Returns\n"
+           "-------\n"
+           "float\n"
+           "    Average scalar flux on the line.\n",
+           py::arg("j"), py::arg("g"))
+
+      .def("vertex_flux", &CMFD::vertex_flux,
+           "Returns an estimate of the scalar flux at a vertex of the CMFD "
+           "mesh, from the average flux of the surfaces which meet there. "
+           "Only available when surface_flux_tally is True.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "i: int\n"
+           "    Index of the x bound, from 0 to nx.\n"
+           "j: int\n"
+           "    Index of the y bound, from 0 to ny.\n"
+           "g: int\n"
+           "    CMFD energy group.\n\n"
+           "Returns\n"
+           "-------\n"
+           "float\n"
+           "    Estimated scalar flux at the vertex.\n",
+           py::arg("i"), py::arg("j"), py::arg("g"))
+
       .def("flux", &CMFD::flux,
            "Gets the CMFD flux in a desired tile and group.\n\n"
            "Parameters\n"
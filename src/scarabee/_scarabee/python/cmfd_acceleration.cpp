@@ -0,0 +1,14 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/cmfd_acceleration.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_CMFDAcceleration(py::module& m) {
+  py::enum_<CMFDAcceleration>(m, "CMFDAcceleration")
+      .value("Unaccelerated", CMFDAcceleration::Unaccelerated)
+      .value("Wielandt", CMFDAcceleration::Wielandt)
+      .value("Chebyshev", CMFDAcceleration::Chebyshev);
+}
@@ -0,0 +1,15 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/cmfd_linear_solver.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_CMFDLinearSolver(py::module& m) {
+  py::enum_<CMFDLinearSolver>(m, "CMFDLinearSolver")
+      .value("BiCGSTAB", CMFDLinearSolver::BiCGSTAB)
+      .value("ILUTBiCGSTAB", CMFDLinearSolver::ILUTBiCGSTAB)
+      .value("SparseLU", CMFDLinearSolver::SparseLU)
+      .value("Auto", CMFDLinearSolver::Auto);
+}
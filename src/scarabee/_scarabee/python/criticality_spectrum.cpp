@@ -1,4 +1,5 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
 
 #include <utils/criticality_spectrum.hpp>
@@ -58,7 +59,38 @@ void init_CriticalitySpectrum(py::module& m) {
            "     Homogenized set of cross sections for the system.\n"
            "B : float\n"
            "    Desired value of the buckling.\n\n",
-           py::arg("xs"), py::arg("B"));
+           py::arg("xs"), py::arg("B"))
+
+      .def(py::init<std::shared_ptr<CrossSection>,
+                    const CriticalitySpectrum&>(),
+           "Computes the criticality energy spectrum using the P1 leakage "
+           "approximation, starting the buckling search from the buckling of "
+           "a similar spectrum (from a previous depletion step or branch).\n\n"
+           "Parameters\n"
+           "----------\n"
+           "xs : CrossSection\n"
+           "     Homogenized set of cross sections for the system.\n"
+           "guess : CriticalitySpectrum\n"
+           "     Spectrum whose buckling is used as the initial guess.\n\n",
+           py::arg("xs"), py::arg("guess"))
+
+      .def_static("solve_batch", &P1CriticalitySpectrum::solve_batch,
+                  py::call_guard<py::gil_scoped_release>(),
+                  "Computes the criticality energy spectra of many sets of "
+                  "cross sections in parallel, using the P1 leakage "
+                  "approximation. Each buckling search starts from the "
+                  "buckling of the previous set solved by the same thread, so "
+                  "similar cross sections (branches or depletion steps) should "
+                  "be given in order.\n\n"
+                  "Parameters\n"
+                  "----------\n"
+                  "xs : list of CrossSection\n"
+                  "     Homogenized sets of cross sections.\n\n"
+                  "Returns\n"
+                  "-------\n"
+                  "list of P1CriticalitySpectrum\n"
+                  "     Criticality spectrum of each set of cross sections.\n",
+                  py::arg("xs"));
 
   py::class_<B1CriticalitySpectrum, CriticalitySpectrum>(
       m, "B1CriticalitySpectrum")
@@ -80,5 +112,36 @@ void init_CriticalitySpectrum(py::module& m) {
            "     Homogenized set of cross sections for the system.\n"
            "B : float\n"
            "    Desired value of the buckling.\n\n",
-           py::arg("xs"), py::arg("B"));
+           py::arg("xs"), py::arg("B"))
+
+      .def(py::init<std::shared_ptr<CrossSection>,
+                    const CriticalitySpectrum&>(),
+           "Computes the criticality energy spectrum using the B1 leakage "
+           "approximation, starting the buckling search from the buckling of "
+           "a similar spectrum (from a previous depletion step or branch).\n\n"
+           "Parameters\n"
+           "----------\n"
+           "xs : CrossSection\n"
+           "     Homogenized set of cross sections for the system.\n"
+           "guess : CriticalitySpectrum\n"
+           "     Spectrum whose buckling is used as the initial guess.\n\n",
+           py::arg("xs"), py::arg("guess"))
+
+      .def_static("solve_batch", &B1CriticalitySpectrum::solve_batch,
+                  py::call_guard<py::gil_scoped_release>(),
+                  "Computes the criticality energy spectra of many sets of "
+                  "cross sections in parallel, using the B1 leakage "
+                  "approximation. Each buckling search starts from the "
+                  "buckling of the previous set solved by the same thread, so "
+                  "similar cross sections (branches or depletion steps) should "
+                  "be given in order.\n\n"
+                  "Parameters\n"
+                  "----------\n"
+                  "xs : list of CrossSection\n"
+                  "     Homogenized sets of cross sections.\n\n"
+                  "Returns\n"
+                  "-------\n"
+                  "list of B1CriticalitySpectrum\n"
+                  "     Criticality spectrum of each set of cross sections.\n",
+                  py::arg("xs"));
 }
@@ -346,7 +346,11 @@ void init_CrossSection(py::module& m) {
            "       Outgoing energy group.\n\n",
            py::arg("l"), py::arg("gin"), py::arg("gout"))
 
-      .def("condense", &CrossSection::condense,
+      .def("condense",
+           py::overload_cast<
+               const std::vector<std::pair<std::size_t, std::size_t>>&,
+               const xt::xtensor<double, 1>&>(&CrossSection::condense,
+                                              py::const_),
            "Condenses the cross sections to a new energy group structure. The "
            "condensation group structure is provided as a list of pairs "
            "(2D tuples), indicating the lower and upper group indices "
@@ -365,6 +369,119 @@ void init_CrossSection(py::module& m) {
            "            Condensed set of cross sections.\n",
            py::arg("groups"), py::arg("flux"))
 
+      .def("content_hash", &CrossSection::content_hash,
+           "Hash of all cross section values, rounded to a relative "
+           "precision. Cross sections which agree within rtol usually have "
+           "the same hash, and equal cross sections always do.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "rtol : float\n"
+           "       Relative precision of the rounding (default is 0).\n\n"
+           "Returns\n"
+           "-------\n"
+           "int\n"
+           "    Hash of the cross section values.\n",
+           py::arg("rtol") = 0.)
+
+      .def("approx_equal", &CrossSection::approx_equal,
+           "Checks if all values of two cross sections agree within a relative "
+           "tolerance.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "R : CrossSection\n"
+           "    Cross section to compare with.\n"
+           "rtol : float\n"
+           "       Relative tolerance (default is 0).\n\n"
+           "Returns\n"
+           "-------\n"
+           "bool\n"
+           "     True if all values agree.\n",
+           py::arg("R"), py::arg("rtol") = 0.)
+
+      .def_property_readonly(
+          "Etr_array",
+          [](const CrossSection& xs) -> const xt::xtensor<double, 1>& {
+            return xs.Etr_XS1D().values();
+          },
+          py::return_value_policy::reference_internal,
+          "Read-only array of the transport corrected total cross section in "
+          "each group, sharing memory with the cross section.")
+
+      .def_property_readonly(
+          "Dtr_array",
+          [](const CrossSection& xs) -> const xt::xtensor<double, 1>& {
+            return xs.Dtr_XS1D().values();
+          },
+          py::return_value_policy::reference_internal,
+          "Read-only array of the transport correction in each group, sharing "
+          "memory with the cross section.")
+
+      .def_property_readonly(
+          "Ea_array",
+          [](const CrossSection& xs) -> const xt::xtensor<double, 1>& {
+            return xs.Ea_XS1D().values();
+          },
+          py::return_value_policy::reference_internal,
+          "Read-only array of the absorption cross section in each group, "
+          "sharing memory with the cross section.")
+
+      .def_property_readonly(
+          "Ef_array",
+          [](const CrossSection& xs) -> const xt::xtensor<double, 1>& {
+            return xs.Ef_XS1D().values();
+          },
+          py::return_value_policy::reference_internal,
+          "Read-only array of the fission cross section in each group, sharing "
+          "memory with the cross section.")
+
+      .def_property_readonly(
+          "vEf_array",
+          [](const CrossSection& xs) -> const xt::xtensor<double, 1>& {
+            return xs.vEf_XS1D().values();
+          },
+          py::return_value_policy::reference_internal,
+          "Read-only array of the fission yield * cross section in each group, "
+          "sharing memory with the cross section.")
+
+      .def_property_readonly(
+          "chi_array",
+          [](const CrossSection& xs) -> const xt::xtensor<double, 1>& {
+            return xs.chi_XS1D().values();
+          },
+          py::return_value_policy::reference_internal,
+          "Read-only array of the fission spectrum in each group, sharing "
+          "memory with the cross section.")
+
+      .def(
+          "Es_matrix",
+          [](const CrossSection& xs) {
+            auto Es = xs.Es_XS2D().dense();
+            for (std::size_t g = 0; g < xs.ngroups(); g++) {
+              Es(0, g, g) += xs.Dtr(g);
+            }
+            return Es;
+          },
+          "Unpacks the scattering matrix of all legendre moments, including "
+          "the transport correction, such that the entries are those of "
+          ":py:meth:`Es`.\n\n"
+          "Returns\n"
+          "-------\n"
+          "ndarray\n"
+          "    3D array indexed by legendre moment, incident group, and "
+          "outgoing group.\n")
+
+      .def(
+          "Es_tr_matrix",
+          [](const CrossSection& xs) -> xt::xtensor<double, 2> {
+            return xt::view(xs.Es_XS2D().dense(), 0, xt::all(), xt::all());
+          },
+          "Unpacks the transport corrected P0 scattering matrix, such that "
+          "the entries are those of :py:meth:`Es_tr`.\n\n"
+          "Returns\n"
+          "-------\n"
+          "ndarray\n"
+          "    2D array indexed by incident group and outgoing group.\n")
+
       .def("diffusion_xs", &CrossSection::diffusion_xs,
            "Creates a :py:class:`DiffusionCrossSection` from the cross "
            "section.\n\n"
@@ -373,6 +490,18 @@ void init_CrossSection(py::module& m) {
            "DiffusionCrossSection\n"
            "    Diffusion cross sections.\n")
 
+      .def("memory_usage", &CrossSection::memory_usage,
+           "Number of bytes held by the cross section arrays, for each of "
+           "the xs and scattering components.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
+      .def(py::pickle(
+          [](const CrossSection& xs) { return py::bytes(xs.to_bytes()); },
+          [](const py::bytes& data) { return CrossSection::from_bytes(data); }))
+
       .def("save", &CrossSection::save,
            "Saves the cross section data to a binary file.\n\n"
            "Parameters\n"
@@ -401,4 +530,24 @@ void init_CrossSection(py::module& m) {
 
       .def("__deepcopy__",
            [](const CrossSection& xs, py::dict) { return CrossSection(xs); });
+
+  m.def("condense_cross_sections", &condense_cross_sections,
+        py::call_guard<py::gil_scoped_release>(),
+        "Condenses many sets of cross sections to a new energy group "
+        "structure, each with its own weighting flux spectrum. The "
+        "condensation scheme is only checked once, and the cross sections "
+        "are condensed in parallel.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "xs : list of CrossSection\n"
+        "     The cross sections to condense.\n"
+        "fluxes : list of ndarray of floats.\n"
+        "         The weighting flux spectrum of each set of cross sections.\n"
+        "groups : list of 2D tuples of ints.\n"
+        "         The scheme for condensing energy groups.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of CrossSection\n"
+        "    Condensed cross sections, in the order of xs.\n",
+        py::arg("xs"), py::arg("fluxes"), py::arg("groups"));
 }
@@ -9,6 +9,10 @@ namespace py = pybind11;
 using namespace scarabee;
 
 void init_CylindricalCell(py::module& m) {
+  py::enum_<CPQuadrature>(m, "CPQuadrature")
+      .value("Adaptive", CPQuadrature::Adaptive)
+      .value("FixedNodes", CPQuadrature::FixedNodes);
+
   py::class_<CylindricalCell, std::shared_ptr<CylindricalCell>>(
       m, "CylindricalCell",
       "A CylindricalCell object represents a one dimensional annular problem "
@@ -33,15 +37,60 @@ void init_CylindricalCell(py::module& m) {
           "solved", &CylindricalCell::solved,
           "True is the system has been solved, False otherwise.")
 
+      .def_property("num_threads", &CylindricalCell::num_threads,
+                    &CylindricalCell::set_num_threads,
+                    "Number of threads used by the solver. When 0 (default), "
+                    "one thread is used per pinned core, or the number given "
+                    "by :py:func:`set_default_threads` if it is not pinned.")
+
+      .def_property("cores", &CylindricalCell::cores,
+                    &CylindricalCell::set_cores,
+                    "Cores to which the threads of the solver are pinned, "
+                    "round robin. Empty (default) if they are not pinned. "
+                    "Pinning is only supported on Linux.")
+
       .def("solve", &CylindricalCell::solve,
            py::call_guard<py::gil_scoped_release>(),
-           "Solves the system for partial flux responses.\n\n"
+           "Solves the system for partial flux responses. The collision "
+           "probabilities of the groups whose transport cross sections are "
+           "unchanged since the previous solve are reused.\n\n"
            "Parameters\n"
            "----------\n"
            "parallel : bool\n"
            "  If True, solves the cell in parallel. Default is False.\n",
            py::arg("parallel") = false)
 
+      .def_property("ki3_mode", &CylindricalCell::ki3_mode,
+                    &CylindricalCell::set_ki3_mode,
+                    ":py:class:`Ki3Mode` used to evaluate the Bickley function "
+                    "Ki3 in the collision probabilities. Series (default) "
+                    "evaluates its Chebyshev series, and Table uses a "
+                    "linearly interpolated table with a maximum error of "
+                    "1.E-7.")
+
+      .def_property("cp_quadrature", &CylindricalCell::cp_quadrature,
+                    &CylindricalCell::set_cp_quadrature,
+                    ":py:class:`CPQuadrature` used for the chord integrals of "
+                    "the collision probabilities. Adaptive (default) "
+                    "integrates each group separately, and FixedNodes uses "
+                    "16 Gauss-Legendre nodes per annulus for all groups.")
+
+      .def_property("group_batch_size", &CylindricalCell::group_batch_size,
+                    &CylindricalCell::set_group_batch_size,
+                    "Number of consecutive groups whose response systems are "
+                    "solved by one thread at a time in a parallel solve. When "
+                    "0 (default), it is chosen from the number of regions, so "
+                    "that cells with few regions batch more groups.")
+
+      .def("memory_usage", &CylindricalCell::memory_usage,
+           "Number of bytes currently held by the arrays of the cell, for "
+           "each of the probabilities, response, and geometry components. "
+           "The cross sections are not included.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
       .def_property_readonly("ngroups", &CylindricalCell::ngroups,
                              "Number of energy groups.")
 
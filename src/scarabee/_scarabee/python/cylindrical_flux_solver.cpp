@@ -83,6 +83,14 @@ void init_CylindricalFluxSolver(py::module& m) {
                     &CylindricalFluxSolver::set_albedo,
                     "Albedo for outer cell boundary.")
 
+      .def_property("direct", &CylindricalFluxSolver::direct,
+                    &CylindricalFluxSolver::set_direct,
+                    "If True, the flux of each generation is found with a "
+                    "direct solve instead of inner iterations. Groups "
+                    "without upscatter are solved one after the other, and "
+                    "the upscatter groups with a single LU factorization of "
+                    "their coupled system. Default is False.")
+
       .def_property(
           "sim_mode",
           [](const CylindricalFluxSolver& cfs) -> SimulationMode {
@@ -267,4 +275,25 @@ void init_CylindricalFluxSolver(py::module& m) {
       .def_property_readonly(
           "solved", &CylindricalFluxSolver::solved,
           "True if the system has been solved, False otherwise.");
+
+  m.def("solve_cells", &solve_cells, py::call_guard<py::gil_scoped_release>(),
+        "Solves a list of :py:class:`CylindricalCell` concurrently, with one "
+        "cell per thread. Cells which appear more than once are only solved "
+        "once.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "cells : list of CylindricalCell\n"
+        "    Cells to solve.\n",
+        py::arg("cells"));
+
+  m.def("solve_flux_solvers", &solve_flux_solvers,
+        py::call_guard<py::gil_scoped_release>(),
+        "Solves a list of :py:class:`CylindricalFluxSolver` concurrently, with "
+        "one solver per thread. The cells of the solvers which are not yet "
+        "solved are first solved concurrently as well.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "solvers : list of CylindricalFluxSolver\n"
+        "    Flux solvers to solve.\n",
+        py::arg("solvers"));
 }
@@ -216,6 +216,33 @@ void init_DepletionChain(py::module& m) {
            "    Name of nuclide to remove.\n",
            py::arg("nuclide"))
 
+      .def("reduce", &DepletionChain::reduce,
+           "Makes a reduced copy of the chain, for fast scoping calculations. "
+           "Nuclides with a half life below min_half_life are first removed, "
+           "as with :py:meth:`remove_nuclide`, lumping their branch ratios "
+           "into their parents. Fission products with a cumulative fission "
+           "yield below min_fission_yield are then pruned: those which decay "
+           "are removed in the same way, and stable ones are dropped. "
+           "Fissionable nuclides and nuclides which are not produced by "
+           "fission are never removed. The errors of the reduced chain can be "
+           "estimated with :py:func:`estimate_chain_reduction_error`.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "min_half_life : float\n"
+           "    Minimum half life of the kept nuclides, in seconds.\n"
+           "min_fission_yield : float\n"
+           "    Minimum cumulative fission yield of the kept fission "
+           "products.\n"
+           "keep : set of string\n"
+           "    Nuclides which must not be removed, such as burnable "
+           "absorbers or tracked outputs. Default is an empty set.\n\n"
+           "Returns\n"
+           "-------\n"
+           "DepletionChain\n"
+           "    Reduced depletion chain.\n",
+           py::arg("min_half_life"), py::arg("min_fission_yield"),
+           py::arg("keep") = std::set<std::string>())
+
       .def_property_readonly("nuclides", &DepletionChain::nuclides,
                              "Set of all nuclides that have a chain entry.")
 
@@ -0,0 +1,103 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <xtensor-python/pytensor.hpp>
+
+#include <data/depletion_checkpoint.hpp>
+
+#include <memory>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_DepletionCheckpoint(py::module& m) {
+  py::class_<DepletionCheckpoint, std::shared_ptr<DepletionCheckpoint>>(
+      m, "DepletionCheckpoint",
+      "State of a depletion history after a completed time step, from which "
+      "the history may be resumed.")
+
+      .def(py::init<>())
+
+      .def_readwrite("completed_steps", &DepletionCheckpoint::completed_steps,
+                     "Number of completed depletion steps.")
+      .def_readwrite("keff", &DepletionCheckpoint::keff,
+                     "Multiplication factor of each completed step.")
+      .def_readwrite("exposures", &DepletionCheckpoint::exposures,
+                     "Exposure of each step, in MWd/kg.")
+      .def_readwrite("times", &DepletionCheckpoint::times,
+                     "Time of each step, in days.")
+      .def_readwrite("material_histories",
+                     &DepletionCheckpoint::material_histories,
+                     "List of the compositions of each depleted region.")
+      .def_readwrite("previous_matrices",
+                     &DepletionCheckpoint::previous_matrices,
+                     "Depletion matrix of the previous step of each region, "
+                     "or None.")
+      .def_readwrite("fuel_dancoff_corrections",
+                     &DepletionCheckpoint::fuel_dancoff_corrections,
+                     "List of the Dancoff corrections of each fuel region.")
+      .def_readwrite("clad_dancoff_corrections",
+                     &DepletionCheckpoint::clad_dancoff_corrections,
+                     "List of the Dancoff corrections of each cladding "
+                     "region.")
+      .def_readwrite("moc_keff", &DepletionCheckpoint::moc_keff,
+                     "Multiplication factor of the last transport solution.")
+      .def_readwrite("moc_flux", &DepletionCheckpoint::moc_flux,
+                     "Scalar flux of the last transport solution.")
+      .def_readwrite("diffusion_data", &DepletionCheckpoint::diffusion_data,
+                     "Diffusion data of each completed step.")
+      .def_readwrite("branch_keff", &DepletionCheckpoint::branch_keff,
+                     "Multiplication factor of each branch of each completed "
+                     "step.")
+      .def_readwrite("branch_diffusion_data",
+                     &DepletionCheckpoint::branch_diffusion_data,
+                     "Diffusion data of each branch of each completed step.")
+
+      .def("save", &DepletionCheckpoint::save,
+           py::call_guard<py::gil_scoped_release>(),
+           "Saves the checkpoint to a binary file.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fname : str\n"
+           "        Name of the output file.",
+           py::arg("fname"))
+
+      .def_static("load", &DepletionCheckpoint::load,
+                  py::call_guard<py::gil_scoped_release>(),
+                  "Loads a checkpoint from a binary file.\n\n"
+                  "Parameters\n"
+                  "----------\n"
+                  "fname : str\n"
+                  "        Name of the binary file.\n\n"
+                  "Returns\n"
+                  "-------\n"
+                  "DepletionCheckpoint\n"
+                  "        Checkpoint from the file.",
+                  py::arg("fname"));
+
+  py::class_<CheckpointWriter, std::shared_ptr<CheckpointWriter>>(
+      m, "CheckpointWriter",
+      "Writes depletion checkpoints in the background. Each checkpoint is "
+      "serialized when it is written, and the file is then written by "
+      "another thread, under a temporary name which is renamed once the "
+      "file is complete.")
+
+      .def(py::init<>())
+
+      .def("write", &CheckpointWriter::write,
+           py::call_guard<py::gil_scoped_release>(),
+           "Starts writing a checkpoint, after waiting for the previous "
+           "write to finish.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "checkpoint : DepletionCheckpoint\n"
+           "             Checkpoint to write.\n"
+           "fname : str\n"
+           "        Name of the output file.",
+           py::arg("checkpoint"), py::arg("fname"))
+
+      .def("wait", &CheckpointWriter::wait,
+           py::call_guard<py::gil_scoped_release>(),
+           "Waits for the last write to finish. Raises an error if it "
+           "failed.");
+}
@@ -2,15 +2,29 @@
 #include <pybind11/stl.h>
 #include <xtensor-python/pytensor.hpp>
 
+#include <data/depletion_integrators.hpp>
 #include <data/depletion_matrix.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace py = pybind11;
 
 using namespace scarabee;
 
 void init_DepletionMatrix(py::module& m) {
+  py::enum_<CRAMSolver>(m, "CRAMSolver")
+      .value("Elimination", CRAMSolver::Elimination,
+             "Gaussian elimination without pivoting, over a symbolic "
+             "structure which is shared by all matrices of the same pattern. "
+             "All poles are factorized at once.")
+      .value("SparseLU", CRAMSolver::SparseLU,
+             "Generic sparse LU factorization with partial pivoting.")
+      .value("ParallelSparseLU", CRAMSolver::ParallelSparseLU,
+             "Sparse LU factorization with partial pivoting, with all poles "
+             "factorized concurrently. Intended for a single large matrix, "
+             "such as a full depletion chain.");
+
   py::class_<DepletionMatrix, std::shared_ptr<DepletionMatrix>>(
       m, "DepletionMatrix",
       "Represents a depletion matrix containing transfer terms due to "
@@ -71,9 +85,10 @@ void init_DepletionMatrix(py::module& m) {
       .def(
           "exponential_product",
           [](const DepletionMatrix& m, xt::pytensor<double, 1>& N,
-             bool cram48 = false) {
+             bool cram48, CRAMSolver solver) {
             std::span<double> Nspn(N.data(), N.size());
-            m.exponential_product(Nspn, cram48);
+            py::gil_scoped_release release;
+            m.exponential_product(Nspn, cram48, solver);
           },
           "Computes the matrix product of the input vector N with the "
           "exponential of the depletion matrix. The array N is modified in "
@@ -91,8 +106,13 @@ void init_DepletionMatrix(py::module& m) {
           "    function is complete.\n"
           "cram48 : bool\n"
           "    If True, a 48th order CRAM is used. If False, a 16th order CRAM"
-          "    is employed. Default value is False.\n",
-          py::arg("N"), py::arg("cram48") = false)
+          "    is employed. Default value is False.\n"
+          "solver : CRAMSolver\n"
+          "    Linear solver for the CRAM poles. If a pivot vanishes with "
+          "    Elimination, SparseLU is used instead. Default value is "
+          "    CRAMSolver.Elimination.\n",
+          py::arg("N"), py::arg("cram48") = false,
+          py::arg("solver") = CRAMSolver::Elimination)
 
       .def("__getitem__",
            [](const DepletionMatrix& m,
@@ -120,6 +140,7 @@ void init_DepletionMatrix(py::module& m) {
       [](std::shared_ptr<DepletionChain> chain, std::shared_ptr<Material> mat,
          const xt::pytensor<double, 1>& flux, std::shared_ptr<NDLibrary> ndl) {
         std::span<const double> flux_spn(flux.data(), flux.size());
+        py::gil_scoped_release release;
         return build_depletion_matrix(chain, mat, flux_spn, ndl);
       },
       "Builds a depletion matrix for a given material and flux spectrum.\n\n"
@@ -141,4 +162,235 @@ void init_DepletionMatrix(py::module& m) {
       "    Depletion matrix for the provided material and flux spectrum. The "
       "    matrix has not been multiplied by any time step at this point.\n",
       py::arg("chain"), py::arg("mat"), py::arg("flux"), py::arg("ndl"));
+
+  py::class_<DepletionRequest>(
+      m, "DepletionRequest",
+      "Describes the depletion of one material over a time step, so that many "
+      "materials may be depleted at once by :py:func:`deplete_materials`.")
+
+      .def(py::init([](std::shared_ptr<Material> material,
+                       std::shared_ptr<Material> initial,
+                       const std::vector<double>& flux,
+                       const std::vector<std::shared_ptr<DepletionMatrix>>&
+                           matrices,
+                       const std::vector<std::vector<double>>& substeps,
+                       bool clear_micro_xs) {
+             return DepletionRequest{material, initial,  flux,
+                                     matrices, substeps, clear_micro_xs};
+           }),
+           "Creates a new depletion request. A new depletion matrix A is "
+           "built from material and flux. The number densities of initial "
+           "are then multiplied by exp(F) for each substep, where F is the "
+           "sum of the matrices weighted by the first coefficients of the "
+           "substep, plus A weighted by the last coefficient.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "material : Material\n"
+           "           Material used to build the depletion matrix. Must "
+           "have loaded depletion cross section data.\n"
+           "initial : Material\n"
+           "          Material with the initial number densities.\n"
+           "flux : ndarray\n"
+           "       Flux spectrum in material.\n"
+           "matrices : list of DepletionMatrix\n"
+           "           Known depletion matrices of the step. Default is an "
+           "empty list.\n"
+           "substeps : list of list of float\n"
+           "           Coefficients of each substep, including the time "
+           "step, with one more coefficient than matrices. Default is "
+           "[[1.]].\n"
+           "clear_micro_xs : bool\n"
+           "                 If True, the micro cross sections of material "
+           "are cleared once the matrix is built. Default is False.\n",
+           py::arg("material"), py::arg("initial"), py::arg("flux"),
+           py::arg("matrices") =
+               std::vector<std::shared_ptr<DepletionMatrix>>(),
+           py::arg("substeps") = std::vector<std::vector<double>>{{1.}},
+           py::arg("clear_micro_xs") = false)
+
+      .def_readwrite("material", &DepletionRequest::material,
+                     "Material used to build the depletion matrix.")
+      .def_readwrite("initial", &DepletionRequest::initial,
+                     "Material with the initial number densities.")
+      .def_readwrite("flux", &DepletionRequest::flux, "Flux spectrum.")
+      .def_readwrite("matrices", &DepletionRequest::matrices,
+                     "Known depletion matrices of the step.")
+      .def_readwrite("substeps", &DepletionRequest::substeps,
+                     "Coefficients of each substep.")
+      .def_readwrite("clear_micro_xs", &DepletionRequest::clear_micro_xs,
+                     "If the micro cross sections of material are cleared.");
+
+  py::class_<DepletionResult>(m, "DepletionResult",
+                              "Result of a :py:class:`DepletionRequest`.")
+      .def_readonly("matrix", &DepletionResult::matrix,
+                    "Depletion matrix built from the material and flux.")
+      .def_readonly("material", &DepletionResult::material,
+                    "Depleted material.");
+
+  m.def("deplete_materials", &deplete_materials,
+        py::call_guard<py::gil_scoped_release>(),
+        "Depletes many materials in parallel.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "chain : DepletionChain\n"
+        "        Depletion chain to use for radioactive decay and "
+        "transmutation.\n"
+        "requests : list of DepletionRequest\n"
+        "           Materials to deplete.\n"
+        "ndl : NDLibrary\n"
+        "      Nuclear data library.\n"
+        "cram48 : bool\n"
+        "         If True, CRAM48 is used instead of CRAM16. Default is "
+        "False.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of DepletionResult\n"
+        "  Result of each request, in order.\n",
+        py::arg("chain"), py::arg("requests"), py::arg("ndl"),
+        py::arg("cram48") = false);
+
+  py::class_<ChainReductionError>(
+      m, "ChainReductionError",
+      "Errors in the number densities of a material depleted with a reduced "
+      "depletion chain, relative to the full chain.")
+      .def_readonly("nuclides", &ChainReductionError::nuclides,
+                    "Compared nuclides.")
+      .def_readonly("full_densities", &ChainReductionError::full_densities,
+                    "Number densities with the full chain.")
+      .def_readonly("reduced_densities",
+                    &ChainReductionError::reduced_densities,
+                    "Number densities with the reduced chain.")
+      .def_readonly("relative_errors", &ChainReductionError::relative_errors,
+                    "Relative error of each nuclide.")
+      .def_readonly("max_error_nuclide",
+                    &ChainReductionError::max_error_nuclide,
+                    "Nuclide with the largest relative error.")
+      .def_readonly("max_relative_error",
+                    &ChainReductionError::max_relative_error,
+                    "Largest relative error.");
+
+  m.def(
+      "estimate_chain_reduction_error",
+      [](std::shared_ptr<DepletionChain> full_chain,
+         std::shared_ptr<DepletionChain> reduced_chain,
+         std::shared_ptr<Material> mat, const xt::pytensor<double, 1>& flux,
+         std::shared_ptr<NDLibrary> ndl, double dt, std::size_t nsteps,
+         double min_fraction, bool cram48) {
+        std::span<const double> flux_spn(flux.data(), flux.size());
+        return estimate_chain_reduction_error(full_chain, reduced_chain, mat,
+                                              flux_spn, ndl, dt, nsteps,
+                                              min_fraction, cram48);
+      },
+      "Depletes a material with a reduced depletion chain and with the full "
+      "chain, using a constant flux, and compares the number densities.\n\n"
+      "Parameters\n"
+      "----------\n"
+      "full_chain : DepletionChain\n"
+      "    Full depletion chain.\n"
+      "reduced_chain : DepletionChain\n"
+      "    Reduced depletion chain, from :py:meth:`DepletionChain.reduce`.\n"
+      "mat : Material\n"
+      "    Material to deplete. Must have loaded depletion cross section "
+      "data.\n"
+      "flux : ndarray\n"
+      "    1D Numpy array containing the flux spectrum.\n"
+      "ndl : NDLibrary\n"
+      "    Nuclear data library.\n"
+      "dt : float\n"
+      "    Time step in seconds.\n"
+      "nsteps : int\n"
+      "    Number of time steps. Default is 1.\n"
+      "min_fraction : float\n"
+      "    Nuclides with a number density below this fraction of the total "
+      "are not compared. Default is 1.E-10.\n"
+      "cram48 : bool\n"
+      "    If True, CRAM48 is used instead of CRAM16. Default is False.\n\n"
+      "Returns\n"
+      "-------\n"
+      "ChainReductionError\n"
+      "    Errors of the reduced chain.\n",
+      py::arg("full_chain"), py::arg("reduced_chain"), py::arg("mat"),
+      py::arg("flux"), py::arg("ndl"), py::arg("dt"), py::arg("nsteps") = 1,
+      py::arg("min_fraction") = 1.E-10, py::arg("cram48") = false);
+
+  m.def("celi_predictor_substeps", &celi_predictor_substeps,
+        "Substeps of the CE/LI predictor, for a :py:class:`DepletionRequest` "
+        "with no known matrices, which builds A0.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "dt : float\n"
+        "     Time step in seconds.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of list of float\n"
+        "  Coefficients of each substep.\n",
+        py::arg("dt"));
+
+  m.def("celi_corrector_substeps", &celi_corrector_substeps,
+        "Substeps of the CE/LI corrector, for a :py:class:`DepletionRequest` "
+        "with known matrix A0, which builds A1. With more than one substep, "
+        "the matrix is interpolated linearly over the time step, and the "
+        "CE/LI rule is applied to each substep.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "dt : float\n"
+        "     Time step in seconds.\n"
+        "nsubsteps : int\n"
+        "            Number of substeps. Default is 1.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of list of float\n"
+        "  Coefficients of each substep.\n",
+        py::arg("dt"), py::arg("nsubsteps") = 1);
+
+  m.def("leqi_predictor_substeps", &leqi_predictor_substeps,
+        "Substeps of the LE/QI predictor, for a :py:class:`DepletionRequest` "
+        "with known matrix Am1, which builds A0.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "dt : float\n"
+        "     Time step in seconds.\n"
+        "dtm1 : float\n"
+        "       Previous time step in seconds.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of list of float\n"
+        "  Coefficients of each substep.\n",
+        py::arg("dt"), py::arg("dtm1"));
+
+  m.def("leqi_corrector_substeps", &leqi_corrector_substeps,
+        "Substeps of the LE/QI corrector, for a :py:class:`DepletionRequest` "
+        "with known matrices Am1 and A0, which builds A1.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "dt : float\n"
+        "     Time step in seconds.\n"
+        "dtm1 : float\n"
+        "       Previous time step in seconds.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of list of float\n"
+        "  Coefficients of each substep.\n",
+        py::arg("dt"), py::arg("dtm1"));
+
+  m.def("cf4_substeps", &cf4_substeps,
+        "Substeps of a stage of the fourth order commutator-free integrator "
+        "CF4, where the matrix Fi of stage i is built from the initial "
+        "densities y0 for the first stage, and from the result yi of stage i "
+        "for the others.\n\n"
+        "  Stage 1: initial y0, no known matrices, builds F1 from y0.\n"
+        "  Stage 2: initial y0, no known matrices, builds F2 from y1.\n"
+        "  Stage 3: initial y1, known F1, builds F3 from y2.\n"
+        "  Stage 4: initial y0, known F1, F2, F3, builds F4 from y3.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "stage : int\n"
+        "        Stage, from 1 to 4.\n"
+        "dt : float\n"
+        "     Time step in seconds.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of list of float\n"
+        "  Coefficients of each substep.\n",
+        py::arg("stage"), py::arg("dt"));
 }
@@ -147,7 +147,47 @@ void init_DiffusionCrossSection(py::module& m) {
            "       Outgoing energy group.\n\n",
            py::arg("gin"), py::arg("gout"))
 
-      .def("condense", &DiffusionCrossSection::condense,
+      .def_property_readonly(
+          "D_array", &DiffusionCrossSection::D_array,
+          py::return_value_policy::reference_internal,
+          "Read-only array of the diffusion coefficient in each group, sharing "
+          "memory with the cross section.")
+
+      .def_property_readonly(
+          "Ea_array", &DiffusionCrossSection::Ea_array,
+          py::return_value_policy::reference_internal,
+          "Read-only array of the absorption cross section in each group, "
+          "sharing memory with the cross section.")
+
+      .def_property_readonly(
+          "Ef_array", &DiffusionCrossSection::Ef_array,
+          py::return_value_policy::reference_internal,
+          "Read-only array of the fission cross section in each group, sharing "
+          "memory with the cross section.")
+
+      .def_property_readonly(
+          "vEf_array", &DiffusionCrossSection::vEf_array,
+          py::return_value_policy::reference_internal,
+          "Read-only array of the fission yield * cross section in each group, "
+          "sharing memory with the cross section.")
+
+      .def_property_readonly(
+          "chi_array", &DiffusionCrossSection::chi_array,
+          py::return_value_policy::reference_internal,
+          "Read-only array of the fission spectrum in each group, sharing "
+          "memory with the cross section.")
+
+      .def_property_readonly(
+          "Es_array", &DiffusionCrossSection::Es_array,
+          py::return_value_policy::reference_internal,
+          "Read-only scattering matrix, indexed by incident group and "
+          "outgoing group, sharing memory with the cross section.")
+
+      .def("condense",
+           py::overload_cast<
+               const std::vector<std::pair<std::size_t, std::size_t>>&,
+               const xt::xtensor<double, 1>&>(&DiffusionCrossSection::condense,
+                                              py::const_),
            "Condenses the cross sections to a new energy group structure. The "
            "condensation group structure is provided as a list of pairs "
            "(2D tuples), indicating the lower and upper group indices "
@@ -166,6 +206,14 @@ void init_DiffusionCrossSection(py::module& m) {
            "                      Condensed set of diffusion cross sections.\n",
            py::arg("groups"), py::arg("flux"))
 
+      .def(py::pickle(
+          [](const DiffusionCrossSection& xs) {
+            return py::bytes(xs.to_bytes());
+          },
+          [](const py::bytes& data) {
+            return DiffusionCrossSection::from_bytes(data);
+          }))
+
       .def("save", &DiffusionCrossSection::save,
            "Saves a set of diffusion cross sections to a binary file.\n\n"
            "Parameters\n"
@@ -186,4 +234,26 @@ void init_DiffusionCrossSection(py::module& m) {
           "DiffusionCrossSection\n"
           "    Diffusion cross sections from the file.\n",
           py::arg("fname"));
+
+  m.def("condense_diffusion_cross_sections",
+        &condense_diffusion_cross_sections,
+        py::call_guard<py::gil_scoped_release>(),
+        "Condenses many sets of diffusion cross sections to a new energy "
+        "group structure, each with its own weighting flux spectrum. The "
+        "condensation scheme is only checked once, and the diffusion cross "
+        "sections are condensed in parallel.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "xs : list of DiffusionCrossSection\n"
+        "     The diffusion cross sections to condense.\n"
+        "fluxes : list of ndarray of floats.\n"
+        "         The weighting flux spectrum of each set of diffusion cross "
+        "sections.\n"
+        "groups : list of 2D tuples of ints.\n"
+        "         The scheme for condensing energy groups.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of DiffusionCrossSection\n"
+        "    Condensed diffusion cross sections, in the order of xs.\n",
+        py::arg("xs"), py::arg("fluxes"), py::arg("groups"));
 }
@@ -264,6 +264,12 @@ void init_DiffusionData(py::module& m) {
            "Rotates the ADFs and form factors corresponding to a 90 degree "
            "rotation of the assembly in the counter clockwise direction.")
 
+      .def(py::pickle(
+          [](const DiffusionData& dd) { return py::bytes(dd.to_bytes()); },
+          [](const py::bytes& data) {
+            return DiffusionData::from_bytes(data);
+          }))
+
       .def("save", &DiffusionData::save,
            "Saves the diffuion data to a binary file.\n\n"
            "Parameters\n"
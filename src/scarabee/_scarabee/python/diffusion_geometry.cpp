@@ -1,6 +1,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <xtensor-python/pytensor.hpp>
+
 #include <diffusion/diffusion_geometry.hpp>
 
 namespace py = pybind11;
@@ -66,7 +68,8 @@ void init_DiffusionGeometry(py::module& m) {
                     const std::vector<double>& /*dy*/,
                     const std::vector<std::size_t>& /*ydivs*/,
                     double /*albedo_xn*/, double /*albedo_xp*/,
-                    double /*albedo_yn*/, double /*albedo_yp*/>(),
+                    double /*albedo_yn*/, double /*albedo_yp*/,
+                    DiffusionSymmetry /*symmetry*/>(),
            "Creates a 2D DiffusionGeometry.\n\n"
            "Parameters\n"
            "----------\n"
@@ -87,10 +90,15 @@ void init_DiffusionGeometry(py::module& m) {
            "albedo_yn : float\n"
            "            Albedo at the negative y boundary.\n"
            "albedo_yp : float\n"
-           "            Albedo at the positive y boundary.\n\n",
+           "            Albedo at the positive y boundary.\n"
+           "symmetry : DiffusionSymmetry\n"
+           "           Symmetry of the core. When not Full, the geometry is\n"
+           "           the upper right quadrant of the core, and the negative\n"
+           "           x and y albedos are ignored. Default is Full.\n\n",
            py::arg("tiles"), py::arg("dx"), py::arg("xdivs"), py::arg("dy"),
            py::arg("ydivs"), py::arg("albedo_xn"), py::arg("albedo_xp"),
-           py::arg("albedo_yn"), py::arg("albedo_yp"))
+           py::arg("albedo_yn"), py::arg("albedo_yp"),
+           py::arg("symmetry") = DiffusionSymmetry::Full)
 
       .def(py::init<const std::vector<DiffusionGeometry::TileFill>& /*tiles*/,
                     const std::vector<double>& /*dx*/,
@@ -101,7 +109,8 @@ void init_DiffusionGeometry(py::module& m) {
                     const std::vector<std::size_t>& /*zdivs*/,
                     double /*albedo_xn*/, double /*albedo_xp*/,
                     double /*albedo_yn*/, double /*albedo_yp*/,
-                    double /*albedo_zn*/, double /*albedo_zp*/>(),
+                    double /*albedo_zn*/, double /*albedo_zp*/,
+                    DiffusionSymmetry /*symmetry*/>(),
            "Creates a 3D DiffusionGeometry.\n\n"
            "Parameters\n"
            "----------\n"
@@ -130,11 +139,16 @@ void init_DiffusionGeometry(py::module& m) {
            "albedo_zn : float\n"
            "            Albedo at the negative z boundary.\n"
            "albedo_zp : float\n"
-           "            Albedo at the positive z boundary.\n\n",
+           "            Albedo at the positive z boundary.\n"
+           "symmetry : DiffusionSymmetry\n"
+           "           Symmetry of the core. When not Full, the geometry is\n"
+           "           the upper right quadrant of the core, and the negative\n"
+           "           x and y albedos are ignored. Default is Full.\n\n",
            py::arg("tiles"), py::arg("dx"), py::arg("xdivs"), py::arg("dy"),
            py::arg("ydivs"), py::arg("dz"), py::arg("zdivs"),
            py::arg("albedo_xn"), py::arg("albedo_xp"), py::arg("albedo_yn"),
-           py::arg("albedo_yp"), py::arg("albedo_zn"), py::arg("albedo_zp"))
+           py::arg("albedo_yp"), py::arg("albedo_zn"), py::arg("albedo_zp"),
+           py::arg("symmetry") = DiffusionSymmetry::Full)
 
       .def(
           "neighbor", &DiffusionGeometry::neighbor,
@@ -199,6 +213,65 @@ void init_DiffusionGeometry(py::module& m) {
           "           Geometry indices of material index m.\n",
           py::arg("m"))
 
+      .def("set_tile_xs", &DiffusionGeometry::set_tile_xs,
+           "Replaces the cross sections of a material tile. The mesh is "
+           "unchanged, so that drivers using this geometry can be solved "
+           "again, starting from their previous solution.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "tile_indx : list of int\n"
+           "    Index of the tile along each axis, starting from the "
+           "negative side.\n"
+           "xs : DiffusionData\n"
+           "    New cross section data of the tile.\n",
+           py::arg("tile_indx"), py::arg("xs"))
+
+      .def("set_tiles_xs", &DiffusionGeometry::set_tiles_xs,
+           "Replaces the cross sections of many material tiles at once, such "
+           "as all nodes of a core after a feedback update. The tiles are all "
+           "checked before any is changed.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "tile_indices : list of list of int\n"
+           "    Index of each tile along each axis.\n"
+           "xs : list of DiffusionData\n"
+           "    New cross section data of each tile.\n",
+           py::arg("tile_indices"), py::arg("xs"))
+
+      .def("replace_xs", &DiffusionGeometry::replace_xs,
+           "Replaces the cross sections old_xs by new_xs in every tile where "
+           "they are used, such as all assemblies of one type in a boron "
+           "search.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "old_xs : DiffusionData\n"
+           "    Cross section data to replace.\n"
+           "new_xs : DiffusionData\n"
+           "    New cross section data.\n\n"
+           "Returns\n"
+           "-------\n"
+           "int\n"
+           "    Number of tiles which were changed.\n",
+           py::arg("old_xs"), py::arg("new_xs"))
+
+      .def("form_factor_grid", &DiffusionGeometry::form_factor_grid,
+           "Constructs the form factors of every pin of the whole core, "
+           "indexed as (x, y, z). The pin powers are the product of this "
+           "array with the homogeneous power at the pin centers.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "x_shp : int\n"
+           "    Number of pins along x in each tile.\n"
+           "y_shp : int\n"
+           "    Number of pins along y in each tile.\n"
+           "z : array of float\n"
+           "    Positions along the z axis.\n\n"
+           "Returns\n"
+           "-------\n"
+           "array of float\n"
+           "      Form factors of all pins at all provided z positions.\n",
+           py::arg("x_shp"), py::arg("y_shp"), py::arg("z"))
+
       .def("dx", &DiffusionGeometry::dx,
            "Width in the x direction of the i mesh along the x axis.\n\n"
            "Parameters\n"
@@ -248,5 +321,18 @@ void init_DiffusionGeometry(py::module& m) {
                              "Number of tiles along the y-axis.")
 
       .def_property_readonly("nz", &DiffusionGeometry::nz,
-                             "Number of tiles along the z-axis.");
+                             "Number of tiles along the z-axis.")
+
+      .def_property_readonly(
+          "symmetry", &DiffusionGeometry::symmetry,
+          ":py:class:`DiffusionSymmetry` of the core described by the "
+          "geometry.")
+
+      .def(py::pickle(
+          [](const DiffusionGeometry& geom) {
+            return py::bytes(geom.to_bytes());
+          },
+          [](const py::bytes& data) {
+            return DiffusionGeometry::from_bytes(data);
+          }));
 }
@@ -0,0 +1,14 @@
+#include <pybind11/pybind11.h>
+
+#include <diffusion/diffusion_symmetry.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_DiffusionSymmetry(py::module& m) {
+  py::enum_<DiffusionSymmetry>(m, "DiffusionSymmetry")
+      .value("Full", DiffusionSymmetry::Full)
+      .value("QuarterMirror", DiffusionSymmetry::QuarterMirror)
+      .value("QuarterRotational", DiffusionSymmetry::QuarterRotational);
+}
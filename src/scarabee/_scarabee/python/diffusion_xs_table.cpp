@@ -0,0 +1,141 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <xtensor-python/pytensor.hpp>
+
+#include <diffusion/diffusion_xs_table.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_DiffusionXSTable(py::module& m) {
+  py::class_<DiffusionXSTable, std::shared_ptr<DiffusionXSTable>>(
+      m, "DiffusionXSTable",
+      "Few-group diffusion data tabulated on a rectangular grid of state "
+      "parameters, such as the boron concentration, fuel temperature, "
+      "moderator density, and burnup. States are interpolated multilinearly "
+      "in C++, all at once, and states outside of the grid are clamped to "
+      "its bounds.")
+
+      .def(py::init<const std::vector<std::string>&,
+                    const std::vector<std::vector<double>>&,
+                    const std::vector<std::shared_ptr<DiffusionData>>&>(),
+           "Creates a cross section table.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "params : list of str\n"
+           "    Name of each state parameter.\n"
+           "grids : list of list of float\n"
+           "    Strictly increasing grid values of each parameter.\n"
+           "data : list of DiffusionData\n"
+           "    Data at each grid point, with the index of the last parameter "
+           "varying fastest. All must have the same number of groups, and "
+           "either all or none may have ADFs, CDFs, and form factors.\n",
+           py::arg("params"), py::arg("grids"), py::arg("data"))
+
+      .def_property_readonly("ngroups", &DiffusionXSTable::ngroups,
+                             "Number of energy groups.")
+
+      .def_property_readonly("nparams", &DiffusionXSTable::nparams,
+                             "Number of state parameters.")
+
+      .def_property_readonly("npoints", &DiffusionXSTable::npoints,
+                             "Number of grid points.")
+
+      .def_property_readonly("params", &DiffusionXSTable::params,
+                             "Name of each state parameter.")
+
+      .def("grid", &DiffusionXSTable::grid,
+           "Grid values of a parameter.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "p : int\n"
+           "    Index of the parameter.\n",
+           py::arg("p"))
+
+      .def("param_index", &DiffusionXSTable::param_index,
+           "Index of a parameter.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "name : str\n"
+           "    Name of the parameter.\n",
+           py::arg("name"))
+
+      .def(
+          "interpolate",
+          [](const DiffusionXSTable& table, const std::vector<double>& state) {
+            return table.interpolate(std::span<const double>(state));
+          },
+          "Interpolates the data at one state.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "state : list of float\n"
+          "    Value of each parameter.\n\n"
+          "Returns\n"
+          "-------\n"
+          "DiffusionData\n"
+          "    Interpolated data.\n",
+          py::arg("state"))
+
+      .def(
+          "interpolate",
+          [](const DiffusionXSTable& table,
+             const xt::xtensor<double, 2>& states) {
+            return table.interpolate(states);
+          },
+          py::call_guard<py::gil_scoped_release>(),
+          "Interpolates the data at many states in parallel.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "states : ndarray\n"
+          "    Value of each parameter, indexed by state then parameter.\n\n"
+          "Returns\n"
+          "-------\n"
+          "list of DiffusionData\n"
+          "    Interpolated data of each state.\n",
+          py::arg("states"))
+
+      .def("update_geometry", &DiffusionXSTable::update_geometry,
+           py::call_guard<py::gil_scoped_release>(),
+           "Interpolates the data at the state of each tile, and replaces the "
+           "cross sections of the tiles in the geometry. Drivers using the "
+           "geometry may then be solved again, starting from their previous "
+           "solution.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "geom : DiffusionGeometry\n"
+           "    Geometry to update.\n"
+           "tiles : list of list of int\n"
+           "    Index of each material tile along each axis.\n"
+           "states : ndarray\n"
+           "    Value of each parameter, indexed by tile then parameter.\n",
+           py::arg("geom"), py::arg("tiles"), py::arg("states"))
+
+      .def(py::pickle(
+          [](const DiffusionXSTable& table) {
+            return py::bytes(table.to_bytes());
+          },
+          [](const py::bytes& data) {
+            return DiffusionXSTable::from_bytes(data);
+          }))
+
+      .def("save", &DiffusionXSTable::save,
+           "Saves the cross section table to a binary file.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fname : str\n"
+           "        Name of file in which to save the table.",
+           py::arg("fname"))
+
+      .def_static("load", &DiffusionXSTable::load,
+                  "Loads a cross section table from a binary file.\n\n"
+                  "Parameters\n"
+                  "----------\n"
+                  "fname : str\n"
+                  "        Name of file from which to load the table.\n\n"
+                  "Returns\n"
+                  "-------\n"
+                  "DiffusionXSTable\n"
+                  "    Table from the file.",
+                  py::arg("fname"));
+}
@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/domain_symmetry.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_DomainSymmetry(py::module& m) {
+  py::enum_<DomainSymmetry>(m, "DomainSymmetry")
+      .value("Full", DomainSymmetry::Full)
+      .value("Diagonal", DomainSymmetry::Diagonal);
+}
@@ -0,0 +1,14 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/exponential_mode.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_ExponentialMode(py::module& m) {
+  py::enum_<ExponentialMode>(m, "ExponentialMode")
+      .value("Rational", ExponentialMode::Rational)
+      .value("Table", ExponentialMode::Table)
+      .value("Precomputed", ExponentialMode::Precomputed);
+}
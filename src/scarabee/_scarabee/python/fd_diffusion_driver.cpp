@@ -24,7 +24,9 @@ void init_FDDiffusionDriver(py::module& m) {
            "geom : DiffusionGeometry\n"
            "       Problem deffinition to solve.")
 
-      .def("solve", &FDDiffusionDriver::solve, "Solves the diffusion problem.")
+      .def("solve", &FDDiffusionDriver::solve,
+           py::call_guard<py::gil_scoped_release>(),
+           "Solves the diffusion problem.")
 
       .def_property_readonly(
           "geometry", &FDDiffusionDriver::geometry,
@@ -37,10 +39,37 @@ void init_FDDiffusionDriver(py::module& m) {
           "solved", &FDDiffusionDriver::solved,
           "True if the problem has been solved, False otherwise.")
 
+      .def_property("num_threads", &FDDiffusionDriver::num_threads,
+                    &FDDiffusionDriver::set_num_threads,
+                    "Number of threads used by the solver. When 0 (default), "
+                    "one thread is used per pinned core, or the number given "
+                    "by :py:func:`set_default_threads` if it is not pinned.")
+
+      .def_property("cores", &FDDiffusionDriver::cores,
+                    &FDDiffusionDriver::set_cores,
+                    "Cores to which the threads of the solver are pinned, "
+                    "round robin. Empty (default) if they are not pinned. "
+                    "Pinning is only supported on Linux.")
+
       .def_property_readonly(
           "keff", &FDDiffusionDriver::keff,
           "Value of keff. This is 1 by default is solved is False.")
 
+      .def_property_readonly(
+          "telemetry", &FDDiffusionDriver::telemetry,
+          py::return_value_policy::reference_internal,
+          ":py:class:`SolverTelemetry` of the last solve.")
+
+      .def("memory_usage", &FDDiffusionDriver::memory_usage,
+           "Number of bytes currently held by the arrays of the solver, "
+           "for each of the flux, matrices, operator, and volumes "
+           "components. The storage of the factorizations is not included. "
+           "The total is logged after each solve.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
       .def_property("keff_tolerance", &FDDiffusionDriver::keff_tolerance,
                     &FDDiffusionDriver::set_keff_tolerance,
                     "Maximum relative error in keff for problem convergence.")
@@ -50,6 +79,29 @@ void init_FDDiffusionDriver(py::module& m) {
           &FDDiffusionDriver::set_flux_tolerance,
           "Maximum relative error in the flux for problem convergence.")
 
+      .def_property(
+          "linear_solver", &FDDiffusionDriver::linear_solver,
+          &FDDiffusionDriver::set_linear_solver,
+          ":py:class:`FDLinearSolver` used to solve for the flux in each power "
+          "iteration. The group-wise solvers are only used for keff problems, "
+          "while MatrixFree is used for both. Default is "
+          "FDLinearSolver.BiCGSTAB.")
+
+      .def_property(
+          "warm_start", &FDDiffusionDriver::warm_start,
+          &FDDiffusionDriver::set_warm_start,
+          "If True, a driver which has already been solved starts the next "
+          "solve from its previous flux and keff. This accelerates repeated "
+          "solves after the cross sections of the geometry have been "
+          "changed, as in a critical boron search. Default is True.")
+
+      .def_property(
+          "upscatter_iterations", &FDDiffusionDriver::upscatter_iterations,
+          &FDDiffusionDriver::set_upscatter_iterations,
+          "Number of Gauss-Seidel sweeps over the groups in each power "
+          "iteration with the group-wise solvers. Only used when there is "
+          "upscattering. Default is 1.")
+
       .def_property(
           "sim_mode",
           [](const FDDiffusionDriver& fdd) -> SimulationMode {
@@ -225,7 +277,9 @@ void init_FDDiffusionDriver(py::module& m) {
            "for the x "
            "coordinate. If the problem is 2 or 3 dimensional, the third and "
            "fourth "
-           "indices are for the y and z coordinates respectively.\n\n"
+           "indices are for the y and z coordinates respectively. When the "
+           "geometry is a quadrant of a symmetric core, the flux is unfolded "
+           "over the whole core.\n\n"
            "Returns\n"
            "-------\n"
            "flux : ndarray\n"
@@ -243,7 +297,9 @@ void init_FDDiffusionDriver(py::module& m) {
            "Returns the computed power distribution, along with the mesh "
            "bounds. The first dimension of the power array is for the x "
            "coordinate. If the problem is 2 or 3 dimensional, the second and "
-           "third indices are for the y and z coordinates respectively.\n\n"
+           "third indices are for the y and z coordinates respectively. When "
+           "the geometry is a quadrant of a symmetric core, the power is "
+           "unfolded over the whole core.\n\n"
            "Returns\n"
            "-------\n"
            "power : ndarray\n"
@@ -0,0 +1,16 @@
+#include <pybind11/pybind11.h>
+
+#include <diffusion/fd_linear_solver.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_FDLinearSolver(py::module& m) {
+  py::enum_<FDLinearSolver>(m, "FDLinearSolver")
+      .value("BiCGSTAB", FDLinearSolver::BiCGSTAB)
+      .value("GroupCG", FDLinearSolver::GroupCG)
+      .value("GroupLDLT", FDLinearSolver::GroupLDLT)
+      .value("GroupMultigrid", FDLinearSolver::GroupMultigrid)
+      .value("MatrixFree", FDLinearSolver::MatrixFree);
+}
@@ -49,6 +49,7 @@ void init_FluxCalculator(py::module& m) {
            "    Atomic weight ratio of the nuclide.\n")
 
       .def("solve", &FluxCalculator::solve,
+           py::call_guard<py::gil_scoped_release>(),
            "Solves the slowing down problem.\n")
 
       .def_property_readonly("energy_boundaries",
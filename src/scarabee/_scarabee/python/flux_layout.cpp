@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/flux_layout.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_FluxLayout(py::module& m) {
+  py::enum_<FluxLayout>(m, "FluxLayout")
+      .value("GroupMajor", FluxLayout::GroupMajor)
+      .value("RegionMajor", FluxLayout::RegionMajor);
+}
@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/fsr_order.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_FSROrder(py::module& m) {
+  py::enum_<FSROrder>(m, "FSROrder")
+      .value("Geometry", FSROrder::Geometry)
+      .value("Hilbert", FSROrder::Hilbert);
+}
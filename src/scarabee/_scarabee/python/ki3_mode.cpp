@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <utils/ki3_table.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_Ki3Mode(py::module& m) {
+  py::enum_<Ki3Mode>(m, "Ki3Mode")
+      .value("Series", Ki3Mode::Series)
+      .value("Table", Ki3Mode::Table);
+}
@@ -70,4 +70,23 @@ void init_Logging(py::module& m) {
         "fname : str\n"
         "        Name of log file.\n",
         py::arg("fname"));
+
+  m.def("set_async_logging", &set_async_logging,
+        "Switches console logging between synchronous and asynchronous "
+        "output. In asynchronous mode, messages are queued without "
+        "acquiring the GIL, and a background thread prints them in "
+        "batches. When the queue fills up, debug messages are dropped. "
+        "Should not be called while a solver is running.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "enabled : bool\n"
+        "        If True, console output is asynchronous.\n",
+        py::arg("enabled"), py::call_guard<py::gil_scoped_release>());
+
+  m.def("async_logging", &async_logging,
+        "Returns True if console logging is asynchronous.");
+
+  // The worker thread must print its queue before the interpreter shuts down
+  py::module_::import("atexit").attr("register")(m.attr("set_async_logging"),
+                                                 false);
 }
@@ -188,6 +188,7 @@ void init_Material(py::module& m) {
            py::arg("name"))
 
       .def("carlvik_xs", &Material::carlvik_xs,
+           py::call_guard<py::gil_scoped_release>(),
            "Computes the macroscopic material cross section, self-shielded "
            "according to the Carlvik two-term approximation.\n\n"
            "Parameters\n"
@@ -208,6 +209,7 @@ void init_Material(py::module& m) {
            py::arg("C"), py::arg("Ee"), py::arg("ndl"), py::arg("max_l") = 1)
 
       .def("roman_xs", &Material::roman_xs,
+           py::call_guard<py::gil_scoped_release>(),
            "Computes the macroscopic material cross section, self-shielded "
            "according to the Roman two-term approximation.\n\n"
            "Parameters\n"
@@ -228,6 +230,7 @@ void init_Material(py::module& m) {
            py::arg("C"), py::arg("Ee"), py::arg("ndl"), py::arg("max_l") = 1)
 
       .def("dilution_xs", &Material::dilution_xs,
+           py::call_guard<py::gil_scoped_release>(),
            "Computes the macroscopic material cross section with nuclides "
            "interpolated to the provided dilutions.\n\n"
            "Parameters\n"
@@ -246,6 +249,7 @@ void init_Material(py::module& m) {
            py::arg("dils"), py::arg("ndl"), py::arg("max_l") = 1)
 
       .def("ring_carlvik_xs", &Material::ring_carlvik_xs,
+           py::call_guard<py::gil_scoped_release>(),
            "Computes the macroscopic material cross section, self-shielded "
            "according to the Carlvik two-term approximation for a single ring "
            "of fuel using the Stoker-Weiss method.\n\n"
@@ -343,6 +347,12 @@ void init_Material(py::module& m) {
                     &Material::set_temperature,
                     "Temperature of the material in kelvin.")
 
+      .def_property_readonly(
+          "version", &Material::version,
+          "Counter which is incremented each time the temperature or maximum "
+          "legendre order is changed. Cross sections computed from a "
+          "material with the same version are still valid.")
+
       .def_property_readonly("average_molar_mass",
                              &Material::average_molar_mass,
                              "Average molar of an atom in the material, "
@@ -388,6 +398,10 @@ void init_Material(py::module& m) {
       .def_property("name", &Material::name, &Material::set_name,
                     "String with the name of the Material.")
 
+      .def(py::pickle(
+          [](const Material& mat) { return py::bytes(mat.to_bytes()); },
+          [](const py::bytes& data) { return Material::from_bytes(data); }))
+
       .def("__deepcopy__",
            [](const Material& mat, py::dict) { return Material(mat); });
 
@@ -416,4 +430,113 @@ void init_Material(py::module& m) {
         "Material\n"
         "  Mixture material with averaged temperature.\n",
         py::arg("mats"), py::arg("fracs"), py::arg("f"), py::arg("ndl"));
+
+  m.def("mix_materials_batch", &mix_materials_batch,
+        py::call_guard<py::gil_scoped_release>(),
+        "Creates many mixtures of the same materials at once. The nuclides "
+        "of the materials are only merged once for all mixtures.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "mats : list of Material\n"
+        "       Materials in the mixtures.\n"
+        "fracs : ndarray\n"
+        "        Fraction of each material, indexed by mixture then "
+        "material.\n"
+        "f : MixingFraction\n"
+        "    Indicates if provided fractions are in Atoms, Weight, or Volume.\n"
+        "ndl : NDLibrary\n"
+        "      Nuclear data library.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of Material\n"
+        "  Mixture materials with averaged temperatures.\n",
+        py::arg("mats"), py::arg("fracs"), py::arg("f"), py::arg("ndl"));
+
+  py::enum_<SelfShieldingMethod>(m, "SelfShieldingMethod")
+      .value("Dilution", SelfShieldingMethod::Dilution,
+             "Nuclides are interpolated to prescribed dilutions.")
+      .value("Roman", SelfShieldingMethod::Roman,
+             "Roman two-term rational approximation.")
+      .value("Carlvik", SelfShieldingMethod::Carlvik,
+             "Carlvik two-term rational approximation.")
+      .value("RingCarlvik", SelfShieldingMethod::RingCarlvik,
+             "Carlvik two-term rational approximation for a ring of a fuel "
+             "pellet.");
+
+  py::class_<SelfShieldingRequest>(
+      m, "SelfShieldingRequest",
+      "Describes the self-shielding of one material, so that many materials "
+      "may be self-shielded at once by :py:func:`self_shield_materials`.")
+
+      .def(py::init([](std::shared_ptr<Material> material,
+                       SelfShieldingMethod method, double C, double Ee,
+                       double Rfuel, double Rin, double Rout,
+                       const std::vector<double>& dils,
+                       std::optional<std::size_t> max_l) {
+             return SelfShieldingRequest{material, method, C,    Ee,   Rfuel,
+                                         Rin,      Rout,   dils, max_l};
+           }),
+           "Creates a new self-shielding request. Only the parameters used by "
+           "the chosen method need to be provided.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "material : Material\n"
+           "           Material to self-shield.\n"
+           "method : SelfShieldingMethod\n"
+           "         Self-shielding method.\n"
+           "C : float\n"
+           "    Dancoff correction factor (Roman, Carlvik, RingCarlvik).\n"
+           "Ee : float\n"
+           "     Escape cross section (Roman, Carlvik).\n"
+           "Rfuel : float\n"
+           "        Radius of the fuel pellet (RingCarlvik).\n"
+           "Rin : float\n"
+           "      Inner radius of the ring (RingCarlvik).\n"
+           "Rout : float\n"
+           "       Outer radius of the ring (RingCarlvik).\n"
+           "dils : list of float\n"
+           "       Dilution of each nuclide (Dilution).\n"
+           "max_l : optional int\n"
+           "        Maximum legendre moment. If not provided, the "
+           "max_legendre_order attribute of the material is used. Default is "
+           "None.\n",
+           py::arg("material"), py::arg("method"), py::arg("C") = 0.,
+           py::arg("Ee") = 0., py::arg("Rfuel") = 0., py::arg("Rin") = 0.,
+           py::arg("Rout") = 0., py::arg("dils") = std::vector<double>(),
+           py::arg("max_l") = std::nullopt)
+
+      .def_readwrite("material", &SelfShieldingRequest::material,
+                     "Material to self-shield.")
+      .def_readwrite("method", &SelfShieldingRequest::method,
+                     "Self-shielding method.")
+      .def_readwrite("C", &SelfShieldingRequest::C,
+                     "Dancoff correction factor.")
+      .def_readwrite("Ee", &SelfShieldingRequest::Ee, "Escape cross section.")
+      .def_readwrite("Rfuel", &SelfShieldingRequest::Rfuel,
+                     "Radius of the fuel pellet.")
+      .def_readwrite("Rin", &SelfShieldingRequest::Rin,
+                     "Inner radius of the ring.")
+      .def_readwrite("Rout", &SelfShieldingRequest::Rout,
+                     "Outer radius of the ring.")
+      .def_readwrite("dils", &SelfShieldingRequest::dils,
+                     "Dilution of each nuclide.")
+      .def_readwrite("max_l", &SelfShieldingRequest::max_l,
+                     "Maximum legendre moment.");
+
+  m.def("self_shield_materials", &self_shield_materials,
+        py::call_guard<py::gil_scoped_release>(),
+        "Computes the self-shielded cross sections of many materials in "
+        "parallel. Requests for the same material are evaluated in order, "
+        "one after the other.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "requests : list of SelfShieldingRequest\n"
+        "           Materials to self-shield, with their methods.\n"
+        "ndl : NDLibrary\n"
+        "      Nuclear data library for cross section interpolation.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of CrossSection\n"
+        "  Macroscopic self-shielded cross section of each request.\n",
+        py::arg("requests"), py::arg("ndl"));
 }
@@ -0,0 +1,92 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <data/material_cache.hpp>
+#include <data/nd_library.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_MaterialCache(py::module& m) {
+  py::class_<MaterialCache, std::shared_ptr<MaterialCache>>(
+      m, "MaterialCache",
+      "Least recently used cache of the materials made by "
+      ":py:func:`borated_water` and :py:func:`mix_materials`, for branch "
+      "and search calculations which ask for the same state points many "
+      "times. Requests whose parameters all agree within the relative "
+      "tolerance are given the same :py:class:`Material`, so that the cross "
+      "sections already computed for it may be reused. The materials must "
+      "therefore not be modified. Mixtures are keyed by the identity and "
+      "version of their components.")
+
+      .def(py::init<std::size_t, double>(),
+           "Creates an empty cache.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "capacity : int\n"
+           "           Maximum number of materials kept. Default is 64.\n"
+           "tolerance : float\n"
+           "            Relative tolerance of the state parameters and "
+           "fractions. Default is 1.E-6.",
+           py::arg("capacity") = 64, py::arg("tolerance") = 1.E-6)
+
+      .def("borated_water", &MaterialCache::borated_water,
+           "Makes, or finds in the cache, a :py:class:`Material` for water "
+           "at a desired temperature, pressure, and boron concentration.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "boron_ppm : float\n"
+           "  Concentration of boron in parts per million.\n"
+           "temperature : float\n"
+           "  Temperature of the water in Kelvin.\n"
+           "pressure : float\n"
+           "  Pressure of the water in MPa.\n"
+           "ndl : NDLibrary\n"
+           "  Nuclear data library.\n\n"
+           "Returns\n"
+           "-------\n"
+           "Material\n"
+           "  Material which contains borated water at the desired "
+           "temperature, pressure, and concentration.\n",
+           py::arg("boron_ppm"), py::arg("temperature"), py::arg("pressure"),
+           py::arg("ndl"))
+
+      .def("mix_materials", &MaterialCache::mix_materials,
+           "Makes, or finds in the cache, a mixture of materials.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "mats : list of Material\n"
+           "       Materials in the mixture.\n"
+           "fracs : list of float\n"
+           "       Fraction for each material.\n"
+           "f : MixingFraction\n"
+           "    Indicates if provided fractions are in Atoms, Weight, or "
+           "Volume.\n"
+           "ndl : NDLibrary\n"
+           "      Nuclear data library.\n\n"
+           "Returns\n"
+           "-------\n"
+           "Material\n"
+           "  Mixture material with averaged temperature.\n",
+           py::arg("mats"), py::arg("fracs"), py::arg("f"), py::arg("ndl"))
+
+      .def_property("capacity", &MaterialCache::capacity,
+                    &MaterialCache::set_capacity,
+                    "Maximum number of materials kept. The least recently "
+                    "used ones are dropped first.")
+
+      .def_property("tolerance", &MaterialCache::tolerance,
+                    &MaterialCache::set_tolerance,
+                    "Relative tolerance of the state parameters and "
+                    "fractions. Changing it clears the cache.")
+
+      .def_property_readonly("size", &MaterialCache::size,
+                             "Number of materials in the cache.")
+
+      .def_property_readonly("hits", &MaterialCache::hits,
+                             "Number of requests found in the cache since it "
+                             "was last cleared.")
+
+      .def("clear", &MaterialCache::clear, "Removes all materials.");
+}
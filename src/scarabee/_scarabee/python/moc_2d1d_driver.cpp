@@ -0,0 +1,161 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <moc/moc_2d1d_driver.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_MOC2D1DDriver(py::module& m) {
+  py::class_<MOC2D1DDriver>(m, "MOC2D1DDriver")
+      .def(py::init<const std::vector<std::shared_ptr<Cartesian2D>>&,
+                    const std::vector<double>&, const std::vector<double>&,
+                    const std::vector<double>&, BoundaryCondition,
+                    BoundaryCondition, BoundaryCondition, BoundaryCondition,
+                    BoundaryCondition, BoundaryCondition>(),
+           "Initializes a 3D problem solved with the 2D/1D method. Each axial "
+           "plane is solved by its own :py:class:`MOCDriver`, and the planes "
+           "are coupled by a 1D diffusion problem along z in each radial "
+           "channel. The radial leakage of the planes is the transverse "
+           "leakage of the 1D problems, whose axial leakage is given back to "
+           "the planes as a flat external source. Planes with the same "
+           "radial geometry share one track laydown.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "planes : list of Cartesian2D\n"
+           "    Geometry of each plane, from the bottom up. All must have the "
+           "same radial extent and number of groups.\n"
+           "dz : list of float\n"
+           "    Height of each plane.\n"
+           "dx : list of float\n"
+           "    Widths of the channel mesh along x. The mesh should follow the "
+           "FSR boundaries, usually with one channel per pin cell.\n"
+           "dy : list of float\n"
+           "    Widths of the channel mesh along y.\n"
+           "xminbc : BoundaryCondition\n"
+           "    Boundary condition at the lower x boundary.\n"
+           "xmaxbc : BoundaryCondition\n"
+           "    Boundary condition at the upper x boundary.\n"
+           "yminbc : BoundaryCondition\n"
+           "    Boundary condition at the lower y boundary.\n"
+           "ymaxbc : BoundaryCondition\n"
+           "    Boundary condition at the upper y boundary.\n"
+           "zminbc : BoundaryCondition\n"
+           "    Boundary condition at the bottom. Reflective or Vacuum.\n"
+           "zmaxbc : BoundaryCondition\n"
+           "    Boundary condition at the top. Reflective or Vacuum.\n",
+           py::arg("planes"), py::arg("dz"), py::arg("dx"), py::arg("dy"),
+           py::arg("xminbc") = BoundaryCondition::Reflective,
+           py::arg("xmaxbc") = BoundaryCondition::Reflective,
+           py::arg("yminbc") = BoundaryCondition::Reflective,
+           py::arg("ymaxbc") = BoundaryCondition::Reflective,
+           py::arg("zminbc") = BoundaryCondition::Reflective,
+           py::arg("zmaxbc") = BoundaryCondition::Reflective)
+
+      .def(
+          "generate_tracks",
+          [](MOC2D1DDriver& md, std::uint32_t na, double d,
+             PolarQuadratureType pq) { return md.generate_tracks(na, d, pq); },
+          py::call_guard<py::gil_scoped_release>(),
+          "Traces the tracks of all planes, and finds the FSRs of each "
+          "channel. Planes with the same radial geometry reuse the tracks of "
+          "the first one.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "nangles : int\n"
+          "          Number of azimuthal angles (must be even).\n"
+          "d : float\n"
+          "    Max spacing between tracks of a given angle (in cm).\n"
+          "polar_quad : PolarQuadrature\n"
+          "             Polar quadrature for generating segment lengths.",
+          py::arg("nangles"), py::arg("d"), py::arg("polar_quad"))
+
+      .def("solve", &MOC2D1DDriver::solve,
+           py::call_guard<py::gil_scoped_release>(),
+           "Iterates between the plane and axial solves until keff and the "
+           "channel fluxes converge.")
+
+      .def("plane", &MOC2D1DDriver::plane,
+           "MOCDriver of a plane. Its solver settings may be changed, but it "
+           "must not be given a CMFD.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "p : int\n"
+           "    Index of the plane, from the bottom.\n",
+           py::arg("p"))
+
+      .def("channel_fsrs", &MOC2D1DDriver::channel_fsrs,
+           "FSR indices of a plane in a channel.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "p : int\n"
+           "    Index of the plane.\n"
+           "c : int\n"
+           "    Index of the channel, numbered along x first.\n",
+           py::arg("p"), py::arg("c"))
+
+      .def("channel_flux", &MOC2D1DDriver::channel_flux,
+           "Average flux of a channel in a plane.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "p : int\n"
+           "    Index of the plane.\n"
+           "c : int\n"
+           "    Index of the channel.\n"
+           "g : int\n"
+           "    Energy group index.\n",
+           py::arg("p"), py::arg("c"), py::arg("g"))
+
+      .def("axial_current", &MOC2D1DDriver::axial_current,
+           "Net current in the +z direction through the bottom of a plane, "
+           "in a channel. The top of the last plane is surface nplanes.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "p : int\n"
+           "    Index of the surface.\n"
+           "c : int\n"
+           "    Index of the channel.\n"
+           "g : int\n"
+           "    Energy group index.\n",
+           py::arg("p"), py::arg("c"), py::arg("g"))
+
+      .def_property_readonly("nplanes", &MOC2D1DDriver::nplanes,
+                             "Number of axial planes.")
+
+      .def_property_readonly("nchannels", &MOC2D1DDriver::nchannels,
+                             "Number of radial channels.")
+
+      .def_property_readonly("ngroups", &MOC2D1DDriver::ngroups,
+                             "Number of energy groups.")
+
+      .def_property_readonly("drawn", &MOC2D1DDriver::drawn,
+                             "True if the tracks have been generated.")
+
+      .def_property_readonly(
+          "solved", &MOC2D1DDriver::solved,
+          "True if problem has been solved, False otherwise.")
+
+      .def_property_readonly("keff", &MOC2D1DDriver::keff,
+                             "Multiplication factor of the problem.")
+
+      .def_property("keff_tolerance", &MOC2D1DDriver::keff_tolerance,
+                    &MOC2D1DDriver::set_keff_tolerance,
+                    "Maximum relative change of keff between 2D/1D "
+                    "iterations for convergence. Default is 1.E-5.")
+
+      .def_property("flux_tolerance", &MOC2D1DDriver::flux_tolerance,
+                    &MOC2D1DDriver::set_flux_tolerance,
+                    "Maximum relative change of the channel fluxes between "
+                    "2D/1D iterations for convergence. Default is 1.E-4.")
+
+      .def_property("max_iterations", &MOC2D1DDriver::max_iterations,
+                    &MOC2D1DDriver::set_max_iterations,
+                    "Maximum number of 2D/1D iterations. Default is 100.")
+
+      .def_property("axial_subdivisions",
+                    &MOC2D1DDriver::axial_subdivisions,
+                    &MOC2D1DDriver::set_axial_subdivisions,
+                    "Number of cells of each plane in the 1D diffusion "
+                    "problems. Default is 4.");
+}
@@ -6,9 +6,12 @@
 
 #include <moc/moc_driver.hpp>
 #include <moc/moc_plotter.hpp>
+#include <moc/geometry_raster.hpp>
 #include <utils/logging.hpp>
 #include <utils/scarabee_exception.hpp>
 
+#include <optional>
+#include <string>
 #include <tuple>
 
 namespace py = pybind11;
@@ -73,6 +76,47 @@ void init_MOCDriver(py::module& m) {
           "             Polar quadrature for generating segment lengths.",
           py::arg("nangles"), py::arg("d"), py::arg("polar_quad"))
 
+      .def(
+          "generate_tracks_adaptive",
+          [](MOCDriver& md, PolarQuadratureType pq, double area_tol,
+             double keff_tol, std::uint32_t max_angles, double min_d) {
+            return md.generate_tracks_adaptive(pq, area_tol, keff_tol,
+                                               max_angles, min_d);
+          },
+          py::call_guard<py::gil_scoped_release>(),
+          "Traces tracks with a number of angles and a track spacing which "
+          "are chosen automatically. Starting from 8 angles and a spacing of "
+          "0.2 cm, the spacing is halved until the FSR area error is below "
+          "area_tol. For keff problems, the problem is then solved, and the "
+          "number of angles is doubled or the spacing halved, whichever "
+          "changes keff the most, until neither changes keff by more than "
+          "keff_tol. The problem is solved once per trial laydown.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "polar_quad : PolarQuadrature\n"
+          "             Polar quadrature for generating segment lengths.\n"
+          "area_tol : float\n"
+          "           Tolerance on the FSR area error.\n"
+          "keff_tol : float\n"
+          "           Tolerance on the change of keff. If 0, only the FSR "
+          "areas are checked.\n"
+          "max_angles : int\n"
+          "             Maximum number of azimuthal angles. Default is 128.\n"
+          "min_d : float\n"
+          "        Minimum track spacing (in cm). Default is 0.005.\n\n"
+          "Returns\n"
+          "-------\n"
+          "tuple of int and float\n"
+          "    Chosen number of angles and track spacing.",
+          py::arg("polar_quad"), py::arg("area_tol"), py::arg("keff_tol"),
+          py::arg("max_angles") = 128, py::arg("min_d") = 0.005)
+
+      .def_property_readonly(
+          "fsr_area_error", &MOCDriver::fsr_area_error,
+          "Largest total absolute error of the FSR areas estimated by the "
+          "tracks of one azimuthal angle, before renormalization, relative to "
+          "the total area.")
+
       .def_property_readonly(
           "drawn", &MOCDriver::drawn,
           "True if geometry has been traced, False otherwise.")
@@ -102,6 +146,24 @@ void init_MOCDriver(py::module& m) {
                     "pass, a warning is issued, but the calculation continues. "
                     "Default value is False.")
 
+      .def_property("deduplicate_xs", &MOCDriver::deduplicate_xs,
+                    &MOCDriver::set_deduplicate_xs,
+                    "If True, flat source regions with distinct CrossSection "
+                    "objects whose values agree within xs_dedup_tolerance "
+                    "share one material in the solver. Materials are indexed "
+                    "again at each solve. Default value is True.")
+
+      .def_property(
+          "xs_dedup_tolerance", &MOCDriver::xs_dedup_tolerance,
+          &MOCDriver::set_xs_dedup_tolerance,
+          "Relative tolerance within which cross sections are considered "
+          "identical when deduplicate_xs is True. Default value is 0, which "
+          "only merges cross sections with exactly the same values.")
+
+      .def_property_readonly("num_materials", &MOCDriver::num_materials,
+                             "Number of distinct materials used by the "
+                             "solver.")
+
       .def_property("cmfd", &MOCDriver::cmfd, &MOCDriver::set_cmfd,
                     "CMFD object for convergence acceleration.")
 
@@ -203,6 +265,25 @@ void init_MOCDriver(py::module& m) {
                              "Value of keff estimated by solver (1 by default "
                              "if no solution has been obtained).")
 
+      .def_property_readonly(
+          "telemetry", &MOCDriver::telemetry,
+          py::return_value_policy::reference_internal,
+          ":py:class:`SolverTelemetry` of the last solve, with the time of the "
+          "fill_source, sweep, cmfd, and keff phases, the number of segments "
+          "swept, and the peak size of each component of "
+          ":py:meth:`memory_usage`.")
+
+      .def("memory_usage", &MOCDriver::memory_usage,
+           "Number of bytes currently held by the arrays of the solver, for "
+           "each of the tracks, segments, angular_flux, scalar_flux, source, "
+           "linear_source, exponentials, xs, fsrs, and cmfd components. The "
+           "total is logged after the tracks are generated and after each "
+           "solve.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
       .def_property_readonly("ngroups", &MOCDriver::ngroups,
                              "Number of energy groups.")
 
@@ -216,6 +297,19 @@ void init_MOCDriver(py::module& m) {
       .def("solve", &MOCDriver::solve, py::call_guard<py::gil_scoped_release>(),
            "Begins iterations to solve problem.")
 
+      .def("solve_chords", &MOCDriver::solve_chords,
+           py::call_guard<py::gil_scoped_release>(),
+           "Solves a fixed-source problem without scattering in a single pass "
+           "over the chains of tracks, with the polar angle integrated "
+           "exactly by the Bickley function Ki3, instead of iterating on the "
+           "boundary fluxes. Meant for Dancoff factor calculations.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "black_xs : float\n"
+           "    Total cross section from which a region absorbs every "
+           "neutron entering it. Default is 1.E4.\n",
+           py::arg("black_xs") = 1.E4)
+
       .def_property(
           "sim_mode",
           [](const MOCDriver& md) -> SimulationMode { return md.sim_mode(); },
@@ -223,6 +317,343 @@ void init_MOCDriver(py::module& m) {
           ":py:class:`SimulationMode` describing type of simulation "
           "(fixed-source or keff).")
 
+      .def_property(
+          "sweep_parallelism",
+          [](const MOCDriver& md) -> SweepParallelism {
+            return md.sweep_parallelism();
+          },
+          [](MOCDriver& md, SweepParallelism& p) {
+            md.sweep_parallelism() = p;
+          },
+          ":py:class:`SweepParallelism` describing how the transport sweep "
+          "is distributed between threads. Groups (default) is best when "
+          "there are many energy groups. Tracks is best for few-group "
+          "problems, at the cost of one scalar flux buffer per thread. "
+          "Chains is like Tracks, but sweeps each chain of connected tracks "
+          "from one end to the other, so that boundary angular fluxes are "
+          "from the current iteration. This usually reduces the number of "
+          "iterations for reflective or periodic problems.")
+
+      .def_property(
+          "flux_layout",
+          [](const MOCDriver& md) -> FluxLayout { return md.flux_layout(); },
+          [](MOCDriver& md, FluxLayout& l) { md.flux_layout() = l; },
+          ":py:class:`FluxLayout` of the source and of the thread-private "
+          "flux tallies of the isotropic sweep, when the tracks are "
+          "distributed between threads. GroupMajor (default) stores the "
+          "regions of a group together. RegionMajor stores the groups of a "
+          "region together, which keeps the regions of a track in cache "
+          "while all of its groups are swept, and is best with the Tracks or "
+          "Chains :py:attr:`sweep_parallelism`. It has no effect when the "
+          "groups are distributed between threads. The layout of "
+          ":py:attr:`flux_array` never changes.")
+
+      .def_property(
+          "extrapolation_order", &MOCDriver::extrapolation_order,
+          &MOCDriver::set_extrapolation_order,
+          "Order of the polynomial in solution_step used to extrapolate the "
+          "initial flux, boundary angular flux, and keff of a solve from the "
+          "previous converged solutions. May be 0, 1 (linear), or 2 "
+          "(quadratic). With 0 (default), a solve starts from the previous "
+          "solution.")
+
+      .def_property("solution_step", &MOCDriver::solution_step,
+                    &MOCDriver::set_solution_step,
+                    "Value of the step parameter (e.g. burnup) for the next "
+                    "solve. Used for the extrapolation of the initial guess.")
+
+      .def_property("record_solutions", &MOCDriver::record_solutions,
+                    &MOCDriver::set_record_solutions,
+                    "If False, converged solutions are not added to the "
+                    "solution history, so that solves of perturbed states "
+                    "(e.g. branch calculations) do not change the "
+                    "extrapolation of the following solves. True by default.")
+
+      .def_property_readonly("solution_history_size",
+                             &MOCDriver::solution_history_size,
+                             "Number of previous solutions kept for the "
+                             "extrapolation of the initial guess.")
+
+      .def("clear_solution_history", &MOCDriver::clear_solution_history,
+           "Forgets the previous solutions used for the extrapolation of the "
+           "initial guess.")
+
+      .def("set_initial_solution", &MOCDriver::set_initial_solution,
+           "Starts the next solve from a known solution, such as one saved in "
+           "a checkpoint, instead of a flat flux. Boundary angular fluxes "
+           "start isotropic.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "keff : float\n"
+           "    Initial multiplication factor.\n"
+           "flux : ndarray\n"
+           "    Scalar flux, with the shape of :py:attr:`flux_array`.\n",
+           py::arg("keff"), py::arg("flux"))
+
+      .def_property(
+          "gauss_seidel", &MOCDriver::gauss_seidel,
+          &MOCDriver::set_gauss_seidel,
+          "If True, isotropic outer iterations sweep the energy groups one "
+          "at a time, from fast to thermal, using the fluxes already updated "
+          "in the iteration for the scattering source (multigroup "
+          "Gauss-Seidel). Otherwise, all groups are swept with the fluxes of "
+          "the previous iteration (Jacobi). Default is False.")
+
+      .def_property("thermal_iterations", &MOCDriver::thermal_iterations,
+                    &MOCDriver::set_thermal_iterations,
+                    "Number of sweeps of the groups with upscattering in "
+                    "each Gauss-Seidel outer iteration. Default is 1.")
+
+      .def_property(
+          "group_masking", &MOCDriver::group_masking,
+          &MOCDriver::set_group_masking,
+          "If True, the isotropic source iterations stop sweeping the groups "
+          "whose flux has converged, for as long as their source does not "
+          "change. All groups are swept every group_mask_interval "
+          "iterations, and once more after convergence. Not used with CMFD "
+          "or GMRES. Default is False.")
+
+      .def_property(
+          "group_mask_ratio", &MOCDriver::group_mask_ratio,
+          &MOCDriver::set_group_mask_ratio,
+          "Fraction of the flux tolerance below which the relative change of "
+          "the flux and source of a group must be for it to be skipped. "
+          "Default is 0.1.")
+
+      .def_property(
+          "group_mask_interval", &MOCDriver::group_mask_interval,
+          &MOCDriver::set_group_mask_interval,
+          "Number of iterations between sweeps of all the groups when "
+          "group_masking is True. Default is 10.")
+
+      .def_property(
+          "mpi_group_decomposition", &MOCDriver::mpi_group_decomposition,
+          &MOCDriver::set_mpi_group_decomposition,
+          "If True, each MPI rank sweeps all tracks for its own block of "
+          "groups, instead of a range of tracks for all groups, and the "
+          "scalar fluxes of the blocks are gathered after each sweep. Best "
+          "for problems with many groups. Not available with GMRES. Default "
+          "is False.")
+
+      .def_property(
+          "coarse_presolve_groups", &MOCDriver::coarse_presolve_groups,
+          &MOCDriver::set_coarse_presolve_groups,
+          "Condensation scheme of a coarse-group pre-solve, as a list of the "
+          "first and last fine group of each coarse group. When set, an "
+          "isotropic solve which does not start from a previous solution "
+          "first solves the problem in the coarse groups, on the same "
+          "tracks, with the cross sections of each material condensed with "
+          "its infinite medium spectrum. The coarse flux is prolongated to "
+          "the fine groups with the same spectra, and the boundary angular "
+          "fluxes with the spectrum of the whole geometry. The fine solve "
+          "then starts from this flux and the coarse keff. CMFD is only "
+          "applied to the fine solve. An empty list (default) disables the "
+          "pre-solve.")
+
+      .def_property(
+          "transport_solver",
+          [](const MOCDriver& md) -> TransportSolver {
+            return md.transport_solver();
+          },
+          [](MOCDriver& md, TransportSolver& s) { md.transport_solver() = s; },
+          ":py:class:`TransportSolver` used to converge the scattering source "
+          "and boundary angular fluxes in each outer iteration. "
+          "SourceIteration (default) performs one sweep per outer iteration. "
+          "GMRES solves the within-iteration problem with a matrix-free "
+          "restarted GMRES, which converges much faster for highly "
+          "scattering problems, at the cost of krylov_restart copies of the "
+          "flux and boundary angular fluxes.")
+
+      .def_property(
+          "source_shape",
+          [](const MOCDriver& md) -> SourceShape { return md.source_shape(); },
+          [](MOCDriver& md, SourceShape& s) { md.source_shape() = s; },
+          ":py:class:`SourceShape` of the source within each flat source "
+          "region. Flat (default) uses a constant source. Linear adds a "
+          "gradient about the centroid of each region, obtained from the "
+          "spatial moments of the flux, which gives the same accuracy with a "
+          "much coarser mesh. The linear source is only available for "
+          "isotropic problems solved with source iterations, and always "
+          "evaluates the exponentials exactly.")
+
+      .def_property(
+          "symmetry",
+          [](const MOCDriver& md) -> DomainSymmetry { return md.symmetry(); },
+          [](MOCDriver& md, DomainSymmetry& s) { md.symmetry() = s; },
+          ":py:class:`DomainSymmetry` used to sweep only part of the tracks. "
+          "Full (default) sweeps all tracks. Diagonal sweeps about half of "
+          "them, for square geometries which are symmetric about the "
+          "diagonal from (x_min, y_min) to (x_max, y_max), such as the "
+          "quarter of an octant symmetric assembly. The number of angles must "
+          "then be a multiple of 8, and the boundary conditions of the x and "
+          "y boundaries must be the same. The symmetry of the geometry is "
+          "checked with the tracks at the start of the solve. The fluxes of "
+          "all flat source regions are still computed. Diagonal symmetry is "
+          "not available with CMFD or anisotropic scattering.")
+
+      .def_property(
+          "fsr_order", &MOCDriver::fsr_order, &MOCDriver::set_fsr_order,
+          ":py:class:`FSROrder` of the flat source region indices. Geometry "
+          "(default) numbers the regions by id and instance. Hilbert numbers "
+          "them cell by cell, along a Hilbert curve through the centers of "
+          "the cells, so that the regions crossed one after the other by a "
+          "track are close in memory, which speeds up the sweep of large "
+          "geometries. The flux and the external source are permuted with "
+          "the regions, and the indices given by :py:meth:`get_fsr_indx` "
+          "always follow the current order. Changing it after "
+          ":py:meth:`generate_tracks` requires drawing the tracks again.")
+
+      .def_property(
+          "bundled_sweep", &MOCDriver::bundled_sweep,
+          &MOCDriver::set_bundled_sweep,
+          "If True, the tracks of each azimuthal angle are sorted by their "
+          "position across the angle, and swept in bundles of neighboring "
+          "parallel tracks. Each bundle is swept by one thread, in both "
+          "directions track by track, so that the flat source regions it "
+          "crosses stay in the cache of the thread. The angles are still "
+          "swept in order. It has no effect on the chain parallel sweep, "
+          "and complements the Hilbert :py:attr:`fsr_order`. Default is "
+          "False.")
+
+      .def_property("krylov_tolerance", &MOCDriver::krylov_tolerance,
+                    &MOCDriver::set_krylov_tolerance,
+                    "Relative residual tolerance of the GMRES solver. Default "
+                    "is 1.E-6.")
+
+      .def_property("krylov_restart", &MOCDriver::krylov_restart,
+                    &MOCDriver::set_krylov_restart,
+                    "Number of GMRES iterations between restarts. Default "
+                    "is 20.")
+
+      .def_property("krylov_max_iterations",
+                    &MOCDriver::krylov_max_iterations,
+                    &MOCDriver::set_krylov_max_iterations,
+                    "Maximum number of GMRES iterations in each outer "
+                    "iteration. Default is 200.")
+
+      .def_property("anderson_depth", &MOCDriver::anderson_depth,
+                    &MOCDriver::set_anderson_depth,
+                    "Number of previous outer iterations used for the "
+                    "Anderson mixing of the flux and keff. May be used with "
+                    "or without CMFD. Default is 0 (disabled).")
+
+      .def_property("anderson_damping", &MOCDriver::anderson_damping,
+                    &MOCDriver::set_anderson_damping,
+                    "Damping factor of the Anderson mixing, in the interval "
+                    "(0, 1]. Values below 1 also damp the plain outer "
+                    "iteration when anderson_depth is 0. Default is 1.")
+
+      .def_property("device_sweep", &MOCDriver::device_sweep,
+                    &MOCDriver::set_device_sweep,
+                    "If True, isotropic source iterations without CMFD are "
+                    "swept on the offload device, which keeps the tracks and "
+                    "the boundary angular fluxes resident between sweeps. "
+                    "Requires a build with SCARABEE_USE_GPU. Default is "
+                    "False.")
+
+      .def_property(
+          "exponential_mode",
+          [](const MOCDriver& md) -> ExponentialMode {
+            return md.exponential_mode();
+          },
+          [](MOCDriver& md, ExponentialMode& m) { md.exponential_mode() = m; },
+          ":py:class:`ExponentialMode` used to evaluate the exponentials in "
+          "the transport sweep. Rational (default) uses a rational "
+          "approximation, Table uses a linearly interpolated table, and "
+          "Precomputed stores the exponential of every segment, group, and "
+          "polar angle at the beginning of each solve.")
+
+      .def_property("exp_table_max_error", &MOCDriver::exp_table_max_error,
+                    &MOCDriver::set_exp_table_max_error,
+                    "Maximum absolute error of the interpolated exponential "
+                    "table, used with ExponentialMode.Table. Default is 1E-6.")
+
+      .def_property("exp_max_memory", &MOCDriver::exp_max_memory,
+                    &MOCDriver::set_exp_max_memory,
+                    "Maximum memory in MB used to store exponentials with "
+                    "ExponentialMode.Precomputed. If more would be needed, "
+                    "the rational approximation is used. Default is 2048.")
+
+      .def_property("angular_source_max_memory",
+                    &MOCDriver::angular_source_max_memory,
+                    &MOCDriver::set_angular_source_max_memory,
+                    "Maximum memory in MB of the angular source cache used "
+                    "by the anisotropic sweep. Groups are swept in blocks "
+                    "whose angular sources fit in this memory. Default is "
+                    "2048.")
+
+      .def_property("modular_ray_tracing", &MOCDriver::modular_ray_tracing,
+                    &MOCDriver::set_modular_ray_tracing,
+                    "If True, generate_tracks reduces the track spacing so "
+                    "that there is a whole number of tracks per tile of the "
+                    "geometry along each boundary. Tracks then cross "
+                    "identical tiles in the same way, and the segments of "
+                    "each distinct tile are only traced once. Default is "
+                    "False.")
+
+      .def_property(
+          "on_the_fly_tracing", &MOCDriver::on_the_fly_tracing,
+          &MOCDriver::set_on_the_fly_tracing,
+          "If True, generate_tracks does not store the segments of the "
+          "tracks, and each track is traced again before it is swept. The "
+          "memory then scales with the number of FSRs instead of the number "
+          "of segments, at the cost of tracing during every sweep, which is "
+          "much faster with modular_ray_tracing. Not available with the "
+          "linear source, diagonal symmetry, track caches, or shared tracks. "
+          "Takes effect at the next generate_tracks. Default is False.")
+
+      .def_property(
+          "compressed_segments", &MOCDriver::compressed_segments,
+          &MOCDriver::set_compressed_segments,
+          "If True, generate_tracks stores the FSR index and the length of "
+          "each segment in 4 bytes instead of 12 or 16, with the lengths "
+          "quantized on 16 bits relative to the longest segment of their "
+          "track, and each track is decoded before it is swept. Not "
+          "available with the "
+          "linear source or diagonal symmetry. Takes effect at the next "
+          "generate_tracks. Default is False.")
+
+      .def_property("track_cache_file", &MOCDriver::track_cache_file,
+                    &MOCDriver::set_track_cache_file,
+                    "Path to a track laydown cache file. When set, "
+                    "generate_tracks reuses the tracks stored in the file if "
+                    "they were traced for the same geometry, number of "
+                    "angles, and track spacing. Otherwise, the tracks are "
+                    "traced and then written to the file. Empty by default, "
+                    "meaning no cache is used.")
+
+      .def_property("track_cache_dir", &MOCDriver::track_cache_dir,
+                    &MOCDriver::set_track_cache_dir,
+                    "Path to a directory of track laydown cache files. When "
+                    "set, and no track_cache_file is given, each laydown is "
+                    "cached in its own file of the directory, named after a "
+                    "hash of the geometry, number of angles, and track "
+                    "spacing. The directory may be shared by many drivers "
+                    "and processes. Empty by default.")
+
+      .def_property("share_tracks", &MOCDriver::share_tracks,
+                    &MOCDriver::set_share_tracks,
+                    "If True, generate_tracks reuses the tracks of any other "
+                    "MOCDriver which shares its tracks and was traced for the "
+                    "same geometry, number of angles, and track spacing, "
+                    "instead of tracing them again. Each driver keeps its own "
+                    "materials and fluxes. False by default.")
+
+      .def("retrace_changed_tiles", &MOCDriver::retrace_changed_tiles,
+           py::call_guard<py::gil_scoped_release>(),
+           "Traces again only the tracks crossing the tiles of the geometry "
+           "which were changed with set_tiles since the tracks were traced. "
+           "All other tracks keep their segments. The FSRs of the unchanged "
+           "tiles keep their flux, and the new FSRs start from the average "
+           "flux of the replaced ones, so that the next solve starts from the "
+           "previous solution. Only the tiles of the root geometry are "
+           "compared. Not available with on-the-fly tracing or compressed "
+           "segments.\n\n"
+           "Returns\n"
+           "-------\n"
+           "int\n"
+           "    Number of tracks which were traced again.")
+
       .def_property(
           "x_min_bc",
           [](const MOCDriver& md) -> BoundaryCondition {
@@ -292,6 +723,17 @@ void init_MOCDriver(py::module& m) {
                              "True if solve has been run sucessfully (reset to "
                              "false on generate_tracks).")
 
+      .def_property("num_threads", &MOCDriver::num_threads,
+                    &MOCDriver::set_num_threads,
+                    "Number of threads used by the solver. When 0 (default), "
+                    "one thread is used per pinned core, or the number given "
+                    "by :py:func:`set_default_threads` if it is not pinned.")
+
+      .def_property("cores", &MOCDriver::cores, &MOCDriver::set_cores,
+                    "Cores to which the threads of the solver are pinned, "
+                    "round robin. Empty (default) if they are not pinned. "
+                    "Pinning is only supported on Linux.")
+
       .def("get_all_fsr_in_cell", &MOCDriver::get_all_fsr_in_cell,
            "Obtains the index of all Flat Source Regions contained in the Cell "
            "located at position r.\n\n"
@@ -324,6 +766,23 @@ void init_MOCDriver(py::module& m) {
            "    Index in the MOCDriver of the specified FSR instance.\n",
            py::arg("fsr_id"), py::arg("instance"))
 
+      .def("get_fsr_indxs", &MOCDriver::get_fsr_indxs,
+           "Obtains the indices for a given instance of many flat source "
+           "region IDs at once. This avoids one call per ID when gathering "
+           "the regions of a whole lattice.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fsr_id_sets : list of list of int\n"
+           "    Lists of flat source region IDs.\n"
+           "instance : int\n"
+           "    Desired instance of the provided FSR IDs.\n\n"
+           "Returns\n"
+           "-------\n"
+           "list of list of int\n"
+           "    Index in the MOCDriver of each FSR instance, in the order of "
+           "fsr_id_sets.\n",
+           py::arg("fsr_id_sets"), py::arg("instance"))
+
       .def("set_extern_src",
            py::overload_cast<const Vector&, const Direction&, std::size_t,
                              double>(&MOCDriver::set_extern_src),
@@ -354,6 +813,52 @@ void init_MOCDriver(py::module& m) {
            "      Value of source in the FSR.\n",
            py::arg("i"), py::arg("g"), py::arg("src"))
 
+      .def("set_extern_src",
+           py::overload_cast<const xt::xtensor<std::size_t, 1>&, std::size_t,
+                             double>(&MOCDriver::set_extern_src),
+           "Sets the same external source in many Flat Source Regions.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fsrs : ndarray of int\n"
+           "       Flat Source Region indices.\n"
+           "g : int\n"
+           "    Energy group index.\n"
+           "src : float\n"
+           "      Value of source in the FSRs.\n",
+           py::arg("fsrs"), py::arg("g"), py::arg("src"))
+
+      .def("set_extern_src",
+           py::overload_cast<const xt::xtensor<std::size_t, 1>&, std::size_t,
+                             const xt::xtensor<double, 1>&>(
+               &MOCDriver::set_extern_src),
+           "Sets the external source in many Flat Source Regions.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fsrs : ndarray of int\n"
+           "       Flat Source Region indices.\n"
+           "g : int\n"
+           "    Energy group index.\n"
+           "src : ndarray of float\n"
+           "      Value of source in each FSR of fsrs.\n",
+           py::arg("fsrs"), py::arg("g"), py::arg("src"))
+
+      .def_property_readonly(
+          "flux_array",
+          py::overload_cast<>(&MOCDriver::flux_array),
+          py::return_value_policy::reference_internal,
+          "Scalar flux array, indexed by group, FSR, and spherical harmonic. "
+          "The array shares its memory with the MOCDriver, and is only valid "
+          "until the flux is reallocated, which happens when switching "
+          "between isotropic and anisotropic solutions.")
+
+      .def_property_readonly(
+          "extern_src_array",
+          py::overload_cast<>(&MOCDriver::extern_src_array),
+          py::return_value_policy::reference_internal,
+          "External source array, indexed by group then FSR. The array "
+          "shares its memory with the MOCDriver, and can be written to "
+          "directly. It is only valid until the source is reallocated.")
+
       .def("extern_src",
            py::overload_cast<const Vector&, const Direction&, std::size_t>(
                &MOCDriver::extern_src, py::const_),
@@ -442,6 +947,89 @@ void init_MOCDriver(py::module& m) {
            "                 Homogenized flux spectrum.",
            py::arg("regions"))
 
+      .def("homogenize_sets", &MOCDriver::homogenize_sets,
+           "Computes a homogenized set of cross sections for each list of "
+           "region indices, in a single parallel pass. This is faster than "
+           "calling homogenize for each list.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "region_sets : list of list of int\n"
+           "              Lists of regions for homogenization.\n"
+           "Returns\n"
+           "-------\n"
+           "list of :py:class:`CrossSection`\n"
+           "                                Homogenized cross sections, in the "
+           "order of region_sets.\n",
+           py::arg("region_sets"))
+
+      .def("mesh_fsr_sets", &MOCDriver::mesh_fsr_sets,
+           "Finds the FSRs in each cell of a Cartesian mesh laid from the "
+           "lower left corner of the geometry. Each FSR is placed in the cell "
+           "which holds most of its track length, so the mesh should follow "
+           "the FSR boundaries. The tracks must have been generated.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "dx : list of float\n"
+           "     Widths of the mesh cells along x.\n"
+           "dy : list of float\n"
+           "     Widths of the mesh cells along y.\n"
+           "Returns\n"
+           "-------\n"
+           "list of list of int\n"
+           "                    FSR indices of each cell, with the cells "
+           "numbered along x first.\n",
+           py::arg("dx"), py::arg("dy"))
+
+      .def("add_tally", &MOCDriver::add_tally,
+           "Adds a tally of a reaction rate integrated over each set of "
+           "regions, in each group. All tallies are computed in parallel at "
+           "the end of every solve, from the converged flux. The tallies are "
+           "removed when the regions are numbered again.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "region_sets : list of list of int\n"
+           "              Region indices of each set.\n"
+           "score : TallyScore\n"
+           "        Reaction rate which is tallied.\n\n"
+           "Returns\n"
+           "-------\n"
+           "int\n"
+           "    Index of the tally.",
+           py::arg("region_sets"), py::arg("score"))
+
+      .def("tally", &MOCDriver::tally,
+           "Result of a tally at the last solve, indexed by set then group. "
+           "It is empty until the next solve after the tally was added.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "t : int\n"
+           "    Index of the tally.\n\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray\n"
+           "    Reaction rate of each set and group.",
+           py::arg("t"))
+
+      .def_property_readonly("num_tallies", &MOCDriver::num_tallies,
+                             "Number of tallies.")
+
+      .def("clear_tallies", &MOCDriver::clear_tallies, "Removes all tallies.")
+
+      .def("homogenize_flux_spectra", &MOCDriver::homogenize_flux_spectra,
+           "Computes a homogenized flux spectrum for each list of region "
+           "indices, in a single parallel pass. This method will raise an "
+           "exception if the problem has not yet been solved.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "region_sets : list of list of int\n"
+           "              Lists of regions for homogenization.\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray of floats\n"
+           "                 Homogenized flux spectra, indexed by set and "
+           "group.",
+           py::arg("region_sets"))
+
       .def("apply_criticality_spectrum", &MOCDriver::apply_criticality_spectrum,
            "Modifies the flux spectrum of the solved problem by multiplying "
            "the value of the flux by the ratio of the provided criticality "
@@ -452,7 +1040,9 @@ void init_MOCDriver(py::module& m) {
            "       Criticality spectrum from a P1 or B1 calculation.\n",
            py::arg("flux"))
 
-      .def("trace_fsr_segments", &MOCDriver::trace_fsr_segments,
+      .def("trace_fsr_segments",
+           py::overload_cast<const Vector, const Direction&>(
+               &MOCDriver::trace_fsr_segments, py::const_),
            "Starting from a given position and direction, this function traces "
            "across the geometry until leaving the problem domain, returning a "
            "list of FSR index - distance pairs.\n\n"
@@ -468,6 +1058,74 @@ void init_MOCDriver(py::module& m) {
            "    All the FSR index - distance pairs.\n",
            py::arg("r_start"), py::arg("u"))
 
+      .def("trace_many_fsr_segments",
+           py::overload_cast<const xt::xtensor<double, 2>&, const Direction&>(
+               &MOCDriver::trace_fsr_segments, py::const_),
+           py::call_guard<py::gil_scoped_release>(),
+           "Traces across the geometry from each of the starting positions, "
+           "in parallel, until leaving the problem domain.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "r_start : ndarray of floats\n"
+           "    Starting positions, as an (N, 2) array of x and y.\n"
+           "u : Direction\n"
+           "    Direction to trace segments.\n\n"
+           "Returns\n"
+           "-------\n"
+           "list of list of pairs of int and float\n"
+           "    The FSR index - distance pairs of each starting position.\n",
+           py::arg("r_start"), py::arg("u"))
+
+      .def("get_fsr_indices", &MOCDriver::get_fsr_indices,
+           py::call_guard<py::gil_scoped_release>(),
+           "Obtains the index of the Flat Source Region at each position, in "
+           "parallel.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "r : ndarray of floats\n"
+           "    Positions, as an (N, 2) array of x and y.\n"
+           "u : Direction\n"
+           "    Direction vector used to disambiguate the FSRs.\n\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray of int\n"
+           "    Index of the FSR at each position.\n",
+           py::arg("r"), py::arg("u"))
+
+      .def("fluxes", &MOCDriver::fluxes,
+           py::call_guard<py::gil_scoped_release>(),
+           "Returns the scalar flux in all groups at each position, in "
+           "parallel.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "r : ndarray of floats\n"
+           "    Positions, as an (N, 2) array of x and y.\n"
+           "u : Direction\n"
+           "    Direction vector used to disambiguate the FSRs.\n"
+           "lj : int\n"
+           "    Spherical harmonic index. Default is zero.\n\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray of floats\n"
+           "    Flux indexed by position and group.\n",
+           py::arg("r"), py::arg("u"), py::arg("lj") = 0)
+
+      .def("fsr_fluxes", &MOCDriver::fsr_fluxes,
+           py::call_guard<py::gil_scoped_release>(),
+           "Returns the scalar flux in all groups of each Flat Source "
+           "Region.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fsrs : ndarray of int\n"
+           "    Flat Source Region indices.\n"
+           "lj : int\n"
+           "    Spherical harmonic index. Default is zero.\n\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray of floats\n"
+           "    Flux indexed by FSR and group.\n",
+           py::arg("fsrs"), py::arg("lj") = 0)
+
       .def(
           "plot",
           [](const MOCDriver& md) {
@@ -478,6 +1136,41 @@ void init_MOCDriver(py::module& m) {
           },
           "Open the graphical MOC geometry plotting window.")
 
+      .def(
+          "render_png",
+          [](const MOCDriver& md, const std::string& fname,
+             std::size_t nx, std::size_t ny, PlotColorBy color_by,
+             bool outline_boundaries, std::optional<std::size_t> g) {
+            if (g) {
+              render_flux_png(md, fname, nx, ny, *g, outline_boundaries);
+            } else {
+              render_geometry_png(*md.geometry(), fname, nx, ny, color_by,
+                                  outline_boundaries);
+            }
+          },
+          "Writes a PNG image of the geometry, or of the flux in one group, "
+          "without opening a window. This uses the same tile parallel "
+          "rasterization as the plot window.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "fname : str\n"
+          "    Name of the PNG file.\n"
+          "nx : int\n"
+          "    Number of pixels along x.\n"
+          "ny : int\n"
+          "    Number of pixels along y.\n"
+          "color_by : PlotColorBy\n"
+          "    Property which gives the colors of the regions of the geometry. "
+          "Default is PlotColorBy.MaterialName.\n"
+          "outline_boundaries : bool\n"
+          "    If the boundaries of the regions are drawn. Default is True.\n"
+          "g : int, optional\n"
+          "    Group of the scalar flux to draw instead of the geometry. The "
+          "system must be solved.",
+          py::arg("fname"), py::arg("nx"), py::arg("ny"),
+          py::arg("color_by") = PlotColorBy::MaterialName,
+          py::arg("outline_boundaries") = true, py::arg("g") = std::nullopt)
+
       .def(
           "rasterize_flux",
           [](const MOCDriver& md, std::size_t nx, std::size_t ny) {
@@ -559,7 +1252,9 @@ void init_MOCDriver(py::module& m) {
           py::arg("nx"), py::arg("ny"))
 
       .def("save", &MOCDriver::save_bin,
-           "Saves MOCDriver to a binary file.\n\n"
+           "Saves MOCDriver to a binary file. The tracks, segments, and flux "
+           "arrays are written as contiguous arrays, and the cross sections "
+           "are only stored once, with the geometry.\n\n"
            "Parameters\n"
            "----------\n"
            "fname : str\n"
@@ -567,10 +1262,24 @@ void init_MOCDriver(py::module& m) {
            py::arg("fname"))
 
       .def_static("load", &MOCDriver::load_bin,
-                  "Loads MOCDriver from a binary file.\n\n"
+                  "Loads MOCDriver from a binary file. Files written by "
+                  "older versions of Scarabee can still be loaded.\n\n"
                   "Parameters\n"
                   "----------\n"
                   "fname : str\n"
                   "        Name of file.\n",
                   py::arg("fname"));
+
+  m.def("solve_all", &solve_all, py::call_guard<py::gil_scoped_release>(),
+        "Solves many MOCDriver instances, sharing the threads between them.\n"
+        "Drivers holding at least a 1 / nthreads share of the total work are\n"
+        "solved one after the other with all threads. All other drivers are\n"
+        "solved at the same time, each with a single thread, starting from\n"
+        "the largest. This is much faster than solving each small driver\n"
+        "from its own Python thread.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "drivers : list of MOCDriver\n"
+        "    Drivers to solve. All must have their tracks generated.\n",
+        py::arg("drivers"));
 }
@@ -1,10 +1,16 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <xtensor-python/pytensor.hpp>
+
 #include <data/nd_library.hpp>
 #include <utils/constants.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace py = pybind11;
 
@@ -77,7 +83,10 @@ void init_NDLibrary(py::module& m) {
            "       Name of the desired nuclide.",
            py::arg("name"))
 
-      .def("infinite_dilution_xs", &NDLibrary::infinite_dilution_xs,
+      .def("infinite_dilution_xs",
+           py::overload_cast<const std::string&, double, std::size_t>(
+               &NDLibrary::infinite_dilution_xs),
+           py::call_guard<py::gil_scoped_release>(),
            "Calculates the infinite dilution cross sections for the nuclide at "
            "the desired temperatures.\n\n"
            "Parameters\n"
@@ -94,7 +103,10 @@ void init_NDLibrary(py::module& m) {
            "  Interpolated infinite dilution cross sections at desired "
            "temperature.")
 
-      .def("dilution_xs", &NDLibrary::dilution_xs,
+      .def("dilution_xs",
+           py::overload_cast<const std::string&, std::size_t, double, double,
+                             std::size_t>(&NDLibrary::dilution_xs),
+           py::call_guard<py::gil_scoped_release>(),
            "Interpolates the cross section of the prescribed nuclide at the "
            "prescribed energy group to the desired temperature and dilution. "
            "If the nuclide is not resonant or the desired group g is not "
@@ -119,7 +131,60 @@ void init_NDLibrary(py::module& m) {
            py::arg("max_l") = 1)
 
       .def(
-          "two_term_xs", &NDLibrary::two_term_xs,
+          "dilution_xs_batch",
+          [](NDLibrary& ndl, const std::vector<std::string>& names,
+             const std::vector<std::size_t>& groups,
+             const std::vector<double>& temps,
+             const std::vector<double>& dils) {
+            if (groups.size() != names.size() ||
+                temps.size() != names.size() || dils.size() != names.size()) {
+              auto mssg =
+                  "The names, groups, temps, and dils must all have the same "
+                  "length.";
+              spdlog::error(mssg);
+              throw ScarabeeException(mssg);
+            }
+
+            std::vector<DilutionQuery> queries(names.size());
+            for (std::size_t i = 0; i < names.size(); i++) {
+              queries[i] = {ndl.nuclide_id(names[i]), groups[i], temps[i],
+                            dils[i]};
+            }
+
+            auto out = xt::xtensor<double, 2>::from_shape(
+                {std::size_t(5), queries.size()});
+            py::gil_scoped_release release;
+            ndl.dilution_xs_batch(queries, out);
+            return out;
+          },
+          "Interpolates the resonant cross sections of many nuclides, energy "
+          "groups, temperatures, and dilutions at once. Queries of the same "
+          "nuclide should be adjacent.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "names : list of str\n"
+          "        Name of the nuclide of each query.\n"
+          "groups : list of int\n"
+          "         Energy group index of each query.\n"
+          "temps : list of float\n"
+          "        Temperature of each query in kelvin.\n"
+          "dils : list of float\n"
+          "       Dilution of each query in barns.\n\n"
+          "Returns\n"
+          "-------\n"
+          "ndarray\n"
+          "  Array of shape (5, len(names)) with the transport correction, "
+          "absorption, fission, (n,gamma), and total P0 scattering cross "
+          "sections of each query.",
+          py::arg("names"), py::arg("groups"), py::arg("temps"),
+          py::arg("dils"))
+
+      .def(
+          "two_term_xs",
+          py::overload_cast<const std::string&, std::size_t, double, double,
+                            double, double, double, std::size_t>(
+              &NDLibrary::two_term_xs),
+          py::call_guard<py::gil_scoped_release>(),
           "Uses the two-term rational approximation for self shielding of "
           "cross sections, where the fuel escape probability is approximated "
           "as \n\n"
@@ -166,7 +231,12 @@ void init_NDLibrary(py::module& m) {
           py::arg("name"), py::arg("g"), py::arg("temp"), py::arg("b1"),
           py::arg("b2"), py::arg("xs1"), py::arg("xs2"), py::arg("max_l") = 1)
 
-      .def("ring_two_term_xs", &NDLibrary::ring_two_term_xs,
+      .def("ring_two_term_xs",
+           py::overload_cast<const std::string&, std::size_t, double, double,
+                             double, double, double, double, double, double,
+                             double, double, std::size_t>(
+               &NDLibrary::ring_two_term_xs),
+           py::call_guard<py::gil_scoped_release>(),
            "Uses the two-term rational approximation and the Stoker-Weiss "
            "method to produce the self-shielded cross sections for a single "
            "nuclide in a ring of fuel. If the nuclide is not resonant or the "
@@ -208,9 +278,110 @@ void init_NDLibrary(py::module& m) {
            py::arg("N"), py::arg("Rfuel"), py::arg("Rin"), py::arg("Rout"),
            py::arg("max_l") = 1)
 
+      .def("save_binary", &NDLibrary::save_binary,
+           py::call_guard<py::gil_scoped_release>(),
+           "Writes the data of all nuclides to a flat binary file, which can "
+           "then be memory mapped with :py:meth:`map_binary` instead of "
+           "reading the nuclides from the HDF5 file.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fname : str\n"
+           "        Name of the binary file to write.\n",
+           py::arg("fname"))
+
+      .def("map_binary", &NDLibrary::map_binary,
+           "Memory maps a binary file written by :py:meth:`save_binary` for "
+           "this library. All nuclides are then loaded without copying, and "
+           "the data is only read from the disk when first accessed. Pages "
+           "are shared between all processes mapping the same file. The "
+           "file must have been written by a build storing the nuclear data "
+           "with the same precision.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fname : str\n"
+           "        Name of the binary file.\n",
+           py::arg("fname"))
+
+      .def("load_nuclides", &NDLibrary::load_nuclides,
+           py::call_guard<py::gil_scoped_release>(),
+           "Reads the data of many nuclides from the HDF5 file. Once loaded, "
+           "nuclides may be used from many threads without any further file "
+           "access. Data already loaded by another NDLibrary for the same "
+           "file is shared instead of being read again.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "names : list of str\n"
+           "        Names of the nuclides to load.\n"
+           "max_l : int\n"
+           "        Maximum legendre moment (default is 1).\n",
+           py::arg("names"), py::arg("max_l") = 1)
+
+      .def("prefetch", &NDLibrary::prefetch,
+           py::call_guard<py::gil_scoped_release>(),
+           "Starts reading the data of many nuclides on another thread, and "
+           "returns at once, so that the file is read while the model is "
+           "being built. Nuclides used before they have been read are loaded "
+           "on demand, or waited for if their read has already started. "
+           "Errors while reading are raised by :py:meth:`wait_prefetch`.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "names : list of str\n"
+           "        Names of the nuclides to load.\n"
+           "max_l : int\n"
+           "        Maximum legendre moment (default is 1).\n",
+           py::arg("names"), py::arg("max_l") = 1)
+
+      .def("wait_prefetch", &NDLibrary::wait_prefetch,
+           py::call_guard<py::gil_scoped_release>(),
+           "Waits for all prefetches to finish. Raises an error if any of "
+           "them failed.")
+
+      .def_property_readonly("prefetching", &NDLibrary::prefetching,
+                             "True while a prefetch is still reading data.")
+
       .def("unload", &NDLibrary::unload,
+           py::call_guard<py::gil_scoped_release>(),
            "Deallocates all NuclideHandles which contained raw nuclear data.")
 
+      .def("memory_usage", &NDLibrary::memory_usage,
+           "Number of bytes of nuclear data of the loaded nuclides, for "
+           "each of the infinite_dilution, resonance, and other "
+           "components. Data shared with other libraries, or mapped from a "
+           "binary library, are counted in full.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
+      .def_property("xs_cache", &NDLibrary::xs_cache, &NDLibrary::set_xs_cache,
+                    "If True, the results of :py:meth:`two_term_xs` and "
+                    ":py:meth:`ring_two_term_xs` are memoized, and queries of "
+                    "the same nuclide and group, with temperatures and "
+                    "escape parameters which agree within "
+                    ":py:attr:`xs_cache_tolerance`, share one result. The "
+                    "cache is shared by all materials using the library, and "
+                    "should be cleared with :py:meth:`clear_xs_cache` "
+                    "whenever the compositions or temperatures change. "
+                    "Default is False.")
+
+      .def_property("xs_cache_tolerance", &NDLibrary::xs_cache_tolerance,
+                    &NDLibrary::set_xs_cache_tolerance,
+                    "Relative tolerance within which the parameters of two "
+                    "queries are considered equal by the cross section "
+                    "cache. Zero only reuses identical queries. Changing it "
+                    "clears the cache. Default is 1.E-6.")
+
+      .def("clear_xs_cache", &NDLibrary::clear_xs_cache,
+           "Removes all results from the cross section cache.")
+
+      .def_property_readonly("xs_cache_size", &NDLibrary::xs_cache_size,
+                             "Number of results in the cross section cache.")
+
+      .def_property_readonly(
+          "xs_cache_hits", &NDLibrary::xs_cache_hits,
+          "Number of queries answered by the cross section cache since it "
+          "was last cleared.")
+
       .def_property_readonly("library", &NDLibrary::library,
                              "Name of the nuclear data library (if provided).")
 
@@ -23,7 +23,9 @@ void init_NEMDiffusionDriver(py::module& m) {
            "geom : DiffusionGeometry\n"
            "       Problem deffinition to solve.")
 
-      .def("solve", &NEMDiffusionDriver::solve, "Solves the diffusion problem.")
+      .def("solve", &NEMDiffusionDriver::solve,
+           py::call_guard<py::gil_scoped_release>(),
+           "Solves the diffusion problem.")
 
       .def_property_readonly(
           "geometry", &NEMDiffusionDriver::geometry,
@@ -36,10 +38,37 @@ void init_NEMDiffusionDriver(py::module& m) {
           "solved", &NEMDiffusionDriver::solved,
           "True if the problem has been solved, False otherwise.")
 
+      .def_property("num_threads", &NEMDiffusionDriver::num_threads,
+                    &NEMDiffusionDriver::set_num_threads,
+                    "Number of threads used by the solver. When 0 (default), "
+                    "one thread is used per pinned core, or the number given "
+                    "by :py:func:`set_default_threads` if it is not pinned.")
+
+      .def_property("cores", &NEMDiffusionDriver::cores,
+                    &NEMDiffusionDriver::set_cores,
+                    "Cores to which the threads of the solver are pinned, "
+                    "round robin. Empty (default) if they are not pinned. "
+                    "Pinning is only supported on Linux.")
+
       .def_property_readonly(
           "keff", &NEMDiffusionDriver::keff,
           "Value of keff. This is 1 by default is solved is False.")
 
+      .def_property_readonly(
+          "telemetry", &NEMDiffusionDriver::telemetry,
+          py::return_value_policy::reference_internal,
+          ":py:class:`SolverTelemetry` of the last solve.")
+
+      .def("memory_usage", &NEMDiffusionDriver::memory_usage,
+           "Number of bytes currently held by the arrays of the solver, "
+           "for each of the flux, response_matrices, reconstruction, "
+           "geometry, and cmfd components. The total is logged after each "
+           "solve.\n\n"
+           "Returns\n"
+           "-------\n"
+           "dict of str to int\n"
+           "    Bytes held by each component.")
+
       .def_property("keff_tolerance", &NEMDiffusionDriver::keff_tolerance,
                     &NEMDiffusionDriver::set_keff_tolerance,
                     "Maximum relative error in keff for problem convergence.")
@@ -49,12 +78,58 @@ void init_NEMDiffusionDriver(py::module& m) {
           &NEMDiffusionDriver::set_flux_tolerance,
           "Maximum relative error in the flux for problem convergence.")
 
+      .def_property(
+          "red_black_sweep", &NEMDiffusionDriver::red_black_sweep,
+          &NEMDiffusionDriver::set_red_black_sweep,
+          "If True, the nodes are swept in a red-black (checkerboard) order, "
+          "where all nodes of one color are solved in parallel. Otherwise, "
+          "the nodes are solved serially. Default is True.")
+
+      .def_property(
+          "cmfd", &NEMDiffusionDriver::cmfd, &NEMDiffusionDriver::set_cmfd,
+          "If True, each outer iteration is followed by a nonlinear CMFD "
+          "solve on the node mesh, whose coupling coefficients are corrected "
+          "with the NEM partial currents. The node fluxes and currents are "
+          "then rescaled by the CMFD solution. Default is False.")
+
+      .def_property(
+          "inner_iterations", &NEMDiffusionDriver::inner_iterations,
+          &NEMDiffusionDriver::set_inner_iterations,
+          "Maximum number of inner iterations (node sweeps) performed in "
+          "each outer iteration. Default is 2.")
+
+      .def_property(
+          "inner_tolerance", &NEMDiffusionDriver::inner_tolerance,
+          &NEMDiffusionDriver::set_inner_tolerance,
+          "Maximum relative change in the node average fluxes between two "
+          "inner iterations, below which the remaining inner iterations of "
+          "the outer iteration are skipped. Zero always performs all inner "
+          "iterations. Default is 0.")
+
+      .def_property(
+          "wielandt_shift", &NEMDiffusionDriver::wielandt_shift,
+          &NEMDiffusionDriver::set_wielandt_shift,
+          "Shift added to keff to obtain the Wielandt eigenvalue estimate. "
+          "When positive, the shifted fission source is updated before each "
+          "inner iteration, accelerating the outer iterations of cores with "
+          "a high dominance ratio. Zero disables the shift. Default is 0.")
+
+      .def_property(
+          "warm_start", &NEMDiffusionDriver::warm_start,
+          &NEMDiffusionDriver::set_warm_start,
+          "If True, a driver which has already been solved starts the next "
+          "solve from its previous flux, partial currents, and keff. This "
+          "accelerates repeated solves after the cross sections of the "
+          "geometry have been changed, as in a critical boron search. "
+          "Default is True.")
+
       .def("flux",
            py::overload_cast<double /*x*/, double /*y*/, double /*z*/,
                              std::size_t /*g*/>(&NEMDiffusionDriver::flux,
                                                 py::const_),
            "Calculates the flux at the desired position and group. The "
-           "lowest value for any coordinate is 0.\n\n"
+           "lowest value for any coordinate is 0. When the geometry is a "
+           "quadrant of a symmetric core, x and y span the whole core.\n\n"
            "Parameters\n"
            "----------\n"
            "x : float\n"
@@ -95,7 +170,8 @@ void init_NEMDiffusionDriver(py::module& m) {
 
       .def("avg_flux", &NEMDiffusionDriver::avg_flux,
            "Constructs an array storing the value of the average flux in "
-           "each node. The resulting array is indexed as (g, x, y, z).\n\n"
+           "each node. The resulting array is indexed as (g, x, y, z), and "
+           "covers the whole core for a symmetric geometry.\n\n"
            "Returns\n"
            "-------\n"
            "array of float\n"
@@ -105,7 +181,8 @@ void init_NEMDiffusionDriver(py::module& m) {
            py::overload_cast<double /*x*/, double /*y*/, double /*z*/>(
                &NEMDiffusionDriver::power, py::const_),
            "Calculates the power density at the desired position. The lowest "
-           "value for any coordinate is 0.\n\n"
+           "value for any coordinate is 0. When the geometry is a quadrant "
+           "of a symmetric core, x and y span the whole core.\n\n"
            "Parameters\n"
            "----------\n"
            "x : float\n"
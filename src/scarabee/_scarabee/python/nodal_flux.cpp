@@ -0,0 +1,271 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <xtensor-python/pytensor.hpp>
+
+#include <diffusion/nodal_flux.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_NodalFlux(py::module& m) {
+  py::class_<NodalFlux1D>(
+      m, "NodalFlux1D",
+      "The transverse integrated homogeneous flux of a node, from a 1D nodal "
+      "diffusion calculation using the Nodal Expansion Method (NEM) with "
+      "reference currents and average fluxes. The primary use of this class "
+      "is for computing the homogeneous flux that is required to define "
+      "discontinuity factors for generalized equivalence theory.")
+
+      .def(py::init<double /*x_min*/, double /*x_max*/, double /*keff*/,
+                    const DiffusionCrossSection& /*xs*/,
+                    const xt::xtensor<double, 1>& /*avg_flx*/,
+                    const xt::xtensor<double, 1>& /*j_neg*/,
+                    const xt::xtensor<double, 1>& /*j_pos*/>(),
+           "Performs the 1D nodal diffusion calculation of the node.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "x_min : float\n"
+           "    Position of the negative surface of the node.\n"
+           "x_max : float\n"
+           "    Position of the positive surface of the node.\n"
+           "keff : float\n"
+           "    Multiplication factor from reference calculation.\n"
+           "xs : DiffusionCrossSection\n"
+           "    Diffusion cross sections homogenized for the node.\n"
+           "avg_flx : ndarray\n"
+           "    Average flux in each group within the node from reference "
+           "calculation.\n"
+           "j_neg : ndarray\n"
+           "    Reference net current in each group on the negative "
+           "boundary.\n"
+           "j_pos : ndarray\n"
+           "    Reference net current in each group on the positive "
+           "boundary.\n",
+           py::arg("x_min"), py::arg("x_max"), py::arg("keff"), py::arg("xs"),
+           py::arg("avg_flx"), py::arg("j_neg"), py::arg("j_pos"))
+
+      .def_property_readonly("x_min", &NodalFlux1D::x_min,
+                             "Position of the negative surface of the node.")
+
+      .def_property_readonly("x_max", &NodalFlux1D::x_max,
+                             "Position of the positive surface of the node.")
+
+      .def_property_readonly("ngroups", &NodalFlux1D::ngroups,
+                             "Number of energy groups.")
+
+      .def_property_readonly(
+          "a", &NodalFlux1D::a,
+          "Expansion coefficients, indexed by group then polynomial.")
+
+      .def("__call__",
+           py::overload_cast<double, std::size_t>(&NodalFlux1D::operator(),
+                                                  py::const_),
+           "Evaluates the flux of a group at a position.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "x : float\n"
+           "    Position.\n"
+           "g : int\n"
+           "    Group index.\n\n"
+           "Returns\n"
+           "-------\n"
+           "float\n"
+           "    Flux in group g at x.\n",
+           py::arg("x"), py::arg("g"))
+
+      .def("__call__",
+           py::overload_cast<const xt::xtensor<double, 1>&, std::size_t>(
+               &NodalFlux1D::operator(), py::const_),
+           "Evaluates the flux of a group at many positions.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "x : ndarray\n"
+           "    Positions.\n"
+           "g : int\n"
+           "    Group index.\n\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray\n"
+           "    Flux in group g at each position.\n",
+           py::arg("x"), py::arg("g"))
+
+      .def("pos_surf_flux",
+           py::overload_cast<std::size_t>(&NodalFlux1D::pos_surf_flux,
+                                          py::const_),
+           "Flux of a group on the positive surface.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "g : int\n"
+           "    Group index.\n",
+           py::arg("g"))
+
+      .def("pos_surf_flux",
+           py::overload_cast<>(&NodalFlux1D::pos_surf_flux, py::const_),
+           "Flux of all groups on the positive surface.")
+
+      .def("neg_surf_flux",
+           py::overload_cast<std::size_t>(&NodalFlux1D::neg_surf_flux,
+                                          py::const_),
+           "Flux of a group on the negative surface.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "g : int\n"
+           "    Group index.\n",
+           py::arg("g"))
+
+      .def("neg_surf_flux",
+           py::overload_cast<>(&NodalFlux1D::neg_surf_flux, py::const_),
+           "Flux of all groups on the negative surface.");
+
+  py::class_<NodalFlux2D>(
+      m, "NodalFlux2D",
+      "The homogeneous flux of a 2D node centered on the origin, from a "
+      "nodal diffusion calculation using the Nodal Expansion Method (NEM) "
+      "with reference currents and average fluxes. The primary use of this "
+      "class is for computing the homogeneous flux that is required to define "
+      "corner discontinuity factors for flux reconstruction. The coupled x-y "
+      "terms require the average corner fluxes of the adjacent nodes, and are "
+      "zero unless provided with :py:meth:`set_cross_terms`. All evaluations "
+      "return the flux of all groups at a point, or an array indexed by point "
+      "and group when given arrays of points.")
+
+      .def(py::init<double /*dx*/, double /*dy*/, double /*keff*/,
+                    const DiffusionCrossSection& /*xs*/,
+                    const xt::xtensor<double, 1>& /*avg_flx*/,
+                    const xt::xtensor<double, 1>& /*j_x_neg*/,
+                    const xt::xtensor<double, 1>& /*j_x_pos*/,
+                    const xt::xtensor<double, 1>& /*j_y_neg*/,
+                    const xt::xtensor<double, 1>& /*j_y_pos*/>(),
+           "Performs the 2D nodal diffusion calculation of the node.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "dx : float\n"
+           "    Width of the node along the x axis.\n"
+           "dy : float\n"
+           "    Width of the node along the y axis.\n"
+           "keff : float\n"
+           "    Multiplication factor from reference calculation.\n"
+           "xs : DiffusionCrossSection\n"
+           "    Diffusion cross sections homogenized for the node.\n"
+           "avg_flx : ndarray\n"
+           "    Average flux in each group within the node from reference "
+           "calculation.\n"
+           "j_x_neg : ndarray\n"
+           "    Reference net current in each group on the negative x "
+           "boundary.\n"
+           "j_x_pos : ndarray\n"
+           "    Reference net current in each group on the positive x "
+           "boundary.\n"
+           "j_y_neg : ndarray\n"
+           "    Reference net current in each group on the negative y "
+           "boundary.\n"
+           "j_y_pos : ndarray\n"
+           "    Reference net current in each group on the positive y "
+           "boundary.\n",
+           py::arg("dx"), py::arg("dy"), py::arg("keff"), py::arg("xs"),
+           py::arg("avg_flx"), py::arg("j_x_neg"), py::arg("j_x_pos"),
+           py::arg("j_y_neg"), py::arg("j_y_pos"))
+
+      .def_property_readonly("dx", &NodalFlux2D::dx,
+                             "Width of the node along the x axis.")
+
+      .def_property_readonly("dy", &NodalFlux2D::dy,
+                             "Width of the node along the y axis.")
+
+      .def_property_readonly("keff", &NodalFlux2D::keff,
+                             "Multiplication factor.")
+
+      .def_property_readonly("ngroups", &NodalFlux2D::ngroups,
+                             "Number of energy groups.")
+
+      .def_property_readonly("flux_x", &NodalFlux2D::flux_x,
+                             py::return_value_policy::reference_internal,
+                             ":py:class:`NodalFlux1D` along the x axis.")
+
+      .def_property_readonly("flux_y", &NodalFlux2D::flux_y,
+                             py::return_value_policy::reference_internal,
+                             ":py:class:`NodalFlux1D` along the y axis.")
+
+      .def("set_cross_terms", &NodalFlux2D::set_cross_terms,
+           "Sets the coefficients of the coupled x-y terms of a group.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "g : int\n"
+           "    Group index.\n"
+           "cxy11 : float\n"
+           "    Coefficient of P1(x) P1(y).\n"
+           "cxy12 : float\n"
+           "    Coefficient of P1(x) P2(y).\n"
+           "cxy21 : float\n"
+           "    Coefficient of P2(x) P1(y).\n"
+           "cxy22 : float\n"
+           "    Coefficient of P2(x) P2(y).\n",
+           py::arg("g"), py::arg("cxy11"), py::arg("cxy12"), py::arg("cxy21"),
+           py::arg("cxy22"))
+
+      .def("__call__",
+           py::overload_cast<double, double>(&NodalFlux2D::operator(),
+                                             py::const_),
+           "Evaluates the flux of all groups at a point.", py::arg("x"),
+           py::arg("y"))
+
+      .def("__call__",
+           py::overload_cast<const xt::xtensor<double, 1>&,
+                             const xt::xtensor<double, 1>&>(
+               &NodalFlux2D::operator(), py::const_),
+           py::call_guard<py::gil_scoped_release>(),
+           "Evaluates the flux of all groups at many points, in parallel.",
+           py::arg("x"), py::arg("y"))
+
+      .def("flux_xy_no_cross",
+           py::overload_cast<double, double>(&NodalFlux2D::flux_xy_no_cross,
+                                             py::const_),
+           "Evaluates the flux of all groups at a point, without the coupled "
+           "x-y terms.",
+           py::arg("x"), py::arg("y"))
+
+      .def("flux_xy_no_cross",
+           py::overload_cast<const xt::xtensor<double, 1>&,
+                             const xt::xtensor<double, 1>&>(
+               &NodalFlux2D::flux_xy_no_cross, py::const_),
+           py::call_guard<py::gil_scoped_release>(),
+           "Evaluates the flux of all groups at many points, without the "
+           "coupled x-y terms, in parallel.",
+           py::arg("x"), py::arg("y"))
+
+      .def("fx", py::overload_cast<double>(&NodalFlux2D::fx, py::const_),
+           "Evaluates the x terms of all groups.", py::arg("x"))
+
+      .def("fx",
+           py::overload_cast<const xt::xtensor<double, 1>&>(&NodalFlux2D::fx,
+                                                            py::const_),
+           py::call_guard<py::gil_scoped_release>(),
+           "Evaluates the x terms of all groups at many positions.",
+           py::arg("x"))
+
+      .def("fy", py::overload_cast<double>(&NodalFlux2D::fy, py::const_),
+           "Evaluates the y terms of all groups.", py::arg("y"))
+
+      .def("fy",
+           py::overload_cast<const xt::xtensor<double, 1>&>(&NodalFlux2D::fy,
+                                                            py::const_),
+           py::call_guard<py::gil_scoped_release>(),
+           "Evaluates the y terms of all groups at many positions.",
+           py::arg("y"))
+
+      .def("fxy",
+           py::overload_cast<double, double>(&NodalFlux2D::fxy, py::const_),
+           "Evaluates the coupled x-y terms of all groups at a point.",
+           py::arg("x"), py::arg("y"))
+
+      .def("fxy",
+           py::overload_cast<const xt::xtensor<double, 1>&,
+                             const xt::xtensor<double, 1>&>(&NodalFlux2D::fxy,
+                                                            py::const_),
+           py::call_guard<py::gil_scoped_release>(),
+           "Evaluates the coupled x-y terms of all groups at many points, in "
+           "parallel.",
+           py::arg("x"), py::arg("y"));
+}
@@ -0,0 +1,15 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/plot_color_by.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_PlotColorBy(py::module& m) {
+  py::enum_<PlotColorBy>(m, "PlotColorBy")
+      .value("Cell", PlotColorBy::Cell)
+      .value("UniqueCell", PlotColorBy::UniqueCell)
+      .value("Material", PlotColorBy::Material)
+      .value("MaterialName", PlotColorBy::MaterialName);
+}
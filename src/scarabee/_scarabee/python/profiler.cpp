@@ -0,0 +1,57 @@
+#include <pybind11/pybind11.h>
+
+#include <utils/profiler.hpp>
+
+#include <string>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_Profiler(py::module& m) {
+  m.def("profiler_enabled", &Profiler::enabled,
+        "True if Scarabee was compiled with the region profiler "
+        "(SCARABEE_PROFILE), False otherwise. Without it, no zone is "
+        "recorded.");
+
+  m.def("reset_profiler", &Profiler::reset,
+        "Clears all the zones recorded by the region profiler. Must not be "
+        "called during a solve.");
+
+  m.def("set_profiler_tracing", &Profiler::set_tracing,
+        "Enables or disables the recording of every zone exit as an event, "
+        "for write_profiler_trace. Disabled by default.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "trace : bool\n"
+        "        True to record the events.",
+        py::arg("trace"));
+
+  m.def("profiler_report", &Profiler::report,
+        py::call_guard<py::gil_scoped_release>(),
+        "Report of the zones recorded by the region profiler, summed over "
+        "all threads. The tree gives the calls and the inclusive time of "
+        "every zone, with its share of the time of its parent zone. The flat "
+        "report gives the calls and total time of every zone name.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "flat : bool\n"
+        "       If True, gives the flat report instead of the tree. Default "
+        "is False.\n\n"
+        "Returns\n"
+        "-------\n"
+        "str\n"
+        "    Text report.",
+        py::arg("flat") = false);
+
+  m.def("write_profiler_trace", &Profiler::write_chrome_trace,
+        py::call_guard<py::gil_scoped_release>(),
+        "Writes the events traced by the region profiler to a Chrome trace "
+        "event JSON file, which can be opened by chrome://tracing or "
+        "Perfetto.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "fname : str\n"
+        "        Name of the JSON file.",
+        py::arg("fname"));
+}
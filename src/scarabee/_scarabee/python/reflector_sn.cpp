@@ -32,7 +32,45 @@ void init_ReflectorSN(py::module& m) {
            py::arg("xs"), py::arg("dx"), py::arg("nangles"),
            py::arg("anisotropic") = true)
 
-      .def("solve", &ReflectorSN::solve)
+      .def("solve", &ReflectorSN::solve,
+           py::call_guard<py::gil_scoped_release>())
+
+      .def("warm_start", &ReflectorSN::warm_start,
+           "Starts the next solve from the flux and keff of another "
+           "ReflectorSN with the same mesh, instead of a flat flux.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "other : ReflectorSN\n"
+           "  Solved ReflectorSN with the same groups and regions.\n",
+           py::arg("other"))
+
+      .def_static(
+          "solve_branches", &ReflectorSN::solve_branches,
+          py::call_guard<py::gil_scoped_release>(),
+          "Solves the same mesh for several sets of cross sections, such as "
+          "the moderator temperature and boron branches of a reflector. The "
+          "first set is solved alone. The others are then solved "
+          "concurrently, each warm started from the flux and keff of the "
+          "closest set already solved.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "xs : list of list of CrossSection\n"
+          "  Cross sections of each bin, for each branch.\n"
+          "dx : iterable of float\n"
+          "  1D iterable of the widths of each bin along x.\n"
+          "nangles : int\n"
+          "  Number of angles tracked.\n"
+          "anisotropic : bool\n"
+          "  True to use anisotropic scattering (default value is True).\n"
+          "dsa : bool\n"
+          "  True to use diffusion synthetic acceleration (default value is "
+          "False).\n\n"
+          "Returns\n"
+          "-------\n"
+          "list of ReflectorSN\n"
+          "  Solved ReflectorSN of each branch, in the order of xs.\n",
+          py::arg("xs"), py::arg("dx"), py::arg("nangles"),
+          py::arg("anisotropic") = true, py::arg("dsa") = false)
 
       .def_property_readonly("nangles", &ReflectorSN::nangles,
                              "Number of discrete angles tracked.")
@@ -41,6 +79,17 @@ void init_ReflectorSN(py::module& m) {
           "solved", &ReflectorSN::solved,
           "True if problem has been solved, False otherwsie.")
 
+      .def_property("num_threads", &ReflectorSN::num_threads,
+                    &ReflectorSN::set_num_threads,
+                    "Number of threads used by the solver. When 0 (default), "
+                    "one thread is used per pinned core, or the number given "
+                    "by :py:func:`set_default_threads` if it is not pinned.")
+
+      .def_property("cores", &ReflectorSN::cores, &ReflectorSN::set_cores,
+                    "Cores to which the threads of the solver are pinned, "
+                    "round robin. Empty (default) if they are not pinned. "
+                    "Pinning is only supported on Linux.")
+
       .def_property_readonly("keff", &ReflectorSN::keff,
                              "Value of keff estimated by solver (1 by default "
                              "if no solution has been obtained).")
@@ -74,6 +123,15 @@ void init_ReflectorSN(py::module& m) {
           &ReflectorSN::set_flux_tolerance,
           "Maximum relative absolute difference in flux for convergence")
 
+      .def_property(
+          "dsa", &ReflectorSN::dsa, &ReflectorSN::set_dsa,
+          "If True, each sweep is followed by a diffusion synthetic "
+          "acceleration. The multigroup diffusion equation for the error in "
+          "the scalar flux is solved, with the change of the scattering "
+          "source over the sweep as its source. This greatly reduces the "
+          "number of iterations in thick, highly scattering regions. Default "
+          "is False.")
+
       .def("flux", &ReflectorSN::flux,
            "Returns the scalar flux in group g in mesh region i.\n\n"
            "Parameters\n"
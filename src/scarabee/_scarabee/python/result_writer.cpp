@@ -0,0 +1,145 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <xtensor-python/pyarray.hpp>
+#include <xtensor-python/pytensor.hpp>
+
+#include <data/result_writer.hpp>
+#include <moc/moc_driver.hpp>
+#include <diffusion/nem_diffusion_driver.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_ResultWriter(py::module& m) {
+  py::class_<ResultWriter, std::shared_ptr<ResultWriter>>(
+      m, "ResultWriter",
+      "Writes solver results to an HDF5 file, straight from the arrays of "
+      "the solvers. Each field is written to a chunked dataset, which is "
+      "compressed when the HDF5 library has the deflate filter. In the "
+      "background, each field is copied when it is written, and the file is "
+      "then written by another thread. One file is usually written per "
+      "depletion step or branch, by opening a new file with the same "
+      "writer.")
+
+      .def(py::init<const std::string&, bool>(),
+           "Creates a result file, replacing any previous file of that "
+           "name.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fname : str\n"
+           "        Name of the result file.\n"
+           "background : bool\n"
+           "             If True, fields are written by another thread. "
+           "Default is False.",
+           py::arg("fname"), py::arg("background") = false)
+
+      .def_property_readonly("file_name", &ResultWriter::file_name,
+                             "Name of the current result file.")
+
+      .def_property_readonly("background", &ResultWriter::background,
+                             "True if fields are written by another thread.")
+
+      .def_property("compression", &ResultWriter::compression,
+                    &ResultWriter::set_compression,
+                    "Deflate level, from 0 for no compression to 9. Default "
+                    "is 4.")
+
+      .def("open", &ResultWriter::open,
+           py::call_guard<py::gil_scoped_release>(),
+           "Waits for the last write to finish, closes the current file, and "
+           "creates a new one.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "fname : str\n"
+           "        Name of the new result file.",
+           py::arg("fname"))
+
+      .def("write", &ResultWriter::write,
+           py::call_guard<py::gil_scoped_release>(),
+           "Writes an array. Groups in the path are created as needed, and "
+           "a field written again at the same path replaces the old one.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "path : str\n"
+           "       Path of the dataset in the file.\n"
+           "data : ndarray\n"
+           "       Array to write.",
+           py::arg("path"), py::arg("data"))
+
+      .def("write_flux",
+           py::overload_cast<const std::string&, const MOCDriver&>(
+               &ResultWriter::write_flux),
+           py::call_guard<py::gil_scoped_release>(),
+           "Writes the scalar flux of a solved MOCDriver, indexed by group "
+           "then FSR.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "path : str\n"
+           "       Path of the dataset in the file.\n"
+           "moc : MOCDriver\n"
+           "      Solved driver.",
+           py::arg("path"), py::arg("moc"))
+
+      .def("write_flux",
+           py::overload_cast<const std::string&, const NEMDiffusionDriver&>(
+               &ResultWriter::write_flux),
+           py::call_guard<py::gil_scoped_release>(),
+           "Writes the node average flux of a solved NEMDiffusionDriver.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "path : str\n"
+           "       Path of the dataset in the file.\n"
+           "nem : NEMDiffusionDriver\n"
+           "      Solved driver.",
+           py::arg("path"), py::arg("nem"))
+
+      .def("write_tally", &ResultWriter::write_tally,
+           py::call_guard<py::gil_scoped_release>(),
+           "Writes the result of a tally of a MOCDriver, indexed by region "
+           "set then group.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "path : str\n"
+           "       Path of the dataset in the file.\n"
+           "moc : MOCDriver\n"
+           "      Solved driver.\n"
+           "t : int\n"
+           "    Index of the tally.",
+           py::arg("path"), py::arg("moc"), py::arg("t"))
+
+      .def("write_pin_power", &ResultWriter::write_pin_power,
+           py::call_guard<py::gil_scoped_release>(),
+           "Writes the pin powers of a NEMDiffusionDriver in the dataset "
+           "power of a group, with the pin bounds in the datasets x and y.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "path : str\n"
+           "       Path of the group in the file.\n"
+           "nem : NEMDiffusionDriver\n"
+           "      Solved driver.\n"
+           "z : ndarray\n"
+           "    Heights at which the pin powers are reconstructed.",
+           py::arg("path"), py::arg("nem"), py::arg("z"))
+
+      .def("set_attribute", &ResultWriter::set_attribute,
+           py::call_guard<py::gil_scoped_release>(),
+           "Sets an attribute of the root of the file, such as the burnup or "
+           "keff.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "name : str\n"
+           "       Name of the attribute.\n"
+           "value : float\n"
+           "        Value of the attribute.",
+           py::arg("name"), py::arg("value"))
+
+      .def("wait", &ResultWriter::wait,
+           py::call_guard<py::gil_scoped_release>(),
+           "Waits for the last write to finish. Raises an error if it "
+           "failed.")
+
+      .def("close", &ResultWriter::close,
+           py::call_guard<py::gil_scoped_release>(),
+           "Waits for the last write to finish and closes the file.");
+}
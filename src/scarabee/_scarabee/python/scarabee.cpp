@@ -20,6 +20,7 @@ extern void init_Nuclide(py::module&);
 extern void init_MaterialComposition(py::module&);
 extern void init_Material(py::module&);
 extern void init_FluxCalculator(py::module&);
+extern void init_Ki3Mode(py::module&);
 extern void init_CylindricalCell(py::module&);
 extern void init_CylindricalFluxSolver(py::module&);
 extern void init_Logging(py::module&);
@@ -28,6 +29,21 @@ extern void init_Direction(py::module&);
 extern void init_PolarQuadrature(py::module&);
 extern void init_BoundaryCondition(py::module&);
 extern void init_SimulationMode(py::module&);
+extern void init_SweepParallelism(py::module&);
+extern void init_ExponentialMode(py::module&);
+extern void init_TransportSolver(py::module&);
+extern void init_SourceShape(py::module&);
+extern void init_DomainSymmetry(py::module&);
+extern void init_FSROrder(py::module&);
+extern void init_TallyScore(py::module&);
+extern void init_FluxLayout(py::module&);
+extern void init_PlotColorBy(py::module&);
+extern void init_CMFDLinearSolver(py::module&);
+extern void init_CMFDAcceleration(py::module&);
+extern void init_SolverTelemetry(py::module&);
+extern void init_Profiler(py::module&);
+extern void init_Threads(py::module&);
+extern void init_SIMD(py::module&);
 extern void init_Track(py::module&);
 extern void init_Cell(py::module&);
 extern void init_EmptyCell(py::module&);
@@ -39,14 +55,22 @@ extern void init_BWRCornerPinCell(py::module&);
 extern void init_Cartesian2D(py::module&);
 extern void init_CMFD(py::module&);
 extern void init_MOCDriver(py::module&);
+extern void init_MOC2D1DDriver(py::module&);
 extern void init_CriticalitySpectrum(py::module&);
 extern void init_DiffusionData(py::module&);
+extern void init_DiffusionSymmetry(py::module&);
 extern void init_DiffusionGeometry(py::module&);
+extern void init_DiffusionXSTable(py::module&);
+extern void init_FDLinearSolver(py::module&);
 extern void init_FDDiffusionDriver(py::module&);
 extern void init_NEMDiffusionDriver(py::module&);
+extern void init_NodalFlux(py::module&);
 extern void init_ReflectorSN(py::module&);
 extern void init_WaterFuncs(py::module&);
 extern void init_DepletionMatrix(py::module&);
+extern void init_DepletionCheckpoint(py::module&);
+extern void init_ResultWriter(py::module&);
+extern void init_MaterialCache(py::module&);
 
 PYBIND11_MODULE(_scarabee, m) {
   xt::import_numpy();
@@ -67,11 +91,27 @@ PYBIND11_MODULE(_scarabee, m) {
   init_MaterialComposition(m);
   init_Material(m);
   init_FluxCalculator(m);
+  init_Ki3Mode(m);
   init_CylindricalCell(m);
   init_CylindricalFluxSolver(m);
   init_PolarQuadrature(m);
   init_BoundaryCondition(m);
   init_SimulationMode(m);
+  init_SweepParallelism(m);
+  init_ExponentialMode(m);
+  init_TransportSolver(m);
+  init_SourceShape(m);
+  init_DomainSymmetry(m);
+  init_FSROrder(m);
+  init_TallyScore(m);
+  init_FluxLayout(m);
+  init_PlotColorBy(m);
+  init_CMFDLinearSolver(m);
+  init_CMFDAcceleration(m);
+  init_SolverTelemetry(m);
+  init_Profiler(m);
+  init_Threads(m);
+  init_SIMD(m);
   init_Track(m);
   init_Cell(m);
   init_EmptyCell(m);
@@ -83,14 +123,22 @@ PYBIND11_MODULE(_scarabee, m) {
   init_Cartesian2D(m);
   init_CMFD(m);
   init_MOCDriver(m);
+  init_MOC2D1DDriver(m);
   init_CriticalitySpectrum(m);
   init_DiffusionData(m);
+  init_DiffusionSymmetry(m);
   init_DiffusionGeometry(m);
+  init_DiffusionXSTable(m);
+  init_FDLinearSolver(m);
   init_FDDiffusionDriver(m);
   init_NEMDiffusionDriver(m);
+  init_NodalFlux(m);
   init_ReflectorSN(m);
   init_WaterFuncs(m);
   init_DepletionMatrix(m);
+  init_DepletionCheckpoint(m);
+  init_ResultWriter(m);
+  init_MaterialCache(m);
 
   m.attr("__author__") = "Hunter Belanger";
   m.attr("__copyright__") = "Copyright 2024-2025, Hunter Belanger";
@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <utils/simd_kernels.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_SIMD(py::module& m) {
+  m.def("simd_architecture", &simd_architecture,
+        "Name of the SIMD instruction set selected for the kernels of the "
+        "solvers on this CPU (e.g. avx512bw, fma3+avx2, sse2).");
+}
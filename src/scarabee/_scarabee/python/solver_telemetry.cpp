@@ -0,0 +1,52 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <utils/solver_telemetry.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_SolverTelemetry(py::module& m) {
+  py::class_<SolverTelemetry>(
+      m, "SolverTelemetry",
+      "Performance counters and convergence history of a solver. It is "
+      "cleared at the start of each solve, and may be read while the solve "
+      "is running.")
+
+      .def_property_readonly(
+          "phase_times", &SolverTelemetry::phase_times,
+          "Dictionary of the wall time in seconds spent in each phase of the "
+          "solve.")
+
+      .def("phase_time", &SolverTelemetry::phase_time,
+           "Wall time in seconds spent in a phase of the solve, or 0 if the "
+           "phase was not entered.\n\n"
+           "Parameters\n"
+           "----------\n"
+           "phase : str\n"
+           "        Name of the phase.",
+           py::arg("phase"))
+
+      .def_property_readonly("counters", &SolverTelemetry::counters,
+                             "Dictionary of the event counters of the solve.")
+
+      .def_property_readonly(
+          "memory", &SolverTelemetry::memory,
+          "Dictionary of the peak size in bytes of the major arrays.")
+
+      .def_property_readonly("iterations", &SolverTelemetry::iterations,
+                             "Number of iterations performed.")
+
+      .def_property_readonly(
+          "residuals", &SolverTelemetry::residuals,
+          "List of the maximum relative flux difference of each iteration.")
+
+      .def_property_readonly("keffs", &SolverTelemetry::keffs,
+                             "List of the keff of each iteration.")
+
+      .def_property_readonly(
+          "segments_per_second", &SolverTelemetry::segments_per_second,
+          "Segments swept per second of sweep, where a segment is counted "
+          "once per group and direction.");
+}
@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/source_shape.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_SourceShape(py::module& m) {
+  py::enum_<SourceShape>(m, "SourceShape")
+      .value("Flat", SourceShape::Flat)
+      .value("Linear", SourceShape::Linear);
+}
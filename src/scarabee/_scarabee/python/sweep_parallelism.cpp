@@ -0,0 +1,14 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/sweep_parallelism.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_SweepParallelism(py::module& m) {
+  py::enum_<SweepParallelism>(m, "SweepParallelism")
+      .value("Groups", SweepParallelism::Groups)
+      .value("Tracks", SweepParallelism::Tracks)
+      .value("Chains", SweepParallelism::Chains);
+}
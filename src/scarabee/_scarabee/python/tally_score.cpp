@@ -0,0 +1,15 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/tally_score.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_TallyScore(py::module& m) {
+  py::enum_<TallyScore>(m, "TallyScore")
+      .value("Flux", TallyScore::Flux)
+      .value("Absorption", TallyScore::Absorption)
+      .value("Fission", TallyScore::Fission)
+      .value("NuFission", TallyScore::NuFission);
+}
@@ -0,0 +1,64 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <utils/threads.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_Threads(py::module& m) {
+  m.def("hardware_threads", &hardware_threads,
+        "Number of processors available to the process.");
+
+  m.def("default_threads", &default_threads,
+        "Number of threads used by the solvers which do not set their own "
+        "num_threads. When 0, the OpenMP defaults are used.");
+
+  m.def("set_default_threads", &set_default_threads,
+        "Sets the number of threads used by the solvers which do not set "
+        "their own num_threads, from any thread of the process.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "n : int\n"
+        "    Number of threads, or 0 to use the OpenMP defaults.",
+        py::arg("n"));
+
+  m.def("reproducible_reductions", &reproducible_reductions,
+        "True if the parallel sums of the solvers do not depend on the "
+        "number of threads.");
+
+  m.def("reduction_blocks", &reduction_blocks,
+        "Number of blocks into which the parallel sums are split when "
+        "reproducible reductions are enabled.");
+
+  m.def("set_reproducible_reductions", &set_reproducible_reductions,
+        "Enables or disables reproducible reductions for the whole process. "
+        "When enabled, the parallel sums of the solvers are split into a "
+        "fixed number of blocks which are summed in order, so that keff and "
+        "the fluxes are bitwise identical for any number of threads. The "
+        "MOC sweeps then keep one flux tally per block, and use at most "
+        "nblocks threads.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "enabled : bool\n"
+        "    If reproducible reductions are used.\n"
+        "nblocks : int\n"
+        "    Number of blocks of the sums. Default is 32.",
+        py::arg("enabled"), py::arg("nblocks") = 32);
+
+  m.def("core_sets", &core_sets,
+        "Splits the processors available to the process into disjoint sets "
+        "of consecutive cores. Solvers run concurrently, which are each "
+        "given one of the sets as their cores, do not compete for the same "
+        "cores.\n\n"
+        "Parameters\n"
+        "----------\n"
+        "n : int\n"
+        "    Number of sets.\n\n"
+        "Returns\n"
+        "-------\n"
+        "list of list of int\n"
+        "    Cores of each set.",
+        py::arg("n"));
+}
@@ -12,7 +12,5 @@ void init_Track(py::module& m) {
       .def("width", &Track::width)
       .def("phi", &Track::phi)
       .def("entry_pos", &Track::entry_pos)
-      .def("exit_pos", &Track::exit_pos)
-      .def("entry_flux", py::overload_cast<>(&Track::entry_flux, py::const_))
-      .def("exit_flux", py::overload_cast<>(&Track::exit_flux, py::const_));
+      .def("exit_pos", &Track::exit_pos);
 }
@@ -0,0 +1,13 @@
+#include <pybind11/pybind11.h>
+
+#include <moc/transport_solver.hpp>
+
+namespace py = pybind11;
+
+using namespace scarabee;
+
+void init_TransportSolver(py::module& m) {
+  py::enum_<TransportSolver>(m, "TransportSolver")
+      .value("SourceIteration", TransportSolver::SourceIteration)
+      .value("GMRES", TransportSolver::GMRES);
+}
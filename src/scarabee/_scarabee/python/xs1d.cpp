@@ -29,6 +29,11 @@ void init_XS1D(py::module& m) {
       .def_property_readonly("ngroups", &XS1D::ngroups,
                              "Number of energy groups.")
 
+      .def_property_readonly("values", &XS1D::values,
+                             py::return_value_policy::reference_internal,
+                             "Read-only array of the cross section in each "
+                             "group, sharing memory with the XS1D.")
+
       .def("__call__", &XS1D::operator(),
            "Returns the value of the cross section in group g.\n\n"
            "Parameters\n"
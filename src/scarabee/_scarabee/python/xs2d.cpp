@@ -4,6 +4,7 @@
 
 #include <data/xs2d.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
@@ -11,6 +12,16 @@ namespace py = pybind11;
 
 using namespace scarabee;
 
+namespace {
+void check_incident_group(const XS2D& xs, std::size_t gin) {
+  if (gin >= xs.ngroups()) {
+    const auto mssg = "Incident group index out of range.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+}
+}  // namespace
+
 void init_XS2D(py::module& m) {
   py::class_<XS2D, std::shared_ptr<XS2D>>(
       m, "XS2D",
@@ -66,6 +77,25 @@ void init_XS2D(py::module& m) {
           "max_legendre_order", &XS2D::max_legendre_order,
           "Order of the largest stored legendre moment scattering matrix.")
 
+      .def_property_readonly(
+          "data", &XS2D::data, py::return_value_policy::reference_internal,
+          "Read-only array of the compressed scattering data, sharing memory "
+          "with the XS2D. The first index is the legendre moment.")
+
+      .def_property_readonly(
+          "packing", &XS2D::packing,
+          py::return_value_policy::reference_internal,
+          "Read-only array with, for each incident group, the starting index "
+          "in the data array, and the lowest and highest outgoing groups.")
+
+      .def("dense", &XS2D::dense,
+           "Unpacks the scattering matrix of all legendre moments.\n\n"
+           "Returns\n"
+           "-------\n"
+           "ndarray\n"
+           "    3D array indexed by legendre moment, incident group, and "
+           "outgoing group.\n")
+
       .def("set_value", &XS2D::set_value,
            "Sets the value of the cross section for legendre moment l and "
            "energy transition gin -> gout.\n\n"
@@ -109,6 +139,61 @@ void init_XS2D(py::module& m) {
            "    Outgoing energy group.\n",
            py::arg("l"), py::arg("gin"), py::arg("gout"))
 
+      .def(
+          "band_min",
+          [](const XS2D& xs, std::size_t gin) {
+            check_incident_group(xs, gin);
+            return xs.band_min(gin);
+          },
+          "Lowest outgoing group stored for an incident group.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "gin : int\n"
+          "    Incident energy group.\n",
+          py::arg("gin"))
+
+      .def(
+          "band_max",
+          [](const XS2D& xs, std::size_t gin) {
+            check_incident_group(xs, gin);
+            return xs.band_max(gin);
+          },
+          "Highest outgoing group stored for an incident group.\n\n"
+          "Parameters\n"
+          "----------\n"
+          "gin : int\n"
+          "    Incident energy group.\n",
+          py::arg("gin"))
+
+      .def(
+          "band",
+          [](const XS2D& xs, std::size_t l, std::size_t gin) {
+            check_incident_group(xs, gin);
+            if (l > xs.max_legendre_order()) {
+              const auto mssg = "Legendre moment index out of range.";
+              spdlog::error(mssg);
+              throw ScarabeeException(mssg);
+            }
+            const auto row = xs.band(l, gin);
+            auto out = xt::xtensor<double, 1>::from_shape({row.size()});
+            std::copy(row.begin(), row.end(), out.begin());
+            return out;
+          },
+          "Stored scattering cross sections for legendre moment l and "
+          "incident group gin, from outgoing group band_min(gin) to "
+          "band_max(gin).\n\n"
+          "Parameters\n"
+          "----------\n"
+          "l : int\n"
+          "    Legendre moment.\n"
+          "gin : int\n"
+          "    Incident energy group.\n\n"
+          "Returns\n"
+          "-------\n"
+          "ndarray\n"
+          "    Values of the band.\n",
+          py::arg("l"), py::arg("gin"))
+
       .def("__add__", &XS2D::operator+)
       .def("__iadd__", &XS2D::operator+=)
       .def("__sub__", &XS2D::operator-)
@@ -0,0 +1,254 @@
+#include <data/result_writer.hpp>
+#include <moc/moc_driver.hpp>
+#include <diffusion/nem_diffusion_driver.hpp>
+#include <utils/hdf5_lock.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#include <H5Zpublic.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <utility>
+
+namespace scarabee {
+
+// Target number of values in a chunk, which is 1 MiB of doubles
+constexpr std::size_t CHUNK_SIZE = std::size_t{1} << 17;
+
+ResultWriter::ResultWriter(const std::string& fname, bool background)
+    : background_(background) {
+  this->open(fname);
+}
+
+ResultWriter::~ResultWriter() {
+  if (thread_.joinable()) thread_.join();
+
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  file_.reset();
+}
+
+void ResultWriter::set_compression(std::size_t level) {
+  if (level > 9) {
+    auto mssg = "Compression level must be in the range [0, 9].";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  compression_ = level;
+}
+
+void ResultWriter::open(const std::string& fname) {
+  this->close();
+
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  try {
+    if (std::filesystem::exists(fname)) {
+      std::filesystem::remove(fname);
+    }
+
+    file_ = std::make_unique<H5::File>(fname, H5::File::Create);
+    fname_ = fname;
+  } catch (const std::exception& e) {
+    std::stringstream mssg;
+    mssg << "Could not create the result file \"" << fname
+         << "\": " << e.what();
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+}
+
+void ResultWriter::check_open() const {
+  if (file_ == nullptr) {
+    std::stringstream mssg;
+    mssg << "The result file \"" << fname_ << "\" is closed.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+}
+
+void ResultWriter::write(const std::string& path,
+                         const xt::xarray<double>& data) {
+  std::vector<std::size_t> dims(data.shape().begin(), data.shape().end());
+  this->write_array(path, data.data(), dims);
+}
+
+void ResultWriter::write_flux(const std::string& path, const MOCDriver& moc) {
+  if (moc.solved() == false) {
+    auto mssg = "Cannot write the flux of an unsolved MOCDriver.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const auto& flux = moc.flux_array();
+  const std::size_t NG = flux.shape()[0];
+  const std::size_t NF = flux.shape()[1];
+  const std::size_t NL = flux.shape()[2];
+  if (NL == 1) {
+    this->write_array(path, flux.data(), {NG, NF});
+    return;
+  }
+
+  // Only the scalar flux is written, without the higher moments
+  std::vector<double> scalar(NG * NF);
+  for (std::size_t g = 0; g < NG; g++) {
+    for (std::size_t i = 0; i < NF; i++) scalar[g * NF + i] = flux(g, i, 0);
+  }
+  this->write_array(path, scalar.data(), {NG, NF});
+}
+
+void ResultWriter::write_tally(const std::string& path, const MOCDriver& moc,
+                               std::size_t t) {
+  const auto& result = moc.tally(t);
+  if (result.size() == 0) {
+    std::stringstream mssg;
+    mssg << "Tally " << t << " has no result to write.";
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+
+  this->write_array(path, result.data(),
+                    {result.shape()[0], result.shape()[1]});
+}
+
+void ResultWriter::write_flux(const std::string& path,
+                              const NEMDiffusionDriver& nem) {
+  if (nem.solved() == false) {
+    auto mssg = "Cannot write the flux of an unsolved NEMDiffusionDriver.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  const auto flux = nem.avg_flux();
+  std::vector<std::size_t> dims(flux.shape().begin(), flux.shape().end());
+  this->write_array(path, flux.data(), dims);
+}
+
+void ResultWriter::write_pin_power(const std::string& path,
+                                   const NEMDiffusionDriver& nem,
+                                   const xt::xtensor<double, 1>& z) {
+  const auto [power, x, y] = nem.pin_power(z);
+  std::vector<std::size_t> dims(power.shape().begin(), power.shape().end());
+  this->write_array(path + "/power", power.data(), dims);
+  this->write_array(path + "/x", x.data(), {x.size()});
+  this->write_array(path + "/y", y.data(), {y.size()});
+}
+
+void ResultWriter::set_attribute(const std::string& name, double value) {
+  this->wait();
+  this->check_open();
+
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  try {
+    if (file_->hasAttribute(name)) file_->deleteAttribute(name);
+    file_->createAttribute(name, value);
+  } catch (const std::exception& e) {
+    std::stringstream mssg;
+    mssg << "Could not write the attribute \"" << name << "\" to \"" << fname_
+         << "\": " << e.what();
+    spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+}
+
+void ResultWriter::wait() {
+  if (thread_.joinable()) thread_.join();
+
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    std::swap(error, error_);
+  }
+
+  if (error) {
+    try {
+      std::rethrow_exception(error);
+    } catch (const std::exception& e) {
+      spdlog::error(e.what());
+      throw;
+    }
+  }
+}
+
+void ResultWriter::close() {
+  // The file is closed even if the last write failed
+  if (thread_.joinable()) thread_.join();
+  {
+    std::lock_guard<std::mutex> lock(hdf5_mutex());
+    if (file_) file_->flush();
+    file_.reset();
+  }
+
+  this->wait();
+}
+
+void ResultWriter::write_array(const std::string& path, const double* data,
+                               const std::vector<std::size_t>& dims) {
+  this->check_open();
+
+  if (background_ == false) {
+    this->write_dataset(path, data, dims);
+    return;
+  }
+
+  // The field is copied before returning, so that the solver may change it
+  // while it is written
+  this->wait();
+  const std::size_t n = std::accumulate(dims.begin(), dims.end(),
+                                        std::size_t{1}, std::multiplies<>());
+  std::vector<double> copy(data, data + n);
+
+  thread_ = std::thread([this, path, dims, copy = std::move(copy)]() {
+    try {
+      this->write_dataset(path, copy.data(), dims);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mtx_);
+      error_ = std::current_exception();
+    }
+  });
+}
+
+void ResultWriter::write_dataset(const std::string& path, const double* data,
+                                 const std::vector<std::size_t>& dims) const {
+  std::lock_guard<std::mutex> lock(hdf5_mutex());
+  try {
+    const std::size_t n = std::accumulate(dims.begin(), dims.end(),
+                                          std::size_t{1}, std::multiplies<>());
+
+    H5::DataSetCreateProps props;
+    if (dims.empty() == false && n > 0) {
+      // Chunks hold whole rows of the last dimension, so that a slice of the
+      // leading indices is read from few chunks
+      std::vector<hsize_t> chunk(dims.size(), 1);
+      chunk.back() = std::min(dims.back(), CHUNK_SIZE);
+      props.add(H5::Chunking(chunk));
+
+      // The bundled HDF5 may be built without zlib
+      if (compression_ > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+        props.add(H5::Shuffle());
+        props.add(H5::Deflate(static_cast<unsigned>(compression_)));
+      }
+    }
+
+    if (file_->exist(path)) file_->unlink(path);
+
+    H5::DataSpace space = dims.empty()
+                              ? H5::DataSpace(H5::DataSpace::dataspace_scalar)
+                              : H5::DataSpace(dims);
+    auto dset = file_->createDataSet<double>(path, space, props);
+    if (n > 0) dset.write_raw(data);
+  } catch (const ScarabeeException&) {
+    throw;
+  } catch (const std::exception& e) {
+    std::stringstream mssg;
+    mssg << "Could not write \"" << path << "\" to \"" << fname_
+         << "\": " << e.what();
+    if (background_ == false) spdlog::error(mssg.str());
+    throw ScarabeeException(mssg.str());
+  }
+}
+
+}  // namespace scarabee
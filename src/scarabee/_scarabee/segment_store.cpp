@@ -0,0 +1,251 @@
+#include <moc/segment_store.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace scarabee {
+
+void SegmentStore::clear() {
+  angle_offsets_.clear();
+  track_offsets_.clear();
+  crossing_offsets_.clear();
+  fsr_indx_.clear();
+  xs_indx_.clear();
+  length_.clear();
+  crossings_.clear();
+  compressed_ = false;
+  fsr_delta_.clear();
+  length_code_.clear();
+  track_first_fsr_.clear();
+  track_length_scale_.clear();
+  escape_offsets_.clear();
+  fsr_escapes_.clear();
+}
+
+void SegmentStore::compress() {
+  if (compressed_) return;
+
+  const std::size_t nt = ntracks();
+  const std::size_t nsegs = nsegments();
+  fsr_delta_.resize(nsegs);
+  length_code_.resize(nsegs);
+  track_first_fsr_.assign(nt, 0);
+  track_length_scale_.assign(nt, 0.);
+
+  // The escapes of each track are found in parallel, and then concatenated
+  // in track order
+  std::vector<std::vector<std::int32_t>> track_escapes(nt);
+
+#pragma omp parallel for schedule(static)
+  for (long long it = 0; it < static_cast<long long>(nt); it++) {
+    const std::size_t t = static_cast<std::size_t>(it);
+    const std::size_t s_begin = track_offsets_[t];
+    const std::size_t s_end = track_offsets_[t + 1];
+    if (s_begin == s_end) continue;
+
+    double max_len = 0.;
+    for (std::size_t s = s_begin; s < s_end; s++) {
+      max_len = std::max(max_len, static_cast<double>(length_[s]));
+    }
+    const double scale = max_len > 0. ? max_len / MAX_LENGTH_CODE : 1.;
+    track_length_scale_[t] = scale;
+    track_first_fsr_[t] = fsr_indx_[s_begin];
+
+    std::uint32_t prev = fsr_indx_[s_begin];
+    for (std::size_t s = s_begin; s < s_end; s++) {
+      const std::int64_t delta = static_cast<std::int64_t>(fsr_indx_[s]) -
+                                 static_cast<std::int64_t>(prev);
+      if (delta > std::numeric_limits<std::int16_t>::max() ||
+          delta <= ESCAPE_DELTA) {
+        fsr_delta_[s] = ESCAPE_DELTA;
+        track_escapes[t].push_back(static_cast<std::int32_t>(delta));
+      } else {
+        fsr_delta_[s] = static_cast<std::int16_t>(delta);
+      }
+      prev = fsr_indx_[s];
+
+      // Lengths are rounded to the nearest step, and never to zero
+      const double code = std::round(static_cast<double>(length_[s]) / scale);
+      length_code_[s] =
+          static_cast<std::uint16_t>(std::clamp(code, 1., MAX_LENGTH_CODE));
+    }
+  }
+
+  escape_offsets_.assign(nt + 1, 0);
+  fsr_escapes_.clear();
+  for (std::size_t t = 0; t < nt; t++) {
+    escape_offsets_[t] = fsr_escapes_.size();
+    fsr_escapes_.insert(fsr_escapes_.end(), track_escapes[t].begin(),
+                        track_escapes[t].end());
+  }
+  escape_offsets_[nt] = fsr_escapes_.size();
+
+  fsr_indx_ = FirstTouchVector<std::uint32_t>();
+  xs_indx_ = FirstTouchVector<std::uint32_t>();
+  length_ = FirstTouchVector<StoredReal>();
+  compressed_ = true;
+}
+
+void SegmentStore::decode_track(
+    std::size_t tt, const std::vector<std::uint32_t>& fsr_xs_indices,
+    SegmentStore& out) const {
+  const std::size_t s_begin = track_offsets_[tt];
+  const std::size_t nsegs = track_offsets_[tt + 1] - s_begin;
+  out.angle_offsets_.assign(1, 0);
+  out.track_offsets_.assign({0, nsegs});
+  out.fsr_indx_.resize(nsegs);
+  out.xs_indx_.resize(nsegs);
+  out.length_.resize(nsegs);
+
+  const double scale = track_length_scale_[tt];
+  std::size_t e = escape_offsets_[tt];
+  std::int64_t fsr = nsegs > 0 ? track_first_fsr_[tt] : 0;
+  for (std::size_t k = 0; k < nsegs; k++) {
+    const std::int16_t delta = fsr_delta_[s_begin + k];
+    fsr += delta == ESCAPE_DELTA ? fsr_escapes_[e++] : delta;
+    out.fsr_indx_[k] = static_cast<std::uint32_t>(fsr);
+    out.xs_indx_[k] = fsr_xs_indices[static_cast<std::size_t>(fsr)];
+    out.length_[k] =
+        static_cast<StoredReal>(scale * length_code_[s_begin + k]);
+  }
+
+  // The crossings are renumbered from the first segment of the track
+  out.crossings_.assign(crossings_.begin() + crossing_offsets_[tt],
+                        crossings_.begin() + crossing_offsets_[tt + 1]);
+  for (auto& c : out.crossings_) c.segment -= s_begin;
+  out.crossing_offsets_.assign({0, out.crossings_.size()});
+}
+
+void SegmentStore::set_xs_indices(
+    const std::vector<std::uint32_t>& fsr_xs_indices) {
+#pragma omp parallel for schedule(static)
+  for (long long s = 0; s < static_cast<long long>(fsr_indx_.size()); s++) {
+    xs_indx_[s] = fsr_xs_indices[fsr_indx_[s]];
+  }
+}
+
+void SegmentStore::pack(const std::vector<std::vector<Track>>& tracks,
+                        const std::vector<std::uint32_t>& fsr_xs_indices,
+                        const CMFD* cmfd) {
+  this->clear();
+
+  if (fsr_xs_indices.size() >= std::numeric_limits<std::uint32_t>::max()) {
+    const auto mssg = "Too many flat source regions to pack segments.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  // The offsets and the CMFD crossings are found first, so that the
+  // segments can then be written in parallel
+  std::vector<const Track*> track_list;
+  std::size_t tt = 0;
+  std::size_t nsegs = 0;
+  for (const auto& angle_tracks : tracks) {
+    angle_offsets_.push_back(tt);
+
+    for (const auto& track : angle_tracks) {
+      track_list.push_back(&track);
+      track_offsets_.push_back(nsegs);
+      crossing_offsets_.push_back(crossings_.size());
+
+      for (std::size_t j = 0; j < track.size(); j++) {
+        const auto& seg = track[j];
+        if (seg.fsr_indx() >= fsr_xs_indices.size()) {
+          const auto mssg = "Segment in an unknown flat source region.";
+          spdlog::error(mssg);
+          throw ScarabeeException(mssg);
+        }
+
+        if (cmfd &&
+            (seg.entry_cmfd_surface() || seg.exit_cmfd_surface())) {
+          crossings_.push_back(
+              {nsegs + j,
+               cmfd->surface_tally(seg.entry_cmfd_surface()),
+               cmfd->surface_tally(seg.exit_cmfd_surface())});
+        }
+      }
+
+      nsegs += track.size();
+      tt++;
+    }
+  }
+
+  track_offsets_.push_back(nsegs);
+  crossing_offsets_.push_back(crossings_.size());
+
+  fsr_indx_.resize(nsegs);
+  xs_indx_.resize(nsegs);
+  length_.resize(nsegs);
+
+#pragma omp parallel for schedule(static)
+  for (long long it = 0; it < static_cast<long long>(tt); it++) {
+    const Track& track = *track_list[it];
+    std::size_t s = track_offsets_[it];
+    for (const auto& seg : track) {
+      const std::size_t i = seg.fsr_indx();
+      fsr_indx_[s] = static_cast<std::uint32_t>(i);
+      xs_indx_[s] = fsr_xs_indices[i];
+      length_[s] = static_cast<StoredReal>(seg.length());
+      s++;
+    }
+  }
+}
+
+void SegmentStore::pack_offsets(
+    const std::vector<std::vector<Track>>& tracks,
+    const std::vector<std::size_t>& track_nsegments) {
+  this->clear();
+
+  std::size_t tt = 0;
+  std::size_t nsegs = 0;
+  for (const auto& angle_tracks : tracks) {
+    angle_offsets_.push_back(tt);
+    for (std::size_t t = 0; t < angle_tracks.size(); t++) {
+      if (tt >= track_nsegments.size()) {
+        const auto mssg = "Number of segments of a track is missing.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+
+      track_offsets_.push_back(nsegs);
+      crossing_offsets_.push_back(0);
+      nsegs += track_nsegments[tt];
+      tt++;
+    }
+  }
+
+  track_offsets_.push_back(nsegs);
+  crossing_offsets_.push_back(0);
+}
+
+void SegmentStore::pack_track(const std::vector<Segment>& segments,
+                              const std::vector<std::uint32_t>& fsr_xs_indices,
+                              const CMFD* cmfd) {
+  const std::size_t nsegs = segments.size();
+  angle_offsets_.assign(1, 0);
+  track_offsets_.assign({0, nsegs});
+  crossings_.clear();
+  fsr_indx_.resize(nsegs);
+  xs_indx_.resize(nsegs);
+  length_.resize(nsegs);
+
+  for (std::size_t s = 0; s < nsegs; s++) {
+    const auto& seg = segments[s];
+    const std::size_t i = seg.fsr_indx();
+    fsr_indx_[s] = static_cast<std::uint32_t>(i);
+    xs_indx_[s] = fsr_xs_indices[i];
+    length_[s] = static_cast<StoredReal>(seg.length());
+
+    if (cmfd && (seg.entry_cmfd_surface() || seg.exit_cmfd_surface())) {
+      crossings_.push_back({s, cmfd->surface_tally(seg.entry_cmfd_surface()),
+                            cmfd->surface_tally(seg.exit_cmfd_surface())});
+    }
+  }
+
+  crossing_offsets_.assign({0, crossings_.size()});
+}
+
+}  // namespace scarabee
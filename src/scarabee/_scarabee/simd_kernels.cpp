@@ -0,0 +1,60 @@
+#include <utils/simd_kernels.hpp>
+
+#include <xsimd/xsimd.hpp>
+
+#include <string>
+#include <utility>
+
+namespace scarabee {
+
+namespace {
+
+// Same choice as xsimd::dispatch: the first architecture of the list which
+// the CPU supports
+template <class... Archs>
+std::string best_architecture(xsimd::arch_list<Archs...>) {
+  const unsigned best = xsimd::available_architectures().best;
+  for (const auto& [version, name] :
+       {std::pair<unsigned, const char*>{Archs::version(), Archs::name()}...}) {
+    if (version <= best) return name;
+  }
+  return xsimd::default_arch::name();
+}
+
+}  // namespace
+
+std::string simd_architecture() { return best_architecture(simd_archs{}); }
+
+void mexp_array(const double* x, double* out, std::size_t n) {
+  static auto kernel = xsimd::dispatch<simd_archs>(MexpKernel{});
+  kernel(x, out, n);
+}
+
+void ki3_table_evaluate(const double* slope, const double* intercept,
+                        double x_max, double invs_dx, const double* x,
+                        double* out, std::size_t n) {
+  static auto kernel = xsimd::dispatch<simd_archs>(Ki3TableKernel{});
+  kernel(slope, intercept, x_max, invs_dx, x, out, n);
+}
+
+void attenuate_segments(std::size_t npol, const double* invs_sin,
+                        const double* wsin, double* angflux,
+                        const double* lEt, const double* Q_Et,
+                        const double* exp_m1, std::ptrdiff_t exp_stride,
+                        std::size_t n, double* delta) {
+  static auto kernel = xsimd::dispatch<simd_archs>(AttenuateSegmentsKernel{});
+  kernel(npol, invs_sin, wsin, angflux, lEt, Q_Et, exp_m1, exp_stride, n,
+         delta);
+}
+
+void scatter_source(std::size_t i_begin, std::size_t i_end, std::size_t g,
+                    std::size_t ngroups, const std::uint32_t* mat,
+                    const std::size_t* offsets, const double* xs,
+                    const std::uint32_t* gin, const double* flux,
+                    std::size_t gstride, std::size_t istride, double* Q) {
+  static auto kernel = xsimd::dispatch<simd_archs>(ScatterSourceKernel{});
+  kernel(i_begin, i_end, g, ngroups, mat, offsets, xs, gin, flux, gstride,
+         istride, Q);
+}
+
+}  // namespace scarabee
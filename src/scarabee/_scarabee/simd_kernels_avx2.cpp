@@ -0,0 +1,6 @@
+// Compiled with -mavx2 -mfma when SCARABEE_SIMD_DISPATCH is enabled
+#ifdef SCARABEE_SIMD_DISPATCH
+#include <utils/simd_kernels_impl.hpp>
+
+SCARABEE_INSTANTIATE_SIMD_KERNELS(xsimd::fma3<xsimd::avx2>)
+#endif
@@ -0,0 +1,7 @@
+// Compiled with -mavx512f -mavx512cd -mavx512dq -mavx512bw -mfma when
+// SCARABEE_SIMD_DISPATCH is enabled
+#ifdef SCARABEE_SIMD_DISPATCH
+#include <utils/simd_kernels_impl.hpp>
+
+SCARABEE_INSTANTIATE_SIMD_KERNELS(xsimd::avx512bw)
+#endif
@@ -0,0 +1,4 @@
+// Kernels for the instruction set of the build
+#include <utils/simd_kernels_impl.hpp>
+
+SCARABEE_INSTANTIATE_SIMD_KERNELS(xsimd::default_arch)
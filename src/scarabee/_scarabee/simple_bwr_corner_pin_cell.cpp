@@ -208,6 +208,8 @@ SimpleBWRCornerPinCell::SimpleBWRCornerPinCell(
       build_IV();
       break;
   }
+
+  this->build_fsr_index();
 }
 
 void SimpleBWRCornerPinCell::build_I() {
@@ -53,6 +53,8 @@ SimplePinCell::SimplePinCell(
       build_iv();
       break;
   }
+
+  this->build_fsr_index();
 }
 
 void SimplePinCell::build_full() {
@@ -37,14 +37,10 @@ SphericalHarmonics::SphericalHarmonics(
       else
         theta = PI - polar_angle[p - n_polar_angle];
 
-      std::size_t it_lj = 0;
-      for (unsigned int l = 0; l <= L_; l++) {
-        for (int j = -static_cast<int>(l); j <= static_cast<int>(l); j++) {
-          all_harmonics_(azm, p, it_lj) = spherical_hamonics(l, j, phi, theta);
-          it_lj++;
-        }
-
-      }  // all scattering moments
+      // All moments of the direction are evaluated at once
+      spherical_harmonics_table(static_cast<unsigned int>(L_), phi, theta,
+                                std::span<double>(&all_harmonics_(azm, p, 0),
+                                                  Nlj_));
     }  // all polar angles
   }  // all azimuthal angles
 }
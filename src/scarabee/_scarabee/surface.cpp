@@ -1,4 +1,5 @@
 #include <moc/surface.hpp>
+#include <moc/surface_kernels.hpp>
 #include <utils/constants.hpp>
 
 #include <cmath>
@@ -9,31 +10,6 @@ namespace scarabee {
 // XPlane
 //-----------------------------------------------------------------------------
 
-inline Surface::Side xplane_side(const double x0, const Vector& r,
-                                 const Direction& u) {
-  if (r.x() - x0 > SURFACE_COINCIDENT)
-    return Surface::Side::Positive;
-  else if (r.x() - x0 < -SURFACE_COINCIDENT)
-    return Surface::Side::Negative;
-  else {
-    if (u.x() > 0.)
-      return Surface::Side::Positive;
-    else
-      return Surface::Side::Negative;
-  }
-}
-
-inline double xplane_distance(const double x0, const Vector& r,
-                              const Direction& u) {
-  const double diff = x0 - r.x();
-  if (std::abs(diff) < SURFACE_COINCIDENT || u.x() == 0.)
-    return INF;
-  else if (diff / u.x() < 0.)
-    return INF;
-  else
-    return diff / u.x();
-}
-
 inline double xplane_integrate_x(const double /*x0*/, const double /*xmin*/,
                                  const double /*xmax*/,
                                  const Surface::Side /*side*/) {
@@ -51,31 +27,6 @@ inline double xplane_integrate_y(const double x0, const double xmin,
 // YPlane
 //-----------------------------------------------------------------------------
 
-inline Surface::Side yplane_side(const double y0, const Vector& r,
-                                 const Direction& u) {
-  if (r.y() - y0 > SURFACE_COINCIDENT)
-    return Surface::Side::Positive;
-  else if (r.y() - y0 < -SURFACE_COINCIDENT)
-    return Surface::Side::Negative;
-  else {
-    if (u.y() > 0.)
-      return Surface::Side::Positive;
-    else
-      return Surface::Side::Negative;
-  }
-}
-
-inline double yplane_distance(const double y0, const Vector& r,
-                              const Direction& u) {
-  const double diff = y0 - r.y();
-  if (std::abs(diff) < SURFACE_COINCIDENT || u.y() == 0.)
-    return INF;
-  else if (diff / u.y() < 0.)
-    return INF;
-  else
-    return diff / u.y();
-}
-
 inline double yplane_integrate_x(const double y0, const double xmin,
                                  const double xmax,
                                  const Surface::Side /*side*/) {
@@ -93,34 +44,6 @@ inline double yplane_integrate_y(const double /*y0*/, const double /*ymin*/,
 // Plane
 //-----------------------------------------------------------------------------
 
-inline Surface::Side plane_side(const double A, const double B, const double C,
-                                const Vector& r, const Direction& u) {
-  const double eval = A * r.x() + B * r.y() - C;
-  if (eval > SURFACE_COINCIDENT)
-    return Surface::Side::Positive;
-  else if (eval < -SURFACE_COINCIDENT)
-    return Surface::Side::Negative;
-  else {
-    if ((A * u.x() + B * u.y()) > 0.)
-      return Surface::Side::Positive;
-    else
-      return Surface::Side::Negative;
-  }
-}
-
-inline double plane_distance(const double A, const double B, const double C,
-                             const Vector& r, const Direction& u) {
-  const double num = C - A * r.x() - B * r.y();
-  const double denom = A * u.x() + B * u.y();
-  const double d = num / denom;
-  if (std::abs(d) < SURFACE_COINCIDENT || denom == 0.)
-    return INF;
-  else if (d < 0.)
-    return INF;
-  else
-    return d;
-}
-
 inline double plane_integrate_x(const double A, const double B, const double C,
                                 const double xmin, const double xmax,
                                 const Surface::Side /*side*/) {
@@ -143,55 +66,6 @@ inline double plane_integrate_y(const double A, const double B, const double C,
 // Cylinder
 //-----------------------------------------------------------------------------
 
-inline Surface::Side cylinder_side(const double x0, const double y0,
-                                   const double rc, const Vector& r,
-                                   const Direction& u) {
-  const double x = r.x() - x0;
-  const double y = r.y() - y0;
-  const double eval = y * y + x * x - rc * rc;
-  if (eval > SURFACE_COINCIDENT)
-    return Surface::Side::Positive;
-  else if (eval < -SURFACE_COINCIDENT)
-    return Surface::Side::Negative;
-  else {
-    Direction norm(r.x() - x0, r.y() - y0);
-    if (u.dot(norm) > 0.)
-      return Surface::Side::Positive;
-    else
-      return Surface::Side::Negative;
-  }
-}
-
-inline double cylinder_distance(const double x0, const double y0,
-                                const double rc, const Vector& r,
-                                const Direction& u) {
-  const double a = u.y() * u.y() + u.x() * u.x();
-  if (a == 0.) return INF;
-
-  const double x = r.x() - x0;
-  const double y = r.y() - y0;
-  const double k = y * u.y() + x * u.x();
-  const double c = y * y + x * x - rc * rc;
-  const double quad = k * k - a * c;
-
-  if (quad < 0.)
-    return INF;
-  else if (std::abs(c) < SURFACE_COINCIDENT) {
-    if (k >= 0.)
-      return INF;
-    else
-      return (-k + std::sqrt(quad)) / a;
-  } else if (c < 0.) {
-    return (-k + std::sqrt(quad)) / a;
-  } else {
-    const double d = (-k - std::sqrt(quad)) / a;
-    if (d < 0.)
-      return INF;
-    else
-      return d;
-  }
-}
-
 inline double cylinder_integrate_x(const double x0, const double y0,
                                    const double rc, const double xmin,
                                    const double xmax,
@@ -0,0 +1,137 @@
+#include <utils/threads.hpp>
+#include <utils/logging.hpp>
+#include <utils/scarabee_exception.hpp>
+
+#if defined(SCARABEE_USE_OMP) && defined(__linux__)
+#include <sched.h>
+#define SCARABEE_PIN_THREADS
+#endif
+
+#include <atomic>
+#include <cstring>
+#include <string>
+
+namespace scarabee {
+
+namespace {
+
+std::atomic<std::size_t> default_threads_{0};
+std::atomic<bool> reproducible_reductions_{false};
+std::atomic<std::size_t> reduction_blocks_{32};
+
+bool in_parallel() {
+#ifdef SCARABEE_USE_OMP
+  return omp_in_parallel() != 0;
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+std::size_t default_threads() { return default_threads_.load(); }
+
+void set_default_threads(std::size_t n) { default_threads_.store(n); }
+
+bool reproducible_reductions() { return reproducible_reductions_.load(); }
+
+std::size_t reduction_blocks() { return reduction_blocks_.load(); }
+
+void set_reproducible_reductions(bool enabled, std::size_t nblocks) {
+  if (nblocks == 0) {
+    const auto mssg = "The number of reduction blocks must be at least 1.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  reduction_blocks_.store(nblocks);
+  reproducible_reductions_.store(enabled);
+}
+
+std::vector<std::vector<std::size_t>> core_sets(std::size_t n) {
+  const std::size_t ncores = hardware_threads();
+  if (n == 0 || n > ncores) {
+    const auto mssg = "Cannot split " + std::to_string(ncores) +
+                      " cores into " + std::to_string(n) + " sets.";
+    spdlog::error(mssg);
+    throw ScarabeeException(mssg);
+  }
+
+  std::vector<std::vector<std::size_t>> sets(n);
+  for (std::size_t s = 0; s < n; s++) {
+    for (std::size_t c = s * ncores / n; c < (s + 1) * ncores / n; c++) {
+      sets[s].push_back(c);
+    }
+  }
+  return sets;
+}
+
+void ThreadSettings::set_cores(const std::vector<std::size_t>& new_cores) {
+  for (const auto c : new_cores) {
+    if (c >= hardware_threads()) {
+      const auto mssg = "Core " + std::to_string(c) +
+                        " is not available to the process, which has " +
+                        std::to_string(hardware_threads()) + " cores.";
+      spdlog::error(mssg);
+      throw ScarabeeException(mssg);
+    }
+  }
+
+#ifndef SCARABEE_PIN_THREADS
+  if (new_cores.empty() == false) {
+    spdlog::warn("Pinning threads to cores is not supported on this build.");
+  }
+#endif
+
+  cores = new_cores;
+}
+
+ThreadScope::ThreadScope(const ThreadSettings& settings) {
+  if (in_parallel()) return;
+
+  team_ = settings.num_threads;
+  if (team_ == 0) team_ = settings.cores.size();
+  if (team_ == 0) team_ = default_threads();
+  if (team_ == 0) return;
+
+  prev_threads_ = max_threads();
+  set_num_threads(team_);
+
+#ifdef SCARABEE_PIN_THREADS
+  if (settings.cores.empty()) return;
+
+  saved_masks_.assign(team_, std::vector<unsigned char>(sizeof(cpu_set_t)));
+#pragma omp parallel num_threads(static_cast<int>(team_))
+  {
+    const std::size_t thrd = thread_index();
+    cpu_set_t mask;
+    sched_getaffinity(0, sizeof(cpu_set_t), &mask);
+    std::memcpy(saved_masks_[thrd].data(), &mask, sizeof(cpu_set_t));
+
+    CPU_ZERO(&mask);
+    CPU_SET(settings.cores[thrd % settings.cores.size()], &mask);
+    sched_setaffinity(0, sizeof(cpu_set_t), &mask);
+  }
+#endif
+}
+
+ThreadScope::~ThreadScope() {
+  if (team_ == 0) return;
+
+#ifdef SCARABEE_PIN_THREADS
+  // The same threads are given back to a team of the same size
+  if (saved_masks_.empty() == false) {
+#pragma omp parallel num_threads(static_cast<int>(team_))
+    {
+      cpu_set_t mask;
+      std::memcpy(&mask, saved_masks_[thread_index()].data(),
+                  sizeof(cpu_set_t));
+      sched_setaffinity(0, sizeof(cpu_set_t), &mask);
+    }
+  }
+#endif
+
+  set_num_threads(prev_threads_);
+}
+
+}  // namespace scarabee
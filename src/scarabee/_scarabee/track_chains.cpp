@@ -0,0 +1,80 @@
+#include <moc/track_chains.hpp>
+#include <utils/scarabee_exception.hpp>
+#include <utils/logging.hpp>
+
+namespace scarabee {
+
+void TrackChains::clear() {
+  chain_offsets_.clear();
+  rows_.clear();
+  slot_tracks_.clear();
+  open_.clear();
+}
+
+void TrackChains::build(const std::vector<std::vector<Track>>& tracks) {
+  this->clear();
+
+  std::size_t ntracks = 0;
+  for (const auto& angle_tracks : tracks) ntracks += angle_tracks.size();
+
+  // Tracks are numbered in the same order as in the SegmentStore
+  std::vector<const Track*> slot_ptrs(ntracks, nullptr);
+  slot_tracks_.resize(ntracks);
+  std::size_t tt = 0;
+  for (const auto& angle_tracks : tracks) {
+    for (const auto& track : angle_tracks) {
+      if (track.flux_slot() >= ntracks || slot_ptrs[track.flux_slot()]) {
+        const auto mssg = "Invalid track flux slot.";
+        spdlog::error(mssg);
+        throw ScarabeeException(mssg);
+      }
+      slot_ptrs[track.flux_slot()] = &track;
+      slot_tracks_[track.flux_slot()] = tt++;
+    }
+  }
+
+  // Row receiving the outgoing flux of the link with incoming row r, or nrows
+  // when the link leaves through a vacuum boundary.
+  const std::size_t nrows = 2 * ntracks;
+  auto next_row = [&slot_ptrs, nrows](std::size_t r) {
+    const Track& track = *slot_ptrs[r / 2];
+    if (r % 2 == 0) {
+      if (track.exit_bc() == BoundaryCondition::Vacuum) return nrows;
+      return track.exit_track_flux();
+    }
+    if (track.entry_bc() == BoundaryCondition::Vacuum) return nrows;
+    return track.entry_track_flux();
+  };
+
+  std::vector<char> has_prev(nrows, 0);
+  for (std::size_t r = 0; r < nrows; r++) {
+    const std::size_t n = next_row(r);
+    if (n < nrows) has_prev[n] = 1;
+  }
+
+  std::vector<char> visited(nrows, 0);
+  rows_.reserve(nrows);
+  auto follow = [&](std::size_t r, bool open) {
+    chain_offsets_.push_back(rows_.size());
+    open_.push_back(open ? 1 : 0);
+    while (r < nrows && visited[r] == 0) {
+      visited[r] = 1;
+      rows_.push_back(r);
+      r = next_row(r);
+    }
+  };
+
+  // Open chains are started from their vacuum boundary
+  for (std::size_t r = 0; r < nrows; r++) {
+    if (has_prev[r] == 0) follow(r, true);
+  }
+
+  // All remaining links belong to closed cycles
+  for (std::size_t r = 0; r < nrows; r++) {
+    if (visited[r] == 0) follow(r, false);
+  }
+
+  chain_offsets_.push_back(rows_.size());
+}
+
+}  // namespace scarabee
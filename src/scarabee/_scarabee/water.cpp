@@ -157,8 +157,8 @@ std::shared_ptr<Material> borated_water(double boron_ppm, double temperature,
 
   // Construct the material composition
   MaterialComposition water_comp(Fraction::Atoms);
-  water_comp.add_nuclide("H1_H2O", 2. * frac_H2O * NATURAL_ABUNDANCES.at("H1"));
-  water_comp.add_nuclide("H2", 2. * frac_H2O * NATURAL_ABUNDANCES.at("H2"));
+  water_comp.add_nuclide("H1_H2O", 2. * frac_H2O * natural_abundance("H1"));
+  water_comp.add_nuclide("H2", 2. * frac_H2O * natural_abundance("H2"));
   water_comp.add_element("O", frac_H2O);
   if (frac_B > 0.) water_comp.add_element("B", frac_B);
 
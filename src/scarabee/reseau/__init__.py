@@ -1,4 +1,5 @@
 from .fuel_pin import *
 from .guide_tube import *
 from .reflector import *
-from .pwr_assembly import *
\ No newline at end of file
+from .pwr_assembly import *
+from .campaign import *
@@ -0,0 +1,21 @@
+from .._scarabee import CrossSection
+import numpy as np
+
+# The fuel and cladding Dancoff problems have the same geometry and differ
+# only in their cross sections and sources. They are solved together as the
+# two groups of one fixed-source problem without scattering, so that the
+# tracks are only swept once for both.
+FUEL_DANCOFF_GROUP = 0
+CLAD_DANCOFF_GROUP = 1
+
+# CMFD condensation scheme of the Dancoff problems, which keeps both groups
+DANCOFF_CMFD_GROUPS = [
+    [FUEL_DANCOFF_GROUP, FUEL_DANCOFF_GROUP],
+    [CLAD_DANCOFF_GROUP, CLAD_DANCOFF_GROUP],
+]
+
+
+def _dancoff_xs(fuel_xs: float, clad_xs: float, name: str) -> CrossSection:
+    # Purely absorbing, so that the two problems are not coupled
+    Et = np.array([fuel_xs, clad_xs])
+    return CrossSection(Et, Et.copy(), np.zeros((2, 2)), name)
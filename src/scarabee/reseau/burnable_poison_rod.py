@@ -1,14 +1,22 @@
 from .._scarabee import (
     NDLibrary,
     DepletionChain,
-    MaterialComposition,
     Material,
     CrossSection,
     MOCDriver,
     DepletionChain,
     DepletionMatrix,
-    build_depletion_matrix,
+    DepletionRequest,
+    DepletionResult,
+    deplete_materials,
+    celi_predictor_substeps,
+    celi_corrector_substeps,
+    leqi_predictor_substeps,
+    leqi_corrector_substeps,
+    SelfShieldingMethod,
+    SelfShieldingRequest,
 )
+from ._dancoff import CLAD_DANCOFF_GROUP, FUEL_DANCOFF_GROUP, _dancoff_xs
 import numpy as np
 from typing import Optional, List, Tuple
 import copy
@@ -113,33 +121,21 @@ class BurnablePoisonRod:
         # ----------------------------------------------------------------------
         self._center_dancoff_xs: Optional[CrossSection] = None
         if self.center is not None:
-            self._center_dancoff_xs = CrossSection(
-                np.array([self.center.potential_xs]),
-                np.array([self.center.potential_xs]),
-                np.array([[0.0]]),
-                "BPR Clad",
+            self._center_dancoff_xs = _dancoff_xs(
+                self.center.potential_xs, self.center.potential_xs, "BPR Clad"
             )
 
-        self._clad_dancoff_xs: CrossSection = CrossSection(
-            np.array([self.clad.potential_xs]),
-            np.array([self.clad.potential_xs]),
-            np.array([[0.0]]),
-            "BPR Clad",
+        self._clad_dancoff_xs: CrossSection = _dancoff_xs(
+            self.clad.potential_xs, self.clad.potential_xs, "BPR Clad"
         )
 
-        self._gap_dancoff_xs: CrossSection = CrossSection(
-            np.array([self.gap.potential_xs]),
-            np.array([self.gap.potential_xs]),
-            np.array([[0.0]]),
-            "BPR Gap",
+        self._gap_dancoff_xs: CrossSection = _dancoff_xs(
+            self.gap.potential_xs, self.gap.potential_xs, "BPR Gap"
         )
 
         # Make initial poison Dancoff xs with initial material
-        self._poison_dancoff_xs: CrossSection = CrossSection(
-            np.array([poison.potential_xs]),
-            np.array([poison.potential_xs]),
-            np.array([[0.0]]),
-            "BPR Poison",
+        self._poison_dancoff_xs: CrossSection = _dancoff_xs(
+            poison.potential_xs, poison.potential_xs, "BPR Poison"
         )
 
         # Center IDs and indices are only populated if the center material is
@@ -318,48 +314,44 @@ class BurnablePoisonRod:
         for id in self._poison_full_dancoff_fsr_ids:
             self._poison_full_dancoff_fsr_inds.append(fullmoc.get_fsr_indx(id, 0))
 
+    def dancoff_potential_xs(self) -> List[float]:
+        """
+        Potential cross sections of the materials of the poison rod which
+        define the Dancoff correction calculations, using the most recent
+        poison composition.
+
+        Returns
+        -------
+        list of float
+            Potential cross sections of the center (if not moderator),
+            cladding, gap, and poison.
+        """
+        pot_xs = []
+        if self.center is not None:
+            pot_xs.append(self.center.potential_xs)
+        pot_xs.append(self.clad.potential_xs)
+        pot_xs.append(self.gap.potential_xs)
+        pot_xs.append(self.poison_materials[-1].potential_xs)
+        return pot_xs
+
     def set_xs_for_dancoff_calculation(self) -> None:
         """
         Sets the cross sections for the Dancoff calculations based on the most
         recent poison composition.
         """
         if self._center_dancoff_xs is not None and self.center is not None:
-            self._center_dancoff_xs.set(
-                CrossSection(
-                    np.array([self.center.potential_xs]),
-                    np.array([self.center.potential_xs]),
-                    np.array([[0.0]]),
-                    "BPR Clad",
-                )
-            )
+            pot_xs = self.center.potential_xs
+            self._center_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "BPR Clad"))
 
-        self._clad_dancoff_xs.set(
-            CrossSection(
-                np.array([self.clad.potential_xs]),
-                np.array([self.clad.potential_xs]),
-                np.array([[0.0]]),
-                "BPR Clad",
-            )
-        )
+        pot_xs = self.clad.potential_xs
+        self._clad_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "BPR Clad"))
 
-        self._gap_dancoff_xs.set(
-            CrossSection(
-                np.array([self.gap.potential_xs]),
-                np.array([self.gap.potential_xs]),
-                np.array([[0.0]]),
-                "BPR Gap",
-            )
-        )
+        pot_xs = self.gap.potential_xs
+        self._gap_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "BPR Gap"))
 
         # Make initial poison Dancoff xs with initial material
-        self._poison_dancoff_xs.set(
-            CrossSection(
-                np.array([self.poison_materials[-1].potential_xs]),
-                np.array([self.poison_materials[-1].potential_xs]),
-                np.array([[0.0]]),
-                "BPR Poison",
-            )
-        )
+        pot_xs = self.poison_materials[-1].potential_xs
+        self._poison_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "BPR Poison"))
 
     def set_isolated_dancoff_fuel_sources(
         self, isomoc: MOCDriver, moderator: Material
@@ -377,26 +369,7 @@ class BurnablePoisonRod:
             Material definition for the moderator, used to obtain the potential
             scattering cross section.
         """
-        # We only set sources for the center if it isn't moderator ! Otherwise,
-        # the GuideTube class is responsible for taking care of this. This case
-        # is indicated by the center material being None. For this case, the
-        # list of FSR indices should be empty.
-        if self.center is not None:
-            pot_xs = self.center.potential_xs
-            for ind in self._center_isolated_dancoff_fsr_inds:
-                isomoc.set_extern_src(ind, 0, pot_xs)
-
-        pot_xs = self.clad.potential_xs
-        for ind in self._clad_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
-
-        pot_xs = self.gap.potential_xs
-        for ind in self._gap_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
-
-        pot_xs = self.poison_materials[-1].potential_xs
-        for ind in self._poison_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        self._set_isolated_dancoff_sources(isomoc, FUEL_DANCOFF_GROUP)
 
     def set_isolated_dancoff_clad_sources(
         self, isomoc: MOCDriver, moderator: Material, ndl: NDLibrary
@@ -407,7 +380,7 @@ class BurnablePoisonRod:
         correction calculation.
 
         The cladding of a burnable poison pin is no self-shielded. Therefore,
-        this method is an alias to set_isolated_dancoff_fuel_sources.
+        the sources are the same as for set_isolated_dancoff_fuel_sources.
 
         Parameters
         ----------
@@ -420,7 +393,7 @@ class BurnablePoisonRod:
             Nuclear data library for obtaining potential scattering cross
             sections.
         """
-        self.set_isolated_dancoff_fuel_sources(isomoc, moderator)
+        self._set_isolated_dancoff_sources(isomoc, CLAD_DANCOFF_GROUP)
 
     def set_full_dancoff_fuel_sources(
         self, fullmoc: MOCDriver, moderator: Material
@@ -438,26 +411,7 @@ class BurnablePoisonRod:
             Material definition for the moderator, used to obtain the potential
             scattering cross section.
         """
-        # We only set sources for the center if it isn't moderator ! Otherwise,
-        # the GuideTube class is responsible for taking care of this. This case
-        # is indicated by the center material being None. For this case, the
-        # list of FSR indices should be empty.
-        if self.center is not None:
-            pot_xs = self.center.potential_xs
-            for ind in self._center_full_dancoff_fsr_inds:
-                fullmoc.set_extern_src(ind, 0, pot_xs)
-
-        pot_xs = self.clad.potential_xs
-        for ind in self._clad_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
-
-        pot_xs = self.gap.potential_xs
-        for ind in self._gap_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
-
-        pot_xs = self.poison_materials[-1].potential_xs
-        for ind in self._poison_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        self._set_full_dancoff_sources(fullmoc, FUEL_DANCOFF_GROUP)
 
     def set_full_dancoff_clad_sources(
         self, fullmoc: MOCDriver, moderator: Material, ndl: NDLibrary
@@ -468,7 +422,7 @@ class BurnablePoisonRod:
         correction calculation.
 
         The cladding of a burnable poison pin is no self-shielded. Therefore,
-        this method is an alias to set_isolated_dancoff_fuel_sources.
+        the sources are the same as for set_full_dancoff_fuel_sources.
 
         Parameters
         ----------
@@ -481,11 +435,112 @@ class BurnablePoisonRod:
             Nuclear data library for obtaining potential scattering cross
             sections.
         """
-        self.set_full_dancoff_fuel_sources(fullmoc, moderator)
+        self._set_full_dancoff_sources(fullmoc, CLAD_DANCOFF_GROUP)
+
+    def _set_isolated_dancoff_sources(self, isomoc: MOCDriver, g: int) -> None:
+        # We only set sources for the center if it isn't moderator ! Otherwise,
+        # the GuideTube class is responsible for taking care of this. This case
+        # is indicated by the center material being None. For this case, the
+        # list of FSR indices should be empty.
+        if self.center is not None:
+            pot_xs = self.center.potential_xs
+            isomoc.set_extern_src(self._center_isolated_dancoff_fsr_inds, g, pot_xs)
+
+        pot_xs = self.clad.potential_xs
+        isomoc.set_extern_src(self._clad_isolated_dancoff_fsr_inds, g, pot_xs)
+
+        pot_xs = self.gap.potential_xs
+        isomoc.set_extern_src(self._gap_isolated_dancoff_fsr_inds, g, pot_xs)
+
+        pot_xs = self.poison_materials[-1].potential_xs
+        isomoc.set_extern_src(self._poison_isolated_dancoff_fsr_inds, g, pot_xs)
+
+    def _set_full_dancoff_sources(self, fullmoc: MOCDriver, g: int) -> None:
+        # We only set sources for the center if it isn't moderator ! Otherwise,
+        # the GuideTube class is responsible for taking care of this. This case
+        # is indicated by the center material being None. For this case, the
+        # list of FSR indices should be empty.
+        if self.center is not None:
+            pot_xs = self.center.potential_xs
+            fullmoc.set_extern_src(self._center_full_dancoff_fsr_inds, g, pot_xs)
+
+        pot_xs = self.clad.potential_xs
+        fullmoc.set_extern_src(self._clad_full_dancoff_fsr_inds, g, pot_xs)
+
+        pot_xs = self.gap.potential_xs
+        fullmoc.set_extern_src(self._gap_full_dancoff_fsr_inds, g, pot_xs)
+
+        pot_xs = self.poison_materials[-1].potential_xs
+        fullmoc.set_extern_src(self._poison_full_dancoff_fsr_inds, g, pot_xs)
 
     # ==========================================================================
     # Transport Calculation Related Methods
 
+    def xs_requests(self, t: int) -> List[SelfShieldingRequest]:
+        """
+        Describes the infinitely dilute cross sections of the center (if not
+        moderator), gap, cladding, and poison at the specified depletion step,
+        so that they may be computed along with those of other cells by
+        :py:func:`self_shield_materials`.
+
+        Parameters
+        ----------
+        t : int
+            Index for the depletion step.
+
+        Returns
+        -------
+        list of SelfShieldingRequest
+            Requests in the order expected by :py:meth:`apply_xs`.
+        """
+        mats = [self.gap, self.clad, self.poison_materials[t]]
+        if self.center is not None:
+            mats.insert(0, self.center)
+
+        return [
+            SelfShieldingRequest(
+                mat, SelfShieldingMethod.Dilution, dils=[1.0e10] * mat.size, max_l=1
+            )
+            for mat in mats
+        ]
+
+    def apply_xs(self, xss: List[CrossSection]) -> None:
+        """
+        Applies the cross sections computed from the requests of
+        :py:meth:`xs_requests`.
+
+        Parameters
+        ----------
+        xss : list of CrossSection
+            Cross sections of the center (if not moderator), gap, cladding,
+            and poison.
+        """
+        nxs = 4 if self.center is not None else 3
+        if len(xss) != nxs:
+            raise RuntimeError(
+                "Number of cross sections does not agree with the burnable poison rod."
+            )
+
+        if self.center is not None:
+            self._center_xs = self._apply_xs(self._center_xs, xss[0], "BPR Center")
+        self._gap_xs = self._apply_xs(self._gap_xs, xss[-3], "BPR Gap")
+        self._clad_xs = self._apply_xs(self._clad_xs, xss[-2], "BPR Clad")
+        self._poison_xs = self._apply_xs(self._poison_xs, xss[-1], "BPR Poison")
+
+    @staticmethod
+    def _apply_xs(
+        old: Optional[CrossSection], xs: CrossSection, name: str
+    ) -> CrossSection:
+        # Existing objects are reset, as the MOC cells hold them
+        if old is None:
+            old = xs
+        else:
+            old.set(xs)
+
+        if old.name == "":
+            old.name = name
+        return old
+
     def set_center_xs(self, ndl: NDLibrary) -> None:
         """
         Constructs the CrossSection object for the material at the center of
@@ -613,19 +668,23 @@ class BurnablePoisonRod:
         moc : MOCDriver
             MOC simulation for the full calculations.
         """
-        self._center_fsr_inds = []
-        self._clad_fsr_inds = []
-        self._gap_fsr_inds = []
-        self._poison_fsr_inds = []
+        self._set_fsr_indexes(moc.get_fsr_indxs(self._fsr_id_sets(), 0))
 
-        for id in self._center_fsr_ids:
-            self._center_fsr_inds.append(moc.get_fsr_indx(id, 0))
-        for id in self._clad_fsr_ids:
-            self._clad_fsr_inds.append(moc.get_fsr_indx(id, 0))
-        for id in self._gap_fsr_ids:
-            self._gap_fsr_inds.append(moc.get_fsr_indx(id, 0))
-        for id in self._poison_fsr_ids:
-            self._poison_fsr_inds.append(moc.get_fsr_indx(id, 0))
+    def _fsr_id_sets(self) -> List[List[int]]:
+        # Sets of FSR IDs of the full MOC calculation, in the order expected
+        # by _set_fsr_indexes
+        return [
+            self._center_fsr_ids,
+            self._clad_fsr_ids,
+            self._gap_fsr_ids,
+            self._poison_fsr_ids,
+        ]
+
+    def _set_fsr_indexes(self, inds: List[List[int]]) -> None:
+        self._center_fsr_inds = inds[0]
+        self._clad_fsr_inds = inds[1]
+        self._gap_fsr_inds = inds[2]
+        self._poison_fsr_inds = inds[3]
 
     def obtain_flux_spectra(self, moc: MOCDriver) -> None:
         """
@@ -636,7 +695,17 @@ class BurnablePoisonRod:
         moc : MOCDriver
             MOC simulation for the full calculations.
         """
-        self._poison_flux_spectrum = moc.homogenize_flux_spectrum(self._poison_fsr_inds)
+        self._set_flux_spectra(
+            moc.homogenize_flux_spectra(self._flux_spectra_fsr_sets())
+        )
+
+    def _flux_spectra_fsr_sets(self) -> List[List[int]]:
+        # Sets of FSR indexes of the depleted regions, in the order expected
+        # by _set_flux_spectra
+        return [self._poison_fsr_inds]
+
+    def _set_flux_spectra(self, spectra: np.ndarray) -> None:
+        self._poison_flux_spectrum = spectra[0, :]
 
     def normalize_flux_spectrum(self, f) -> None:
         """
@@ -653,6 +722,29 @@ class BurnablePoisonRod:
 
         self._poison_flux_spectrum *= f
 
+    def flux_spectra_state(self) -> np.ndarray:
+        """
+        Copies the flux spectrum of the poison, so that it may be restored
+        after the calculation of a perturbed state.
+
+        Returns
+        -------
+        ndarray
+            Flux spectrum of the poison.
+        """
+        return np.array(self._poison_flux_spectrum)
+
+    def restore_flux_spectra_state(self, state: np.ndarray) -> None:
+        """
+        Restores the flux spectrum of the poison.
+
+        Parameters
+        ----------
+        state : ndarray
+            Flux spectrum from :py:meth:`flux_spectra_state`.
+        """
+        self._poison_flux_spectrum = state
+
     def predict_depletion(
         self,
         chain: DepletionChain,
@@ -679,6 +771,32 @@ class BurnablePoisonRod:
         dtm1 : float, optional
             Durration of the previous time step in seconds. Default is None.
         """
+        requests = self.predictor_depletion_requests(dt, dtm1)
+        self.set_predictor_depletion_results(
+            deplete_materials(chain, requests, ndl)
+        )
+
+    def predictor_depletion_requests(
+        self, dt: float, dtm1: Optional[float] = None
+    ) -> List[DepletionRequest]:
+        """
+        Makes the depletion request of the predictor for the poison, so that
+        many materials may be depleted at once with
+        :py:func:`deplete_materials`. The results must then be given to
+        :py:meth:`set_predictor_depletion_results`.
+
+        Parameters
+        ----------
+        dt : float
+            Durration of the time step in seconds.
+        dtm1 : float, optional
+            Durration of the previous time step in seconds. Default is None.
+
+        Returns
+        -------
+        list of DepletionRequest
+            Depletion request of the poison.
+        """
         if dt <= 0:
             raise ValueError("Predictor time step must be > 0.")
 
@@ -686,57 +804,38 @@ class BurnablePoisonRod:
         flux = self._poison_flux_spectrum
         mat = self._poison_materials[-1]  # Use last available mat !
 
-        # Build depletion matrix for beginning of time step
-        A0 = build_depletion_matrix(chain, mat, flux, ndl)
-
-        # Save current matrix
-        self._poison_current_dep_mat = A0
-
-        # At this point, we can clear the xs data from the last material as
-        # depletion matrix is now built.
-        mat.clear_all_micro_xs_data()
-
-        # Initialize an array with the initial target number densities
-        N = np.zeros(A0.size)
-        nuclides = A0.nuclides
-        for i, nuclide in enumerate(nuclides):
-            N[i] = mat.atom_density(nuclide)
-
+        # The matrix for the beginning of the time step is built from the last
+        # material, after which its xs data can be cleared.
         if self._poison_prev_dep_mat is None or dtm1 is None:
             # Use CE/LI
-            A0 *= dt
-
-            # Do the matrix exponential
-            A0.exponential_product(N)
-
-            # Undo multiplication by time step on the matrix
-            A0 /= dt
-
+            matrices = []
+            substeps = celi_predictor_substeps(dt)
         else:
             # Use LE/QI
-            Am1 = self._poison_prev_dep_mat
-
-            F1 = (-dt / (12.0 * dtm1)) * Am1 + ((6.0 * dtm1 + dt) / (12.0 * dtm1)) * A0
-            F1 *= dt
+            matrices = [self._poison_prev_dep_mat]
+            substeps = leqi_predictor_substeps(dt, dtm1)
 
-            F2 = (-5.0 * dt / (12.0 * dtm1)) * Am1 + (
-                (6.0 * dtm1 + 5.0 * dt) / (12.0 * dtm1)
-            ) * A0
-            F2 *= dt
+        return [
+            DepletionRequest(mat, mat, flux, matrices, substeps, clear_micro_xs=True)
+        ]
 
-            # Do the matrix exponentials
-            F1.exponential_product(N)
-            F2.exponential_product(N)
+    def set_predictor_depletion_results(self, results: List[DepletionResult]):
+        """
+        Saves the results of the requests made by
+        :py:meth:`predictor_depletion_requests`. The predicted material
+        composition is appended to the materials list.
 
-        # Now we can build a new material composition
-        new_mat_comp = MaterialComposition()
-        for i, nuclide in enumerate(nuclides):
-            if N[i] > 0.0:
-                new_mat_comp.add_nuclide(nuclide, N[i])
+        Parameters
+        ----------
+        results : list of DepletionResult
+            Depletion result of the poison.
+        """
+        if len(results) != 1:
+            raise ValueError("Burnable poison rod requires one result.")
 
-        # Make the new material
-        new_mat = Material(new_mat_comp, mat.temperature, ndl)
-        self._poison_materials.append(new_mat)
+        # Save current matrix
+        self._poison_current_dep_mat = results[0].matrix
+        self._poison_materials.append(results[0].material)
 
     def correct_depletion(
         self,
@@ -763,75 +862,128 @@ class BurnablePoisonRod:
         dtm1 : float, optional
             Durration of the previous time step in seconds. Default is None.
         """
+        requests = self.corrector_depletion_requests(dt, dtm1)
+        self.set_corrector_depletion_results(
+            deplete_materials(chain, requests, ndl)
+        )
+
+    def corrector_depletion_requests(
+        self, dt: float, dtm1: Optional[float] = None
+    ) -> List[DepletionRequest]:
+        """
+        Makes the depletion request of the corrector for the poison, so that
+        many materials may be depleted at once with
+        :py:func:`deplete_materials`. The results must then be given to
+        :py:meth:`set_corrector_depletion_results`.
+
+        Parameters
+        ----------
+        dt : float
+            Durration of the time step in seconds.
+        dtm1 : float, optional
+            Durration of the previous time step in seconds. Default is None.
+
+        Returns
+        -------
+        list of DepletionRequest
+            Depletion request of the poison.
+        """
         if dt <= 0:
             raise ValueError("Corrector time step must be > 0.")
 
-        # Get the flux and initial material
+        # Get the flux and predicted material
         flux = self._poison_flux_spectrum
         mat_pred = self._poison_materials[-1]  # Use last available mat !
+        mat_old = self._poison_materials[-2]  # Go 2 steps back !!
 
         # Get depletion matrix for beginning of time step
         A0 = self._poison_current_dep_mat
 
-        # Build depletion matrix and multiply by time step
-        Ap1 = build_depletion_matrix(chain, mat_pred, flux, ndl)
-
-        # Initialize an array with the initial target number densities
-        mat_old = self._poison_materials[-2]  # Go 2 steps back !!
-        N = np.zeros(Ap1.size)
-        nuclides = Ap1.nuclides
-        for i, nuclide in enumerate(nuclides):
-            N[i] = mat_old.atom_density(nuclide)
-
         if self._poison_prev_dep_mat is None or dtm1 is None:
             # Use CE/LI
-            F1 = (5.0 * dt / 12.0) * A0 + (dt / 12.0) * Ap1
-            F2 = (dt / 12.0) * A0 + (5.0 * dt / 12.0) * Ap1
-
-            F1.exponential_product(N)
-            F2.exponential_product(N)
-
+            matrices = [A0]
+            substeps = celi_corrector_substeps(dt)
         else:
             # Use LE/QI
+            matrices = [self._poison_prev_dep_mat, A0]
+            substeps = leqi_corrector_substeps(dt, dtm1)
 
-            # Get previous depletion matrix
-            Am1 = self._poison_prev_dep_mat
+        return [DepletionRequest(mat_pred, mat_old, flux, matrices, substeps)]
 
-            F3 = (
-                (-dt * dt / (12.0 * dtm1 * (dtm1 + dt))) * Am1
-                + (
-                    (5.0 * dtm1 * dtm1 + 6.0 * dtm1 * dt + dt * dt)
-                    / (12.0 * dtm1 * (dtm1 + dt))
-                )
-                * A0
-                + (dtm1 / (12.0 * (dtm1 + dt))) * Ap1
-            )
-            F3 *= dt
+    def set_corrector_depletion_results(self, results: List[DepletionResult]):
+        """
+        Saves the results of the requests made by
+        :py:meth:`corrector_depletion_requests`. The corrected material
+        composition replaces the one which was appended in the corrector step.
 
-            F4 = (
-                (-dt * dt / (12.0 * dtm1 * (dtm1 + dt))) * Am1
-                + (
-                    (dtm1 * dtm1 + 2.0 * dtm1 * dt + dt * dt)
-                    / (12.0 * dtm1 * (dtm1 + dt))
-                )
-                * A0
-                + ((5.0 * dtm1 + 4.0 * dt) / (12.0 * (dtm1 + dt))) * Ap1
-            )
-            F4 *= dt
+        Parameters
+        ----------
+        results : list of DepletionResult
+            Depletion result of the poison.
+        """
+        if len(results) != 1:
+            raise ValueError("Burnable poison rod requires one result.")
 
-            F3.exponential_product(N)
-            F4.exponential_product(N)
+        self._poison_materials[-1] = results[0].material
 
-        # Now we can build a new material composition
-        new_mat_comp = MaterialComposition()
-        for i, nuclide in enumerate(nuclides):
-            if N[i] > 0.0:
-                new_mat_comp.add_nuclide(nuclide, N[i])
+        # Save the current matrix as previous matrix for next step !
+        self._poison_prev_dep_mat = self._poison_current_dep_mat
+        self._poison_current_dep_mat = None
 
-        # Make the new material
-        new_mat = Material(new_mat_comp, mat_pred.temperature, ndl)
-        self._poison_materials[-1] = new_mat
+    def depletion_checkpoint_state(
+        self,
+    ) -> Tuple[
+        List[List[Material]],
+        List[Optional[DepletionMatrix]],
+        List[List[float]],
+        List[List[float]],
+    ]:
+        """
+        Returns the state of the rod needed to resume a depletion history
+        from a checkpoint, once a depletion step has been completed.
+
+        Returns
+        -------
+        list of list of Material
+            Compositions of the poison, for each depletion step.
+        list of DepletionMatrix
+            Depletion matrix of the previous step of the poison.
+        list of list of float
+            Fuel Dancoff corrections, which are empty.
+        list of list of float
+            Cladding Dancoff corrections, which are empty.
+        """
+        return ([list(self._poison_materials)], [self._poison_prev_dep_mat], [], [])
+
+    def restore_depletion_checkpoint_state(
+        self,
+        materials: List[List[Material]],
+        matrices: List[Optional[DepletionMatrix]],
+        fuel_dancoff_corrections: List[List[float]],
+        clad_dancoff_corrections: List[List[float]],
+    ) -> None:
+        """
+        Restores the state returned by :py:meth:`depletion_checkpoint_state`.
 
-        # Save the current matrix as previous matrix for next step !
-        self._poison_prev_dep_mat = A0
+        Parameters
+        ----------
+        materials : list of list of Material
+            Compositions of the poison, for each depletion step.
+        matrices : list of DepletionMatrix
+            Depletion matrix of the previous step of the poison.
+        fuel_dancoff_corrections : list of list of float
+            Fuel Dancoff corrections, which must be empty.
+        clad_dancoff_corrections : list of list of float
+            Cladding Dancoff corrections, which must be empty.
+        """
+        if (
+            len(materials) != 1
+            or len(matrices) != 1
+            or len(fuel_dancoff_corrections) != 0
+            or len(clad_dancoff_corrections) != 0
+        ):
+            raise ValueError("Checkpoint does not match burnable poison rod.")
+
+        self._poison_materials = list(materials[0])
+        self._poison_prev_dep_mat = matrices[0]
         self._poison_current_dep_mat = None
@@ -0,0 +1,193 @@
+from .pwr_assembly import PWRAssembly
+from .._scarabee import (
+    NDLibrary,
+    DiffusionData,
+    set_output_file,
+    scarabee_log,
+    LogLevel,
+)
+from typing import Callable, Dict, List, Optional
+import multiprocessing
+import os
+import time
+
+
+class AssemblyCase:
+    """
+    Defines one assembly calculation of a :py:func:`run_campaign`.
+
+    Parameters
+    ----------
+    name : str
+        Name of the case, used to name its output files. Must be unique within
+        a campaign.
+    build : callable
+        Function which takes the :py:class:`NDLibrary` of the process and
+        returns the :py:class:`PWRAssembly` to solve. It is sent to another
+        process, and must therefore be defined at the top level of a module.
+
+    Attributes
+    ----------
+    name : str
+        Name of the case.
+    build : callable
+        Function building the assembly from an :py:class:`NDLibrary`.
+    """
+
+    def __init__(self, name: str, build: Callable[[NDLibrary], PWRAssembly]):
+        if not callable(build):
+            raise TypeError("build must be callable.")
+        self._name = name
+        self._build = build
+
+    @property
+    def name(self) -> str:
+        return self._name
+
+    @property
+    def build(self) -> Callable[[NDLibrary], PWRAssembly]:
+        return self._build
+
+
+# Library of each worker process, mapped once and used by all of its cases
+_worker_ndl: Optional[NDLibrary] = None
+_worker_track_cache_dir: Optional[str] = None
+
+
+def _init_worker(binary_library: str, track_cache_dir: str) -> None:
+    global _worker_ndl, _worker_track_cache_dir
+    _worker_ndl = NDLibrary()
+    _worker_ndl.map_binary(binary_library)
+    _worker_track_cache_dir = track_cache_dir
+
+
+def _run_case(case: AssemblyCase, output_dir: str) -> List[str]:
+    base = os.path.join(output_dir, case.name)
+    set_output_file(base + "_out.txt")
+
+    asmbly = case.build(_worker_ndl)
+    if asmbly.track_cache_dir is None:
+        asmbly.track_cache_dir = _worker_track_cache_dir
+    asmbly.solve()
+
+    fnames = []
+    if isinstance(asmbly.diffusion_data, DiffusionData):
+        fnames.append(base + ".bin")
+        asmbly.diffusion_data.save(fnames[-1])
+    else:
+        for t, dd in enumerate(asmbly.diffusion_data):
+            fnames.append(base + "_{:}.bin".format(t))
+            dd.save(fnames[-1])
+    return fnames
+
+
+def _run_timed_case(args) -> tuple:
+    case, output_dir = args
+    start = time.perf_counter()
+    fnames = _run_case(case, output_dir)
+    return case.name, fnames, time.perf_counter() - start
+
+
+def run_campaign(
+    cases: List[AssemblyCase],
+    output_dir: str,
+    nprocs: Optional[int] = None,
+    threads_per_proc: Optional[int] = None,
+    binary_library: Optional[str] = None,
+) -> Dict[str, List[str]]:
+    """
+    Solves many assemblies at once, distributing them over local processes.
+    The nuclear data library is written once as a binary library, which every
+    process then memory maps, so that the pages of nuclear data are shared by
+    all processes of the node. The track laydowns are cached in a common
+    directory, so that each distinct geometry is only traced once. The
+    :py:class:`DiffusionData` of each case are saved in the output directory,
+    as "<name>.bin" for a single calculation, or "<name>_<t>.bin" for each
+    burn-up point of a depletion calculation, and the log of each case is
+    written to "<name>_out.txt".
+
+    Parameters
+    ----------
+    cases : list of AssemblyCase
+        All assembly calculations to run. Larger cases should come first, as
+        they are started in the given order.
+    output_dir : str
+        Directory in which the results are written. Created if needed.
+    nprocs : optional int
+        Number of processes. Defaults to the number of cases, limited by the
+        number of CPUs.
+    threads_per_proc : optional int
+        Number of OpenMP threads of each process. Defaults to the number of
+        CPUs divided by the number of processes.
+    binary_library : optional str
+        Binary library written by :py:meth:`NDLibrary.save_binary` for the
+        library given by the SCARABEE_ND_LIBRARY environment variable. If it
+        does not exist, it is written from that library. Defaults to
+        "nd_library.bin" in the output directory.
+
+    Returns
+    -------
+    dict of str to list of str
+        Names of the files written for each case.
+    """
+    names = [case.name for case in cases]
+    if len(set(names)) != len(names):
+        raise ValueError("Case names must be unique.")
+
+    ncpus = os.cpu_count() or 1
+    if nprocs is None:
+        nprocs = min(len(cases), ncpus)
+    if nprocs < 1:
+        raise ValueError("nprocs must be at least 1.")
+    if threads_per_proc is None:
+        threads_per_proc = max(1, ncpus // nprocs)
+    if threads_per_proc < 1:
+        raise ValueError("threads_per_proc must be at least 1.")
+
+    os.makedirs(output_dir, exist_ok=True)
+    if binary_library is None:
+        binary_library = os.path.join(output_dir, "nd_library.bin")
+    if not os.path.exists(binary_library):
+        scarabee_log(LogLevel.Info, "Writing binary library {:}".format(binary_library))
+        NDLibrary().save_binary(binary_library)
+    track_cache_dir = os.path.join(output_dir, "tracks")
+    os.makedirs(track_cache_dir, exist_ok=True)
+
+    scarabee_log(
+        LogLevel.Info,
+        "Running {:} cases with {:} processes of {:} threads".format(
+            len(cases), nprocs, threads_per_proc
+        ),
+    )
+
+    # OpenMP reads the number of threads when the module is loaded by each
+    # new process, which inherits the environment given at creation. Spawned
+    # processes are used, as forking a process which has already started
+    # OpenMP threads is unsafe.
+    results: Dict[str, List[str]] = {}
+    start = time.perf_counter()
+    old_threads = os.environ.get("OMP_NUM_THREADS")
+    os.environ["OMP_NUM_THREADS"] = str(threads_per_proc)
+    try:
+        ctx = multiprocessing.get_context("spawn")
+        with ctx.Pool(nprocs, _init_worker, (binary_library, track_cache_dir)) as pool:
+            tasks = [(case, output_dir) for case in cases]
+            for name, fnames, elapsed in pool.imap_unordered(_run_timed_case, tasks):
+                results[name] = fnames
+                scarabee_log(
+                    LogLevel.Info,
+                    "[{:}/{:}] {:} done in {:.1f} s ({:.1f} s elapsed)".format(
+                        len(results),
+                        len(cases),
+                        name,
+                        elapsed,
+                        time.perf_counter() - start,
+                    ),
+                )
+    finally:
+        if old_threads is None:
+            del os.environ["OMP_NUM_THREADS"]
+        else:
+            os.environ["OMP_NUM_THREADS"] = old_threads
+
+    return results
@@ -1,6 +1,5 @@
 from .._scarabee import (
     NDLibrary,
-    MaterialComposition,
     Material,
     CrossSection,
     PinCellType,
@@ -11,10 +10,20 @@ from .._scarabee import (
     DepletionChain,
     DepletionMatrix,
     mix_materials,
-    build_depletion_matrix,
+    DepletionRequest,
+    DepletionResult,
+    deplete_materials,
+    celi_predictor_substeps,
+    celi_corrector_substeps,
+    leqi_predictor_substeps,
+    leqi_corrector_substeps,
+    SelfShieldingMethod,
+    SelfShieldingRequest,
+    self_shield_materials,
 )
+from ._dancoff import FUEL_DANCOFF_GROUP, CLAD_DANCOFF_GROUP, _dancoff_xs
 import numpy as np
-from typing import Optional, List
+from typing import Optional, List, Tuple
 import copy
 
 
@@ -128,22 +137,14 @@ class FuelPin:
 
         # Initialize empty variables for Dancoff correction calculations.
         # These are all kept private.
-        self._fuel_dancoff_xs: CrossSection = CrossSection(
-            np.array([1.0e5]), np.array([1.0e5]), np.array([[0.0]]), "Fuel"
-        )
+        self._fuel_dancoff_xs: CrossSection = _dancoff_xs(1.0e5, 1.0e5, "Fuel")
         self._gap_dancoff_xs: Optional[CrossSection] = None
         if self.gap is not None:
-            self._gap_dancoff_xs = CrossSection(
-                np.array([self.gap.potential_xs]),
-                np.array([self.gap.potential_xs]),
-                np.array([[0.0]]),
-                "Gap",
+            self._gap_dancoff_xs = _dancoff_xs(
+                self.gap.potential_xs, self.gap.potential_xs, "Gap"
             )
-        self._clad_dancoff_xs: CrossSection = CrossSection(
-            np.array([self.clad.potential_xs]),
-            np.array([self.clad.potential_xs]),
-            np.array([[0.0]]),
-            "Clad",
+        self._clad_dancoff_xs: CrossSection = _dancoff_xs(
+            self.clad.potential_xs, 1.0e5, "Clad"
         )
 
         self._fuel_isolated_dancoff_fsr_ids = []
@@ -384,38 +385,46 @@ class FuelPin:
 
     # ==========================================================================
     # Dancoff Correction Related Methods
-    def set_xs_for_fuel_dancoff_calculation(self) -> None:
-        """
-        Sets the 1-group cross sections to calculate the fuel Dancoff correction.
-        """
-        self._fuel_dancoff_xs.set(
-            CrossSection(
-                np.array([1.0e5]), np.array([1.0e5]), np.array([[0.0]]), "Fuel"
-            )
+    def _average_fuel_potential_xs(self, ndl: NDLibrary) -> float:
+        # Create average fuel mixture
+        fuel_mats = []
+        fuel_vols = []
+        for ring in self.fuel_ring_materials:
+            fuel_mats.append(ring[-1])
+            fuel_vols.append(1.0 / self.num_fuel_rings)
+        avg_fuel: Material = mix_materials(
+            fuel_mats, fuel_vols, MixingFraction.Volume, ndl
         )
+        return avg_fuel.potential_xs
 
-        if self._gap_dancoff_xs is not None and self.gap is not None:
-            self._gap_dancoff_xs.set(
-                CrossSection(
-                    np.array([self.gap.potential_xs]),
-                    np.array([self.gap.potential_xs]),
-                    np.array([[0.0]]),
-                    "Gap",
-                )
-            )
+    def dancoff_potential_xs(self, ndl: NDLibrary) -> List[float]:
+        """
+        Potential cross sections of the materials of the pin which define the
+        Dancoff correction calculations, using the most recent fuel
+        compositions.
 
-        self._clad_dancoff_xs.set(
-            CrossSection(
-                np.array([self.clad.potential_xs]),
-                np.array([self.clad.potential_xs]),
-                np.array([[0.0]]),
-                "Clad",
-            )
-        )
+        Parameters
+        ----------
+        ndl : NDLibrary
+            Nuclear data library for obtaining potential scattering cross
+            sections.
 
-    def set_xs_for_clad_dancoff_calculation(self, ndl: NDLibrary) -> None:
+        Returns
+        -------
+        list of float
+            Potential cross sections of the average fuel, gap (if present),
+            and cladding.
+        """
+        pot_xs = [self._average_fuel_potential_xs(ndl)]
+        if self.gap is not None:
+            pot_xs.append(self.gap.potential_xs)
+        pot_xs.append(self.clad.potential_xs)
+        return pot_xs
+
+    def set_xs_for_dancoff_calculation(self, ndl: NDLibrary) -> None:
         """
-        Sets the 1-group cross sections to calculate the clad Dancoff correction.
+        Sets the 2-group cross sections to calculate the fuel and the clad
+        Dancoff corrections, which are solved together as one group each.
 
         Parameters
         ----------
@@ -423,43 +432,16 @@ class FuelPin:
             Nuclear data library for obtaining potential scattering cross
             sections.
         """
-        # Create average fuel mixture
-        fuel_mats = []
-        fuel_vols = []
-        for ring in self.fuel_ring_materials:
-            fuel_mats.append(ring[-1])
-            fuel_vols.append(1.0 / self.num_fuel_rings)
-        avg_fuel: Material = mix_materials(
-            fuel_mats, fuel_vols, MixingFraction.Volume, ndl
-        )
-
         self._fuel_dancoff_xs.set(
-            CrossSection(
-                np.array([avg_fuel.potential_xs]),
-                np.array([avg_fuel.potential_xs]),
-                np.array([[0.0]]),
-                "Fuel",
-            )
+            _dancoff_xs(1.0e5, self._average_fuel_potential_xs(ndl), "Fuel")
         )
 
         if self._gap_dancoff_xs is not None and self.gap is not None:
             self._gap_dancoff_xs.set(
-                CrossSection(
-                    np.array([self.gap.potential_xs]),
-                    np.array([self.gap.potential_xs]),
-                    np.array([[0.0]]),
-                    "Gap",
-                )
+                _dancoff_xs(self.gap.potential_xs, self.gap.potential_xs, "Gap")
             )
 
-        self._clad_dancoff_xs.set(
-            CrossSection(
-                np.array([1.0e5]),
-                np.array([1.0e5]),
-                np.array([[0.0]]),
-                "Clad",
-            )
-        )
+        self._clad_dancoff_xs.set(_dancoff_xs(self.clad.potential_xs, 1.0e5, "Clad"))
 
     def make_dancoff_moc_cell(
         self,
@@ -477,7 +459,8 @@ class FuelPin:
         Parameters
         ----------
         moderator_xs : CrossSection
-            One group cross sections for the moderator. Total should equal
+            Dancoff cross sections for the moderator, with one group for the
+            fuel and one for the clad calculation. Total should equal
             absorption (i.e. no scattering) and should be equal to the
             macroscopic potential cross section.
         dx : float
@@ -600,24 +583,28 @@ class FuelPin:
             scattering cross section.
         """
         # Fuel sources should all be zero !
-        for ind in self._fuel_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, 0.0)
+        isomoc.set_extern_src(
+            self._fuel_isolated_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, 0.0
+        )
 
         # Gap sources should all be potential_xs
         if self.gap is not None:
             pot_xs = self.gap.potential_xs
-            for ind in self._gap_isolated_dancoff_fsr_inds:
-                isomoc.set_extern_src(ind, 0, pot_xs)
+            isomoc.set_extern_src(
+                self._gap_isolated_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+            )
 
         # Clad sources should all be potential_xs
         pot_xs = self.clad.potential_xs
-        for ind in self._clad_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._clad_isolated_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._mod_isolated_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
     def set_isolated_dancoff_clad_sources(
         self, isomoc: MOCDriver, moderator: Material, ndl: NDLibrary
@@ -650,23 +637,27 @@ class FuelPin:
 
         # Fuel sources should all be potential_xs
         pot_xs = avg_fuel.potential_xs
-        for ind in self._fuel_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._fuel_isolated_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+        )
 
         # Gap sources should all be potential_xs
         if self.gap is not None:
             pot_xs = self.gap.potential_xs
-            for ind in self._gap_isolated_dancoff_fsr_inds:
-                isomoc.set_extern_src(ind, 0, pot_xs)
+            isomoc.set_extern_src(
+                self._gap_isolated_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+            )
 
         # Clad sources should all be zero !
-        for ind in self._clad_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, 0.0)
+        isomoc.set_extern_src(
+            self._clad_isolated_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, 0.0
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._mod_isolated_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+        )
 
     def set_full_dancoff_fuel_sources(
         self, fullmoc: MOCDriver, moderator: Material
@@ -685,24 +676,28 @@ class FuelPin:
             scattering cross section.
         """
         # Fuel sources should all be zero !
-        for ind in self._fuel_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, 0.0)
+        fullmoc.set_extern_src(
+            self._fuel_full_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, 0.0
+        )
 
         # Gap sources should all be potential_xs
         if self.gap is not None:
             pot_xs = self.gap.potential_xs
-            for ind in self._gap_full_dancoff_fsr_inds:
-                fullmoc.set_extern_src(ind, 0, pot_xs)
+            fullmoc.set_extern_src(
+                self._gap_full_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+            )
 
         # Clad sources should all be potential_xs
         pot_xs = self.clad.potential_xs
-        for ind in self._clad_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._clad_full_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._mod_full_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
     def set_full_dancoff_clad_sources(
         self, fullmoc: MOCDriver, moderator: Material, ndl: NDLibrary
@@ -735,23 +730,27 @@ class FuelPin:
 
         # Fuel sources should all be potential_xs
         pot_xs = avg_fuel.potential_xs
-        for ind in self._fuel_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._fuel_full_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+        )
 
         # Gap sources should all be potential_xs
         if self.gap is not None:
             pot_xs = self.gap.potential_xs
-            for ind in self._gap_full_dancoff_fsr_inds:
-                fullmoc.set_extern_src(ind, 0, pot_xs)
+            fullmoc.set_extern_src(
+                self._gap_full_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+            )
 
         # Clad sources should all be zero !
-        for ind in self._clad_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, 0.0)
+        fullmoc.set_extern_src(
+            self._clad_full_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, 0.0
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._mod_full_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+        )
 
     def compute_fuel_dancoff_correction(
         self, isomoc: MOCDriver, fullmoc: MOCDriver
@@ -773,9 +772,9 @@ class FuelPin:
         """
         iso_flux = isomoc.homogenize_flux_spectrum(
             self._fuel_isolated_dancoff_fsr_inds
-        )[0]
+        )[FUEL_DANCOFF_GROUP]
         full_flux = fullmoc.homogenize_flux_spectrum(self._fuel_full_dancoff_fsr_inds)[
-            0
+            FUEL_DANCOFF_GROUP
         ]
         return (iso_flux - full_flux) / iso_flux
 
@@ -799,9 +798,9 @@ class FuelPin:
         """
         iso_flux = isomoc.homogenize_flux_spectrum(
             self._clad_isolated_dancoff_fsr_inds
-        )[0]
+        )[CLAD_DANCOFF_GROUP]
         full_flux = fullmoc.homogenize_flux_spectrum(self._clad_full_dancoff_fsr_inds)[
-            0
+            CLAD_DANCOFF_GROUP
         ]
         return (iso_flux - full_flux) / iso_flux
 
@@ -837,87 +836,151 @@ class FuelPin:
             )
         self._clad_dancoff_corrections.append(C)
 
+    def pop_dancoff_corrections(self) -> None:
+        """
+        Removes the most recent fuel and cladding Dancoff corrections, such as
+        those appended for a branch calculation.
+        """
+        self._fuel_dancoff_corrections.pop()
+        self._clad_dancoff_corrections.pop()
+
     # ==========================================================================
     # Transport Calculation Related Methods
-    def set_fuel_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
+    def fuel_self_shielding_requests(self, t: int) -> List[SelfShieldingRequest]:
         """
-        Constructs the CrossSection object for all fuel rings of the pin at the
-        specified depletion step.
+        Describes the self-shielding of all fuel rings of the pin at the
+        specified depletion step, so that it may be performed along with that
+        of other pins by :py:func:`self_shield_materials`.
 
         Parameters
         ----------
         t : int
             Index for the depletion step.
-        ndl : NDLibrary
-            Nuclear data library to use for cross sections.
+
+        Returns
+        -------
+        list of SelfShieldingRequest
+            Self-shielding request for each fuel ring.
+        """
+        if self.num_fuel_rings == 1:
+            # Compute escape xs
+            Ee = 1.0 / (2.0 * self.fuel_radius)
+            return [
+                SelfShieldingRequest(
+                    self._fuel_ring_materials[0][t],
+                    SelfShieldingMethod.Carlvik,
+                    C=self._fuel_dancoff_corrections[t],
+                    Ee=Ee,
+                )
+            ]
+
+        # Do each ring
+        requests = []
+        for ri in range(self.num_fuel_rings):
+            Rin = 0.0
+            if ri > 0:
+                Rin = self._fuel_radii[ri - 1]
+            Rout = self._fuel_radii[ri]
+            requests.append(
+                SelfShieldingRequest(
+                    self._fuel_ring_materials[ri][t],
+                    SelfShieldingMethod.RingCarlvik,
+                    C=self._fuel_dancoff_corrections[t],
+                    Rfuel=self.fuel_radius,
+                    Rin=Rin,
+                    Rout=Rout,
+                )
+            )
+        return requests
+
+    def set_fuel_xs(self, xss: List[CrossSection]) -> None:
+        """
+        Applies the self-shielded cross sections of all fuel rings, as computed
+        from the requests of :py:meth:`fuel_self_shielding_requests`.
+
+        Parameters
+        ----------
+        xss : list of CrossSection
+            Cross section of each fuel ring.
         """
-        # Do the fuel cross sections
+        if len(xss) != self.num_fuel_rings:
+            raise RuntimeError(
+                "Number of fuel cross sections does not agree with the number of fuel rings."
+            )
+
         if len(self._fuel_ring_xs) == 0:
             # Create initial CrossSection objects
-            if self.num_fuel_rings == 1:
-                # Compute escape xs
-                Ee = 1.0 / (2.0 * self.fuel_radius)
-                self._fuel_ring_xs.append(
-                    self._fuel_ring_materials[0][t].carlvik_xs(
-                        self._fuel_dancoff_corrections[t], Ee, ndl
-                    )
-                )
+            for xs in xss:
+                self._fuel_ring_xs.append(xs)
                 if self._fuel_ring_xs[-1].name == "":
                     self._fuel_ring_xs[-1].name = "Fuel"
-            else:
-                # Do each ring
-                for ri in range(self.num_fuel_rings):
-                    Rin = 0.0
-                    if ri > 0:
-                        Rin = self._fuel_radii[ri - 1]
-                    Rout = self._fuel_radii[ri]
-                    self._fuel_ring_xs.append(
-                        self._fuel_ring_materials[ri][t].ring_carlvik_xs(
-                            self._fuel_dancoff_corrections[t],
-                            self.fuel_radius,
-                            Rin,
-                            Rout,
-                            ndl,
-                        )
-                    )
-                    if self._fuel_ring_xs[-1].name == "":
-                        self._fuel_ring_xs[-1].name = "Fuel"
 
         elif len(self._fuel_ring_xs) == self.num_fuel_rings:
             # Reset XS values. Cannot reassign or pointers will be broken !
-            if self.num_fuel_rings == 1:
-                # Compute escape xs
-                Ee = 1.0 / (2.0 * self.fuel_radius)
-                self._fuel_ring_xs[0].set(
-                    self._fuel_ring_materials[0][t].carlvik_xs(
-                        self._fuel_dancoff_corrections[t], Ee, ndl
-                    )
-                )
-                if self._fuel_ring_xs[0].name == "":
-                    self._fuel_ring_xs[0].name = "Fuel"
-            else:
-                # Do each ring
-                for ri in range(self.num_fuel_rings):
-                    Rin = 0.0
-                    if ri > 0:
-                        Rin = self._fuel_radii[ri - 1]
-                    Rout = self._fuel_radii[ri]
-                    self._fuel_ring_xs[ri].set(
-                        self._fuel_ring_materials[ri][t].ring_carlvik_xs(
-                            self._fuel_dancoff_corrections[t],
-                            self.fuel_radius,
-                            Rin,
-                            Rout,
-                            ndl,
-                        )
-                    )
-                    if self._fuel_ring_xs[ri].name == "":
-                        self._fuel_ring_xs[ri].name = "Fuel"
+            for ri, xs in enumerate(xss):
+                self._fuel_ring_xs[ri].set(xs)
+                if self._fuel_ring_xs[ri].name == "":
+                    self._fuel_ring_xs[ri].name = "Fuel"
         else:
             raise RuntimeError(
                 "Number of fuel cross sections does not agree with the number of fuel rings."
             )
 
+    def set_fuel_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
+        """
+        Constructs the CrossSection object for all fuel rings of the pin at the
+        specified depletion step.
+
+        Parameters
+        ----------
+        t : int
+            Index for the depletion step.
+        ndl : NDLibrary
+            Nuclear data library to use for cross sections.
+        """
+        self.set_fuel_xs(
+            self_shield_materials(self.fuel_self_shielding_requests(t), ndl)
+        )
+
+    def gap_xs_request(self) -> Optional[SelfShieldingRequest]:
+        """
+        Describes the infinitely dilute cross section of the gap, so that it
+        may be computed along with the cross sections of other pins by
+        :py:func:`self_shield_materials`.
+
+        Returns
+        -------
+        SelfShieldingRequest or None
+            Request for the gap, or None if the pin has no gap.
+        """
+        if self.gap is None:
+            return None
+
+        return SelfShieldingRequest(
+            self.gap,
+            SelfShieldingMethod.Dilution,
+            dils=[1.0e10] * self.gap.size,
+            max_l=1,
+        )
+
+    def apply_gap_xs(self, xs: CrossSection) -> None:
+        """
+        Applies the cross section of the gap, as computed from the request of
+        :py:meth:`gap_xs_request`.
+
+        Parameters
+        ----------
+        xs : CrossSection
+            Cross section of the gap.
+        """
+        if self._gap_xs is None:
+            self._gap_xs = xs
+        else:
+            self._gap_xs.set(xs)
+
+        if self._gap_xs.name == "":
+            self._gap_xs.name = "Gap"
+
     def set_gap_xs(self, ndl: NDLibrary) -> None:
         """
         Constructs the CrossSection object for the gap between the fuel pellet
@@ -929,26 +992,23 @@ class FuelPin:
             Nuclear data library to use for cross sections.
         """
         if self.gap is not None:
-            if self._gap_xs is None:
-                self._gap_xs = self.gap.dilution_xs([1.0e10] * self.gap.size, ndl)
-            else:
-                self._gap_xs.set(self.gap.dilution_xs([1.0e10] * self.gap.size, ndl))
+            self.apply_gap_xs(self.gap.dilution_xs([1.0e10] * self.gap.size, ndl))
 
-            if self._gap_xs.name == "":
-                self._gap_xs.name = "Gap"
-
-    def set_clad_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
+    def clad_self_shielding_request(self, t: int) -> SelfShieldingRequest:
         """
-        Constructs the CrossSection object for the cladding of the pin at the
-        specified depletion step. The depletion step only changes the Dancoff
-        correction, not the cladding composition.
+        Describes the self-shielding of the cladding of the pin at the
+        specified depletion step, so that it may be performed along with that
+        of other pins by :py:func:`self_shield_materials`.
 
         Parameters
         ----------
         t : int
             Index for the depletion step.
-        ndl : NDLibrary
-            Nuclear data library to use for cross sections.
+
+        Returns
+        -------
+        SelfShieldingRequest
+            Self-shielding request for the cladding.
         """
         # Compute escape xs
         Ee = 0.0
@@ -957,19 +1017,48 @@ class FuelPin:
         else:
             Ee = 1.0 / (2.0 * (self.clad_radius - self.fuel_radius))
 
-        # Get / set the xs
+        return SelfShieldingRequest(
+            self.clad,
+            SelfShieldingMethod.Roman,
+            C=self._clad_dancoff_corrections[t],
+            Ee=Ee,
+        )
+
+    def set_clad_xs(self, xs: CrossSection) -> None:
+        """
+        Applies the self-shielded cross section of the cladding, as computed
+        from the request of :py:meth:`clad_self_shielding_request`.
+
+        Parameters
+        ----------
+        xs : CrossSection
+            Cross section of the cladding.
+        """
         if self._clad_xs is None:
-            self._clad_xs = self.clad.roman_xs(
-                self._clad_dancoff_corrections[t], Ee, ndl
-            )
+            self._clad_xs = xs
         else:
-            self._clad_xs.set(
-                self.clad.roman_xs(self._clad_dancoff_corrections[t], Ee, ndl)
-            )
+            self._clad_xs.set(xs)
 
         if self._clad_xs.name == "":
             self._clad_xs.name = "Clad"
 
+    def set_clad_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
+        """
+        Constructs the CrossSection object for the cladding of the pin at the
+        specified depletion step. The depletion step only changes the Dancoff
+        correction, not the cladding composition.
+
+        Parameters
+        ----------
+        t : int
+            Index for the depletion step.
+        ndl : NDLibrary
+            Nuclear data library to use for cross sections.
+        """
+        self.set_clad_xs(
+            self_shield_materials([self.clad_self_shielding_request(t)], ndl)[0]
+        )
+
     def make_moc_cell(
         self,
         moderator_xs: CrossSection,
@@ -1094,22 +1183,23 @@ class FuelPin:
         moc : MOCDriver
             MOC simulation for the full calculations.
         """
-        self._fuel_ring_fsr_inds: List[List[int]] = []
-        for r in range(self.num_fuel_rings):
-            self._fuel_ring_fsr_inds.append([])
-        self._gap_fsr_inds: List[int] = []
-        self._clad_fsr_inds: List[int] = []
-        self._mod_fsr_inds: List[int] = []
+        self._set_fsr_indexes(moc.get_fsr_indxs(self._fsr_id_sets(), 0))
+
+    def _fsr_id_sets(self) -> List[List[int]]:
+        # Sets of FSR IDs of the full MOC calculation, in the order expected
+        # by _set_fsr_indexes
+        return self._fuel_ring_fsr_ids + [
+            self._gap_fsr_ids,
+            self._clad_fsr_ids,
+            self._mod_fsr_ids,
+        ]
 
-        for r in range(self.num_fuel_rings):
-            for id in self._fuel_ring_fsr_ids[r]:
-                self._fuel_ring_fsr_inds[r].append(moc.get_fsr_indx(id, 0))
-        for id in self._gap_fsr_ids:
-            self._gap_fsr_inds.append(moc.get_fsr_indx(id, 0))
-        for id in self._clad_fsr_ids:
-            self._clad_fsr_inds.append(moc.get_fsr_indx(id, 0))
-        for id in self._mod_fsr_ids:
-            self._mod_fsr_inds.append(moc.get_fsr_indx(id, 0))
+    def _set_fsr_indexes(self, inds: List[List[int]]) -> None:
+        nr = self.num_fuel_rings
+        self._fuel_ring_fsr_inds: List[List[int]] = inds[:nr]
+        self._gap_fsr_inds: List[int] = inds[nr]
+        self._clad_fsr_inds: List[int] = inds[nr + 1]
+        self._mod_fsr_inds: List[int] = inds[nr + 2]
 
     def obtain_flux_spectra(self, moc: MOCDriver) -> None:
         """
@@ -1121,10 +1211,18 @@ class FuelPin:
         moc : MOCDriver
             MOC simulation for the full calculations.
         """
+        self._set_flux_spectra(
+            moc.homogenize_flux_spectra(self._flux_spectra_fsr_sets())
+        )
+
+    def _flux_spectra_fsr_sets(self) -> List[List[int]]:
+        # Sets of FSR indexes of the depleted regions, in the order expected
+        # by _set_flux_spectra
+        return self._fuel_ring_fsr_inds
+
+    def _set_flux_spectra(self, spectra: np.ndarray) -> None:
         for r in range(self.num_fuel_rings):
-            self._fuel_ring_flux_spectra[r] = moc.homogenize_flux_spectrum(
-                self._fuel_ring_fsr_inds[r]
-            )
+            self._fuel_ring_flux_spectra[r] = spectra[r, :]
 
     def compute_pin_linear_power(self, ndl: NDLibrary):
         """
@@ -1168,6 +1266,30 @@ class FuelPin:
         for r in range(self.num_fuel_rings):
             self._fuel_ring_flux_spectra[r] *= f
 
+    def flux_spectra_state(self) -> List[np.ndarray]:
+        """
+        Copies the flux spectra of the fuel rings, so that they may be restored
+        after the calculation of a perturbed state.
+
+        Returns
+        -------
+        list of ndarray
+            Flux spectrum of each fuel ring.
+        """
+        return [np.array(spectrum) for spectrum in self._fuel_ring_flux_spectra]
+
+    def restore_flux_spectra_state(self, state: List[np.ndarray]) -> None:
+        """
+        Restores the flux spectra of the fuel rings.
+
+        Parameters
+        ----------
+        state : list of ndarray
+            Flux spectra from :py:meth:`flux_spectra_state`.
+        """
+        for r in range(self.num_fuel_rings):
+            self._fuel_ring_flux_spectra[r] = state[r]
+
     def predict_depletion(
         self,
         chain: DepletionChain,
@@ -1194,68 +1316,78 @@ class FuelPin:
         dtm1 : float, optional
             Durration of the previous time step in seconds. Default is None.
         """
+        requests = self.predictor_depletion_requests(dt, dtm1)
+        self.set_predictor_depletion_results(
+            deplete_materials(chain, requests, ndl)
+        )
+
+    def predictor_depletion_requests(
+        self, dt: float, dtm1: Optional[float] = None
+    ) -> List[DepletionRequest]:
+        """
+        Makes the depletion requests of the predictor for each fuel ring, so
+        that the rings of many pins may be depleted at once with
+        :py:func:`deplete_materials`. The results must then be given to
+        :py:meth:`set_predictor_depletion_results`.
+
+        Parameters
+        ----------
+        dt : float
+            Durration of the time step in seconds.
+        dtm1 : float, optional
+            Durration of the previous time step in seconds. Default is None.
+
+        Returns
+        -------
+        list of DepletionRequest
+            Depletion request of each fuel ring.
+        """
         if dt <= 0:
             raise ValueError("Predictor time step must be > 0.")
 
-        # Do the prediction step for each fuel ring
+        requests = []
         for r in range(self.num_fuel_rings):
             # Get the flux and initial material
             flux = self._fuel_ring_flux_spectra[r]
             mat = self._fuel_ring_materials[r][-1]  # Use last available mat !
 
-            # Build depletion matrix for beginning of time step
-            A0 = build_depletion_matrix(chain, mat, flux, ndl)
-
-            # Save current matrix
-            self._fuel_ring_current_dep_mats[r] = A0
-
-            # At this point, we can clear the xs data from the last material as
-            # depletion matrix is now built.
-            mat.clear_all_micro_xs_data()
-
-            # Initialize an array with the initial target number densities
-            N = np.zeros(A0.size)
-            nuclides = A0.nuclides
-            for i, nuclide in enumerate(nuclides):
-                N[i] = mat.atom_density(nuclide)
-
+            # The matrix for the beginning of the time step is built from the
+            # last material, after which its xs data can be cleared.
             if self._fuel_ring_prev_dep_mats[r] is None or dtm1 is None:
                 # Use CE/LI
-                A0 *= dt
-
-                # Do the matrix exponential
-                A0.exponential_product(N)
-
-                # Undo multiplication by time step on the matrix
-                A0 /= dt
-
+                matrices = []
+                substeps = celi_predictor_substeps(dt)
             else:
                 # Use LE/QI
-                Am1 = self._fuel_ring_prev_dep_mats[r]
+                matrices = [self._fuel_ring_prev_dep_mats[r]]
+                substeps = leqi_predictor_substeps(dt, dtm1)
 
-                F1 = (-dt / (12.0 * dtm1)) * Am1 + (
-                    (6.0 * dtm1 + dt) / (12.0 * dtm1)
-                ) * A0
-                F1 *= dt
+            requests.append(
+                DepletionRequest(
+                    mat, mat, flux, matrices, substeps, clear_micro_xs=True
+                )
+            )
 
-                F2 = (-5.0 * dt / (12.0 * dtm1)) * Am1 + (
-                    (6.0 * dtm1 + 5.0 * dt) / (12.0 * dtm1)
-                ) * A0
-                F2 *= dt
+        return requests
 
-                # Do the matrix exponentials
-                F1.exponential_product(N)
-                F2.exponential_product(N)
+    def set_predictor_depletion_results(self, results: List[DepletionResult]):
+        """
+        Saves the results of the requests made by
+        :py:meth:`predictor_depletion_requests`. The predicted material
+        compositions are appended to the materials lists.
 
-            # Now we can build a new material composition
-            new_mat_comp = MaterialComposition()
-            for i, nuclide in enumerate(nuclides):
-                if N[i] > 0.0:
-                    new_mat_comp.add_nuclide(nuclide, N[i])
+        Parameters
+        ----------
+        results : list of DepletionResult
+            Depletion result of each fuel ring.
+        """
+        if len(results) != self.num_fuel_rings:
+            raise ValueError("Number of results does not match fuel rings.")
 
-            # Make the new material
-            new_mat = Material(new_mat_comp, mat.temperature, ndl)
-            self._fuel_ring_materials[r].append(new_mat)
+        for r, res in enumerate(results):
+            # Save current matrix
+            self._fuel_ring_current_dep_mats[r] = res.matrix
+            self._fuel_ring_materials[r].append(res.material)
 
     def correct_depletion(
         self,
@@ -1282,77 +1414,142 @@ class FuelPin:
         dtm1 : float, optional
             Durration of the previous time step in seconds. Default is None.
         """
+        requests = self.corrector_depletion_requests(dt, dtm1)
+        self.set_corrector_depletion_results(
+            deplete_materials(chain, requests, ndl)
+        )
+
+    def corrector_depletion_requests(
+        self, dt: float, dtm1: Optional[float] = None
+    ) -> List[DepletionRequest]:
+        """
+        Makes the depletion requests of the corrector for each fuel ring, so
+        that the rings of many pins may be depleted at once with
+        :py:func:`deplete_materials`. The results must then be given to
+        :py:meth:`set_corrector_depletion_results`.
+
+        Parameters
+        ----------
+        dt : float
+            Durration of the time step in seconds.
+        dtm1 : float, optional
+            Durration of the previous time step in seconds. Default is None.
+
+        Returns
+        -------
+        list of DepletionRequest
+            Depletion request of each fuel ring.
+        """
         if dt <= 0:
             raise ValueError("Corrector time step must be > 0.")
 
-        # Do the prediction step for each fuel ring
+        requests = []
         for r in range(self.num_fuel_rings):
-            # Get the flux and initial material
+            # Get the flux and predicted material
             flux = self._fuel_ring_flux_spectra[r]
             mat_pred = self._fuel_ring_materials[r][-1]  # Use last available mat !
+            mat_old = self._fuel_ring_materials[r][-2]  # Go 2 steps back !!
 
             # Get depletion matrix for beginning of time step
             A0 = self._fuel_ring_current_dep_mats[r]
 
-            # Build depletion matrix and multiply by time step
-            Ap1 = build_depletion_matrix(chain, mat_pred, flux, ndl)
-
-            # Initialize an array with the initial target number densities
-            mat_old = self._fuel_ring_materials[r][-2]  # Go 2 steps back !!
-            N = np.zeros(Ap1.size)
-            nuclides = Ap1.nuclides
-            for i, nuclide in enumerate(nuclides):
-                N[i] = mat_old.atom_density(nuclide)
-
             if self._fuel_ring_prev_dep_mats[r] is None or dtm1 is None:
                 # Use CE/LI
-                F1 = (5.0 * dt / 12.0) * A0 + (dt / 12.0) * Ap1
-                F2 = (dt / 12.0) * A0 + (5.0 * dt / 12.0) * Ap1
-
-                F1.exponential_product(N)
-                F2.exponential_product(N)
-
+                matrices = [A0]
+                substeps = celi_corrector_substeps(dt)
             else:
                 # Use LE/QI
+                matrices = [self._fuel_ring_prev_dep_mats[r], A0]
+                substeps = leqi_corrector_substeps(dt, dtm1)
 
-                # Get previous depletion matrix
-                Am1 = self._fuel_ring_prev_dep_mats[r]
-
-                F3 = (
-                    (-dt * dt / (12.0 * dtm1 * (dtm1 + dt))) * Am1
-                    + (
-                        (5.0 * dtm1 * dtm1 + 6.0 * dtm1 * dt + dt * dt)
-                        / (12.0 * dtm1 * (dtm1 + dt))
-                    )
-                    * A0
-                    + (dtm1 / (12.0 * (dtm1 + dt))) * Ap1
-                )
-                F3 *= dt
-
-                F4 = (
-                    (-dt * dt / (12.0 * dtm1 * (dtm1 + dt))) * Am1
-                    + (
-                        (dtm1 * dtm1 + 2.0 * dtm1 * dt + dt * dt)
-                        / (12.0 * dtm1 * (dtm1 + dt))
-                    )
-                    * A0
-                    + ((5.0 * dtm1 + 4.0 * dt) / (12.0 * (dtm1 + dt))) * Ap1
-                )
-                F4 *= dt
+            requests.append(
+                DepletionRequest(mat_pred, mat_old, flux, matrices, substeps)
+            )
+
+        return requests
 
-                F3.exponential_product(N)
-                F4.exponential_product(N)
+    def set_corrector_depletion_results(self, results: List[DepletionResult]):
+        """
+        Saves the results of the requests made by
+        :py:meth:`corrector_depletion_requests`. The corrected material
+        compositions replace the ones where were appended in the corrector step.
 
-            # Now we can build a new material composition
-            new_mat_comp = MaterialComposition()
-            for i, nuclide in enumerate(nuclides):
-                if N[i] > 0.0:
-                    new_mat_comp.add_nuclide(nuclide, N[i])
+        Parameters
+        ----------
+        results : list of DepletionResult
+            Depletion result of each fuel ring.
+        """
+        if len(results) != self.num_fuel_rings:
+            raise ValueError("Number of results does not match fuel rings.")
 
-            # Make the new material
-            new_mat = Material(new_mat_comp, mat_pred.temperature, ndl)
-            self._fuel_ring_materials[r][-1] = new_mat
+        for r, res in enumerate(results):
+            self._fuel_ring_materials[r][-1] = res.material
 
             # Save the current matrix as previous matrix for next step !
-            self._fuel_ring_prev_dep_mats[r] = A0
+            self._fuel_ring_prev_dep_mats[r] = self._fuel_ring_current_dep_mats[r]
             self._fuel_ring_current_dep_mats[r] = None
+
+    def depletion_checkpoint_state(
+        self,
+    ) -> Tuple[
+        List[List[Material]],
+        List[Optional[DepletionMatrix]],
+        List[List[float]],
+        List[List[float]],
+    ]:
+        """
+        Returns the state of the pin needed to resume a depletion history
+        from a checkpoint, once a depletion step has been completed.
+
+        Returns
+        -------
+        list of list of Material
+            Compositions of each fuel ring, for each depletion step.
+        list of DepletionMatrix
+            Depletion matrix of the previous step of each fuel ring.
+        list of list of float
+            Fuel Dancoff corrections.
+        list of list of float
+            Cladding Dancoff corrections.
+        """
+        return (
+            [list(mats) for mats in self._fuel_ring_materials],
+            list(self._fuel_ring_prev_dep_mats),
+            [list(self._fuel_dancoff_corrections)],
+            [list(self._clad_dancoff_corrections)],
+        )
+
+    def restore_depletion_checkpoint_state(
+        self,
+        materials: List[List[Material]],
+        matrices: List[Optional[DepletionMatrix]],
+        fuel_dancoff_corrections: List[List[float]],
+        clad_dancoff_corrections: List[List[float]],
+    ) -> None:
+        """
+        Restores the state returned by :py:meth:`depletion_checkpoint_state`.
+
+        Parameters
+        ----------
+        materials : list of list of Material
+            Compositions of each fuel ring, for each depletion step.
+        matrices : list of DepletionMatrix
+            Depletion matrix of the previous step of each fuel ring.
+        fuel_dancoff_corrections : list of list of float
+            Fuel Dancoff corrections.
+        clad_dancoff_corrections : list of list of float
+            Cladding Dancoff corrections.
+        """
+        if len(materials) != self.num_fuel_rings or len(matrices) != len(
+            materials
+        ):
+            raise ValueError("Checkpoint does not match fuel rings.")
+
+        if len(fuel_dancoff_corrections) != 1 or len(clad_dancoff_corrections) != 1:
+            raise ValueError("Checkpoint does not match fuel pin.")
+
+        self._fuel_ring_materials = [list(mats) for mats in materials]
+        self._fuel_ring_prev_dep_mats = list(matrices)
+        self._fuel_ring_current_dep_mats = [None] * self.num_fuel_rings
+        self._fuel_dancoff_corrections = list(fuel_dancoff_corrections[0])
+        self._clad_dancoff_corrections = list(clad_dancoff_corrections[0])
@@ -7,10 +7,17 @@ from .._scarabee import (
     PinCell,
     MOCDriver,
     DepletionChain,
+    SelfShieldingMethod,
+    SelfShieldingRequest,
+    self_shield_materials,
+    DepletionMatrix,
+    DepletionRequest,
+    DepletionResult,
 )
 from .burnable_poison_rod import BurnablePoisonRod
+from ._dancoff import CLAD_DANCOFF_GROUP, FUEL_DANCOFF_GROUP, _dancoff_xs
 import numpy as np
-from typing import Optional, List
+from typing import Optional, List, Tuple
 import copy
 
 
@@ -84,11 +91,8 @@ class GuideTube:
 
         # Initialize empty variables for Dancoff correction calculations.
         # These are all kept private.
-        self._clad_dancoff_xs: CrossSection = CrossSection(
-            np.array([self.clad.potential_xs]),
-            np.array([self.clad.potential_xs]),
-            np.array([[0.0]]),
-            "Clad",
+        self._clad_dancoff_xs: CrossSection = _dancoff_xs(
+            self.clad.potential_xs, 1.0e5, "Clad"
         )
 
         self._clad_isolated_dancoff_fsr_ids = []
@@ -188,27 +192,33 @@ class GuideTube:
 
     # ==========================================================================
     # Dancoff Correction Related Methods
-    def set_xs_for_fuel_dancoff_calculation(self) -> None:
+    def dancoff_potential_xs(self, ndl: NDLibrary) -> List[float]:
         """
-        Sets the 1-group cross sections to calculate the fuel Dancoff
-        corrections.
-        """
-        self._clad_dancoff_xs.set(
-            CrossSection(
-                np.array([self.clad.potential_xs]),
-                np.array([self.clad.potential_xs]),
-                np.array([[0.0]]),
-                "Clad",
-            )
-        )
+        Potential cross sections of the materials of the guide tube and its
+        fill which define the Dancoff correction calculations, using the most
+        recent poison composition.
 
+        Parameters
+        ----------
+        ndl : NDLibrary
+            Nuclear data library for obtaining potential scattering cross
+            sections.
+
+        Returns
+        -------
+        list of float
+            Potential cross sections of the cladding, followed by those of
+            the fill.
+        """
+        pot_xs = [self.clad.potential_xs]
         if isinstance(self.fill, BurnablePoisonRod):
-            self.fill.set_xs_for_dancoff_calculation()
+            pot_xs += self.fill.dancoff_potential_xs()
+        return pot_xs
 
-    def set_xs_for_clad_dancoff_calculation(self, ndl: NDLibrary) -> None:
+    def set_xs_for_dancoff_calculation(self, ndl: NDLibrary) -> None:
         """
-        Sets the 1-group cross sections to calculate the clad Dancoff
-        corrections.
+        Sets the 2-group cross sections to calculate the fuel and the clad
+        Dancoff corrections, which are solved together as one group each.
 
         Parameters
         ----------
@@ -216,14 +226,7 @@ class GuideTube:
             Nuclear data library for obtaining potential scattering cross
             sections.
         """
-        self._clad_dancoff_xs.set(
-            CrossSection(
-                np.array([1.0e5]),
-                np.array([1.0e5]),
-                np.array([[0.0]]),
-                "Clad",
-            )
-        )
+        self._clad_dancoff_xs.set(_dancoff_xs(self.clad.potential_xs, 1.0e5, "Clad"))
 
         if isinstance(self.fill, BurnablePoisonRod):
             self.fill.set_xs_for_dancoff_calculation()
@@ -244,7 +247,8 @@ class GuideTube:
         Parameters
         ----------
         moderator_xs : CrossSection
-            One group cross sections for the moderator. Total should equal
+            Dancoff cross sections for the moderator, with one group for the
+            fuel and one for the clad calculation. Total should equal
             absorption (i.e. no scattering) and should be equal to the
             macroscopic potential cross section.
         dx : float
@@ -387,13 +391,15 @@ class GuideTube:
         """
         # Clad sources should all be potential_xs
         pot_xs = self.clad.potential_xs
-        for ind in self._clad_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._clad_isolated_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._mod_isolated_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
         if isinstance(self.fill, BurnablePoisonRod):
             self.fill.set_isolated_dancoff_fuel_sources(isomoc, moderator)
@@ -418,13 +424,15 @@ class GuideTube:
             sections.
         """
         # Clad sources should all be zero !
-        for ind in self._clad_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, 0.0)
+        isomoc.set_extern_src(
+            self._clad_isolated_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, 0.0
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_isolated_dancoff_fsr_inds:
-            isomoc.set_extern_src(ind, 0, pot_xs)
+        isomoc.set_extern_src(
+            self._mod_isolated_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+        )
 
         if isinstance(self.fill, BurnablePoisonRod):
             self.fill.set_isolated_dancoff_clad_sources(isomoc, moderator, ndl)
@@ -447,13 +455,15 @@ class GuideTube:
         """
         # Clad sources should all be potential_xs
         pot_xs = self.clad.potential_xs
-        for ind in self._clad_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._clad_full_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._mod_full_dancoff_fsr_inds, FUEL_DANCOFF_GROUP, pot_xs
+        )
 
         if isinstance(self.fill, BurnablePoisonRod):
             self.fill.set_full_dancoff_fuel_sources(fullmoc, moderator)
@@ -478,13 +488,15 @@ class GuideTube:
             sections.
         """
         # Clad sources should all be zero !
-        for ind in self._clad_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, 0.0)
+        fullmoc.set_extern_src(
+            self._clad_full_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, 0.0
+        )
 
         # Moderator sources should all be potential_xs
         pot_xs = moderator.potential_xs
-        for ind in self._mod_full_dancoff_fsr_inds:
-            fullmoc.set_extern_src(ind, 0, pot_xs)
+        fullmoc.set_extern_src(
+            self._mod_full_dancoff_fsr_inds, CLAD_DANCOFF_GROUP, pot_xs
+        )
 
         if isinstance(self.fill, BurnablePoisonRod):
             self.fill.set_full_dancoff_clad_sources(fullmoc, moderator, ndl)
@@ -509,9 +521,9 @@ class GuideTube:
         """
         iso_flux = isomoc.homogenize_flux_spectrum(
             self._clad_isolated_dancoff_fsr_inds
-        )[0]
+        )[CLAD_DANCOFF_GROUP]
         full_flux = fullmoc.homogenize_flux_spectrum(self._clad_full_dancoff_fsr_inds)[
-            0
+            CLAD_DANCOFF_GROUP
         ]
         C = (iso_flux - full_flux) / iso_flux
         D = 1.0 - C
@@ -533,37 +545,110 @@ class GuideTube:
             )
         self._clad_dancoff_corrections.append(C)
 
+    def pop_dancoff_corrections(self) -> None:
+        """
+        Removes the most recent cladding Dancoff correction, such as the one
+        appended for a branch calculation.
+        """
+        self._clad_dancoff_corrections.pop()
+
     # ==========================================================================
     # Transport Calculation Related Methods
-    def set_clad_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
+    def clad_self_shielding_request(self, t: int) -> SelfShieldingRequest:
         """
-        Constructs the CrossSection object for the cladding of the guide tube
-        at the specified depletion step. The depletion step only changes the
-        Dancoff correction, not the cladding composition.
+        Describes the self-shielding of the cladding of the guide tube at the
+        specified depletion step, so that it may be performed along with that
+        of other cells by :py:func:`self_shield_materials`.
 
         Parameters
         ----------
         t : int
             Index for the depletion step.
-        ndl : NDLibrary
-            Nuclear data library to use for cross sections.
+
+        Returns
+        -------
+        SelfShieldingRequest
+            Self-shielding request for the cladding.
         """
         # Compute escape xs
         Ee = 1.0 / (2.0 * (self.outer_radius - self.inner_radius))
 
-        # Get / set the xs
+        return SelfShieldingRequest(
+            self.clad,
+            SelfShieldingMethod.Roman,
+            C=self._clad_dancoff_corrections[t],
+            Ee=Ee,
+        )
+
+    def set_clad_xs(self, xs: CrossSection) -> None:
+        """
+        Applies the self-shielded cross section of the cladding, as computed
+        from the request of :py:meth:`clad_self_shielding_request`.
+
+        Parameters
+        ----------
+        xs : CrossSection
+            Cross section of the cladding.
+        """
         if self._clad_xs is None:
-            self._clad_xs = self.clad.roman_xs(
-                self._clad_dancoff_corrections[t], Ee, ndl
-            )
+            self._clad_xs = xs
         else:
-            self._clad_xs.set(
-                self.clad.roman_xs(self._clad_dancoff_corrections[t], Ee, ndl)
-            )
+            self._clad_xs.set(xs)
 
         if self._clad_xs.name == "":
             self._clad_xs.name = "Clad"
 
+    def set_clad_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
+        """
+        Constructs the CrossSection object for the cladding of the guide tube
+        at the specified depletion step. The depletion step only changes the
+        Dancoff correction, not the cladding composition.
+
+        Parameters
+        ----------
+        t : int
+            Index for the depletion step.
+        ndl : NDLibrary
+            Nuclear data library to use for cross sections.
+        """
+        self.set_clad_xs(
+            self_shield_materials([self.clad_self_shielding_request(t)], ndl)[0]
+        )
+
+    def fill_xs_requests(self, t: int) -> List[SelfShieldingRequest]:
+        """
+        Describes the cross sections of the fill of the guide tube at the
+        specified depletion step, so that they may be computed along with
+        those of other cells by :py:func:`self_shield_materials`.
+
+        Parameters
+        ----------
+        t : int
+            Index for the depletion step.
+
+        Returns
+        -------
+        list of SelfShieldingRequest
+            Requests for the fill, which are empty if the guide tube is not
+            filled with a burnable poison rod.
+        """
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            return self.fill.xs_requests(t)
+        return []
+
+    def apply_fill_xs(self, xss: List[CrossSection]) -> None:
+        """
+        Applies the cross sections of the fill, as computed from the requests
+        of :py:meth:`fill_xs_requests`.
+
+        Parameters
+        ----------
+        xss : list of CrossSection
+            Cross sections of the fill.
+        """
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            self.fill.apply_xs(xss)
+
     def set_fill_xs_for_depletion_step(self, t: int, ndl: NDLibrary) -> None:
         """
         Constructs the CrossSection objects for the fill of the guide tube
@@ -740,16 +825,22 @@ class GuideTube:
         moc : MOCDriver
             MOC simulation for the full calculations.
         """
-        self._clad_fsr_inds: List[int] = []
-        self._mod_fsr_inds: List[int] = []
+        self._set_fsr_indexes(moc.get_fsr_indxs(self._fsr_id_sets(), 0))
+
+    def _fsr_id_sets(self) -> List[List[int]]:
+        # Sets of FSR IDs of the full MOC calculation, in the order expected
+        # by _set_fsr_indexes, followed by those of a burnable poison rod
+        sets = [self._clad_fsr_ids, self._mod_fsr_ids]
+        if isinstance(self.fill, BurnablePoisonRod):
+            sets += self.fill._fsr_id_sets()
+        return sets
 
-        for id in self._clad_fsr_ids:
-            self._clad_fsr_inds.append(moc.get_fsr_indx(id, 0))
-        for id in self._mod_fsr_ids:
-            self._mod_fsr_inds.append(moc.get_fsr_indx(id, 0))
+    def _set_fsr_indexes(self, inds: List[List[int]]) -> None:
+        self._clad_fsr_inds: List[int] = inds[0]
+        self._mod_fsr_inds: List[int] = inds[1]
 
         if isinstance(self.fill, BurnablePoisonRod):
-            self.fill.populate_fsr_indexes(moc)
+            self.fill._set_fsr_indexes(inds[2:])
 
     def obtain_flux_spectra(self, moc: MOCDriver) -> None:
         """
@@ -764,6 +855,17 @@ class GuideTube:
         if not self.empty and isinstance(self.fill, BurnablePoisonRod):
             self.fill.obtain_flux_spectra(moc)
 
+    def _flux_spectra_fsr_sets(self) -> List[List[int]]:
+        # Sets of FSR indexes of the depleted regions, in the order expected
+        # by _set_flux_spectra
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            return self.fill._flux_spectra_fsr_sets()
+        return []
+
+    def _set_flux_spectra(self, spectra: np.ndarray) -> None:
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            self.fill._set_flux_spectra(spectra)
+
     def normalize_flux_spectrum(self, f) -> None:
         """
         If the guide tube contains a burnable poison rod, it applies a
@@ -778,6 +880,32 @@ class GuideTube:
         if not self.empty and isinstance(self.fill, BurnablePoisonRod):
             self.fill.normalize_flux_spectrum(f)
 
+    def flux_spectra_state(self) -> Optional[np.ndarray]:
+        """
+        Copies the flux spectrum of the burnable poison rod, if there is one,
+        so that it may be restored after the calculation of a perturbed state.
+
+        Returns
+        -------
+        ndarray or None
+            Flux spectrum of the poison, or None without a poison rod.
+        """
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            return self.fill.flux_spectra_state()
+        return None
+
+    def restore_flux_spectra_state(self, state: Optional[np.ndarray]) -> None:
+        """
+        Restores the flux spectrum of the burnable poison rod, if there is one.
+
+        Parameters
+        ----------
+        state : ndarray or None
+            Flux spectrum from :py:meth:`flux_spectra_state`.
+        """
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            self.fill.restore_flux_spectra_state(state)
+
     def predict_depletion(
         self,
         chain: DepletionChain,
@@ -843,3 +971,149 @@ class GuideTube:
 
         if not self.empty and isinstance(self.fill, BurnablePoisonRod):
             self.fill.correct_depletion(chain, ndl, dt, dtm1)
+
+    def predictor_depletion_requests(
+        self, dt: float, dtm1: Optional[float] = None
+    ) -> List[DepletionRequest]:
+        """
+        Makes the depletion requests of the predictor for the fill of the
+        guide tube, so that many materials may be depleted at once with
+        :py:func:`deplete_materials`. The results must then be given to
+        :py:meth:`set_predictor_depletion_results`.
+
+        Parameters
+        ----------
+        dt : float
+            Durration of the time step in seconds.
+        dtm1 : float, optional
+            Durration of the previous time step in seconds. Default is None.
+
+        Returns
+        -------
+        list of DepletionRequest
+            Depletion requests of the fill, empty if nothing is depleted.
+        """
+        if dt <= 0:
+            raise ValueError("Predictor time step must be > 0.")
+
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            return self.fill.predictor_depletion_requests(dt, dtm1)
+        return []
+
+    def set_predictor_depletion_results(self, results: List[DepletionResult]):
+        """
+        Saves the results of the requests made by
+        :py:meth:`predictor_depletion_requests`.
+
+        Parameters
+        ----------
+        results : list of DepletionResult
+            Depletion results of the fill.
+        """
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            self.fill.set_predictor_depletion_results(results)
+        elif len(results) > 0:
+            raise ValueError("Guide tube has no depleted materials.")
+
+    def corrector_depletion_requests(
+        self, dt: float, dtm1: Optional[float] = None
+    ) -> List[DepletionRequest]:
+        """
+        Makes the depletion requests of the corrector for the fill of the
+        guide tube, so that many materials may be depleted at once with
+        :py:func:`deplete_materials`. The results must then be given to
+        :py:meth:`set_corrector_depletion_results`.
+
+        Parameters
+        ----------
+        dt : float
+            Durration of the time step in seconds.
+        dtm1 : float, optional
+            Durration of the previous time step in seconds. Default is None.
+
+        Returns
+        -------
+        list of DepletionRequest
+            Depletion requests of the fill, empty if nothing is depleted.
+        """
+        if dt <= 0:
+            raise ValueError("Corrector time step must be > 0.")
+
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            return self.fill.corrector_depletion_requests(dt, dtm1)
+        return []
+
+    def set_corrector_depletion_results(self, results: List[DepletionResult]):
+        """
+        Saves the results of the requests made by
+        :py:meth:`corrector_depletion_requests`.
+
+        Parameters
+        ----------
+        results : list of DepletionResult
+            Depletion results of the fill.
+        """
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            self.fill.set_corrector_depletion_results(results)
+        elif len(results) > 0:
+            raise ValueError("Guide tube has no depleted materials.")
+
+    def depletion_checkpoint_state(
+        self,
+    ) -> Tuple[
+        List[List[Material]],
+        List[Optional[DepletionMatrix]],
+        List[List[float]],
+        List[List[float]],
+    ]:
+        """
+        Returns the state of the guide tube and of its fill needed to resume
+        a depletion history from a checkpoint, once a depletion step has been
+        completed.
+
+        Returns
+        -------
+        list of list of Material
+            Compositions of the fill, for each depletion step.
+        list of DepletionMatrix
+            Depletion matrices of the previous step of the fill.
+        list of list of float
+            Fuel Dancoff corrections, which are empty.
+        list of list of float
+            Cladding Dancoff corrections.
+        """
+        materials, matrices = [], []
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            materials, matrices, _, _ = self.fill.depletion_checkpoint_state()
+        return (materials, matrices, [], [list(self._clad_dancoff_corrections)])
+
+    def restore_depletion_checkpoint_state(
+        self,
+        materials: List[List[Material]],
+        matrices: List[Optional[DepletionMatrix]],
+        fuel_dancoff_corrections: List[List[float]],
+        clad_dancoff_corrections: List[List[float]],
+    ) -> None:
+        """
+        Restores the state returned by :py:meth:`depletion_checkpoint_state`.
+
+        Parameters
+        ----------
+        materials : list of list of Material
+            Compositions of the fill, for each depletion step.
+        matrices : list of DepletionMatrix
+            Depletion matrices of the previous step of the fill.
+        fuel_dancoff_corrections : list of list of float
+            Fuel Dancoff corrections, which must be empty.
+        clad_dancoff_corrections : list of list of float
+            Cladding Dancoff corrections.
+        """
+        if len(fuel_dancoff_corrections) != 0 or len(clad_dancoff_corrections) != 1:
+            raise ValueError("Checkpoint does not match guide tube.")
+
+        if not self.empty and isinstance(self.fill, BurnablePoisonRod):
+            self.fill.restore_depletion_checkpoint_state(materials, matrices, [], [])
+        elif len(materials) > 0 or len(matrices) > 0:
+            raise ValueError("Guide tube has no depleted materials.")
+
+        self._clad_dancoff_corrections = list(clad_dancoff_corrections[0])
@@ -2,15 +2,15 @@ from scarabee.reseau.burnable_poison_rod import BurnablePoisonRod
 from .fuel_pin import FuelPin
 from .guide_tube import GuideTube
 from .critical_leakage import CriticalLeakage
+from ._dancoff import _dancoff_xs, DANCOFF_CMFD_GROUPS
 from ._ensleeve import (
     _ensleeve_quarter,
     _ensleeve_half_top,
     _ensleeve_half_right,
     _ensleeve_full,
 )
-from .nodal_flux import NodalFlux1D, NodalFlux2D
 from .._scarabee import (
-    borated_water,
+    MaterialCache,
     Material,
     CrossSection,
     NDLibrary,
@@ -20,25 +20,36 @@ from .._scarabee import (
     Direction,
     Cartesian2D,
     MOCDriver,
+    solve_all,
     CMFD,
     BoundaryCondition,
     SimulationMode,
     YamamotoTabuchi6,
+    CriticalitySpectrum,
     P1CriticalitySpectrum,
     B1CriticalitySpectrum,
     ADF,
     CDF,
     DiffusionCrossSection,
     DiffusionData,
+    NodalFlux1D,
+    NodalFlux2D,
     set_logging_level,
     scarabee_log,
     LogLevel,
+    SelfShieldingMethod,
+    SelfShieldingRequest,
+    self_shield_materials,
+    condense_diffusion_cross_sections,
+    deplete_materials,
+    DepletionCheckpoint,
+    CheckpointWriter,
 )
 from enum import Enum
 import numpy as np
-from typing import Optional, List, Tuple, Union
+from typing import Callable, Dict, Optional, List, Tuple, Union
 import copy
-from threading import Thread
+import os
 
 
 class Symmetry(Enum):
@@ -62,6 +73,248 @@ class Symmetry(Enum):
     """
 
 
+class DancoffMethod(Enum):
+    """
+    Defines how the Dancoff corrections of a PWR fuel assembly are computed.
+    """
+
+    MOC = 1
+    """
+    Fixed-source MOC calculations, iterated until the flux converges. This
+    is the reference method.
+    """
+
+    Chord = 2
+    """
+    A single pass over the chords of the same tracks, with the polar angle
+    integrated exactly by the Bickley function Ki3. Much faster, and meant
+    for scoping studies and branch calculations.
+    """
+
+
+class Branch:
+    """
+    Perturbation of the state of a PWRAssembly, for a branch calculation
+    which is run from the converged base state. Parameters which are None
+    keep their value from the base state.
+
+    Parameters
+    ----------
+    boron_ppm : optional float
+        Moderator boron concentration in parts per million. Default is None.
+    moderator_temp : optional float
+        Moderator temperature in Kelvin. Default is None.
+    moderator_pressure : optional float
+        Moderator pressure in MPa. Default is None.
+    fuel_temp : optional float
+        Temperature of all fuel rings in Kelvin. Default is None.
+
+    Attributes
+    ----------
+    boron_ppm : optional float
+        Moderator boron concentration in parts per million.
+    moderator_temp : optional float
+        Moderator temperature in Kelvin.
+    moderator_pressure : optional float
+        Moderator pressure in MPa.
+    fuel_temp : optional float
+        Temperature of all fuel rings in Kelvin.
+    """
+
+    def __init__(
+        self,
+        boron_ppm: Optional[float] = None,
+        moderator_temp: Optional[float] = None,
+        moderator_pressure: Optional[float] = None,
+        fuel_temp: Optional[float] = None,
+    ):
+        if boron_ppm is not None and boron_ppm < 0.0:
+            raise ValueError("Boron concentration must be >= 0.")
+        if moderator_temp is not None and moderator_temp <= 0.0:
+            raise ValueError("Moderator temperature must be > 0.")
+        if moderator_pressure is not None and moderator_pressure <= 0.0:
+            raise ValueError("Moderator pressure must be > 0.")
+        if fuel_temp is not None and fuel_temp <= 0.0:
+            raise ValueError("Fuel temperature must be > 0.")
+
+        self._boron_ppm = boron_ppm
+        self._moderator_temp = moderator_temp
+        self._moderator_pressure = moderator_pressure
+        self._fuel_temp = fuel_temp
+
+    @property
+    def boron_ppm(self) -> Optional[float]:
+        return self._boron_ppm
+
+    @property
+    def moderator_temp(self) -> Optional[float]:
+        return self._moderator_temp
+
+    @property
+    def moderator_pressure(self) -> Optional[float]:
+        return self._moderator_pressure
+
+    @property
+    def fuel_temp(self) -> Optional[float]:
+        return self._fuel_temp
+
+    def __repr__(self) -> str:
+        params = []
+        if self.boron_ppm is not None:
+            params.append(f"boron_ppm={self.boron_ppm}")
+        if self.moderator_temp is not None:
+            params.append(f"moderator_temp={self.moderator_temp}")
+        if self.moderator_pressure is not None:
+            params.append(f"moderator_pressure={self.moderator_pressure}")
+        if self.fuel_temp is not None:
+            params.append(f"fuel_temp={self.fuel_temp}")
+        return "Branch(" + ", ".join(params) + ")"
+
+
+# Relative change of the moderator potential cross section above which the
+# Dancoff corrections of a branch are recomputed instead of reused
+_BRANCH_DANCOFF_RTOL = 1.0e-4
+
+
+def _dilute_request(mat: Material) -> SelfShieldingRequest:
+    return SelfShieldingRequest(
+        mat, SelfShieldingMethod.Dilution, dils=[1.0e10] * mat.size, max_l=1
+    )
+
+
+class _XSBatch:
+    """
+    Collects self-shielding requests from many cells, along with the methods
+    which apply their results, so that they are all computed in one call to
+    :py:func:`self_shield_materials`.
+    """
+
+    def __init__(self):
+        self._slots: List[Tuple[Callable, List[SelfShieldingRequest], bool]] = []
+
+    def add(
+        self,
+        requests: List[SelfShieldingRequest],
+        apply: Callable[[List[CrossSection]], None],
+    ) -> None:
+        if len(requests) > 0:
+            self._slots.append((apply, requests, False))
+
+    def add_one(
+        self, request: SelfShieldingRequest, apply: Callable[[CrossSection], None]
+    ) -> None:
+        self._slots.append((apply, [request], True))
+
+    def run(self, ndl: NDLibrary, cache: Optional[dict] = None) -> None:
+        """
+        Computes and applies the cross sections of all slots. If a cache is
+        given, slots whose requests are identical to those last applied, for
+        the same materials at the same version, are skipped, as the cross
+        section objects already hold their results. As each request changes
+        the micro xs data of its material, a slot is only skipped if no other
+        request for one of its materials is computed, so that every material
+        is left in the same state as if all requests were computed.
+        """
+        sigs = [[_request_signature(r) for r in reqs] for _, reqs, _ in self._slots]
+
+        todo = [True] * len(self._slots)
+        if cache is not None:
+            for k, (apply, reqs, _) in enumerate(self._slots):
+                entry = cache.get(_slot_key(apply))
+                todo[k] = entry is None or not _same_signatures(
+                    entry, apply.__self__, reqs, sigs[k]
+                )
+
+            dirty = set()
+            for k, (_, reqs, _) in enumerate(self._slots):
+                if todo[k]:
+                    dirty.update(id(r.material) for r in reqs)
+            for k, (_, reqs, _) in enumerate(self._slots):
+                if not todo[k] and any(id(r.material) in dirty for r in reqs):
+                    todo[k] = True
+
+        requests = []
+        for k, (_, reqs, _) in enumerate(self._slots):
+            if todo[k]:
+                requests += reqs
+        xss = self_shield_materials(requests, ndl) if len(requests) > 0 else []
+
+        start = 0
+        for k, (apply, reqs, single) in enumerate(self._slots):
+            if not todo[k]:
+                continue
+            n = len(reqs)
+            apply(xss[start] if single else xss[start : start + n])
+            start += n
+            if cache is not None:
+                mats = [r.material for r in reqs]
+                cache[_slot_key(apply)] = (apply.__self__, mats, sigs[k])
+
+
+def _slot_key(apply: Callable) -> tuple:
+    # Cells apply many kinds of cross sections, each with its own method
+    return (id(apply.__self__), apply.__name__)
+
+
+def _request_signature(req: SelfShieldingRequest) -> tuple:
+    return (
+        req.material.version,
+        req.method,
+        req.C,
+        req.Ee,
+        req.Rfuel,
+        req.Rin,
+        req.Rout,
+        tuple(req.dils),
+        req.max_l,
+    )
+
+
+def _same_signatures(
+    entry: tuple, owner, reqs: List[SelfShieldingRequest], sigs: List[tuple]
+) -> bool:
+    # The owner and materials are held by the entry, so their ids stay unique
+    old_owner, old_mats, old_sigs = entry
+    return (
+        old_owner is owner
+        and len(old_mats) == len(reqs)
+        and all(m is r.material for m, r in zip(old_mats, reqs))
+        and old_sigs == sigs
+    )
+
+
+class _PinClass:
+    """
+    Cells of an assembly which are identical by symmetry and loading. Only the
+    requests of the first cell are computed, and their results are applied to
+    all cells of the class. The methods have the names of the cell methods
+    which they fan out to, so that they may be cached by :py:class:`_XSBatch`.
+    """
+
+    def __init__(self, cells: List[Union[FuelPin, GuideTube]]):
+        self.cells = cells
+
+    @property
+    def rep(self) -> Union[FuelPin, GuideTube]:
+        return self.cells[0]
+
+    def set_fuel_xs(self, xss: List[CrossSection]) -> None:
+        for cell in self.cells:
+            cell.set_fuel_xs(xss)
+
+    def apply_gap_xs(self, xs: CrossSection) -> None:
+        for cell in self.cells:
+            cell.apply_gap_xs(xs)
+
+    def set_clad_xs(self, xs: CrossSection) -> None:
+        for cell in self.cells:
+            cell.set_clad_xs(xs)
+
+    def apply_fill_xs(self, xss: List[CrossSection]) -> None:
+        for cell in self.cells:
+            cell.apply_fill_xs(xss)
+
+
 class PWRAssembly:
     """
     A PWRAssembly instance is responsible for performing all the lattice
@@ -167,6 +420,37 @@ class PWRAssembly:
     dancoff_flux_tolerance : float
         Flux convergence tolerance for Dancoff correction calculations. Must be
         in range (0., 1.E-2). Default value is 1.E-5.
+    dancoff_method : DancoffMethod
+        Method used to compute the Dancoff corrections. The chord method
+        ignores the dancoff_flux_tolerance. Default value is DancoffMethod.MOC.
+    dancoff_update_tolerance : optional float
+        If provided, the Dancoff corrections of a self-shielding calculation
+        are only recomputed when the potential cross section of a material of
+        the Dancoff calculations has changed by more than this relative
+        tolerance since the corrections were last computed. Otherwise, the
+        previous corrections are reused. Default is None, for which the
+        corrections are always recomputed.
+    dancoff_update_interval : optional int
+        If provided, the Dancoff corrections are recomputed at least once
+        every this many self-shielding calculations, even if the potential
+        cross sections remain within the dancoff_update_tolerance. If only
+        this option is given, the corrections are recomputed at this fixed
+        interval. Default is None.
+    dancoff_cmfd : bool
+        If True, the MOC calculation of the Dancoff corrections for the full
+        assembly is accelerated with CMFD, on the same pin cell mesh as the
+        assembly calculation. Default value is False. **If you wish to turn
+        it on, you must set this attribute before calling the solve method
+        for the first time.**
+    share_symmetric_pins : bool
+        If True, cells which are mirror images of one another under a
+        reflection of the simulated domain are treated as one. Reflections
+        are only used if every cell is mapped onto a cell given by the same
+        object, such as the diagonal of a quarter assembly with a symmetric
+        loading. The cells of a class share one composition history, one
+        self-shielding calculation, and one depletion solve, and their flux
+        spectra are averaged over all of their regions. Must be set before
+        calling the solve method. Default value is False.
     moc_track_spacing : float
         Spacing between tracks in the assembly MOC calculations. Default value
         is 0.05 cm.
@@ -218,6 +502,28 @@ class PWRAssembly:
         step. If False, the flux from the predictor transport calculation is
         used to perform the corrector step, performing only one transport
         calculation per time step. Default value is True.
+    flux_extrapolation_order : int
+        Order of the polynomial in burn-up used to extrapolate the initial
+        guess of each transport calculation from the previous ones during
+        depletion. May be 0, 1 (linear), or 2 (quadratic). With 0, each
+        calculation starts from the previous solution. Default value is 0.
+    checkpoint_file : optional str
+        Name of the file in which the state of a depletion calculation is
+        saved after each completed time step. If the file already exists when
+        solve is called, the depletion calculation resumes after the last step
+        saved in it. The file is written in the background, so that the next
+        transport calculation is not delayed. Default is None.
+    track_cache_dir : optional str
+        Directory in which the track laydowns of the assembly and Dancoff
+        calculations are cached, one file per distinct geometry. Assemblies
+        of the same geometry, possibly solved in other processes, then only
+        trace their tracks once. Default is None.
+    branches : list of Branch
+        State perturbations computed from the converged base state of the
+        single assembly calculation, or of each burn-up point. The tracks and
+        the base solution are reused, and the Dancoff corrections are only
+        recomputed for branches which change the moderator. Default is an
+        empty list.
     exposures : ndarray
         1D Numpy array of the total assembly burn-up exposures at which
         material information is available, in units of MWd/kg. Default value
@@ -238,6 +544,12 @@ class PWRAssembly:
         performed, this attribute will be a list of DiffusionData instances,
         with one for each burn-up point. Before solve has been called, this
         attribute is None.
+    branch_keff : list of float or list of list of float
+        Value of keff for each branch. If depletion was performed, there is
+        one list for each burn-up point.
+    branch_diffusion_data : list of DiffusionData or list of list of DiffusionData
+        DiffusionData instance of each branch. If depletion was performed,
+        there is one list for each burn-up point.
     """
 
     def __init__(
@@ -384,11 +696,14 @@ class PWRAssembly:
         self._linear_power = linear_power
 
         # Make material for borated water
-        self._moderator: Material = borated_water(
-            self.boron_ppm, self.moderator_temp, self.moderator_pressure, self._ndl
+        self._moderator_cache = MaterialCache()
+        self._moderator: Material = self._make_moderator(
+            self.boron_ppm, self.moderator_temp, self.moderator_pressure
         )
-        self._moderator.name = f"Moderator ({self.boron_ppm} ppm boron)"
-        self._moderator.max_legendre_order = self._moderator_legendre_order
+
+        # All compositions are now known, so the nuclear data can be read
+        # while the geometry is built and the tracks are generated
+        self._prefetch_nuclides()
 
         # Set initial boundary conditions
         self._x_min_bc = BoundaryCondition.Periodic
@@ -409,29 +724,23 @@ class PWRAssembly:
         # ----------------------------------------------------------------------
 
         # Make water xs for dancoff calculation
-        self._moderator_dancoff_xs: CrossSection = CrossSection(
-            np.array([self.moderator.potential_xs]),
-            np.array([self.moderator.potential_xs]),
-            np.array([[0.0]]),
-            "Moderator",
+        pot_xs = self.moderator.potential_xs
+        self._moderator_dancoff_xs: CrossSection = _dancoff_xs(
+            pot_xs, pot_xs, "Moderator"
         )
 
         # Spacer grid and grid sleeve dancoff cross sections
         self._spacer_grid_dancoff_xs: Optional[CrossSection] = None
         self._grid_sleeve_dancoff_xs: Optional[CrossSection] = None
         if self.spacer_grid is not None:
-            self._spacer_grid_dancoff_xs: CrossSection = CrossSection(
-                np.array([self.spacer_grid.potential_xs]),
-                np.array([self.spacer_grid.potential_xs]),
-                np.array([[0.0]]),
-                "Spacer Grid",
+            pot_xs = self.spacer_grid.potential_xs
+            self._spacer_grid_dancoff_xs: CrossSection = _dancoff_xs(
+                pot_xs, pot_xs, "Spacer Grid"
             )
         if self.grid_sleeve is not None:
-            self._grid_sleeve_dancoff_xs: CrossSection = CrossSection(
-                np.array([self.grid_sleeve.potential_xs]),
-                np.array([self.grid_sleeve.potential_xs]),
-                np.array([[0.0]]),
-                "Grid Sleeve",
+            pot_xs = self.grid_sleeve.potential_xs
+            self._grid_sleeve_dancoff_xs: CrossSection = _dancoff_xs(
+                pot_xs, pot_xs, "Grid Sleeve"
             )
 
         # Isolated cell geometry for Dancoff correction calculations
@@ -448,6 +757,15 @@ class PWRAssembly:
         self._dancoff_moc_track_spacing = 0.05
         self._dancoff_moc_num_angles = 32
         self._dancoff_flux_tolerance = 1.0e-5
+        self._dancoff_method = DancoffMethod.MOC
+        self._dancoff_update_tolerance: Optional[float] = None
+        self._dancoff_update_interval: Optional[int] = None
+        self._dancoff_cmfd: bool = False
+
+        # Potential cross sections with which the Dancoff corrections were
+        # last computed, and the number of times they have been reused since
+        self._dancoff_reference_pot_xs: Optional[np.ndarray] = None
+        self._dancoff_reuse_count: int = 0
 
         self._fuel_dancoff_corrections = np.zeros(
             (self._simulated_shape[1], self._simulated_shape[0])
@@ -465,6 +783,15 @@ class PWRAssembly:
             self.moderator.size * [1.0e10], self._ndl
         )
 
+        # Requests last applied to each cross section by recompute_all_xs, so
+        # that the cross sections of unchanged materials are not recomputed
+        self._xs_cache: dict = {}
+
+        # Classes of cells which are identical by symmetry, built when first
+        # needed. Each cell is its own class unless pins are shared.
+        self._share_symmetric_pins: bool = False
+        self._pin_classes: Optional[List[_PinClass]] = None
+
         # Spacer grid and grid sleeve cross sections
         self._spacer_grid_xs: Optional[CrossSection] = None
         self._grid_sleeve_xs: Optional[CrossSection] = None
@@ -493,6 +820,9 @@ class PWRAssembly:
         self._infinite_flux_spectrum = (
             None  # To reset to infinite spectrum in MOC driver
         )
+        self._critical_spectrum: Optional[CriticalitySpectrum] = (
+            None  # Initial guess for the next buckling search
+        )
 
         # Depletion time steps in MWd/kg and depletion time steps in days.
         # Initially starts as None (should be provided by user)
@@ -507,6 +837,15 @@ class PWRAssembly:
         # performed per time step.
         self._corrector_transport: bool = True
 
+        # Order of the burn-up extrapolation of the initial transport guess
+        self._flux_extrapolation_order: int = 0
+
+        # File for the checkpoints of the depletion history, and the transport
+        # solution of a checkpoint used to start the next calculation
+        self._checkpoint_file: Optional[str] = None
+        self._track_cache_dir: Optional[str] = None
+        self._initial_moc_solution: Optional[Tuple[float, np.ndarray]] = None
+
         # Either a single value or list of values (for each depletion step)
         self._keff: Union[float, List[float]] = 1.0
 
@@ -526,6 +865,26 @@ class PWRAssembly:
         # burn-up step.
         self._diffusion_data: Optional[Union[DiffusionData, List[DiffusionData]]] = None
 
+        # Branch states, and their results for the single calculation or for
+        # each burn-up step
+        self._branches: List[Branch] = []
+        self._branch_keff: Union[List[float], List[List[float]]] = []
+        self._branch_diffusion_data: Union[
+            List[DiffusionData], List[List[DiffusionData]]
+        ] = []
+
+    def _make_moderator(
+        self, boron_ppm: float, moderator_temp: float, moderator_pressure: float
+    ) -> Material:
+        # Branches and steps at the same moderator state share one material,
+        # along with the cross sections already computed for it
+        moderator = self._moderator_cache.borated_water(
+            boron_ppm, moderator_temp, moderator_pressure, self._ndl
+        )
+        moderator.name = f"Moderator ({boron_ppm} ppm boron)"
+        moderator.max_legendre_order = self._moderator_legendre_order
+        return moderator
+
     @property
     def shape(self) -> Tuple[int, int]:
         return self._shape
@@ -642,6 +1001,66 @@ class PWRAssembly:
 
         self._dancoff_flux_tolerance = tol
 
+    @property
+    def dancoff_method(self) -> DancoffMethod:
+        return self._dancoff_method
+
+    @dancoff_method.setter
+    def dancoff_method(self, method: DancoffMethod) -> None:
+        if not isinstance(method, DancoffMethod):
+            raise TypeError("Dancoff method must be a DancoffMethod.")
+        self._dancoff_method = method
+
+    @property
+    def dancoff_update_tolerance(self) -> Optional[float]:
+        return self._dancoff_update_tolerance
+
+    @dancoff_update_tolerance.setter
+    def dancoff_update_tolerance(self, tol: Optional[float]) -> None:
+        if tol is not None:
+            tol = float(tol)
+            if tol < 0.0:
+                raise ValueError("Dancoff update tolerance must be >= 0.")
+        self._dancoff_update_tolerance = tol
+
+    @property
+    def dancoff_update_interval(self) -> Optional[int]:
+        return self._dancoff_update_interval
+
+    @dancoff_update_interval.setter
+    def dancoff_update_interval(self, interval: Optional[int]) -> None:
+        if interval is not None:
+            if interval < 1:
+                raise ValueError("Dancoff update interval must be >= 1.")
+            interval = int(interval)
+        self._dancoff_update_interval = interval
+
+    @property
+    def dancoff_cmfd(self) -> bool:
+        return self._dancoff_cmfd
+
+    @dancoff_cmfd.setter
+    def dancoff_cmfd(self, cmfd: bool) -> None:
+        if self._full_dancoff_moc is not None:
+            raise RuntimeError(
+                "Cannot change Dancoff CMFD once the Dancoff calculation has been initialized."
+            )
+        self._dancoff_cmfd = cmfd
+
+    @property
+    def share_symmetric_pins(self) -> bool:
+        return self._share_symmetric_pins
+
+    @share_symmetric_pins.setter
+    def share_symmetric_pins(self, share: bool) -> None:
+        if self._asmbly_moc is not None:
+            raise RuntimeError(
+                "Cannot change pin sharing once the assembly calculation has started."
+            )
+        self._share_symmetric_pins = share
+        self._pin_classes = None
+        self._xs_cache.clear()
+
     @property
     def moc_track_spacing(self) -> float:
         return self._moc_track_spacing
@@ -808,6 +1227,55 @@ class PWRAssembly:
     def corrector_transport(self, val: bool) -> None:
         self._corrector_transport = val
 
+    @property
+    def flux_extrapolation_order(self) -> int:
+        return self._flux_extrapolation_order
+
+    @flux_extrapolation_order.setter
+    def flux_extrapolation_order(self, order: int) -> None:
+        if order not in (0, 1, 2):
+            raise ValueError("Flux extrapolation order must be 0, 1, or 2.")
+        self._flux_extrapolation_order = order
+        if self._asmbly_moc is not None:
+            self._asmbly_moc.extrapolation_order = order
+
+    @property
+    def checkpoint_file(self) -> Optional[str]:
+        return self._checkpoint_file
+
+    @checkpoint_file.setter
+    def checkpoint_file(self, fname: Optional[str]) -> None:
+        self._checkpoint_file = fname
+
+    @property
+    def track_cache_dir(self) -> Optional[str]:
+        return self._track_cache_dir
+
+    @track_cache_dir.setter
+    def track_cache_dir(self, dname: Optional[str]) -> None:
+        self._track_cache_dir = dname
+
+    @property
+    def branches(self) -> List[Branch]:
+        return self._branches
+
+    @branches.setter
+    def branches(self, branches: List[Branch]) -> None:
+        for branch in branches:
+            if not isinstance(branch, Branch):
+                raise TypeError("Branches must be Branch instances.")
+        self._branches = list(branches)
+
+    @property
+    def branch_keff(self) -> Union[List[float], List[List[float]]]:
+        return self._branch_keff
+
+    @property
+    def branch_diffusion_data(
+        self,
+    ) -> Union[List[DiffusionData], List[List[DiffusionData]]]:
+        return self._branch_diffusion_data
+
     @property
     def keff(self) -> Union[float, List[float]]:
         return self._keff
@@ -950,10 +1418,19 @@ class PWRAssembly:
         self._cells = []
         self._cells_set = False
         self._initial_heavy_metal_linear_mass = 0.0
+
+        # Cells given by the same object have the same loading, which is used
+        # to find the cells which are identical by symmetry
+        loadings: Dict[int, int] = {}
+        self._cell_loadings: List[List[int]] = []
         for j in range(len(cells)):
             self._cells.append([])
+            self._cell_loadings.append([])
             for i in range(len(cells[j])):
                 self._cells[-1].append(copy.deepcopy(cells[j][i]))
+                self._cell_loadings[-1].append(
+                    loadings.setdefault(id(cells[j][i]), len(loadings))
+                )
 
                 if isinstance(cells[j][i], FuelPin):
                     lfm = cells[j][i].initial_fissionable_linear_mass
@@ -994,6 +1471,73 @@ class PWRAssembly:
         # Convert HM mass from g to kg
         self._initial_heavy_metal_linear_mass *= 1.0e-3
 
+    def _symmetry_maps(self) -> List[Callable[[int, int], Tuple[int, int]]]:
+        # Reflections of the simulated domain onto itself, as maps of the
+        # (j, i) index of a cell. In a quarter assembly, the symmetry lines are
+        # the first column and the last row, which meet on the diagonal.
+        nx, ny = self._simulated_shape
+        if self.symmetry == Symmetry.Full:
+            return [
+                lambda j, i: (j, nx - 1 - i),
+                lambda j, i: (ny - 1 - j, i),
+                lambda j, i: (i, j),
+            ]
+        elif self.symmetry == Symmetry.Half:
+            return [lambda j, i: (j, nx - 1 - i)]
+        return [lambda j, i: (ny - 1 - i, nx - 1 - j)]
+
+    def _cell_classes(self) -> List[_PinClass]:
+        """
+        Groups the cells which are identical by symmetry. Only the reflections
+        under which every cell is mapped onto a cell given by the same object
+        are used, and the classes are their orbits. Each class starts with
+        the first of its cells in row-major order.
+        """
+        if self._pin_classes is not None:
+            return self._pin_classes
+
+        ny = len(self.cells)
+        nx = len(self.cells[0])
+        cls = [[j * nx + i for i in range(nx)] for j in range(ny)]
+
+        if self.share_symmetric_pins:
+            loads = self._cell_loadings
+            for m in self._symmetry_maps():
+                if any(
+                    loads[m(j, i)[0]][m(j, i)[1]] != loads[j][i]
+                    for j in range(ny)
+                    for i in range(nx)
+                ):
+                    continue
+
+                # Merge the classes of each cell and of its image
+                for j in range(ny):
+                    for i in range(nx):
+                        mj, mi = m(j, i)
+                        a, b = cls[j][i], cls[mj][mi]
+                        if a != b:
+                            lo, hi = min(a, b), max(a, b)
+                            for row in cls:
+                                for k in range(nx):
+                                    if row[k] == hi:
+                                        row[k] = lo
+
+        members: Dict[int, List[Union[FuelPin, GuideTube]]] = {}
+        for j in range(ny):
+            for i in range(nx):
+                members.setdefault(cls[j][i], []).append(self.cells[j][i])
+        self._pin_classes = [_PinClass(members[c]) for c in sorted(members)]
+
+        if self.share_symmetric_pins:
+            scarabee_log(
+                LogLevel.Info,
+                "{:} cells are shared as {:} symmetric classes.".format(
+                    nx * ny, len(self._pin_classes)
+                ),
+            )
+
+        return self._pin_classes
+
     def _compute_fuel_volume_fraction(self) -> None:
         """
         Computes the fraction of the assembly which is fuel.
@@ -1043,6 +1587,44 @@ class PWRAssembly:
             self.assembly_pitch * self.assembly_pitch
         )
 
+    def _prefetch_nuclides(self) -> None:
+        """
+        Starts reading the data of all nuclides in the assembly in the
+        background. Each nuclide is read with the largest Legendre order of
+        the materials in which it appears.
+        """
+        materials: List[Material] = [self.moderator]
+        if self.spacer_grid is not None:
+            materials.append(self.spacer_grid)
+        if self.grid_sleeve is not None:
+            materials.append(self.grid_sleeve)
+
+        for row in self.cells:
+            for cell in row:
+                if isinstance(cell, FuelPin):
+                    materials += [ring[-1] for ring in cell.fuel_ring_materials]
+                    if cell.gap is not None:
+                        materials.append(cell.gap)
+                    materials.append(cell.clad)
+                else:
+                    materials.append(cell.clad)
+                    if isinstance(cell.fill, BurnablePoisonRod):
+                        bp = cell.fill
+                        if bp.center is not None:
+                            materials.append(bp.center)
+                        materials += [bp.clad, bp.gap, bp.poison_materials[-1]]
+
+        max_ls: Dict[str, int] = {}
+        for mat in materials:
+            for nuc in mat.composition.nuclides:
+                max_ls[nuc.name] = max(max_ls.get(nuc.name, 0), mat.max_legendre_order)
+
+        by_max_l: Dict[int, List[str]] = {}
+        for name, max_l in max_ls.items():
+            by_max_l.setdefault(max_l, []).append(name)
+        for max_l, names in by_max_l.items():
+            self._ndl.prefetch(names, max_l)
+
     def _compute_moderator_volume_fraction(self) -> None:
         """
         Computes the fraction of the assembly which is moderator.
@@ -1293,11 +1875,19 @@ class PWRAssembly:
                 # Make the MOCDriver
                 moc = MOCDriver(geom)
                 moc.sim_mode = SimulationMode.FixedSource
+                # Isolated Dancoff problems have no CMFD, and converge slowly otherwise
+                moc.anderson_depth = 5
                 moc.x_min_bc = x_min_bc
                 moc.x_max_bc = x_max_bc
                 moc.y_min_bc = y_min_bc
                 moc.y_max_bc = y_max_bc
 
+                # Most isolated cells have the same geometry, which is only traced
+                # once for all of them
+                moc.share_tracks = True
+                if self.track_cache_dir is not None:
+                    moc.track_cache_dir = self.track_cache_dir
+
                 # Generate tracks in serial as each call will run with threads
                 moc.generate_tracks(
                     self._dancoff_moc_num_angles,
@@ -1455,16 +2045,53 @@ class PWRAssembly:
         # Construct the MOC
         self._full_dancoff_moc = MOCDriver(self._full_dancoff_geom)
         self._full_dancoff_moc.sim_mode = SimulationMode.FixedSource
+        self._full_dancoff_moc.anderson_depth = 5
         self._full_dancoff_moc.x_min_bc = self._x_min_bc
         self._full_dancoff_moc.x_max_bc = self._x_max_bc
         self._full_dancoff_moc.y_min_bc = self._y_min_bc
         self._full_dancoff_moc.y_max_bc = self._y_max_bc
+        if self.dancoff_cmfd:
+            # The assembly is optically thick for the purely absorbing Dancoff
+            # problems, so the boundary fluxes converge slowly without CMFD
+            dx_cmfd, dy_cmfd = self._cmfd_mesh()
+            self._full_dancoff_moc.cmfd = CMFD(dx_cmfd, dy_cmfd, DANCOFF_CMFD_GROUPS)
+        if self.track_cache_dir is not None:
+            self._full_dancoff_moc.track_cache_dir = self.track_cache_dir
         self._full_dancoff_moc.generate_tracks(
             self._dancoff_moc_num_angles,
             self._dancoff_moc_track_spacing,
             YamamotoTabuchi6(),
         )
 
+    def _cmfd_mesh(self) -> Tuple[List[float], List[float]]:
+        """
+        CMFD mesh with one tile per pin cell of the simulated domain. The gap
+        around the pins is added to the outer tiles, and the pins cut in half
+        by a symmetry plane have a half-width tile.
+        """
+        extra_width = 0.5 * (self.assembly_pitch - self.shape[0] * self.pitch)
+        dx_cmfd = self._simulated_shape[0] * [self.pitch]
+        dy_cmfd = self._simulated_shape[1] * [self.pitch]
+        if self.symmetry != Symmetry.Full and self.shape[1] % 2 == 1:
+            dy_cmfd[0] *= 0.5
+        if self.symmetry == Symmetry.Quarter and self.shape[0] % 2 == 1:
+            dx_cmfd[0] *= 0.5
+
+        if self.symmetry == Symmetry.Full:
+            dx_cmfd[0] += extra_width
+            dx_cmfd[-1] += extra_width
+            dy_cmfd[0] += extra_width
+            dy_cmfd[-1] += extra_width
+        elif self.symmetry == Symmetry.Half:
+            dx_cmfd[0] += extra_width
+            dx_cmfd[-1] += extra_width
+            dy_cmfd[-1] += extra_width
+        else:
+            dx_cmfd[-1] += extra_width
+            dy_cmfd[-1] += extra_width
+
+        return dx_cmfd, dy_cmfd
+
     def _save_dancoff_fsr_indexes(self) -> None:
         for j in range(len(self.cells)):
             for i in range(len(self.cells[j])):
@@ -1481,14 +2108,8 @@ class PWRAssembly:
         """
         Updates the moderator cross section for all Dancoff correction calculations.
         """
-        self._moderator_dancoff_xs.set(
-            CrossSection(
-                np.array([self.moderator.potential_xs]),
-                np.array([self.moderator.potential_xs]),
-                np.array([[0.0]]),
-                "Moderator",
-            )
-        )
+        pot_xs = self.moderator.potential_xs
+        self._moderator_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "Moderator"))
 
     def set_dancoff_spacer_grid_sleeve_xs(self) -> None:
         """
@@ -1496,31 +2117,22 @@ class PWRAssembly:
         correction calculations.
         """
         if self.spacer_grid is not None:
-            self._spacer_grid_dancoff_xs.set(
-                CrossSection(
-                    np.array([self.spacer_grid.potential_xs]),
-                    np.array([self.spacer_grid.potential_xs]),
-                    np.array([[0.0]]),
-                    "Spacer Grid",
-                )
-            )
+            pot_xs = self.spacer_grid.potential_xs
+            self._spacer_grid_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "Spacer Grid"))
         if self.grid_sleeve is not None:
-            self._grid_sleeve_dancoff_xs.set(
-                CrossSection(
-                    np.array([self.grid_sleeve.potential_xs]),
-                    np.array([self.grid_sleeve.potential_xs]),
-                    np.array([[0.0]]),
-                    "Grid Sleeve",
-                )
-            )
+            pot_xs = self.grid_sleeve.potential_xs
+            self._grid_sleeve_dancoff_xs.set(_dancoff_xs(pot_xs, pot_xs, "Grid Sleeve"))
 
-    def compute_fuel_dancoff_corrections(self) -> None:
+    def compute_dancoff_corrections(self) -> None:
         """
-        Recomputes all Dancoff corrections for the fuel regions in the problem,
-        using the most recent material definitions. All fuel is shelf-shielded
-        together, regardless of wether or not is is UO2 or MOX.
+        Recomputes all Dancoff corrections for the fuel regions and the fuel
+        pin cladding regions in the problem, using the most recent material
+        definitions. All fuel is self-shielded together, regardless of wether
+        or not is is UO2 or MOX, and all cladding is self-shielded together.
+        The fuel and the cladding problems are solved at once, as the two
+        groups of each MOC calculation.
         """
-        scarabee_log(LogLevel.Info, "Computing Dancoff corrections for the fuel.")
+        scarabee_log(LogLevel.Info, "Computing Dancoff corrections.")
         set_logging_level(LogLevel.Warning)
         if not self._dancoff_components_initialized():
             raise RuntimeError(
@@ -1532,34 +2144,38 @@ class PWRAssembly:
             for i in range(len(self.cells[j])):
                 cell = self.cells[j][i]
                 isomoc = self._isolated_dancoff_mocs[j][i]
-
                 isomoc.flux_tolerance = self.dancoff_flux_tolerance
 
-                cell.set_xs_for_fuel_dancoff_calculation()
+                cell.set_xs_for_dancoff_calculation(self._ndl)
 
                 cell.set_isolated_dancoff_fuel_sources(isomoc, self.moderator)
+                cell.set_isolated_dancoff_clad_sources(
+                    isomoc, self.moderator, self._ndl
+                )
 
                 cell.set_full_dancoff_fuel_sources(
                     self._full_dancoff_moc, self.moderator
                 )
+                cell.set_full_dancoff_clad_sources(
+                    self._full_dancoff_moc, self.moderator, self._ndl
+                )
         self._full_dancoff_moc.flux_tolerance = self.dancoff_flux_tolerance
 
-        # Solve all the MOCs in parallel
-        threads = []
+        # Solve all the MOCs, in parallel when iterated. Each chord solve is
+        # a single pass which already uses all threads.
+        mocs = []
         for j in range(len(self.cells)):
             for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                if isinstance(cell, FuelPin):
-                    isomoc = self._isolated_dancoff_mocs[j][i]
-                    threads.append(Thread(target=isomoc.solve))
-                    threads[-1].start()
-        threads.append(Thread(target=self._full_dancoff_moc.solve))
-        threads[-1].start()
-        for t in threads:
-            t.join()
-
-        # Go through and let each cell compute the Dancoff correction if it holds
-        # a fuel pin.
+                mocs.append(self._isolated_dancoff_mocs[j][i])
+        mocs.append(self._full_dancoff_moc)
+        if self.dancoff_method == DancoffMethod.Chord:
+            for moc in mocs:
+                moc.solve_chords()
+        else:
+            solve_all(mocs)
+
+        # Go through and let each cell compute its Dancoff corrections. Only
+        # fuel pins have a fuel Dancoff correction.
         for j in range(len(self.cells)):
             for i in range(len(self.cells[j])):
                 cell = self.cells[j][i]
@@ -1570,58 +2186,6 @@ class PWRAssembly:
                         isomoc, self._full_dancoff_moc
                     )
                     self._fuel_dancoff_corrections[j, i] = C
-        set_logging_level(LogLevel.Info)
-
-    def compute_clad_dancoff_corrections(self) -> None:
-        """
-        Recomputes all Dancoff corrections for the fuel pin cladding regions
-        in the problem, using the most recent material definitions. All
-        cladding is shelf-shielded together.
-        """
-        scarabee_log(LogLevel.Info, "Computing Dancoff corrections for the cladding.")
-        set_logging_level(LogLevel.Warning)
-        if self._full_dancoff_moc is None:
-            raise RuntimeError(
-                "Dancoff calculation components have not been initialized."
-            )
-
-        # Set the xs and sources for all cells
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                isomoc = self._isolated_dancoff_mocs[j][i]
-                isomoc.flux_tolerance = self.dancoff_flux_tolerance
-
-                cell.set_xs_for_clad_dancoff_calculation(self._ndl)
-
-                cell.set_isolated_dancoff_clad_sources(
-                    isomoc, self.moderator, self._ndl
-                )
-
-                cell.set_full_dancoff_clad_sources(
-                    self._full_dancoff_moc, self.moderator, self._ndl
-                )
-            self._full_dancoff_moc.flux_tolerance = self.dancoff_flux_tolerance
-
-        # Solve all the MOCs in parallel
-        threads = []
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                isomoc = self._isolated_dancoff_mocs[j][i]
-                threads.append(Thread(target=isomoc.solve))
-                threads[-1].start()
-        threads.append(Thread(target=self._full_dancoff_moc.solve))
-        threads[-1].start()
-        for t in threads:
-            t.join()
-
-        # Go through and let each cell compute the Dancoff correction if it holds
-        # a fuel pin.
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                isomoc = self._isolated_dancoff_mocs[j][i]
 
                 C = cell.compute_clad_dancoff_correction(isomoc, self._full_dancoff_moc)
                 self._clad_dancoff_corrections[j, i] = C
@@ -1654,11 +2218,57 @@ class PWRAssembly:
         self.set_dancoff_moderator_xs()
         self.set_dancoff_spacer_grid_sleeve_xs()
 
-        # Compute Dancoff corrections
-        self.compute_fuel_dancoff_corrections()
-        self.compute_clad_dancoff_corrections()
+        # Compute Dancoff corrections, unless the previous ones may be reused
+        pot_xs = None
+        if (
+            self._dancoff_update_tolerance is not None
+            or self._dancoff_update_interval is not None
+        ):
+            pot_xs = self._dancoff_potential_xs()
+
+        if pot_xs is None or self._dancoff_update_needed(pot_xs):
+            self.compute_dancoff_corrections()
+            self._dancoff_reference_pot_xs = pot_xs
+            self._dancoff_reuse_count = 0
+        else:
+            self._dancoff_reuse_count += 1
+            scarabee_log(
+                LogLevel.Info,
+                "Reusing Dancoff corrections, max relative change in potential "
+                "xs: {:.3E}.".format(self._dancoff_pot_xs_change(pot_xs)),
+            )
         self.apply_dancoff_corrections()
 
+    def _dancoff_potential_xs(self) -> np.ndarray:
+        pot_xs = [self.moderator.potential_xs]
+        if self.spacer_grid is not None:
+            pot_xs.append(self.spacer_grid.potential_xs)
+        if self.grid_sleeve is not None:
+            pot_xs.append(self.grid_sleeve.potential_xs)
+        for row in self.cells:
+            for cell in row:
+                pot_xs += cell.dancoff_potential_xs(self._ndl)
+        return np.array(pot_xs)
+
+    def _dancoff_pot_xs_change(self, pot_xs: np.ndarray) -> float:
+        ref = self._dancoff_reference_pot_xs
+        return float(np.max(np.abs(pot_xs - ref) / np.abs(ref)))
+
+    def _dancoff_update_needed(self, pot_xs: np.ndarray) -> bool:
+        # The relative change of the potential cross sections is the estimate
+        # of the error made by reusing the Dancoff corrections, which, for a
+        # fixed geometry, depend only on them.
+        ref = self._dancoff_reference_pot_xs
+        if ref is None or ref.shape != pot_xs.shape:
+            return True
+        if self._dancoff_update_interval is not None:
+            if self._dancoff_reuse_count + 1 >= self._dancoff_update_interval:
+                return True
+        if self._dancoff_update_tolerance is not None:
+            if self._dancoff_pot_xs_change(pot_xs) > self._dancoff_update_tolerance:
+                return True
+        return False
+
     # ==========================================================================
     # Transport Calculation Related Methods
 
@@ -1787,6 +2397,7 @@ class PWRAssembly:
         self._asmbly_moc.x_max_bc = self._x_max_bc
         self._asmbly_moc.y_min_bc = self._y_min_bc
         self._asmbly_moc.y_max_bc = self._y_max_bc
+        self._asmbly_moc.extrapolation_order = self._flux_extrapolation_order
 
         # Apply CMFD if turned on
         if self.cmfd and self.cmfd_condensation_scheme is None:
@@ -1794,32 +2405,14 @@ class PWRAssembly:
                 "CMFD is enabled but no CMFD condensation scheme has been provided."
             )
         elif self.cmfd:
-            extra_width = 0.5 * (self.assembly_pitch - self.shape[0] * self.pitch)
-            dx_cmfd = self._simulated_shape[0] * [self.pitch]
-            dy_cmfd = self._simulated_shape[1] * [self.pitch]
-            if self.symmetry != Symmetry.Full and self.shape[1] % 2 == 1:
-                dy_cmfd[0] *= 0.5
-            if self.symmetry == Symmetry.Quarter and self.shape[0] % 2 == 1:
-                dx_cmfd[0] *= 0.5
-
-            if self.symmetry == Symmetry.Full:
-                dx_cmfd[0] += extra_width
-                dx_cmfd[-1] += extra_width
-                dy_cmfd[0] += extra_width
-                dy_cmfd[-1] += extra_width
-            elif self.symmetry == Symmetry.Half:
-                dx_cmfd[0] += extra_width
-                dx_cmfd[-1] += extra_width
-                dy_cmfd[-1] += extra_width
-            else:
-                dx_cmfd[-1] += extra_width
-                dy_cmfd[-1] += extra_width
-
+            dx_cmfd, dy_cmfd = self._cmfd_mesh()
             self._asmbly_moc.cmfd = CMFD(
                 dx_cmfd, dy_cmfd, self.cmfd_condensation_scheme
             )
 
         # Trace tracks
+        if self.track_cache_dir is not None:
+            self._asmbly_moc.track_cache_dir = self.track_cache_dir
         self._asmbly_moc.generate_tracks(
             self._moc_num_angles,
             self._moc_track_spacing,
@@ -1829,10 +2422,16 @@ class PWRAssembly:
         self._save_fsr_indexes()
 
     def _save_fsr_indexes(self) -> None:
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                cell.populate_fsr_indexes(self._asmbly_moc)
+        # The FSR IDs of all cells are converted to indexes in one call
+        cells = [cell for row in self.cells for cell in row]
+        id_sets = [cell._fsr_id_sets() for cell in cells]
+        inds = self._asmbly_moc.get_fsr_indxs(
+            [ids for sets in id_sets for ids in sets], 0
+        )
+        start = 0
+        for cell, sets in zip(cells, id_sets):
+            cell._set_fsr_indexes(inds[start : start + len(sets)])
+            start += len(sets)
 
     def plot(self) -> None:
         """
@@ -1848,6 +2447,7 @@ class PWRAssembly:
         """
         Updates the moderator cross section for transport calculations.
         """
+        self._xs_cache.clear()
         self._moderator_xs.set(
             self.moderator.dilution_xs(self.moderator.size * [1.0e10], self._ndl)
         )
@@ -1857,6 +2457,7 @@ class PWRAssembly:
         Updates the spacer grid and grid sleeve cross sections for transport
         calculations.
         """
+        self._xs_cache.clear()
         if self.spacer_grid is not None:
             self._spacer_grid_xs.set(
                 self.spacer_grid.dilution_xs(
@@ -1873,16 +2474,46 @@ class PWRAssembly:
     def recompute_all_xs(self) -> None:
         """
         Computes and applies all cross sections using the most recent material
-        information and Dancoff corrections.
+        information and Dancoff corrections. Cross sections whose materials,
+        material versions, and Dancoff corrections are unchanged since the
+        last call are not recomputed.
         """
-        self.recompute_all_fuel_xs()
-        self.recompute_all_gap_xs()
-        self.recompute_all_clad_xs()
-
-        self.recompute_all_guide_tube_fill_xs()
+        # The cross sections of all materials of the assembly are computed in a
+        # single parallel batch. Requests for the same material are evaluated
+        # in the order they are added, which is that of the individual
+        # recompute methods, so the results are the same as calling each one.
+        # Only the first cell of each class of symmetric cells is computed.
+        classes = self._cell_classes()
+        batch = _XSBatch()
+        for pc in classes:
+            if isinstance(pc.rep, FuelPin):
+                batch.add(pc.rep.fuel_self_shielding_requests(-1), pc.set_fuel_xs)
+
+        for pc in classes:
+            if isinstance(pc.rep, FuelPin):
+                gap_request = pc.rep.gap_xs_request()
+                if gap_request is not None:
+                    batch.add_one(gap_request, pc.apply_gap_xs)
+
+        for pc in classes:
+            batch.add_one(pc.rep.clad_self_shielding_request(-1), pc.set_clad_xs)
+
+        for pc in classes:
+            if isinstance(pc.rep, GuideTube):
+                batch.add(pc.rep.fill_xs_requests(-1), pc.apply_fill_xs)
+
+        batch.add_one(_dilute_request(self.moderator), self._moderator_xs.set)
+        if self.spacer_grid is not None:
+            batch.add_one(_dilute_request(self.spacer_grid), self._spacer_grid_xs.set)
+        if self.grid_sleeve is not None:
+            batch.add_one(_dilute_request(self.grid_sleeve), self._grid_sleeve_xs.set)
 
-        self.set_moderator_xs()
-        self.set_spacer_grid_sleeve_xs()
+        # When the library memoizes self-shielded cross sections, pins with
+        # nearly the same escape parameters share their results within this
+        # step only, as the compositions and temperatures change between steps
+        if self._ndl.xs_cache:
+            self._ndl.clear_xs_cache()
+        batch.run(self._ndl, self._xs_cache)
 
     def recompute_all_self_shielded_xs(self) -> None:
         """
@@ -1897,27 +2528,44 @@ class PWRAssembly:
         Computes and applies all fuel cross sections using the most recent
         material information and Dancoff corrections.
         """
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                if isinstance(cell, FuelPin):
-                    cell.set_fuel_xs_for_depletion_step(-1, self._ndl)
+        self._xs_cache.clear()
+
+        # All rings of all pins are self-shielded together, in parallel, once
+        # per class of symmetric pins
+        pins = []
+        requests = []
+        for pc in self._cell_classes():
+            if isinstance(pc.rep, FuelPin):
+                pin_requests = pc.rep.fuel_self_shielding_requests(-1)
+                pins.append((pc, len(requests), len(pin_requests)))
+                requests += pin_requests
+
+        xss = self_shield_materials(requests, self._ndl)
+        for pc, start, nrings in pins:
+            pc.set_fuel_xs(xss[start : start + nrings])
 
     def recompute_all_clad_xs(self) -> None:
         """
         Computes and applies all cladding cross sections using the most recent
         material information and Dancoff corrections.
         """
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                cell.set_clad_xs_for_depletion_step(-1, self._ndl)
+        self._xs_cache.clear()
+
+        # The claddings of all cells are self-shielded together, in parallel,
+        # once per class of symmetric cells
+        classes = self._cell_classes()
+        requests = [pc.rep.clad_self_shielding_request(-1) for pc in classes]
+
+        xss = self_shield_materials(requests, self._ndl)
+        for pc, xs in zip(classes, xss):
+            pc.set_clad_xs(xs)
 
     def recompute_all_gap_xs(self) -> None:
         """
         Computes and applies all gap cross sections using the most recent
         material information.
         """
+        self._xs_cache.clear()
         for j in range(len(self.cells)):
             for i in range(len(self.cells[j])):
                 cell = self.cells[j][i]
@@ -1929,6 +2577,7 @@ class PWRAssembly:
         Computes and applies all cross sections for the fill objects of guide
         tubes. These could be for burnable poison rods or control rods.
         """
+        self._xs_cache.clear()
         for j in range(len(self.cells)):
             for i in range(len(self.cells[j])):
                 cell = self.cells[j][i]
@@ -1954,12 +2603,23 @@ class PWRAssembly:
             scarabee_log(
                 LogLevel.Info, "Performing P1 criticality spectrum calculation"
             )
-            critical_spectrum = P1CriticalitySpectrum(homogenized_moc)
+            if self._critical_spectrum is None:
+                critical_spectrum = P1CriticalitySpectrum(homogenized_moc)
+            else:
+                critical_spectrum = P1CriticalitySpectrum(
+                    homogenized_moc, self._critical_spectrum
+                )
         else:
             scarabee_log(
                 LogLevel.Info, "Performing B1 criticality spectrum calculation"
             )
-            critical_spectrum = B1CriticalitySpectrum(homogenized_moc)
+            if self._critical_spectrum is None:
+                critical_spectrum = B1CriticalitySpectrum(homogenized_moc)
+            else:
+                critical_spectrum = B1CriticalitySpectrum(
+                    homogenized_moc, self._critical_spectrum
+                )
+        self._critical_spectrum = critical_spectrum
 
         self._asmbly_moc.apply_criticality_spectrum(critical_spectrum.flux)
 
@@ -1982,9 +2642,31 @@ class PWRAssembly:
         depleted. This includes each fuel ring in fuel pins and the poison in
         burnable poison rods.
         """
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                self.cells[j][i].obtain_flux_spectra(self._asmbly_moc)
+        # The spectra of all cells are homogenized in one parallel call. The
+        # spectra of a class of symmetric cells are averaged over the regions
+        # of all of its cells, and each cell is given its own copy.
+        classes = self._cell_classes()
+        fsr_sets = []
+        for pc in classes:
+            cell_sets = [cell._flux_spectra_fsr_sets() for cell in pc.cells]
+            fsr_sets.append(
+                [
+                    [fsr for sets in cell_sets for fsr in sets[k]]
+                    for k in range(len(cell_sets[0]))
+                ]
+            )
+        all_sets = [fsrs for sets in fsr_sets for fsrs in sets]
+        if len(all_sets) == 0:
+            return
+        spectra = self._asmbly_moc.homogenize_flux_spectra(all_sets)
+        start = 0
+        for pc, sets in zip(classes, fsr_sets):
+            if len(sets) > 0:
+                for cell in pc.cells:
+                    cell._set_flux_spectra(
+                        np.array(spectra[start : start + len(sets), :])
+                    )
+            start += len(sets)
 
     def normalize_flux_to_power(self) -> None:
         """
@@ -2066,13 +2748,12 @@ class PWRAssembly:
         if self.condensation_scheme is None:
             raise RuntimeError("Energy condensation scheme not set.")
 
-        flux = [0.0 for G in range(len(self.condensation_scheme))]
+        fine_flux = self._asmbly_moc.fluxes(np.array([[r.x, r.y]]), u)[0, :]
 
+        flux = [0.0 for G in range(len(self.condensation_scheme))]
         for G in range(len(self.condensation_scheme)):
             gmin, gmax = self.condensation_scheme[G][:]
-
-            for g in range(gmin, gmax + 1):
-                flux[G] += self._asmbly_moc.flux(r, u, g)
+            flux[G] = np.sum(fine_flux[gmin : gmax + 1])
 
         return flux
 
@@ -2101,20 +2782,16 @@ class PWRAssembly:
         if self.condensation_scheme is None:
             raise RuntimeError("Energy condensation scheme not set.")
 
-        total_length = 0.0
-        for s in segments:
-            total_length += s[1]
-        invs_tot_length = 1.0 / total_length
+        fsrs = np.array([s[0] for s in segments], dtype=np.uint64)
+        lengths = np.array([s[1] for s in segments])
 
-        flux = np.zeros(len(self.condensation_scheme))
+        # Length weighted average of the fine group flux
+        fine_flux = lengths @ self._asmbly_moc.fsr_fluxes(fsrs) / np.sum(lengths)
 
+        flux = np.zeros(len(self.condensation_scheme))
         for G in range(len(self.condensation_scheme)):
             gmin, gmax = self.condensation_scheme[G][:]
-            for g in range(gmin, gmax + 1):
-                for s in segments:
-                    flux[G] += s[1] * self._asmbly_moc.flux(s[0], g)
-
-        flux *= invs_tot_length
+            flux[G] = np.sum(fine_flux[gmin : gmax + 1])
 
         return flux
 
@@ -2437,6 +3114,40 @@ class PWRAssembly:
         current /= moc.x_max - moc.x_min
         return current
 
+    def _condense_cmfd_tiles(
+        self, tiles: List[Tuple[int, int]]
+    ) -> Tuple[List[np.ndarray], List[DiffusionCrossSection]]:
+        """
+        Homogenizes the flux spectrum and the diffusion cross sections of
+        CMFD tiles. The cross sections of all tiles are condensed at once.
+
+        Parameters
+        ----------
+        tiles : list of tuple of int
+            Indices (i, j) of the CMFD tiles.
+
+        Returns
+        -------
+        list of ndarray
+            Homogenized flux spectrum of each tile.
+        list of DiffusionCrossSection
+            Condensed diffusion cross sections of each tile.
+        """
+        moc = self._asmbly_moc
+        cmfd = moc.cmfd
+
+        flux_specs = []
+        fine_diff_xs = []
+        for i, j in tiles:
+            cmfd_tile_fsrs = cmfd.tile_fsr_list(i, j)
+            flux_specs.append(moc.homogenize_flux_spectrum(cmfd_tile_fsrs))
+            fine_diff_xs.append(moc.homogenize(cmfd_tile_fsrs).diffusion_xs())
+
+        few_diff_xs = condense_diffusion_cross_sections(
+            fine_diff_xs, flux_specs, self.condensation_scheme
+        )
+        return flux_specs, few_diff_xs
+
     def _get_het_flux_xp_cmfd(self, cond_scheme: List[List[int]]) -> np.ndarray:
         NG = len(cond_scheme)
         moc = self._asmbly_moc
@@ -2450,16 +3161,16 @@ class PWRAssembly:
         i = cmfd.nx - 1
         x_min = 0.0
         x_max = cmfd.dx[-1]
+        tile_flux_specs, tile_diff_xs = self._condense_cmfd_tiles(
+            [(i, j) for j in range(cmfd.ny)]
+        )
         for j in range(cmfd.ny):
-            # For tile (i, j), get the FSR list
-            cmfd_tile_fsrs = cmfd.tile_fsr_list(i, j)
-
             # Get surface indices
             s_neg = cmfd.get_x_neg_surf(i, j)
             s_pos = cmfd.get_x_pos_surf(i, j)
 
-            # Homogenize average flux for the tile
-            tile_flux_spec = moc.homogenize_flux_spectrum(cmfd_tile_fsrs)
+            # Average flux for the tile
+            tile_flux_spec = tile_flux_specs[j]
             avg_flux = np.zeros(NG)
             for G in range(NG):
                 for g in range(
@@ -2467,12 +3178,8 @@ class PWRAssembly:
                 ):
                     avg_flux[G] += tile_flux_spec[g]
 
-            # Homogenize the xs and condense
-            fine_tile_xs = moc.homogenize(cmfd_tile_fsrs)
-            fine_tile_diff_xs = fine_tile_xs.diffusion_xs()
-            few_diff_xs = fine_tile_diff_xs.condense(
-                self.condensation_scheme, tile_flux_spec
-            )
+            # Condensed xs of the tile
+            few_diff_xs = tile_diff_xs[j]
 
             # Condense currents for the tile
             j_neg = np.zeros(NG)
@@ -2489,9 +3196,8 @@ class PWRAssembly:
 
         # Now we need to get the average heterogeneous flux on the surface
         het_flux = np.zeros(NG)
-        for G in range(NG):
-            for j in range(cmfd.ny):
-                het_flux[G] += node_fluxes[j].pos_surf_flux(G) * dlts[j]
+        for j in range(cmfd.ny):
+            het_flux += node_fluxes[j].pos_surf_flux() * dlts[j]
         het_flux /= moc.y_max - moc.y_min
 
         return het_flux
@@ -2509,16 +3215,16 @@ class PWRAssembly:
         i = 0
         x_min = 0.0
         x_max = cmfd.dx[0]
+        tile_flux_specs, tile_diff_xs = self._condense_cmfd_tiles(
+            [(i, j) for j in range(cmfd.ny)]
+        )
         for j in range(cmfd.ny):
-            # For tile (i, j), get the FSR list
-            cmfd_tile_fsrs = cmfd.tile_fsr_list(i, j)
-
             # Get surface indices
             s_neg = cmfd.get_x_neg_surf(i, j)
             s_pos = cmfd.get_x_pos_surf(i, j)
 
-            # Homogenize average flux for the tile
-            tile_flux_spec = moc.homogenize_flux_spectrum(cmfd_tile_fsrs)
+            # Average flux for the tile
+            tile_flux_spec = tile_flux_specs[j]
             avg_flux = np.zeros(NG)
             for G in range(NG):
                 for g in range(
@@ -2526,12 +3232,8 @@ class PWRAssembly:
                 ):
                     avg_flux[G] += tile_flux_spec[g]
 
-            # Homogenize the xs and condense
-            fine_tile_xs = moc.homogenize(cmfd_tile_fsrs)
-            fine_tile_diff_xs = fine_tile_xs.diffusion_xs()
-            few_diff_xs = fine_tile_diff_xs.condense(
-                self.condensation_scheme, tile_flux_spec
-            )
+            # Condensed xs of the tile
+            few_diff_xs = tile_diff_xs[j]
 
             # Condense currents for the tile
             j_neg = np.zeros(NG)
@@ -2548,9 +3250,8 @@ class PWRAssembly:
 
         # Now we need to get the average heterogeneous flux on the surface
         het_flux = np.zeros(NG)
-        for G in range(NG):
-            for j in range(cmfd.ny):
-                het_flux[G] += node_fluxes[j].neg_surf_flux(G) * dlts[j]
+        for j in range(cmfd.ny):
+            het_flux += node_fluxes[j].neg_surf_flux() * dlts[j]
         het_flux /= moc.y_max - moc.y_min
 
         return het_flux
@@ -2568,16 +3269,16 @@ class PWRAssembly:
         j = cmfd.ny - 1
         y_min = 0.0
         y_max = cmfd.dy[-1]
+        tile_flux_specs, tile_diff_xs = self._condense_cmfd_tiles(
+            [(i, j) for i in range(cmfd.nx)]
+        )
         for i in range(cmfd.nx):
-            # For tile (i, j), get the FSR list
-            cmfd_tile_fsrs = cmfd.tile_fsr_list(i, j)
-
             # Get surface indices
             s_neg = cmfd.get_y_neg_surf(i, j)
             s_pos = cmfd.get_y_pos_surf(i, j)
 
-            # Homogenize average flux for the tile
-            tile_flux_spec = moc.homogenize_flux_spectrum(cmfd_tile_fsrs)
+            # Average flux for the tile
+            tile_flux_spec = tile_flux_specs[i]
             avg_flux = np.zeros(NG)
             for G in range(NG):
                 for g in range(
@@ -2585,12 +3286,8 @@ class PWRAssembly:
                 ):
                     avg_flux[G] += tile_flux_spec[g]
 
-            # Homogenize the xs and condense
-            fine_tile_xs = moc.homogenize(cmfd_tile_fsrs)
-            fine_tile_diff_xs = fine_tile_xs.diffusion_xs()
-            few_diff_xs = fine_tile_diff_xs.condense(
-                self.condensation_scheme, tile_flux_spec
-            )
+            # Condensed xs of the tile
+            few_diff_xs = tile_diff_xs[i]
 
             # Condense currents for the tile
             j_neg = np.zeros(NG)
@@ -2607,9 +3304,8 @@ class PWRAssembly:
 
         # Now we need to get the average heterogeneous flux on the surface
         het_flux = np.zeros(NG)
-        for G in range(NG):
-            for i in range(cmfd.nx):
-                het_flux[G] += node_fluxes[i].pos_surf_flux(G) * dlts[i]
+        for i in range(cmfd.nx):
+            het_flux += node_fluxes[i].pos_surf_flux() * dlts[i]
         het_flux /= moc.x_max - moc.x_min
 
         return het_flux
@@ -2626,16 +3322,16 @@ class PWRAssembly:
         j = 0
         y_min = 0.0
         y_max = cmfd.dy[0]
+        tile_flux_specs, tile_diff_xs = self._condense_cmfd_tiles(
+            [(i, j) for i in range(cmfd.nx)]
+        )
         for i in range(cmfd.nx):
-            # For tile (i, j), get the FSR list
-            cmfd_tile_fsrs = cmfd.tile_fsr_list(i, j)
-
             # Get surface indices
             s_neg = cmfd.get_y_neg_surf(i, j)
             s_pos = cmfd.get_y_pos_surf(i, j)
 
-            # Homogenize average flux for the tile
-            tile_flux_spec = moc.homogenize_flux_spectrum(cmfd_tile_fsrs)
+            # Average flux for the tile
+            tile_flux_spec = tile_flux_specs[i]
             avg_flux = np.zeros(NG)
             for G in range(NG):
                 for g in range(
@@ -2643,12 +3339,8 @@ class PWRAssembly:
                 ):
                     avg_flux[G] += tile_flux_spec[g]
 
-            # Homogenize the xs and condense
-            fine_tile_xs = moc.homogenize(cmfd_tile_fsrs)
-            fine_tile_diff_xs = fine_tile_xs.diffusion_xs()
-            few_diff_xs = fine_tile_diff_xs.condense(
-                self.condensation_scheme, tile_flux_spec
-            )
+            # Condensed xs of the tile
+            few_diff_xs = tile_diff_xs[i]
 
             # Condense currents for the tile
             j_neg = np.zeros(NG)
@@ -2665,9 +3357,8 @@ class PWRAssembly:
 
         # Now we need to get the average heterogeneous flux on the surface
         het_flux = np.zeros(NG)
-        for G in range(NG):
-            for i in range(cmfd.nx):
-                het_flux[G] += node_fluxes[i].neg_surf_flux(G) * dlts[i]
+        for i in range(cmfd.nx):
+            het_flux += node_fluxes[i].neg_surf_flux() * dlts[i]
         het_flux /= moc.x_max - moc.x_min
 
         return het_flux
@@ -2696,17 +3387,11 @@ class PWRAssembly:
         moc = self._asmbly_moc
 
         # First, compute the homogeneous flux
+        fine_homog_flux = moc.homogenize_flux_spectrum()
         homog_flux = np.zeros(NG)
-        total_volume = 0.0
-        for i in range(moc.nfsr):
-            Vi = moc.volume(i)
-            total_volume += Vi
-
-            for G in range(NG):
-                gmin, gmax = self.condensation_scheme[G][:]
-                for g in range(gmin, gmax + 1):
-                    homog_flux[G] += Vi * moc.flux(i, g)
-        homog_flux /= total_volume
+        for G in range(NG):
+            gmin, gmax = self.condensation_scheme[G][:]
+            homog_flux[G] = np.sum(fine_homog_flux[gmin : gmax + 1])
 
         # Create empty arrays for ADFs and CDFs
         adf = np.ones((NG, 6))
@@ -2949,6 +3634,7 @@ class PWRAssembly:
         self_shield: bool,
         apply_dancoff_corrections: bool = False,
         transport: bool = True,
+        exposure: Optional[float] = None,
     ) -> None:
         """
         Runs a single MOC calculation, applies critical leakage model, obtains
@@ -2969,6 +3655,9 @@ class PWRAssembly:
             If True, the MOC calculation is performed. Otherwise, the MOC
             calculation is not performed, but the leakage correction and flux
             normalization are.
+        exposure : float, optional
+            Assembly exposure of the material compositions, in MWd/kg. Used to
+            extrapolate the initial guess of the MOC calculation.
         """
         if self_shield:
             # If we want self-shielding, do that stuff
@@ -2984,6 +3673,12 @@ class PWRAssembly:
 
         self._asmbly_moc.flux_tolerance = self.flux_tolerance
         self._asmbly_moc.keff_tolerance = self.keff_tolerance
+        if exposure is not None:
+            self._asmbly_moc.solution_step = exposure
+        if self._initial_moc_solution is not None:
+            # Warm start from the solution of a checkpoint
+            self._asmbly_moc.set_initial_solution(*self._initial_moc_solution)
+            self._initial_moc_solution = None
 
         if transport:
             set_logging_level(LogLevel.Warning)
@@ -2997,37 +3692,256 @@ class PWRAssembly:
         self.normalize_flux_to_power()
         self.apply_infinite_spectrum()
 
+    def _set_branch_state(
+        self,
+        boron_ppm: float,
+        moderator_temp: float,
+        moderator_pressure: float,
+        moderator: Optional[Material],
+        fuel_temps: List[float],
+    ) -> None:
+        self._boron_ppm = boron_ppm
+        self._moderator_temp = moderator_temp
+        self._moderator_pressure = moderator_pressure
+        if moderator is None:
+            moderator = self._make_moderator(
+                boron_ppm, moderator_temp, moderator_pressure
+            )
+        self._moderator = moderator
+
+        for mat, temp in zip(self._current_fuel_materials(), fuel_temps):
+            mat.temperature = temp
+
+    def _current_fuel_materials(self) -> List[Material]:
+        mats = []
+        for row in self.cells:
+            for cell in row:
+                if isinstance(cell, FuelPin):
+                    mats += [ring[-1] for ring in cell.fuel_ring_materials]
+        return mats
+
+    def _run_branches(self) -> Tuple[List[float], List[DiffusionData]]:
+        """
+        Runs the calculation of each branch from the converged base state,
+        reusing the tracks, the base solution as initial guess, and the
+        Dancoff corrections when the moderator is nearly unchanged. The base
+        state is restored afterwards, including the flux spectra used for
+        depletion and the solution history used for extrapolation.
+
+        Returns
+        -------
+        list of float
+            Value of keff for each branch.
+        list of DiffusionData
+            Diffusion data for each branch.
+        """
+        keffs: List[float] = []
+        diffusion_data: List[DiffusionData] = []
+        if len(self.branches) == 0:
+            return keffs, diffusion_data
+
+        base = (
+            self._boron_ppm,
+            self._moderator_temp,
+            self._moderator_pressure,
+            self._moderator,
+            [mat.temperature for mat in self._current_fuel_materials()],
+        )
+        base_pot_xs = self.moderator.potential_xs
+        base_spectra = [
+            [cell.flux_spectra_state() for cell in row] for row in self.cells
+        ]
+        base_fuel_dancoff = np.array(self._fuel_dancoff_corrections)
+        base_clad_dancoff = np.array(self._clad_dancoff_corrections)
+        base_critical_spectrum = self._critical_spectrum
+        base_solution = (self._asmbly_moc.keff, np.array(self._asmbly_moc.flux_array))
+
+        # Branch solutions must not be extrapolated from by the base solves
+        self._asmbly_moc.record_solutions = False
+
+        for b, branch in enumerate(self.branches):
+            scarabee_log(LogLevel.Info, "Branch {:}: {:}".format(b, branch))
+
+            boron_ppm = base[0] if branch.boron_ppm is None else branch.boron_ppm
+            mod_temp = base[1]
+            if branch.moderator_temp is not None:
+                mod_temp = branch.moderator_temp
+            mod_pressure = base[2]
+            if branch.moderator_pressure is not None:
+                mod_pressure = branch.moderator_pressure
+            fuel_temps = base[4]
+            if branch.fuel_temp is not None:
+                fuel_temps = len(fuel_temps) * [branch.fuel_temp]
+            same_moderator = (boron_ppm, mod_temp, mod_pressure) == base[:3]
+            self._set_branch_state(
+                boron_ppm,
+                mod_temp,
+                mod_pressure,
+                base[3] if same_moderator else None,
+                fuel_temps,
+            )
+
+            # Dancoff corrections only depend on the potential cross sections
+            new_dancoff = (
+                abs(self.moderator.potential_xs - base_pot_xs)
+                > _BRANCH_DANCOFF_RTOL * base_pot_xs
+            )
+            if new_dancoff:
+                self.set_dancoff_moderator_xs()
+                self.compute_dancoff_corrections()
+                self.apply_dancoff_corrections()
+
+            self.recompute_all_xs()
+
+            set_logging_level(LogLevel.Warning)
+            self._asmbly_moc.solve()
+            set_logging_level(LogLevel.Info)
+            scarabee_log(LogLevel.Info, "Kinf: {:.5f}".format(self._asmbly_moc.keff))
+            keffs.append(self._asmbly_moc.keff)
+
+            self.apply_leakage_model()
+            self.obtain_flux_spectra()
+            self.normalize_flux_to_power()
+            self.apply_infinite_spectrum()
+            diffusion_data.append(self._compute_diffusion_data())
+
+            if new_dancoff:
+                for row in self.cells:
+                    for cell in row:
+                        cell.pop_dancoff_corrections()
+                self._fuel_dancoff_corrections = np.array(base_fuel_dancoff)
+                self._clad_dancoff_corrections = np.array(base_clad_dancoff)
+            scarabee_log(LogLevel.Info, "")
+
+        # Restore the base state
+        self._set_branch_state(*base)
+        self.set_dancoff_moderator_xs()
+        self.recompute_all_xs()
+        for row, row_spectra in zip(self.cells, base_spectra):
+            for cell, spectra in zip(row, row_spectra):
+                cell.restore_flux_spectra_state(spectra)
+        self._critical_spectrum = base_critical_spectrum
+        self._asmbly_moc.set_initial_solution(*base_solution)
+        self._asmbly_moc.record_solutions = True
+
+        return keffs, diffusion_data
+
     def _predict_depletion(self, dt: float, dtm1: Optional[float]) -> None:
-        # Do all depletions in parallel
-        threads = []
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                threads.append(
-                    Thread(
-                        target=cell.predict_depletion,
-                        args=(self._chain, self._ndl, dt, dtm1),
-                    )
+        # Do all depletions at once, in parallel, once per class of symmetric
+        # cells, which then share the depleted materials
+        classes = self._cell_classes()
+        requests = [pc.rep.predictor_depletion_requests(dt, dtm1) for pc in classes]
+        results = deplete_materials(
+            self._chain, [req for reqs in requests for req in reqs], self._ndl
+        )
+
+        offset = 0
+        for pc, reqs in zip(classes, requests):
+            for cell in pc.cells:
+                cell.set_predictor_depletion_results(
+                    results[offset : offset + len(reqs)]
                 )
-                threads[-1].start()
-        for t in threads:
-            t.join()
+            offset += len(reqs)
 
     def _correct_depletion(self, dt: float, dtm1: Optional[float]) -> None:
-        # Do all depletions in parallel
-        threads = []
-        for j in range(len(self.cells)):
-            for i in range(len(self.cells[j])):
-                cell = self.cells[j][i]
-                threads.append(
-                    Thread(
-                        target=cell.correct_depletion,
-                        args=(self._chain, self._ndl, dt, dtm1),
-                    )
+        # Do all depletions at once, in parallel, once per class of symmetric
+        # cells, which then share the depleted materials
+        classes = self._cell_classes()
+        requests = [pc.rep.corrector_depletion_requests(dt, dtm1) for pc in classes]
+        results = deplete_materials(
+            self._chain, [req for reqs in requests for req in reqs], self._ndl
+        )
+
+        offset = 0
+        for pc, reqs in zip(classes, requests):
+            for cell in pc.cells:
+                cell.set_corrector_depletion_results(
+                    results[offset : offset + len(reqs)]
                 )
-                threads[-1].start()
-        for t in threads:
-            t.join()
+            offset += len(reqs)
+
+    def _make_checkpoint(self, completed_steps: int) -> DepletionCheckpoint:
+        checkpoint = DepletionCheckpoint()
+        checkpoint.completed_steps = completed_steps
+        checkpoint.keff = list(self._keff[:completed_steps])
+        checkpoint.exposures = list(self._exposures[:completed_steps])
+        checkpoint.times = list(self._times[:completed_steps])
+
+        materials, matrices, fuel_dancoff, clad_dancoff = [], [], [], []
+        for row in self.cells:
+            for cell in row:
+                m, a, f, c = cell.depletion_checkpoint_state()
+                materials += m
+                matrices += a
+                fuel_dancoff += f
+                clad_dancoff += c
+        checkpoint.material_histories = materials
+        checkpoint.previous_matrices = matrices
+        checkpoint.fuel_dancoff_corrections = fuel_dancoff
+        checkpoint.clad_dancoff_corrections = clad_dancoff
+
+        checkpoint.moc_keff = self._asmbly_moc.keff
+        checkpoint.moc_flux = np.array(self._asmbly_moc.flux_array)
+        checkpoint.diffusion_data = list(self._diffusion_data)
+        checkpoint.branch_keff = [list(k) for k in self._branch_keff]
+        checkpoint.branch_diffusion_data = [
+            list(d) for d in self._branch_diffusion_data
+        ]
+        return checkpoint
+
+    def _restore_checkpoint(self, checkpoint: DepletionCheckpoint) -> int:
+        steps = checkpoint.completed_steps
+        if steps > self.depletion_time_steps.size:
+            raise ValueError("Checkpoint has more steps than the depletion.")
+
+        exposures = np.zeros(self.depletion_exposure_steps.size + 1)
+        exposures[1:] = np.cumsum(self.depletion_exposure_steps)
+        if not np.allclose(checkpoint.exposures, exposures[:steps]):
+            raise ValueError("Checkpoint exposures do not match depletion steps.")
+
+        # Properties of the checkpoint are copies, so they are only read once
+        materials = checkpoint.material_histories
+        matrices = checkpoint.previous_matrices
+        fuel_dancoff = checkpoint.fuel_dancoff_corrections
+        clad_dancoff = checkpoint.clad_dancoff_corrections
+
+        mi, fi, ci = 0, 0, 0
+        for row in self.cells:
+            for cell in row:
+                m, _, f, c = cell.depletion_checkpoint_state()
+                cell.restore_depletion_checkpoint_state(
+                    materials[mi : mi + len(m)],
+                    matrices[mi : mi + len(m)],
+                    fuel_dancoff[fi : fi + len(f)],
+                    clad_dancoff[ci : ci + len(c)],
+                )
+                mi += len(m)
+                fi += len(f)
+                ci += len(c)
+
+        if mi != len(materials) or fi != len(fuel_dancoff) or ci != len(clad_dancoff):
+            raise ValueError("Checkpoint does not match the assembly cells.")
+
+        self._keff[:steps] = checkpoint.keff
+        self._exposures[:steps] = checkpoint.exposures
+        self._times[:steps] = checkpoint.times
+        self._diffusion_data = list(checkpoint.diffusion_data)
+        self._branch_keff = [list(k) for k in checkpoint.branch_keff]
+        self._branch_diffusion_data = [
+            list(d) for d in checkpoint.branch_diffusion_data
+        ]
+
+        moc_flux = checkpoint.moc_flux
+        if moc_flux.size > 0:
+            self._initial_moc_solution = (checkpoint.moc_keff, moc_flux)
+
+        scarabee_log(
+            LogLevel.Info,
+            'Resuming depletion after step {:} from "{:}".'.format(
+                steps, self.checkpoint_file
+            ),
+        )
+        return steps
 
     def _run_depletion_steps(self) -> None:
         if self._chain is None:
@@ -3039,8 +3953,22 @@ class PWRAssembly:
         self._exposures = np.zeros(self.depletion_exposure_steps.size + 1)
         self._times = np.zeros(self.depletion_exposure_steps.size + 1)
         self._diffusion_data = []
+        self._branch_keff = []
+        self._branch_diffusion_data = []
+
+        first_step = 0
+        writer: Optional[CheckpointWriter] = None
+        if self.checkpoint_file is not None:
+            writer = CheckpointWriter()
+            if os.path.exists(self.checkpoint_file):
+                first_step = self._restore_checkpoint(
+                    DepletionCheckpoint.load(self.checkpoint_file)
+                )
 
         for t, dt in enumerate(self.depletion_time_steps):
+            if t < first_step:
+                continue
+
             if t > 0:
                 self._exposures[t] = (
                     self._exposures[t - 1] + self.depletion_exposure_steps[t - 1]
@@ -3064,26 +3992,38 @@ class PWRAssembly:
 
             scarabee_log(LogLevel.Info, "Predictor:")
             # Run initial calcualtion for this time step
-            self._run_assembly_calculation(True)
+            self._run_assembly_calculation(True, exposure=self._exposures[t])
             scarabee_log(LogLevel.Info, "")
             self._keff[t] = self._asmbly_moc.keff
             self._diffusion_data.append(self._compute_diffusion_data())
+            branch_keff, branch_diffusion_data = self._run_branches()
+            self._branch_keff.append(branch_keff)
+            self._branch_diffusion_data.append(branch_diffusion_data)
 
             # Predic isotopes at midpoint of step
             self._predict_depletion(dt_sec, dtm1_sec)
 
             scarabee_log(LogLevel.Info, "Corrector:")
             # Run the a new transport calcualtion to get rates
-            self._run_assembly_calculation(False, transport=self.corrector_transport)
+            # The predicted compositions are those at the end of the step
+            self._run_assembly_calculation(
+                False,
+                transport=self.corrector_transport,
+                exposure=self._exposures[t] + self.depletion_exposure_steps[t],
+            )
 
             # Do correction step for isotopes
             self._correct_depletion(dt_sec, dtm1_sec)
 
+            # The checkpoint is written while the next step is running
+            if writer is not None:
+                writer.write(self._make_checkpoint(t + 1), self.checkpoint_file)
+
         # Run last step at the end to get keff for our final material compositions
         scarabee_log(LogLevel.Info, "")
         scarabee_log(LogLevel.Info, 60 * "-")
         self._exposures[-1] = self._exposures[-2] + self.depletion_exposure_steps[-1]
-        self._times[-1] = self._times[-2] + dt
+        self._times[-1] = self._times[-2] + self.depletion_time_steps[-1]
         scarabee_log(
             LogLevel.Info, "Running Time Step {:}".format(self._times.size - 1)
         )
@@ -3092,11 +4032,17 @@ class PWRAssembly:
         )
         scarabee_log(LogLevel.Info, "Time    : {:.3E} days".format(self._times[-1]))
         scarabee_log(LogLevel.Info, "")
-        self._run_assembly_calculation(True)
+        self._run_assembly_calculation(True, exposure=self._exposures[-1])
         self._keff[-1] = self._asmbly_moc.keff
         self._diffusion_data.append(self._compute_diffusion_data())
+        branch_keff, branch_diffusion_data = self._run_branches()
+        self._branch_keff.append(branch_keff)
+        self._branch_diffusion_data.append(branch_diffusion_data)
         scarabee_log(LogLevel.Info, "")
 
+        if writer is not None:
+            writer.wait()
+
     def solve(self) -> None:
         """
         Solves the assembly problem. If depletion_exposure_steps or
@@ -3108,6 +4054,7 @@ class PWRAssembly:
             self._run_assembly_calculation(True)
             self._keff = self._asmbly_moc.keff
             self._diffusion_data = self._compute_diffusion_data()
+            self._branch_keff, self._branch_diffusion_data = self._run_branches()
         else:
             # Run depletion steps
             self._run_depletion_steps()
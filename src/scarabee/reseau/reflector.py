@@ -5,11 +5,11 @@ from .._scarabee import (
     DiffusionCrossSection,
     DiffusionData,
     ReflectorSN,
+    NodalFlux1D,
     set_logging_level,
     scarabee_log,
     LogLevel,
 )
-from .nodal_flux import NodalFlux1D
 
 import numpy as np
 #import matplotlib.pyplot as plt
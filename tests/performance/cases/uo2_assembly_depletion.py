@@ -0,0 +1,71 @@
+"""
+Reduced depletion of a 1.6% enriched 17x17 PWR assembly of the BEAVRS core,
+with quarter symmetry and a few short exposure steps. Requires the nuclear
+data library given by SCARABEE_ND_LIBRARY.
+"""
+
+import numpy as np
+from scarabee import (
+    NDLibrary,
+    MaterialComposition,
+    Material,
+    Fraction,
+    DensityUnits,
+)
+from scarabee.reseau import FuelPin, GuideTube, PWRAssembly, Symmetry
+
+ndl = NDLibrary()
+
+FuelComp = MaterialComposition(Fraction.Atoms, name="Fuel 1.6%")
+FuelComp.add_leu(1.6, 1.0)
+FuelComp.add_element("O", 2.0)
+Fuel = Material(FuelComp, 575.0, 10.31341, DensityUnits.g_cm3, ndl)
+
+CladComp = MaterialComposition(Fraction.Weight, name="Zircaloy 4")
+CladComp.add_element("O", 0.00125)
+CladComp.add_element("Cr", 0.0010)
+CladComp.add_element("Fe", 0.0021)
+CladComp.add_element("Zr", 0.98115)
+CladComp.add_element("Sn", 0.0145)
+Clad = Material(CladComp, 575.0, 6.55, DensityUnits.g_cm3, ndl)
+
+HeComp = MaterialComposition(Fraction.Atoms, name="He Gas")
+HeComp.add_element("He", 1.0)
+He = Material(HeComp, 575.0, 0.0015981, DensityUnits.g_cm3, ndl)
+
+gt = GuideTube(inner_radius=0.56134, outer_radius=0.60198, clad=Clad)
+
+fp = FuelPin(
+    fuel=Fuel,
+    fuel_radius=0.39218,
+    gap=He,
+    gap_radius=0.40005,
+    clad=Clad,
+    clad_radius=0.45720,
+)
+
+cells = [
+    [fp, fp, fp, fp, fp, fp, fp, fp, fp],
+    [fp, fp, fp, fp, fp, fp, fp, fp, fp],
+    [gt, fp, fp, gt, fp, fp, fp, fp, fp],
+    [fp, fp, fp, fp, fp, gt, fp, fp, fp],
+    [fp, fp, fp, fp, fp, fp, fp, fp, fp],
+    [gt, fp, fp, gt, fp, fp, gt, fp, fp],
+    [fp, fp, fp, fp, fp, fp, fp, fp, fp],
+    [fp, fp, fp, fp, fp, fp, fp, fp, fp],
+    [gt, fp, fp, gt, fp, fp, gt, fp, fp],
+]
+
+asmbly = PWRAssembly(
+    pitch=1.25984,
+    assembly_pitch=21.50364,
+    shape=(17, 17),
+    symmetry=Symmetry.Quarter,
+    moderator_pressure=15.5132,
+    moderator_temp=575.0,
+    boron_ppm=975.0,
+    cells=cells,
+    ndl=ndl,
+)
+asmbly.depletion_exposure_steps = np.array([0.1, 0.4, 0.5])
+asmbly.solve()
@@ -0,0 +1,86 @@
+import json
+import os
+
+import pytest
+
+BASELINES = os.path.join(os.path.dirname(__file__), "baselines.json")
+
+
+def pytest_addoption(parser):
+    group = parser.getgroup("performance")
+    group.addoption(
+        "--perf-results",
+        default="performance_results.json",
+        help="File where the measurements of the performance cases are written.",
+    )
+    group.addoption(
+        "--perf-tolerance",
+        type=float,
+        default=0.2,
+        help="Relative increase of wall time or peak RSS over the baseline "
+        "which is reported as a regression.",
+    )
+    group.addoption(
+        "--perf-update-baselines",
+        action="store_true",
+        help="Store the measurements as the new baselines instead of "
+        "comparing against them.",
+    )
+
+
+def pytest_configure(config):
+    config.addinivalue_line(
+        "markers",
+        "performance: end-to-end timing of a representative workflow, only "
+        'run when selected with -m "performance"',
+    )
+
+
+def pytest_collection_modifyitems(config, items):
+    # The performance cases take minutes, and only run when asked for
+    if "performance" in (config.getoption("markexpr") or ""):
+        return
+
+    skip = pytest.mark.skip(reason='select with -m "performance" to run')
+    for item in items:
+        if "performance" in item.keywords:
+            item.add_marker(skip)
+
+
+class PerformanceRecord:
+    def __init__(self, config):
+        self.config = config
+        self.results = {}
+        if os.path.exists(BASELINES):
+            with open(BASELINES) as f:
+                self.baselines = json.load(f)
+        else:
+            self.baselines = {}
+
+    @property
+    def tolerance(self):
+        return self.config.getoption("--perf-tolerance")
+
+    @property
+    def update_baselines(self):
+        return self.config.getoption("--perf-update-baselines")
+
+    def save(self):
+        if not self.results:
+            return
+
+        with open(self.config.getoption("--perf-results"), "w") as f:
+            json.dump(self.results, f, indent=2, sort_keys=True)
+
+        if self.update_baselines:
+            self.baselines.update(self.results)
+            with open(BASELINES, "w") as f:
+                json.dump(self.baselines, f, indent=2, sort_keys=True)
+                f.write("\n")
+
+
+@pytest.fixture(scope="session")
+def perf_record(request):
+    record = PerformanceRecord(request.config)
+    yield record
+    record.save()
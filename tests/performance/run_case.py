@@ -0,0 +1,84 @@
+"""
+Runs one performance case in the current process and prints its metrics as
+JSON on the last line of stdout. It is started in a fresh interpreter by the
+performance tests, so that the peak RSS is that of the case alone.
+
+Usage: python run_case.py <script> [<solver variable> ...]
+
+The script is run as __main__, with matplotlib windows disabled. Each solver
+variable named is looked up in the globals of the script once it has run,
+and its keff and telemetry are recorded.
+"""
+
+import json
+import os
+import runpy
+import sys
+import time
+
+os.environ.setdefault("MPLBACKEND", "Agg")
+
+
+def peak_rss_bytes():
+    try:
+        import resource
+    except ImportError:  # Windows
+        return None
+
+    rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # Linux reports kilobytes, macOS bytes
+    return rss if sys.platform == "darwin" else 1024 * rss
+
+
+def solver_metrics(solver):
+    metrics = {}
+    if hasattr(solver, "keff"):
+        metrics["keff"] = solver.keff
+
+    if hasattr(solver, "telemetry"):
+        tel = solver.telemetry
+        metrics["iterations"] = tel.iterations
+        metrics["phase_times"] = tel.phase_times
+        metrics["counters"] = tel.counters
+        metrics["memory"] = tel.memory
+
+    if hasattr(solver, "memory_usage"):
+        metrics["memory_usage"] = solver.memory_usage()
+
+    cmfd = getattr(solver, "cmfd", None)
+    if cmfd is not None and hasattr(cmfd, "telemetry"):
+        metrics["cmfd_phase_times"] = cmfd.telemetry.phase_times
+
+    return metrics
+
+
+def main():
+    script = os.path.abspath(sys.argv[1])
+    solver_names = sys.argv[2:]
+
+    try:
+        import matplotlib.pyplot as plt
+
+        plt.show = lambda *args, **kwargs: plt.close("all")
+    except ImportError:
+        pass
+
+    # Files written by the script land next to it, as when run by hand
+    os.chdir(os.path.dirname(script))
+
+    start = time.perf_counter()
+    script_globals = runpy.run_path(script, run_name="__main__")
+    wall_time = time.perf_counter() - start
+
+    result = {
+        "wall_time": wall_time,
+        "peak_rss": peak_rss_bytes(),
+        "solvers": {
+            name: solver_metrics(script_globals[name]) for name in solver_names
+        },
+    }
+    print(json.dumps(result))
+
+
+if __name__ == "__main__":
+    main()
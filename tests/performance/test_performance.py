@@ -0,0 +1,108 @@
+import json
+import os
+import subprocess
+import sys
+
+import pytest
+
+"""
+End-to-end performance tests of representative workflows. Each case runs in
+its own interpreter, and its wall time, peak RSS, iteration counts and phase
+times are written to the results file, then compared against the baselines
+stored in baselines.json.
+
+Run with:
+    pytest -m performance tests/performance
+and store new baselines, on the reference machine, with:
+    pytest -m performance tests/performance --perf-update-baselines
+"""
+
+HERE = os.path.dirname(__file__)
+EXAMPLES = os.path.join(HERE, "..", "..", "examples")
+
+# Name of each case, the script it runs, and the solver variables of the
+# script whose telemetry is recorded
+CASES = [
+    ("c5g7", os.path.join(EXAMPLES, "c5g7.py"), ["moc"]),
+    ("biblis", os.path.join(EXAMPLES, "biblis.py"), ["solver"]),
+    ("nem_iaea3d", os.path.join(EXAMPLES, "nem_iaea3d.py"), ["solver"]),
+    (
+        "uo2_assembly_depletion",
+        os.path.join(HERE, "cases", "uo2_assembly_depletion.py"),
+        ["asmbly"],
+    ),
+]
+
+NEEDS_ND_LIBRARY = {"uo2_assembly_depletion"}
+
+
+def run_case(script, solvers):
+    proc = subprocess.run(
+        [sys.executable, os.path.join(HERE, "run_case.py"), script] + solvers,
+        capture_output=True,
+        text=True,
+    )
+    if proc.returncode != 0:
+        pytest.fail(
+            "Case {} failed:\n{}".format(os.path.basename(script), proc.stderr)
+        )
+    return json.loads(proc.stdout.strip().splitlines()[-1])
+
+
+def regressions(name, result, baseline, tolerance):
+    found = []
+
+    def check(label, value, base, tol):
+        if value is None or base is None or base <= 0:
+            return
+        if value > (1.0 + tol) * base:
+            found.append(
+                "{}: {} went from {:.4g} to {:.4g} (+{:.1f}%)".format(
+                    name, label, base, value, 100.0 * (value / base - 1.0)
+                )
+            )
+
+    check("wall time", result["wall_time"], baseline.get("wall_time"), tolerance)
+    check("peak RSS", result["peak_rss"], baseline.get("peak_rss"), tolerance)
+
+    for solver, metrics in result["solvers"].items():
+        base = baseline.get("solvers", {}).get(solver, {})
+        # A change in the number of iterations is not noise
+        check(
+            solver + " iterations",
+            metrics.get("iterations"),
+            base.get("iterations"),
+            0.0,
+        )
+        for phase, t in metrics.get("phase_times", {}).items():
+            check(
+                solver + " " + phase + " time",
+                t,
+                base.get("phase_times", {}).get(phase),
+                tolerance,
+            )
+
+    return found
+
+
+@pytest.mark.performance
+class TestPerformance:
+    @pytest.mark.parametrize(
+        "name,script,solvers", CASES, ids=[case[0] for case in CASES]
+    )
+    def test_case(self, perf_record, name, script, solvers):
+        if name in NEEDS_ND_LIBRARY and "SCARABEE_ND_LIBRARY" not in os.environ:
+            pytest.skip("SCARABEE_ND_LIBRARY is not set")
+
+        result = run_case(script, solvers)
+        perf_record.results[name] = result
+
+        if perf_record.update_baselines:
+            return
+
+        baseline = perf_record.baselines.get(name)
+        if baseline is None:
+            pytest.skip("No baseline stored for " + name)
+
+        found = regressions(name, result, baseline, perf_record.tolerance)
+        assert not found, "Performance regressions:\n" + "\n".join(found)